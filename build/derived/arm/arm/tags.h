@@ -0,0 +1 @@
+/* generated: tags.h (compat) */
@@ -0,0 +1,900 @@
+/*
+ * Copyright (C) Advanced RISC Machines Limited and
+ *               Codemist Limited, 19126.
+ * All rights reserved.
+ *
+ * build/derived/arm/thumb/headers.c, created by genhdrs on Sun Oct 18 11:32:35 2026
+ */
+
+static const unsigned short int compression_info[256] = {
+    0x0000, 0x0a23, 0x696e, 0x0a20, 0x7420, 0x6520, 0x6465, 0x5f5f, 
+    0x0666, 0x6c6f, 0x000a, 0x293b, 0x6f75, 0x0802, 0x0d05, 0x626c, 
+    0x640c, 0x6966, 0x100f, 0x010e, 0x1205, 0x202a, 0x6172, 0x0303, 
+    0x0204, 0x0a0a, 0x2007, 0x6368, 0x6e67, 0x091c, 0x1b16, 0x1d20, 
+    0x0020, 0x0021, 0x0022, 0x0023, 0x6609, 0x2c20, 0x0026, 0x0b0a, 
+    0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 
+    0x2461, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 
+    0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 
+    0x0165, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 
+    0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x6e64, 
+    0x1e15, 0x030a, 0x636f, 0x7f11, 0x0111, 0x4004, 0x6083, 0x6628, 
+    0x1f14, 0x7369, 0x7374, 0x6572, 0x4646, 0x7304, 0x826e, 0x8e8d, 
+    0x7265, 0x2920, 0x655f, 0x6c75, 0x8020, 0x7970, 0x8a72, 0x6d61, 
+    0x081a, 0x494c, 0x7495, 0x766f, 0x6964, 0x9373, 0x9b9c, 0x709d, 
+    0x4699, 0xa045, 0x7829, 0x897a, 0x8f94, 0x616c, 0x0b81, 0x9a65, 
+    0x6c28, 0x7365, 0x5349, 0xa392, 0x3634, 0x2031, 0x7261, 0x0820, 
+    0x28a2, 0x5354, 0x2028, 0x8785, 0x1520, 0x4552, 0x6578, 0x5f4d, 
+    0xa888, 0x2785, 0x2788, 0x2814, 0x6304, 0x0b17, 0x0274, 0x4f4e, 
+    0xab04, 0x2030, 0x5f56, 0x676e, 0x8498, 0x1919, 0x846e, 0x6797, 
+    0x70ae, 0xc720, 0xc8c9, 0x6173, 0x2929, 0x01ca, 0x0b03, 0x3939, 
+    0x9096, 0xd069, 0x0120, 0x5f6f, 0x6f72, 0x860a, 0x2928, 0x4443, 
+    0x746f, 0xb1d7, 0x494e, 0x639f, 0x645f, 0x8c8c, 0xaabf, 0xb5de, 
+    0xc2df, 0xdb9f, 0xd9e0, 0xe207, 0x0763, 0x1f18, 0x616e, 0x725f, 
+    0x748b, 0x756e, 0x9128, 0xc698, 0x0313, 0x2c03, 0x3b20, 0x6973, 
+    0x6e20, 0xd1bc, 0xa1b4, 0xd20e, 0x3031, 0x89c3, 0xcb73, 0x6c65, 
+    0xb3ba, 0xb741, 0xc178, 0x1307, 0x205f, 0x2a20, 0x4074, 0x6666};
+
+typedef struct {
+    const char *name;
+    int content;
+} header_files;
+
+static const header_files builtin_headers[] = {
+   {"assert.h", 0},
+   {"ctype.h", 294},
+   {"errno.h", 850},
+   {"float.h", 1078},
+   {"iso646.h", 1930},
+   {"limits.h", 2056},
+   {"locale.h", 2399},
+   {"math.h", 2906},
+   {"setjmp.h", 6809},
+   {"signal.h", 7055},
+   {"stdarg.h", 7328},
+   {"stddef.h", 8108},
+   {"stdio.h", 8407},
+   {"stdlib.h", 11077},
+   {"string.h", 12314},
+   {"time.h", 12733},
+   {0, 0}};
+
+static const unsigned char string_data[] = {
+    205,102,212, 99,146,216,112, 95,247,118,101,108,197,197, 25,235,
+    246,139,116, 95,104,243,  7,246,139,116, 95,104,196,225,  3,182,
+    232,240, 34, 67, 34, 32,158, 26,246,139,116, 40,143,128, 37,143,
+    128, 37,190,206,182,232,240, 34, 67, 34, 32,158, 26,246,139,116,
+     50, 40,143,128, 37,143,128, 37,143,128, 37,190, 11, 96,108,169,
+      3,182,232,240,158, 26,246,139,116, 40,143,128, 37,143,128, 37,
+    190,206,182,232,240,158, 26,246,139,116, 50, 40,143,128, 37,143,
+    128, 37,143,128, 37,190, 11,210, 17, 26,227, 32, 62, 61, 32, 50,
+    244, 49, 49, 50,243,138, 97,116,105, 99, 95,246,139,  4, 95, 83,
+    116, 97,116,105, 99, 95,246,139,116,210,101,131,134, 96,108,169,
+    210,233,175,246,139,116,213,132,175, 78, 68, 69, 66, 85, 71,243,
+    246,139,116, 40,105,195,111,144,234, 40,158, 41, 48, 41, 96,108,
+    169,243,246,139,116, 40,101,234, 40,101,145, 63,178,158, 41, 48,
+     32, 58, 26,246,139,116, 40, 35,101, 44, 26,161,  7, 44, 26, 76,
+    218, 69,  7,204,210, 17, 26,227, 32, 62, 61,173,207, 57,244,210,
+    233,175,246,139,116,243,246,139,116, 40,101,234, 40,101,145, 63,
+    178,158, 41, 48, 32, 58, 26,246,139,116, 50, 40, 35,101, 44, 26,
+    102,233, 99,  7, 44, 26,161,  7, 44, 26, 76,218, 69,  7,204,210,
+    101,131,134, 25, 10,  0,205,102,212, 99,146,216,112, 95,247,118,
+    101,108,205,  2, 99,147,  6,211,110,108,121,211,110, 99,101,197,
+    197,235, 99,154,146,104, 19,228,154,146,104, 25, 10,251, 83,173,
+     32,251, 80, 32, 50, 32,251, 66, 32, 52, 32,251, 76, 32, 56, 32,
+    251, 85,173, 54, 32,251, 78, 32, 51, 50, 32,251, 67, 32,172, 32,
+    251, 88,173, 50, 56, 32, 10,196,225, 10,182,232,240, 34, 67, 34,
+     32,123,134,132,175, 83, 89,177, 69, 77, 95,177, 65, 84, 73, 67,
+     83, 10,182,232,240,233,245,101,100, 32,128,228,167, 59, 96,108,
+    169, 10,182,232,240,233,245,101,100, 32, 30, 26, 99,167, 91, 93,
+     59,213, 19,239,165,110,117,109, 40, 99,234,228,167, 91, 99, 93,
+     32, 38,178,  7, 85, 43,  7, 76, 43,  7, 78,204,129, 19,239,165,
+    112,104, 97, 40, 99,234,228,167, 91, 99, 93, 32, 38,178,  7, 85,
+     43,  7, 76,204,  3, 25, 24,239, 15,230,107, 40, 24,166, 19,239,
+     99,110,116,114,168, 99,234,228,167, 91, 99, 93, 32, 38, 26, 67,
+     41, 23, 10, 19,239,100,105,103,105,116, 40, 99,234,228,167, 91,
+     99, 93, 32, 38, 26, 78, 41,129, 19,239,103,174,112,104, 40, 99,
+    234,228,167, 91, 99, 93, 32, 38,178,  7, 76, 43,  7, 85, 43,  7,
+     78, 43,  7, 80,204,129, 19,239,  9,119,139, 40, 99,234,228,167,
+     91, 99, 93, 32, 38, 26, 76, 41,129, 19,239,112,114,190, 40, 99,
+    234,228,167, 91, 99, 93, 32, 38,178,  7, 76, 43,  7, 85, 43,  7,
+     78, 43,  7, 80, 43,  7, 66,204, 23, 10, 19,239,112,233, 99,116,
+     40, 99,234,228,167, 91, 99, 93, 32, 38, 26, 80, 41,129, 19,239,
+    115,112, 97, 99,101, 40, 99,234,228,167, 91, 99, 93, 32, 38, 26,
+     83, 41,129, 19,239,117,112,112,139, 40, 99,234,228,167, 91, 99,
+     93, 32, 38, 26, 85, 41,129, 19,239,120,100,105,103,105,116, 40,
+     99,234,228,167, 91, 99, 93, 32, 38,178,  7, 78, 43,  7, 88,204,
+    129,235,225, 10, 24, 40,239,165,110,117,109,214, 24, 39, 24, 40,
+    239,165,112,104, 97,214, 24, 39, 24, 40,239, 99,110,116,114,108,
+    214, 24, 39, 24, 40,239,100,105,103,105,116,214, 24, 39, 24, 40,
+    239,103,174,112,104,214, 24, 39, 24, 40,239,  9,119,139,214, 24,
+     39, 24, 40,239,112,114,190,214, 24, 39, 24, 40,239,112,233, 99,
+    116,214, 24, 39, 24, 40,239,115,112, 97, 99,101,214, 24, 39, 24,
+     40,239,117,112,112,139,214, 24, 39, 24, 40,239,120,100,105,103,
+    105,116,214, 24, 11,134, 25, 24,216,  9,119,139, 40, 24,189, 25,
+     24,116, 12,112,112,139, 40, 24,189,196,225, 10,125,213,134, 25,
+     10,  0,205,102,212, 99,146,216,112, 95,247,118,101,108,205,  2,
+     99,147,  6,211,110,108,121,211,110, 99,101,197, 25,235,139,114,
+    110,111, 95,104,251,139,114,110,111, 95,104, 10,198,175,139,114,
+    110,111,132,175, 83, 89,177, 69, 77, 95,177, 65, 84, 73, 67, 83,
+     19,139,114,110,111, 21,  7,139,114,110,111,196,225, 10,182,232,
+    240, 34, 67, 34, 32, 24, 42,  7,139,114,110,111, 59, 96,108,169,
+     10,182,232,240,155,108, 97,116,105,108,  5, 24, 42,  7,139,114,
+    110,111, 59,134, 96,108,169, 19,139,114,110,111, 26,139,114,110,
+    111,196,225, 10,182,232,240, 34, 67, 34, 32, 24,139,114,110,111,
+     59,  3, 96,108,169, 10,182,232,240,155,108, 97,116,105,108,  5,
+     24,139,114,110,111, 59,134,134,134,129, 19, 69, 68, 79, 77,173,
+    129, 19,181, 65, 78, 71, 69, 32, 50,129, 19, 69,170, 71, 78, 85,
+     77, 32, 51,129, 19, 69,153, 83, 69, 81, 32, 52,129, 19, 69, 79,
+     86,181, 70, 76, 79, 87, 32, 53,129, 19, 69, 70, 66, 73, 71, 32,
+     54,129,134, 25, 10,  0,205,102,212, 99,146,216,112, 95,247,118,
+    101,108,205,  2, 99,147,  6,211,110,108,121,211,110, 99,101,197,
+     25,235,254, 95,104,251,254, 95,104, 10, 19, 70, 76, 84, 95, 82,
+     65, 68, 73, 88, 32, 50,236, 70, 76, 84, 95, 82, 79, 85, 78, 68,
+     83,173,236, 70, 76, 84, 95, 69, 86, 65, 76,183, 69, 84, 72, 79,
+     68,193,129, 19, 70, 76, 84, 95, 72, 65, 83, 95, 83, 85, 66, 78,
+     79, 82, 77,173, 19, 68, 66, 76, 95, 72, 65, 83, 95, 83, 85, 66,
+     78, 79, 82, 77,173, 19, 76, 68, 66, 76, 95, 72, 65, 83, 95, 83,
+     85, 66, 78, 79, 82, 77,173,129, 19, 70, 76, 84,249, 78, 84, 95,
+     68, 73, 71, 32, 50, 52, 19, 68, 66, 76,249, 78, 84, 95, 68, 73,
+     71, 32, 53, 51, 19, 76, 68, 66, 76,249, 78, 84, 95, 68, 73, 71,
+     32, 53, 51,129, 19, 70, 76, 84, 95, 68, 69, 67, 73, 77, 65, 76,
+     95, 68, 73, 71, 32, 57, 19, 68, 66, 76, 95, 68, 69, 67, 73, 77,
+     65, 76, 95, 68, 73, 71,173, 55, 19, 76, 68, 66, 76, 95, 68, 69,
+     67, 73, 77, 65, 76, 95, 68, 73, 71,173, 55, 23, 10, 19, 68, 69,
+     67, 73, 77, 65, 76, 95, 68, 73, 71,173, 55, 23, 10, 19, 70, 76,
+     84, 95, 68, 73, 71, 32, 54, 19, 68, 66, 76, 95, 68, 73, 71,173,
+     53, 19, 76, 68, 66, 76, 95, 68, 73, 71,173, 53,129, 19, 70, 76,
+     84,183,218, 95, 69, 88, 80,178, 45, 49, 50, 53, 41, 19, 68, 66,
+     76,183,218, 95, 69, 88, 80,178, 45, 49, 48, 50, 49, 41, 19, 76,
+     68, 66, 76,183,218, 95, 69, 88, 80,178, 45, 49, 48, 50, 49, 41,
+     23, 10, 19, 70, 76, 84,183,218, 95, 49, 48, 95, 69, 88, 80,178,
+     45, 51, 55, 41, 19, 68, 66, 76,183,218, 95, 49, 48, 95, 69, 88,
+     80,178, 45, 51, 48, 55, 41, 19, 76, 68, 66, 76,183,218, 95, 49,
+     48, 95, 69, 88, 80,178, 45, 51, 48, 55, 41, 23, 10, 19, 70, 76,
+     84,249, 88, 95, 69, 88, 80,173, 50, 56, 19, 68, 66, 76,249, 88,
+     95, 69, 88, 80,173, 48, 50, 52, 19, 76, 68, 66, 76,249, 88, 95,
+     69, 88, 80,173, 48, 50, 52, 23, 10, 19, 70, 76, 84,249, 88, 95,
+     49, 48, 95, 69, 88, 80, 32, 51, 56, 19, 68, 66, 76,249, 88, 95,
+     49, 48, 95, 69, 88, 80, 32, 51, 48, 56, 19, 76, 68, 66, 76,249,
+     88, 95, 49, 48, 95, 69, 88, 80, 32, 51, 48, 56, 23, 10, 19, 70,
+     76, 84,249, 88, 32, 51, 46, 52, 48, 50, 56, 50, 51, 52, 55,101,
+     43, 51, 56, 70, 19, 68, 66, 76,249, 88,173, 46, 55, 57, 55, 54,
+     57, 51, 49, 51, 52, 56, 54, 50, 51, 49, 53, 55, 49,101, 43, 51,
+     48, 56, 19, 76, 68, 66, 76,249, 88,173, 46, 55, 57, 55, 54, 57,
+     51, 49, 51, 52, 56, 54, 50, 51, 49, 53, 55, 49,101, 43, 51, 48,
+     56, 76,129, 19, 70, 76, 84, 95, 69, 80, 83,153,191,173, 46, 49,
+     57, 50, 48, 57, 50, 57, 48,101, 45, 55, 70, 19, 68, 66, 76, 95,
+     69, 80, 83,153,191, 32, 50, 46, 50, 50, 48, 52, 52, 54, 48, 52,
+     57, 50, 53, 48, 51, 49, 51, 49,101, 45, 49, 54, 19, 76, 68, 66,
+     76, 95, 69, 80, 83,153,191, 32, 50, 46, 50, 50, 48, 52, 52, 54,
+     48, 52, 57, 50, 53, 48, 51, 49, 51, 49,101, 45, 49, 54, 76,129,
+     19, 70, 76, 84,183,218,173, 46, 49, 55, 53, 52, 57, 52, 51, 53,
+    101, 45, 51, 56, 70, 19, 68, 66, 76,183,218, 32, 50, 46, 50, 50,
+     53, 48, 55, 51, 56, 53, 56, 53, 48, 55, 50,244, 51, 56,101, 45,
+     51, 48, 56, 19, 76, 68, 66, 76,183,218, 32, 50, 46, 50, 50, 53,
+     48, 55, 51, 56, 53, 56, 53, 48, 55, 50,244, 51, 56,101, 45, 51,
+     48, 56, 76,129, 19, 70, 76, 84, 95, 84, 82, 85, 69,183,218,173,
+     46, 52,244, 50, 57, 56, 52, 54,101, 45, 52, 53, 70, 19, 68, 66,
+     76, 95, 84, 82, 85, 69,183,218, 32, 52, 46, 57, 52, 48, 54, 53,
+    172, 53, 56, 52, 49, 50, 52, 54, 53, 52, 52,101, 45, 51, 50, 52,
+     19, 76, 68, 66, 76, 95, 84, 82, 85, 69,183,218, 32, 52, 46, 57,
+     52, 48, 54, 53,172, 53, 56, 52, 49, 50, 52, 54, 53, 52, 52,101,
+     45, 51, 50, 52, 76,129,134, 25, 10,  0,205,102,212, 99,146,216,
+    112, 95,247,118,101,108,205,  2, 99,147,  6,211,110,108,121,211,
+    110, 99,101,197, 10,235,239,111,172, 54, 95,104,251,239,111,172,
+     54, 95,104, 10, 19, 97,127, 32, 38, 38, 19, 97,127, 95,101,113,
+     32, 38, 61, 19, 98,105,116, 97,127, 32, 38, 19, 98,105,116,212,
+     32,124, 19,130,109,112,108, 32,126, 19,110,111,  4, 33, 19,110,
+    111,116, 95,101,113, 32, 33, 61, 19,212, 32,124,124, 19,212, 95,
+    101,113, 32,124, 61, 19,120,212, 32, 94, 19,120,212, 95,101,113,
+     32, 94, 61, 10,134, 25, 10,  0,205,102,212, 99,146,216,112, 95,
+    247,118,101,108,205,  2, 99,147,  6,211,110,108,121,211,110, 99,
+    101,197, 25,235,108,105,109,105,116,115, 95,104,251,108,105,109,
+    105,116,115, 95,104, 10, 19, 67, 72, 65, 82, 95, 66, 73, 84, 32,
+     56,236, 83, 67, 72, 65, 82,183,218,178, 45, 48,120, 56, 48, 41,
+    236, 83, 67, 72, 65, 82,249, 88,250, 55, 70,236, 85, 67, 72, 65,
+     82,249, 88,250,140,  3,196, 70, 69, 65, 84, 85, 82, 69, 95,170,
+     71, 78, 69, 68, 95, 67, 72, 65, 82, 19, 67, 72, 65, 82,183,218,
+    178, 45, 48,120, 56, 48, 41,236, 67, 72, 65, 82,249, 88,250, 55,
+     70,  3, 96,108,169, 19, 67, 72, 65, 82,183,218,193,236, 67, 72,
+     65, 82,249, 88,250,140,  3,134, 19, 77, 66, 95, 76, 69, 78,249,
+     88,173, 23, 10, 19, 83, 72, 82, 84,183,218,178, 45, 48,120, 56,
+     48, 48, 48, 41,236, 83, 72, 82, 84,249, 88,250, 55,140, 70,236,
+     85, 83, 72, 82, 84,249, 88,250,221,236,218, 84,183,218,178,126,
+     48,120, 55,221,140, 70, 41,236,218, 84,249, 88,250, 55,221,140,
+     70,236, 85,218, 84,249, 88,250,221,221,236, 76,191, 71,183,218,
+    178,126, 48,120, 55,221,140, 70, 76, 41,236, 76,191, 71,249, 88,
+    250, 55,221,140, 70, 76,236, 85, 76,191, 71,249, 88,250,221,221,
+     76,  3,132, 26,227, 32, 62, 61,173,207, 57,244, 19, 76, 76,191,
+     71,183,218,178,126, 48,120, 55,221,221,221,140, 70, 41,236, 76,
+     76,191, 71,249, 88,250, 55,221,221,221,140, 70,236, 85, 76, 76,
+    191, 71,249, 88,250,221,221,221,221,  3,213,134, 25, 10,  0,205,
+    102,212, 99,146,216,112, 95,247,118,101,108,205,  2, 99,147,  6,
+    211,110,108,121,211,110, 99,101,197, 25,235,  9, 99,165,146,104,
+    251,  9, 99,165,146,104, 25, 10, 19, 76, 67, 95, 67, 79, 76, 76,
+     65, 84, 69,173,236, 76, 67, 95, 67, 84, 89, 80, 69, 32, 50, 23,
+     19, 76, 67,183,191, 69, 84, 65, 82, 89, 32, 52, 23, 19, 76, 67,
+     95, 78, 85, 77,181, 73, 67, 32, 56, 23, 19, 76, 67, 95, 84, 73,
+     77, 69,173, 54,236, 76, 67, 95, 65, 76, 76, 32, 51, 49,129,196,
+    225, 10,182,232,240, 34, 67, 34, 32,128,169,116,  9, 99,165,101,
+     40, 24, 37,164, 11, 96,108,169, 10,182,232,240,128,169,116,  9,
+     99,165,101, 40, 24, 37,164, 11,134,  3, 25,150,117,188,108,142,
+    118, 32,123,  3,128,  6, 99,105,151,108, 95,112,111,190, 59, 23,
+    128,116,104, 12,115, 97,127,115, 95,169,112, 59, 23,  3,128,103,
+    114, 12,112,  2,103, 59, 23,  3,128,190, 95, 99,117,114,231,115,
+    121,109, 98,111,108, 59, 23, 23, 23, 23,128, 99,117,114,144,110,
+     99,121, 95,115,121,109, 98,111,108, 59, 23,128,109,111,110, 95,
+      6, 99,105,151,108, 95,112,111,190, 59, 23,128,109,111,110, 95,
+    116,104, 12,115, 97,127,115, 95,169,112, 59, 23,  3,128,109,111,
+    110, 95,103,114, 12,112,  2,103, 59, 23,  3,128,112,111,137,116,
+    105,118,146,245, 59, 23,  3,128,110,101,103, 97,116,105,118,146,
+    245, 59, 23,  3, 30, 32,190, 95,102,174, 99, 95,100,105,103,105,
+    116,115, 59, 23, 23, 30, 32,102,174, 99, 95,100,105,103,105,116,
+    115, 59, 23,  3, 30, 32,112, 95, 99,115, 95,112,144, 99,101,  6,
+    115, 59, 23,  3, 30, 32,112, 95,169,112, 95, 98,121, 95,115,112,
+     97, 99,101, 59, 23, 23, 30, 32,110, 95, 99,115, 95,112,144, 99,
+    101,  6,115, 59, 23,  3, 30, 32,110, 95,169,112, 95, 98,121, 95,
+    115,112, 97, 99,101, 59, 23, 23, 30, 32,112, 95,245, 95,112,111,
+    115,110, 59, 23,  3, 30, 32,110, 95,245, 95,112,111,115,110, 59,
+     23, 10,129,125, 59, 10,196,225, 10,182,232,240, 34, 67, 34, 32,
+    150,117,188,108,142,118, 21,  9, 99,165,101,142,118, 40,158, 11,
+     96,108,169, 10,182,232,240,150,117,188,108,142,118, 21,  9, 99,
+    165,101,142,118, 40,158, 11,134,129,198,175, 78, 85, 76, 76,243,
+     78, 85, 76, 76,193,213,134, 25, 10,  0,205,102,212, 99,146,216,
+    112, 95,247,118,101,108,205,  2, 99,147,  6,211,110,108,121,211,
+    110, 99,101,197, 25,235,151,116,104, 95,104,251,151,116,104, 95,
+    104, 10,196, 67, 67, 95, 78, 79, 82, 67, 82, 79, 70, 84, 10, 19,
+    228,165,108,139, 95,110, 22,114,111,119,134, 25,167,175,133,254,
+     95,116, 59, 10,167,175, 20, 18,146,116, 59,129,198,175, 72, 85,
+     71, 69,194, 65, 76,243, 72, 85, 71, 69,194, 65, 76, 26,104,117,
+    103,146,118,165,196,225,243, 72, 85, 71, 69, 26,104,117,103,146,
+    118,165, 10,182,232,240, 34, 67, 34, 32,143, 20, 72, 85, 71, 69,
+    194, 65, 76, 59, 96,108,169, 10,182,232,240,143, 20, 72, 85, 71,
+     69,194, 65, 76, 59,134,134, 23, 23, 23, 23, 23, 23, 10,198,175,
+     72, 85, 71, 69,194, 65, 76, 76, 19, 72, 85, 71, 69,194, 65, 76,
+     76,178, 40, 31, 18,101,145, 72, 85, 71, 69,194, 65, 76, 41,134,
+     23, 10,235,225,198,175, 72, 85, 71, 69,194, 65, 76, 70,243, 72,
+     85, 71, 69,194, 65, 76, 70, 32,218, 70,218, 73, 84, 89,213, 19,
+    218, 70,218, 73, 84, 89,193,102, 95, 55, 70, 56, 48, 48, 48, 48,
+     48,236, 78, 65, 78,193,102, 95, 55, 70, 67, 48, 48, 48,244,129,
+     19, 70, 80, 95, 90,181, 79,193, 19, 70, 80, 95, 83, 85, 66, 78,
+     79, 82, 77, 65, 76,173, 19, 70, 80, 95, 78, 79, 82, 77, 65, 76,
+     32, 50, 19, 70, 80, 95,218, 70,218, 73, 84, 69, 32, 51, 19, 70,
+     80, 95, 78, 65, 78, 32, 52,  3,213,196, 70, 80, 95, 70, 65,177,
+     95, 70, 77, 65, 19, 70, 80, 95, 70, 65,177, 95, 70, 77, 65,173,
+    134,196, 70, 80, 95, 70, 65,177, 95, 70, 77, 65, 70, 19, 70, 80,
+     95, 70, 65,177, 95, 70, 77, 65, 70,173,134,196, 70, 80, 95, 70,
+     65,177, 95, 70, 77, 65, 76, 19, 70, 80, 95, 70, 65,177, 95, 70,
+     77, 65, 76,173,134, 23, 10, 19, 70, 80, 95,153, 79, 71, 66, 48,
+    178, 45, 48,120, 55,221,140, 70,145, 19, 70, 80, 95,153, 79, 71,
+     66, 78, 65, 78,178,126, 48,120, 55,221,140, 70,145, 23, 10, 19,
+     77, 65, 84, 72, 95,181, 82, 78, 79,173, 19, 77, 65, 84, 72, 95,
+    181, 82, 69, 88, 67, 69, 80, 84, 32, 50, 10,  1,233,175,151,116,
+    104, 95,139,114,104, 97,127,108,  2,103, 23, 23, 23, 23, 23, 23,
+     23, 23,  3, 25, 23, 23, 23, 23, 23, 23, 23, 23, 10,196,225, 10,
+    182,232,240, 34, 67, 34, 32,123,213,235,225, 25, 10, 47, 47, 35,
+    202,110,111, 95,137,  6, 95,101,255,101, 99,116,115, 10, 47, 47,
+     35,202,102,212, 99,146,102,112, 22,103,115, 95,  2, 95,144,103,
+    115, 10,228,165,108,139, 95,110, 22,114,111,119, 32, 24,  7,102,
+    112, 99,108,246, 17,121,135,254, 39, 24,  7,102,112, 99,108,246,
+     17,121,100, 40, 18,101, 39,228,165,108,139, 95,110, 22,114,111,
+    119, 32, 24,  7,245, 98,105,116,135,254, 39, 24,  7,245, 98,105,
+    116,100, 40, 18,101, 39,228,165,108,139, 95,110, 22,114,111,119,
+     32,133,  7,130,112,121,245,135,254, 44,254, 39, 20,  7,130,112,
+    121,137,103,127, 40, 18,101, 44, 18,101, 39, 47, 47, 35,202,110,
+    111, 95,102,212, 99,146,102,112, 22,103,115, 95,  2, 95,144,103,
+    115, 10, 47, 47, 35,202,137,  6, 95,101,255,101, 99,116,115, 10,
+    196,225, 19,228,108,246,151, 99,114,111, 40,102,110, 44,114,234,
+    163,101,111,135,114,145, 61, 61, 32, 52, 32, 63, 26, 35, 35,102,
+    110, 35, 35,135, 40,254,214,114, 41,145, 58, 32, 92,  3,  7, 35,
+     35,102,110, 35, 35,100, 40, 40, 18,101,214,114,204, 41, 96,108,
+    169,251,246,139,116,102,112, 40,114, 41, 26, 95,246,139,116, 40,
+      7, 95,167,111,135,114,145, 61, 61,250, 48, 48, 50, 32,124,124,
+     92,  3,  7, 95,167,111,135,114,145, 61, 61,250, 50, 48, 50, 32,
+    124,124, 92,  3,  7, 95,167,111,135,114,145, 61, 61,250, 52, 48,
+     50, 37, 92,  3, 34, 73,108,247,103,165, 32,154,  5,117,169,100,
+     32,119,105,116,104, 32, 99,108,246, 17,105, 99, 97,116,105,111,
+    240,151, 99,114,111, 34, 41, 10, 19,228,108,246,151, 99,114,111,
+     40,102,110, 44,114,234,  7,246,139,116,102,112, 40,114, 41, 44,
+     92,  3,  7, 95,167,111,135,114,145, 61, 61,250, 52, 48, 50, 32,
+     63, 26, 35, 35,102,110, 35, 35,135, 40,254,214,114, 41,145, 58,
+     32, 92,  3,  7, 35, 35,102,110, 35, 35,100, 40, 40, 18,101,214,
+    114,204, 41,213, 19,102,112, 99,108,246, 17,121, 40,114, 41, 26,
+     99,108,246,151, 99,114,111, 40,102,112, 99,108,246, 17,121, 44,
+     40,114,204,236,239,102,  2,105,116,101, 40,114,234,102,112, 99,
+    108,246, 17,121, 40,114,145, 60, 61, 32, 70, 80, 95, 78, 79, 82,
+     77, 65, 76, 41,236,239,  2,135,114,234,102,112, 99,108,246, 17,
+    121, 40,114,145, 61, 61, 32, 70, 80, 95,218, 70,218, 73, 84, 69,
+     41,236,239,110,230, 40,114,234,102,112, 99,108,246, 17,121, 40,
+    114,145, 61, 61, 32, 70, 80, 95, 78, 65, 78, 41,236,239,110,212,
+    151,168,114,234,102,112, 99,108,246, 17,121, 40,114,145, 61, 61,
+     32, 70, 80, 95, 78, 79, 82, 77, 65, 76, 41,236,245, 98,105,116,
+     40,114, 41, 26, 99,108,246,151, 99,114,111, 40,245, 98,105,116,
+     44, 40,114,204,129,134, 25, 20, 97,130,115,187,185, 97,130,115,
+    248, 97,130,115,184,189,129, 20,203,  2,187,185,203,  2,248,203,
+      2,184,189,129, 20, 97,116,230,187,185, 97,116,230,248, 97,116,
+    230,184,189, 10, 20, 97,116,230, 50,187, 37, 20,185, 97,116,230,
+     50,179, 37,133,186, 97,116,230, 50,184, 37,136,189, 23, 10, 20,
+    130,115,187,185,130,115,248,130,115,184,189,129, 20,115,  2,187,
+    185,115,  2,248,115,  2,184,189,129, 20,116,230,187,185,116,230,
+    248,116,230,184,189,  3, 25, 20, 97,130,115,104,187,185, 97,130,
+    115,104,248, 97,130,115,104,184,189,129, 20,203,  2,104,187,185,
+    203,  2,104,248,203,  2,104,184,189, 10, 20, 97,116,230,104,187,
+    185, 97,116,230,104,248, 97,116,230,104,184,189, 23, 10, 20,130,
+    115,104,187,185,130,115,104,248,130,115,104,184,189,129, 20,115,
+      2,104,187,185,115,  2,104,248,115,  2,104,184,189,129, 20,116,
+    230,104,187,185,116,230,104,248,116,230,104,184,189, 25, 20,182,
+    112,187,185,182,112,248,182,112,184,189,129, 20,182,112, 50,187,
+    185,182,112, 50,248,182,112, 50,184,189,129, 20,182,112,109, 49,
+    187,185,182,112,109, 49,248,182,112,109, 49,184,189,129, 20,102,
+    144,120,112,187, 37, 24,253,185,102,144,120,112,179, 37, 24,253,
+    186,102,144,120,112,184, 37, 24,253,189, 23, 23, 10, 24,105,  9,
+    103, 98,187, 39, 24,105,  9,103, 98,179, 39, 24,105,  9,103, 15,
+     40,136,189, 23, 23, 10, 20,108,  6,120,112,187, 37, 24,185,108,
+      6,120,112,179, 37, 24,186,108,  6,120,112,184, 37, 24,189,129,
+     20,  9,103,187,185,  9,103,248,  9,103,184,189, 23, 10, 20,  9,
+    103, 49, 48,187,185,  9,103, 49, 48,248,  9,103, 49, 48,184,189,
+     23, 10, 20,  9,103, 49,112,187,185,  9,103, 49,112,248,  9,103,
+     49,112,184,189, 23, 10, 20,  9,103, 50,187,185,  9,103, 50,248,
+      9,103, 50,184,189,129, 20,  9,103, 98,187,185,  9,103, 98,248,
+      9,103, 15, 40,136,189, 23, 23, 10, 20,109,111,100,135, 20, 37,
+     20,253,185,109,111,100,102,179, 37,133,253,186,109,111,100,102,
+    184, 37,136,253,189, 23, 10, 20,115, 99,165, 98,110,187, 37, 24,
+    185,115, 99,165, 98,110,179, 37, 24,186,115, 99,165, 98,110,184,
+     37, 24, 39, 20,115, 99,165, 15,110,187, 37,229,185,115, 99,165,
+     15,110,179, 37,229,186,115, 99,165, 15,110,184, 37,229,189, 25,
+     20, 99, 98,114,116,187,185, 99, 98,114,116,248, 99, 98,114,116,
+    184,189,205,110,111, 95,137,  6, 95,101,255,101, 99,116,115, 10,
+     20,102, 97, 98,115,187,185,102, 97, 98,115,248,102, 97, 98,115,
+    184,189,205,137,  6, 95,101,255,101, 99,116,115, 10, 20,104,149,
+    111,116,187, 37, 20,185,104,149,111,116,179, 37,133,186,104,149,
+    111,116,184, 37,136,189,129, 20,112,111,119,187, 37, 20,185,112,
+    111,119,179, 37,133,186,112,111,119,184, 37,136,189, 23, 10, 20,
+    115,113,114,116,187,185,115,113,114,116,248,115,113,114,116,184,
+    189,  3, 25, 20,139,135, 20,185,139,102,248,139,102,184,189, 10,
+     20,139,102, 99,187,185,139,102, 99,248,139,102, 99,184,189, 23,
+     10, 20,108,103, 97,109,151,187,185,108,103, 97,109,151,248,108,
+    103, 97,109,151,184,189, 23, 10, 20,116,103, 97,109,151,187,185,
+    116,103, 97,109,151,248,116,103, 97,109,151,184,189, 23,  3, 25,
+     20, 99,101,105,168, 20,185, 99,101,105,108,248, 99,101,105,108,
+    184,189,129, 20, 36,212,187,185, 36,212,248, 36,212,184,189,  3,
+    205,110,111, 95,137,  6, 95,101,255,101, 99,116,115, 10, 20,110,
+    101, 22, 98,121,190,187,185,110,101, 22, 98,121,190,248,110,101,
+     22, 98,121,190,184,189,  3,205,137,  6, 95,101,255,101, 99,116,
+    115, 10, 20,114,190,187,185,114,190,248,114,190,184,189,129,229,
+    108,114,190,187, 39,229,108,114,190,179, 39,229,108,114,190,184,
+     11,196,227,132, 26,227, 32, 62, 61,173,207, 57,244, 10, 31,229,
+    108,108,114,190,187, 39, 31,229,108,108,114,190,179, 39, 31,229,
+    108,108,114,190,184, 11,134,134, 23,  3,205,110,111, 95,137,  6,
+     95,101,255,101, 99,116,115, 10, 20,114, 12,127,187,185,114, 12,
+    127,248,114, 12,127,184,189,  3,205,137,  6, 95,101,255,101, 99,
+    116,115, 10,229,108,114, 12,127,187, 39,229,108,114, 12,127,179,
+     39,229,108,114, 12,127,184, 11,196,227,132, 26,227, 32, 62, 61,
+    173,207, 57,244, 10, 31,229,108,108,114, 12,127,187, 39, 31,229,
+    108,108,114, 12,127,179, 39, 31,229,108,108,114, 12,127,184, 11,
+    134,134, 23,129, 20,116,114,233, 99,187,185,116,114,233, 99,248,
+    116,114,233, 99,184,189,129, 20,102,109,111,100,187, 37, 20,185,
+    102,109,111,100,179, 37,133,186,102,109,111,100,184, 37,136,189,
+     23,129, 20,144,151,  2,  6,114,187, 37, 20,185,144,151,  2,  6,
+    114,179, 37,133,186,144,151,  2,  6,114,184, 37,136,189, 10, 20,
+    144,109,113,117,111,187, 37, 20, 37, 24,253,185,144,109,113,117,
+    111,179, 37,133, 37, 24,253,186,144,109,113,117,111,184, 37,136,
+     37, 24,253,189, 23, 23, 10,205,110,111, 95,137,  6, 95,101,255,
+    101, 99,116,115, 10, 20,130,112,121,245,187, 37, 20,185,130,112,
+    121,245,179, 37,133,186,130,112,121,245,184, 37,136,189,129, 20,
+    110,230, 40,164,185,110,230,135,164,186,110,230,168,164,206,205,
+    137,  6, 95,101,255,101, 99,116,115, 10, 20,110,182,116, 97,102,
+    232,187, 37, 20,185,110,182,116, 97,102,232,179, 37,133,186,110,
+    182,116, 97,102,232,184, 37,136,189, 10, 20,110,182,116,216,119,
+     22,100,187, 37,136,185,110,182,116,216,119, 22,100,179, 37,136,
+    186,110,182,116,216,119, 22,100,184, 37,136,189, 10, 20,102,100,
+    105,109,187, 37, 20,185,102,100,105,109,179, 37,133,186,102,100,
+    105,109,184, 37,136,189, 23,  3,205,110,111, 95,137,  6, 95,101,
+    255,101, 99,116,115, 10, 20,102,151,120,187, 37, 20,185,102,151,
+    120,179, 37,133,186,102,151,120,184, 37,136,166, 20,102,109,  2,
+    187, 37, 20,185,102,109,  2,179, 37,133,186,102,109,  2,184, 37,
+    136,206,205,137,  6, 95,101,255,101, 99,116,115, 25, 20,102,151,
+    187, 37, 20, 37, 20,185,102,151,179, 37,133, 37,133,186,102,151,
+    184, 37,136, 37,136,189, 23,129,235,225, 19,239,103,144, 97,232,
+     40,120, 44,121,234,176, 26,103,144, 97,232,178,121,204, 19,239,
+    103,144, 97,232,101,113,117,165, 40,120, 44,121,234,176, 26,103,
+    144, 97,232,101,113,117,165,178,121,204, 19,239,247,115,115, 40,
+    120, 44,121,234,176, 26,247,115,115,178,121,204, 19,239,247,115,
+    169,113,117,165, 40,120, 44,121,234,176, 26,247,115,169,113,117,
+    165,178,121,204, 19,239,247,115,115,103,144, 97,232, 40,120, 44,
+    121,234,176, 26,247,115,115,103,144, 97,232,178,121,204, 19,239,
+    233,212,  6,144,100, 40,120, 44,121,234,176, 26,233,212,  6,144,
+    100,178,121,204, 23, 23,213,196, 78, 79,249, 84, 72, 95,218, 76,
+    218,218, 71,197, 25, 10, 20,  7,220, 97,130,115, 40, 18,101, 39,
+     20,  7,220,203,  2, 40, 18,101, 39, 20,  7,220, 97,116,230, 40,
+     18,101, 39, 20,  7,220,130,115, 40, 18,101, 39, 20,  7,220,115,
+      2, 40, 18,101, 39, 20,  7,220,116,230, 40, 18,101, 39, 20,  7,
+    220,  9,103, 40, 18,101, 39, 20,  7,220,108,103, 49, 48, 40, 18,
+    101, 39, 20,  7,220,182,112, 40, 18,101, 39, 20,  7,220, 97, 98,
+    115, 40, 18,101, 39, 20,  7,220,115,113,114,116, 40, 18,101, 39,
+     20,  7,220, 36,212, 40, 18,101, 39, 20,  7,220, 99,101,105,168,
+     18,101, 39, 20,  7,220,116,114,233, 99, 40, 18,101, 39, 20,  7,
+    220,114,190, 40, 18,101, 39,229,  7,220,108,114,190, 40, 18,101,
+     39, 20,  7,220,144,109, 40, 18,101, 44, 18,101, 39, 20,  7,220,
+    102,151, 40, 18,101, 44, 18,101, 44, 18,101, 11,196, 77, 65, 84,
+     72, 95, 70, 79, 82, 67, 69, 95,218, 76,218,218, 71,210, 17, 26,
+    227, 32, 62, 61,173,207, 57,244, 19, 97,130,115,176, 26,220, 97,
+    130,115,176, 19,203,  2,176, 26,220,203,  2,176, 19,130,115,176,
+     26,220,130,115,176, 19,115,  2,176, 26,220,115,  2,176, 19,116,
+    230,176, 26,220,116,230,176, 19,115,113,114,116,176, 26,220,115,
+    113,114,116,176, 19,  9,103,176, 26,220,  9,103,176, 19,  9,103,
+     49, 48,176, 26,220,108,103, 49, 48,176, 19,182,112,176, 26,220,
+    182,112,176,210,101,131,134, 19, 97,116,230,176, 26,220, 97,116,
+    230,176,196,225,243,102, 97, 98,115,176, 26,220, 97, 98,115,176,
+     96,108,169,243,102, 97, 98,115, 40,120,234, 40,158,145,163,101,
+    111,102,178,102, 97, 98,115, 41,176, 44, 26, 97, 98,115,178, 18,
+    101,145,176, 41,134, 19, 36,212,176, 26,220, 36,212,176, 19, 99,
+    101,105,168,162, 26,220, 99,101,105,168,162, 19,116,114,233, 99,
+    176, 26,220,116,114,233, 99,176, 19,114,190,176, 26,220,114,190,
+    176, 19,108,114,190,176, 26,220,108,114,190,176, 19,144,151,  2,
+      6,114, 40,120, 44,121, 41, 26,220,144,109, 40,120, 44,121, 41,
+    196, 70, 80, 95, 70, 65,177, 95, 70, 77, 65,243,102,151, 40,120,
+     44,121, 44,122, 41, 26,220,102,151, 40,120, 44,121, 44,122, 41,
+    134,235,225, 10,228,165,108,139, 95,110, 22,114,111,119, 32,133,
+      7,231, 97,130,115, 40,254, 39,228,165,108,139, 95,110, 22,114,
+    111,119, 32,133,  7,231,203,  2, 40,254, 39,228,165,108,139, 95,
+    110, 22,114,111,119, 32,133,  7,231, 97,116,230, 40,254, 39,228,
+    165,108,139, 95,110, 22,114,111,119, 32,133,  7,231,115,  2, 40,
+    254, 39,228,165,108,139, 95,110, 22,114,111,119, 32,133,  7,231,
+    130,115, 40,254, 39,228,165,108,139, 95,110, 22,114,111,119, 32,
+    133,  7,231,116,230, 40,254, 39,228,165,108,139, 95,110, 22,114,
+    111,119, 32,133,  7,231,  9,103, 40,254, 39,228,165,108,139, 95,
+    110, 22,114,111,119, 32,133,  7,231,108,103, 49, 48, 40,254, 39,
+    228,165,108,139, 95,110, 22,114,111,119, 32,133,  7,231,182,112,
+     40,254, 39,228,165,108,139, 95,110, 22,114,111,119, 32,133,  7,
+    231, 97, 98,115, 40,254, 39,228,165,108,139, 95,110, 22,114,111,
+    119, 32,133,  7,231,115,113,114,116, 40,254, 39,228,165,108,139,
+     95,110, 22,114,111,119, 32,133,  7,231, 36,212, 40,254, 39,228,
+    165,108,139, 95,110, 22,114,111,119, 32,133,  7,231, 99,101,105,
+    168,254, 39,228,165,108,139, 95,110, 22,114,111,119, 32,133,  7,
+    231,116,114,233, 99, 40,254, 39,228,165,108,139, 95,110, 22,114,
+    111,119, 32,133,  7,231,114,190, 40,254, 39,228,165,108,139, 95,
+    110, 22,114,111,119, 32,229,  7,231,108,114,190, 40,254, 39,228,
+    165,108,139, 95,110, 22,114,111,119, 32,133,  7,231,144,109, 40,
+    254, 44,254, 39,228,165,108,139, 95,110, 22,114,111,119, 32,133,
+      7,231,102,151, 40,254, 44,254, 44,254, 11, 19,130,112,121,245,
+     40,120, 44,121, 41, 26,130,112,121,137,103,127, 40,120, 44,121,
+     41, 19,130,112,121,245,135,120, 44,121, 41, 26,130,112,121,245,
+    135,120, 44,121, 41, 19, 97,130,115,135,162, 26,231, 97,130,115,
+    176, 19,203,  2,135,162, 26,231,203,  2,176, 19, 97,116,230,135,
+    162, 26,231, 97,116,230,176, 19,115,  2,135,162, 26,231,115,  2,
+    176, 19,130,115,135,162, 26,231,130,115,176, 19,116,230,135,162,
+     26,231,116,230,176, 19,115,113,114,116,135,162, 26,231,115,113,
+    114,116,176, 19,  9,103,135,162, 26,231,  9,103,176, 19,  9,103,
+     49, 48,135,162, 26,231,108,103, 49, 48,176, 19,182,112,135,162,
+     26,231,182,112,176, 19,102, 97, 98,115,135,120,234, 40,158,145,
+    163,101,111,102,178,102, 97, 98,115,102, 41,176, 44, 26, 97, 98,
+    115,178,254,145,176, 41, 19, 36,212,135,162, 26,231, 36,212,176,
+     19, 99,101,105,108,135,162, 26,231, 99,101,105,168,162, 19,116,
+    114,233, 99,135,162, 26,231,116,114,233, 99,176, 19,114,190,135,
+    162, 26,231,114,190,176, 19,108,114,190,135,162, 26,231,108,114,
+    190,176, 19,144,151,  2,  6,114,135,120, 44,121, 41, 26,231,144,
+    109, 40,120, 44,121, 41,196, 70, 80, 95, 70, 65,177, 95, 70, 77,
+     65, 70,243,102,151,135,120, 44,121, 44,122, 41, 26,231,102,151,
+     40,120, 44,121, 44,122, 41,134,134,213,196, 84, 65, 82, 71, 69,
+     84, 95, 70, 80, 85,194, 70, 80, 10,133,  7,231, 97, 98,115, 40,
+    254, 39, 20,  7,220, 97, 98,115, 40, 18,101, 39, 19,102, 97, 98,
+    115,135,162, 26,231, 97, 98,115,176, 19,102, 97, 98,115,176, 26,
+    220, 97, 98,115,176,213,196,225, 10,125,213,196, 67, 67, 95, 78,
+     79, 82, 67, 82, 79, 70, 84, 10, 47, 47, 32, 83,104, 12,108,100,
+     32,151,116, 27, 32,119,105,116,104, 32,116,104,  5, 35, 14, 97,
+      4,116,104,  5,216,112, 46,  1,233,152, 99,165,108,139, 95,110,
+     22,114,111,119,213,134, 25, 10,  0,205,102,212, 99,146,216,112,
+     95,247,118,101,108,205,  2, 99,147,  6,211,110,108,121,211,110,
+     99,101,197,197,235,169,116,106,109,112, 95,104,251,169,116,106,
+    109,112, 95,104, 10,196, 74, 77, 80, 95, 66, 85, 70, 95,170, 90,
+     69, 10,167,175, 24,106,109,112, 95, 98,117,102, 91,  7, 74, 77,
+     80, 95, 66, 85, 70, 95,170, 90, 69, 93, 59, 96,108,169, 10,167,
+    175, 24,106,109,112, 95, 98,117,102, 91, 50, 50, 93,238,134, 32,
+      3,197, 25,196,217,  7, 10, 19,169,116,106,109,112, 40,106,109,
+    112, 95, 98,117,102,234,169,116,106,109,112, 40,106,109,112, 95,
+     98,117,102,204,213,196,225, 19, 95, 78,111,144,116,117,114,110,
+     10,182,232,240, 34, 67, 34, 32,123, 96,108, 17, 32, 13,101,100,
+     40,  7,227,145, 38, 38, 26,227, 32, 62, 61,173,207, 57,244, 96,
+    108,169, 19, 95, 78,111,144,116,117,114,110,213, 24,169,116,106,
+    109,112, 40,106,109,112, 95, 98,117,102, 32,206, 25,158,252, 78,
+    111,144,116,117,114,240, 29,106,109,112, 40,106,109,112, 95, 98,
+    117,102, 32, 37, 24,206,196,225, 10,125,213,134, 25, 10,  0,205,
+    102,212, 99,146,216,112, 95,247,118,101,108,205,  2, 99,147,  6,
+    211,110,108,121,211,110, 99,101,197,197,235,245,165, 95,104,251,
+    245,165, 95,104, 25,167,175, 24,137,103, 95, 97,216,109,105, 99,
+     95,116, 59, 23, 10,196,225, 10,182,232,240, 34, 67, 34, 32,123,
+    213,158, 26,170, 71, 95, 68, 70, 76, 40,190, 39,158, 26,170, 71,
+     95,181, 82, 40,190, 39,158, 26,170, 71, 95, 73, 71, 78, 40,190,
+    206, 19,170, 71, 95, 68, 70, 76, 32, 38,  7,170, 71, 95, 68, 70,
+     76, 19,170, 71, 95,181, 82, 32, 38,  7,170, 71, 95,181, 82, 19,
+    170, 71, 95, 73, 71, 78, 32, 38,  7,170, 71, 95, 73, 71, 78, 10,
+    236,170, 71, 65, 66, 82, 84,173, 32, 19,170, 71, 70, 80, 69, 32,
+     50, 32, 19,170, 71,153, 76, 32, 51, 32, 19,170, 71,218, 84, 32,
+     52, 32, 19,170, 71, 83, 69, 71, 86, 32, 53, 32, 19,170, 71, 84,
+    181, 77, 32, 54, 32, 19,170, 71,177, 65, 75, 32, 55, 32,129, 19,
+    170, 71, 85, 83, 82, 49, 32, 56, 19,170, 71, 85, 83, 82, 50, 32,
+     57, 19,170, 71, 79, 83,181, 82, 79, 82,173, 48, 25,158,178, 42,
+    245,165,178, 24, 37,158,178,253, 32,214,190,204,214,190,206, 25,
+     24,174,105,169, 40, 24,189,196,225, 10,125,213,134, 25, 10,  0,
+    205,102,212, 99,146,216,112, 95,247,118,101,108,205,  2, 99,147,
+      6,211,110,108,121,211,110, 99,101,197, 25,235,138,100, 22,103,
+     95,104,251,138,100, 22,103, 95,104,197, 25,167,175,128,118, 97,
+     95,108,105,138, 91, 49, 93,238,129,196,225, 10,116,101,109,112,
+    108, 97,116,  5, 60, 99,108,246, 32, 84, 62, 32,150,117,188,  7,
+    165,105,195,111,102,116,101,138, 10,123, 32, 30, 26,109,101,109,
+     98,139, 49,238, 84, 26,109,101,109, 98,139, 50, 59, 10,125, 59,
+     10,251,165,105,195,111,135,167,145, 92,  3, 40, 40,128, 41, 38,
+     40, 40, 40,  7,165,105,195,111,102,116,101,138, 60,167, 62, 42,
+    145, 48, 41, 45, 62,  7,109,101,109, 98,139, 50,145, 45,178,128,
+     41, 48, 41,251,165,105,195,117,112,216,167, 40,112,116,114, 44,
+    167,145, 92,  3, 40, 40,128,214, 40,190,214,112,116,114,145, 43,
+    178,  7,165,105,195,111,135,167, 41, 45, 49,145, 38, 32,126, 40,
+      7,165,105,195,111,135,167, 41, 45, 49,204, 41, 10, 19,118, 97,
+     95,138, 22,116, 40, 97,112, 44,112, 22,109, 78,145, 92,  3, 40,
+     40,158,214, 42, 40, 97,112,145, 61,178,128, 41, 38, 40,112, 22,
+    109, 78,145, 43, 32,163,101,111,135,112, 22,109, 78,204, 41, 19,
+    118, 97, 95, 22,103, 40, 97,112, 44,167,145, 92,  3, 40, 42, 40,
+    154,  5, 42,214, 40, 42, 40, 97,112, 41, 61,  7,165,105,195,117,
+    112,216,167, 40, 42, 40, 97,112, 41, 44,167, 41, 43,163,101,111,
+    135,167,204, 45, 92,  3,163,101,111,135,167,204, 41, 96,108,169,
+    197,251,165,105,195,111,135,167,145, 92,  3, 40, 40,128, 41, 38,
+     40, 40, 40,150,117, 99,116,123, 30, 26,109,101,109, 98,139, 49,
+    238, 92,  3,  7, 95,154,  5,154,  5,  7,109,101,109, 98,139, 50,
+     59,125, 42,145, 48, 41, 45, 62,  7,109,101,109, 98,139, 50,145,
+     45, 32, 92,  3, 40,128, 41, 48, 41,251,165,105,195,117,112,216,
+    167, 40,112,116,114, 44,167,145, 92,  3, 40, 40,128,214, 40,190,
+    214,112,116,114,145, 43,178,  7,165,105,195,111,135,167, 41, 45,
+     49,145, 38, 32,126, 40,  7,165,105,195,111,135,167, 41, 45, 49,
+    204, 41, 25, 19,118, 97, 95,138, 22,116, 40, 97,112, 44,112, 22,
+    109, 78,145, 92,  3, 40,  7, 95,246,139,116, 40, 40,  7, 95,167,
+    111,135,112, 22,109, 78,145, 38,250, 52, 56, 49,145, 61, 61,193,
+     37, 92,  3, 34, 73,108,247,103,165, 32,154,  5,111,102, 32, 50,
+    127, 32, 22,103,117,109,101,110,  4,216, 32,118, 97, 95,138, 22,
+    116, 34, 41, 37, 92,  3, 40,158,214, 42, 40, 97,112,145, 61,178,
+    128, 41, 38, 40,112, 22,109, 78,145, 43, 32,163,101,111,135,112,
+     22,109, 78,204, 41,129, 19,118, 97, 95, 22,103, 40, 97,112, 44,
+    167,145, 92,  3, 40,  7, 95,246,139,116, 40, 40,  7, 95,167,111,
+    135,  7, 95,154,  5,167,145, 38,250, 52, 56, 49,145, 61, 61,193,
+     37, 92,  3, 34, 73,108,247,103,165, 32,154,  5,117,169,100, 32,
+    119,105,116,104, 32,118, 97, 95, 22,103, 34, 41, 37, 92,  3, 42,
+     40,  7, 95,154,  5,154,  5, 42,214, 40, 42, 40, 97,112, 41, 61,
+      7,165,105,195,117,112,216,167, 40, 42, 40, 97,112, 41, 44,167,
+     41, 43,163,101,111,135,  7, 95,154,  5,167,204, 45, 92,  3,163,
+    101,111,135,  7, 95,154,  5,167,204, 41,  3,213, 19,118, 97, 95,
+    130,112,121, 40,  6,138, 44,115,114, 99,234, 40,158,214, 42, 40,
+      6,138,145, 61, 21, 40,115,114, 99,204, 41,129, 19,118, 97, 95,
+    101,127, 40, 97,112,234, 40,158,214, 42, 40, 97,112,145, 61,178,
+    128, 41, 45, 50, 53, 54,204,129,134, 25, 10,  0,205,102,212, 99,
+    146,216,112, 95,247,118,101,108,205,  2, 99,147,  6,211,110,108,
+    121,211,110, 99,101,197,197,235,138,100,  8, 95,104,251,138,100,
+      8, 95,104, 25,167,175, 24,112,116,114,100, 17,102, 95,116, 59,
+    235,217,  7,243,112,116,114,100, 17,102, 95,  4, 24,134,129,235,
+    171,116,243,  7,192, 49, 10,167,175,233,245,101,100, 32, 24,171,
+    116,238,  3,213,235,119, 30, 95,116,243,  7,119, 30, 95,  4, 49,
+     10,167,175, 24,119, 30, 95,116,238,  3,213,196,227,132, 26,227,
+     32, 62, 61, 32, 50,244, 49, 49, 50, 10,167,175,233,105,111,110,
+     10,123, 32, 31,229,  7, 97, 59,  3,136,  7, 98, 59,  3,158, 21,
+    228, 59,  3,158,178, 42,  7,100,214,158, 39,125, 32,151,120, 95,
+    165,105,195, 95,116, 59,  3,134,213,198,175, 78, 85, 76, 76, 32,
+    243, 78, 85, 76, 76,193,  3,213,196,225, 19,111,255,169,216,135,
+    167, 37,109,101,109, 98,139,145, 92,  3, 40, 40,171,116,214, 40,
+    128, 41, 38, 40, 40, 40,154,  5, 42, 41, 48, 41, 45, 62,109,101,
+    109, 98,139,145, 45,178,128, 41, 48,204, 96,108,169, 19,111,255,
+    169,216,135,167, 37,109,101,109, 98,139,145, 92,  3, 40, 40,171,
+    116,214, 40,128, 41, 38, 40, 40, 40,  7, 95,154,  5,154,  5, 42,
+     41, 48, 41, 45, 62,109,101,109, 98,139,145, 45,178,128, 41, 48,
+    204,134,  3,134, 25, 10,  0,205,102,212, 99,146,216,112, 95,247,
+    118,101,108,205,  2, 99,147,  6,211,110,108,121,211,110, 99,101,
+    197,197,235,138,100,105,111, 95,104,251,138,100,105,111, 95,104,
+     10,251, 76, 73, 66,224, 32, 53, 48, 48, 32, 10,235,171,116,251,
+    192, 49, 10,167,175,233,245,101,100, 32, 24,171,116,238,134, 25,
+     10,167,175,128,  7,118, 97, 95,108,105,138, 91, 49, 93,238, 10,
+    198,175, 78, 85, 76, 76,243, 78, 85, 76, 76,193, 32,134, 25,167,
+    175,229,211,255, 95,116, 59,132, 26,227, 32, 62, 61,173,207, 57,
+    244, 10,167,175, 31,229,211,255,172, 95,116, 59,213,198,175, 95,
+    161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 19, 95,161, 95,
+     79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32, 51, 50,134,132, 26,
+    227, 32, 62, 61,173,207, 57,244, 32, 38, 38,252,161, 95, 79,140,
+     83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,172, 10,167,175,
+    211,255,172, 95,  4,102,112,111,115, 95,116, 59, 96,108, 17,252,
+    161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,
+     51, 50, 10,167,175,211,255, 95,  4,102,112,111,115, 95,116, 59,
+     96,108,169, 96,114,114,212, 32, 85,110,115,117,112,112,212,116,
+    101,100,252,161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32,
+    118, 97,147,101,134,129,132, 32, 13,101,100, 40, 95, 76, 65, 82,
+     71, 69,161, 95, 83, 79, 85, 82, 67, 69,145,124,124, 32, 13,101,
+    100, 40, 95, 76, 65, 82, 71, 69,161,172, 95, 83, 79, 85, 82, 67,
+     69, 41, 10,167,175,102,112,111,115, 95,  4,111,255, 95,116, 59,
+    134,129,132, 26,227, 32, 62, 61,173,207, 57,244, 32, 38, 38, 32,
+     13,101,100, 40, 95, 76, 65, 82, 71, 69,161,172, 95, 83, 79, 85,
+     82, 67, 69, 41, 10,167,175,211,255,172, 95,  4,102,112,111,115,
+    172, 95,116, 37,111,255,172, 95,116, 59,134,  3, 25,167,175,150,
+    117,188,  7,161, 95,150,117, 99,116, 10,123, 32,233,245,101,100,
+     32,128,  7,112,116,114, 59,  3, 24,  7,105, 99,110,116,238,  3,
+     24,  7,111, 99,110,116,238,  3, 24,  7,102,108, 97,103, 59, 23,
+      3,233,245,101,100, 32,128,  7, 98, 97,169,238,  3, 24,  7,102,
+    105,247,238,  3, 29, 26, 99,108,105, 98, 95,233,117,169,100,238,
+      3, 24,  7, 98,117,102,163,238,  3, 24,  7,245, 97,116,117,144,
+    238,  3,150,117,188,  7,182,116,174,100, 97,116, 97, 21,  7,182,
+    116,174,112,238, 10,125, 32,161, 59,129,243, 95, 73, 79, 82, 69,
+     65, 68,250,244, 32,243, 95, 73, 79, 87, 82, 73, 84, 69,250, 48,
+     50, 32,243, 95, 73, 79, 66,218,250, 48, 52, 32,243, 95, 73, 79,
+    177, 82, 71,250, 48, 56, 32,243, 95, 73, 79, 83, 69, 69, 75,250,
+     49, 48, 32,243, 95, 73, 79, 76, 65, 90, 89,250, 50, 48, 32,243,
+     95, 73, 79, 83, 66, 70,250, 56, 48, 48, 32,243, 95, 73, 79, 65,
+     80, 80, 69, 78, 68,250, 48, 56, 48, 48, 48, 32, 19, 95, 73, 79,
+     69, 79, 70,250, 52, 48, 32, 19, 95, 73, 79,181, 82,250, 56, 48,
+     32, 19, 95, 73, 79, 70, 66, 70,250, 49, 48, 48, 32, 19, 95, 73,
+     79, 76, 66, 70,250, 50, 48, 48, 32, 19, 95, 73,191, 66, 70,250,
+     52, 48, 48, 32, 10, 19, 66, 85, 70,170, 90,178, 52, 48, 57, 54,
+    145, 19, 69, 79, 70,178, 45, 49, 41,236, 70, 79, 80, 69, 78,249,
+     88,252, 83, 89, 83, 95, 79, 80, 69, 78,129, 19, 95, 83, 89, 83,
+     95, 79, 80, 69, 78,173, 54, 19,161, 78, 65, 77, 69,249, 88, 32,
+     56, 48,236, 76, 95,116,109,112,110, 97,109, 32,161, 78, 65, 77,
+     69,249, 88,129,198,175, 83, 69, 69, 75, 95, 83, 69, 84, 19, 83,
+     69, 69, 75, 95, 83, 69, 84,193, 32, 19, 83, 69, 69, 75, 95, 67,
+     85, 82,173, 32, 19, 83, 69, 69, 75, 95, 69, 78, 68, 32, 50, 32,
+    213, 19, 84, 77, 80,249, 88,173, 48, 48, 48, 48, 48, 48, 48, 48,
+     48,129,196,225, 10,182,232,240, 34, 67, 34, 32,123,134,132,175,
+     83, 89,177, 69, 77, 95,177, 65, 84, 73, 67, 83, 10,182,232,240,
+    161, 21,138,100,  2, 59, 10,182,232,240,161, 21,138, 16,116, 59,
+     10,182,232,240,161, 21,138,  6,114,114, 59, 96,108,169, 10,182,
+    232,240,161, 26,105,111, 98, 91, 93, 59,129, 19,138,100,  2,178,
+     38,  7,105,111, 98, 91, 48, 93, 41,236,138, 16,  4, 40, 38,  7,
+    105,111, 98, 91, 49, 93, 41,236,138,  6,114,114,178, 38,  7,105,
+    111, 98, 91, 50, 93, 41,  3,134, 25, 24,144,109,111,118,101, 40,
+    164,166, 24,144,110, 97,109,101, 40,164, 37,164,166,161, 21,116,
+    109,112,102,105,247, 40,158, 11,132, 26,227, 32, 62, 61,173,207,
+     57,244, 10,161, 21, 95,116,109,112,102,105,247,172, 40,158, 11,
+    132,252,161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61,
+     61, 32,172, 19,116,109,112,102,105,108,  5, 95,116,109,112,102,
+    105,247,172,134,132,175, 95, 76, 65, 82, 71, 69,161,172, 95, 83,
+     79, 85, 82, 67, 69, 19,116,109,112,102,105,247,172,252,116,109,
+    112,102,105,247,172,134,134,129,128,116,109,112,110, 97,109, 40,
+    148,206, 25, 24,102, 99,  9,169, 40,242,166, 24,255,157,104, 40,
+    242,166,161, 21,102,111,112,101,110, 40,164,237,164, 11,132, 26,
+    227, 32, 62, 61,173,207, 57,244, 10,161, 21, 95,102,111,112,101,
+    110,172, 40,164,237,164, 11,132,252,161, 95, 79,140, 83, 69, 84,
+     95, 66, 73, 84, 83, 32, 61, 61, 32,172, 19,102,111,112,101,240,
+     95,102,111,112,101,110,172,134,132,175, 95, 76, 65, 82, 71, 69,
+    161,172, 95, 83, 79, 85, 82, 67, 69, 19,102,111,112,101,110,172,
+    252,102,111,112,101,110,172,134,134,129,161, 21,102,144,111,112,
+    101,110, 40,164,237,164,237,242, 11,132, 26,227, 32, 62, 61,173,
+    207, 57,244, 10,161, 21, 95,102,144,111,112,101,110,172, 40,164,
+    237,164,237,242, 11,132,252,161, 95, 79,140, 83, 69, 84, 95, 66,
+     73, 84, 83, 32, 61, 61, 32,172, 19,102,144,111,112,101,240, 95,
+    102,144,111,112,101,110,172,134,132,175, 95, 76, 65, 82, 71, 69,
+    161,172, 95, 83, 79, 85, 82, 67, 69, 19,102,144,111,112,101,110,
+    172,252,102,144,111,112,101,110,172,134,134,129,158, 32,169,116,
+     98,117,135,242, 37,148,166, 24,169,116,118, 98,117,135,242, 37,
+    148,237, 24, 37,192,166,205, 45,118, 49, 32, 10, 24,102,112,114,
+    190,135,242, 37,164, 37, 46, 46, 46,166, 24,112,114,190,135,164,
+     37, 46, 46, 46,166, 24,115,110,112,114,190,135,148, 37,192,237,
+    164, 37, 46, 46, 46,166, 24,115,112,114,190,135,148, 37,164, 37,
+     46, 46, 46,206,205, 45,118, 50, 32, 10, 24,102,115, 99,230,135,
+    242,237,164, 37, 46, 46, 46,166, 24,115, 99,230,135,164, 37, 46,
+     46, 46,166, 24,115,115, 99,230,135,164, 37,164, 37, 46, 46, 46,
+    206,205, 45,118, 48, 32, 10, 24,118,102,112,114,190,135,242, 37,
+    164,237,  7,118, 97, 95,108,105,141,166, 24,118,102,115, 99,230,
+    135,242, 37,164,237,  7,118, 97, 95,108,105,141,166, 24,118,112,
+    114,190,135,164, 44, 26,118, 97, 95,108,105,141,166, 24,118,115,
+     99,230,135,164, 44, 26,118, 97, 95,108,105,141,166, 24,118,115,
+    110,112,114,190,135,148, 37,192,237,164, 44, 26,118, 97, 95,108,
+    105,141,166, 24,118,115,112,114,190,135,148, 37,164,237,  7,118,
+     97, 95,108,105,141,166, 24,118,115,115, 99,230,135,164, 37,164,
+    237,  7,118, 97, 95,108,105,141,206, 25, 24,102,103,101,116, 99,
+     40,242,166,128,102,103,101,116,115, 40,148, 37, 24, 37,242,166,
+     24,102,112,117,116, 99, 40, 24, 37,242,166, 24,102,112,117,116,
+    115, 40,164, 37,242,166, 24,  7,102,105,108, 98,117,135,242,206,
+     19,103,101,116, 99, 40,112,145, 92,  3, 40, 45, 45, 40, 40,112,
+     41, 45, 62,  7,105, 99,110,116,145, 62, 61,193, 32, 63, 21, 40,
+     40,112, 41, 45, 62,  7,112,116,114, 41, 43, 43, 32, 58, 26,102,
+    105,108, 98,117,135,112,204,235,225, 10, 24, 40,103,101,116, 99,
+    214,242, 11,134,236,103,101,116, 30, 40,145,103,101,116, 99, 40,
+    138,100,  2, 41,235,225, 10, 24, 40,103,101,116, 30,214,158, 11,
+    134,  3,132, 26,227, 32, 60, 32, 50,244, 49, 49, 50, 10,128,103,
+    101,116,115, 40,148,206,213, 24,  7,102,108,115, 98,117,135, 24,
+     37,242,206, 19,112,117,116, 99, 40, 27, 37,112,145, 92,  3, 40,
+     45, 45, 40, 40,112, 41, 45, 62,  7,111, 99,110,116,145, 62, 61,
+    193, 32, 63,178, 42, 40, 40,112, 41, 45, 62,  7,112,116,114, 41,
+     43, 43, 32, 61,178, 27, 41,145, 58, 26,102,108,115, 98,117,135,
+     27, 44,112,204,235,225, 10, 24, 40,112,117,116, 99,214, 24, 37,
+    242, 11,134,236,112,117,116, 30, 40, 27,145,112,117,116, 99, 40,
+     27, 37,138, 16,116, 41,235,225, 10, 24, 40,112,117,116, 30,214,
+     24, 11,134,129, 24,112,117,116,115, 40,164,166, 24,117, 28,101,
+    116, 99, 40, 24, 37,242,206, 25,192,102,144, 97,100, 40,158,180,
+    237,192, 37,192, 37,242,166,192,102,119,114,105,116,101, 40,143,
+    158,180,237,192, 37,192, 37,242,206, 25, 24,102,103,101,116,112,
+    111,115, 40,242, 37,211,255, 95,  4,253, 11,132, 26,227, 32, 62,
+     61,173,207, 57,244, 10, 24, 95,102,103,101,116,112,111,115,172,
+     40,242, 37,211,255,172, 95,  4,253, 11,132,252,161, 95, 79,140,
+     83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,172, 19,102,103,
+    101,116,112,111,115,252,102,103,101,116,112,111,115,172,134,132,
+    175, 95, 76, 65, 82, 71, 69,161,172, 95, 83, 79, 85, 82, 67, 69,
+     19,102,103,101,116,112,111,115,172,252,102,103,101,116,112,111,
+    115,172,134,134,129, 24,102,169,101,107, 40,242, 37,229, 37, 24,
+     39, 24, 95,102,169,101,107,111, 40,242, 37,211,255, 95,  4, 37,
+     24, 11,132, 32, 13,101,100, 40, 95, 76, 65, 82, 71, 69,161, 95,
+     83, 79, 85, 82, 67, 69,145,124,124, 32, 13,101,100, 40, 95, 76,
+     65, 82, 71, 69,161,172, 95, 83, 79, 85, 82, 67, 69, 41,132,252,
+    161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,
+    172, 19,102,169,101,107,111,252,102,169,101,107,111,172, 96,108,
+    169, 19,102,169,101,107,111,252,102,169,101,107,111,134,134,132,
+     26,227, 32, 62, 61,173,207, 57,244, 10, 24, 95,102,169,101,107,
+    111,172, 40,242, 37,211,255,172, 95,  4, 37, 24, 11,132,175, 95,
+     76, 65, 82, 71, 69,161,172, 95, 83, 79, 85, 82, 67, 69, 19,102,
+    169,101,107,111,172,252,102,169,101,107,111,172,134,134,129, 24,
+    102,169,116,112,111,115, 40,242, 37,143,211,255, 95,  4,253, 11,
+    132, 26,227, 32, 62, 61,173,207, 57,244, 10, 24, 95,102,169,116,
+    112,111,115,172, 40,242, 37,143,211,255,172, 95,  4,253, 11,132,
+    252,161, 95, 79,140, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61,
+     32,172, 19,102,169,116,112,111,115,252,102,169,116,112,111,115,
+    172,134,132,175, 95, 76, 65, 82, 71, 69,161,172, 95, 83, 79, 85,
+     82, 67, 69, 19,102,169,116,112,111,115,172,252,102,169,116,112,
+    111,115,172,134,134,129,229,102,116,101,108,168,242, 39,211,255,
+     95,  4, 95,102,116,101,108,  9, 40,242, 11,132, 32, 13,101,100,
+     40, 95, 76, 65, 82, 71, 69,161, 95, 83, 79, 85, 82, 67, 69,145,
+    124,124, 32, 13,101,100, 40, 95, 76, 65, 82, 71, 69,161,172, 95,
+     83, 79, 85, 82, 67, 69, 41,132,252,161, 95, 79,140, 83, 69, 84,
+     95, 66, 73, 84, 83, 32, 61, 61, 32,172, 19,102,116,101,108,  9,
+    252,102,116,101,108,  9,172, 96,108,169, 19,102,116,101,108,  9,
+    252,102,116,101,108,  9,134,134,132, 26,227, 32, 62, 61,173,207,
+     57,244, 10,211,255,172, 95,  4, 95,102,116,101,108,  9,172, 40,
+    242, 11,132,175, 95, 76, 65, 82, 71, 69,161,172, 95, 83, 79, 85,
+     82, 67, 69, 19,102,116,101,108,  9,172,252,102,116,101,108,  9,
+    172,134,134,129,158, 32,144,119,  2,100, 40,242,206, 25,158, 32,
+     99,247, 22,139,114, 40,242,166, 19,102,101,111,135,138,144, 97,
+    109,234, 40,138,144, 97,109, 41, 45, 62,  7,102,108, 97,103, 32,
+     38,252, 73, 79, 69, 79, 70, 41,235,225, 10, 24, 40,102,101,111,
+    102,214,242, 11,134,236,102,139,114,212, 40,138,144, 97,109,234,
+     40,138,144, 97,109, 41, 45, 62,  7,102,108, 97,103, 32, 38,252,
+     73, 79,181, 82, 41,235,225, 10, 24, 40,102,139,114,212,214,242,
+     11,134,129,158, 32,112,139,114,212, 40,164,206,196,225, 10,125,
+    213,134, 25, 10,  0,205,102,212, 99,146,216,112, 95,247,118,101,
+    108,205,  2, 99,147,  6,211,110,108,121,211,110, 99,101,197,197,
+    235,138,100,108,105, 98, 95,104,251,138,100,108,105, 98, 95,104,
+     10,235,171,116,243,  7,192, 49,  3,167,175,233,245,101,100, 32,
+     24,171,116,238,213,235,119, 30, 95,116,  3,167,175, 24,119, 30,
+     95,116,238,243,  7,119, 30, 95,  4, 49,213,198,175, 78, 85, 76,
+     76,243, 78, 85, 76, 76,193, 32,134, 25,167,175,150,117,188,100,
+    105,118, 95,  4,123, 32, 24,113,117,111,116, 37,144,109,238,125,
+     32,100,105,118, 95,116, 59,129,167,175,150,117,188,108,100,105,
+    118, 95,  4,123, 32,229,113,117,111,116, 37,144,109,238,125, 32,
+    108,100,105,118, 95,116, 59,  3,196,227,132, 26,227, 32, 62, 61,
+    173,207, 57,244, 10,167,175,150,117,188,108,108,100,105,118, 95,
+      4,123, 32, 31,229,113,117,111,116, 37,144,109,238,125, 32,108,
+    108,100,105,118, 95,116, 59,  3,134,213,196, 69, 88, 73, 84, 95,
+     70, 65,153, 85, 82, 69,243, 69, 88, 73, 84, 95, 70, 65,153, 85,
+     82, 69, 26, 69, 88, 73, 84, 95, 70, 65,153, 85, 82, 69,  3, 96,
+    108,169,243, 69, 88, 73, 84, 95, 70, 65,153, 85, 82, 69,173, 32,
+    134, 19, 69, 88, 73, 84, 95, 83, 85, 67, 67, 69, 83, 83,193,129,
+     19, 82, 65, 78, 68,249, 88,250, 55,221,140, 70,236, 95, 65, 78,
+    170, 95, 82, 65, 78, 68,249, 88,250, 55,255,102, 32,236, 77, 66,
+     95, 67, 85, 82,249, 88,173,129,196,225, 19,209, 99,116, 19, 95,
+     78,111,144,116,117,114,110, 10,182,232,240, 34, 67, 34, 32,123,
+     96,108, 17, 32, 13,101,100, 40,  7,227,145, 38, 38, 26,227, 32,
+     62, 61,173,207, 57,244, 19,241,  7,209, 99,116, 96,108,169, 19,
+    209, 99,116, 19, 95, 78,111,144,116,117,114,110,213, 20, 97,216,
+    135,164,166, 24, 97,216,105, 40,164,166,229, 97,216,168,164,206,
+    196,227,132, 26,227, 32, 62, 61,173,207, 57,244, 10, 31,229, 97,
+    216,108,168,164,206,134,134, 25, 20,150,216,100, 40,164,241,237,
+    128,253,241,185,150,216,135,164,241,237,128,253,241,186,150,216,
+    108,100, 40,164,241,237,128,253,241,166,229,150,216,168,164,241,
+    237,128,253,241, 37, 24,166,233,245,101,100, 32,229,150,116, 12,
+    168,164,241,237,128,253,241, 37, 24,206,196,227,132, 26,227, 32,
+     62, 61,173,207, 57,244, 10, 31,229,150,216,108,168,164,241,237,
+    128,253,241, 37, 24,166,233,245,101,100, 32, 31,229,150,116, 12,
+    108,168,164,241,237,128,253,241,237, 24,206,134,134, 25, 24,174,
+    127, 40,158,166,158, 32,115,174,127, 40,233,245,101,100, 32, 24,
+    166, 24, 95, 65, 78,170, 95,174,127, 40,158,166,158,252, 65, 78,
+    170, 95,115,174,127, 40,233,245,101,100, 32, 24,166,196,225,235,
+    151,108,  9, 99, 95,104,251,151,108,  9, 99, 95,104, 25,167,175,
+    128,151,108,  9, 99, 95,116, 59, 10,132, 26,225, 32, 62, 61, 32,
+     50,244, 55, 48, 51, 10,158, 21,165,105,195,101,220,165,  9, 99,
+     40,192, 37,192, 11,213,128, 99,165,  9, 99, 40,192, 37,192, 39,
+    158, 32,102,144,101, 40,158,180, 39,128,151,108,  9, 99, 40,192,
+     39,128,144,165,  9, 99, 40,158,180, 37,192, 11,134, 96,108,169,
+    132, 26,227, 32, 62, 61, 32, 50,244, 49, 49, 50, 10,158, 21,165,
+    105,195,101,220,165,  9, 99, 40,192, 37,192,206,213,158, 21, 99,
+    165,  9, 99, 40,192, 37,192,166,158, 32,102,144,101, 40,158,180,
+    166,158, 21,151,108,  9, 99, 40,192,166,158, 21,144,165,  9, 99,
+     40,158,180, 37,192,206,134, 25,158,252, 78,111,144,116,117,114,
+    240, 97, 98,212,116, 40,158,166, 24, 97,116,182,105,116, 40,158,
+    178,253,214,158, 41,166,158,252, 78,111,144,116,117,114,240,182,
+    105,116, 40, 24,206,196,227,132, 26,227, 32, 62, 61, 32, 50,244,
+     49, 49, 50, 10, 24, 97,116, 95,113,117,105, 99,107, 95,182,105,
+    116, 40,158,178,253,214,158, 41,166,158,252, 78,111,144,116,117,
+    114,240,113,117,105, 99,107, 95,182,105,116, 40, 24,206,134,134,
+     25,158,252, 78,111,144,116,117,114,240, 95, 69,120,105,116, 40,
+     24,206, 25,128,103,101,116,101,110,118, 40,164,166, 24,115,121,
+    138,101,109, 40,164,206, 25,158, 21, 98,169, 22, 27, 40,143,158,
+    180, 37,143,158,180,237,192, 37,192,237, 24, 40,253,214,143,158,
+     21, 37,143,158, 21, 41,166,158, 32,113,115,212,116, 40,158,180,
+     37,192, 37,192,237, 24, 40,253,214,143,158, 21, 37,143,158, 21,
+     41,206, 25, 24, 97, 98,115, 40, 24,166,100,105,118, 95,  4,100,
+    105,118, 40, 24, 37, 24,166,229,108, 97, 98,115, 40,229,166,108,
+    100,105,118, 95,  4,108,100,105,118, 40,229, 37,229,206,196,227,
+    132, 26,227, 32, 62, 61,173,207, 57,244, 10, 31,229,108,108, 97,
+     98,115, 40, 31,229,166,108,108,100,105,118, 95,  4,108,108,100,
+    105,118, 40, 31,229, 37, 31,229,206,134,213,235,225, 10, 19, 97,
+     98,115, 40,106,234, 40,158,145,163,101,111,102,178, 97, 98,115,
+    214,106, 41, 44, 26, 97, 98,115,178,190,234,106,204, 19,108, 97,
+     98,115, 40,106,234, 40,158,145,163,101,111,102,178,108, 97, 98,
+    115,214,106, 41, 44, 26, 97, 98,115,178, 31,190,234,106,204,134,
+     25, 10, 24,109, 15,101,110, 40,164, 37,192,166, 24,109, 98,216,
+    119, 99, 40,119, 30, 95,  4,253,241, 37,164,241,237,192,166, 24,
+    119, 99,216,109, 98, 40,148, 37,119, 30, 95,  4,206, 25, 10,192,
+    109, 98,138,111,119, 99,115, 40,119, 30, 95,  4,253,241, 37,164,
+    241,237,192,166,192,119, 99,138,111,109, 98,115, 40,148,241, 37,
+    143,119, 30, 95,  4,253,241,237,192,206,196,225, 10,125,134,  1,
+    233,175,209, 99,116, 10,134, 25, 10,  0,205,102,212, 99,146,216,
+    112, 95,247,118,101,108,205,  2, 99,147,  6,211,110,108,121,211,
+    110, 99,101,197,197,235,150,  2,103, 95,104,251,150,  2,103, 95,
+    104, 10,235,171,116,251,192, 49, 10,167,175,233,245,101,100, 32,
+     24,171,116,238,213,198,175, 78, 85, 76, 76,243, 78, 85, 76, 76,
+    193,213,196,225, 19,209, 99,116, 10,182,232,240, 34, 67, 34, 32,
+    123, 96,108, 17, 32, 13,101,100, 40,  7,227,145, 38, 38, 26,227,
+     32, 62, 61,173,207, 57,244, 19,241,  7,209, 99,116, 96,108,169,
+     19,209, 99,116,213,128,150, 99,112,121, 40,148,241, 37,164,241,
+    166,128,150,110, 99,112,121, 40,148,241, 37,164,241,237,192,206,
+     25,128,150, 99, 97,116, 40,148,241, 37,164,241,166,128,150,110,
+     99, 97,116, 40,148,241, 37,164,241,237,192,206,197, 24,109,101,
+    109, 99,109,112, 40,143,158,180, 37,143,158,180, 37,192,166, 24,
+    150, 99,109,112, 40,164, 37,164,166, 24,150,110, 99,109,112, 40,
+    164, 37,164, 37,192,166, 24,150,130,108,168,164, 37,164,206, 25,
+    192,150,120,102,114,109, 40,148,241, 37,164,241,237,192,206, 25,
+    128,150, 27,114, 40,164, 37, 24,166,192,150, 99,115,112,110, 40,
+    164, 37,164,166,128,150,112, 98,114,107, 40,164, 37,164,166,128,
+    150,114, 27,114, 40,164, 37, 24,166,192,150,115,112,110, 40,164,
+     37,164,166,128,150,150, 40,164, 37,164,166,128,150,216,107, 40,
+    148,241, 37,164,241,206, 25,158, 21,109,101,109, 99,112,121, 40,
+    158,180,241, 37,143,158,180,241,237,192,166,158, 21,109,101,109,
+    109,111,118,101, 40,158,180, 37,143,158,180, 37,192,166,158, 21,
+    109,101,109, 27,114, 40,143,158,180, 37, 24, 37,192,166,158, 21,
+    109,101,109,169,116, 40,158,180, 37, 24, 37,192,206, 25,128,150,
+    139,114,212, 40, 24,166,192,150,247,110, 40,164,206,196,225, 10,
+    125,134,  1,233,175,209, 99,116, 10,134, 25, 10,  0,205,102,212,
+     99,146,216,112, 95,247,118,101,108,205,  2, 99,147,  6,211,110,
+    108,121,211,110, 99,101,197,197,235,116,105,109,146,104,251,116,
+    105,109,146,104, 10,235,171,116,251,192, 49, 10,167,175,233,245,
+    101,100, 32, 24,171,116,238,213,198,175, 78, 85, 76, 76,243, 78,
+     85, 76, 76,193, 32,213,196, 67, 76, 75, 95, 84, 67, 75,243, 67,
+     76, 79, 67, 75, 83, 95, 80,181, 95, 83, 69, 67, 26, 67, 76, 75,
+     95, 84, 67, 75, 32, 96,108,169,243, 67, 76, 79, 67, 75, 83, 95,
+     80,181, 95, 83, 69, 67,173, 48, 48, 32,  3,134, 25,167,175,233,
+    245,101,100, 32, 24, 99,  9, 99,107, 95,116,238, 10,167,175,233,
+    245,101,100, 32, 24,116,105,109,146,116,238, 25,150,117,188,116,
+    109, 32,123,  3, 24,116,109, 95,169, 99,238,  3, 24,116,109, 95,
+    109,  2,238,  3, 24,116,109, 95,104, 12,114,238,  3, 24,116,109,
+     95,109,100, 97,121,238,  3, 24,116,109, 95,109,111,110,238,  3,
+     24,116,109, 95,121,101, 22,238,  3, 24,116,109, 95,119,100, 97,
+    121,238,  3, 24,116,109, 95,121,100, 97,121,238,  3, 24,116,109,
+     95,239,100,138,238, 10,125, 59,129,196,225, 10,182,232,240, 34,
+     67, 34, 32,123,213, 99,  9, 99,107, 95,  4, 99,  9, 99,107, 40,
+    158,166, 20,100, 17,102,116,105,109,101, 40,116,105,109,146,  4,
+     37,116,105,109,146,  4,166,116,105,109,146,  4,109,107,116,105,
+    109,101, 40,150,117,188,116,109,180,166,116,105,109,146,  4,116,
+    105,109,101, 40,116,105,109,146,  4,253,206,132, 26,227, 32, 62,
+     61, 32, 50,244, 49, 49, 50, 10,150,117,188,116,105,109,101,115,
+    112,101, 99, 32,123,  3,116,105,109,146,  4,116,118, 95,169, 99,
+    238,  3, 31,116,118, 95,110,169, 99,238, 10,125, 59,236, 84, 73,
+     77, 69, 95, 85, 84, 67,173,129, 24,116,105,109,101,115,112,101,
+     99, 95,103,101,116, 40,150,117,188,116,105,109,101,115,112,101,
+     99, 21, 37, 24,206,213,128,203, 99,116,105,109,101, 40,143,150,
+    117,188,116,109,180,166,128, 99,116,105,109,101, 40,143,116,105,
+    109,146,  4,253,166,150,117,188,116,109, 21,103,109,116,105,109,
+    101, 40,143,116,105,109,146,  4,253,166,150,117,188,116,109, 21,
+      9, 99,165,116,105,109,101, 40,143,116,105,109,146,  4,253,166,
+    192,150,102,116,105,109,101, 40,148, 37,192,237,164,237,143,150,
+    117,188,116,109,180,206,196,225, 10,125,213,134, 25, 10,  0};
+
+#define HDRSTACKDEPTH  6
+
+/* end of build/derived/arm/thumb/headers.c */
@@ -0,0 +1,2219 @@
+static RProc * const rprocs[] = {
+  0
+};
+
+typedef int32 propproc(const PendingOp *const p);
+static propproc * const peepprops[] = {
+ a_loads_r1,
+ a_uses_r1,
+ a_uses_r2,
+ a_uses_r3,
+ a_uses_r4,
+ a_loads_r2
+};
+#define p_loads_r1 0
+#define p_uses_r1 1
+#define p_uses_r2 2
+#define p_uses_r3 3
+#define p_uses_r4 4
+#define p_loads_r2 5
+#define fb_(a, b) ((((int32)(a))<<8) | (b))
+#define fh_(a, b) ((((int32)(a))<<16) | (b))
+static const int32 peepsets[] = {
+  /*  0*/J_MOVC+J_ALIGN4,
+  /*  1*/J_CLRC+J_ALIGN4,
+  /*  2*/J_CALLR,
+  /*  3*/J_MULR,
+  /*  4*/J_STRBR,
+  /*  5*/J_STRWR,
+  /*  6*/J_STRR,
+  /*  7*/0,
+  /*  8*/P_CMPZ,
+  /*  9*/J_MOVR,
+  /* 10*/J_ADDR,
+  /* 11*/J_MOVC+J_ALIGN4,
+  /* 12*/J_CLRC+J_ALIGN4,
+  /* 13*/J_CALLR,
+  /* 14*/J_MULR,
+  /* 15*/J_STRBK,
+  /* 16*/J_STRWK,
+  /* 17*/J_LDMW,
+  /* 18*/J_STMW,
+  /* 19*/J_MOVK,
+  /* 20*/J_MOVR,
+  /* 21*/J_ADDK,
+  /* 22*/J_ADDR,
+  /* 23*/J_SUBR,
+  /* 24*/(P_PRE+P_POST+P_CMPZ),
+  /* 25*/J_MULR,
+  /* 26*/J_LDRK+J_ALIGN1,
+  /* 27*/J_LDRWK+J_ALIGN1,
+  /* 28*/J_LDRK+J_ALIGN1+J_UNSIGNED,
+  /* 29*/J_LDRWK+J_ALIGN1+J_UNSIGNED,
+  /* 30*/J_LDRK+J_ALIGN1+J_SIGNED,
+  /* 31*/J_LDRWK+J_ALIGN1+J_SIGNED,
+  /* 32*/J_LDMW,
+  /* 33*/J_STMW,
+  /* 34*/J_CMPK+Q_EQ,
+  /* 35*/J_CMPK+Q_NE,
+  /* 36*/J_CMPK+Q_UEQ,
+  /* 37*/J_CMPK+Q_UNE,
+  /* 38*/~(J_SIGNED+J_UNSIGNED),
+  /* 39*/J_MOVR,
+  /* 40*/J_NEGR,
+  /* 41*/J_NOTR,
+  /* 42*/J_ADDK,
+  /* 43*/J_ADDR,
+  /* 44*/J_SUBR,
+  /* 45*/J_RSBK,
+  /* 46*/J_RSBR,
+  /* 47*/J_ANDK,
+  /* 48*/J_ANDR,
+  /* 49*/J_BICR,
+  /* 50*/J_ORRK,
+  /* 51*/J_ORRR,
+  /* 52*/J_EORK,
+  /* 53*/J_EORR,
+  /* 54*/J_SHLR,
+  /* 55*/J_SHLK,
+  /* 56*/J_SHRR,
+  /* 57*/J_SHRK,
+  /* 58*/J_RORR,
+  /* 59*/J_RORK,
+  /* 60*/J_MULR,
+  /* 61*/J_MULK,
+  /* 62*/~Q_MASK,
+  /* 63*/J_CMPK,
+  /* 64*/J_CMPR,
+  /* 65*/J_CMPFK,
+  /* 66*/J_CMPFR,
+  /* 67*/J_CMPDK,
+  /* 68*/J_CMPDR,
+  /* 69*/~(J_SIGNED+J_UNSIGNED+J_ALIGNMENT),
+  /* 70*/J_LDRFR,
+  /* 71*/J_LDRDR,
+  /* 72*/J_STRFR,
+  /* 73*/J_STRDR,
+  /* 74*/J_LDRBR,
+  /* 75*/J_LDRWR,
+  /* 76*/J_LDRR,
+  /* 77*/J_STRBR,
+  /* 78*/J_STRWR,
+  /* 79*/J_STRR,
+  /* 80*/J_LDRBK,
+  /* 81*/J_LDRBR,
+  /* 82*/J_LDRWK,
+  /* 83*/J_LDRWR,
+  /* 84*/P_POST,
+  /* 85*/J_ADCON,
+  /* 86*/J_STRING,
+  /* 87*/J_B+Q_LT,
+  /* 88*/J_CONDEXEC+Q_LT,
+  /* 89*/J_B+Q_GE,
+  /* 90*/J_CONDEXEC+Q_GE,
+  /* 91*/J_CMPK+Q_LT,
+  /* 92*/J_CMPK+Q_GE,
+  /* 93*/J_ADDK,
+  /* 94*/J_SUBK,
+  /* 95*/J_ANDK,
+  /* 96*/J_ORRK,
+  /* 97*/J_EORK,
+  /* 98*/J_LDRK,
+  /* 99*/~J_ALIGNMENT,
+  /*100*/J_STRK,
+  /*101*/J_LDRK,
+  /*102*/J_STRK,
+  /*103*/J_STRR,
+  /*104*/J_STRBK,
+  /*105*/J_STRBR,
+  /*106*/J_STRWK,
+  /*107*/J_STRWR,
+  /*108*/J_STRBK+J_ALIGN1,
+  /*109*/J_STRBR+J_ALIGN1,
+  /*110*/J_STRWK+J_ALIGN2,
+  /*111*/J_STRWR+J_ALIGN2,
+  0
+};
+static const PeepOpDef peepsubs[] = {
+  /*  0*/{pot_op, 0, 0, 0, J_ADDR},
+  /*  1*/{pot_peep, 0, 0, 0, 0},
+  /*  2*/{pot_op, 0, 0, 0, J_ADDK},
+  /*  3*/{pot_op, 0, 0, 0, J_MOVR},
+  /*  4*/{pot_prop, 0, 0, 0, p_uses_r2},
+  /*  5*/{pot_opinset, 0, 0, 7, fh_(0, 0)},
+  /*  6*/{pot_peep_m, 0, 0, 0, fh_(8, 7)},
+  /*  7*/{pot_opinset, 0, 0, 2, fh_(0, 9)},
+  /*  8*/{pot_prop, 0, 0, 0, p_uses_r3},
+  /*  9*/{pot_opinset, 0, 0, 4, fh_(0, 0)},
+  /* 10*/{pot_prop, 0, 0, 0, p_uses_r1},
+  /* 11*/{pot_opinset, 0, 0, 8, fh_(0, 11)},
+  /* 12*/{pot_prop, 0, 0, 0, p_loads_r1},
+  /* 13*/{pot_opinset, 0, 0, 5, fh_(0, 19)},
+  /* 14*/{pot_peep_m, 0, 0, 0, fh_(24, 7)},
+  /* 15*/{pot_opinset, 0, 0, 9, fh_(0, 25)},
+  /* 16*/{pot_op, 0, 0, 0, J_NOTR},
+  /* 17*/{pot_opinset_m, 0, 0, 23, fh_(38, 39)},
+  /* 18*/{pot_op, 0, 0, 0, J_MOVC+J_ALIGN4},
+  /* 19*/{pot_peep_m, 0, 0, 0, fh_(84, 7)},
+  /* 20*/{pot_op_m, 0, 0, 0, fh_(99, 98)},
+  /* 21*/{pot_opinset_m, 0, 0, 2, fh_(99, 100)},
+  /* 22*/{pot_op, 0, 0, 0, J_ORRK},
+  /* 23*/{pot_op_m, 0, 0, 0, fh_(38, 57)},
+  /* 24*/{pot_op_m, 0, 0, 0, fh_(38, 55)}
+};
+static PeepReplace const replacements[] = {
+  /*  0*/{prt_set, pf_op, pft_field, fb_(1, pf_op)},
+  /*  1*/{prt_set, pf_r3, pft_exprn, 8},
+  /*  2*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*  3*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*  4*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*  5*/{prt_set, pf_r3, pft_exprn, 11},
+  /*  6*/{prt_set, pf_op, pft_val, J_MOVR},
+  /*  7*/{prt_set, pf_r2, pft_val, GAP},
+  /*  8*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*  9*/{prt_set, pf_op, pft_field, fb_(1, pf_op)},
+  /* 10*/{prt_set, pf_r2, pft_exprn, 12},
+  /* 11*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /* 12*/{prt_set, pf_r3, pft_exprn, 13},
+  /* 13*/{prt_set, pf_r2, pft_val, GAP},
+  /* 14*/{prt_set, pf_op, pft_val, J_MOVK},
+  /* 15*/{prt_set, pf_r3, pft_exprn, 0},
+  /* 16*/{prt_set, pf_r2, pft_val, GAP},
+  /* 17*/{prt_set, pf_op, pft_val, J_MOVK},
+  /* 18*/{prt_set, pf_r3, pft_exprn, 3},
+  /* 19*/{prt_set, pf_r2, pft_val, GAP},
+  /* 20*/{prt_set, pf_op, pft_val, J_MOVK},
+  /* 21*/{prt_swapr2r3},
+  /* 22*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /* 23*/{prt_set, pf_op, pft_val, J_BICR},
+  /* 24*/{prt_set, pf_op, pft_val, J_MOVR},
+  /* 25*/{prt_set, pf_r3, pft_field, fb_(0, pf_r2)},
+  /* 26*/{prt_set, pf_r2, pft_val, GAP},
+  /* 27*/{prt_set, pf_op, pft_val, J_SHRK+J_UNSIGNED},
+  /* 28*/{prt_set, pf_r3, pft_exprn, 14},
+  /* 29*/{prt_set, pf_op, pft_val, J_SHLK},
+  /* 30*/{prt_set, pf_r3, pft_val, 31},
+  /* 31*/{prt_set, pf_op, pft_val, J_MOVK},
+  /* 32*/{prt_set, pf_r2, pft_val, GAP},
+  /* 33*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /* 34*/{prt_set, pf_dataflow, pft_exprn, 15},
+  /* 35*/{prt_set, pf_dataflow, pft_exprn, 16},
+  /* 36*/{prt_set, pf_peep, pft_exprn, 17},
+  /* 37*/{prt_set, pf_op, pft_exprn, 18},
+  /* 38*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /* 39*/{prt_set, pf_dataflow, pft_exprn, 19},
+  /* 40*/{prt_set, pf_peep, pft_exprn, 17},
+  /* 41*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /* 42*/{prt_set, pf_r2, pft_exprn, 12},
+  /* 43*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /* 44*/{prt_set, pf_r3, pft_exprn, 8},
+  /* 45*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /* 46*/{prt_set, pf_r3, pft_exprn, 13},
+  /* 47*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /* 48*/{prt_set, pf_r3, pft_exprn, 0},
+  /* 49*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /* 50*/{prt_set, pf_r3, pft_exprn, 3},
+  /* 51*/{prt_set, pf_r3, pft_exprn, 3},
+  /* 52*/{prt_set, pf_op, pft_val, J_ORRK},
+  /* 53*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /* 54*/{prt_set, pf_op, pft_val, J_ANDK},
+  /* 55*/{prt_set, pf_dataflow, pft_exprn, 20},
+  /* 56*/{prt_set, pf_peep, pft_exprn, 21},
+  /* 57*/{prt_swapr2r3},
+  /* 58*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /* 59*/{prt_set, pf_r1, pft_field, fb_(1, pf_r3)},
+  /* 60*/{prt_set, pf_r4, pft_exprn, 23},
+  /* 61*/{prt_set, pf_r2, pft_field, fb_(1, pf_r3)},
+  /* 62*/{prt_set, pf_r4, pft_exprn, 23},
+  /* 63*/{prt_set, pf_op, pft_val, J_SHLK},
+  /* 64*/{prt_set, pf_r3, pft_val, 1},
+  /* 65*/{prt_kill},
+  /* 66*/{prt_set, pf_r1, pft_field, fb_(1, pf_r2)},
+  /* 67*/{prt_set, pf_op, pft_exprn, 24},
+  /* 68*/{prt_set, pf_peep, pft_exprn, 25},
+  /* 69*/{prt_set, pf_r3, pft_exprn, 26}
+};
+static PeepExprn const peepexprns[] = {
+ /*  0*/{peo_or, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*  1*/{peo_proc1, pep_bit, pft_val, pft_none, R_PSR,0},
+ /*  2*/{peo_and, 0, pft_field, pft_field, fb_(2, pf_r3),fb_(0, pf_r3)},
+ /*  3*/{peo_and, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*  4*/{peo_eor, 0, pft_val, pft_field, 0xffffffffL,fb_(1, pf_r3)},
+ /*  5*/{peo_shl, 0, pft_val, pft_field, 1,fb_(0, pf_r3)},
+ /*  6*/{peo_sub, 0, pft_val, pft_exprn, 0,5},
+ /*  7*/{peo_and, 0, pft_exprn, pft_exprn, 4,6},
+ /*  8*/{peo_add, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*  9*/{peo_sub, 0, pft_val, pft_field, 32,fb_(0, pf_r3)},
+ /* 10*/{peo_proc1, pep_bit, pft_exprn, pft_none, 9,0},
+ /* 11*/{peo_sub, 0, pft_exprn, pft_val, 10,1},
+ /* 12*/{peo_add, 0, pft_field, pft_field, fb_(1, pf_r2),fb_(0, pf_r3)},
+ /* 13*/{peo_eor, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /* 14*/{peo_sub, 0, pft_val, pft_field, 31,fb_(0, pf_r3)},
+ /* 15*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_dataflow),~J_DEAD_R1},
+ /* 16*/{peo_or, 0, pft_field, pft_val, fb_(2, pf_dataflow),J_DEAD_R3},
+ /* 17*/{peo_or, 0, pft_field, pft_val, fb_(2, pf_peep),P_CMPZ},
+ /* 18*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_op),1},
+ /* 19*/{peo_or, 0, pft_field, pft_val, fb_(2, pf_dataflow),J_DEAD_R1},
+ /* 20*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_dataflow),J_DEAD_R1},
+ /* 21*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_peep),P_CMPZ},
+ /* 22*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(1, pf_r1),0},
+ /* 23*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_r4),22},
+ /* 24*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),Q_MI^Q_LT},
+ /* 25*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_peep),P_POST},
+ /* 26*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_r3),255}
+};
+
+static PeepOp const p1_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, 0, 2, 31}};
+static PeepConstraint const c1[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p2_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(0, 1)}, 0, 2, 63}};
+static PeepConstraint const c2[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p3_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(2, 1)}, 0, 3, 24}};
+static PeepConstraint const c3[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p4_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(3, 1)}, 0, 1, 65}};
+static PeepConstraint const c4[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p5_ops[] = {
+  {{pot_andnot, 0, pu_r2, 0, fh_(4, 5)}, p_dead_r2, 1, 61},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 1, 65}};
+static PeepConstraint const c5[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p6_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(4, 7)}, p_dead_r2, 1, 61},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 1, 65}};
+static PeepConstraint const c6[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p7_ops[] = {
+  {{pot_andnot, 0, pu_r3, 0, fh_(8, 9)}, p_dead_r3, 1, 11},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 1, 65}};
+static PeepConstraint const c7[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p8_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(8, 7)}, p_dead_r3, 1, 11},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 1, 65}};
+static PeepConstraint const c8[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p9_ops[] = {
+  {{pot_andnot, 0, pu_r1, 0, fh_(10, 11)}, p_dead_r1, 1, 59},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 1, 65}};
+static PeepConstraint const c9[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p10_ops[] = {
+  {{pot_and, 0, pu_r1, 0, fh_(10, 7)}, p_dead_r1, 1, 59},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(3, 6)}, p_dead_r1, 1, 65}};
+static PeepConstraint const c10[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p11_ops[] = {
+  {{pot_andnot, 0, pu_r2, 0, fh_(4, 5)}, 0, 1, 61},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 0, 0}};
+static PeepConstraint const c11[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p12_ops[] = {
+  {{pot_andnot, 0, pu_r3, 0, fh_(8, 9)}, 0, 1, 11},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 0, 0}};
+static PeepConstraint const c12[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p13_ops[] = {
+  {{pot_andnot, 0, pu_r1, 0, fh_(10, 11)}, 0, 1, 59},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(3, 6)}, 0, 0, 0}};
+static PeepConstraint const c13[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p14_ops[] = {
+  {{pot_opinset, 0, pu_r2+pu_r4, 1, fh_(0, 0)}, p_dead_r2, 2, 61},
+  {{pot_op, pu_r1, pu_r1+pu_r3, 0, J_MOVR}, p_dead_r3, 1, 65}};
+static PeepConstraint const c14[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p15_ops[] = {
+  {{pot_opinset, 0, pu_r1+pu_r4, 2, fh_(0, 0)}, p_dead_r1, 2, 59},
+  {{pot_op, pu_r1, pu_r1+pu_r3, 0, J_MOVR}, p_dead_r3, 1, 65}};
+static PeepConstraint const c15[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p16_ops[] = {
+  {{pot_andnot, pu_r1, pu_r1, 0, fh_(12, 10)}, 0, 0, 0},
+  {{pot_and, pu_r1, 0, 0, fh_(13, 14)}, 0, 1, 65}};
+static PeepConstraint const c16[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_proc1, pcp_notcall, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p17_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(3, 6)}, p_dead_r3, 1, 65},
+  {{pot_opinset, pu_r1, pu_r1, 1, fh_(0, 3)}, 0, 1, 41}};
+static PeepConstraint const c17[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)},
+  {pct_lt, 0, pft_field, pft_val, fb_(0, pf_r1), 8}};
+static PeepOp const p18_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(3, 6)}, p_dead_r3, 1, 65},
+  {{pot_opinset, pu_r1, pu_r1, 1, fh_(0, 3)}, 0, 2, 57}};
+static PeepConstraint const c18[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_lt, 0, pft_field, pft_val, fb_(0, pf_r1), 8}};
+static PeepOp const p19_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(3, 6)}, p_dead_r3, 1, 65},
+  {{pot_andnot, pu_r1, pu_r1, 0, fh_(12, 15)}, 0, 1, 41}};
+static PeepConstraint const c19[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_lt, 0, pft_field, pft_val, fb_(0, pf_r1), 8}};
+static PeepOp const p20_ops[] = {
+  {{pot_op, 0, pu_r3, 0, J_ANDR}, p_dead_r3, 2, 22},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(16, 1)}, 0, 1, 65}};
+static PeepConstraint const c20[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p21_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDR}, p_dead_r2, 3, 21},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(16, 1)}, 0, 1, 65}};
+static PeepConstraint const c21[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p22_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 34)}, 0, 1, 65},
+  {{pot_and, 0, pu_r3, 0, fh_(3, 1)}, 0, 1, 56}};
+static PeepConstraint const c22[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PC, 0}};
+static PeepOp const p23_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 34)}, p_dead_r2, 1, 65},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(17, 1)}, 0, 2, 55}};
+static PeepConstraint const c23[] = {
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PC, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p24_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 34)}, 0, 1, 65},
+  {{pot_and, 0, pu_r1, 0, fh_(17, 1)}, 0, 1, 56}};
+static PeepConstraint const c24[] = {
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PC, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p25_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, p_dead_r2, 2, 51},
+  {{pot_op, pu_r1, pu_r1, 0, J_ORRK}, 0, 2, 53}};
+static PeepConstraint const c25[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p26_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, p_dead_r2, 1, 2},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c26[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_val, 0, -1}};
+static PeepOp const p27_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, p_dead_r2, 2, 49},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c27[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p28_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, p_dead_r2, 2, 47},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ORRK}, 0, 1, 65}};
+static PeepConstraint const c28[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p29_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_EORK}, p_dead_r2, 2, 45},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_EORK}, 0, 1, 65}};
+static PeepConstraint const c29[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p30_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ADDK}, p_dead_r2, 2, 43},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ADDK}, 0, 1, 65}};
+static PeepConstraint const c30[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p31_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, 0, 3, 18},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c31[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p32_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, 0, 3, 15},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c32[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p33_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_EORK}, 0, 3, 12},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c33[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p34_ops[] = {
+  {{pot_opinset_m, 0, 0, 6, fh_(62, 63)}, 0, 0, 0},
+  {{pot_opinset_m, 0, 0, 6, fh_(62, 63)}, 0, 1, 65}};
+static PeepConstraint const c34[] = {
+  {pct_proc1, pcp_regset_unused, pft_exprn, pft_none, 1, 0}};
+static PeepOp const p35_ops[] = {
+  {{pot_op, pu_r1, pu_r1, 0, J_STRBK+J_ALIGN1}, p_dead_r1, 0, 0},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 1, 69}};
+static PeepConstraint const c35[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_gtu, 0, pft_field, pft_val, fb_(1, pf_r3), 255}};
+static PeepOp const p36_ops[] = {
+  {{pot_opinset_m, 0, pu_r2, 10, fh_(69, 70)}, p_dead_r2, 1, 61},
+  {{pot_op, pu_r1, pu_r1+pu_r3, 0, J_MOVR}, 0, 1, 65}};
+static PeepConstraint const c36[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_peep), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_lt, 0, pft_field, pft_val, fb_(1, pf_r3), 8}};
+static PeepOp const p37_ops[] = {
+  {{pot_op, 0, 0, 0, J_ANDK}, 0, 1, 65},
+  {{pot_opinset_m, 0, pu_r1, 2, fh_(69, 80)}, 0, 0, 0}};
+static PeepConstraint const c37[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 255},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p38_ops[] = {
+  {{pot_op, 0, 0, 0, J_ANDK}, 0, 1, 65},
+  {{pot_opinset_m, 0, pu_r1, 2, fh_(69, 82)}, 0, 0, 0}};
+static PeepConstraint const c38[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 65535},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p39_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 1)}, 0, 1, 65},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(18, 19)}, 0, 1, 68}};
+static PeepConstraint const c39[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP}};
+static PeepOp const p40_ops[] = {
+  {{pot_op, pu_r1, pu_r1, 0, J_ADDK}, p_dead_r2, 1, 65},
+  {{pot_opinset, pu_r1, pu_r1, 2, fh_(0, 85)}, 0, 2, 41}};
+static PeepConstraint const c40[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p41_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ADDK}, p_dead_r2, 3, 9},
+  {{pot_opinset, pu_r1, pu_r1, 2, fh_(0, 85)}, 0, 1, 65}};
+static PeepConstraint const c41[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p42_ops[] = {
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(3, 1)}, 0, 1, 65},
+  {{pot_and, 0, pu_r1, 0, fh_(3, 1)}, 0, 0, 0}};
+static PeepConstraint const c42[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r1)}};
+static PeepOp const p43_ops[] = {
+  {{pot_op, 0, 0, 0, J_ANDK}, 0, 1, 65},
+  {{pot_op, 0, pu_r1, 0, J_ANDR}, 0, 0, 0},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c43[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_exprn, pft_field, 2, fb_(2, pf_r3)}};
+static PeepOp const p44_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 87)}, 0, 1, 67},
+  {{pot_opinset, 0, 0, 2, fh_(0, 91)}, p_dead_r2, 1, 65},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(17, 1)}, 0, 2, 39}};
+static PeepConstraint const c44[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PC, 0}};
+static PeepOp const p45_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 87)}, 0, 1, 67},
+  {{pot_opinset, 0, 0, 2, fh_(0, 91)}, 0, 1, 65},
+  {{pot_and, 0, pu_r1, 0, fh_(17, 1)}, 0, 1, 36}};
+static PeepConstraint const c45[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PC, 0}};
+static PeepOp const p46_ops[] = {
+  {{pot_opinset, 0, 0, 5, fh_(0, 93)}, 0, 2, 37},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c46[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(0, pf_r1), R_SP}};
+static PeepOp const p47_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(20, 1)}, 0, 3, 6},
+  {{pot_and, 0, pu_r1+pu_r2, 0, fh_(21, 1)}, 0, 0, 0}};
+static PeepConstraint const c47[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p48_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 87)}, 0, 1, 67},
+  {{pot_opinset, 0, 0, 2, fh_(0, 91)}, p_dead_r2, 1, 65},
+  {{pot_and, 0, pu_r3, 0, fh_(3, 1)}, 0, 2, 35}};
+static PeepConstraint const c48[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0}};
+static PeepOp const p49_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 87)}, 0, 1, 67},
+  {{pot_opinset, 0, 0, 2, fh_(0, 91)}, 0, 1, 65},
+  {{pot_and, 0, pu_r3, 0, fh_(3, 1)}, 0, 1, 36}};
+static PeepConstraint const c49[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0}};
+static PeepOp const p50_ops[] = {
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 65},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c50[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p51_ops[] = {
+  {{pot_opinset, 0, 0, 6, fh_(0, 102)}, p_dead_r1, 2, 33},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 65},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c51[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p52_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_SHRK+J_UNSIGNED}, p_dead_r2, 3, 3},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2, 0, fh_(38, 55)}, 0, 1, 65}};
+static PeepConstraint const c52[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p53_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(22, 1)}, 0, 2, 31}};
+static PeepConstraint const c53[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0xffffffff}};
+static PeepOp const p54_ops[] = {
+  {{pot_op, 0, 0, 0, J_ORRK}, 0, 1, 14},
+  {{pot_op, pu_r1, pu_r1, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c54[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_field, 3, fb_(1, pf_r3)}};
+static PeepOp const p55_ops[] = {
+  {{pot_op_m, 0, pu_r2, 0, fh_(38, 57)}, p_dead_r2, 1, 2},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c55[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_val, pft_exprn, 0, 7}};
+static PeepOp const p56_ops[] = {
+  {{pot_op_m, 0, pu_r2, 0, fh_(38, 57)}, p_dead_r2, 3, 0},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(23, 1)}, 0, 1, 65}};
+static PeepConstraint const c56[] = {
+  {pct_or, 0, pft_val, pft_val, 3, 4},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_le, 0, pft_exprn, pft_val, 8, 31},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_op), J_SHRK+J_UNSIGNED},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_op), fb_(0, pf_op)}};
+static PeepOp const p57_ops[] = {
+  {{pot_op_m, 0, pu_r2, 0, fh_(38, 55)}, p_dead_r2, 2, 1},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(24, 1)}, 0, 1, 65}};
+static PeepConstraint const c57[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_le, 0, pft_exprn, pft_val, 8, 31}};
+static PeepOp const p58_ops[] = {
+  {{pot_opinset, 0, pu_r1, 2, fh_(0, 108)}, p_dead_r1, 1, 66},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c58[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 255},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_ne, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p59_ops[] = {
+  {{pot_opinset, 0, pu_r1, 2, fh_(0, 110)}, p_dead_r1, 1, 66},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c59[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 65535},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_ne, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p60_ops[] = {
+  {{pot_op_m, 0, 0, 0, fh_(38, 55)}, 0, 0, 0},
+  {{pot_op, pu_r1, pu_r1, 0, J_ANDK}, 0, 1, 65}};
+static PeepConstraint const c60[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 1},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 31}};
+static PeepOp const p61_ops[] = {
+  {{pot_op_m, 0, 0, 0, fh_(38, 55)}, 0, 2, 27},
+  {{pot_op, pu_r1, pu_r1, 0, J_ANDK}, 0, 2, 29}};
+static PeepConstraint const c61[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 1},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(0, pf_r3), 31}};
+static PeepHole const patterns[] = {
+  {&p1_ops[0], &c1[0], 1, 1, 0, 0},
+  {&p2_ops[0], &c2[0], 1, 1, 0, 0},
+  {&p3_ops[0], &c3[0], 1, 1, 0, 0},
+  {&p4_ops[0], &c4[0], 1, 1, 0, 0},
+  {&p5_ops[0], &c5[0], 2, 2, 0, 0},
+  {&p6_ops[0], &c6[0], 2, 1, 0, 0},
+  {&p7_ops[0], &c7[0], 2, 2, 0, 0},
+  {&p8_ops[0], &c8[0], 2, 1, 0, 0},
+  {&p9_ops[0], &c9[0], 2, 2, 0, 0},
+  {&p10_ops[0], &c10[0], 2, 1, 0, 0},
+  {&p11_ops[0], &c11[0], 2, 2, 0, 0},
+  {&p12_ops[0], &c12[0], 2, 2, 0, 0},
+  {&p13_ops[0], &c13[0], 2, 2, 0, 0},
+  {&p14_ops[0], &c14[0], 2, 2, 0, 0},
+  {&p15_ops[0], &c15[0], 2, 2, 0, 0},
+  {&p16_ops[0], &c16[0], 2, 2, 0, 0},
+  {&p17_ops[0], &c17[0], 2, 3, 0, 0},
+  {&p18_ops[0], &c18[0], 2, 4, 0, 0},
+  {&p19_ops[0], &c19[0], 2, 2, 0, 0},
+  {&p20_ops[0], &c20[0], 2, 1, 0, 0},
+  {&p21_ops[0], &c21[0], 2, 1, 0, 0},
+  {&p22_ops[0], &c22[0], 2, 3, 0, 0},
+  {&p23_ops[0], &c23[0], 2, 3, 0, 0},
+  {&p24_ops[0], &c24[0], 2, 3, 0, 0},
+  {&p25_ops[0], &c25[0], 2, 1, 0, 0},
+  {&p26_ops[0], &c26[0], 2, 2, 0, 0},
+  {&p27_ops[0], &c27[0], 2, 1, 0, 0},
+  {&p28_ops[0], &c28[0], 2, 1, 0, 0},
+  {&p29_ops[0], &c29[0], 2, 1, 0, 0},
+  {&p30_ops[0], &c30[0], 2, 1, 0, 0},
+  {&p31_ops[0], &c31[0], 2, 1, 0, 0},
+  {&p32_ops[0], &c32[0], 2, 1, 0, 0},
+  {&p33_ops[0], &c33[0], 2, 1, 0, 0},
+  {&p34_ops[0], &c34[0], 2, 1, 0, 0},
+  {&p35_ops[0], &c35[0], 2, 2, 0, 0},
+  {&p36_ops[0], &c36[0], 2, 3, 0, 0},
+  {&p37_ops[0], &c37[0], 2, 3, 0, 0},
+  {&p38_ops[0], &c38[0], 2, 3, 0, 0},
+  {&p39_ops[0], &c39[0], 2, 4, 0, 0},
+  {&p40_ops[0], &c40[0], 2, 1, 0, 0},
+  {&p41_ops[0], &c41[0], 2, 1, 0, 0},
+  {&p42_ops[0], &c42[0], 2, 2, 0, 0},
+  {&p43_ops[0], &c43[0], 3, 4, 0, 0},
+  {&p44_ops[0], &c44[0], 3, 3, 0, 0},
+  {&p45_ops[0], &c45[0], 3, 3, 0, 0},
+  {&p46_ops[0], &c46[0], 2, 2, 0, 0},
+  {&p47_ops[0], &c47[0], 2, 3, 0, G_STR},
+  {&p48_ops[0], &c48[0], 3, 2, 0, 0},
+  {&p49_ops[0], &c49[0], 3, 2, 0, 0},
+  {&p50_ops[0], &c50[0], 2, 2, 0, 0},
+  {&p51_ops[0], &c51[0], 3, 2, 0, G_ANY},
+  {&p52_ops[0], &c52[0], 2, 2, 0, 0},
+  {&p53_ops[0], &c53[0], 1, 1, 0, 0},
+  {&p54_ops[0], &c54[0], 2, 2, 0, 0},
+  {&p55_ops[0], &c55[0], 2, 2, 0, 0},
+  {&p56_ops[0], &c56[0], 2, 3, 0, 0},
+  {&p57_ops[0], &c57[0], 2, 2, 0, 0},
+  {&p58_ops[0], &c58[0], 2, 3, 0, 0},
+  {&p59_ops[0], &c59[0], 2, 3, 0, 0},
+  {&p60_ops[0], &c60[0], 2, 3, 0, 0},
+  {&p61_ops[0], &c61[0], 2, 3, 0, 0}
+};
+
+#define PeepholeMax 61
+#define MaxInst 3
+#if pcp_argct_regset_unused != 1
+ # error wrong argument count for pcp_regset_unused
+#endif
+#if pcp_argct_regset_unkilled != 1
+ # error wrong argument count for pcp_regset_unkilled
+#endif
+#if pcp_argct_notcall != 1
+ # error wrong argument count for pcp_notcall
+#endif
+#if pep_argct_bit != 1
+ # error wrong argument count for pep_bit
+#endif
+static int const po_2[] = { /* B */
+	43,
+	44,
+	47,
+	48
+};
+static int const po_4[] = { /* LDRK */
+	4,
+	10,
+	15,
+	46
+};
+static int const po_5[] = { /* LDRR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_6[] = { /* LDRVK */
+	15
+};
+static int const po_7[] = { /* LDRV */
+	15
+};
+static int const po_8[] = { /* LDRBK */
+	4,
+	10,
+	15
+};
+static int const po_9[] = { /* LDRBR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_10[] = { /* LDRBVK */
+	15
+};
+static int const po_11[] = { /* LDRBV */
+	15
+};
+static int const po_12[] = { /* LDRWK */
+	4,
+	10,
+	15
+};
+static int const po_13[] = { /* LDRWR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_14[] = { /* LDRWVK */
+	15
+};
+static int const po_15[] = { /* LDRWV */
+	15
+};
+static int const po_16[] = { /* LDRLK */
+	4,
+	10,
+	15
+};
+static int const po_17[] = { /* LDRLR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_18[] = { /* LDRLVK */
+	15
+};
+static int const po_19[] = { /* LDRLV */
+	15
+};
+static int const po_20[] = { /* LDRFK */
+	4,
+	10,
+	15
+};
+static int const po_21[] = { /* LDRFR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_22[] = { /* LDRFVK */
+	15
+};
+static int const po_23[] = { /* LDRFV */
+	15
+};
+static int const po_24[] = { /* LDRDK */
+	4,
+	10,
+	15
+};
+static int const po_25[] = { /* LDRDR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_26[] = { /* LDRDVK */
+	15
+};
+static int const po_27[] = { /* LDRDV */
+	15
+};
+static int const po_28[] = { /* STRK */
+	4,
+	8,
+	10,
+	12,
+	50
+};
+static int const po_29[] = { /* STRR */
+	6,
+	8,
+	11,
+	12,
+	35,
+	50
+};
+static int const po_30[] = { /* STRVK */
+	8,
+	12
+};
+static int const po_31[] = { /* STRV */
+	8,
+	12
+};
+static int const po_32[] = { /* STRBK */
+	4,
+	10,
+	34,
+	50,
+	57
+};
+static int const po_33[] = { /* STRBR */
+	6,
+	8,
+	11,
+	12,
+	35,
+	50,
+	57
+};
+static int const po_34[] = { /* STRBVK */
+	8,
+	12
+};
+static int const po_35[] = { /* STRBV */
+	8,
+	12
+};
+static int const po_36[] = { /* STRWK */
+	4,
+	10,
+	50,
+	58
+};
+static int const po_37[] = { /* STRWR */
+	6,
+	8,
+	11,
+	12,
+	35,
+	50,
+	58
+};
+static int const po_38[] = { /* STRWVK */
+	8,
+	12
+};
+static int const po_39[] = { /* STRWV */
+	8,
+	12
+};
+static int const po_40[] = { /* STRLK */
+	4,
+	8,
+	10,
+	12
+};
+static int const po_41[] = { /* STRLR */
+	4,
+	6,
+	8,
+	10,
+	11,
+	12
+};
+static int const po_42[] = { /* STRLVK */
+	8,
+	12
+};
+static int const po_43[] = { /* STRLV */
+	8,
+	12
+};
+static int const po_44[] = { /* STRFK */
+	4,
+	8,
+	10,
+	12
+};
+static int const po_45[] = { /* STRFR */
+	4,
+	6,
+	8,
+	10,
+	11,
+	12,
+	35
+};
+static int const po_46[] = { /* STRFVK */
+	8,
+	12
+};
+static int const po_47[] = { /* STRFV */
+	8,
+	12
+};
+static int const po_48[] = { /* STRDK */
+	4,
+	8,
+	10,
+	12
+};
+static int const po_49[] = { /* STRDR */
+	4,
+	6,
+	8,
+	10,
+	11,
+	12,
+	35
+};
+static int const po_50[] = { /* STRDVK */
+	8,
+	12
+};
+static int const po_51[] = { /* STRDV */
+	8,
+	12
+};
+static int const po_52[] = { /* LDRV1 */
+	15
+};
+static int const po_53[] = { /* PUSHR */
+	8,
+	12
+};
+static int const po_54[] = { /* MOVK */
+	15,
+	49
+};
+static int const po_55[] = { /* MOVR */
+	3,
+	6,
+	7,
+	11,
+	15,
+	16,
+	17,
+	18,
+	41
+};
+static int const po_56[] = { /* CMPK */
+	4,
+	10,
+	21,
+	22,
+	23,
+	33
+};
+static int const po_57[] = { /* CMPR */
+	4,
+	6,
+	10,
+	11,
+	33
+};
+static int const po_58[] = { /* CHKLK */
+	4,
+	10
+};
+static int const po_59[] = { /* CHKLR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_60[] = { /* CHKUK */
+	4,
+	10
+};
+static int const po_61[] = { /* CHKUR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_64[] = { /* LDRLV1 */
+	15
+};
+static int const po_65[] = { /* PUSHL */
+	8,
+	12
+};
+static int const po_66[] = { /* MOVLK */
+	15
+};
+static int const po_67[] = { /* MOVLR */
+	6,
+	11,
+	15
+};
+static int const po_68[] = { /* LDRFV1 */
+	15
+};
+static int const po_69[] = { /* PUSHF */
+	8,
+	12
+};
+static int const po_70[] = { /* MOVFK */
+	15
+};
+static int const po_71[] = { /* MOVFR */
+	6,
+	11,
+	15
+};
+static int const po_72[] = { /* LDRDV1 */
+	15
+};
+static int const po_73[] = { /* PUSHD */
+	8,
+	12
+};
+static int const po_74[] = { /* MOVDK */
+	15
+};
+static int const po_75[] = { /* MOVDR */
+	6,
+	11,
+	15
+};
+static int const po_76[] = { /* ANDK */
+	0,
+	4,
+	10,
+	15,
+	24,
+	26,
+	30,
+	36,
+	37,
+	42,
+	45
+};
+static int const po_77[] = { /* ANDR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	19,
+	20
+};
+static int const po_78[] = { /* ORRK */
+	4,
+	10,
+	15,
+	25,
+	27,
+	31,
+	45,
+	52,
+	53
+};
+static int const po_79[] = { /* ORRR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_80[] = { /* EORK */
+	4,
+	10,
+	15,
+	28,
+	32,
+	45
+};
+static int const po_81[] = { /* EORR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_82[] = { /* ADDK */
+	2,
+	4,
+	10,
+	15,
+	29,
+	38,
+	39,
+	40,
+	45
+};
+static int const po_83[] = { /* ADDR */
+	1,
+	4,
+	5,
+	6,
+	7,
+	10,
+	11,
+	15
+};
+static int const po_84[] = { /* CALLK */
+	15
+};
+static int const po_85[] = { /* CALLR */
+	15
+};
+static int const po_86[] = { /* MULK */
+	4,
+	10,
+	15
+};
+static int const po_87[] = { /* MULR */
+	15
+};
+static int const po_88[] = { /* CMPFK */
+	4,
+	10,
+	33
+};
+static int const po_89[] = { /* CMPFR */
+	4,
+	6,
+	10,
+	11,
+	33
+};
+static int const po_90[] = { /* CHKNEFK */
+	4,
+	10
+};
+static int const po_91[] = { /* CHKNEFR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_92[] = { /* CHKNEDK */
+	4,
+	10
+};
+static int const po_93[] = { /* CHKNEDR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_94[] = { /* CHKNEK */
+	4,
+	10
+};
+static int const po_95[] = { /* CHKNER */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_96[] = { /* OPSYSK */
+	15
+};
+static int const po_97[] = { /* CSE_LOADR */
+	15
+};
+static int const po_98[] = { /* INIT */
+	15
+};
+static int const po_101[] = { /* ADCONF */
+	15
+};
+static int const po_102[] = { /* ADCOND */
+	15
+};
+static int const po_103[] = { /* STRING */
+	15
+};
+static int const po_104[] = { /* SUBK */
+	4,
+	10,
+	15,
+	45
+};
+static int const po_105[] = { /* SUBR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_106[] = { /* DIVK */
+	4,
+	10,
+	15
+};
+static int const po_107[] = { /* DIVR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_108[] = { /* RSBK */
+	4,
+	10,
+	15
+};
+static int const po_109[] = { /* RSBR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_110[] = { /* REMK */
+	4,
+	10,
+	15
+};
+static int const po_111[] = { /* REMR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_112[] = { /* SHLK */
+	4,
+	10,
+	15,
+	56,
+	59,
+	60
+};
+static int const po_113[] = { /* SHLR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_114[] = { /* SHRK */
+	4,
+	10,
+	15,
+	51,
+	54,
+	55
+};
+static int const po_115[] = { /* SHRR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_116[] = { /* INLINE1 */
+	4,
+	10,
+	15
+};
+static int const po_117[] = { /* NEGR */
+	6,
+	11,
+	15
+};
+static int const po_118[] = { /* NOTR */
+	6,
+	11,
+	15
+};
+static int const po_119[] = { /* ADCONV */
+	15
+};
+static int const po_120[] = { /* USEF */
+	8,
+	12
+};
+static int const po_121[] = { /* INITF */
+	15
+};
+static int const po_122[] = { /* ADDFK */
+	4,
+	10,
+	15
+};
+static int const po_123[] = { /* ADDFR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_124[] = { /* MULFK */
+	4,
+	10,
+	15
+};
+static int const po_125[] = { /* MULFR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_126[] = { /* INLINE1F */
+	4,
+	10,
+	15
+};
+static int const po_127[] = { /* SUBFK */
+	4,
+	10,
+	15
+};
+static int const po_128[] = { /* SUBFR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_129[] = { /* DIVFK */
+	4,
+	10,
+	15
+};
+static int const po_130[] = { /* DIVFR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_131[] = { /* NEGFR */
+	6,
+	11,
+	15
+};
+static int const po_132[] = { /* FLTFR */
+	6,
+	11,
+	15
+};
+static int const po_133[] = { /* FIXFR */
+	6,
+	11,
+	15
+};
+static int const po_134[] = { /* MOVDFR */
+	6,
+	11,
+	15
+};
+static int const po_135[] = { /* MOVIFR */
+	6,
+	11,
+	15
+};
+static int const po_136[] = { /* ADCON */
+	15
+};
+static int const po_137[] = { /* USED */
+	8,
+	12
+};
+static int const po_138[] = { /* INITD */
+	15
+};
+static int const po_139[] = { /* CMPDK */
+	4,
+	10,
+	33
+};
+static int const po_140[] = { /* CMPDR */
+	4,
+	6,
+	10,
+	11,
+	33
+};
+static int const po_141[] = { /* ADDDK */
+	4,
+	10,
+	15
+};
+static int const po_142[] = { /* ADDDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_143[] = { /* MULDK */
+	4,
+	10,
+	15
+};
+static int const po_144[] = { /* MULDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_145[] = { /* MOVIDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_146[] = { /* INLINE1D */
+	4,
+	10,
+	15
+};
+static int const po_147[] = { /* SUBDK */
+	4,
+	10,
+	15
+};
+static int const po_148[] = { /* SUBDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_149[] = { /* DIVDK */
+	4,
+	10,
+	15
+};
+static int const po_150[] = { /* DIVDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_151[] = { /* NEGDR */
+	6,
+	11,
+	15
+};
+static int const po_152[] = { /* FLTDR */
+	6,
+	11,
+	15
+};
+static int const po_153[] = { /* FIXDR */
+	6,
+	11,
+	15
+};
+static int const po_154[] = { /* MOVFDR */
+	6,
+	11,
+	15
+};
+static int const po_155[] = { /* CSE_WORD1 */
+	6,
+	11,
+	15
+};
+static int const po_156[] = { /* CSE_WORD2 */
+	6,
+	11,
+	15
+};
+static int const po_157[] = { /* CLRC */
+	14
+};
+static int const po_158[] = { /* MOVC */
+	13,
+	14
+};
+static int const po_159[] = { /* TAILCALLK */
+	15
+};
+static int const po_160[] = { /* TAILCALLR */
+	6,
+	11,
+	15
+};
+static int const po_165[] = { /* RESULT2 */
+	6,
+	11,
+	15
+};
+static int const po_166[] = { /* FNCON */
+	15
+};
+static int const po_167[] = { /* MOVDIR */
+	6,
+	11,
+	15
+};
+static int const po_168[] = { /* MOVFIR */
+	6,
+	11,
+	15
+};
+static int const po_170[] = { /* EXTEND */
+	4,
+	10,
+	15
+};
+static int const po_171[] = { /* RORK */
+	4,
+	10,
+	15
+};
+static int const po_172[] = { /* RORR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_178[] = { /* CONDEXEC */
+	43,
+	44,
+	47,
+	48
+};
+static int const po_180[] = { /* MOVLIR */
+	6,
+	11,
+	15
+};
+static int const po_181[] = { /* MOVILR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_184[] = { /* CASEBRANCH */
+	8,
+	12
+};
+static int const po_185[] = { /* USE */
+	8,
+	12
+};
+static int const po_186[] = { /* SCCK */
+	15
+};
+static int const po_187[] = { /* BZ */
+	4,
+	10
+};
+static int const po_190[] = { /* ADJUST */
+	4,
+	10,
+	15
+};
+static int const po_191[] = { /* RSBDK */
+	4,
+	10,
+	15
+};
+static int const po_192[] = { /* RSBDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_193[] = { /* RDVDK */
+	4,
+	10,
+	15
+};
+static int const po_194[] = { /* RDVDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_195[] = { /* RSBDK */
+	4,
+	10,
+	15
+};
+static int const po_196[] = { /* RSBDR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_197[] = { /* RDVFK */
+	4,
+	10,
+	15
+};
+static int const po_198[] = { /* RDVFR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_199[] = { /* MLAR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_200[] = { /* MLAK */
+	4,
+	10,
+	15
+};
+static int const po_201[] = { /* MULL */
+	6,
+	11,
+	15
+};
+static int const po_202[] = { /* MLAL */
+	4,
+	6,
+	8,
+	10,
+	11,
+	12
+};
+static int const po_203[] = { /* ADCONLL */
+	15
+};
+static int const po_206[] = { /* FIXDRM */
+	6,
+	11,
+	15
+};
+static int const po_207[] = { /* FIXDRM */
+	6,
+	11,
+	15
+};
+static int const po_210[] = { /* BINRK */
+	4,
+	10,
+	15
+};
+static int const po_211[] = { /* BINRR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_212[] = { /* BINRRK */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_213[] = { /* BINRRR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_214[] = { /* MOVK */
+	15,
+	49
+};
+static int const po_215[] = { /* MOVR */
+	3,
+	6,
+	7,
+	11,
+	15,
+	16,
+	17,
+	18,
+	41
+};
+static int const po_216[] = { /* MOVRK */
+	6,
+	11,
+	15
+};
+static int const po_217[] = { /* MOVRR */
+	6,
+	11,
+	15
+};
+static int const po_218[] = { /* CMPK */
+	4,
+	10,
+	21,
+	22,
+	23,
+	33
+};
+static int const po_219[] = { /* CMPR */
+	4,
+	6,
+	10,
+	11,
+	33
+};
+static int const po_220[] = { /* CMPRK */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_221[] = { /* CMPRR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_222[] = { /* LDRK */
+	4,
+	10,
+	15,
+	46
+};
+static int const po_223[] = { /* LDRR */
+	4,
+	6,
+	10,
+	11,
+	15,
+	35
+};
+static int const po_224[] = { /* LDRKW */
+	4,
+	10,
+	15
+};
+static int const po_225[] = { /* LDRRW */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_226[] = { /* STRK */
+	4,
+	8,
+	10,
+	12,
+	50
+};
+static int const po_227[] = { /* STRR */
+	6,
+	8,
+	11,
+	12,
+	35,
+	50
+};
+static int const po_228[] = { /* STRKW */
+	4,
+	8,
+	10,
+	12
+};
+static int const po_229[] = { /* STRRW */
+	4,
+	6,
+	8,
+	10,
+	11,
+	12
+};
+static int const po_230[] = { /* LDM */
+	8,
+	12
+};
+static int const po_232[] = { /* STM */
+	8,
+	12
+};
+static int const po_234[] = { /* MRS */
+	15
+};
+static int const po_235[] = { /* MSR */
+	6,
+	11
+};
+static int const po_237[] = { /* SWP */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_238[] = { /* SWPB */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_241[] = { /* MRC */
+	15
+};
+static int const po_242[] = { /* MCR */
+	8,
+	12
+};
+static int const po_243[] = { /* LDC */
+	4,
+	10
+};
+static int const po_244[] = { /* LDCW */
+	4,
+	10
+};
+static int const po_245[] = { /* STC */
+	4,
+	10
+};
+static int const po_246[] = { /* STCW */
+	4,
+	10
+};
+static int const po_249[] = { /* ADCK */
+	4,
+	10,
+	15
+};
+static int const po_250[] = { /* ADCR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_251[] = { /* SBCK */
+	4,
+	10,
+	15
+};
+static int const po_252[] = { /* SBCR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_253[] = { /* RSCK */
+	4,
+	10,
+	15
+};
+static int const po_254[] = { /* RSCR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_255[] = { /* TSTK */
+	4,
+	10
+};
+static int const po_256[] = { /* TSTR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_257[] = { /* BICK */
+	4,
+	10,
+	15
+};
+static int const po_258[] = { /* BICR */
+	4,
+	6,
+	10,
+	11,
+	15
+};
+static int const po_259[] = { /* CMNK */
+	4,
+	10
+};
+static int const po_260[] = { /* CMNR */
+	4,
+	6,
+	10,
+	11
+};
+static int const po_261[] = { /* MVNK */
+	4,
+	10
+};
+static int const po_262[] = { /* MVNR */
+	4,
+	6,
+	10,
+	11
+};
+
+static struct { int i; int const *peepv; } const peepholeperop[] = {
+	{0, 0},
+	{0, 0},
+	{4, &po_2[0]},
+	{0, 0},
+	{4, &po_4[0]},
+	{6, &po_5[0]},
+	{1, &po_6[0]},
+	{1, &po_7[0]},
+	{3, &po_8[0]},
+	{6, &po_9[0]},
+	{1, &po_10[0]},
+	{1, &po_11[0]},
+	{3, &po_12[0]},
+	{6, &po_13[0]},
+	{1, &po_14[0]},
+	{1, &po_15[0]},
+	{3, &po_16[0]},
+	{5, &po_17[0]},
+	{1, &po_18[0]},
+	{1, &po_19[0]},
+	{3, &po_20[0]},
+	{6, &po_21[0]},
+	{1, &po_22[0]},
+	{1, &po_23[0]},
+	{3, &po_24[0]},
+	{6, &po_25[0]},
+	{1, &po_26[0]},
+	{1, &po_27[0]},
+	{5, &po_28[0]},
+	{6, &po_29[0]},
+	{2, &po_30[0]},
+	{2, &po_31[0]},
+	{5, &po_32[0]},
+	{7, &po_33[0]},
+	{2, &po_34[0]},
+	{2, &po_35[0]},
+	{4, &po_36[0]},
+	{7, &po_37[0]},
+	{2, &po_38[0]},
+	{2, &po_39[0]},
+	{4, &po_40[0]},
+	{6, &po_41[0]},
+	{2, &po_42[0]},
+	{2, &po_43[0]},
+	{4, &po_44[0]},
+	{7, &po_45[0]},
+	{2, &po_46[0]},
+	{2, &po_47[0]},
+	{4, &po_48[0]},
+	{7, &po_49[0]},
+	{2, &po_50[0]},
+	{2, &po_51[0]},
+	{1, &po_52[0]},
+	{2, &po_53[0]},
+	{2, &po_54[0]},
+	{9, &po_55[0]},
+	{6, &po_56[0]},
+	{5, &po_57[0]},
+	{2, &po_58[0]},
+	{4, &po_59[0]},
+	{2, &po_60[0]},
+	{4, &po_61[0]},
+	{0, 0},
+	{0, 0},
+	{1, &po_64[0]},
+	{2, &po_65[0]},
+	{1, &po_66[0]},
+	{3, &po_67[0]},
+	{1, &po_68[0]},
+	{2, &po_69[0]},
+	{1, &po_70[0]},
+	{3, &po_71[0]},
+	{1, &po_72[0]},
+	{2, &po_73[0]},
+	{1, &po_74[0]},
+	{3, &po_75[0]},
+	{11, &po_76[0]},
+	{7, &po_77[0]},
+	{9, &po_78[0]},
+	{5, &po_79[0]},
+	{6, &po_80[0]},
+	{5, &po_81[0]},
+	{9, &po_82[0]},
+	{8, &po_83[0]},
+	{1, &po_84[0]},
+	{1, &po_85[0]},
+	{3, &po_86[0]},
+	{1, &po_87[0]},
+	{3, &po_88[0]},
+	{5, &po_89[0]},
+	{2, &po_90[0]},
+	{4, &po_91[0]},
+	{2, &po_92[0]},
+	{4, &po_93[0]},
+	{2, &po_94[0]},
+	{4, &po_95[0]},
+	{1, &po_96[0]},
+	{1, &po_97[0]},
+	{1, &po_98[0]},
+	{0, 0},
+	{0, 0},
+	{1, &po_101[0]},
+	{1, &po_102[0]},
+	{1, &po_103[0]},
+	{4, &po_104[0]},
+	{5, &po_105[0]},
+	{3, &po_106[0]},
+	{5, &po_107[0]},
+	{3, &po_108[0]},
+	{5, &po_109[0]},
+	{3, &po_110[0]},
+	{5, &po_111[0]},
+	{6, &po_112[0]},
+	{5, &po_113[0]},
+	{6, &po_114[0]},
+	{5, &po_115[0]},
+	{3, &po_116[0]},
+	{3, &po_117[0]},
+	{3, &po_118[0]},
+	{1, &po_119[0]},
+	{2, &po_120[0]},
+	{1, &po_121[0]},
+	{3, &po_122[0]},
+	{5, &po_123[0]},
+	{3, &po_124[0]},
+	{5, &po_125[0]},
+	{3, &po_126[0]},
+	{3, &po_127[0]},
+	{5, &po_128[0]},
+	{3, &po_129[0]},
+	{5, &po_130[0]},
+	{3, &po_131[0]},
+	{3, &po_132[0]},
+	{3, &po_133[0]},
+	{3, &po_134[0]},
+	{3, &po_135[0]},
+	{1, &po_136[0]},
+	{2, &po_137[0]},
+	{1, &po_138[0]},
+	{3, &po_139[0]},
+	{5, &po_140[0]},
+	{3, &po_141[0]},
+	{5, &po_142[0]},
+	{3, &po_143[0]},
+	{5, &po_144[0]},
+	{5, &po_145[0]},
+	{3, &po_146[0]},
+	{3, &po_147[0]},
+	{5, &po_148[0]},
+	{3, &po_149[0]},
+	{5, &po_150[0]},
+	{3, &po_151[0]},
+	{3, &po_152[0]},
+	{3, &po_153[0]},
+	{3, &po_154[0]},
+	{3, &po_155[0]},
+	{3, &po_156[0]},
+	{1, &po_157[0]},
+	{2, &po_158[0]},
+	{1, &po_159[0]},
+	{3, &po_160[0]},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{3, &po_165[0]},
+	{1, &po_166[0]},
+	{3, &po_167[0]},
+	{3, &po_168[0]},
+	{0, 0},
+	{3, &po_170[0]},
+	{3, &po_171[0]},
+	{5, &po_172[0]},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{4, &po_178[0]},
+	{0, 0},
+	{3, &po_180[0]},
+	{5, &po_181[0]},
+	{0, 0},
+	{0, 0},
+	{2, &po_184[0]},
+	{2, &po_185[0]},
+	{1, &po_186[0]},
+	{2, &po_187[0]},
+	{0, 0},
+	{0, 0},
+	{3, &po_190[0]},
+	{3, &po_191[0]},
+	{5, &po_192[0]},
+	{3, &po_193[0]},
+	{5, &po_194[0]},
+	{3, &po_195[0]},
+	{5, &po_196[0]},
+	{3, &po_197[0]},
+	{5, &po_198[0]},
+	{5, &po_199[0]},
+	{3, &po_200[0]},
+	{3, &po_201[0]},
+	{6, &po_202[0]},
+	{1, &po_203[0]},
+	{0, 0},
+	{0, 0},
+	{3, &po_206[0]},
+	{3, &po_207[0]},
+	{0, 0},
+	{0, 0},
+	{3, &po_210[0]},
+	{5, &po_211[0]},
+	{5, &po_212[0]},
+	{5, &po_213[0]},
+	{2, &po_214[0]},
+	{9, &po_215[0]},
+	{3, &po_216[0]},
+	{3, &po_217[0]},
+	{6, &po_218[0]},
+	{5, &po_219[0]},
+	{4, &po_220[0]},
+	{4, &po_221[0]},
+	{4, &po_222[0]},
+	{6, &po_223[0]},
+	{3, &po_224[0]},
+	{5, &po_225[0]},
+	{5, &po_226[0]},
+	{6, &po_227[0]},
+	{4, &po_228[0]},
+	{6, &po_229[0]},
+	{2, &po_230[0]},
+	{0, 0},
+	{2, &po_232[0]},
+	{0, 0},
+	{1, &po_234[0]},
+	{2, &po_235[0]},
+	{0, 0},
+	{5, &po_237[0]},
+	{5, &po_238[0]},
+	{0, 0},
+	{0, 0},
+	{1, &po_241[0]},
+	{2, &po_242[0]},
+	{2, &po_243[0]},
+	{2, &po_244[0]},
+	{2, &po_245[0]},
+	{2, &po_246[0]},
+	{0, 0},
+	{0, 0},
+	{3, &po_249[0]},
+	{5, &po_250[0]},
+	{3, &po_251[0]},
+	{5, &po_252[0]},
+	{3, &po_253[0]},
+	{5, &po_254[0]},
+	{2, &po_255[0]},
+	{4, &po_256[0]},
+	{3, &po_257[0]},
+	{5, &po_258[0]},
+	{2, &po_259[0]},
+	{4, &po_260[0]},
+	{2, &po_261[0]},
+	{4, &po_262[0]}
+};
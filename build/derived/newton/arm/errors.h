@@ -0,0 +1,1542 @@
+/*
+ * Copyright (C) Advanced RISC Machines Limited and
+ *               Codemist Limited, 19126.
+ * All rights reserved.
+ *
+ * build/derived/newton/arm/errors.h, created by genhdrs on Sun Oct 18 10:59:52 2026
+ */
+
+#ifndef _msgs_LOADED
+#define _msgs_LOADED 1
+
+typedef char *syserr_message_type;
+extern void syserr(syserr_message_type errcode, ...);
+
+/*
+ * C compiler error prototype file (miperrs.h)
+ * Copyright (C) Codemist Ltd, 1988.
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * RCS $Revision$ Codemist 151
+ * Checkin $Date$
+ * Revising $Author$
+ */
+
+/*
+ * This file is input to the genhdrs utility, which can compress error
+ * strings (but leaving escape sequences alone so that format checking can
+ * occur) and optionally mapping syserr messages onto numeric codes
+ * (in case somebody wants to save the about 4Kbytes of memory involved).
+ */
+
+/* AM: (after discussion with LDS) It would seem that error texts below */
+/* which (seriously) take 2 or more arguments should be of the form     */
+/*    #define ermsg(a,b,c) "ho hum %s had a %s %s", a, b, c             */
+/* etc. to allow different sentence order in other (natural) languages. */
+
+/* One nice thing would be to have a variant form of $r (etc) which did */
+/* not quote its arg to avoid many uses of symname_() in the code.      */
+
+                              /* Don't compress #include strings! */
+
+#include "msg.h"
+
+#if defined(__CC_NORCROFT) && !defined(NLS)
+  /*
+   * The next procedure takes a string as a format... check args.
+   */
+#pragma -v3
+#endif
+
+/* cc_msg has been left in globals.h since it takes an uncompressed string */
+extern void cc_rerr(msg_t errcode, ...);
+extern void cc_ansi_rerr(msg_t errcode, ...);
+extern void cc_warn(msg_t errcode, ...);
+extern void cc_ansi_warn(msg_t errcode, ...);
+extern void cc_pccwarn(msg_t errcode, ...);
+extern void cc_err(msg_t errcode, ...);
+extern void cc_fatalerr(msg_t errcode, ...);
+extern void cc_rerr_cwarn(msg_t errorcode, ...);
+extern void cc_rerr_cppwarn(msg_t errorcode, ...);
+
+#if defined(__CC_NORCROFT) && !defined(NLS)
+  /*
+   * End of procedures that take error strings or codes.
+   */
+#pragma -v0
+#endif
+
+extern void push_fnap_context(Binder* fn); /* NULL fn ok */
+extern void set_fnap_arg(int);
+extern void pop_fnap_context(void);
+extern void push_nested_context(msg_t, IPtr arg1, IPtr arg2);
+extern void pop_nested_context(void);
+
+#ifdef NLS
+#  include "tags.h"             /* Under NLS, use tag versions */
+#else
+
+      /* Map strings to offsets in compressed string table */
+
+#define warn_option_letter "unknown option -%c%c: ignored"
+#define warn_option_g "unknown debugging option -g%c: -g assumed"
+#define warn_option_zq "unknown option -zq%c: ignored"
+#define warn_preinclude "can't open pre-include file %s (ignored)"
+#define warn_template_repository "can't write template repository %s (ignored)"
+#define warn_option_E \
+        "Obsolete use of '%s' to suppress errors -- use '-zu' for PCC mode"
+#define warn_option_p "unknown profile option %s: -p assumed"
+#define warn_option   "unknown option %s: ignored"
+
+#define warn_usage_rw \
+        "undefined behaviour: $b written and read without intervening sequence point"
+#define warn_usage_ww \
+        "undefined behaviour: $b written twice without intervening sequence point"
+
+/* Preprocessor messages.  Here presumably because the preprocessor can be
+   shared between different language front-ends.  But then why is pp.[ch] in
+   cfe?  */
+
+#define pp_warn_triglyph \
+        "ANSI '%c%c%c' trigraph for '%c' found - was this intended?"
+#define pp_warn_nested_comment "character sequence %s inside comment"
+#define pp_warn_many_arglines \
+        "(possible error): >= %lu lines of macro arguments"
+#define pp_warn_redefinition "repeated definition of #define macro %s"
+#define pp_warn_ifvaldef "#ifdef %s may indicate trouble..." /* MACH_EXTNS */
+#define pp_warn_nonansi_header "Non-ANSI #include <%s>"
+#define pp_warn_bad_pragma "Unrecognised #pragma (no '-' or unknown word)"
+#define pp_warn_bad_pragma1 "Unrecognised #pragma -%c"
+#define pp_warn_unused_macro "#define macro '%s' defined but not used"
+#define pp_warn_unbalanced "Unbalanced #if/#ifdef/#ifndef/#endif in file"
+#define pp_warn_macro_arg_exp_in_string "argument %s of macro %s expanded in %c...%c"
+#define pp_warn_pragma_suppress "#pragma -b suppresses errors (hence non-ANSI)"
+#define pp_warn_not_guarded "Header file not guarded against multiple inclusion"
+#define pp_warn_guard_not_defined "File is guarded by '%s' but does not #define it"
+#define pp_warn_continued_comment "trailing '\\' continues comment"
+#define pp_warn_directive_in_args \
+    "preprocessor directive ignored in macro argument list\n"
+#define pp_warn_eol_string_skipped "Unmatched quote (%c) in skipped line"
+#define pp_rerr_redefinition "differing redefinition of #define macro %s"
+#define pp_rerr_nonunique_formal "duplicate macro formal parameter: '%s'"
+#define pp_rerr_define_hash_arg "operand of # not macro formal parameter"
+#define pp_rerr_define_hashhash "## first or last token in #define body"
+#define pp_rerr_newline_eof "missing newline before EOF - inserted"
+#define pp_rerr_nonprint_char "unprintable char %#.2x found - ignored"
+#define pp_rerr_illegal_option "illegal option -D%s%s"
+#define pp_rerr_spurious_else "spurious #else ignored"
+#define pp_rerr_spurious_elif "spurious #elif ignored"
+#define pp_rerr_spurious_endif "spurious #endif ignored"
+#define pp_rerr_hash_line "number missing in #line"
+#define pp_rerr_hash_error "#error encountered \"%s\""
+#define pp_rerr_hash_ident "#ident is not in ANSI C"
+#define pp_rerr_junk_eol "junk at end of #%s line - ignored"
+#define pp_err_eof_comment "EOF in comment"
+#define pp_err_eof_string "EOF in string"
+#define pp_err_eol_string "quote (%c) inserted before newline"
+#define pp_err_eof_escape "EOF in string escape"
+#define pp_err_missing_quote "Missing '%c' in pre-processor command line"
+#define pp_err_if_defined "No identifier after #if defined"
+#define pp_err_if_defined1 "No ')' after #if defined(..."
+#define pp_err_rpar_eof "Missing ')' after %s(... on line %ld"
+#define pp_err_many_args "Too many arguments to macro %s(... on line %ld"
+#define pp_err_few_args "Too few arguments to macro %s(... on line %ld"
+#define pp_err_missing_identifier "Missing identifier after #define"
+#define pp_err_missing_parameter "Missing parameter name in #define %s(..."
+#define pp_err_missing_comma "Missing ',' or ')' after #define %s(..."
+#define pp_err_undef "Missing identifier after #undef"
+#define pp_err_ifdef "Missing identifier after #ifdef"
+#define pp_err_include_quote "Missing '<' or '\"' after #include"
+#define pp_err_include_junk "Junk after #include %c%s%c"
+#define pp_err_include_file "#include file %c%s%c wouldn't open"
+#define pp_err_unknown_directive "Unknown directive: #%s"
+#define pp_err_endif_eof "Missing #endif at EOF"
+#define pp_fatalerr_hash_error "#error encountered \"%s\""
+#define pp_fatalerr_readfail "Host file system read error\n"
+
+#define bind_warn_extern_clash \
+        "extern clash $r, $r clash (ANSI 6 char monocase)"
+#define bind_warn_unused_static_decl "unused earlier static declaration of $r"
+#define bind_warn_not_in_hdr "extern $r not declared in header"
+#define bind_warn_main_not_int "extern 'main' needs to be 'int' function"
+#define bind_warn_label_not_used "label $r was defined but not used"
+/*
+ * Note that when part of an error string MUST be stored as a regular
+ * non-compressed string I have to inform the GenHdrs utility with %Z and %O
+ * This arises when a string contains literal strings as extra sub-args.
+ */
+
+/* No longer applies to bind_warn_*_not_used, though */
+
+#define bind_warn_typedef_not_used "typedef $b declared but not used"
+#define bind_warn_typename_not_used "typename $b declared but not used"
+#define bind_warn_function_not_used "function $b declared but not used"
+#define bind_warn_variable_not_used "variable $b declared but not used"
+
+#define bind_warn_static_not_used "static $b declared but not used"
+#define cg_warn_implicit_return "implicit return in non-void %s()"
+#define flowgraf_warn_implicit_return "implicit return in non-void function"
+#define regalloc_warn_use_before_set "$b may be used before being set"
+#define regalloc_warn_never_used "$b is set but never used"
+#define sem_warn_unsigned "ANSI surprise: 'long' $s 'unsigned' yields 'long'"
+#define sem_warn_format_type "actual type $t of argument %d mismatches format '%.*s'"
+#define sem_warn_bad_format "Illegal format conversion '%%%c'"
+#define sem_warn_incomplete_format "Incomplete format string"
+#define sem_warn_format_nargs_0 "Format requires 0 parameters, but %ld given"
+#define sem_warn_format_nargs_1 "Format requires 1 parameter, but %ld given"
+#define sem_warn_format_nargs_n "Format requires %ld parameters, but %ld given"
+#define sem_warn_addr_array "'&' unnecessary for function or array $e"
+#define sem_warn_bad_shift(_m,_n) "shift of $m by %ld undefined in ANSI C",_m,_n
+#define sem_warn_divrem_0 "division by zero: $s"
+#define sem_warn_fp_overflow(op) "floating point constant overflow: $s",op
+#define sem_warn_implicit_constructor "implicit constructor $t()"
+#define sem_warn_cast_sametype "explicit cast to same type"
+#define sem_warn_ctor_confused "user defined constructors confusing"
+#define sem_warn_structassign "structure assignment"
+
+#define sem_errwarn_udiad_overflow "unsigned constant overflow: $s"
+#define sem_errwarn_diad_overflow "signed constant overflow: $s"
+#define sem_errwarn_umonad_overflow "unsigned constant overflow: $s"
+#define sem_errwarn_monad_overflow "signed constant overflow: $s"
+#define sem_errwarn_bad_shift "overlarge shift distance"
+#define sem_errwarn_divrem_0 "division by zero: $s"
+#define sem_errwarn_ucomp_0 "odd unsigned comparison with 0: $s"
+#define sem_errwarn_ucomp_0_false "unsigned comparison with 0 is always false: $s"
+#define sem_errwarn_ucomp_0_true "unsigned comparison with 0 is always true: $s"
+#define sem_errwarn_fp_overflow "floating point constant overflow: $s"
+
+#define sem_rerr_udiad_overflow(op,_a,_b,_c) "unsigned constant overflow: $s",op
+#define sem_rerr_diad_overflow(op,_a,_b,_c) "signed constant overflow: $s",op
+#define sem_rerr_umonad_overflow(op,_a,_b) "unsigned constant overflow: $s",op
+#define sem_rerr_monad_overflow(op,_a,_b) "signed constant overflow: $s",op
+#define sem_rerr_implicit_cast_overflow(_t,_a,_b) \
+                                "implicit cast (to $t) overflow",_t
+#define sem_rerr_implicit_cast5 \
+        "$s: implicit cast of pointer loses $m qualifier"
+#define sem_warn_depr_string \
+        "$s: deprecated conversion of string literal to pointer to non-const"
+#define sem_rerr_too_many_args_ovld "too many arguments for overload resolution"
+#define sem_rerr_postdecr_bool "operand of $s cannot be 'bool'"
+#define sem_rerr_opequal_bool \
+        "type of left operand of $s cannot be 'bool'"
+
+#define sem_warn_deprecated_bool "deprecated use: operand of $s is 'bool'"
+#define sem_warn_unusual_bool "$s: cast to 'bool' (other than integer 0 or 1)"
+#define sem_warn_fix_fail "floating to integral conversion overflow"
+#define sem_warn_index_ovfl "out-of-bound offset %ld in address"
+#define sem_warn_low_precision "lower precision in wider context: $s"
+#define sem_warn_odd_condition "use of $s in condition context"
+#define sem_warn_void_context "no side effect in void context: $s"
+#define sem_warn_olde_mismatch "argument and old-style parameter mismatch: $e"
+#define sem_warn_uncheckable_format \
+        "'format' arg. to printf/scanf etc. is variable, so cannot be checked"
+#define sem_warn_narrow_voidstar "implicit cast from (void *), C++ forbids"
+#define sem_warn_narrowing "implicit narrowing cast: $s"
+#define sem_warn_fn_cast \
+        "$s: cast between function pointer and non-function object"
+#define sem_warn_pointer_int "explicit cast of pointer to 'int'"
+#define bind_warn_unused_this_in_member "'this' unused in non-static member function"
+#define bind_warn_cpp_scope_differ "C++ scope may differ: $c"
+#define bind_warn_new_tag_in_formals "$c invented in parameter list"
+
+#define bind_err_cant_use_outer_member "attempt to use $p$r"
+#define bind_err_extern_clash "extern clash $r, $r (linker %ld char)"
+#define bind_err_extern_clash_monocase "extern clash $r, $r (linker %ld char monocase)"
+#define bind_err_duplicate_tag "duplicate definition of $s tag $b"
+#define bind_err_reuse_tag "re-using $s tag $b as $s tag"
+#define bind_err_incomplete_tentative \
+        "incomplete tentative declaration of $r"
+#define bind_err_type_disagreement "type disagreement for $r"
+#define bind_err_duplicate_definition "duplicate definition of $r"
+#define bind_err_duplicate_label "duplicate definition of label $r - ignored"
+#define bind_err_unset_label "label $r has not been set"
+#define bind_err_undefined_static \
+        "static function $b not defined - treated as extern"
+#define bind_err_conflicting_globalreg \
+        "conflicting global register declarations for $b"
+#define xbind_err_template_specialize_after "attempt to specialize after use"
+#define xbind_err_template_undef "attempt to instantiate undefined template $b"
+#define xbind_err_template_none "no template found to specialize or instantiate"
+#define xbind_err_template_ambiguous "ambiguous templates to specialize or instantiate"
+#define bind_err_template_tpara_redeclared "re-declaration of template type paramenter $r"
+
+#define fp_err_very_big "Overlarge floating point value found"
+#define fp_err_big_single \
+        "Overlarge (single precision) floating point value found"
+#define sem_err_typeclash "Illegal types for operands: $s"
+#define sem_err_sizeof_struct "size of $c needed but not yet defined"
+#define sem_rerr_sizeof_opaque "size of opaque $c needed"
+#define sem_err_lvalue "Illegal in lvalue: function or array $e"
+#define sem_err_bitfield_address "bit fields do not have addresses"
+#define sem_err_lvalue1 "Illegal in l-value: 'enum' constant $b"
+#define sem_err_lvalue2 "Illegal in the context of an l-value: $s"
+#define sem_err_nonconst "illegal in %s: <unknown>"
+#define sem_err_nonconst1 "illegal in %s: non constant $b"
+#define sem_err_nonconst2 "illegal in %s: $s"
+
+#define bind_msg_const_nonconst "illegal in constant expression: <unknown>"
+#define bind_msg_const_nonconst1 \
+     "illegal in constant expression: non constant $b"
+#define bind_msg_const_nonconst2 "illegal in constant expression: $s"
+
+#define moan_floating_type_nonconst \
+     "illegal in floating type initialiser: <unknown>"
+#define moan_floating_type_nonconst1 \
+     "illegal in floating type initialiser: non constant $b"
+#define moan_floating_type_nonconst2 \
+     "illegal in floating type initialiser: $s"
+#define moan_static_int_type_nonconst \
+     "illegal in static integral type initialiser: <unknown>"
+#define moan_static_int_type_nonconst1 \
+     "illegal in static integral type initialiser: non constant $b"
+#define moan_static_int_type_nonconst2 \
+     "illegal in static integral type initialiser: $s"
+
+#define sem_err_nonfunction "attempt to apply a non-function"
+#define sem_err_void_argument "'void' values may not be arguments"
+#define sem_err_bad_cast "$s: illegal cast of $t to pointer"
+#define sem_err_bad_cast1 "$s: illegal cast to $t"
+#define sem_err_bad_cast2 "$s: cast to non-equal $t illegal"
+#define sem_err_undef_struct \
+        "$c not yet defined - cannot be selected from"
+#define sem_err_unknown_field "$c has no $r field"
+#define sem_err_no_this_pntr "no 'this' pointer to access member"
+#define sem_err_no_this_pntr2 "no 'this' pointer for member function $e"
+#define sem_err_dupl_default_value \
+        "duplicate declaration of default value for argument #%d: $r"
+#define sem_err_missing_default_value "missing default value for argment #%d: $r"
+#define sem_err_noncallsite_function "non-call site '.*' or '->*' yielding function"
+#define sem_err_illegal_loperand "illegal left operand to $s"
+#define sem_err_addr_globalvar "$b is a global register variable - can't take its address"
+#define sem_err_ctor_confused "construction of value of type $t is recursively confused"
+#define sem_err_no_ctor_at_type "no constructor for $c at this type signature"
+
+#define sem_err_template_nontype_storage "template non-type $b has no storage"
+#define syn_err_template_member "template member expected"
+#define syn_rerr_temp_para_redefinition "template parameter $b re-defined"
+
+#define simplify_err_outsizearray "array $b too large"
+#define simplify_err_illegal_use_of_mem_fn "illegal use of member function - '&$#b' intended?"
+
+/* This has been removed - MJW
+ * #define errs_membobj(_m)\
+ * %Z  (_m ? "member":"object")
+ * %O
+ */
+
+#define bind_rerr_undefined_tag "$s tag $b not defined"
+#define bind_rerr_mem_opaque "can't access data member $b of opaque type"
+#define bind_rerr_linkage_disagreement \
+        "linkage disagreement for $r - treated as $g"
+#define bind_rerr_linkage_disagreement_2 \
+        "$b has no linkage, but $b requires it to have"
+#define bind_rerr_linkage_disagreement_3 \
+        "linkage disagreement between $b and $b"
+#define bind_rerr_linkage_previously_c \
+        "$b was previously declared without \"C\" linkage"
+#define bind_rerr_duplicate_typedef "duplicate typedef $r"
+#define bind_rerr_local_extern "extern $r mismatches top-level declaration"
+#define xbind_warn_implicit_virtual "$p$r inherits implicit virtual"
+#define xbind_rerr_inherited_type_differs "inherited virtual function type differs: $b"
+#define xbind_rerr_ovld_non_fn "attempt to overload non-function $b"
+#define xbind_rerr_is_ambiguous_name "$r is an ambiguous name in $c"
+#define xbind_rerr_dl_cant_be_overloaded "'operator delete' can't be overloaded"
+#define xbind_rerr_bad_dl_type \
+    "'operator delete' must be of type 'void (void*)' or 'void (void*, size_t)'"
+#define xbind_rerr_bad_global_dl_type \
+    "'::operator delete' must be of type 'void (void*)'"
+#define xbind_rerr_bad_nw_type \
+    "'operator new' must have a return type of 'void*' and have a first argument of type 'size_t'"
+#define xbind_rerr_more_than_one_C_linkage "more than one $r has \"C\" linkage"
+#define xbind_rerr_both_virtual_and_nonvirtual \
+    "$r inherits both virtual and non-virtual attributes from bases of $c"
+
+#define cg_rerr_iffy_arithmetics "iffy arithmetic shift"
+#define fp_rerr_very_small "small floating point value converted to 0.0"
+#define fp_rerr_small_single \
+        "small (single precision) floating value converted to 0.0"
+#define sem_rerr_sizeof_bitfield \
+        "sizeof <bit field> illegal - sizeof(int) assumed"
+#define sem_rerr_sizeof_void "size of 'void' required - treated as 1"
+#define sem_rerr_sizeof_array "size of a [] array required, treated as [1]"
+#define sem_rerr_sizeof_function \
+        "size of function required - treated as size of pointer"
+#define sem_rerr_pointer_arith \
+        "<int> $s <pointer> treated as <int> $s (int)<pointer>"
+#define sem_rerr_pointer_arith1 \
+        "<pointer> $s <int> treated as (int)<pointer> $s <int>"
+#define sem_rerr_assign_const "assignment to 'const' object $e"
+#define sem_rerr_addr_regvar \
+        "'register' attribute for $b ignored when address taken"
+#define sem_rerr_lcast "objects that have been cast are not l-values"
+#define sem_rerr_pointer_compare \
+"comparison $s of pointer and int:\n\
+  literal 0 (for == and !=) is only legal case"
+#define sem_rerr_different_pointers "differing pointer types: $s"
+#define sem_rerr_wrong_no_args "wrong number of parameters to $e"
+#define sem_rerr_casttoenum "$s: cast of $m to differing enum" /* warn in C */
+#define sem_rerr_valcasttoref "$s: non-lvalue cast to non-const reference"
+#define sem_rerr_implicit_cast1 \
+        "$s: implicit cast of pointer to non-equal pointer"
+#define sem_rerr_implicit_cast2 "$s: implicit cast of non-0 int to pointer"
+#define sem_rerr_implicit_cast3 "$s: implicit cast of pointer to 'int'"
+#define sem_rerr_implicit_cast4 "$s: implicit cast of $t to 'int'"
+#define sem_rerr_nonpublic "$p$r is a non-public member"
+#define sem_rerr_cant_balance "differing pointer types: $s"
+#define sem_rerr_void_indirection "illegal indirection on (void *): '*'"
+#define sem_rerr_noncallsite_ovld "non-call site overload (using $b for $e)"
+#define sem_rerr_cast_dtype_from_vbase "cast to derived type from virtual base"
+#define sem_rerr_abclass_need_vtable "confusion: abstract? $c needs vtable"
+#define sem_rerr_too_many_args "too many arguments: $t constructor"
+
+#define obj_fatalerr_io_object "I/O error on object stream"
+#define compiler_rerr_no_extern_decl\
+    "no external declaration in translation unit"
+#define compiler_fatalerr_io_error "I/O error writing '%s'"
+#define compiler_fatalerr_load_version \
+    "load file created with a different version of the compiler"
+#define driver_fatalerr_io_object "I/O error on object stream"
+#define driver_fatalerr_io_asm "I/O error on assembler output stream"
+#define driver_fatalerr_io_listing "I/O error on listing stream"
+
+#ifdef TARGET_HAS_AOUT
+#define aout_fatalerr_toomany "Too many symbols for 'a.out' output"
+#define aout_fatalerr_toobig "Module too big for a.out formatter"
+#endif
+#ifdef TARGET_HAS_COFF
+#define coff_fatalerr_toomany "Too many relocations for COFF format in .o file"
+#define coff_fatalerr_toobig "Module too big for COFF formatter"
+#endif
+#define misc_fatalerr_space1 "out of store (for error buffer)"
+#define misc_fatalerr_toomanyerrs "Too many errors"
+#define misc_fatalerr_space2 "out of store (in cc_alloc)\n\
+(Compilation of the debugging tables requested with the -g option\n\
+ requires a great deal of memory. Recompiling without -g, with\n\
+ the more restricted -gf option, or with the program broken into\n\
+ smaller pieces, may help.)"
+#define misc_fatalerr_space3 "out of store (in cc_alloc)"
+
+/* Beware: none of the following driver_message #defined are used!      */
+#define driver_message_nolisting \
+        "Unable to open %s for listing: -l option ignored\n"
+#ifdef NO_ASSEMBLER_OUTPUT
+#define driver_message_noasm \
+        "This version of the compiler does not support -s\n"
+#endif
+#define driver_message_writefail "Couldn't write file '%s'\n"
+#define driver_message_oddoption "Unrecognized option '%c': ignored\n"
+#define driver_message_readfail "Couldn't read file '%s'\n"
+/* NB the next error can not arise with the current ARM driver */
+#define driver_message_toomanyfiles "Too many file args"
+#define driver_message_asmstdout "Assembly code will go to stdout\n"
+#define driver_message_no_listing \
+        "-m option useless without source listing. Ignored\n"
+#define driver_message_nomap "-m file not available or corrupt - ignored\n"
+#define driver_message_notest \
+        "This version of the compiler does not support the -test option\n"
+#define driver_message_needfile "At least one file argument wanted\n"
+#ifndef COMPILING_ON_ARM_OS
+#define driver_message_spool "output to clog1.log & clog2.log\n"
+#endif
+#define driver_message_testfile "No files allowed with -test\n"
+
+
+#define driver_abort_msg "Compilation aborted: %s\n"
+#define driver_couldnt_write "couldn't write file '%s'\n"
+#define driver_couldnt_read "couldn't read file '%s'\n"
+#define driver_too_many_file_args "too many file arguments"
+#define driver_couldnt_read_counts "couldn't read \"counts\" file"
+#define driver_malformed_counts "malformed \"counts\" file"
+#define driver_toolenv_writefail "Couldn't write installation configuration\n"
+
+#define driver_incompat_cfrontcpp_ansi "-ansi incompatible with -cfront or -cpp"
+#define driver_incompat_cfrontcpp_pcc "-pcc incompatible with -cfront or -cpp"
+#define driver_incompat_pccansi_cfront "-cfront incompatible with -pcc or -ansi"
+#define driver_incompat_pccansi_cpp "-cpp incompatible with -pcc or -ansi"
+#define driver_ignored_arthur_unix "Warning: -arthur/-super ignored under unix\n"
+#ifdef WANT_WHINGY_MSGS_EVEN_WHEN_WRONG
+#define driver_ignored_linkerflags \
+    "Warning: linker flag(s) ignored with -c -E -M or -S\n"
+#endif
+#define driver_conflict_EM "Warning: options -E and -M conflict: -E assumed\n"
+#ifdef FORTRAN
+#define driver_conflict_strict_onetrip \
+    "Warning: -onetrip and -strict conflict: -strict assumed\n"
+#define driver_conflict_strict_f66 \
+    "Warning: -f66 and -strict conflict: -strict assumed\n"
+#define driver_conflict_strict_extend \
+    "Warning: -extend and -strict conflict: -strict assumed\n"
+#define driver_implies_f66_onetrip "Warning: -f66 implies -onetrip\n"
+#endif
+
+#define driver_ignored_filename_overlong "Overlong filename ignored: %s\n"
+#define driver_unknown_filetype "Error: type of '%s' unknown (file ignored)\n"
+#define driver_option_bad "Error: bad option '%s': ignored\n"
+#ifdef FORTRAN
+#define driver_option_nimp "Error: unimplemented option '%s': ignored\n"
+#endif
+#define driver_via_not_opened "Can't open -via file %s\n"
+/* Printed as "Error: bad option '<opt> <opt> <opt> ...': ignored\n" */
+#define driver_option_bad1 "Error: bad option "
+#define driver_option_bad2 ": ignored\n"
+#define driver_option_missing_filearg "Missing file argument for %s\n"
+#define driver_option_missing_lastarg "No argument to last compiler option"
+#define driver_option_missing_arg "No argument to compiler option %s\n"
+#define driver_cant_open_output "Can't open %s for output\n"
+
+#define driver_cpp_toomanyfileargs "More than 2 file arguments to cpp ignored\n"
+#define driver_cpp_cantopenoutput "Can't open output file %s\n"
+#define driver_stdin_otherfiles "stdin ('-') combined with other files -- ignored\n"
+
+#define driver_noeffect "Warning: %s command with no effect\n"
+
+/* Needs fixing for NLS */
+#define driver_banner "%s\n", CC_BANNER
+#define driver_prerelease "%s\n", DRIVER_PRE_RELEASE_MSG
+
+
+/* messages that form part of the varied help texts produced by cc -help */
+
+#define driver_expire "\
+This time-limited software remains the property of %s.\n\
+It will expire at (GMT) %s\n"
+
+#define help_blank "\n"
+#define help_bsd_f77 "\n\nBSD compatible ANSI F77 compiler.\n"
+#define help_usage "\n\
+Usage:         %s [options] file1 file2 ... filen\n"
+#define help_main_options "Main options:\n"
+#define help_list                "\
+-list          Generate a compilation listing\n"
+#define help_iso                 "\
+-iso           Compile strictly according to ISO (BS 6192 : 1982)\n"
+#define help_ansi                "\
+-ansi          Compile ANSI-style C source code\n"
+#define help_strict              "\
+-strict        Accept only programs strictly conforming to ANSI standard\n"
+#define help_pcc                 "\
+-pcc           Compile UNIX PCC style C source code\n"
+#define help_pcc_bsd             "\
+-pcc           Compile BSD UNIX PCC-style C source code\n"
+#define help_f66                 "\
+-f66           Follow F66 practices or rules when conflicting with F77\n"
+#define help_arthur              "\
+-arthur        Add 'arthur' to the list of libraries to be linked with\n\
+                 (Arthur only)\n"
+#define help_brazil              "\
+-super         Add 'supervisor' to the list of libraries to be linked with\n\
+                 (Brazil only)\n"
+#define help_dont_link           "\
+-c             Do not link the files being compiled\n"
+#define help_dont_link_invoke    "\
+-c             Do not invoke the linker to link the files being compiled\n"
+#define help_leave_comments      "\
+-C             Prevent the preprocessor from removing comments (Use with -E)\n"
+#define help_predefine           "\
+-D<symbol>     Define <symbol> on entry to the compiler\n"
+#define help_predefine_pp        "\
+-D<symbol>     Define preprocessor <symbol> on entry to the compiler\n"
+#define help_preprocess_pascal   "\
+-E             Preprocess the Pascal source code only\n"
+#define help_preprocess_c        "\
+-E             Preprocess the C source code only\n"
+#define help_preprocess_fortran  "\
+-E             Preprocess the F77 source code only\n"
+#define help_compiler_features   "\
+-F<options>    Enable a selection of compiler defined features\n"
+#define help_runtime_checks      "\
+-R<options>    Disable selected run time error checks\n"
+#define help_debug               "\
+-g<options>    Generate code that may be used with the debugger\n"
+#define help_debug_noopt         "\
+-g             Generate code that may be used with the debugger\n"
+#define help_include_I           "\
+-I<directory>  Include <directory> on the #include search path\n"
+#define help_16bit_ints          "\
+-i2            Make the default integer size 16 bits\n"
+#define help_include_J           "\
+-J<directory>  Replace the default #include path with <directory>\n"
+#define help_libraries           "\
+-L<libs>       Specify a comma-joined list of libraries to be linked with\n\
+               instead of the standard library\n"
+#define help_makefile            "\
+-M<options>    Generate a 'makefile' style list of dependencies\n"
+#define help_output              "\
+-o<file>       Instruct the linker to call the object code produced <file>\n"
+#define help_output_space        "\
+-o <file>      Instruct the linker to name the object code produced <file>\n"
+#define help_optimised           "\
+-O             Invoke the object code improver\n"
+#define help_onetrip             "\
+-onetrip       Compile DO loops that are performed at least once if reached\n"
+#define help_profile             "\
+-P<options>    Generate code to generate 'profile' information\n"
+#define help_profile_lc          "\
+-p<options>    Generate code to generate 'profile' information\n"
+#define help_readonly_strings    "\
+-R             Place all compile time strings in a 'Read only' segment\n"
+#define help_readonly_strings_lc "\
+-r             Place all compile time strings in a 'Read only' segment\n"
+#define help_output_assembler    "\
+-S             Output assembly code instead of object code\n"
+#define help_generate_assembler  "\
+-S             Generate assembly code instead of object code\n"
+#define help_dont_downcase       "\
+-U             Do not convert upper case letters to lower case\n"
+#define help_preundefine         "\
+-U<symbol>     Undefine <symbol> on entry to the compiler\n"
+#define help_preundefine_pp      "\
+-U<symbol>     Undefine preprocessor <symbol> on entry to the compiler\n"
+#define help_disable_warnings    "\
+-W<options>    Disable all or selected warning and error messages\n"
+#define help_disable_warnings_lc "\
+-w<options>    Disable all or selected warning and error messages\n"
+#define help_helios_libraries    "\
+-Z<option>     Special Helios options for shared library building etc\n"
+
+
+/* messages generated by misc.c */
+#ifndef TARGET_IS_UNIX
+#  ifndef COMPILING_ON_MPW
+#define misc_message_lineno(_f,_l,_s) "\"%s\", line %ld: %s",_f,_l,_s
+#  else
+#define misc_message_lineno_mpw(_f,_l,_s) \
+        "File \"%s\"; Line %ld # %s",_f,_l,_s
+#  endif
+#else
+#define misc_message_lineno_unix(_f,_l,_s) "%s: %ld: %s",_f,_l,_s
+#endif
+
+#ifndef TARGET_IS_UNIX
+#  ifndef COMPILING_ON_MPW
+#define misc_message_nolineno(_f,_s) "\"%s\": %s",_f,_s
+#  else
+#define misc_message_nolineno_mpw(_f,_s) \
+        "File \"%s\" # %s",_f,_s
+#  endif
+#else
+#define misc_message_nolineno_unix(_f,_s) "%s: %s",_f,_s
+#endif
+
+#define misc_message_nofile(_s) "%s",_s
+
+#ifndef COMPILING_ON_MPW
+#define misc_message_sum1_zero "%s: 0 warnings"
+#define misc_message_sum1_sing "%s: 1 warning"
+#define misc_message_sum1(_f,nx) "%s: %ld warnings", _f, nx
+#else
+#define misc_message_sum1_zero_mpw "### \"%s\": 0 warnings"
+#define misc_message_sum1_sing_mpw "### \"%s\": 1 warning"
+#define misc_message_sum1_mpw(_f,nx) "### \"%s\": %ld warnings", _f, nx
+#endif
+
+#define misc_message_sum2 " (+ %ld suppressed)"
+#define misc_message_sum3_zero ", 0 errors"
+#define misc_message_sum3_sing ", 1 error"
+#define misc_message_sum3 ", %ld errors"
+#define misc_message_sum5_zero ", 0 serious errors\n"
+#define misc_message_sum5_sing ", 1 serious error\n"
+#define misc_message_sum5 ", %ld serious errors\n"
+
+#define misc_message_internal "Failure of internal consistency check"
+
+#define misc_msg_fnarg_this_fnap "<implicit 'this' argument to function call>"
+#define misc_msg_fnarg_this_fnname "<implicit 'this' argument to $b>"
+#define misc_msg_fnarg_fnap "<argument %d to function call>"
+#define misc_msg_fnarg_fnname "<argument %d to $b>"
+
+/* Cannot be issued if NARGREGS==0 */
+#define warn_untrustable "untrustable code generated for $r"
+
+#endif                          /* ndef NLS */
+/* Under NLS the following are still not tags */
+
+ /* The next batch of things just get mapped onto syserr codes */
+
+#define syserr_removepostincs "unexpected op in RemovePostIncs"
+#define syserr_mkqualifiedtype "mkqualifiedtype(..., %ld)"
+#define syserr_unbitfield "unbitfield_type $t"
+#define syserr_bf_promote "bf_promoted_type $t"
+#define syserr_typeof "typeof(%ld)"
+#define syserr_alignoftype "alignoftype(%ld,%#lx)"
+#define syserr_sizeoftype "sizeoftype(%ld,%#lx)"
+#define syserr_codeoftype "codeoftype"
+#define syserr_equivtype "equivtype(%ld)"
+#define syserr_compositetype "compositetype(%ld)"
+#define syserr_trydiadicreduce "trydiadreduce(unsigned op %ld)"
+#define syserr_trydiadicreduce1 "trydiadreduce(signed op %ld)"
+#define syserr_trydiadicreduce2 "trydiadreduce(float op %ld)"
+#define syserr_fp_op "FP op %ld unknown"
+#define syserr_trymonadicreduce "trymonadreduce(int op %ld)"
+#define syserr_trymonadicreduce1 "trymonadreduce(float op %ld)"
+#define syserr_bf_container "bf_container"
+#define syserr_coerceunary1 "coerceunary(%ld,%#lx)"
+#define syserr_bitfieldassign "bitfieldassign"
+#define syserr_mkindex "sem(mkindex)"
+#define syserr_ptrdiff "sem(mkbinary/ptrdiff)"
+#define syserr_va_arg_fn "sem(odd va_arg fn)"
+#define syserr_mkcast "mkcast(%ld,%#lx)"
+#define syserr_mkcast1 "mkcast(%ld)"
+#define syserr_te_plain "te_plain(%ld)"
+#define syserr_clone_node "clone_node(%ld)"
+#define syserr_optimise "optimise &(%ld)"
+#define syserr_optimise1 "optimise(%ld)"
+#define syserr_mcrepofexpr "mcrepofexpr(%ld,%#lx)"
+#define syserr_mcreparray "mcrep(array %ld)"
+#define syserr_newdbuf "pp_newdbuf(%ld,%ld)"
+#define syserr_pp_recursion "pp recursive sleep: '%s'"
+#define syserr_pp_special "pp_special(%ld)"
+#define syserr_overlarge_store1 "Overlarge storage request (binder %ld)"
+#define syserr_overlarge_store2 "Overlarge storage request (local %ld)"
+#define syserr_discard2 "discard2 %p"
+#define syserr_discard3 "discard3 %p"
+#define syserr_alloc_unmark "alloc_unmark - called too often"
+#define syserr_alloc_unmark1 "alloc_unmark(no drop_local_store())"
+#define syserr_alloc_reinit "alloc_reinit(no drop_local_store())"
+#define syserr_addclash "add_clash (0x%lx, 0x%lx)"
+#define syserr_forget_slave "forget_slave(%ld, %ld) %ld"
+#define syserr_GAP "GAP in reference_register"
+#define syserr_corrupt_register "corrupt_register %ld %p"
+#define syserr_regalloc "regalloc(corrupt/alloc)"
+#define syserr_regalloc_typefnaux "regalloc(typefnaux)"
+#define syserr_regalloc_POP "regalloc(POP)"
+#define syserr_call2 "CALL2 %ld"
+#define syserr_regno "reg %lx"
+#define syserr_vregsort "vregsort(%lx)"
+#define syserr_liveness "liveness odd"
+#define syserr_dataflow "dataflow &-var"
+#define syserr_choose_real_reg "choose_real_reg %lx"
+#define syserr_fail_to_spill "Failed to spill register for %ld"
+#define syserr_regalloc_reinit2 "regalloc_reinit2"
+#define syserr_regheap "Register heap overflow"
+#define syserr_bad_fmt_dir "bad fmt directive"
+#define syserr_syserr "syserr simulated"
+#define syserr_r1r "r1r %ld"
+#define syserr_r2r "r2r %ld"
+#define syserr_r3r "r3r %ld"
+#define syserr_r4r "r4r %ld"
+#define syserr_expand_jop "expand_jop(2address)"
+#define syserr_nonauto_active "Non auto 'active_binders' element"
+#define syserr_size_of_binder "size_of_binder"
+#define syserr_insertblockbetween "insertblockbetween(%ld, %ld)"
+#define syserr_reopen_block "reopen_block called"
+#define syserr_scaled_address "emit5(scaled address)"
+#define syserr_expand_pushr "expand_jop_macro(PUSHR)"
+#define syserr_remove_noop_failed "remove_noop failed"
+#define syserr_remove_noop_failed2 "remove_noop failed2"
+#define syserr_bad_bindaddr "Bad bindaddr_() with LDRVx1"
+#define syserr_ldrfk "duff LD/STRF/DK 0x%lx"
+#define syserr_ldrk "duff LD/STRK 0x%lx"
+#define syserr_ldrbk "duff LD/STRBK 0x%lx"
+#define syserr_ldrwk "duff LD/STRWK 0x%lx"
+#define syserr_branch_backptr "Bad back-pointer code in branch_chain"
+#define syserr_no_main_exit "use_cond_field(no main exit)"
+#define syserr_two_returns "Two return exits from a block"
+#define syserr_unrefblock "unrefblock"
+#define syserr_zip_blocks "zip_blocks(SETSP confused %ld!=%ld)"
+#define syserr_live_empty_block "ALIVE empty block L%ld"
+#define syserr_loctype "loctype"
+#define syserr_adconbase "cse_adconbase"
+#define syserr_find_exprn "CSE: find_exprn %ld"
+#define syserr_removecomparison "CSE: removecomparison %lx"
+#define syserr_evalconst "CSE: evalconst %lx"
+#define syserr_scanblock "cse_scanblock %08lx"
+#define syserr_prune "csescan(prune)"
+#define syserr_globalize "globalize_declaree1(%p,%ld)"
+#define syserr_globalize1 "globalize_typeexpr(%p,%ld)"
+#define syserr_copy_typeexpr "copy_typeexpr(%p,%ld)"
+#define syserr_tentative "is_tentative(tmpdataq == NULL)"
+#define syserr_tentative1 "is_tentative(ADCON)"
+#define syserr_tentative2 "tentative definition confusion"
+#define syserr_instate_decl "instate_decl %ld"
+#define syserr_totarget "totargetsex(%d)"
+#define syserr_vg_wpos "vg_wpos(%ld)"
+#define syserr_vg_wflush "vg_wflush(type=0x%x)"
+#define syserr_gendcI "gendcI(%ld,%ld)"
+#define syserr_vg_wtype "vg_wtype=0x%x"
+#define syserr_codevec "code vector overflow"
+#define syserr_nonstring_lit "non-string literal: %.8lx"
+#define syserr_addr_lit "Address-literals should not arise in HELIOS mode"
+#define syserr_dumplits "dumplits(codep&3)"
+#define syserr_dumplits1 "codebuf(dumplits1)"
+#define syserr_dumplits2 "codebuf(dumplits2)"
+#define syserr_outlitword "outlitword confused"
+#define syserr_dumplits3 "codebuf(dumplits3)"
+#define syserr_addlocalcse "addlocalcse %ld"
+#define syserr_cse_lost_def "cse: def missing"
+#define syserr_cse_lost_use "cse: use missing"
+#define syserr_cse_safetolift "cse: safetolift"
+#define syserr_storecse "storecse %ld %ld\n"
+#define syserr_baseop "cse: baseop %lx"
+#define syserr_cse_wordn "CSE_WORDn"
+#define syserr_addcsedefs "addcsedefs"
+#define syserr_cse_preheader "cse: loop preheader %d != %ld"
+#define syserr_cse_modifycode "cse: modifycode %ld %ld!=%ld"
+#define syserr_cse_modifycode_2 "cse: compare ref L%ld not reachable from def L%ld"
+#define syserr_cse_makesubdef "cse: MakeSubDef"
+#define syserr_referencecsedefs "ReferenceCSEDefs"
+#define cse_rewritenext "cse: RewriteNext %ld: %ld"
+#define syserr_regtype "ensure_regtype(%lx)"
+#define syserr_struct_val "Value of structure requested improperly"
+#define syserr_missing_expr "missing expr"
+#define syserr_checknot "s_checknot"
+#define syserr_structassign_val "value of structure assignment needed"
+#define syserr_floating "Float %%"
+#define syserr_cg_expr  "cg_expr(%ld = $s)"
+#define syserr_bad_reg "bad reg %lx in use"
+#define syserr_bad_fp_reg "fp reg in use"
+#define syserr_cg_fnarg "cg_fnarg(odd rep %lx)"
+#define syserr_fnarg_struct "cg(struct arg confused)"
+#define syserr_fnret_struct "struct returning s_fnap"
+#define syserr_cg_fnarg1 "cg_fnargs confused"
+#define syserr_cg_argcount "arg count confused"
+#define syserr_cg_fnarg2 "cg_fnargs tidy"
+#define syserr_padbinder "odd padbinder $b in cg_fnargs()"
+#define syserr_null_nb "nb==NULL in cg.c (A)"
+#define syserr_cg_fnap "cg_fnap"
+#define syserr_cg_fnap_1 "cg_fnap_1(typefnaux-mismatch)"
+#define syserr_cg_return_struct "cg_return(struct)"
+#define syserr_cg_cmd "cg_cmd(%ld = $s)"
+#define syserr_cg_endcase "cg_cmd(endcase)"
+#define syserr_cg_break "cg_cmd(break)"
+#define syserr_cg_cont "cg_cmd(cont)"
+#define syserr_cg_switch "switch expression must have integer type"
+#define syserr_cg_caselist "cg_caselist"
+#define syserr_cg_case "cg_cmd(case)"
+#define syserr_unset_case "Unset case_lab"
+#define syserr_cg_default "cg_cmd(default)"
+#define syserr_cg_badrep "rep bad in comparison %.8lx"
+#define syserr_cg_plain "(plain) qualifies non-<narrow-int-binder>"
+#define syserr_cg_cast "Illegal cast involving a structure or union"
+#define syserr_cg_fpsize "fp sizes are wrong %ld %ld"
+#define syserr_cg_cast1 "bad mode %ld in cast expression"
+#define syserr_cg_cast2 "cast %ld %ld %ld %ld"
+#define syserr_cg_indexword "Indexed address mode with word-store"
+#define syserr_cg_bad_width "bad width %ld in cg_stind"
+#define syserr_cg_bad_mode "bad mcmode %ld in cg_stind"
+#define syserr_chroma "chroma_check(target.h setup wrong or multi-temp op confused)"
+#define syserr_Q_swap "Q_swap(%lx)"
+#define syserr_cg_stgclass "Funny storage class %#lx"
+#define syserr_cg_storein "cg_storein(%ld)"
+#define syserr_cg_addr "p nasty in '&(p=q)'"
+#define syserr_cg_addr1 "cg_addr(%ld)"
+#define syserr_cg_shift0 "n=0 in shift_op1"
+#define syserr_not_shift "not a shift in shift_operand()"
+#define syserr_not_shift1 "not a shift in shift_amount()"
+#define syserr_integer_expected "integer expression expected"
+#define syserr_nonauto_arg "Non-auto arg!"
+#define syserr_struct_result "Unexpected struct result"
+#define syserr_cg_topdecl "cg_topdecl(not fn type)"
+#define syserr_cg_unknown "unknown top level %ld"
+#define syserr_cg_narrowformal "unwidened formal"
+#define syserr_emitfloat1 "Bad FP op with emitfloat1"
+#define syserr_regalloc_clash "Register allocation clash (R%d)"
+
+#ifdef TARGET_HAS_AOUT
+#define syserr_aout_reloc "relocate_code_to_data(PCreloc)"
+#define syserr_aout_checksym "obj_checksym(%s)"
+#define syserr_aout_reloc1 "obj_coderelocation %.8lx"
+#define syserr_aout_gendata "obj_gendata(%ld)"
+#define syserr_aout_datalen "obj_data len=%ld"
+#define syserr_aout_data "obj_data %ldEL%ld'%s'"
+#define syserr_aout_debug "writedebug: aoutobj linked with xxxdbg not dbx"
+#  ifdef TARGET_HAS_DEBUGGER  /* dbx support */
+#define syserr_too_many_types "too many types in dbx"
+#define syserr_addcodep "bad pointer in dbg_addcodep"
+#define syserr_tagbindsort "bad tagbindsort 0x%08lx"
+#define syserr_sprinttype "sprinttype(%p,0x%lx)"
+#define syserr_dbx_locvar "debugger table confusion(local variable $r %lx %lx)"
+#define syserr_dbx_scope "dbg_scope"
+#define syserr_dbx_proc "dbg_proc"
+#define syserr_dbx_proc1 "dbg_proc confused"
+#define syserr_dbx_write "dbg_write(%lx)"
+#  endif
+#endif
+
+#ifdef TARGET_HAS_COFF
+#define syserr_coff_reloc "relocate_code_to_data(PCreloc)"
+#define syserr_coff_pcrel "coff(unexpected X_PCreloc)"
+#define syserr_coff_m88000 "coffobj(X_DataAddr needs extending)"
+#define syserr_coff_toobig "coffobj(Module over 64K -- fix)"
+#define syserr_coff_checksym "obj_checksym($r)"
+#define syserr_coff_reloc1 "obj_coderelocation(%.8lx)"
+#define syserr_coff_gendata "obj_gendata(%ld)"
+#define syserr_coff_datalen "obj_data len=%ld"
+#define syserr_coff_data "obj_data %ldEL%ld'%s'"
+#  ifdef TARGET_HAS_DEBUGGER  /* dbx support */
+#define syserr_too_many_types "too many types in dbx"
+#define syserr_addcodep "bad pointer in dbg_addcodep"
+#define syserr_tagbindsort "bad tagbindsort 0x%08lx"
+#define syserr_sprinttype "sprinttype(%p,0x%lx)"
+#define syserr_dbx_locvar "debugger table confusion(local variable $r %lx %lx)"
+#define syserr_dbx_scope "dbg_scope"
+#define syserr_dbx_proc "dbg_proc"
+#define syserr_dbx_proc1 "dbg_proc confused"
+#define syserr_dbx_write "dbg_write(%lx)"
+#  endif
+#endif
+
+#ifndef NLS                     /* These become tags */
+
+      /* The following remain as ordinary (uncompressed) strings */
+
+/*
+ * @@@ Wording here is subject to change...
+ */
+#define misc_message_warning   "Warning: "
+#define misc_message_error     "Error: "
+#define misc_message_serious   "Serious error: "
+#define misc_message_fatal     "Fatal error: "
+#define misc_message_abandoned "\nCompilation abandoned.\n"
+
+/*
+ * The following are used in init_sym_name_table() and/or ctxtofdeclflag()
+ * and eventually find their ways into various error messages.
+ */
+
+/* _aftercommand has been added where needed in feerrs.h
+ * #define errname_aftercommand    " after command"
+ */
+#define errname_unset              "<?>"
+#define errname_pointertypes       "<after * in declarator>"
+#define errname_toplevel           "<top level>"
+#define errname_structelement      "<structure component>"
+#define errname_formalarg          "<formal parameter>"
+#define errname_formaltype         "<formal parameter type declaration>"
+#define errname_blockhead          "<head of block>"
+#define errname_typename           "<type-name>"
+#define errname_unknown            "<unknown context>"
+#define errname_error              "<previous error>"
+#define errname_invisible          "<invisible>"
+#define errname_let                "<let>"
+#define errname_character          "<character constant>"
+#define errname_wcharacter         "<wide character constant>"
+#define errname_integer            "<integer constant>"
+#define errname_int64con           "<int64 constant>"
+#define errname_boolean            "<boolean constant>"
+#define errname_floatcon           "<floating constant>"
+#define errname_string             "<string constant>"
+#define errname_wstring            "<wide string constant>"
+#define errname_identifier         "<identifier>"
+#define errname_binder             "<variable>"
+#define errname_tagbind            "<struct/union tag>"
+#define errname_simpletype         "<simple type>"
+#define errname_conversiontype     "<conversion type>"
+#define errname_new_type_name      "<new-type-name>"
+#define errname_catch_name         "<catch name>"
+#define errname_cond               "_?_:_"
+#define errname_displace           "++ or --"
+#define errname_postinc            "++"
+#define errname_postdec            "--"
+#define errname_arrow              "->"
+#define errname_dotstar            ".*"
+#define errname_arrowstar          "->*"
+#define errname_constructor        "<constructor>"
+#define errname_destructor         "<destructor>"
+#define errname_addrof             "unary &"
+#define errname_content            "unary *"
+#define errname_monplus            "unary +"
+#define errname_neg                "unary -"
+#define errname_fnap               "<function argument>"
+#define errname_fnarg              "<function argument %d>"
+#define errname_subscript          "<subscript>"
+#define errname_cast               "<cast>"
+#define errname_sizeoftype         "sizeof"
+#define errname_sizeofexpr         "sizeof"
+#define errname_ptrdiff            "-"   /* for (a-b)=c msg */
+#define errname_endcase            "break"
+#define errname_block              "<block>"
+#define errname_decl               "decl"
+#define errname_fndef              "fndef"
+#define errname_typespec           "typespec"
+#define errname_typedefname        "typedefname"
+#define errname_valof              "valof"
+#define errname_ellipsis           "..."
+#define errname_init               "="
+#define errname_eol                "\\n"
+#define errname_eof                "<eof>"
+#define errname_longdouble         "long double" /* there is no s_longdouble */
+#define errname_membertemplate     "<member template>"
+#define errname_classtemplate      "<class template>"
+
+#ifdef RANGECHECK_SUPPORTED
+#  define errname_rangecheck       "<rangecheck>"
+#  define errname_checknot         "<checknot>"
+#endif
+
+#endif                          /* ndef NLS */
+
+/* end of miperrs.h */
+/*
+ * cfe/feerrs.h - prototype for front-end error messages file
+ * Copyright (C) Acorn Computers Ltd., 1988-1990.
+ * Copyright (C) Codemist Ltd., 1987-1992.
+ * Copyright (C) Advanced RISC Machines Limited, 1991-1992.
+ * SPDX-Licence-Identifier: Apache-2.0
+ * version 3b.
+ */
+
+/*
+ * RCS $Revision$
+ * Checkin $Date$
+ * Revising $Author$
+ */
+
+#ifndef NLS                     /* if NLS, miperrs will have included tags */
+
+  /* Ordinary error messages - mapped onto numeric codes */
+
+/* Preprocessor messages are in miperrs.h */
+
+#define lex_warn_force_unsigned "'%s' treated as '%sul' in 32-bit implementation"
+#define lex_warn_force_longlong "'%s' treated as '%sll'"
+#define lex_warn_force_ulonglong "'%s' treated as '%sull'"
+#define lex_warn_multi_char "non-portable - not 1 char in '...'"
+#define lex_warn_cplusplusid "C++ keyword used as identifier: $r"
+#define lex_warn_cplusplusimpl \
+        "Functionality of C++ keyword may not yet be fully implemented: $r"
+
+#define syn_warn_hashif_undef "Undefined macro '%s' in #if - treated as 0"
+#define syn_warn_invent_extern "inventing 'extern int %s();'"
+#define syn_warn_unary_plus "Unary '+' is a feature of ANSI C"
+#define syn_warn_spurious_braces "spurious {} around scalar initialiser"
+#define syn_warn_dangling_else "Dangling 'else' indicates possible error"
+#define syn_warn_void_return "non-value return in non-void function"
+#define syn_warn_use_of_short \
+        "'short' slower than 'int' on this machine (see manual)"
+#define syn_warn_undeclared_parm \
+        "formal parameter $r not declared - 'int' assumed"
+#define syn_warn_old_style "Old-style function $r"
+#define syn_warn_give_args "Deprecated declaration %s() - give arg types"
+#define syn_warn_ANSI_decl "ANSI style function declaration used, '%s(...)'"
+#define syn_warn_archaic_init "Ancient form of initialisation, use '='"
+#define syn_warn_untyped_fn "implicit 'int' return type for $r - 'void' intended?"
+#define syn_warn_no_named_member "$c has no named member"
+#define syn_warn_extra_comma "Superfluous ',' in 'enum' declaration"
+#define syn_warn_struct_padded "padding inserted in struct $b"
+#define syn_warn_switch_funny "'switch (e)' not followed by '{'"
+#define syn_warn_modify_access "access declaration with no effect"
+#define syn_warn_storageclass_no_declarator \
+        "storage-class without declarator is spurious"
+#define syn_warn_lacks_storage_type \
+        "declaration lacks type/storage-class (assuming 'int'): $r"
+#define syn_warn_archaic_fnpara "archaic C-style function parameter $l"
+#define syn_warn_special_ops "'=', ',' or unary '&' defined as non-member"
+#define syn_warn_ineffective_asm_decl "asm(...) ignored: inline assembler not available"
+#define syn_warn_insert_sym_anachronism "inserting $r in ':(...)' anachronism"
+#define syn_warn_superfluous_prefix \
+     "superfluous 'union','class', 'struct' or 'enum' prefix"
+#define syn_warn_no_default_structor "$b: $c has no default %s"
+
+
+#define xsyn_info_instantiate_class \
+        "while instantiating $c"
+#define xsyn_info_instantiate_fn \
+        "while instantiating function $p$r"
+#define xsyn_warn_ARM_cctor_suppress \
+        "$b suppresses default copy constructor under ARM semantics"
+#define xsyn_warn_ISO_cctor_no_suppress \
+        "$b does not suppress default copy constructor under ISO semantics"
+#define xsyn_warn_ARM_opeq_suppress \
+        "$b suppresses default operator= under ARM semantics"
+#define xsyn_warn_ISO_opeq_no_suppress \
+        "$b does not suppress default operator= under ISO semantics"
+#define xsyn_warn_delete_undef \
+        "delete of pointer to undefined $c; no destructor will be called"
+#define xsyn_warn_implicit_private_base "base class $c is implicitly private"
+
+#define simp_warn_checkvar "syserr soon: checkvar use %ld"
+
+#define vargen_warn_nonull "omitting trailing '\\0' for %s [%ld]"
+#define vargen_warn_unnamed_bitfield \
+        "Unnamed bit field initialised to 0"
+#define vargen_warn_init_non_aggregate \
+        "Attempt to initialise non-aggregate"
+
+#define lex_err_ioverflow "Number %s too large for 32-bit implementation"
+#define lex_err_ioverflow_64 "Number %s too large for 64-bit implementation"
+#define lex_err_overlong_fp "Grossly over-long floating point number"
+#define lex_err_fp_syntax1 "Digit required after exponent marker"
+#define lex_err_overlong_hex "Grossly over-long hexadecimal constant"
+#define lex_err_overlong_int "Grossly over-long number"
+#define lex_err_need_hex_dig "Hex digit needed after 0x or 0X"
+#define lex_err_need_hex_dig1 "Missing hex digit(s) after \\x"
+#define lex_err_backslash_blank \
+        "\\<space> and \\<tab> are invalid string escapes"
+#define lex_err_unterminated_string "Newline or end of file within string"
+#define lex_err_bad_hash "misplaced preprocessor character '%c'"
+#define lex_err_bad_char "illegal character (0x%lx = \'%c\') in source"
+#define lex_err_bad_noprint_char "illegal character (hex code 0x%x) in source"
+#define lex_err_ellipsis "(...) must have exactly 3 dots"
+#define lex_err_illegal_whitespace "$s may not have whitespace in it"
+
+#define syn_err_illdtor "illegal destructor '~$#l'"
+#define syn_err_bitsize "bit size %ld illegal - 1 assumed"
+#define syn_err_zerobitsize "zero width named bit field - 1 assumed"
+#define syn_err_arraysize "Array size %ld illegal - 1 assumed"
+#define syn_err_expected "expected $s - inserted before $l"
+#define syn_err_expected1 "expected $s - inserted before $l"
+#define syn_err_expected1_aftercommand "expected $s after command - inserted before $l"
+#define syn_err_expected2 "expected $s or $s - inserted $s before $l"
+#define syn_err_expecteda "expected $s"
+#define syn_err_expected1a "expected $s"
+#define syn_err_expected1a_aftercommand "expected $s after command"
+#define syn_err_expected2a "expected $s or $s"
+#define syn_err_mix_strings "char and wide (L\"...\") strings do not concatenate"
+#define syn_err_expected_expr "<expression> expected but found $l"
+#ifdef EXTENSION_VALOF
+#define syn_err_valof_block \
+        "{ following a cast will be treated as VALOF block"
+#endif
+#define syn_err_typedef "typedef name $r used in expression context"
+#define syn_err_assertion "___assert(0, $e)"
+#define syn_err_expected_member "Expected <member> but found $l"
+#define syn_err_hashif_eof "EOF not newline after #if ..."
+#define syn_err_hashif_junk "Junk after #if <expression>"
+#define syn_err_initialisers "too many initialisers in {} for aggregate"
+#define syn_err_initialisers1 "{} must have 1 element to initialise scalar"
+#define syn_rerr_empty_init "Initialiser list must contain at least one expression"
+#define syn_err_default "'default' not in switch - ignored"
+#define syn_err_default1 "duplicate 'default' case ignored"
+#define syn_err_case "'case' not in switch - ignored"
+#define syn_err_case1 "duplicated case constant: %ld"
+#define syn_err_expected_cmd "<command> expected but found $l"
+#define syn_err_expected_stmt "<statement> expected but found $l"
+#define syn_err_expected_while "'while' expected after 'do' but found $l"
+#define syn_err_else "Misplaced 'else' ignored"
+#define syn_err_continue "'continue' not in loop - ignored"
+#define syn_err_break "'break' not in loop or switch - ignored"
+#define syn_err_no_label "'goto' not followed by label - ignored"
+#define syn_err_no_brace "'{' of function body expected - found $l"
+#define syn_err_stgclass \
+        "storage class $s not permitted in context %s - ignored"
+#define syn_err_stgclass1 "storage class $s incompatible with $g - ignored"
+#define syn_err_typeclash "type $s inconsistent with $m"
+#define syn_err_tag_brace \
+        "'{' or <identifier> expected after $s but found $l"
+#define syn_err_expected3 "Expecting <declarator> or <type> but found $l"
+#define syn_err_unneeded_id \
+        "superfluous $l in <abstract declarator> - ignored"
+#define syn_err_undef_struct_member(_b,_s) \
+        "undefined $c member: $r", _b, _s
+#define syn_err_undef_struct_object(_b,_s) \
+        "undefined $c object: $r", _b, _s
+#define syn_err_selfdef_struct_member(_b,_s) \
+        "attempt to include $c member: $r within itself", _b, _s
+#define syn_err_selfdef_struct_object(_b,_s) \
+        "attempt to include $c object: $r within itself", _b, _s
+#define syn_err_void_object_member(_s) "illegal 'void' member: $r", _s
+#define syn_err_void_object_object(_s) "illegal 'void' object: $r", _s
+#define syn_err_duplicate_type \
+        "duplicate type specification of formal parameter $r"
+#define syn_err_not_a_formal "Non-formal $r in parameter-type-specifier"
+#define syn_err_cant_init "$g names may not be initialised"
+#define syn_err_enumdef \
+        "<identifier> expected but found $l in 'enum' definition"
+#define syn_err_undef_enum "Undefined enum $r"
+#define syn_err_misplaced_brace "Misplaced '{' at top level - ignoring block"
+#define syn_err_not_friend "not a friend class $r"
+#define syn_err_undef_basetag "undefined base: $c"
+#define syn_err_missing_basetag "missing base tag: $l"
+#define syn_err_incomp_arg_ovld "Incompatible arguments to $b (overload missing?)"
+#define syn_err_no_operator_ovld "No operator $s with this type signature"
+#define syn_err_multi_overload_call "ambiguous %d-way overload for call to $b"
+#define syn_err_multi_operator_ovld "ambiguous %d-way overload for operator $s"
+#define syn_err_multi_convfn_ovld \
+    "ambiguous %d-way choice of conversion from $c to $t"
+#define syn_err_multi_ctor_ovld \
+    "ambiguous %d-way choice of constructor from $t to $c"
+#define syn_err_ambiguous_user_defined_conv \
+    "ambiguous implicit user-defined conversion from $c to $c"
+#define syn_err_illegal_asm_decl "illegal asm(...) declaration (ignored)"
+#define syn_err_recursive_app_operator_arrow \
+        "recursive application of operator->() to object of type $c; return type intended?"
+
+#define sem_err_assign_ovld \
+    "no suitable operator=() for $c: overload missing?"
+#define sem_warn_virtual "virtual function call of $b"
+#define sem_warn_addr_of_memfn "address of member function $b"
+#define xsem_warn_cast_undef_struct \
+    "cast from ptr/ref to $c to ptr/ref to $c; one is undefined, assuming unrelated"
+#define xsem_warn_unreachable_handler "handler is unreachable"
+
+#define syn_err_constructor_init "constructor forbids $r = {...} initialiser"
+#define syn_err_no_named_member "$c has no $r member"
+#define syn_err_not_found_named_member "member $r not found in $c"
+#define syn_err_missing_named_mfn "Missing class member function name"
+#define syn_err_classname_not_found "class-name $r not found"
+#define syn_err_member_cannot_init "member cannot be initialised: $r"
+#define syn_err_lacks_bclass_anachronism "$c lacks base class for ':(...)' anachronism"
+#define syn_err_not_member "$l is not a member of struct/class $b"
+#define syn_err_try_catch "'try-catch' unimplemented"
+#define syn_err_catch_ignored "misplaced 'catch' ignored"
+#define syn_err_illegal_simple_types "illegal <simple type>: $m"
+#define syn_err_no_member_here "class member $b cannot be defined here"
+#define syn_err_template_not_impl "'template' not implemented"
+#define syn_err_friend_type "'friend <type>;' needs elaborated-type-specifier"
+#define syn_err_linkage_spec "expected <linkage-spec> '}' before $l"
+#define syn_err_illegal_operator "'operator $s' is illegal"
+#define syn_err_wrong_args_ovld "wrong number of arguments to overload $b"
+#define syn_err_cannot_follow_unary_dcolon "$l cannot follow unary '::'"
+#define syn_err_cannot_follow_binary_dcolon "$l cannot follow binary '::'"
+#define syn_err_expected_dtor_name "expected destructor name after ::~, found $l"
+#define syn_err_missing_tlevel_decl "missing top-level declaration: $r"
+#define syn_err_no_decl_at_type "no $b declaration at this type"
+#define syn_err_lacks_arg_ctor "$t lacks an %ld-argument constructor"
+#define syn_err_no_nullary_ctor "no nullary constructor: $b"
+#define syn_err_ignored_new_array_ctor "new <array> initialiser ignored"
+#define syn_err_requires_pntr_arg "requires pointer argument: $s"
+#define syn_err_duplicated_mem_init "duplicate member initialisation: $r"
+#define syn_err_init_not_in_ctor "member initialiser not in constructor"
+#define syn_err_expected_id_in_mem_init "expecting <identifier> in <member-initialiser>"
+#define syn_err_missing_catch_after_try "omitted 'catch' after 'try'"
+#define syn_err_ill_this "legal only in member function: $l"
+#define syn_err_template_notclassorfunction "'template' not class nor function"
+#define syn_err_template_scope "invalid $c scope"
+#define syn_err_unspecialized_template "attempt to use template $b"
+#define syn_err_asm_not_available "inline assembler not available in strict ANSI mode"
+
+#define sem_err_temp_type_float "floating point type not allowed"
+#define sem_err_addr_template "attempt to take address of template $b"
+#define sem_err_typededuce_disagree "type deduction fails: $t disagrees with $t"
+#define sem_warn_typededuce_arraysize "type deduction fails: array size differs"
+#define sem_err_typededuce_ambiguous "type deduction fails: function type %d-way resolvable"
+#define sem_err_typededuce_pointer "type deduction fails: $t incompatible to $t"
+#define sem_err_typededuce_recognize "type deduction fails: un-recognizable type $t"
+#define sem_err_typededuce_type "type deduction fails: free template type arg $r"
+#define sem_err_typededuce_const "type deduction fails: free template non-type arg $r"
+#define sem_err_typename_not_found "type deduction failed: typename $b not found\n"
+#define sem_err_template_ambiguous "Ambiguous class/function templates"
+#define sem_err_non_type_arg_linkage "extern linkage expected for template argument $b"
+#define sem_err_non_type_arg_value "illegal non-type template arg $e"
+#define sem_err_template_arg_linkage "template type arg $t must have extern linkage"
+#define sem_err_call_dependency "call to $e not dependent on template args to $c"
+#define sem_err_type_arg_expected "template type arg expected"
+#define sem_err_typeclash_1 "type $m is inconsistent with $m"
+#define sem_err_typeclash_2 "template type expected, found $e"
+#define sem_err_typeclash_3 "template type inconsistent with $t"
+#define sem_err_lvalue_needed "temporary required for template argument"
+#define sem_err_dotdotdot_handler_not_last "handler for '...' must come last"
+#define sem_rerr_template_formal_length_class \
+        "number of template formals for $c differs from a previous declaration"
+#define sem_rerr_template_formal_length_function \
+        "number of template formals for $b differs from a previous declaration"
+#define sem_rerr_template_formal_type "template formal type $t inconsistent with $t"
+
+#define vargen_err_long_string "string initialiser longer than %s [%ld]"
+#define vargen_err_nonstatic_addr \
+        "non-static address $b in pointer initialiser"
+#define vargen_err_bad_ptr "$s: illegal use in pointer initialiser"
+#define vargen_err_init_void "objects of type 'void' can not be initialised"
+#define vargen_err_undefined_struct \
+        "$c must be defined for (static) variable declaration"
+#define vargen_err_open_array "Uninitialised static [] arrays illegal"
+#define vargen_err_overlarge_reg "invalid global register number"
+#define vargen_err_not_int "invalid type for global int register"
+#define vargen_err_not_float "invalid type for global float register"
+#ifdef TARGET_CALL_USES_DESCRIPTOR
+#define vargen_err_badinit "illegal initialisation to $r%+ld"
+#endif
+#ifdef TARGET_IS_HELIOS
+#define vg_err_dynamicinit "Initialised dynamic array with -ZR or -ZL"
+#endif
+#define vargen_rerr_nonaligned \
+        "Non-aligned ADCON at data+0x%lx (value $r+0x%lx) set to NULL"
+#define vargen_rerr_datadata_reloc \
+       "RISC OS (or other) reentrant module has static init. to data $r"
+#define vargen_rerr_compiler_confused \
+        "compiler confused: static const with dynamic initialisation"
+#define vargen_rerr_local_static_with_dtor \
+        "unimplemented: local static with destructor: $b"
+
+#define lex_rerr_8_or_9 "digit 8 or 9 found in octal number"
+#define lex_rerr_pp_number "number illegally followed by letter"
+#define lex_rerr_hex_exponent "hex number cannot have exponent"
+#define lex_rerr_esc16_truncated \
+        "overlarge escape '\\x%s%lx' treated as '\\x%lx'"
+#define lex_rerr_esc8_truncated "overlarge escape '\\%o' treated as '\\%o'"
+#define lex_rerr_illegal_esc "illegal string escape '\\%c' - treated as %c"
+#define lex_rerr_not1wchar "L'...' needs exactly 1 wide character"
+#define lex_rerr_empty_char "no chars in character constant ''"
+#define lex_rerr_overlong_char "more than 4 chars in character constant"
+
+#define syn_rerr_qualified_void "Return type may not be a void type other than 'void'"
+#define syn_rerr_array_0 "array [0] found"
+#ifdef EXTENSION_VALOF
+#define syn_rerr_void_valof "void valof blocks are not permitted"
+#endif
+#define syn_rerr_undeclared "undeclared name, inventing 'extern int %s'"
+#define syn_rerr_undeclared_fn "undeclared name, inventing 'extern \"C\" int %s(...);'"
+#define syn_rerr_insert_parens \
+        "parentheses (..) inserted around expression following $s"
+#define syn_rerr_return_expr_void "return <expr> illegal for void function"
+#define syn_rerr_return_expr_ctor "return <expr> illegal for constructor"
+#define syn_rerr_return_expr_dtor "return <expr> illegal for destructor"
+#define syn_rerr_qualified_typedef(_b,_m) \
+        "$m typedef $b has $m re-specified", _m, _b, _m
+#define syn_rerr_no_quals_allowed \
+        "only non-static member functions can be const or volatile"
+#define syn_rerr_missing_type "missing type specification - 'int' assumed"
+#define syn_rerr_missing_type_for "missing type specification for $r - 'int' assumed"
+#define syn_rerr_long_float "ANSI C does not support 'long float'"
+#define syn_rerr_missing_type1 \
+        "omitted <type> before formal declarator - 'int' assumed"
+#define syn_rerr_missing_type2 \
+        "function prototype formal $r needs type or class - 'int' assumed"
+#define syn_rerr_ellipsis_first "ellipsis (...) cannot be only parameter"
+#define syn_rerr_mixed_formals "prototype and old-style parameters mixed"
+#define syn_rerr_open_member "illegal [] member: $r"
+#define syn_rerr_ref_void "illegal type (void &) treated as (int &)"
+#define syn_rerr_ill_ref "$t of reference illegal -- '&' ignored"
+#define syn_rerr_fn_returntype "function returning $t illegal -- assuming pointer"
+#define syn_rerr_abst_class_rtype(_c)\
+        "function return abstract $c illegal", _c
+#define syn_rerr_array_elttype "array of $t illegal -- assuming pointer"
+#define syn_rerr_fn_ptr_member(_s) \
+   "member $r may not be function -- assuming pointer", _s
+#define syn_rerr_fn_ptr_object(_s) \
+   "object $r may not be function -- assuming pointer", _s
+#define syn_rerr_fn_ptr1 \
+        "function $r may not be initialised - assuming function pointer"
+#define syn_rerr_archaic_init "Ancient form of initialisation, use '='"
+#define syn_rerr_bitfield "illegal bit field type $t - 'int' assumed"
+#define syn_rerr_ANSIbitfield "ANSI C forbids bit field type $t"
+#define syn_rerr_missing_formal "formal name missing in function definition"
+#define syn_rerr_ineffective "declaration with no effect"
+#define syn_rerr_duplicate_member(b) "duplicate member $b", b
+#define syn_rerr_duplicate_member2(cl, sv) "duplicate member $p$r", cl, sv
+#define syn_rerr_semicolon_in_arglist \
+        "',' (not ';') separates formal parameters"
+#define syn_rerr_no_members "$c has no members"
+#define syn_rerr_not_base(mm,cc) "$b is not a base member of $c",mm,cc
+#define syn_rerr_badly_placed_access \
+    "access declarations only in public and protected parts"
+#define syn_rerr_modify_access "base access rights cannot be altered"
+#define xsyn_rerr_bad_conv "illegal conversion $p$r"
+#define xsyn_rerr_zero_params "$p$r must have zero parameters"
+#define xsyn_rerr_non_memfn_operator "$p$r must be a non-static member function"
+#define xsyn_rerr_no_return_type_allowed "no return type allowed for $p$r"
+#define xsyn_rerr_must_be_function "$p$r must be a function"
+#define syn_rerr_jump_past_init "jump past initialisation for $b"
+#define syn_rerr_ambiguous_qualification "$r is ambiguously qualified"
+#define syn_rerr_abstract_class_member(_b,_s) \
+        "abstract $c member: $r", _b, _s
+#define syn_rerr_abstract_class_object(_b,_s) \
+        "abstract $c object: $r", _b, _s
+#define syn_rerr_opaque_class_member(_b,_s) \
+        "opaque $c member: $r", _b, _s
+#define syn_rerr_opaque_class_object(_b,_s) \
+        "opaque $c object: $r", _b, _s
+#define syn_rerr_insert_braces "inserting { } around command after $s"
+#define syn_rerr_not_decl_qual(tb,s) \
+        "Definition of $c not $s: qualifier ignored", tb, s
+#define syn_rerr_ignored_non_fn "$g ignored for non-function $r"
+#define syn_rerr_global_anon_union "global anonymous union must be static"
+#define syn_rerr_defaults_ordering "defaulted parameter $r followed by non-defaulted"
+#define syn_rerr_unknown_linkage "unknown linkage: extern $e"
+#define syn_rerr_illegal_anon_union_mem "illegal anonymous union member $r"
+#define syn_rerr_illegal_nonpub_anon_union_mem "illegal non-public anonymous union member $r"
+#define syn_rerr_delete_expr_anachronism "'e' ignored in 'delete [e]' anachronism"
+#define syn_rerr_self_copying_ctor "self-copying constructor for $c"
+#define syn_rerr_duplicated_base "duplicate base $c ignored"
+#define syn_rerr_no_arg_in_template "no arguments in template<>"
+#define syn_rerr_superfluous_access_adjuster \
+        "superfluous type for access adjuster, declaration ignored"
+#define syn_rerr_private_bmember_ignored "private overloaded base member ignored"
+#define syn_rerr_local_default "$b has auto storage"
+#define syn_rerr_declaree_out_of_scope "'$#b::$#r' cannot be declared here"
+#define syn_rerr_friend_class_not_definable "friend $c shall not be defined"
+#define syn_rerr_expect_dtor "expecting destructor for $c, found $r"
+#define syn_rerr_union_w_base "unions may not have bases"
+#define syn_rerr_meminit_wrong_args \
+   "too few/many arguments to initialiser for simple member $b"
+#define syn_rerr_ref_not_initialised "reference $b must be initialised"
+#define syn_rerr_const_not_initialised "constant $b must be initialised"
+#define syn_rerr_addrof_cdtor_taken "can't take address of constructor or destructor"
+#define syn_rerr_multi_convfn_bool \
+    "ambiguous %d-way choice of conversion from $c in Boolean context"
+#define syn_rerr_tagdef_in_formals "cannot define within formals: $c"
+#define syn_rerr_neg_unsigned_enum "$c cannot have both negative and unsigned enumerators"
+#define xsyn_rerr_instantiate_mixup "instantiate don't mix with template or specialization"
+#define xsyn_rerr_spurious_instantiate "too many instantiate request"
+#define syn_rerr_extra_template_actuals "extra template actual(s) ignored"
+
+/* Split for the NLS */
+#define syn_moan_hashif_nonconst "illegal in #if <expression>: <unknown>"
+#define syn_moan_hashif_nonconst1 \
+     "illegal in #if <expression>: non constant $b"
+#define syn_moan_hashif_nonconst2 "illegal in #if <expression>: $s"
+#define syn_moan_case_nonconst \
+     "illegal in case expression (ignored): <unknown>"
+#define syn_moan_case_nonconst1 \
+     "illegal in case expression (ignored): non constant $b"
+#define syn_moan_case_nonconst2 \
+     "illegal in case expression (ignored): $s"
+
+      /* The following remain as ordinary (uncompressed) strings */
+
+#define syn_moan_hashif "#if <expression>"
+#define syn_moan_case "case expression (ignored)"
+#define xsyn_constructor_string "constructor"
+#define xsyn_copy_constructor_string "copy constructor"
+#define xsyn_destructor_string "destructor"
+#define xsyn_copy_assign_string "copy assignment"
+
+#endif                          /* Under NLS these are not tags */
+
+ /* The next batch of things just get mapped onto syserr codes */
+
+#define syserr_genpointer "genpointer&(%ld)"
+#define syserr_initsubstatic "initsubstatic(bit)"
+#define syserr_initstatic "initstatic(%ld,%#lx)"
+#define syserr_initstatic1 "initstatic(%ld)"
+#define syserr_rd_decl_init "rd_decl/init(%#lx)"
+#define syserr_rd_typename "rd_typename()=0"
+#define syserr_rdinit "syn_rdinit"
+#define syserr_rd_declarator "rd_declarator(%ld)"
+#define syserr_defaultstgclass "defaultstorageclass(%#x)"
+#define syserr_rd_declrhslist "rd_declrhslist confused"
+#define syserr_rd_decl2 "rd_decl2(%p,%ld)"
+#define syserr_rd_strdecl "rd_strdecl"
+#define syserr_lex_string "lex_string"
+
+/* end of cfe/feerrs.h */
+/*
+ * arm/mcerrs.h - prototype for machine-specific error messages file
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * RCS $Revision$
+ * Checkin $Date$
+ * Revising $Author$
+ */
+
+#ifndef NLS                     /* if NLS, miperrs will have included tags */
+
+  /* Ordinary error messages - mapped onto numeric codes */
+
+/*
+ * The following message is always machine specific since it may include
+ * information about the source of support for the product.
+ */
+#define misc_disaster_banner   "\n\
+Internal inconsistency: either resource shortage or compiler fault. If you\n\
+cannot alter your program to avoid this failure, please contact your supplier\n"
+
+#define mcdep_warn_fpinconsistent \
+        "Software floating point inconsistent with FPE2/3 and FPREGARGS"
+#define gen_warn_Lisp "Lisp-support stack push needed %ld"
+#define gen_err_swi "SWI number 0x%x too large"
+#define gen_err_irq "%s cannot handle __irq functions"
+#define obj_err_common "repeated common block $r"
+#define obj_err_common1 "common block $r too small"
+#define obj_err_common2 "common block $r too large"
+#define armobj_fatalerr_toomany "Too many symbols for ACORN linker"
+#define armdbg_fatalerr_toobig \
+        "Debug table size exceeds space in Acorn AOF format"
+
+#define asm_non_const           "illegal constant (ignored): <unknown>"
+#define asm_nonconst1           "illegal constant expression (ignored): non constant $b"
+#define asm_nonconst2           "illegal constant expression (ignored): $s"
+#define asm_err_bad_shift       "illegal shift specifier: %s"
+#define asm_err_expected_shift  "shift specifier expected"
+#define asm_err_bad_opcode      "illegal instruction opcode: %s"
+#define asm_err_bad_physreg     "physical registername expected, but found %s instead"
+#define asm_err_bad_psrfield    "illegal PSR field: %s"
+#define asm_err_expected_psr    "PSR field expected"
+#define asm_err_bad_shiftval    "shift value %d out of range"
+#define asm_err_expected_coproc "coprocessor identifier expected"
+#define asm_err_unknown_coproc  "illegal coprocessor identifier: %s"
+#define asm_err_coproc_op_range "coprocessor operation out of range: %d"
+#define asm_err_ldrt_adrmode    "preindexed addressing not available for LDRT/STRT"
+#define asm_err_no_mrs          "MRS & MSR are not available on this architecture"
+#define asm_err_no_teqp         "TEQP/TSTP/CMPP/CMNP are not available on this architecture"
+#define asm_err_no_longmul      "long multiply is not available on this architecture"
+#define asm_err_no_halfword     "halfword support is not available on this architecture"
+#define asm_err_corrupted_reg   "R%d corrupted but possibly reused later. This code may not work correctly"
+#define asm_err_ldm_base_list   "LDM/STM base with writeback in register list"
+#define asm_err_ldm_empty       "LDM/STM with empty register list"
+#define asm_err_ldm_badlist     "LDM/STM with illegal register list"
+#define asm_err_ldr_base_wb     "LDR/STR base, [base] with writeback"
+#define asm_err_mul_conflict    "MUL/MLA with Rd = Rm"
+#define asm_err_mull_conflict   "MULL/MLAL with Rhi = Rlo, Rhi = Rm or Rlo = Rm"
+#define asm_err_swp_conflict    "SWP with Rd = Rm, Rm = Rn or Rd = Rn"
+#define asm_err_pc              "illegal use of PC as operand"
+#define asm_err_write_pc        "illegal write to PC"
+#define asm_err_branch_pc       "a branch by writing to PC is not supported"
+#define asm_err_fn_id           "function identifier expected"
+#define asm_err_fn_notfound     "function %s undefined"
+#define asm_err_thumb_highreg   "illegal access to high register R%d"
+
+#endif                          /* ndef NLS - syserrs are not tags */
+
+  /* System failure messages - error text not preserved */
+
+#define syserr_interwork "Cannot compile this code with interworking, recompile without interworking"
+#define syserr_commondef "commondef %ld"
+#define syserr_obj_checksym "obj_checksym($r)"
+#define syserr_obj_codereloc "obj_coderelocation %.8lx"
+#define syserr_obj_gendata "obj_gendata(%ld)"
+#define syserr_obj_datalen "obj_data len=%ld"
+#define syserr_obj_data1 "obj_data %ldEL%ld'%s'"
+#define syserr_find_extsym "find_extsym"
+#define syserr_duff_lab "asm_trailer(duff lab)"
+#define syserr_asm_trailer "asm_trailer(%ld)"
+#define syserr_asm_data "asm_data len=%ld"
+#define syserr_asm_trailer1 "asm_trailer(%ldF%ld)"
+#define syserr_asm_hdata "asm_hdata len=%ld"
+#define syserr_module_reloc "Unsupported Arthur module relocation mode %d"
+#define syserr_outinstr "outinstr(%lx)"
+#define syserr_datasymb "Unable to find another data symbol at %ld"
+#define syserr_shifts "Register & constant shift together"
+#define syserr_remove_noop "remove_noops(MOVR r,r) failed"
+#define syserr_silly_shift "Silly shift value %ld"
+#define syserr_inline1 "armgen(J_INLINE1)"
+#define syserr_jop_mode "Illegal JOP mode(%lx,%lx)"
+#define syserr_gen_freg "freg %ld"
+#define syserr_remove_fp_noop "remove_noops(MOVD/FR r,r) failed"
+#define syserr_fp_const "%lx not an immediate fp constant"
+#define syserr_show_inst_dir "show_inst_dir(%#lX)"
+#define syserr_local_base "local_base %lx"
+#define syserr_local_addr "local_address %lx"
+#define syserr_bad_regpair "bad register pair"
+/* #define syserr_neg_addr "negative local address %ld/%lx for $b" */
+#define syserr_local_addr1 "local_addr"
+#define syserr_debug_addr "debugger local_fpaddr confused"
+#define syserr_displacement "displacement out of range %ld"
+#define syserr_unknown_label "unknown label reference type %.8lx"
+#define syserr_enter "emit(J_ENTER %ld)"
+#define syserr_gen_eval "gen_eval %ld"
+#define syserr_pendingstack_overflow "pending stack overflow"
+#define syserr_setsp_confused "SETSP confused %ld!=%ld %ld"
+#define syserr_callingstandard "Callingstandard %c"
+#define syserr_peep_bad_field "bad peephole op field"
+#define syserr_peep_cant_swap "peephole: can't swap"
+#define syserr_peep_bad_optype "bad peephole op type"
+#define syserr_bad_maxinst "peephole MAXINST inconsistent with peephole definitions"
+#define syserr_bad_useconstraint "bad peephole use constraint"
+#ifndef TARGET_HAS_AOUT
+#define syserr_debugger_line "debugger #line confused"
+#define syserr_addcodep "dbg_addcodep(twice)"
+#define syserr_filetooffset "dbg_filetooffset(%s)"
+#define syserr_dbg_bitfield "dbg_typerep(BITFIELD)"
+#define syserr_dbg_typerep "dbg_typerep(%p,0x%lx)"
+#define syserr_dbg_proc "dbg_proc"
+#define syserr_dbg_proc1 "dbg_proc confused"
+#define syserr_dbg_table "debugger table confusion(local variable $r %lx %lx)"
+#define syserr_dbg_scope "dbg_scope"
+#define syserr_dbg_write "dbg_write(%lx)"
+#define syserr_dbg_struct "dbg_STRUCT confused"
+#define syserr_dbg_fileinfobase "dbg_fileinfobase %ld != %ld"
+#define syserr_dbgloc "dbgloc %ld != %ld"
+#endif
+#define syserr_leaf_fn "Leaf function %s too big"
+#define syserr_stm_freeregs "STM free register conflict (regmask %d, free regs %d)"
+
+/* end of arm/mcerrs.h */
+
+#endif  /* _msgs_LOADED */
+/* end of build/derived/newton/arm/errors.h */
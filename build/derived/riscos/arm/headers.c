@@ -0,0 +1,1162 @@
+/*
+ * Copyright (C) Advanced RISC Machines Limited and
+ *               Codemist Limited, 19126.
+ * All rights reserved.
+ *
+ * build/derived/riscos/arm/headers.c, created by genhdrs on Sun Oct 18 07:52:38 2026
+ */
+
+static const unsigned short int compression_info[256] = {
+    0x0000, 0x696e, 0x0a23, 0x7420, 0x6520, 0x6465, 0x0a20, 0x0566, 
+    0x5f5f, 0x6c6f, 0x000a, 0x4646, 0x293b, 0x0701, 0x0d04, 0x020e, 
+    0x6f75, 0x0a0a, 0x6966, 0x626c, 0x6410, 0x1413, 0x202a, 0x6572, 
+    0x0103, 0x1504, 0x6172, 0x2c20, 0x6368, 0x0606, 0x6e67, 0x6e64, 
+    0x0020, 0x0021, 0x0022, 0x0023, 0x1c1a, 0x2008, 0x0026, 0x091e, 
+    0x0028, 0x0029, 0x002a, 0x002b, 0x002c, 0x002d, 0x002e, 0x002f, 
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 
+    0x0038, 0x0039, 0x003a, 0x003b, 0x003c, 0x003d, 0x003e, 0x003f, 
+    0x2720, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 
+    0x0048, 0x0049, 0x004a, 0x004b, 0x004c, 0x004d, 0x004e, 0x004f, 
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 
+    0x0058, 0x0059, 0x005a, 0x005b, 0x005c, 0x005d, 0x005e, 0x005f, 
+    0x7374, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 
+    0x0068, 0x0069, 0x006a, 0x006b, 0x006c, 0x006d, 0x006e, 0x006f, 
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 
+    0x0078, 0x0079, 0x007a, 0x007b, 0x007c, 0x007d, 0x007e, 0x0c0a, 
+    0x7369, 0x176e, 0x0265, 0x6609, 0x2416, 0x0b0b, 0x8361, 0x6f6e, 
+    0x1f12, 0x0212, 0x8288, 0x060a, 0x8603, 0x7970, 0x748d, 0x656c, 
+    0x6628, 0x7265, 0x2028, 0x4019, 0x766f, 0x6964, 0x9495, 0x7303, 
+    0x8e65, 0x6387, 0x6578, 0x9997, 0x494e, 0x655f, 0x5f4d, 0x6c75, 
+    0x6b81, 0x8f5f, 0xa0a1, 0x0720, 0x6072, 0x5fa2, 0x676e, 0x6d61, 
+    0x0725, 0x8420, 0x9a74, 0x6564, 0x3078, 0x4c45, 0x0174, 0x5354, 
+    0x9f73, 0x70b0, 0x807a, 0x616c, 0x80a6, 0x756e, 0x8120, 0xaab6, 
+    0x7072, 0x2920, 0x3634, 0x7829, 0x4649, 0x98a3, 0xbcad, 0x9ba9, 
+    0x5349, 0x7365, 0x0c8b, 0x6f72, 0x6c28, 0x9e41, 0xb29d, 0xab20, 
+    0x20ac, 0x6f73, 0x6303, 0x6167, 0x2031, 0xb4c7, 0x5f74, 0xc558, 
+    0x110a, 0x4552, 0x1620, 0x28bb, 0x908c, 0x9c54, 0x89a8, 0x4f4e, 
+    0xa720, 0xb8cb, 0xc493, 0xc603, 0xd9d8, 0x2819, 0x6c65, 0x7f8c, 
+    0x7f93, 0x0c1d, 0x1111, 0x2896, 0x896e, 0x5f56, 0x02dc, 0x3b20, 
+    0x0c06, 0x8a0a, 0xb5cd, 0x6f70, 0x2929, 0x6173, 0x3939, 0xcfc8, 
+    0x0220, 0x2818, 0x2992, 0x4443, 0x63b1, 0x8585, 0x91a4, 0xaff3, 
+    0xf4b1, 0xf669, 0x6973, 0x6174, 0xce3b, 0x5f66, 0x726f, 0xc0d7};
+
+typedef struct {
+    const char *name;
+    int content;
+} header_files;
+
+static const header_files builtin_headers[] = {
+   {"assert.h", 0},
+   {"ctype.h", 312},
+   {"errno.h", 873},
+   {"float.h", 1092},
+   {"iso646.h", 1943},
+   {"limits.h", 2070},
+   {"locale.h", 2393},
+   {"math.h", 2886},
+   {"setjmp.h", 7012},
+   {"signal.h", 7264},
+   {"stdarg.h", 7536},
+   {"stddef.h", 8333},
+   {"stdio.h", 8642},
+   {"stdlib.h", 11385},
+   {"string.h", 12725},
+   {"time.h", 13164},
+   {"kernel.h", 13692},
+   {"stdint.h", 16065},
+   {"varargs.h", 17273},
+   {0, 0}};
+
+static const unsigned char string_data[] = {
+    230,102,195, 99,157,116,235, 95,222,118,143,226,226, 17,228,168,
+    237,115, 23,116, 95,104,240, 14,  8,237,115, 23,116, 95,104,214,
+    248,  6,183, 34, 67, 34, 32,150, 37,237,115, 23,116, 40,155,132,
+     27,155,132, 27,174,232,183, 34, 67, 34, 32,150, 37,237,115, 23,
+    116, 50, 40,155,132, 27,155,132, 27,155,132, 27,174, 12,130,108,
+    193,  6,183,150, 37,237,115, 23,116, 40,155,132, 27,155,132, 27,
+    174,232,183,150, 37,237,115, 23,116, 50, 40,155,132, 27,155,132,
+     27,155,132, 27,174, 12,240, 18, 37,247,229,209,255,  8, 32, 62,
+     61, 32, 50, 48, 49, 49, 49, 50,240, 14, 96,251,105, 99, 95,237,
+    115, 23,  3, 95, 83,116,251,105, 99, 95,237,115, 23,116,240,101,
+    136,138,130,108,193,240,181,163,237,115, 23,116,233,137,163, 78,
+     68, 69, 66, 85, 71,240, 14,237,115, 23,116, 40,105,166,111,145,
+    242,227, 41, 48, 41,130,108,193,240, 14,237,115, 23,116, 40,101,
+    242, 40,101,185, 63,146,150, 41, 48, 32, 58, 37,237,115, 23,116,
+     40, 35,101, 27,  8,190,  8, 27,  8, 76,156, 69,  8,236,240, 18,
+     37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49,240,181,
+    163,237,115, 23,116,240, 14,237,115, 23,116, 40,101,242, 40,101,
+    185, 63,146,150, 41, 48, 32, 58, 37,237,115, 23,116, 50, 40, 35,
+    101, 27,  8,102,181, 99,  8, 27,  8,190,  8, 27,  8, 76,156, 69,
+      8,236,240,101,136,138,208,  0,230,102,195, 99,157,116,235, 95,
+    222,118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,101,
+    226,226,228,168, 99,152, 95,104, 15,  8, 99,152, 95,104,208, 15,
+      8, 83,204, 32, 15,  8, 80, 32, 50, 32, 15,  8, 66, 32, 52, 32,
+     15,  8, 76, 32, 56, 32, 15,  8, 85,204, 54, 32, 15,  8, 78, 32,
+     51, 50, 32, 15,  8, 67, 32,186, 32, 15,  8, 88,204, 50, 56, 32,
+     10,214,248, 10,183, 34, 67, 34, 32,123,138,137,163, 83, 89,175,
+     69, 77, 95,175, 65, 84, 73, 67, 83, 10,183,234,132,  8, 99,152,
+     59,130,108,193, 10,183,234, 36, 37, 99,152, 91, 93, 59,233, 15,
+    250,179,110,117,109, 40, 99,242,  8, 99,152, 91, 99, 93, 32, 38,
+    146,  8, 85, 43,  8, 76, 43,  8, 78,236,139, 15,250,179,112,104,
+     97, 40, 99,242,  8, 99,152, 91, 99, 93, 32, 38,146,  8, 85, 43,
+      8, 76,236,  6, 17, 24,250, 19, 97,110,107,241,194, 15,250, 99,
+    110,116,114,196, 99,242,  8, 99,152, 91, 99, 93, 32, 38, 37, 67,
+     41, 29, 10, 15,250,100,105,103,105,116, 40, 99,242,  8, 99,152,
+     91, 99, 93, 32, 38, 37, 78, 41,139, 15,250,103,114, 97,112,104,
+     40, 99,242,  8, 99,152, 91, 99, 93, 32, 38,146,  8, 76, 43,  8,
+     85, 43,  8, 78, 43,  8, 80,236,139, 15,250,  9,119, 23, 40, 99,
+    242,  8, 99,152, 91, 99, 93, 32, 38, 37, 76, 41,139, 15,250,184,
+    174, 40, 99,242,  8, 99,152, 91, 99, 93, 32, 38,146,  8, 76, 43,
+      8, 85, 43,  8, 78, 43,  8, 80, 43,  8, 66,236, 29, 10, 15,250,
+    112,181, 99,116, 40, 99,242,  8, 99,152, 91, 99, 93, 32, 38, 37,
+     80, 41,139, 15,250,115,112, 97, 99,101, 40, 99,242,  8, 99,152,
+     91, 99, 93, 32, 38, 37, 83, 41,139, 15,250,117,112,112, 23, 40,
+     99,242,  8, 99,152, 91, 99, 93, 32, 38, 37, 85, 41,139, 15,250,
+    120,100,105,103,105,116, 40, 99,242,  8, 99,152, 91, 99, 93, 32,
+     38,146,  8, 78, 43,  8, 88,236,139,228,168,248, 10, 24, 40,250,
+    179,110,117,109, 41,241,127, 24, 40,250,179,112,104, 97, 41,241,
+    127, 24, 40,250, 99,110,116,114,108, 41,241,127, 24, 40,250,100,
+    105,103,105,116, 41,241,127, 24, 40,250,103,114, 97,112,104, 41,
+    241,127, 24, 40,250,  9,119, 23, 41,241,127, 24, 40,250,184,174,
+     41,241,127, 24, 40,250,112,181, 99,116, 41,241,127, 24, 40,250,
+    115,112, 97, 99,101, 41,241,127, 24, 40,250,117,112,112, 23, 41,
+    241,127, 24, 40,250,120,100,105,103,105,116, 41,241, 12,138, 17,
+     24,116,111,  9,119, 23,241,225, 17, 24,116, 16,112,112, 23,241,
+    225,214,248, 10,125,233,138,208,  0,230,102,195, 99,157,116,235,
+     95,222,118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,
+    101,226, 17,228,168, 23,114,110,111, 95,104, 15,  8, 23,114,110,
+    111, 95,104, 10,228,163, 23,114,110,111,137,163, 83, 89,175, 69,
+     77, 95,175, 65, 84, 73, 67, 83, 15, 23,114,110,111, 22,  8, 23,
+    114,110,111,214,248, 10,183, 34, 67, 34, 32, 24, 42,  8, 23,114,
+    110,111, 59,130,108,193, 10,183,148,108,251,105,108,  4, 24, 42,
+      8, 23,114,110,111, 59,138,130,108,193, 15, 23,114,110,111, 37,
+     23,114,110,111,214,248, 10,183, 34, 67, 34, 32, 24, 23,114,110,
+    111, 59,  6,130,108,193, 10,183,148,108,251,105,108,  4, 24, 23,
+    114,110,111, 59,138,138,138,139, 15, 69, 68, 79, 77,204,139, 15,
+    209, 65, 78, 71, 69, 32, 50,139, 15, 69,192, 71, 78, 85, 77, 32,
+     51,139, 15, 69, 73, 76, 83, 69, 81, 32, 52,139, 15, 69, 79, 86,
+    209, 70, 76, 79, 87, 32, 53,139, 15, 69, 70, 66, 73, 71, 32, 54,
+    139,138,208,  0,230,102,195, 99,157,116,235, 95,222,118,143,230,
+      1, 99,159,  5, 95,135,108,121, 95,135, 99,101,226, 17,228,168,
+    134,116, 95,104, 15,  8,134,116, 95,104, 10, 15, 70, 76, 84, 95,
+     82, 65, 68, 73, 88, 32, 50,  6, 15, 70, 76, 84, 95, 82, 79, 85,
+     78, 68, 83,204,  6, 15, 70, 76, 84, 95, 69, 86, 65, 76,158, 69,
+     84, 72, 79, 68, 32, 48,139, 15, 70, 76, 84, 95, 72, 65, 83, 95,
+     83, 85, 66, 78, 79, 82, 77,204, 15, 68, 66, 76, 95, 72, 65, 83,
+     95, 83, 85, 66, 78, 79, 82, 77,204, 15, 76, 68, 66, 76, 95, 72,
+     65, 83, 95, 83, 85, 66, 78, 79, 82, 77,204,139, 15, 70, 76, 84,
+    197, 78, 84, 95, 68, 73, 71, 32, 50, 52, 15, 68, 66, 76,197, 78,
+     84, 95, 68, 73, 71, 32, 53, 51, 15, 76, 68, 66, 76,197, 78, 84,
+     95, 68, 73, 71, 32, 53, 51,139, 15, 70, 76, 84, 95, 68, 69, 67,
+     73, 77, 65, 76, 95, 68, 73, 71, 32, 57, 15, 68, 66, 76, 95, 68,
+     69, 67, 73, 77, 65, 76, 95, 68, 73, 71,204, 55, 15, 76, 68, 66,
+     76, 95, 68, 69, 67, 73, 77, 65, 76, 95, 68, 73, 71,204, 55, 29,
+     10, 15, 68, 69, 67, 73, 77, 65, 76, 95, 68, 73, 71,204, 55, 29,
+     10, 15, 70, 76, 84, 95, 68, 73, 71, 32, 54, 15, 68, 66, 76, 95,
+     68, 73, 71,204, 53, 15, 76, 68, 66, 76, 95, 68, 73, 71,204, 53,
+    139, 15, 70, 76, 84,158,156, 95, 69, 88, 80,146, 45, 49, 50, 53,
+     41, 15, 68, 66, 76,158,156, 95, 69, 88, 80,146, 45, 49, 48, 50,
+     49, 41, 15, 76, 68, 66, 76,158,156, 95, 69, 88, 80,146, 45, 49,
+     48, 50, 49, 41, 29, 10, 15, 70, 76, 84,158,156, 95, 49, 48, 95,
+     69, 88, 80,146, 45, 51, 55, 41, 15, 68, 66, 76,158,156, 95, 49,
+     48, 95, 69, 88, 80,146, 45, 51, 48, 55, 41, 15, 76, 68, 66, 76,
+    158,156, 95, 49, 48, 95, 69, 88, 80,146, 45, 51, 48, 55, 41, 29,
+     10, 15, 70, 76, 84,207, 95, 69, 88, 80,204, 50, 56, 15, 68, 66,
+     76,207, 95, 69, 88, 80,204, 48, 50, 52, 15, 76, 68, 66, 76,207,
+     95, 69, 88, 80,204, 48, 50, 52, 29, 10, 15, 70, 76, 84,207, 95,
+     49, 48, 95, 69, 88, 80, 32, 51, 56, 15, 68, 66, 76,207, 95, 49,
+     48, 95, 69, 88, 80, 32, 51, 48, 56, 15, 76, 68, 66, 76,207, 95,
+     49, 48, 95, 69, 88, 80, 32, 51, 48, 56, 29, 10, 15, 70, 76, 84,
+    207, 32, 51, 46, 52, 48, 50, 56, 50, 51, 52, 55,101, 43, 51, 56,
+     70, 15, 68, 66, 76,207,204, 46, 55, 57, 55, 54, 57, 51, 49, 51,
+     52, 56, 54, 50, 51, 49, 53, 55, 49,101, 43, 51, 48, 56, 15, 76,
+     68, 66, 76,207,204, 46, 55, 57, 55, 54, 57, 51, 49, 51, 52, 56,
+     54, 50, 51, 49, 53, 55, 49,101, 43, 51, 48, 56, 76,139, 15, 70,
+     76, 84, 95, 69, 80,192, 76,215,204, 46, 49, 57, 50, 48, 57, 50,
+     57, 48,101, 45, 55, 70, 15, 68, 66, 76, 95, 69, 80,192, 76,215,
+     32, 50, 46, 50, 50, 48, 52, 52, 54, 48, 52, 57, 50, 53, 48, 51,
+     49, 51, 49,101, 45, 49, 54, 15, 76, 68, 66, 76, 95, 69, 80,192,
+     76,215, 32, 50, 46, 50, 50, 48, 52, 52, 54, 48, 52, 57, 50, 53,
+     48, 51, 49, 51, 49,101, 45, 49, 54, 76,139, 15, 70, 76, 84,158,
+    156,204, 46, 49, 55, 53, 52, 57, 52, 51, 53,101, 45, 51, 56, 70,
+     15, 68, 66, 76,158,156, 32, 50, 46, 50, 50, 53, 48, 55, 51, 56,
+     53, 56, 53, 48, 55, 50, 48, 49, 51, 56,101, 45, 51, 48, 56, 15,
+     76, 68, 66, 76,158,156, 32, 50, 46, 50, 50, 53, 48, 55, 51, 56,
+     53, 56, 53, 48, 55, 50, 48, 49, 51, 56,101, 45, 51, 48, 56, 76,
+    139, 15, 70, 76, 84, 95, 84, 82, 85, 69,158,156,204, 46, 52, 48,
+     49, 50, 57, 56, 52, 54,101, 45, 52, 53, 70, 15, 68, 66, 76, 95,
+     84, 82, 85, 69,158,156, 32, 52, 46, 57, 52, 48, 54, 53,186, 53,
+     56, 52, 49, 50, 52, 54, 53, 52, 52,101, 45, 51, 50, 52, 15, 76,
+     68, 66, 76, 95, 84, 82, 85, 69,158,156, 32, 52, 46, 57, 52, 48,
+     54, 53,186, 53, 56, 52, 49, 50, 52, 54, 53, 52, 52,101, 45, 51,
+     50, 52, 76,139,138,208,  0,230,102,195, 99,157,116,235, 95,222,
+    118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,101, 17,
+    208,228,168,250,111,186, 54, 95,104, 15,  8,250,111,186, 54, 95,
+    104, 10, 15, 97, 31, 32, 38, 38, 15, 97, 31, 95,101,113, 32, 38,
+     61, 15, 98,105,116, 97, 31, 32, 38, 15, 98,105,116,195, 32,124,
+     15, 99,111,109,112,108, 32,126, 15,110,111,  3, 33, 15,110,111,
+    116, 95,101,113, 32, 33, 61, 15,195, 32,124,124, 15,195, 95,101,
+    113, 32,124, 61, 15,120,195, 32, 94, 15,120,195, 95,101,113, 32,
+     94, 61, 10,138,208,  0,230,102,195, 99,157,116,235, 95,222,118,
+    143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,101,226, 17,
+    228,168,108,105,109,105,116,115, 95,104, 15,  8,108,105,109,105,
+    116,115, 95,104, 10, 15, 67, 72, 65, 82, 95, 66, 73, 84, 32, 56,
+      6, 15, 83, 67, 72, 65, 82,158,156,146, 45,172, 56, 48, 41,  6,
+     15, 83, 67, 72, 65, 82,239, 55, 70,  6, 15, 85, 67, 72, 65, 82,
+    239, 11,  6,214, 70, 69, 65, 84, 85, 82, 69, 95,192, 71, 78, 69,
+     68, 95, 67, 72, 65, 82, 15, 67, 72, 65, 82,158,156,146, 45,172,
+     56, 48, 41,  6, 15, 67, 72, 65, 82,239, 55, 70,  6,130,108,193,
+     15, 67, 72, 65, 82,158,156, 32, 48,  6, 15, 67, 72, 65, 82,239,
+     11,  6,138, 15, 77, 66, 95,173, 78,207,204, 29, 10, 15, 83, 72,
+     82, 84,158,156,146, 45,172, 56, 48, 48, 48, 41,  6, 15, 83, 72,
+     82, 84,239, 55, 11, 70,  6, 15, 85, 83, 72, 82, 84,239,133,  6,
+     15,213,158,156,146,126,172, 55,133, 11, 70, 41,  6, 15,213,239,
+     55,133, 11, 70,  6, 15, 85,213,239,245,  6, 15, 76,215, 71,158,
+    156,146,126,172, 55,133, 11, 70, 76, 41,  6, 15, 76,215, 71,239,
+     55,133, 11, 70, 76,  6, 15, 85, 76,215, 71,239,245, 76,  6,137,
+     37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 15, 76,
+     76,215, 71,158,156,146,126,172, 55,245,133, 11, 70, 41,  6, 15,
+     76, 76,215, 71,239, 55,245,133, 11, 70,  6, 15, 85, 76, 76,215,
+     71,239,245,245,  6,233,138,208,  0,230,102,195, 99,157,116,235,
+     95,222,118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,
+    101,226, 17,228,168,  9, 99,179,157,104, 15,  8,  9, 99,179,157,
+    104,208, 15, 76, 67, 95, 67, 79, 76, 76, 65, 84, 69,204,  6, 15,
+     76, 67, 95, 67, 84, 89, 80, 69, 32, 50, 29, 15, 76, 67,158,215,
+     69, 84, 65, 82, 89, 32, 52, 29, 15, 76, 67, 95, 78, 85, 77,209,
+     73, 67, 32, 56, 29, 15, 76, 67, 95, 84, 73, 77, 69,204, 54,  6,
+     15, 76, 67, 95, 65, 76, 76, 32, 51, 49,139,214,248, 10,183, 34,
+     67, 34, 32,132,193,116,  9, 99,179,101,241, 27,191, 12,130,108,
+    193, 10,183,132,193,116,  9, 99,179,101,241, 27,191, 12,138,  6,
+     17,164,117,202,108,153,118, 32,123,  6,132,  5, 99,105,167,108,
+     95,112,111,174, 59, 29,132,116,104, 16,115, 97, 31,115, 95,193,
+    112, 59, 29,  6,132,103,114, 16,112,  1,103, 59, 29,  6,132,174,
+     95, 99,117,114,114, 95,115,121,109, 98,111,108, 59, 29, 29, 29,
+     29,132, 99,117,114,145,110, 99,121, 95,115,121,109, 98,111,108,
+     59, 29,132,109,135, 95,  5, 99,105,167,108, 95,112,111,174, 59,
+     29,132,109,135,206,104, 16,115, 97, 31,115, 95,193,112, 59, 29,
+      6,132,109,135, 95,103,114, 16,112,  1,103, 59, 29,  6,132,112,
+    111,128,116,105,118,157,180, 59, 29,  6,132,110,101,103,251,105,
+    118,157,180, 59, 29,  6, 36, 32,174,253,114, 97, 99, 95,100,105,
+    103,105,116,115, 59, 29, 29, 36, 32,102,114, 97, 99, 95,100,105,
+    103,105,116,115, 59, 29,  6, 36, 32,112, 95, 99,115, 95,112,145,
+     99,101,  5,115, 59, 29,  6, 36, 32,112, 95,193,112, 95, 98,121,
+     95,115,112, 97, 99,101, 59, 29, 29, 36, 32,110, 95, 99,115, 95,
+    112,145, 99,101,  5,115, 59, 29,  6, 36, 32,110, 95,193,112, 95,
+     98,121, 95,115,112, 97, 99,101, 59, 29, 29, 36, 32,112, 95,180,
+     95,112,201,110, 59, 29,  6, 36, 32,110, 95,180, 95,112,201,110,
+     59, 29, 10,139,125, 59, 10,214,248, 10,183, 34, 67, 34, 32,164,
+    117,202,108,153,118, 22,  9, 99,179,101,153,118,227, 12,130,108,
+    193, 10,183,164,117,202,108,153,118, 22,  9, 99,179,101,153,118,
+    227, 12,138,139,228,163, 78, 85, 76, 76,240, 14, 78, 85, 76, 76,
+     32, 48,233,138,208,  0,230,102,195, 99,157,116,235, 95,222,118,
+    143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,101,226, 17,
+    228,168,167,116,104, 95,104, 15,  8,167,116,104, 95,104, 10,214,
+     67, 67, 95, 78, 79, 82, 67, 82, 79, 70, 84, 10, 15,  8, 99,179,
+    108, 23, 95,110, 26,254,119,138, 17,189,140,134,116,252, 10,189,
+     25, 21,157,116, 59,139,228,163, 72, 85, 71, 69,229, 65, 76,240,
+     14, 72, 85, 71, 69,229, 65, 76, 37,104,117,103,157,118,179,214,
+    248,240, 14, 72, 85, 71, 69, 37,104,117,103,157,118,179, 10,183,
+     34, 67, 34, 32,155, 25, 72, 85, 71, 69,229, 65, 76, 59,130,108,
+    193, 10,183,155, 25, 72, 85, 71, 69,229, 65, 76, 59,138,138, 29,
+     29, 29, 29, 29, 29, 10,228,163, 72, 85, 71, 69,229, 65, 76, 76,
+     15, 72, 85, 71, 69,229, 65, 76, 76,146, 40, 64, 21,101,185, 72,
+     85, 71, 69,229, 65, 76, 41,138, 29, 10,228,168,248,228,163, 72,
+     85, 71, 69,229, 65, 76, 70,240, 14, 72, 85, 71, 69,229, 65, 76,
+     70, 32,156, 70,156, 73, 84, 89,233, 15,156, 70,156, 73, 84, 89,
+     32, 48,102, 95, 55, 70, 56, 48, 48, 48, 48, 48,  6, 15, 78, 65,
+     78, 32, 48,102, 95, 55, 70, 67, 48, 48, 48, 48, 49,139, 15, 70,
+     80, 95, 90,209, 79, 32, 48, 15, 70, 80, 95, 83, 85, 66, 78, 79,
+     82, 77, 65, 76,204, 15, 70, 80, 95, 78, 79, 82, 77, 65, 76, 32,
+     50, 15, 70, 80, 95,156, 70,156, 73, 84, 69, 32, 51, 15, 70, 80,
+     95, 78, 65, 78, 32, 52,  6,233,214, 70, 80, 95, 70, 65,175, 95,
+     70, 77, 65, 15, 70, 80, 95, 70, 65,175, 95, 70, 77, 65,204,138,
+    214, 70, 80, 95, 70, 65,175, 95, 70, 77, 65, 70, 15, 70, 80, 95,
+     70, 65,175, 95, 70, 77, 65, 70,204,138,214, 70, 80, 95, 70, 65,
+    175, 95, 70, 77, 65, 76, 15, 70, 80, 95, 70, 65,175, 95, 70, 77,
+     65, 76,204,138, 29, 10, 15, 70, 80, 95, 73, 76, 79, 71, 66, 48,
+    146, 45,172, 55,133, 11, 70,185, 15, 70, 80, 95, 73, 76, 79, 71,
+     66, 78, 65, 78,146,126,172, 55,133, 11, 70,185, 29, 10, 15, 77,
+     65, 84, 72, 95,209, 82, 78, 79,204, 15, 77, 65, 84, 72, 95,209,
+     82, 69, 88, 67, 69, 80, 84, 32, 50, 10,  2,181,163,167,116,104,
+     95, 23,114,104, 97, 31,108,  1,103, 29, 29, 29, 29, 29, 29, 29,
+     29,  6, 17, 29, 29, 29, 29, 29, 29, 29, 29, 10,214,248, 10,183,
+     34, 67, 34, 32,123,233,228,168,248,208, 47, 47, 35,220,110,111,
+     95,128,  5, 95,101,102,102,101, 99,116,115, 10, 47, 47, 35,220,
+    102,195, 99,157,102,112, 26,103,115, 95,  1, 95,145,103,115, 10,
+      8, 99,179,108, 23, 95,110, 26,254,119, 32, 24,  8,102,112, 99,
+    108,237,115, 18,121,144,134,116,127, 24,  8,102,112, 99,108,237,
+    115, 18,121,100, 40, 21,101,127,  8, 99,179,108, 23, 95,110, 26,
+    254,119, 32, 24,  8,180, 98,105,116,144,134,116,127, 24,  8,180,
+     98,105,116,100, 40, 21,101,127,  8, 99,179,108, 23, 95,110, 26,
+    254,119, 32,140,  8, 99,235,121,180,144,134,116, 44,134,116,127,
+     25,  8, 99,235,121,128,103, 31, 40, 21,101, 44, 21,101,127, 47,
+     47, 35,220,110,111,253,195, 99,157,102,112, 26,103,115, 95,  1,
+     95,145,103,115, 10, 47, 47, 35,220,128,  5, 95,101,102,102,101,
+     99,116,115, 10,214,248, 15,  8, 99,108,237,115,167, 99,254, 40,
+    102,110, 44,114,242,178,101,111,144,114,185, 61, 61, 32, 52, 32,
+     63, 37, 35, 35,102,110, 35, 35,144, 40,134,116, 41, 40,114, 41,
+    185, 58, 32, 92,  6,  8, 35, 35,102,110, 35, 35,100, 40, 40, 21,
+    101, 41, 40,114,236, 41,130,108,193, 15,  8,237,115, 23,116,102,
+    112, 40,114, 41, 37, 95,237,115, 23,116, 40,  8, 95,152,111,144,
+    114,185, 61, 61,200, 48, 48, 50, 32,124,124, 92,  6,  8, 95,152,
+    111,144,114,185, 61, 61,200, 50, 48, 50, 32,124,124, 92,  6,  8,
+     95,152,111,144,114,185, 61, 61,200, 52, 48, 50, 27, 92,  6, 34,
+     73,108,222,103,179, 32,142,  4,117,115,199,119,105,116,104, 32,
+     99,108,237,115, 18,105, 99,251,105,135, 32,167, 99,254, 34, 41,
+     10, 15,  8, 99,108,237,115,167, 99,254, 40,102,110, 44,114,242,
+      8,237,115, 23,116,102,112, 40,114, 41, 44, 92,  6,  8, 95,152,
+    111,144,114,185, 61, 61,200, 52, 48, 50, 32, 63, 37, 35, 35,102,
+    110, 35, 35,144, 40,134,116, 41, 40,114, 41,185, 58, 32, 92,  6,
+      8, 35, 35,102,110, 35, 35,100, 40, 40, 21,101, 41, 40,114,236,
+     41,233, 15,102,112, 99,108,237,115, 18,121, 40,114, 41, 37, 99,
+    108,237,115,167, 99,254, 40,102,112, 99,108,237,115, 18,121, 44,
+     40,114,236,  6, 15,250,102,  1,105,116,101, 40,114,242,102,112,
+     99,108,237,115, 18,121, 40,114,185, 60, 61, 32, 70, 80, 95, 78,
+     79, 82, 77, 65, 76, 41,  6, 15,250,  1,144,114,242,102,112, 99,
+    108,237,115, 18,121, 40,114,185, 61, 61, 32, 70, 80, 95,156, 70,
+    156, 73, 84, 69, 41,  6, 15,250,110, 97,110, 40,114,242,102,112,
+     99,108,237,115, 18,121, 40,114,185, 61, 61, 32, 70, 80, 95, 78,
+     65, 78, 41,  6, 15,250,110,195,167,196,114,242,102,112, 99,108,
+    237,115, 18,121, 40,114,185, 61, 61, 32, 70, 80, 95, 78, 79, 82,
+     77, 65, 76, 41,  6, 15,180, 98,105,116, 40,114, 41, 37, 99,108,
+    237,115,167, 99,254, 40,180, 98,105,116, 44, 40,114,236,139,138,
+     17, 25, 97, 99,201,221,223, 97, 99,201,212,224, 97, 99,201,218,
+    225,139, 25,237,  1,221,223,237,  1,212,224,237,  1,218,225,139,
+     25,251, 97,110,221,223,251, 97,110,212,224,251, 97,110,218,225,
+     10, 25,251, 97,110, 50,221, 27, 25,223,251, 97,110, 50,212, 27,
+    140,224,251, 97,110, 50,218, 27,147,225, 29, 10, 25, 99,201,221,
+    223, 99,201,212,224, 99,201,218,225,139, 25,115,  1,221,223,115,
+      1,212,224,115,  1,218,225,139, 25,116, 97,110,221,223,116, 97,
+    110,212,224,116, 97,110,218,225,  6, 17, 25, 97, 99,201,104,221,
+    223, 97, 99,201,104,212,224, 97, 99,201,104,218,225,139, 25,237,
+      1,104,221,223,237,  1,104,212,224,237,  1,104,218,225, 10, 25,
+    251, 97,110,104,221,223,251, 97,110,104,212,224,251, 97,110,104,
+    218,225, 29, 10, 25, 99,201,104,221,223, 99,201,104,212,224, 99,
+    201,104,218,225,139, 25,115,  1,104,221,223,115,  1,104,212,224,
+    115,  1,104,218,225,139, 25,116, 97,110,104,221,223,116, 97,110,
+    104,212,224,116, 97,110,104,218,225, 17, 25,154,112,221,223,154,
+    112,212,224,154,112,218,225,139, 25,154,112, 50,221,223,154,112,
+     50,212,224,154,112, 50,218,225,139, 25,154,112,109, 49,221,223,
+    154,112,109, 49,212,224,154,112,109, 49,218,225,139, 25,102,145,
+    120,112,221, 27, 24, 42, 32,223,102,145,120,112,212, 27, 24, 42,
+     32,224,102,145,120,112,218, 27, 24, 42, 32,225, 29, 29, 10, 24,
+    105,  9,103, 98,221,127, 24,105,  9,103, 98,212,127, 24,105,  9,
+    103, 19, 40,147,225, 29, 29, 10, 25,108,  5,120,112,221, 27, 24,
+    223,108,  5,120,112,212, 27, 24,224,108,  5,120,112,218, 27, 24,
+    225,139, 25,  9,103,221,223,  9,103,212,224,  9,103,218,225, 29,
+     10, 25,  9,103, 49, 48,221,223,  9,103, 49, 48,212,224,  9,103,
+     49, 48,218,225, 29, 10, 25,  9,103, 49,112,221,223,  9,103, 49,
+    112,212,224,  9,103, 49,112,218,225, 29, 10, 25,  9,103, 50,221,
+    223,  9,103, 50,212,224,  9,103, 50,218,225,139, 25,  9,103, 98,
+    221,223,  9,103, 98,212,224,  9,103, 19, 40,147,225, 29, 29, 10,
+     25,109,111,100,144, 25, 27, 25, 42, 32,223,109,111,100,102,212,
+     27,140, 42, 32,224,109,111,100,102,218, 27,147, 42, 32,225, 29,
+     10, 25,115, 99,179, 98,110,221, 27, 24,223,115, 99,179, 98,110,
+    212, 27, 24,224,115, 99,179, 98,110,218, 27, 24,127, 25,115, 99,
+    179, 19,110,221, 27, 64, 24,223,115, 99,179, 19,110,212, 27, 64,
+     24,224,115, 99,179, 19,110,218, 27, 64, 24,225, 17, 25, 99, 98,
+    114,116,221,223, 99, 98,114,116,212,224, 99, 98,114,116,218,225,
+    230,110,111, 95,128,  5, 95,101,102,102,101, 99,116,115, 10, 25,
+    102, 97, 98,115,221,223,102, 97, 98,115,212,224,102, 97, 98,115,
+    218,225,230,128,  5, 95,101,102,102,101, 99,116,115, 10, 25,104,
+    141,111,116,221, 27, 25,223,104,141,111,116,212, 27,140,224,104,
+    141,111,116,218, 27,147,225,139, 25,112,111,119,221, 27, 25,223,
+    112,111,119,212, 27,140,224,112,111,119,218, 27,147,225, 29, 10,
+     25,115,113,114,116,221,223,115,113,114,116,212,224,115,113,114,
+    116,218,225,  6, 17, 25, 23,144, 25,223, 23,102,212,224, 23,102,
+    218,225, 10, 25, 23,102, 99,221,223, 23,102, 99,212,224, 23,102,
+     99,218,225, 29, 10, 25,108,103, 97,109,167,221,223,108,103, 97,
+    109,167,212,224,108,103, 97,109,167,218,225, 29, 10, 25,116,103,
+     97,109,167,221,223,116,103, 97,109,167,212,224,116,103, 97,109,
+    167,218,225, 29,  6, 17, 25, 99,101,105,196, 25,223, 99,101,105,
+    108,212,224, 99,101,105,108,218,225,139, 25,131,195,221,223,131,
+    195,212,224,131,195,218,225,  6,230,110,111, 95,128,  5, 95,101,
+    102,102,101, 99,116,115, 10, 25,110,101, 26, 98,121,174,221,223,
+    110,101, 26, 98,121,174,212,224,110,101, 26, 98,121,174,218,225,
+      6,230,128,  5, 95,101,102,102,101, 99,116,115, 10, 25,114,174,
+    221,223,114,174,212,224,114,174,218,225,139, 64, 24,108,114,174,
+    221,127, 64, 24,108,114,174,212,127, 64, 24,108,114,174,218, 12,
+    214,247,229,209,255,  8,137, 37,247,229,209,255,  8, 32, 62, 61,
+    204,238, 57, 48, 49, 10, 64, 64, 24,108,108,114,174,221,127, 64,
+     64, 24,108,108,114,174,212,127, 64, 64, 24,108,108,114,174,218,
+     12,138,138, 29,  6,230,110,111, 95,128,  5, 95,101,102,102,101,
+     99,116,115, 10, 25,114, 16, 31,221,223,114, 16, 31,212,224,114,
+     16, 31,218,225,  6,230,128,  5, 95,101,102,102,101, 99,116,115,
+     10, 64, 24,108,114, 16, 31,221,127, 64, 24,108,114, 16, 31,212,
+    127, 64, 24,108,114, 16, 31,218, 12,214,247,229,209,255,  8,137,
+     37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 10, 64,
+     64, 24,108,108,114, 16, 31,221,127, 64, 64, 24,108,108,114, 16,
+     31,212,127, 64, 64, 24,108,108,114, 16, 31,218, 12,138,138, 29,
+    139, 25,116,114,181, 99,221,223,116,114,181, 99,212,224,116,114,
+    181, 99,218,225,139, 25,102,109,111,100,221, 27, 25,223,102,109,
+    111,100,212, 27,140,224,102,109,111,100,218, 27,147,225, 29,139,
+     25,145,167,  1,  5,114,221, 27, 25,223,145,167,  1,  5,114,212,
+     27,140,224,145,167,  1,  5,114,218, 27,147,225, 10, 25,145,109,
+    113,117,111,221, 27, 25, 27, 24, 42, 32,223,145,109,113,117,111,
+    212, 27,140, 27, 24, 42, 32,224,145,109,113,117,111,218, 27,147,
+     27, 24, 42, 32,225, 29, 29, 10,230,110,111, 95,128,  5, 95,101,
+    102,102,101, 99,116,115, 10, 25, 99,235,121,180,221, 27, 25,223,
+     99,235,121,180,212, 27,140,224, 99,235,121,180,218, 27,147,225,
+    139, 25,110, 97,110, 40,191,223,110, 97,110,144,191,224,110, 97,
+    110,196,191,232,230,128,  5, 95,101,102,102,101, 99,116,115, 10,
+     25,110,170, 97,102,116, 23,221, 27, 25,223,110,170, 97,102,116,
+     23,212, 27,140,224,110,170, 97,102,116, 23,218, 27,147,225, 10,
+     25,110,170,116,111,119, 26,100,221, 27,147,223,110,170,116,111,
+    119, 26,100,212, 27,147,224,110,170,116,111,119, 26,100,218, 27,
+    147,225, 10, 25,102,100,105,109,221, 27, 25,223,102,100,105,109,
+    212, 27,140,224,102,100,105,109,218, 27,147,225, 29,  6,230,110,
+    111, 95,128,  5, 95,101,102,102,101, 99,116,115, 10, 25,102,167,
+    120,221, 27, 25,223,102,167,120,212, 27,140,224,102,167,120,218,
+     27,147,194, 25,102,109,  1,221, 27, 25,223,102,109,  1,212, 27,
+    140,224,102,109,  1,218, 27,147,232,230,128,  5, 95,101,102,102,
+    101, 99,116,115, 17, 25,102,167,221, 27, 25, 27, 25,223,102,167,
+    212, 27,140, 27,140,224,102,167,218, 27,147, 27,147,225, 29,139,
+    228,168,248, 15,250,103,145,251, 23, 40,120, 44,121,242,211, 37,
+    103,145,251, 23,146,121,236, 15,250,103,145,251, 23,101,113,117,
+    179, 40,120, 44,121,242,211, 37,103,145,251, 23,101,113,117,179,
+    146,121,236, 15,250,222,115,115, 40,120, 44,121,242,211, 37,222,
+    115,115,146,121,236, 15,250,222,115,193,113,117,179, 40,120, 44,
+    121,242,211, 37,222,115,193,113,117,179,146,121,236, 15,250,222,
+    115,115,103,145,251, 23, 40,120, 44,121,242,211, 37,222,115,115,
+    103,145,251, 23,146,121,236, 15,250,181,195,  5,145,100, 40,120,
+     44,121,242,211, 37,181,195,  5,145,100,146,121,236, 29, 29,233,
+    214, 78, 79,197, 84, 72, 95,156, 76,156,156, 71,226,208, 25,  8,
+    100, 95, 97, 99,201, 40, 21,101,127, 25,  8,100, 95,237,  1, 40,
+     21,101,127, 25,  8,100, 95,251, 97,110, 40, 21,101,127, 25,  8,
+    100, 95, 99,201, 40, 21,101,127, 25,  8,100, 95,115,  1, 40, 21,
+    101,127, 25,  8,100,206, 97,110, 40, 21,101,127, 25,  8,100, 95,
+      9,103, 40, 21,101,127, 25,  8,100, 95,108,103, 49, 48, 40, 21,
+    101,127, 25,  8,100, 95,154,112, 40, 21,101,127, 25,  8,100, 95,
+     97, 98,115, 40, 21,101,127, 25,  8,100, 95,115,113,114,116, 40,
+     21,101,127, 25,  8,100, 95,131,195, 40, 21,101,127, 25,  8,100,
+     95, 99,101,105,196, 21,101,127, 25,  8,100,206,114,181, 99, 40,
+     21,101,127, 25,  8,100, 95,114,174, 40, 21,101,127, 64, 24,  8,
+    100, 95,108,114,174, 40, 21,101,127, 25,  8,100, 95,145,109, 40,
+     21,101, 44, 21,101,127, 25,  8,100,253,167, 40, 21,101, 44, 21,
+    101, 44, 21,101, 12,214, 77, 65, 84, 72, 95, 70, 79, 82, 67, 69,
+     95,156, 76,156,156, 71,240, 18, 37,247,229,209,255,  8, 32, 62,
+     61,204,238, 57, 48, 49, 15, 97, 99,201,211, 37,100, 95, 97, 99,
+    201,211, 15,237,  1,211, 37,100, 95,237,  1,211, 15, 99,201,211,
+     37,100, 95, 99,201,211, 15,115,  1,211, 37,100, 95,115,  1,211,
+     15,116, 97,110,211, 37,100,206, 97,110,211, 15,115,113,114,116,
+    211, 37,100, 95,115,113,114,116,211, 15,  9,103,211, 37,100, 95,
+      9,103,211, 15,  9,103, 49, 48,211, 37,100, 95,108,103, 49, 48,
+    211, 15,154,112,211, 37,100, 95,154,112,211,240,101,136,138, 15,
+    251, 97,110,211, 37,100, 95,251, 97,110,211,214,248,240, 14,102,
+     97, 98,115,211, 37,100, 95, 97, 98,115,211,130,108,193,240, 14,
+    102, 97, 98,115,211,146,227,185,178,101,111,102,146,102, 97, 98,
+    115, 41,211, 27,  8, 97, 98,115,146, 21,101,242,187, 41,138, 15,
+    131,195,211, 37,100, 95,131,195,211, 15, 99,101,105,196,187, 37,
+    100, 95, 99,101,105,196,187, 15,116,114,181, 99,211, 37,100,206,
+    114,181, 99,211, 15,114,174,211, 37,100, 95,114,174,211, 15,108,
+    114,174,211, 37,100, 95,108,114,174,211, 15,145,167,  1,  5,114,
+     40,120, 44,121, 41, 37,100, 95,145,109, 40,120, 44,121, 41,214,
+     70, 80, 95, 70, 65,175, 95, 70, 77, 65,240, 14,102,167, 40,120,
+     44,121, 44,122, 41, 37,100,253,167, 40,120, 44,121, 44,122, 41,
+    138,228,168,248, 10,  8, 99,179,108, 23, 95,110, 26,254,119, 32,
+    140,  8,114, 95, 97, 99,201, 40,134,116,127,  8, 99,179,108, 23,
+     95,110, 26,254,119, 32,140,  8,114, 95,237,  1, 40,134,116,127,
+      8, 99,179,108, 23, 95,110, 26,254,119, 32,140,  8,114, 95,251,
+     97,110, 40,134,116,127,  8, 99,179,108, 23, 95,110, 26,254,119,
+     32,140,  8,114, 95,115,  1, 40,134,116,127,  8, 99,179,108, 23,
+     95,110, 26,254,119, 32,140,  8,114, 95, 99,201, 40,134,116,127,
+      8, 99,179,108, 23, 95,110, 26,254,119, 32,140,  8,114,206, 97,
+    110, 40,134,116,127,  8, 99,179,108, 23, 95,110, 26,254,119, 32,
+    140,  8,114, 95,  9,103, 40,134,116,127,  8, 99,179,108, 23, 95,
+    110, 26,254,119, 32,140,  8,114, 95,108,103, 49, 48, 40,134,116,
+    127,  8, 99,179,108, 23, 95,110, 26,254,119, 32,140,  8,114, 95,
+    154,112, 40,134,116,127,  8, 99,179,108, 23, 95,110, 26,254,119,
+     32,140,  8,114, 95, 97, 98,115, 40,134,116,127,  8, 99,179,108,
+     23, 95,110, 26,254,119, 32,140,  8,114, 95,115,113,114,116, 40,
+    134,116,127,  8, 99,179,108, 23, 95,110, 26,254,119, 32,140,  8,
+    114, 95,131,195, 40,134,116,127,  8, 99,179,108, 23, 95,110, 26,
+    254,119, 32,140,  8,114, 95, 99,101,105,196,134,116,127,  8, 99,
+    179,108, 23, 95,110, 26,254,119, 32,140,  8,114,206,114,181, 99,
+     40,134,116,127,  8, 99,179,108, 23, 95,110, 26,254,119, 32,140,
+      8,114, 95,114,174, 40,134,116,127,  8, 99,179,108, 23, 95,110,
+     26,254,119, 32, 64, 24,  8,114, 95,108,114,174, 40,134,116,127,
+      8, 99,179,108, 23, 95,110, 26,254,119, 32,140,  8,114, 95,145,
+    109, 40,134,116, 44,134,116,127,  8, 99,179,108, 23, 95,110, 26,
+    254,119, 32,140,  8,114,253,167, 40,134,116, 44,134,116, 44,134,
+    116, 12, 15, 99,235,121,180, 40,120, 44,121, 41, 37, 99,235,121,
+    128,103, 31, 40,120, 44,121, 41, 15, 99,235,121,180,144,120, 44,
+    121, 41, 37, 99,235,121,180,144,120, 44,121, 41, 15, 97, 99,201,
+    144,187, 37,114, 95, 97, 99,201,211, 15,237,  1,144,187, 37,114,
+     95,237,  1,211, 15,251, 97,110,144,187, 37,114, 95,251, 97,110,
+    211, 15,115,  1,144,187, 37,114, 95,115,  1,211, 15, 99,201,144,
+    187, 37,114, 95, 99,201,211, 15,116, 97,110,144,187, 37,114,206,
+     97,110,211, 15,115,113,114,116,144,187, 37,114, 95,115,113,114,
+    116,211, 15,  9,103,144,187, 37,114, 95,  9,103,211, 15,  9,103,
+     49, 48,144,187, 37,114, 95,108,103, 49, 48,211, 15,154,112,144,
+    187, 37,114, 95,154,112,211, 15,102, 97, 98,115,144,187,146,227,
+    185,178,101,111,102,146,102, 97, 98,115,102, 41,211, 27,  8, 97,
+     98,115,146,134,116,242,187, 41, 15,131,195,144,187, 37,114, 95,
+    131,195,211, 15, 99,101,105,108,144,187, 37,114, 95, 99,101,105,
+    196,187, 15,116,114,181, 99,144,187, 37,114,206,114,181, 99,211,
+     15,114,174,144,187, 37,114, 95,114,174,211, 15,108,114,174,144,
+    187, 37,114, 95,108,114,174,211, 15,145,167,  1,  5,114,144,120,
+     44,121, 41, 37,114, 95,145,109, 40,120, 44,121, 41,214, 70, 80,
+     95, 70, 65,175, 95, 70, 77, 65, 70,240, 14,102,167,144,120, 44,
+    121, 44,122, 41, 37,114,253,167, 40,120, 44,121, 44,122, 41,138,
+    138,233,214, 84, 65, 82, 71, 69, 84, 95, 70, 80, 85,229, 70, 80,
+     10,140,  8,114, 95, 97, 98,115, 40,134,116,127, 25,  8,100, 95,
+     97, 98,115, 40, 21,101,127, 15,102, 97, 98,115,144,187, 37,114,
+     95, 97, 98,115,211, 15,102, 97, 98,115,211, 37,100, 95, 97, 98,
+    115,211,233,214,248, 10,125,233,214, 67, 67, 95, 78, 79, 82, 67,
+     82, 79, 70, 84, 10, 47, 47, 32, 83,104, 16,108,100, 32,167,116,
+     28, 32,119,105,116,104, 32,116,104,  4, 35, 14, 97,  3,116,104,
+      4,116,235, 46,  2,181,168, 99,179,108, 23, 95,110, 26,254,119,
+    233,138,208,  0,230,102,195, 99,157,116,235, 95,222,118,143,230,
+      1, 99,159,  5, 95,135,108,121, 95,135, 99,101,226,226,228,168,
+    193,116,106,109,112, 95,104, 15,  8,193,116,106,109,112, 95,104,
+     10,214, 74, 77, 80, 95, 66, 85, 70, 95,192, 90, 69, 10,189, 24,
+    106,109,112, 95, 98,117,102, 91,  8, 74, 77, 80, 95, 66, 85, 70,
+     95,192, 90, 69, 93, 59,130,108,193, 10,189, 24,106,109,112, 95,
+     98,117,102, 91, 50, 50, 93,231,138, 32,  6,226, 17,214,247,  8,
+     10, 15,193,116,106,109,112, 40,106,109,112, 95, 98,117,102,242,
+    193,116,106,109,112, 40,106,109,112, 95, 98,117,102,236,233,214,
+    248, 15, 95, 78,111,145,116,117,114,110, 10,183, 34, 67, 34, 32,
+    123,130,108, 18, 32, 13,171, 40,  8,247,229,209,255,  8,185, 38,
+     38, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49,130,
+    108,193, 15, 95, 78,111,145,116,117,114,110,233, 24,193,116,106,
+    109,112, 40,106,109,112, 95, 98,117,102, 32,232, 17,150, 32, 95,
+     78,111,145,116,117,114,110, 32, 39,106,109,112, 40,106,109,112,
+     95, 98,117,102, 32, 27, 24,232,214,248, 10,125,233,138,208,  0,
+    230,102,195, 99,157,116,235, 95,222,118,143,230,  1, 99,159,  5,
+     95,135,108,121, 95,135, 99,101,226,226,228,168,180,179, 95,104,
+     15,  8,180,179, 95,104, 17,189, 24,128,103, 95,251,111,109,105,
+     99,252, 29, 10,214,248, 10,183, 34, 67, 34, 32,123,233,150, 37,
+    192, 71, 95, 68, 70, 76, 40,174,127,150, 37,192, 71, 95,209, 82,
+     40,174,127,150, 37,192, 71, 95, 73, 71, 78, 40,174,232, 15,192,
+     71, 95, 68, 70, 76, 32, 38,  8,192, 71, 95, 68, 70, 76, 15,192,
+     71, 95,209, 82, 32, 38,  8,192, 71, 95,209, 82, 15,192, 71, 95,
+     73, 71, 78, 32, 38,  8,192, 71, 95, 73, 71, 78, 10,  6, 15,192,
+     71, 65, 66, 82, 84,204, 32, 15,192, 71, 70, 80, 69, 32, 50, 32,
+     15,192, 71, 73, 76, 76, 32, 51, 32, 15,192, 71,213, 32, 52, 32,
+     15,192, 71, 83, 69, 71, 86, 32, 53, 32, 15,192, 71, 84,209, 77,
+     32, 54, 32, 15,192, 71,175, 65, 75, 32, 55, 32,139, 15,192, 71,
+     85, 83, 82, 49, 32, 56, 15,192, 71, 85, 83, 82, 50, 32, 57, 15,
+    192, 71, 79, 83,209, 82, 79, 82,204, 48, 17,150,146, 42,180,179,
+    146, 24, 27,150,146, 42, 32, 32, 41, 40,174,236, 41, 40,174,232,
+     17, 24,114, 97,105,193,241,225,214,248, 10,125,233,138,208,  0,
+    230,102,195, 99,157,116,235, 95,222,118,143,230,  1, 99,159,  5,
+     95,135,108,121, 95,135, 99,101,226, 17,228,168, 96,100, 26,103,
+     95,104, 15,  8, 96,100, 26,103, 95,104,226, 17,189,132,118, 97,
+     95,108,105, 96, 91, 49, 93,231,139,214,248, 10,116,101,109,112,
+    108,251,  4, 60, 99,108,237,115, 32, 84, 62, 32,164,117,202,  8,
+    179,105,166,111,102,116,101, 96, 10,123, 32, 36, 37,109,101,109,
+     98, 23, 49,231, 84, 37,109,101,109, 98, 23, 50, 59, 10,125, 59,
+     10, 15,  8,179,105,166,111,144,152,185, 92,  6, 40, 40,132, 41,
+     38, 40, 40, 40,  8,179,105,166,111,102,116,101, 96, 60,152, 62,
+     42,185, 48, 41, 45, 62,  8,109,101,109, 98, 23, 50,185, 45,146,
+    132, 41, 48, 41, 15,  8,179,105,166,117,112,116,111,152, 40,112,
+    116,114, 44,152,185, 92,  6, 40, 40,132, 41, 40, 40,174, 41, 40,
+    112,116,114,185, 43,146,  8,179,105,166,111,144,152, 41, 45, 49,
+    185, 38, 32,126, 40,  8,179,105,166,111,144,152, 41, 45, 49,236,
+     41, 10, 15,118, 97, 95, 96, 26,116, 40, 97,112, 44,112, 26,109,
+     78,185, 92,  6, 40,227, 41, 40, 42, 40, 97,112,185, 61,146,132,
+     41, 38, 40,112, 26,109, 78,185, 43, 32,178,101,111,144,112, 26,
+    109, 78,236, 41, 15,118, 97, 95, 26,103, 40, 97,112, 44,152,185,
+     92,  6, 40, 42, 40,142,  4, 42, 41, 40, 40, 42, 40, 97,112, 41,
+     61,  8,179,105,166,117,112,116,111,152, 40, 42, 40, 97,112, 41,
+     44,152, 41, 43,178,101,111,144,152,236, 45, 92,  6,178,101,111,
+    144,152,236, 41,130,108,193,226, 15,  8,179,105,166,111,144,152,
+    185, 92,  6, 40, 40,132, 41, 38, 40, 40, 40,164,117, 99,116,123,
+     36, 37,109,101,109, 98, 23, 49,231, 92,  6,  8, 95,142,  4,142,
+      4,  8,109,101,109, 98, 23, 50, 59,125, 42,185, 48, 41, 45, 62,
+      8,109,101,109, 98, 23, 50,185, 45, 32, 92,  6, 40,132, 41, 48,
+     41, 15,  8,179,105,166,117,112,116,111,152, 40,112,116,114, 44,
+    152,185, 92,  6, 40, 40,132, 41, 40, 40,174, 41, 40,112,116,114,
+    185, 43,146,  8,179,105,166,111,144,152, 41, 45, 49,185, 38, 32,
+    126, 40,  8,179,105,166,111,144,152, 41, 45, 49,236, 41, 17, 15,
+    118, 97, 95, 96, 26,116, 40, 97,112, 44,112, 26,109, 78,185, 92,
+      6, 40,  8, 95,237,115, 23,116, 40, 40,  8, 95,152,111,144,112,
+     26,109, 78,185, 38,200, 52, 56, 49,185, 61, 61, 32, 48, 27, 92,
+      6, 34, 73,108,222,103,179, 32,142,  4,111,102, 32, 50, 31, 32,
+     26,103,117,109,101,110,  3,116,111, 32,118, 97, 95, 96, 26,116,
+     34, 41, 27, 92,  6,227, 41, 40, 42, 40, 97,112,185, 61,146,132,
+     41, 38, 40,112, 26,109, 78,185, 43, 32,178,101,111,144,112, 26,
+    109, 78,236, 41,139, 15,118, 97, 95, 26,103, 40, 97,112, 44,152,
+    185, 92,  6, 40,  8, 95,237,115, 23,116, 40, 40,  8, 95,152,111,
+    144,  8, 95,142,  4,152,185, 38,200, 52, 56, 49,185, 61, 61, 32,
+     48, 27, 92,  6, 34, 73,108,222,103,179, 32,142,  4,117,115,199,
+    119,105,116,104, 32,118, 97, 95, 26,103, 34, 41, 27, 92,  6, 42,
+     40,  8, 95,142,  4,142,  4, 42, 41, 40, 40, 42, 40, 97,112, 41,
+     61,  8,179,105,166,117,112,116,111,152, 40, 42, 40, 97,112, 41,
+     44,152, 41, 43,178,101,111,144,  8, 95,142,  4,152,236, 45, 92,
+      6,178,101,111,144,  8, 95,142,  4,152,236, 41,  6,233, 15,118,
+     97, 95, 99,235,121, 40,  5, 96, 44,115,114, 99,242,227, 41, 40,
+     42, 40,  5, 96,185, 61, 22, 40,115,114, 99,236, 41,139, 15,118,
+     97, 95,101, 31, 40, 97,112,242,227, 41, 40, 42, 40, 97,112,185,
+     61,146,132, 41, 45, 50, 53, 54,236,139,138,208,  0,230,102,195,
+     99,157,116,235, 95,222,118,143,230,  1, 99,159,  5, 95,135,108,
+    121, 95,135, 99,101,226,226,228,168, 96,100,  7, 95,104, 15,  8,
+     96,100,  7, 95,104, 17,189, 24,112,116,114,100, 18,102,252,228,
+    168,247,  8,240, 14,112,116,114,100, 18,102, 95,  3, 24,138,139,
+    228,168,198,116,240, 14,  8,219, 49, 10,189,234, 24,198,116,231,
+      6,233,228,168,119, 36,206,240, 14,  8,119, 36, 95,  3, 49, 10,
+    189, 24,119, 36,206,231,  6,233,214,247,229,209,255,  8,137, 37,
+    247,229,209,255,  8, 32, 62, 61, 32, 50, 48, 49, 49, 49, 50, 10,
+    189,181,105,135, 10,123, 32, 64, 64, 24,  8, 97, 59,  6,147,  8,
+     98, 59,  6,150, 22,  8, 99, 59,  6,150,146, 42,  8,100, 41,227,
+    127,125, 32,167,120, 95,179,105,166,252,  6,138,233,228,163, 78,
+     85, 76, 76, 32,240, 14, 78, 85, 76, 76, 32, 48,  6,233,214,248,
+     15,111,102,102,193,116,111,144,152, 27,109,101,109, 98, 23,185,
+     92,  6, 40, 40,198,116, 41, 40, 40,132, 41, 38, 40, 40, 40,142,
+      4, 42, 41, 48, 41, 45, 62,109,101,109, 98, 23,185, 45,146,132,
+     41, 48,236,130,108,193, 15,111,102,102,193,116,111,144,152, 27,
+    109,101,109, 98, 23,185, 92,  6, 40, 40,198,116, 41, 40, 40,132,
+     41, 38, 40, 40, 40,  8, 95,142,  4,142,  4, 42, 41, 48, 41, 45,
+     62,109,101,109, 98, 23,185, 45,146,132, 41, 48,236,138,  6,138,
+    208,  0,230,102,195, 99,157,116,235, 95,222,118,143,230,  1, 99,
+    159,  5, 95,135,108,121, 95,135, 99,101,226,226,228,168, 96,100,
+    105,111, 95,104, 15,  8, 96,100,105,111, 95,104, 10, 15,  8, 76,
+     73, 66,229,209,255, 32, 53, 48, 48, 32, 10,228,168,198,116, 15,
+      8,219, 49, 10,189,234, 24,198,116,231,138,208,189,132,  8,118,
+     97, 95,108,105, 96, 91, 49, 93,231, 10,228,163, 78, 85, 76, 76,
+    240, 14, 78, 85, 76, 76, 32, 48, 32,138, 17,189, 64, 24, 95,111,
+    102,102,252,137, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57,
+     48, 49, 10,189, 64, 64, 24, 95,111,102,102,186,252,233,228,163,
+     95,190, 95, 79, 11, 83, 69, 84, 95, 66, 73, 84, 83, 15, 95,190,
+     95, 79, 11, 83, 69, 84, 95, 66, 73, 84, 83, 32, 51, 50,138,137,
+     37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 32, 38,
+     38, 32, 95,190, 95, 79, 11, 83, 69, 84, 95, 66, 73, 84, 83, 32,
+     61, 61, 32,186, 10,189, 95,111,102,102,186, 95,  3,102,112,201,
+    252,130,108, 18, 32, 95,190, 95, 79, 11, 83, 69, 84, 95, 66, 73,
+     84, 83, 32, 61, 61, 32, 51, 50, 10,189, 95,111,102,102, 95,  3,
+    102,112,201,252,130,108,193,  2, 23,114,195, 32, 85,110,115,117,
+    112,112,195,116,199, 95,190, 95, 79, 11, 83, 69, 84, 95, 66, 73,
+     84, 83, 32,118, 97,159,101,138,139,137, 32, 13,171, 40, 95, 76,
+     65, 82, 71, 69,190, 95, 83, 79, 85, 82, 67, 69,185,124,124, 32,
+     13,171, 40, 95, 76, 65, 82, 71, 69,190,186, 95, 83, 79, 85, 82,
+     67, 69, 41, 10,189,102,112,201, 95,  3,111,102,102,252,138,139,
+    137, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 32,
+     38, 38, 32, 13,171, 40, 95, 76, 65, 82, 71, 69,190,186, 95, 83,
+     79, 85, 82, 67, 69, 41, 10,189, 95,111,102,102,186, 95,  3,102,
+    112,201,186,206, 27,111,102,102,186,252,138,  6, 17,189,164,117,
+    202,  8,190, 95,164,117, 99,116, 10,123, 32,234,132,  8,112,116,
+    114, 59,  6, 24,  8,105, 99,110,116,231,  6, 24,  8,111, 99,110,
+    116,231,  6, 24,  8,102,108,203, 59, 29,  6,234,132,  8, 98, 97,
+    193,231,  6, 24,  8,102,105,222,231,  6, 39, 37, 99,108,105, 98,
+     95,181,117,115,171,231,  6, 24,  8, 98,117,102,178,231,  6, 24,
+      8,180,251,117,145,231,  6,164,117,202,  8,170,114, 97,100,251,
+     97, 22,  8,170,114, 97,112,231, 10,125, 32,190, 59,139,240, 14,
+     95, 73, 79, 82, 69, 65, 68,200, 48, 49, 32,240, 14, 95, 73, 79,
+     87, 82, 73, 84, 69,200, 48, 50, 32,240, 14, 95, 73, 79, 66,156,
+    200, 48, 52, 32,240, 14, 95, 73, 79,175, 82, 71,200, 48, 56, 32,
+    240, 14, 95, 73, 79, 83, 69, 69, 75,200, 49, 48, 32,240, 14, 95,
+     73, 79, 76, 65, 90, 89,200, 50, 48, 32,240, 14, 95, 73, 79, 83,
+     66, 70,200, 56, 48, 48, 32,240, 14, 95, 73, 79, 65, 80, 80, 69,
+     78, 68,200, 48, 56, 48, 48, 48, 32, 15, 95, 73, 79, 69, 79, 70,
+    200, 52, 48, 32, 15, 95, 73, 79,209, 82,200, 56, 48, 32, 15, 95,
+     73, 79, 70, 66, 70,200, 49, 48, 48, 32, 15, 95, 73, 79, 76, 66,
+     70,200, 50, 48, 48, 32, 15, 95, 73,215, 66, 70,200, 52, 48, 48,
+     32, 10, 15, 66, 85, 70,192, 90,146, 52, 48, 57, 54,185, 15, 69,
+     79, 70,146, 45, 49, 41,  6, 15, 70, 79, 80, 69, 78,207, 32, 95,
+     83, 89, 83, 95, 79, 80, 69, 78,139, 15, 95, 83, 89, 83, 95, 79,
+     80, 69, 78,204, 54, 15,190, 78, 65, 77, 69,207, 32, 56, 48,  6,
+     15, 76,206,109,112,110, 97,109, 32,190, 78, 65, 77, 69,207,139,
+    228,163, 83, 69, 69, 75, 95, 83, 69, 84, 15, 83, 69, 69, 75, 95,
+     83, 69, 84, 32, 48, 32, 15, 83, 69, 69, 75, 95, 67, 85, 82,204,
+     32, 15, 83, 69, 69, 75, 95, 69, 78, 68, 32, 50, 32,233, 15, 84,
+     77, 80,207,204, 48, 48, 48, 48, 48, 48, 48, 48, 48,139,214,248,
+     10,183, 34, 67, 34, 32,123,138,137,163, 83, 89,175, 69, 77, 95,
+    175, 65, 84, 73, 67, 83, 10,183,190, 22, 96,100,  1, 59, 10,183,
+    190, 22, 96, 20,116, 59, 10,183,190, 22, 96,  5,114,114, 59,130,
+    108,193, 10,183,190, 37,105,111, 98, 91, 93, 59,139, 15, 96,100,
+      1,146, 38,  8,105,111, 98, 91, 48, 93, 41,  6, 15, 96, 20,  3,
+     40, 38,  8,105,111, 98, 91, 49, 93, 41,  6, 15, 96,  5,114,114,
+    146, 38,  8,105,111, 98, 91, 50, 93, 41,  6,138, 17, 24,145,109,
+    111,118,101, 40,191,194, 24,145,110, 97,109,101, 40,191, 27,191,
+    194,190, 22,116,109,112,102,105,222,227, 12,137, 37,247,229,209,
+    255,  8, 32, 62, 61,204,238, 57, 48, 49, 10,190, 22,206,109,112,
+    102,105,222,186,227, 12,137, 32, 95,190, 95, 79, 11, 83, 69, 84,
+     95, 66, 73, 84, 83, 32, 61, 61, 32,186, 15,116,109,112,102,105,
+    108,  4,206,109,112,102,105,222,186,138,137,163, 95, 76, 65, 82,
+     71, 69,190,186, 95, 83, 79, 85, 82, 67, 69, 15,116,109,112,102,
+    105,222,186, 32,206,109,112,102,105,222,186,138,138,139,132,116,
+    109,112,110, 97,109, 40,169,232, 17, 24,102, 99,  9,193, 40,190,
+    210,194, 24,102,102,176,104, 40,190,210,194,190, 22,102,235,101,
+    110, 40,191, 44,  6,191, 12,137, 37,247,229,209,255,  8, 32, 62,
+     61,204,238, 57, 48, 49, 10,190, 22,253,235,101,110,186, 40,191,
+     44,  6,191, 12,137, 32, 95,190, 95, 79, 11, 83, 69, 84, 95, 66,
+     73, 84, 83, 32, 61, 61, 32,186, 15,102,235,101,110, 32,253,235,
+    101,110,186,138,137,163, 95, 76, 65, 82, 71, 69,190,186, 95, 83,
+     79, 85, 82, 67, 69, 15,102,235,101,110,186, 32,253,235,101,110,
+    186,138,138,139,190, 22,102,145,235,101,110, 40,191, 44,  6,191,
+     44,  6,190,210, 12,137, 37,247,229,209,255,  8, 32, 62, 61,204,
+    238, 57, 48, 49, 10,190, 22,253,145,235,101,110,186, 40,191, 44,
+      6,191, 44,  6,190,210, 12,137, 32, 95,190, 95, 79, 11, 83, 69,
+     84, 95, 66, 73, 84, 83, 32, 61, 61, 32,186, 15,102,145,235,101,
+    110, 32,253,145,235,101,110,186,138,137,163, 95, 76, 65, 82, 71,
+     69,190,186, 95, 83, 79, 85, 82, 67, 69, 15,102,145,235,101,110,
+    186, 32,253,145,235,101,110,186,138,138,139,150, 32,193,116, 98,
+    117,144,190,210, 27,169,194, 24,193,116,118, 98,117,144,190,210,
+     27,169, 44,  6, 24, 27,219,194,230, 45,118, 49, 32, 10, 24,102,
+    184,174,144,190,210, 27,191, 27, 46, 46, 46,194, 24,184,174,144,
+    191, 27, 46, 46, 46,194, 24,115,110,184,174,144,169, 27,219, 44,
+      6,191, 27, 46, 46, 46,194, 24,115,184,174,144,169, 27,191, 27,
+     46, 46, 46,232,230, 45,118, 50, 32, 10, 24,102,115, 99, 97,110,
+    144,190,210, 44,  6,191, 27, 46, 46, 46,194, 24,115, 99, 97,110,
+    144,191, 27, 46, 46, 46,194, 24,115,115, 99, 97,110,144,191, 27,
+    191, 27, 46, 46, 46,232,230, 45,118, 48, 32, 10, 24,118,102,184,
+    174,144,190,210, 27,191, 44,  6,  8,118, 97, 95,108,105,151,194,
+     24,118,102,115, 99, 97,110,144,190,210, 27,191, 44,  6,  8,118,
+     97, 95,108,105,151,194, 24,118,184,174,144,191, 27,  8,118, 97,
+     95,108,105,151,194, 24,118,115, 99, 97,110,144,191, 27,  8,118,
+     97, 95,108,105,151,194, 24,118,115,110,184,174,144,169, 27,219,
+     44,  6,191, 27,  8,118, 97, 95,108,105,151,194, 24,118,115,184,
+    174,144,169, 27,191, 44,  6,  8,118, 97, 95,108,105,151,194, 24,
+    118,115,115, 99, 97,110,144,191, 27,191, 44,  6,  8,118, 97, 95,
+    108,105,151,232, 17, 24,102,103,101,116, 99, 40,190,210,194,132,
+    102,103,101,116,115, 40,169, 27, 24, 27,190,210,194, 24,102,112,
+    117,116, 99,241, 27,190,210,194, 24,102,112,117,116,115, 40,191,
+     27,190,210,194, 24,  8,102,105,108, 98,117,144,190,210,232, 15,
+    103,101,116, 99, 40,112,185, 92,  6, 40, 45, 45, 40, 40,112, 41,
+     45, 62,  8,105, 99,110,116,185, 62, 61, 32, 48, 32, 63, 22, 40,
+     40,112, 41, 45, 62,  8,112,116,114, 41, 43, 43, 32, 58, 37,102,
+    105,108, 98,117,144,112,236,228,168,248, 10, 24, 40,103,101,116,
+     99, 41, 40,190,210, 12,138,  6, 15,103,101,116, 36, 40,185,103,
+    101,116, 99, 40, 96,100,  1, 41,228,168,248, 10, 24, 40,103,101,
+    116, 36, 41,227, 12,138,  6,137, 37,247,229,209,255,  8, 32, 60,
+     32, 50, 48, 49, 49, 49, 50, 10,132,103,101,116,115, 40,169,232,
+    233, 24,  8,102,108,115, 98,117,144, 24, 27,190,210,232, 15,112,
+    117,116, 99, 40, 28, 27,112,185, 92,  6, 40, 45, 45, 40, 40,112,
+     41, 45, 62,  8,111, 99,110,116,185, 62, 61, 32, 48, 32, 63,146,
+     42, 40, 40,112, 41, 45, 62,  8,112,116,114, 41, 43, 43, 32, 61,
+    146, 28, 41,185, 58, 37,102,108,115, 98,117,144, 28, 44,112,236,
+    228,168,248, 10, 24, 40,112,117,116, 99, 41,241, 27,190,210, 12,
+    138,  6, 15,112,117,116, 36, 40, 28,185,112,117,116, 99, 40, 28,
+     27, 96, 20,116, 41,228,168,248, 10, 24, 40,112,117,116, 36, 41,
+    241, 12,138,139, 24,112,117,116,115, 40,191,194, 24,117, 30,101,
+    116, 99,241, 27,190,210,232, 17,219,102,145, 97,100,227,210, 44,
+      6,219, 27,219, 27,190,210,194,219,102,119,114,105,116,101, 40,
+    155,150,210, 44,  6,219, 27,219, 27,190,210,232, 17, 24,102,103,
+    101,116,112,201, 40,190,210, 27, 95,111,102,102, 95,  3, 42, 32,
+     12,137, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49,
+     10, 24,253,103,101,116,112,201,186, 40,190,210, 27, 95,111,102,
+    102,186, 95,  3, 42, 32, 12,137, 32, 95,190, 95, 79, 11, 83, 69,
+     84, 95, 66, 73, 84, 83, 32, 61, 61, 32,186, 15,102,103,101,116,
+    112,201, 32,253,103,101,116,112,201,186,138,137,163, 95, 76, 65,
+     82, 71, 69,190,186, 95, 83, 79, 85, 82, 67, 69, 15,102,103,101,
+    116,112,201,186, 32,253,103,101,116,112,201,186,138,138,139, 24,
+    102,193,101,107, 40,190,210, 27, 64, 24, 27, 24,127, 24,253,193,
+    101,107,111, 40,190,210, 27, 95,111,102,102, 95,  3, 27, 24, 12,
+    137, 32, 13,171, 40, 95, 76, 65, 82, 71, 69,190, 95, 83, 79, 85,
+     82, 67, 69,185,124,124, 32, 13,171, 40, 95, 76, 65, 82, 71, 69,
+    190,186, 95, 83, 79, 85, 82, 67, 69, 41,137, 32, 95,190, 95, 79,
+     11, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,186, 15,102,
+    193,101,107,111, 32,253,193,101,107,111,186,130,108,193, 15,102,
+    193,101,107,111, 32,253,193,101,107,111,138,138,137, 37,247,229,
+    209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 10, 24,253,193,101,
+    107,111,186, 40,190,210, 27, 95,111,102,102,186, 95,  3, 27, 24,
+     12,137,163, 95, 76, 65, 82, 71, 69,190,186, 95, 83, 79, 85, 82,
+     67, 69, 15,102,193,101,107,111,186, 32,253,193,101,107,111,186,
+    138,138,139, 24,102,193,116,112,201, 40,190,210, 27,155, 95,111,
+    102,102, 95,  3, 42, 32, 12,137, 37,247,229,209,255,  8, 32, 62,
+     61,204,238, 57, 48, 49, 10, 24,253,193,116,112,201,186, 40,190,
+    210, 27,155, 95,111,102,102,186, 95,  3, 42, 32, 12,137, 32, 95,
+    190, 95, 79, 11, 83, 69, 84, 95, 66, 73, 84, 83, 32, 61, 61, 32,
+    186, 15,102,193,116,112,201, 32,253,193,116,112,201,186,138,137,
+    163, 95, 76, 65, 82, 71, 69,190,186, 95, 83, 79, 85, 82, 67, 69,
+     15,102,193,116,112,201,186, 32,253,193,116,112,201,186,138,138,
+    139, 64, 24,102,116,143,196,190,210,127, 95,111,102,102, 95,  3,
+    253,116,143,  9, 40,190,210, 12,137, 32, 13,171, 40, 95, 76, 65,
+     82, 71, 69,190, 95, 83, 79, 85, 82, 67, 69,185,124,124, 32, 13,
+    171, 40, 95, 76, 65, 82, 71, 69,190,186, 95, 83, 79, 85, 82, 67,
+     69, 41,137, 32, 95,190, 95, 79, 11, 83, 69, 84, 95, 66, 73, 84,
+     83, 32, 61, 61, 32,186, 15,102,116,143,  9, 32,253,116,143,  9,
+    186,130,108,193, 15,102,116,143,  9, 32,253,116,143,  9,138,138,
+    137, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 10,
+     95,111,102,102,186, 95,  3,253,116,143,  9,186, 40,190,210, 12,
+    137,163, 95, 76, 65, 82, 71, 69,190,186, 95, 83, 79, 85, 82, 67,
+     69, 15,102,116,143,  9,186, 32,253,116,143,  9,186,138,138,139,
+    150, 32,145,119,  1,100, 40,190,210,232, 17,150, 32, 99,222, 26,
+     23,114, 40,190,210,194, 15,102,101,111,144, 96,145, 97,109,242,
+     40, 96,145, 97,109, 41, 45, 62,  8,102,108,203, 32, 38, 32, 95,
+     73, 79, 69, 79, 70, 41,228,168,248, 10, 24, 40,102,101,111,102,
+     41, 40,190,210, 12,138,  6, 15,102, 23,114,195, 40, 96,145, 97,
+    109,242, 40, 96,145, 97,109, 41, 45, 62,  8,102,108,203, 32, 38,
+     32, 95, 73, 79,209, 82, 41,228,168,248, 10, 24, 40,102, 23,114,
+    195, 41, 40,190,210, 12,138,139,150, 32,112, 23,114,195, 40,191,
+    232,214,248, 10,125,233,138,208,  0,230,102,195, 99,157,116,235,
+     95,222,118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,
+    101,226,226,228,168, 96,100,108,105, 98, 95,104, 15,  8, 96,100,
+    108,105, 98, 95,104, 10,228,168,198,116,240, 14,  8,219, 49,  6,
+    189,234, 24,198,116,231,233,228,168,119, 36,206,  6,189, 24,119,
+     36,206,231,240, 14,  8,119, 36, 95,  3, 49,233,228,163, 78, 85,
+     76, 76,240, 14, 78, 85, 76, 76, 32, 48, 32,138, 17,189,164,117,
+    202,100,105,118, 95,  3,123, 32, 24,113,117,111,116, 27,145,109,
+    231,125, 32,100,105,118,252,139,189,164,117,202,108,100,105,118,
+     95,  3,123, 32, 64, 24,113,117,111,116, 27,145,109,231,125, 32,
+    108,100,105,118,252,  6,214,247,229,209,255,  8,137, 37,247,229,
+    209,255,  8, 32, 62, 61,204,238, 57, 48, 49, 10,189,164,117,202,
+    108,108,100,105,118, 95,  3,123, 32, 64, 64, 24,113,117,111,116,
+     27,145,109,231,125, 32,108,108,100,105,118,252,  6,138,233,214,
+     69, 88, 73, 84, 95, 70, 65, 73, 76, 85, 82, 69,240, 14, 69, 88,
+     73, 84, 95, 70, 65, 73, 76, 85, 82, 69, 37, 69, 88, 73, 84, 95,
+     70, 65, 73, 76, 85, 82, 69,  6,130,108,193,240, 14, 69, 88, 73,
+     84, 95, 70, 65, 73, 76, 85, 82, 69,204, 32,138, 15, 69, 88, 73,
+     84, 95, 83, 85, 67, 67, 69, 83, 83, 32, 48,139, 15, 82, 65, 78,
+     68,239, 55,133, 11, 70,  6, 15, 95, 65, 78,192, 95, 82, 65, 78,
+     68,239, 55,102,102,102, 32,  6, 15, 77, 66, 95, 67, 85, 82,207,
+    204,139,214,248, 15,249, 99,116, 15, 95, 78,111,145,116,117,114,
+    110, 10,183, 34, 67, 34, 32,123,130,108, 18, 32, 13,171, 40,  8,
+    247,229,209,255,  8,185, 38, 38, 37,247,229,209,255,  8, 32, 62,
+     61,204,238, 57, 48, 49, 15,249,202,  8,249, 99,116,130,108,193,
+     15,249, 99,116, 15, 95, 78,111,145,116,117,114,110,233, 25,251,
+    111,144,191,194, 24,251,111,105, 40,191,194, 64, 24,251,111,196,
+    191,232,214,247,229,209,255,  8,137, 37,247,229,209,255,  8, 32,
+     62, 61,204,238, 57, 48, 49, 10, 64, 64, 24,251,111,108,196,191,
+    232,138,138, 17, 25,164,116,111,100, 40,191,249,202, 44,  6,132,
+     42, 32,249,202,223,164,116,111,144,191,249,202, 44,  6,132, 42,
+     32,249,202,224,164,116,111,108,100, 40,191,249,202, 44,  6,132,
+     42, 32,249,202,194, 64, 24,164,116,111,196,191,249,202, 44,  6,
+    132, 42, 32,249,202, 27, 24,194,234, 64, 24,164,116, 16,196,191,
+    249,202, 44,  6,132, 42, 32,249,202, 27, 24,232,214,247,229,209,
+    255,  8,137, 37,247,229,209,255,  8, 32, 62, 61,204,238, 57, 48,
+     49, 10, 64, 64, 24,164,116,111,108,196,191,249,202, 44,  6,132,
+     42, 32,249,202, 27, 24,194,234, 64, 64, 24,164,116, 16,108,196,
+    191,249,202, 44,  6,132, 42, 32,249,202, 44,  6, 24,232,138,138,
+     17, 24,114, 97, 31,227,194,150, 32,115,114, 97, 31, 40,234, 24,
+    194, 24, 95, 65, 78,192, 95,114, 97, 31,227,194,150, 32, 95, 65,
+     78,192, 95,115,114, 97, 31, 40,234, 24,194,214,248,228,168,167,
+    108,  9, 99, 95,104, 15,  8,167,108,  9, 99, 95,104, 17,189,132,
+    167,108,  9, 99,252, 10,137, 37,248, 32, 62, 61, 32, 50, 48, 49,
+     55, 48, 51, 10,150, 22,179,105,166,171, 95,179,  9, 99, 40,219,
+     27,219, 12,233,132, 99,179,  9, 99, 40,219, 27,219,127,150, 32,
+    102,145,101,227,210,127,132,167,108,  9, 99, 40,219,127,132,145,
+    179,  9, 99,227,210, 27,219, 12,138,130,108,193,137, 37,247,229,
+    209,255,  8, 32, 62, 61, 32, 50, 48, 49, 49, 49, 50, 10,150, 22,
+    179,105,166,171, 95,179,  9, 99, 40,219, 27,219,232,233,150, 22,
+     99,179,  9, 99, 40,219, 27,219,194,150, 32,102,145,101,227,210,
+    194,150, 22,167,108,  9, 99, 40,219,194,150, 22,145,179,  9, 99,
+    227,210, 27,219,232,138, 17,150, 32, 95, 78,111,145,116,117,114,
+    110, 32, 97, 98,195,116,227,194, 24,251,154,105,116,227,146, 42,
+     32, 41,227, 41,194,150, 32, 95, 78,111,145,116,117,114,110, 32,
+    154,105,116,241,232,214,247,229,209,255,  8,137, 37,247,229,209,
+    255,  8, 32, 62, 61, 32, 50, 48, 49, 49, 49, 50, 10, 24,251, 95,
+    113,117,105, 99,107, 95,154,105,116,227,146, 42, 32, 41,227, 41,
+    194,150, 32, 95, 78,111,145,116,117,114,110, 32,113,117,105, 99,
+    107, 95,154,105,116,241,232,138,138, 17,150, 32, 95, 78,111,145,
+    116,117,114,110, 32, 95, 69,120,105,116,241,232, 17,132,103,101,
+    116,101,110,118, 40,191,194, 24,115,121, 96,101,109, 40,191,232,
+     17,150, 22, 98,193, 26, 28, 40,155,150,210, 27,155,150,210, 44,
+      6,219, 27,219, 44,  6, 24, 40, 42, 32, 41, 40,155,150, 22, 27,
+    155,150, 22, 41,194,150, 32,113,115,195,116,227,210, 27,219, 27,
+    219, 44,  6, 24, 40, 42, 32, 41, 40,155,150, 22, 27,155,150, 22,
+     41,232, 17, 24, 97, 98,115,241,194,100,105,118, 95,  3,100,105,
+    118,241, 27, 24,194, 64, 24,108, 97, 98,115, 40, 64, 24,194,108,
+    100,105,118, 95,  3,108,100,105,118, 40, 64, 24, 27, 64, 24,232,
+    214,247,229,209,255,  8,137, 37,247,229,209,255,  8, 32, 62, 61,
+    204,238, 57, 48, 49, 10, 64, 64, 24,108,108, 97, 98,115, 40, 64,
+     64, 24,194,108,108,100,105,118, 95,  3,108,108,100,105,118, 40,
+     64, 64, 24, 27, 64, 64, 24,232,138,233,228,168,248, 10, 15, 97,
+     98,115, 40,106,242,227,185,178,101,111,102,146, 97, 98,115, 41,
+     40,106, 41, 27,  8, 97, 98,115,146,174,242,106,236, 15,108, 97,
+     98,115, 40,106,242,227,185,178,101,111,102,146,108, 97, 98,115,
+     41, 40,106, 41, 27,  8, 97, 98,115,146, 64,174,242,106,236,138,
+    208, 24,109, 19,101,110, 40,191, 27,219,194, 24,109, 98,116,111,
+    119, 99, 40,119, 36, 95,  3, 42, 32,249,202, 27,191,249,202, 44,
+      6,219,194, 24,119, 99,116,111,109, 98, 40,169, 27,119, 36, 95,
+      3,232,208,219,109, 98, 96,111,119, 99,115, 40,119, 36, 95,  3,
+     42, 32,249,202, 27,191,249,202, 44,  6,219,194,219,119, 99, 96,
+    111,109, 98,115, 40,169,249,202, 27,155,119, 36, 95,  3, 42, 32,
+    249,202, 44,  6,219,232,214,248, 10,125,138,  2,181,163,249, 99,
+    116, 10,138,208,  0,230,102,195, 99,157,116,235, 95,222,118,143,
+    230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,101,226,226,228,
+    168,164,  1,103, 95,104, 15,  8,164,  1,103, 95,104, 10,228,168,
+    198,116, 15,  8,219, 49, 10,189,234, 24,198,116,231,233,228,163,
+     78, 85, 76, 76,240, 14, 78, 85, 76, 76, 32, 48,233,214,248, 15,
+    249, 99,116, 10,183, 34, 67, 34, 32,123,130,108, 18, 32, 13,171,
+     40,  8,247,229,209,255,  8,185, 38, 38, 37,247,229,209,255,  8,
+     32, 62, 61,204,238, 57, 48, 49, 15,249,202,  8,249, 99,116,130,
+    108,193, 15,249, 99,116,233,132,164, 99,112,121, 40,169,249,202,
+     27,191,249,202,194,132,164,110, 99,112,121, 40,169,249,202, 27,
+    191,249,202, 44,  6,219,232, 17,132,164, 99,251, 40,169,249,202,
+     27,191,249,202,194,132,164,110, 99,251, 40,169,249,202, 27,191,
+    249,202, 44,  6,219,232,226, 24,109,101,109, 99,109,112, 40,155,
+    150,210, 27,155,150,210, 27,219,194, 24,164, 99,109,112, 40,191,
+     27,191,194, 24,164,110, 99,109,112, 40,191, 27,191, 27,219,194,
+     24,164, 99,111,108,196,191, 27,191,232, 17,219,164,120,102,114,
+    109, 40,169,249,202, 27,191,249,202, 44,  6,219,232, 17,132,164,
+     28,114, 40,191, 27, 24,194,219,164, 99,115,112,110, 40,191, 27,
+    191,194,132,164,112, 98,114,107, 40,191, 27,191,194,132,164,114,
+     28,114, 40,191, 27, 24,194,219,164,115,112,110, 40,191, 27,191,
+    194,132,164,164, 40,191, 27,191,194,132,164,116,111,107, 40,169,
+    249,202, 27,191,249,202,232, 17,150, 22,109,101,109, 99,112,121,
+    227,210,249,202, 27,155,150,210,249,202, 44,  6,219,194,150, 22,
+    109,101,109,109,111,118,101,227,210, 27,155,150,210, 27,219,194,
+    150, 22,109,101,109, 28,114, 40,155,150,210, 27, 24, 27,219,194,
+    150, 22,109,101,109,193,116,227,210, 27, 24, 27,219,232, 17,132,
+    164, 23,114,195,241,194,219,164,222,110, 40,191,232,214,248, 10,
+    125,138,  2,181,163,249, 99,116, 10,138,208,  0,230,102,195, 99,
+    157,116,235, 95,222,118,143,230,  1, 99,159,  5, 95,135,108,121,
+     95,135, 99,101,226,226,228,168,116,105,109,157,104, 15,  8,116,
+    105,109,157,104, 10,228,168,198,116, 15,  8,219, 49, 10,189,234,
+     24,198,116,231,233,228,163, 78, 85, 76, 76,240, 14, 78, 85, 76,
+     76, 32, 48, 32,233,214, 67, 76, 75, 95, 84, 67, 75,240, 14, 67,
+     76, 79, 67, 75, 83, 95, 80,209, 95, 83, 69, 67, 37, 67, 76, 75,
+     95, 84, 67, 75, 32,130,108,193,240, 14, 67, 76, 79, 67, 75, 83,
+     95, 80,209, 95, 83, 69, 67,204, 48, 48, 32,  6,138, 17,189,234,
+     24, 99,  9, 99,107,206,231, 10,189,234, 24,116,105,109,157,116,
+    231, 17,164,117,202,116,109, 32,123,  6, 24,116,109, 95,193, 99,
+    231,  6, 24,116,109, 95,109,  1,231,  6, 24,116,109, 95,104, 16,
+    114,231,  6, 24,116,109, 95,109,100, 97,121,231,  6, 24,116,109,
+     95,109,135,231,  6, 24,116,109, 95,121,101, 26,231,  6, 24,116,
+    109, 95,119,100, 97,121,231,  6, 24,116,109, 95,121,100, 97,121,
+    231,  6, 24,116,109, 95,250,100, 96,231, 10,125, 59,139,214,248,
+     10,183, 34, 67, 34, 32,123,233, 99,  9, 99,107, 95,  3, 99,  9,
+     99,107,227,194, 25,100, 18,102,116,105,109,101, 40,116,105,109,
+    157,  3, 27,116,105,109,157,  3,194,116,105,109,157,  3,109,107,
+    116,105,109,101, 40,164,117,202,116,109,210,194,116,105,109,157,
+      3,116,105,109,101, 40,116,105,109,157,  3, 42, 32,232,137, 37,
+    247,229,209,255,  8, 32, 62, 61, 32, 50, 48, 49, 49, 49, 50, 10,
+    164,117,202,116,105,109,101,115,112,101, 99, 32,123,  6,116,105,
+    109,157,  3,116,118, 95,193, 99,231,  6, 64,116,118, 95,110,193,
+     99,231, 10,125, 59,  6, 15, 84, 73, 77, 69, 95, 85, 84, 67,204,
+    139, 24,116,105,109,101,115,112,101, 99, 95,103,101,116, 40,164,
+    117,202,116,105,109,101,115,112,101, 99, 22, 27, 24,232,233,132,
+    237, 99,116,105,109,101, 40,155,164,117,202,116,109,210,194,132,
+     99,116,105,109,101, 40,155,116,105,109,157,  3, 42, 32,194,164,
+    117,202,116,109, 22,103,109,116,105,109,101, 40,155,116,105,109,
+    157,  3, 42, 32,194,164,117,202,116,109, 22,  9, 99,179,116,105,
+    109,101, 40,155,116,105,109,157,  3, 42, 32,194,219,164,102,116,
+    105,109,101, 40,169, 27,219, 44,  6,191, 44,  6,155,164,117,202,
+    116,109,210,232,214,248, 10,125,233,138,208,  0,230,102,195, 99,
+    157,116,235, 95,222,118,143,230,  1, 99,159,  5, 95,135,108,121,
+     95,135, 99,101,208,228,168,162,104, 15,  8,162,104, 10,228,168,
+    198,116,240, 14,  8,219, 49,  6,189,234, 24,198,116,231,138, 17,
+    189,164,117,202,123,  6, 24,114, 91, 49, 48, 93,231, 10,125, 32,
+    165,115,119,105, 95,145,103,115, 59, 17,189,164,117,202,123,  6,
+     24,  9, 97,100, 27,154,101, 99,231,  6, 24, 96, 26,116, 27,101,
+     31,231, 10,125, 32,165,201,102,105,108,157, 98,  9, 99,107, 59,
+     17,189,164,117,202,123,  6,150,210,100,251, 97,112,116,114,231,
+      6, 24,110, 98,121,116,101,115, 27,102,105,222,112,116,114, 59,
+      6, 24, 98,117,102, 95,222,110,231,  6,169,119,105,108,100,253,
+    108,100,231, 10,125, 32,165,201,103, 98,112, 98, 95, 98,  9, 99,
+    107, 59, 17,189,164,117,202,123,  6, 24, 23,114,110,117,109,231,
+      6, 36, 32, 23,114,109,101,115,115, 91, 50, 53, 50, 93,231, 10,
+    125, 32,165,201, 23,114,195, 59, 17,189,164,117,202, 96, 97, 99,
+    107, 95, 28,181,107, 32,123,  6,234, 64,115, 99, 95,109, 26,107,
+    231,  6,164,117,202, 96, 97, 99,107, 95, 28,181,107, 22,115, 99,
+     95,110,170, 44, 22,115, 99, 95,112,145,118, 59,  6,234, 64,115,
+     99, 95,178,101, 59,  6, 24, 40, 42,115, 99, 95,  5,179,  9, 99,
+    251,101, 41, 40,127,125, 32,165, 96, 97, 99,107, 95, 28,181,107,
+     59, 10,214,248, 10,183, 34, 67, 34, 10,123,138, 17,183, 24,  8,
+    254,111,116, 95, 96, 97, 99,107, 95,178,101, 59,208,183, 24,165,
+      1,105,116,253,108,203,115, 59, 17, 15,165,156, 73, 84, 70, 76,
+     65, 71, 95, 85, 78, 83, 65, 70, 69, 95, 65, 84, 79, 77, 73, 67,
+     83, 32, 50, 32, 17,183,165, 96, 97, 99,107, 95, 28,181,107, 22,
+    165, 99,117,114,145,110,116, 95, 96, 97, 99,107, 95, 28,181,107,
+    227, 12, 17,183,150, 32,165,193,116,145,116,117,114,110, 99,111,
+      5, 40,234, 99,111,  5, 12, 17,183,150, 32,165,154,105,116, 40,
+    174, 12, 17,183,150, 32,165,114, 97,250,157, 23,114,195, 40,165,
+    201, 23,114,195, 22, 12,226,183,150, 32,165,154,105,116,116,114,
+     97,112,104, 97, 31,108, 23,227,127, 15,165, 72, 79,175, 95, 85,
+     78, 68, 69, 70,156, 69, 68, 32, 45, 49, 15,165, 66, 66, 67,158,
+     79, 83, 49, 95, 48, 32, 48, 15,165, 66, 66, 67,158, 79, 83, 49,
+     95, 50,204, 15,165, 66, 66, 67, 95, 65, 67, 87, 32, 50, 15,165,
+     66, 66, 67,197,175,209, 32, 51, 15,165, 66, 66, 67,197,175,209,
+     95, 69, 84, 32, 52, 15,165, 66, 66, 67,197,175,209, 95, 67, 79,
+     77, 80, 65, 67, 84, 32, 53, 15,165, 65, 82, 84, 72, 85, 82, 32,
+     54, 15,165, 83, 80, 82,156, 71, 66, 79, 65, 82, 68, 32, 55, 15,
+    165, 65, 95, 85, 78, 73, 88, 32, 56, 17,183, 24,165,104,111, 96,
+    201,227, 12,208,183, 24,165,102,112, 97,118, 97,105,108, 97, 19,
+    101,227, 12, 17, 15,165, 78,215, 88,200, 56, 48, 48, 48, 48, 48,
+     48, 48, 10,183,165,201, 23,114,195, 22,165,115,119,105,241,110,
+    111, 27,165,115,119,105, 95,145,103,115, 22,  1, 44,  6,165,115,
+    119,105, 95,145,103,115, 22, 16,116, 12,208,183,165,201, 23,114,
+    195, 22,165,115,119,105, 95, 99,241,110,111, 27,165,115,119,105,
+     95,145,103,115, 22,  1, 44,  6,165,115,119,105, 95,145,103,115,
+     22, 16,116, 27, 24, 42, 99, 26,114,121, 12,208,183,132,165, 99,
+    111,109,167, 31, 95,164,  1,103,227, 12,226, 15,165,209, 82, 79,
+     82,146, 45, 50, 41, 17,183, 24,165,201, 98,121,116,101,241,235,
+     27, 24,120, 27, 24,121, 12,208,183, 24,165,201,114,100, 28,227,
+     12,208,183, 24,165,201,119,114, 28,241, 28, 12,208,183, 24,165,
+    201, 98,103,101,116, 40,234,104, 97, 31,222, 12,208,183, 24,165,
+    201, 98,112,117,116,241, 28, 27,234,104, 97, 31,222, 12,208,183,
+     24,165,201,103, 98,112, 98,241,235, 27,234,104, 97, 31,222, 27,
+    165,201,103, 98,112, 98, 95, 98,  9, 99,107, 22,  1, 16,116, 12,
+     17,183, 24,165,201,119,195,100,241,235, 27, 24, 42,100,251, 97,
+     12,208,183, 24,165,201,102,  1,100,241,235, 27,132,110, 97,109,
+    101, 12,208,183, 24,165,201,102,105,222,241,235, 27,155,132,110,
+     97,109,101, 27,165,201,102,105,108,157, 98,  9, 99,107, 22,  1,
+     16,116, 12,208,183, 24,165,201, 26,103,115,241,235, 27,234,104,
+     97, 31,222, 27, 24, 26,103, 12,208,183, 24,165,201, 99,108,105,
+     40,155,132,115, 12,208,183,165,201, 23,114,195, 22,165,108, 97,
+     96, 95,201, 23,114,195,227, 12,208,183,165,201, 23,114,195, 22,
+    165,103,101,116,101,110,118, 40,155,132,110, 97,109,101, 27,132,
+     98,117,102,102, 23, 27,234,178,101, 12,208,183,165,201, 23,114,
+    195, 22,165,193,116,101,110,118, 40,155,132,110, 97,109,101, 27,
+    155,132,118, 97,159,101, 12,208,183, 24,165,115,121, 96,101,109,
+     40,155,132,164,  1,103, 27, 24, 28, 97,  1, 12,226,183,234,165,
+    179,  9, 99, 40,234,109,  1,119,195,100,115, 27,150, 22, 42, 98,
+      9, 99,107, 12,208,189,150, 32,102,145,101,184,111, 99,227, 22,
+    127,189,150,210,179,  9, 99,184,111, 99, 40,181,180,171, 12, 17,
+    183,150, 32,165,145,103,105, 96, 23, 95,179,  9, 99,115, 40,179,
+      9, 99,184,111, 99, 22,167,108,  9, 99, 27,102,145,101,184,111,
+     99, 22,102,145,101, 12,208,183,150, 22,  8,114,116, 95,179,  9,
+     99, 97,117,116,111, 40,181,180,171,127,183,150, 37,114,116,253,
+    145,101, 97,117,116,111,227, 22, 12,208,189, 24,165, 69,120,116,
+    101, 31, 80,254, 99,241, 27,150, 42, 42, 32,127,183,165, 69,120,
+    116,101, 31, 80,254, 99, 22,165,145,103,105, 96, 23, 95,115,  9,
+    116,170,101, 31, 40,165, 69,120,116,101, 31, 80,254, 99, 22,184,
+    111, 99, 12,208,183, 24,165,101,115, 99, 97,112,157,193,101,110,
+    227, 12,208,189,181,105,135, 32,123,  6,164,117,202,123, 24,115,
+     58, 49, 27,117, 58, 49, 54, 27,120, 58,204, 53,231,234,109,104,
+    105, 27,109,  9,231,125, 32,105, 59,  6, 24,119, 91, 51, 93,231,
+    125, 32, 95,170,101,110,  5,100,253,112, 95,110,117,109, 98, 23,
+     59, 17,189,164,117,202,123,  6, 24,114, 52, 27,114, 53, 27,114,
+     54, 27,114, 55, 27,114, 56, 27,114, 57, 59,  6, 24,102,112, 27,
+    115,112, 27,112, 99, 27,115,108, 59,  6, 95,170,101,110,  5,100,
+    253,112, 95,110,117,109, 98, 23, 32,102, 52, 27,102, 53, 27,102,
+     54, 27,102, 55,231,125, 32,165,181,119,  1,100, 98,  9, 99,107,
+     59, 17,183, 24,165,181,119,  1,100, 40,165,181,119,  1,100, 98,
+      9, 99,107, 22,  1, 16,116, 27,132, 42,108, 97, 30,117,203,101,
+     12,208,183,132,165,184,111, 99,110, 97,109,101,241,112, 99, 12,
+    208,183,132,165,108, 97, 30,117,203,101,241,112, 99, 12, 17,208,
+    183,234,165,117,100,105,118, 40,234,100,105,118,250,195, 27,234,
+    100,105,118,105,  5, 31,127,183,234,165,117,145,109, 40,234,100,
+    105,118,250,195, 27,234,100,105,118,105,  5, 31,127,183,234,165,
+    117,100,105,118, 49, 48, 40,234,100,105,118,105,  5, 31, 12, 17,
+    183, 24,165,115,100,105,118,241,100,105,118,250,195, 27, 24,100,
+    105,118,105,  5, 31,127,183, 24,165,115,145,109,241,100,105,118,
+    250,195, 27, 24,100,105,118,105,  5, 31,127,183, 24,165,115,100,
+    105,118, 49, 48,241,100,105,118,105,  5, 31, 12,226,189,101,110,
+    117,109, 32,123, 32, 78,111,116, 72, 97, 31,108,171, 27, 72, 97,
+     31,108,199,125, 32,165, 72, 97, 31,108,171, 79,114, 78,111,116,
+     59, 17,189,164,117,202,123,  6, 24,145,103,115, 32, 91, 49, 54,
+     93, 59, 10,125, 32,165,145,103,105, 96, 23,193,116, 59, 17,189,
+    164,117,202,123,  6, 24,145,103,115, 32, 91, 49, 48, 93, 59, 10,
+    125, 32,165,101,118,101,110,116,145,103,105, 96, 23,115, 59, 17,
+    189,150,146, 42, 80, 82, 79, 67,242,150,127,189,165, 72, 97, 31,
+    108,171, 79,114, 78,111,  3, 40, 42,165,116,114, 97,112,184,111,
+     99,242, 24, 99,111,  5, 27,165,145,103,105, 96, 23,193,  3, 42,
+    145,103,115,127,189,165, 72, 97, 31,108,171, 79,114, 78,111,  3,
+     40, 42,165,101,118,101,110,116,184,111, 99,242, 24, 99,111,  5,
+     27,165,145,103,105, 96, 23,193,  3, 42,145,103,115, 12, 17,189,
+    164,117,202,165,108, 97, 30,117,203,101,  5,115, 99,114,105,112,
+    116,105,135, 32,123,  6, 24,178,101, 59,  6, 24, 99,111,  5, 96,
+     26,116, 27, 99,111,  5,101, 31, 59,  6,132,110, 97,109,101, 59,
+      6, 80, 82, 79, 67,146, 42, 73,110,105,116, 80,254, 99, 41, 40,
+    155,164,117,202,165,108, 97, 30,117,203,101,  5,115, 99,114,105,
+    112,116,105,135, 22,232, 80, 82, 79, 67, 32, 70,  1,179,105,193,
+     80,254, 99, 59,  6,165,116,114, 97,112,184,111, 99, 32, 84,114,
+     97,112, 80,254, 99, 59,  6,165,116,114, 97,112,184,111, 99, 32,
+     85,110, 99, 97,117,103,104,116, 84,114, 97,112, 80,254, 99, 59,
+      6,165,101,118,101,110,116,184,111, 99, 32, 69,118,101,110,116,
+     80,254, 99, 59,  6,165,101,118,101,110,116,184,111, 99, 32, 85,
+    110,104, 97, 31,108,171, 69,118,101,110,116, 80,254, 99, 59,  6,
+    150,146, 42, 70, 97, 96, 69,118,101,110,116, 80,254, 99,242,165,
+    101,118,101,110,116,145,103,105, 96, 23,115, 22,232, 24, 40, 42,
+     85,110,119,  1,100, 80,254, 99,242,165,181,119,  1,100, 98,  9,
+     99,107, 22,  1, 16,116, 27,132, 42,108, 97, 30,117,203,101,232,
+    132,146, 42, 78, 97,109,101, 80,254, 99,242, 24,112, 99,232,150,
+     22, 99,116,195, 96, 26,116, 44, 22, 99,116,111,145, 31, 44, 22,
+    100,116,195, 96, 26,116, 44, 22,100,116,111,145, 31, 59,  6,150,
+    146, 42, 42, 99,116,195,118,101, 99, 96, 26,116, 41,227, 41, 27,
+     40, 42, 42, 99,116,195,118,101, 99,101, 31, 41,227,232,150,146,
+     42, 42,100,116,195,118,101, 99, 96, 26,116, 41,227, 41, 27, 40,
+     42, 42,100,116,195,118,101, 99,101, 31, 41,227,127,125, 32,165,
+    108, 97, 30,117,203,101,  5,115, 99,114,105,112,116,105,135, 59,
+     17,189, 24,165, 99, 99,184,111, 99, 40,174, 27,174, 27,174, 12,
+     17,183, 24,165, 99,179,108, 95, 99,108,105,101,110,116,241, 97,
+     49, 27, 24, 97, 50, 27, 24, 97, 51, 27,165, 99, 99,184,111, 99,
+     32, 99,179,222,101, 12,208,183, 24,165, 99,108,105,101,110,116,
+     95,250, 95,109,111,100,117,222,227, 12,208,183, 24,165,184,111,
+     99,101,115,115,195, 95,109,111,  5,227, 12, 17,183,150, 32,165,
+    105,114,113,115, 95,135,227, 12, 17,183,150, 32,165,105,114,113,
+    115, 95,111,102,144,150, 12, 17,183, 24,165,105,114,113,115, 95,
+    100,250, 97, 19,171,227, 12,208,183,150, 22,165, 82, 77, 65,179,
+      9, 99, 40,219,178,101, 12, 17,183,150, 22,165, 82, 77, 65,170,
+    101, 31,227, 22,112, 27,219,178,101, 12, 17,183,150, 32,165, 82,
+     77, 65,102,145,101,227, 22,112,127,214,248, 10,125,233,138, 17,
+      0,230,102,195, 99,157,116,235, 95,222,118,143,230,  1, 99,159,
+      5, 95,135,108,121, 95,135, 99,101, 17,208,228,168, 96,100,174,
+     95,104, 15,  8, 96,100,174, 95,104, 10,137, 37,247,229,209,255,
+      8, 32, 62, 61,204,238, 57, 48, 49,240, 14,  8, 96,100,174, 95,
+    108,108,138,208,189,205, 36, 32,174, 56,252, 10,189,234, 36, 32,
+    117,174, 56,252, 10,189,205,115,104,195,  3,174, 49, 54,252, 10,
+    189,234,115,104,195,  3,117,174, 49, 54,252, 10,189,205, 24,174,
+     51, 50,252, 10,189,234, 24,117,174, 51, 50,252,208,189,205, 36,
+     32,174, 95,222, 97, 96, 56,252, 10,189,234, 36, 32,117,174, 95,
+    222, 97, 96, 56,252, 10,189,205,115,104,195,  3,174, 95,222, 97,
+     96, 49, 54,252, 10,189,234,115,104,195,  3,117,174, 95,222, 97,
+     96, 49, 54,252, 10,189,205, 24,174, 95,222, 97, 96, 51, 50,252,
+     10,189,234, 24,117,174, 95,222, 97, 96, 51, 50,252,208,189,205,
+     24,174,253, 97, 96, 56,252, 10,189,234, 24,117,174,253, 97, 96,
+     56,252, 10,189,205, 24,174,253, 97, 96, 49, 54,252, 10,189,234,
+     24,117,174,253, 97, 96, 49, 54,252, 10,189,205, 24,174,253, 97,
+     96, 51, 50,252, 10,189,234, 24,117,174,253, 97, 96, 51, 50,252,
+    208,189,205, 24,174,112,116,114,252, 10,189,234, 24,117,174,112,
+    116,114,252, 10,214, 96,100,174, 95,108,108, 10,189,205, 64, 64,
+    174,186,252, 10,189,234, 64, 64,117,174,186,252, 10,189,205, 64,
+     64,174, 95,222, 97, 96,186,252, 10,189,234, 64, 64,117,174, 95,
+    222, 97, 96,186,252, 10,189,205, 64, 64,174,253, 97, 96,186,252,
+     10,189,234, 64, 64,117,174,253, 97, 96,186,252,208,189,205, 64,
+     64,174,167,120,252, 10,189,234, 64, 64,117,174,167,120,252,233,
+    137, 32, 33, 13,171, 40,  8,248,185,124,124, 32, 13,171, 40,  8,
+    247, 95, 76, 73, 77, 73, 84,197, 67, 82, 79, 83, 41, 10, 15,213,
+     56,158,156,146, 45,172, 56, 48, 41, 15,213, 56,239, 55, 70, 15,
+     85,213, 56,239, 11, 15,213, 49, 54,158,156,146, 45,172, 56, 48,
+     48, 48, 41, 15,213, 49, 54,239, 55, 11, 70, 15, 85,213, 49, 54,
+    239,133, 15,213, 51, 50,158,156,146,126,172, 55,133, 11, 70, 41,
+     15,213, 51, 50,239, 55,133, 11, 70, 15, 85,213, 51, 50,239,245,
+     10, 15,213, 95,173, 65,175, 56,158,156,146, 45,172, 56, 48, 41,
+     15,213, 95,173, 65,175, 56,239, 55, 70, 15, 85,213, 95,173, 65,
+    175, 56,239, 11, 15,213, 95,173, 65,175, 49, 54,158,156,146, 45,
+    172, 56, 48, 48, 48, 41, 15,213, 95,173, 65,175, 49, 54,239, 55,
+     11, 70, 15, 85,213, 95,173, 65,175, 49, 54,239,133, 15,213, 95,
+    173, 65,175, 51, 50,158,156,146,126,172, 55,133, 11, 70, 41, 15,
+    213, 95,173, 65,175, 51, 50,239, 55,133, 11, 70, 15, 85,213, 95,
+    173, 65,175, 51, 50,239,245, 10, 15,213, 95, 70, 65,175, 56,158,
+    156,146,126,172, 55,133, 11, 70, 41, 15,213, 95, 70, 65,175, 56,
+    239, 55,133, 11, 70, 15, 85,213, 95, 70, 65,175, 56,239,245, 15,
+    213, 95, 70, 65,175, 49, 54,158,156,146,126,172, 55,133, 11, 70,
+     41, 15,213, 95, 70, 65,175, 49, 54,239, 55,133, 11, 70, 15, 85,
+    213, 95, 70, 65,175, 49, 54,239,245, 15,213, 95, 70, 65,175, 51,
+     50,158,156,146,126,172, 55,133, 11, 70, 41, 15,213, 95, 70, 65,
+    175, 51, 50,239, 55,133, 11, 70, 15, 85,213, 95, 70, 65,175, 51,
+     50,239,245, 10, 15,213, 80, 84, 82,158,156,146,126,172, 55,133,
+     11, 70, 41, 15,213, 80, 84, 82,239, 55,133, 11, 70, 15, 85,213,
+     80, 84, 82,239,245, 10,214, 96,100,174, 95,108,108, 15,213,186,
+    158,156,146,126,172, 55,245,133, 11, 70, 41, 15,213,186,239, 55,
+    245,133, 11, 70, 15, 85,213,186,239,245,245, 15,213, 95,173, 65,
+    175,186,158,156,146,126,172, 55,245,133, 11, 70, 41, 15,213, 95,
+    173, 65,175,186,239, 55,245,133, 11, 70, 15, 85,213, 95,173, 65,
+    175,186,239,245,245, 15,213, 95, 70, 65,175,186,158,156,146,126,
+    172, 55,245,133, 11, 70, 41, 15,213, 95, 70, 65,175,186,239, 55,
+    245,133, 11, 70, 15, 85,213, 95, 70, 65,175,186,239,245,245, 10,
+     15,213, 77, 65, 88,158,156,146,126,172, 55,245,133, 11, 70, 41,
+     15,213, 77, 65, 88,239, 55,245,133, 11, 70, 15, 85,213, 77, 65,
+     88,239,245,245,233, 15, 80, 84, 82, 68, 73, 11,158,156,146,126,
+    172, 55,133, 11, 70, 41, 15, 80, 84, 82, 68, 73, 11,239, 55,133,
+     11, 70, 10, 15,192, 71, 95, 65, 84, 79, 77, 73, 67,158,156,146,
+    126,172, 55,133, 11, 70, 41, 15,192, 71, 95, 65, 84, 79, 77, 73,
+     67,239, 55,133, 11, 70, 10, 15,192, 90, 69,239,245, 10, 15, 87,
+     67, 72, 65, 82,158,156,146,126,172, 55,133, 11, 70, 41, 15, 87,
+     67, 72, 65, 82,239, 55,133, 11, 70, 10,233,137, 32, 33, 13,171,
+     40,  8,248,185,124,124, 32, 13,171, 40,  8,247, 95, 67,215,175,
+     65, 78, 84,197, 67, 82, 79, 83, 41, 10, 15,213, 56, 95, 67, 40,
+    110,185,110, 15, 85,213, 56, 95, 67, 40,110,185,110, 35, 35,117,
+     15,213, 49, 54, 95, 67, 40,110,185,110, 15, 85,213, 49, 54, 95,
+     67, 40,110,185,110, 35, 35,117, 15,213, 51, 50, 95, 67, 40,110,
+    185,110, 15, 85,213, 51, 50, 95, 67, 40,110,185,110, 35, 35,117,
+    214, 96,100,174, 95,108,108, 15,213,186, 95, 67, 40,110,185,110,
+     35, 35,108,108, 15, 85,213,186, 95, 67, 40,110,185,110, 35, 35,
+    117,108,108, 10, 15,213, 77, 65, 88, 95, 67, 40,110,185,110, 35,
+     35,108,108, 15, 85,213, 77, 65, 88, 95, 67, 40,110,185,110, 35,
+     35,117,108,108,233,233,138,208,  0,230,102,195, 99,157,116,235,
+     95,222,118,143,230,  1, 99,159,  5, 95,135,108,121, 95,135, 99,
+    101,226,189,132,118, 97, 95,108,105, 96, 59, 15,118, 97, 95,100,
+     99,108, 32, 24,118, 97, 95,179,105, 96, 59, 15,118, 97, 95, 96,
+     26,116, 40,108,105, 96,185,108,105,151, 61,146,132,185, 38,118,
+     97, 95,179,105, 96, 15,118, 97, 95,101, 31, 40,108,105, 96, 41,
+     15,118, 97, 95, 26,103, 40,108,105, 96, 44,109,111,  5,242, 40,
+    109,111,100,  4, 42, 41, 40,108,105,151, 43, 61, 32,178,101,111,
+    144,109,111,  5,236, 41, 91, 45, 49, 93, 10,  0};
+
+#define HDRSTACKDEPTH  5
+
+/* end of build/derived/riscos/arm/headers.c */
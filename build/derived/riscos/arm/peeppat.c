@@ -0,0 +1,5693 @@
+static RProc * const rprocs[] = {
+  0
+};
+
+typedef int32 propproc(const PendingOp *const p);
+static propproc * const peepprops[] = {
+ a_loads_r1,
+ a_uses_r1,
+ a_uses_r2,
+ a_uses_r3,
+ a_uses_r4,
+ a_loads_r2
+};
+#define p_loads_r1 0
+#define p_uses_r1 1
+#define p_uses_r2 2
+#define p_uses_r3 3
+#define p_uses_r4 4
+#define p_loads_r2 5
+#define fb_(a, b) ((((int32)(a))<<8) | (b))
+#define fh_(a, b) ((((int32)(a))<<16) | (b))
+static const int32 peepsets[] = {
+  /*  0*/0,
+  /*  1*/(P_SETCC+P_RSHIFT),
+  /*  2*/P_SETCC,
+  /*  3*/J_CMPK,
+  /*  4*/~Q_MASK,
+  /*  5*/~(J_SIGNED+J_UNSIGNED+J_ALIGN4),
+  /*  6*/J_MOVC,
+  /*  7*/J_CLRC,
+  /*  8*/J_PUSHC,
+  /*  9*/J_CALLR,
+  /* 10*/J_MULR,
+  /* 11*/J_MLAR,
+  /* 12*/J_MULL,
+  /* 13*/J_MLAL,
+  /* 14*/P_CMPZ,
+  /* 15*/J_MOVC,
+  /* 16*/J_CLRC,
+  /* 17*/J_PUSHC,
+  /* 18*/J_CALLR,
+  /* 19*/J_MULL,
+  /* 20*/J_MLAL,
+  /* 21*/J_MOVC,
+  /* 22*/J_CLRC,
+  /* 23*/J_PUSHC,
+  /* 24*/J_CALLR,
+  /* 25*/J_MULR,
+  /* 26*/J_MLAR,
+  /* 27*/J_MULL+J_SIGNED,
+  /* 28*/J_MULL,
+  /* 29*/J_MLAL,
+  /* 30*/J_MOVC,
+  /* 31*/J_CLRC,
+  /* 32*/J_PUSHC,
+  /* 33*/J_CALLR,
+  /* 34*/J_MULL+J_SIGNED,
+  /* 35*/J_MULL,
+  /* 36*/J_MLAL,
+  /* 37*/J_MOVC+J_ALIGN4,
+  /* 38*/J_PUSHC+J_ALIGN4,
+  /* 39*/J_MOVC+J_ALIGN4,
+  /* 40*/J_CLRC+J_ALIGN4,
+  /* 41*/J_MOVK,
+  /* 42*/J_MOVR,
+  /* 43*/J_ADDK,
+  /* 44*/J_ADDR,
+  /* 45*/J_SUBR,
+  /* 46*/(P_PRE+P_POST+P_CMPZ),
+  /* 47*/J_MULR,
+  /* 48*/J_MLAR,
+  /* 49*/J_LDMW,
+  /* 50*/(P_RSHIFT+P_SETCC),
+  /* 51*/J_TAILCALLK,
+  /* 52*/J_TAILCALLR,
+  /* 53*/P_RSHIFT,
+  /* 54*/J_NOTR,
+  /* 55*/J_TABLE_BITS,
+  /* 56*/~P_RSHIFT,
+  /* 57*/J_CMPK+Q_EQ,
+  /* 58*/J_CMPK+Q_NE,
+  /* 59*/J_CMPK+Q_UEQ,
+  /* 60*/J_CMPK+Q_UNE,
+  /* 61*/~(J_SHIFTMASK+J_SIGNED+J_UNSIGNED),
+  /* 62*/J_MOVR,
+  /* 63*/J_NEGR,
+  /* 64*/J_NOTR,
+  /* 65*/J_ADDK,
+  /* 66*/J_ADDR,
+  /* 67*/J_SUBK,
+  /* 68*/J_SUBR,
+  /* 69*/J_RSBK,
+  /* 70*/J_RSBR,
+  /* 71*/J_ANDK,
+  /* 72*/J_ANDR,
+  /* 73*/J_BICR,
+  /* 74*/J_ORRK,
+  /* 75*/J_ORRR,
+  /* 76*/J_EORK,
+  /* 77*/J_EORR,
+  /* 78*/J_SHLR,
+  /* 79*/J_SHLK,
+  /* 80*/J_SHRR,
+  /* 81*/J_SHRK,
+  /* 82*/J_RORR,
+  /* 83*/J_RORK,
+  /* 84*/J_ADCR,
+  /* 85*/J_ADCK,
+  /* 86*/J_SBCR,
+  /* 87*/J_SBCK,
+  /* 88*/J_RSCR,
+  /* 89*/J_RSCK,
+  /* 90*/J_MULR,
+  /* 91*/J_MULK,
+  /* 92*/J_MLAR,
+  /* 93*/J_CMPK,
+  /* 94*/J_CMPR,
+  /* 95*/J_CMPFK,
+  /* 96*/J_CMPFR,
+  /* 97*/J_CMPDK,
+  /* 98*/J_CMPDR,
+  /* 99*/~(J_SIGNED+J_UNSIGNED+J_NEGINDEX+J_SHIFTMASK+J_ALIGNMENT),
+  /*100*/J_LDRFR,
+  /*101*/J_LDRDR,
+  /*102*/J_STRFR,
+  /*103*/J_STRDR,
+  /*104*/J_LDRBR,
+  /*105*/J_LDRWR,
+  /*106*/J_LDRR,
+  /*107*/J_STRBR,
+  /*108*/J_STRR,
+  /*109*/J_LDRFK+J_ALIGN4,
+  /*110*/J_LDRDK+J_ALIGN4,
+  /*111*/J_LDRDK+J_ALIGN8,
+  /*112*/J_STRFK+J_ALIGN4,
+  /*113*/J_STRDK+J_ALIGN4,
+  /*114*/J_STRDK+J_ALIGN8,
+  /*115*/~(J_SIGNED+J_UNSIGNED),
+  /*116*/J_STRBK+J_ALIGN1,
+  /*117*/J_LDRBK+J_ALIGN1,
+  /*118*/J_LDRWK+J_ALIGN2,
+  /*119*/J_STRWK+J_ALIGN2,
+  /*120*/J_LDRK+J_ALIGN4,
+  /*121*/J_STRK+J_ALIGN4,
+  /*122*/~(J_SIGNED+J_UNSIGNED+J_ALIGNMENT),
+  /*123*/J_LDRBK,
+  /*124*/J_LDRWK,
+  /*125*/J_LDRK,
+  /*126*/J_STRBK,
+  /*127*/J_STRWK,
+  /*128*/J_STRK,
+  /*129*/P_PRE+P_POST+P_MS,
+  /*130*/P_POST,
+  /*131*/~(J_SIGNED+J_UNSIGNED+J_NEGINDEX+J_ALIGNMENT),
+  /*132*/J_LDRBK,
+  /*133*/J_LDRBR,
+  /*134*/J_ADDR,
+  /*135*/J_ADCR,
+  /*136*/J_SUBR,
+  /*137*/J_SBCR,
+  /*138*/J_RSBR,
+  /*139*/J_RSCR,
+  /*140*/J_ANDR,
+  /*141*/J_ORRR,
+  /*142*/J_EORR,
+  /*143*/J_CMPR,
+  /*144*/J_SHLR,
+  /*145*/J_SHRR,
+  /*146*/J_RORR,
+  /*147*/J_ADDR,
+  /*148*/J_ADCR,
+  /*149*/J_ANDR,
+  /*150*/J_ORRR,
+  /*151*/J_EORR,
+  /*152*/J_CMPR+Q_EQ,
+  /*153*/J_CMPR+Q_NE,
+  /*154*/J_CMPR+Q_LT,
+  /*155*/J_CMPR+Q_GE,
+  /*156*/J_CMPR+Q_LE,
+  /*157*/J_CMPR+Q_GT,
+  /*158*/J_CMPR+Q_LO,
+  /*159*/J_CMPR+Q_HS,
+  /*160*/J_CMPR+Q_LS,
+  /*161*/J_CMPR+Q_HI,
+  /*162*/J_SHLK,
+  /*163*/J_SHRK,
+  /*164*/J_RORK,
+  /*165*/~J_BASEALIGN4,
+  /*166*/J_ADCON,
+  /*167*/J_STRING,
+  /*168*/J_LDRR+J_ALIGN4,
+  /*169*/~(J_SIGNED+J_UNSIGNED+J_NEGINDEX+J_SHIFTMASK),
+  /*170*/J_ANDR+J_SHIFTR,
+  /*171*/~(J_SHIFTVAL+J_SHIFTA),
+  /*172*/~J_SHIFTVAL,
+  /*173*/J_CMPR+J_SHIFTR+J_SHIFTA+Q_EQ,
+  /*174*/J_CMPR+J_SHIFTR+J_SHIFTA+Q_NE,
+  /*175*/~J_SHIFTMASK,
+  /*176*/J_B+Q_LT,
+  /*177*/J_CONDEXEC+Q_LT,
+  /*178*/J_B+Q_GE,
+  /*179*/J_CONDEXEC+Q_GE,
+  /*180*/J_CMPK+Q_LT,
+  /*181*/J_CMPK+Q_GE,
+  /*182*/J_MOVR,
+  /*183*/J_NEGR,
+  /*184*/J_NOTR,
+  /*185*/J_ADDK,
+  /*186*/J_ADDR,
+  /*187*/J_SUBK,
+  /*188*/J_SUBR,
+  /*189*/J_RSBK,
+  /*190*/J_RSBR,
+  /*191*/J_ANDK,
+  /*192*/J_ANDR,
+  /*193*/J_BICR,
+  /*194*/J_ORRK,
+  /*195*/J_ORRR,
+  /*196*/J_EORK,
+  /*197*/J_EORR,
+  /*198*/J_SHLR,
+  /*199*/J_SHLK,
+  /*200*/J_SHRR,
+  /*201*/J_SHRK,
+  /*202*/J_RORR,
+  /*203*/J_RORK,
+  /*204*/J_ADCK,
+  /*205*/J_ADCR,
+  /*206*/J_SBCK,
+  /*207*/J_SBCR,
+  /*208*/J_RSCK,
+  /*209*/J_RSCR,
+  /*210*/J_MULR,
+  /*211*/J_MULK,
+  /*212*/J_MLAR,
+  /*213*/J_ADDK,
+  /*214*/J_SUBK,
+  /*215*/J_RSBK,
+  /*216*/J_ANDK,
+  /*217*/J_ORRK,
+  /*218*/J_EORK,
+  /*219*/~J_ALIGNMENT,
+  /*220*/(P_PRE+P_POST),
+  /*221*/J_STRK,
+  /*222*/J_LDRK,
+  /*223*/P_PRE,
+  /*224*/J_ADDR,
+  /*225*/J_ADCR,
+  /*226*/J_SUBR,
+  /*227*/J_SBCR,
+  /*228*/J_RSBR,
+  /*229*/J_RSCR,
+  /*230*/J_ANDR,
+  /*231*/J_BICR,
+  /*232*/J_ORRR,
+  /*233*/J_EORR,
+  /*234*/J_CMPR,
+  /*235*/J_ADDR,
+  /*236*/J_ADCR,
+  /*237*/J_ANDR,
+  /*238*/J_BICR,
+  /*239*/J_ORRR,
+  /*240*/J_EORR,
+  /*241*/J_CMPR+Q_EQ,
+  /*242*/J_CMPR+Q_NE,
+  /*243*/P_BASEALIGNED,
+  /*244*/J_LDRBK+J_SIGNED,
+  /*245*/J_LDRWK+J_SIGNED+J_ALIGN2,
+  /*246*/J_LDRWR+J_SIGNED+J_ALIGN2,
+  /*247*/J_LDRWK+J_UNSIGNED+J_ALIGN2,
+  /*248*/J_LDRWR+J_UNSIGNED+J_ALIGN2,
+  /*249*/P_MS,
+  /*250*/J_LDRBK+J_SIGNED+J_ALIGN1,
+  /*251*/J_LDRBR+J_SIGNED+J_ALIGN1,
+  /*252*/J_LDRR+J_ALIGN4,
+  /*253*/J_STRR+J_ALIGN4,
+  /*254*/J_LDRBR+J_ALIGN4,
+  /*255*/J_STRBR+J_ALIGN4,
+  /*256*/J_STRK,
+  /*257*/J_STRR,
+  /*258*/J_STRBK,
+  /*259*/J_STRBR,
+  /*260*/~(J_SHIFTMASK+J_NEGINDEX),
+  /*261*/J_ADDR,
+  /*262*/J_SUBR,
+  /*263*/J_LDRR+J_ALIGN4,
+  /*264*/J_LDRWR+J_ALIGN2,
+  /*265*/J_LDRBR+J_ALIGN1,
+  /*266*/~(J_SHIFTVAL+J_UNSIGNED),
+  /*267*/J_CMPR+J_SHIFTR+Q_EQ,
+  /*268*/J_CMPR+J_SHIFTR+Q_NE,
+  /*269*/J_CONDEXEC+Q_EQ,
+  /*270*/J_CONDEXEC+Q_UEQ,
+  /*271*/J_CMPK+Q_EQ,
+  /*272*/J_CMPK+Q_UEQ,
+  /*273*/J_LDRK+J_ALIGN4,
+  /*274*/J_STRK+J_ALIGN4,
+  /*275*/J_STRBK+J_ALIGN1,
+  /*276*/J_LDRWK+J_ALIGN2,
+  /*277*/J_LDRBK+J_ALIGN1,
+  /*278*/J_LDRK+J_ALIGN1,
+  /*279*/J_STRK+J_ALIGN1,
+  /*280*/J_STRBK+J_ALIGN1,
+  /*281*/J_LDRBK+J_ALIGN1,
+  /*282*/J_LDRK+J_ALIGN4,
+  /*283*/J_STRK+J_ALIGN4,
+  /*284*/P_PRE+P_POST,
+  /*285*/J_LDRBK+J_UNSIGNED,
+  /*286*/J_STRBK,
+  /*287*/J_LDRBK+J_SIGNED,
+  /*288*/J_STRBK+J_ALIGN1,
+  /*289*/J_STRBR+J_ALIGN1,
+  /*290*/J_CMPR+Q_EQ,
+  /*291*/J_CMPR+Q_NE,
+  /*292*/J_CMPR+Q_HI,
+  /*293*/J_CMPR+Q_LS,
+  /*294*/J_CMPR+Q_LO,
+  /*295*/J_CMPR+Q_HS,
+  /*296*/J_CMPR+Q_EQ,
+  /*297*/J_CMPR+Q_NE,
+  /*298*/J_CMPR+Q_LE,
+  /*299*/J_CMPR+Q_LT,
+  /*300*/J_CMPR+Q_GE,
+  /*301*/J_CMPR+Q_GT,
+  /*302*/J_ADDR,
+  /*303*/J_SUBR,
+  /*304*/J_RSBR,
+  /*305*/J_ANDR,
+  /*306*/J_ORRR,
+  /*307*/J_EORR,
+  /*308*/J_CMPR,
+  /*309*/J_ADDR,
+  /*310*/J_ANDR,
+  /*311*/J_ORRR,
+  /*312*/J_EORR,
+  /*313*/J_ADDR,
+  /*314*/J_ANDR,
+  /*315*/J_ORRR,
+  /*316*/J_EORR,
+  /*317*/J_CMPR+Q_EQ,
+  /*318*/J_CMPR+Q_NE,
+  /*319*/J_B,
+  /*320*/J_CONDEXEC,
+  /*321*/~(J_SHIFTMASK|Q_MASK),
+  /*322*/P_UNSIGNEDCOND,
+  /*323*/P_SWAPPEDOPS,
+  /*324*/P_SWAPCOND,
+  /*325*/J_CONDEXEC+Q_NE,
+  /*326*/J_CONDEXEC+Q_UNE,
+  /*327*/J_CMPR+Q_EQ,
+  /*328*/J_CMPR+Q_UEQ,
+  /*329*/J_ADDK,
+  /*330*/J_RSBK,
+  /*331*/J_ANDK,
+  /*332*/J_ORRK,
+  /*333*/J_EORK,
+  /*334*/~(J_SHIFTMASK+Q_MASK),
+  /*335*/J_SHIFTMASK,
+  /*336*/J_LDRWK+J_ALIGN2,
+  /*337*/J_LDRWR+J_ALIGN2,
+  /*338*/~J_UNSIGNED,
+  /*339*/J_CALLK,
+  /*340*/J_TAILCALLK,
+  /*341*/J_ADCON,
+  /*342*/J_ADCONV,
+  /*343*/J_ADCOND,
+  /*344*/J_CONDEXEC,
+  /*345*/J_B,
+  /*346*/J_CMPK+Q_LO,
+  /*347*/J_CMPK+Q_HS,
+  /*348*/J_ADDR,
+  /*349*/J_ADDK,
+  /*350*/(P_SETCC+P_CMPZ),
+  /*351*/~(P_CMPZ+P_SETCC),
+  /*352*/J_B+Q_HI,
+  /*353*/J_CONDEXEC+Q_HI,
+  /*354*/J_B+Q_LS,
+  /*355*/J_CONDEXEC+Q_LS,
+  /*356*/J_CMPK+Q_HI,
+  /*357*/J_CMPK+Q_LS,
+  /*358*/J_B+Q_EQ,
+  /*359*/J_B+Q_UEQ,
+  /*360*/J_CONDEXEC+Q_EQ,
+  /*361*/J_CONDEXEC+Q_UEQ,
+  /*362*/J_B+Q_NE,
+  /*363*/J_B+Q_UNE,
+  /*364*/J_CONDEXEC+Q_NE,
+  /*365*/J_CONDEXEC+Q_UNE,
+  /*366*/J_B+Q_AL,
+  /*367*/J_CONDEXEC+Q_AL,
+  0
+};
+static const PeepOpDef peepsubs[] = {
+  /*  0*/{pot_op, 0, 0, 0, J_ADDR},
+  /*  1*/{pot_peep_m, 0, 0, 0, fh_(1, 0)},
+  /*  2*/{pot_op, 0, 0, 0, J_ADDK},
+  /*  3*/{pot_peep_m, 0, 0, 0, fh_(2, 0)},
+  /*  4*/{pot_op, 0, 0, 0, J_MOVR},
+  /*  5*/{pot_peep, 0, 0, 0, 0},
+  /*  6*/{pot_prop, 0, 0, 0, p_loads_r1},
+  /*  7*/{pot_opinset_m, 0, 0, 8, fh_(5, 6)},
+  /*  8*/{pot_prop, 0, 0, 0, p_uses_r1},
+  /*  9*/{pot_or, 0, 0, 0, fh_(6, 7)},
+  /* 10*/{pot_peep_m, 0, 0, 0, fh_(14, 0)},
+  /* 11*/{pot_prop, 0, 0, 0, p_loads_r2},
+  /* 12*/{pot_prop, 0, 0, 0, p_uses_r2},
+  /* 13*/{pot_or, 0, 0, 0, fh_(11, 7)},
+  /* 14*/{pot_prop, 0, 0, 0, p_uses_r3},
+  /* 15*/{pot_prop, 0, 0, 0, p_uses_r4},
+  /* 16*/{pot_opinset_m, 0, 0, 6, fh_(5, 15)},
+  /* 17*/{pot_opinset_m, 0, 0, 9, fh_(5, 21)},
+  /* 18*/{pot_or, 0, 0, 0, fh_(11, 17)},
+  /* 19*/{pot_opinset_m, 0, 0, 7, fh_(5, 30)},
+  /* 20*/{pot_opinset, 0, 0, 5, fh_(0, 41)},
+  /* 21*/{pot_peep_m, 0, 0, 0, fh_(46, 0)},
+  /* 22*/{pot_opinset, 0, 0, 3, fh_(0, 47)},
+  /* 23*/{pot_peep_m, 0, 0, 0, fh_(50, 0)},
+  /* 24*/{pot_op, 0, 0, 0, J_MULR},
+  /* 25*/{pot_op, 0, 0, 0, J_ANDR},
+  /* 26*/{pot_peep_m, 0, 0, 0, fh_(53, 0)},
+  /* 27*/{pot_op_m, 0, 0, 0, fh_(55, 54)},
+  /* 28*/{pot_peep_m, 0, 0, 0, fh_(56, 0)},
+  /* 29*/{pot_op, 0, 0, 0, J_NOTR},
+  /* 30*/{pot_andnot, 0, 0, 0, fh_(28, 5)},
+  /* 31*/{pot_opinset_m, 0, 0, 31, fh_(61, 62)},
+  /* 32*/{pot_op, 0, 0, 0, J_ORRK},
+  /* 33*/{pot_op, 0, 0, 0, J_ANDK},
+  /* 34*/{pot_op, 0, 0, 0, J_EORK},
+  /* 35*/{pot_op, 0, 0, 0, J_SUBR},
+  /* 36*/{pot_op, 0, 0, 0, J_MOVK},
+  /* 37*/{pot_opinset_m, 0, 0, 6, fh_(115, 116)},
+  /* 38*/{pot_peep_m, 0, 0, 0, fh_(129, 0)},
+  /* 39*/{pot_peep_m, 0, 0, 0, fh_(130, 0)},
+  /* 40*/{pot_opinset, 0, 0, 6, fh_(0, 109)},
+  /* 41*/{pot_peep, 0, 0, 0, P_POST},
+  /* 42*/{pot_op, 0, 0, 0, J_MOVC+J_ALIGN4},
+  /* 43*/{pot_opinset, 0, 0, 2, fh_(0, 110)},
+  /* 44*/{pot_opinset_m, 0, 0, 10, fh_(4, 134)},
+  /* 45*/{pot_opinset_m, 0, 0, 3, fh_(115, 144)},
+  /* 46*/{pot_opinset, 0, 0, 7, fh_(0, 147)},
+  /* 47*/{pot_opinset, 0, 0, 4, fh_(0, 136)},
+  /* 48*/{pot_opinset, 0, 0, 8, fh_(0, 154)},
+  /* 49*/{pot_opinset_m, 0, 0, 3, fh_(115, 162)},
+  /* 50*/{pot_op_m, 0, 0, 0, fh_(115, 120)},
+  /* 51*/{pot_op_m, 0, 0, 0, fh_(169, 168)},
+  /* 52*/{pot_op_m, 0, 0, 0, fh_(171, 170)},
+  /* 53*/{pot_andnot, 0, 0, 0, fh_(3, 10)},
+  /* 54*/{pot_op_m, 0, 0, 0, fh_(115, 79)},
+  /* 55*/{pot_opinset_m, 0, 0, 31, fh_(61, 182)},
+  /* 56*/{pot_opinset, 0, 0, 6, fh_(0, 213)},
+  /* 57*/{pot_op_m, 0, 0, 0, fh_(219, 125)},
+  /* 58*/{pot_peep_m, 0, 0, 0, fh_(220, 0)},
+  /* 59*/{pot_opinset_m, 0, 0, 2, fh_(219, 221)},
+  /* 60*/{pot_peep_m, 0, 0, 0, fh_(220, 223)},
+  /* 61*/{pot_opinset_m, 0, 0, 11, fh_(4, 224)},
+  /* 62*/{pot_op, 0, 0, 0, J_MULK},
+  /* 63*/{pot_opinset, 0, 0, 8, fh_(0, 235)},
+  /* 64*/{pot_op_m, 0, 0, 0, fh_(122, 124)},
+  /* 65*/{pot_peep_m, 0, 0, 0, fh_(243, 0)},
+  /* 66*/{pot_op_m, 0, 0, 0, fh_(219, 244)},
+  /* 67*/{pot_opinset, 0, 0, 4, fh_(0, 245)},
+  /* 68*/{pot_peep_m, 0, 0, 0, fh_(249, 0)},
+  /* 69*/{pot_opinset, 0, 0, 2, fh_(0, 250)},
+  /* 70*/{pot_op, 0, 0, 0, J_SHRK+J_UNSIGNED},
+  /* 71*/{pot_opinset_m, 0, 0, 5, fh_(260, 261)},
+  /* 72*/{pot_op_m, 0, 0, 0, fh_(172, 170)},
+  /* 73*/{pot_op, 0, 0, 0, J_LDRK+J_ALIGN4},
+  /* 74*/{pot_op, 0, 0, 0, J_STRDK+J_ALIGN4},
+  /* 75*/{pot_op_m, 0, 0, 0, fh_(115, 81)},
+  /* 76*/{pot_opinset_m, 0, 0, 4, fh_(115, 280)},
+  /* 77*/{pot_peep_m, 0, 0, 0, fh_(284, 0)},
+  /* 78*/{pot_op_m, 0, 0, 0, fh_(219, 285)},
+  /* 79*/{pot_opinset_m, 0, 0, 2, fh_(219, 286)},
+  /* 80*/{pot_opinset, 0, 0, 6, fh_(0, 290)},
+  /* 81*/{pot_opinset, 0, 0, 4, fh_(0, 154)},
+  /* 82*/{pot_opinset, 0, 0, 6, fh_(0, 296)},
+  /* 83*/{pot_opinset, 0, 0, 4, fh_(0, 292)},
+  /* 84*/{pot_opinset_m, 0, 0, 7, fh_(4, 302)},
+  /* 85*/{pot_opinset, 0, 0, 4, fh_(0, 309)},
+  /* 86*/{pot_opinset, 0, 0, 2, fh_(0, 303)},
+  /* 87*/{pot_opinset, 0, 0, 6, fh_(0, 313)},
+  /* 88*/{pot_op_m, 0, 0, 0, fh_(321, 94)},
+  /* 89*/{pot_peep_m, 0, 0, 0, fh_(322, 0)},
+  /* 90*/{pot_opinset_m, 0, 0, 2, fh_(4, 319)},
+  /* 91*/{pot_peep_m, 0, 0, 0, fh_(323, 0)},
+  /* 92*/{pot_peep_m, 0, 0, 0, fh_(324, 0)},
+  /* 93*/{pot_opinset, 0, 0, 4, fh_(0, 230)},
+  /* 94*/{pot_and, 0, 0, 0, fh_(12, 14)},
+  /* 95*/{pot_op, 0, 0, 0, J_LDRWK+J_ALIGN2},
+  /* 96*/{pot_opinset, 0, 0, 5, fh_(0, 329)},
+  /* 97*/{pot_andnot, 0, 0, 0, fh_(12, 14)},
+  /* 98*/{pot_opinset_m, 0, 0, 7, fh_(334, 302)},
+  /* 99*/{pot_op_m, 0, 0, 0, fh_(335, 54)},
+  /*100*/{pot_opinset, 0, 0, 2, fh_(0, 336)},
+  /*101*/{pot_op, 0, 0, 0, J_MOVDK},
+  /*102*/{pot_opinset, 0, 0, 2, fh_(0, 348)},
+  /*103*/{pot_peep_m, 0, 0, 0, fh_(350, 0)},
+  /*104*/{pot_op, 0, 0, 0, J_CMPK+Q_NE},
+  /*105*/{pot_peep_m, 0, 0, 0, fh_(351, 0)},
+  /*106*/{pot_op, 0, 0, 0, J_CMPK+Q_EQ},
+  /*107*/{pot_peep_m, 0, 0, 0, fh_(14, 14)}
+};
+static PeepReplace const replacements[] = {
+  /*  0*/{prt_set, pf_peep, pft_exprn, 55},
+  /*  1*/{prt_set, pf_op, pft_field, fb_(0, pf_op)},
+  /*  2*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /*  3*/{prt_set, pf_r2, pft_field, fb_(0, pf_r2)},
+  /*  4*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*  5*/{prt_set, pf_r4, pft_val, GAP},
+  /*  6*/{prt_set, pf_op, pft_val, J_ADDK},
+  /*  7*/{prt_set, pf_r1, pft_field, fb_(0, pf_r2)},
+  /*  8*/{prt_set, pf_r2, pft_field, fb_(0, pf_r2)},
+  /*  9*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /* 10*/{prt_set, pf_dataflow, pft_val, J_DEAD_R2},
+  /* 11*/{prt_set, pf_r4, pft_val, 0},
+  /* 12*/{prt_set, pf_op, pft_val, J_ADDK},
+  /* 13*/{prt_set, pf_r1, pft_val, R_SP},
+  /* 14*/{prt_set, pf_r2, pft_val, R_SP},
+  /* 15*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /* 16*/{prt_set, pf_dead_r2, pft_val, 1},
+  /* 17*/{prt_asr, pf_none, pft_field, fb_(0, pf_r3)},
+  /* 18*/{prt_set, pf_op, pft_val, J_ANDK},
+  /* 19*/{prt_set, pf_r1, pft_field, fb_(0, pf_r3)},
+  /* 20*/{prt_set, pf_r2, pft_field, fb_(0, pf_r3)},
+  /* 21*/{prt_set, pf_r3, pft_exprn, 60},
+  /* 22*/{prt_set, pf_peep, pft_exprn, 61},
+  /* 23*/{prt_swapr2r3},
+  /* 24*/{prt_set, pf_peep, pft_exprn, 64},
+  /* 25*/{prt_set, pf_r4, pft_field, fb_(1, pf_r3)},
+  /* 26*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /* 27*/{prt_set, pf_op, pft_exprn, 65},
+  /* 28*/{prt_swapr2r3},
+  /* 29*/{prt_set, pf_peep, pft_exprn, 63},
+  /* 30*/{prt_set, pf_op, pft_exprn, 66},
+  /* 31*/{prt_set, pf_r4, pft_field, fb_(1, pf_r3)},
+  /* 32*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /* 33*/{prt_swapr2r3},
+  /* 34*/{prt_set, pf_r4, pft_field, fb_(1, pf_r4)},
+  /* 35*/{prt_set, pf_peep, pft_exprn, 68},
+  /* 36*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /* 37*/{prt_set, pf_op, pft_val, J_BICR},
+  /* 38*/{prt_set, pf_op, pft_val, J_RSBK},
+  /* 39*/{prt_set, pf_peep, pft_val, P_CMPZ},
+  /* 40*/{prt_set, pf_r1, pft_field, fb_(3, pf_r1)},
+  /* 41*/{prt_set, pf_r3, pft_val, 1},
+  /* 42*/{prt_set, pf_op, pft_val, J_ADDK},
+  /* 43*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /* 44*/{prt_set, pf_r3, pft_exprn, 69},
+  /* 45*/{prt_set, pf_peep, pft_exprn, 70},
+  /* 46*/{prt_set, pf_op, pft_val, J_ADDK},
+  /* 47*/{prt_set, pf_r1, pft_field, fb_(5, pf_r1)},
+  /* 48*/{prt_set, pf_r3, pft_exprn, 71},
+  /* 49*/{prt_set, pf_peep, pft_exprn, 72},
+  /* 50*/{prt_set, pf_op, pft_val, J_SHLK},
+  /* 51*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /* 52*/{prt_set, pf_r2, pft_field, fb_(0, pf_r2)},
+  /* 53*/{prt_set, pf_r3, pft_exprn, 74},
+  /* 54*/{prt_set, pf_op, pft_val, J_ADDK},
+  /* 55*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /* 56*/{prt_set, pf_r3, pft_exprn, 69},
+  /* 57*/{prt_set, pf_peep, pft_exprn, 77},
+  /* 58*/{prt_set, pf_op, pft_exprn, 81},
+  /* 59*/{prt_swapr2r3},
+  /* 60*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /* 61*/{prt_set, pf_peep, pft_exprn, 82},
+  /* 62*/{prt_set, pf_op, pft_exprn, 87},
+  /* 63*/{prt_swapr2r3},
+  /* 64*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /* 65*/{prt_set, pf_peep, pft_exprn, 82},
+  /* 66*/{prt_set, pf_op, pft_exprn, 91},
+  /* 67*/{prt_set, pf_r2, pft_field, fb_(2, pf_r1)},
+  /* 68*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /* 69*/{prt_set, pf_peep, pft_exprn, 92},
+  /* 70*/{prt_set, pf_op, pft_val, J_ANDK},
+  /* 71*/{prt_set, pf_r2, pft_field, fb_(1, pf_r1)},
+  /* 72*/{prt_set, pf_r3, pft_val, 255},
+  /* 73*/{prt_set, pf_peep, pft_val, 0},
+  /* 74*/{prt_set, pf_op, pft_val, J_POPMB},
+  /* 75*/{prt_set, pf_r1, pft_exprn, 93},
+  /* 76*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /* 77*/{prt_set, pf_r3, pft_exprn, 96},
+  /* 78*/{prt_set, pf_op, pft_val, J_MOVDIM},
+  /* 79*/{prt_set, pf_r1, pft_exprn, 100},
+  /* 80*/{prt_set, pf_r2, pft_val, 0},
+  /* 81*/{prt_set, pf_r3, pft_exprn, 101},
+  /* 82*/{prt_set, pf_op, pft_val, J_MOVIDM},
+  /* 83*/{prt_set, pf_r1, pft_exprn, 102},
+  /* 84*/{prt_set, pf_r2, pft_val, 0},
+  /* 85*/{prt_set, pf_r3, pft_exprn, 106},
+  /* 86*/{prt_set, pf_op, pft_val, J_MOVDIM},
+  /* 87*/{prt_set, pf_r1, pft_exprn, 108},
+  /* 88*/{prt_set, pf_r2, pft_val, 0},
+  /* 89*/{prt_set, pf_r3, pft_exprn, 109},
+  /* 90*/{prt_set, pf_op, pft_val, J_ANDK},
+  /* 91*/{prt_set, pf_r2, pft_field, fb_(0, pf_r3)},
+  /* 92*/{prt_set, pf_r3, pft_exprn, 110},
+  /* 93*/{prt_set, pf_dead_r2, pft_val, 1},
+  /* 94*/{prt_set, pf_op, pft_exprn, 113},
+  /* 95*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /* 96*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /* 97*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /* 98*/{prt_set, pf_op, pft_exprn, 114},
+  /* 99*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*100*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*101*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*102*/{prt_set, pf_op, pft_val, J_TAILCALLX},
+  /*103*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*104*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*105*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*106*/{prt_set, pf_op, pft_exprn, 116},
+  /*107*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*108*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*109*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*110*/{prt_set, pf_op, pft_exprn, 117},
+  /*111*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*112*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*113*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*114*/{prt_set, pf_op, pft_val, J_CALLX},
+  /*115*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*116*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*117*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*118*/{prt_set, pf_op, pft_val, J_SHRK+J_SIGNED},
+  /*119*/{prt_set, pf_r2, pft_field, fb_(0, pf_r1)},
+  /*120*/{prt_set, pf_r3, pft_val, 24},
+  /*121*/{prt_set, pf_peep, pft_val, 0},
+  /*122*/{prt_set, pf_op, pft_exprn, 119},
+  /*123*/{prt_set, pf_r2, pft_field, fb_(0, pf_r1)},
+  /*124*/{prt_set, pf_r3, pft_val, 16},
+  /*125*/{prt_set, pf_peep, pft_val, 0},
+  /*126*/{prt_set, pf_op, pft_exprn, 121},
+  /*127*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*128*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*129*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*130*/{prt_set, pf_op, pft_val, J_TAILCALLI},
+  /*131*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*132*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*133*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*134*/{prt_set, pf_op, pft_exprn, 122},
+  /*135*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*136*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*137*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*138*/{prt_set, pf_op, pft_val, J_CALLI},
+  /*139*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*140*/{prt_set, pf_r4, pft_field, fb_(1, pf_r2)},
+  /*141*/{prt_set, pf_peep, pft_field, fb_(1, pf_peep)},
+  /*142*/{prt_swapr2r3},
+  /*143*/{prt_set, pf_op, pft_exprn, 125},
+  /*144*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*145*/{prt_set, pf_peep, pft_exprn, 82},
+  /*146*/{prt_swapr2r3},
+  /*147*/{prt_set, pf_peep, pft_exprn, 63},
+  /*148*/{prt_set, pf_r4, pft_field, fb_(1, pf_r3)},
+  /*149*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*150*/{prt_set, pf_op, pft_val, J_POPMB},
+  /*151*/{prt_set, pf_r2, pft_field, fb_(0, pf_r1)},
+  /*152*/{prt_set, pf_r1, pft_val, 8},
+  /*153*/{prt_set, pf_r3, pft_exprn, 96},
+  /*154*/{prt_set, pf_op, pft_val, J_MLAR},
+  /*155*/{prt_set, pf_r2, pft_field, fb_(1, pf_r3)},
+  /*156*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*157*/{prt_set, pf_r4, pft_field, fb_(0, pf_r3)},
+  /*158*/{prt_set, pf_op, pft_val, J_MLAR},
+  /*159*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*160*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*161*/{prt_set, pf_r4, pft_field, fb_(0, pf_r3)},
+  /*162*/{prt_set, pf_op, pft_val, J_MLAR},
+  /*163*/{prt_set, pf_r2, pft_field, fb_(1, pf_r3)},
+  /*164*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*165*/{prt_set, pf_r4, pft_field, fb_(0, pf_r2)},
+  /*166*/{prt_set, pf_op, pft_val, J_MLAR},
+  /*167*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*168*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*169*/{prt_set, pf_r4, pft_field, fb_(0, pf_r2)},
+  /*170*/{prt_set, pf_op, pft_val, J_SUBK},
+  /*171*/{prt_set, pf_peep, pft_val, P_CMPZ},
+  /*172*/{prt_set, pf_r1, pft_field, fb_(3, pf_r1)},
+  /*173*/{prt_set, pf_op, pft_val, J_ADCK},
+  /*174*/{prt_set, pf_r3, pft_val, 0},
+  /*175*/{prt_set, pf_cond, pft_val, Q_AL},
+  /*176*/{prt_set, pf_op, pft_val, J_RDVDK},
+  /*177*/{prt_swapr2r3},
+  /*178*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*179*/{prt_set, pf_op, pft_val, J_RSBFK},
+  /*180*/{prt_swapr2r3},
+  /*181*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*182*/{prt_set, pf_op, pft_val, J_RSBDK},
+  /*183*/{prt_swapr2r3},
+  /*184*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*185*/{prt_set, pf_op, pft_val, J_SHRK+J_UNSIGNED},
+  /*186*/{prt_set, pf_r2, pft_field, fb_(0, pf_r1)},
+  /*187*/{prt_set, pf_r3, pft_exprn, 126},
+  /*188*/{prt_set, pf_op, pft_val, J_SUBR},
+  /*189*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /*190*/{prt_set, pf_peep, pft_exprn, 77},
+  /*191*/{prt_set, pf_op, pft_exprn, 127},
+  /*192*/{prt_swapr2r3},
+  /*193*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*194*/{prt_set, pf_op, pft_exprn, 80},
+  /*195*/{prt_swapr2r3},
+  /*196*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*197*/{prt_set, pf_op, pft_exprn, 128},
+  /*198*/{prt_swapr2r3},
+  /*199*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*200*/{prt_set, pf_op, pft_exprn, 86},
+  /*201*/{prt_swapr2r3},
+  /*202*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*203*/{prt_set, pf_op, pft_exprn, 131},
+  /*204*/{prt_set, pf_r2, pft_field, fb_(2, pf_r1)},
+  /*205*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*206*/{prt_set, pf_op, pft_exprn, 133},
+  /*207*/{prt_set, pf_r2, pft_field, fb_(2, pf_r1)},
+  /*208*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*209*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*210*/{prt_set, pf_peep, pft_val, P_POST},
+  /*211*/{prt_asr, pf_none, pft_field, fb_(0, pf_r3)},
+  /*212*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*213*/{prt_set, pf_peep, pft_exprn, 134},
+  /*214*/{prt_asr, pf_none, pft_field, fb_(0, pf_r3)},
+  /*215*/{prt_set, pf_op, pft_val, J_ADDK},
+  /*216*/{prt_set, pf_r2, pft_field, fb_(1, pf_r1)},
+  /*217*/{prt_set, pf_r3, pft_exprn, 37},
+  /*218*/{prt_set, pf_op, pft_exprn, 135},
+  /*219*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*220*/{prt_set, pf_peep, pft_val, P_POST},
+  /*221*/{prt_set, pf_op, pft_exprn, 136},
+  /*222*/{prt_set, pf_peep, pft_exprn, 137},
+  /*223*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*224*/{prt_set, pf_op, pft_exprn, 138},
+  /*225*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*226*/{prt_set, pf_peep, pft_val, P_POST},
+  /*227*/{prt_set, pf_op, pft_exprn, 139},
+  /*228*/{prt_set, pf_peep, pft_exprn, 137},
+  /*229*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*230*/{prt_set, pf_op, pft_exprn, 140},
+  /*231*/{prt_set, pf_r2, pft_field, fb_(2, pf_r1)},
+  /*232*/{prt_set, pf_r3, pft_exprn, 141},
+  /*233*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*234*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*235*/{prt_set, pf_r3, pft_exprn, 144},
+  /*236*/{prt_swapr2r3},
+  /*237*/{prt_set, pf_op, pft_exprn, 124},
+  /*238*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*239*/{prt_swapr2r3},
+  /*240*/{prt_set, pf_op, pft_exprn, 148},
+  /*241*/{prt_set, pf_peep, pft_exprn, 82},
+  /*242*/{prt_set, pf_op, pft_val, J_MOVR},
+  /*243*/{prt_set, pf_r2, pft_val, GAP},
+  /*244*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*245*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*246*/{prt_swapr2r3},
+  /*247*/{prt_set, pf_r3, pft_exprn, 110},
+  /*248*/{prt_set, pf_op, pft_field, fb_(1, pf_op)},
+  /*249*/{prt_set, pf_r2, pft_exprn, 149},
+  /*250*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*251*/{prt_swapr2r3},
+  /*252*/{prt_set, pf_op, pft_exprn, 150},
+  /*253*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*254*/{prt_set, pf_op, pft_val, J_POPMB},
+  /*255*/{prt_set, pf_r1, pft_exprn, 93},
+  /*256*/{prt_set, pf_r3, pft_exprn, 96},
+  /*257*/{prt_set, pf_op, pft_val, J_PUSHC+J_ALIGN4},
+  /*258*/{prt_set, pf_r1, pft_field, fb_(2, pf_r3)},
+  /*259*/{prt_set, pf_r4, pft_exprn, 151},
+  /*260*/{prt_set, pf_op, pft_val, J_RSBK},
+  /*261*/{prt_swapr2r3},
+  /*262*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*263*/{prt_set, pf_r3, pft_exprn, 5},
+  /*264*/{prt_set, pf_r2, pft_val, GAP},
+  /*265*/{prt_set, pf_op, pft_val, J_MOVK},
+  /*266*/{prt_set, pf_r3, pft_exprn, 152},
+  /*267*/{prt_set, pf_r2, pft_val, GAP},
+  /*268*/{prt_set, pf_op, pft_val, J_MOVK},
+  /*269*/{prt_set, pf_r3, pft_exprn, 4},
+  /*270*/{prt_set, pf_r2, pft_val, GAP},
+  /*271*/{prt_set, pf_op, pft_val, J_MOVK},
+  /*272*/{prt_set, pf_r3, pft_exprn, 29},
+  /*273*/{prt_set, pf_r2, pft_val, GAP},
+  /*274*/{prt_set, pf_op, pft_val, J_MOVK},
+  /*275*/{prt_swapr2r3},
+  /*276*/{prt_set, pf_r3, pft_field, fb_(1, pf_r3)},
+  /*277*/{prt_set, pf_op, pft_exprn, 153},
+  /*278*/{prt_set, pf_op, pft_val, J_MOVR},
+  /*279*/{prt_set, pf_r3, pft_field, fb_(0, pf_r2)},
+  /*280*/{prt_set, pf_r2, pft_val, GAP},
+  /*281*/{prt_set, pf_op, pft_exprn, 154},
+  /*282*/{prt_swapr2r3},
+  /*283*/{prt_set, pf_r2, pft_val, R_A4},
+  /*284*/{prt_set, pf_r1, pft_val, R_A4},
+  /*285*/{prt_set, pf_r2, pft_val, R_A4},
+  /*286*/{prt_set, pf_r1, pft_val, R_A3},
+  /*287*/{prt_set, pf_dead_r2, pft_val, 0},
+  /*288*/{prt_set, pf_dead_r3, pft_val, 0},
+  /*289*/{prt_set, pf_op, pft_exprn, 159},
+  /*290*/{prt_set, pf_r3, pft_field, fb_(1, pf_r2)},
+  /*291*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /*292*/{prt_set, pf_peep, pft_exprn, 160},
+  /*293*/{prt_set, pf_op, pft_exprn, 65},
+  /*294*/{prt_set, pf_peep, pft_exprn, 161},
+  /*295*/{prt_set, pf_op, pft_exprn, 162},
+  /*296*/{prt_set, pf_peep, pft_exprn, 163},
+  /*297*/{prt_set, pf_op, pft_val, J_SHRK+J_UNSIGNED},
+  /*298*/{prt_set, pf_r3, pft_exprn, 78},
+  /*299*/{prt_set, pf_op, pft_exprn, 80},
+  /*300*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*301*/{prt_set, pf_op, pft_val, J_SHLK},
+  /*302*/{prt_set, pf_r3, pft_exprn, 84},
+  /*303*/{prt_set, pf_op, pft_exprn, 86},
+  /*304*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*305*/{prt_set, pf_op, pft_val, J_SHRK+J_UNSIGNED},
+  /*306*/{prt_set, pf_r3, pft_exprn, 129},
+  /*307*/{prt_set, pf_op, pft_val, J_SHRK+J_SIGNED},
+  /*308*/{prt_set, pf_r3, pft_exprn, 129},
+  /*309*/{prt_set, pf_op, pft_val, J_SHLK},
+  /*310*/{prt_set, pf_r3, pft_exprn, 89},
+  /*311*/{prt_set, pf_r3, pft_exprn, 5},
+  /*312*/{prt_asr, pf_none, pft_field, fb_(0, pf_r3)},
+  /*313*/{prt_set, pf_r4, pft_exprn, 164},
+  /*314*/{prt_set, pf_peep, pft_exprn, 165},
+  /*315*/{prt_set, pf_op, pft_exprn, 166},
+  /*316*/{prt_set, pf_peep, pft_exprn, 167},
+  /*317*/{prt_set, pf_op, pft_val, J_MOVK},
+  /*318*/{prt_set, pf_r2, pft_val, GAP},
+  /*319*/{prt_set, pf_r3, pft_exprn, 28},
+  /*320*/{prt_set, pf_peep, pft_exprn, 168},
+  /*321*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*322*/{prt_set, pf_r3, pft_exprn, 172},
+  /*323*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*324*/{prt_set, pf_r3, pft_exprn, 175},
+  /*325*/{prt_set, pf_r1, pft_field, fb_(2, pf_r1)},
+  /*326*/{prt_set, pf_dead_r1, pft_val, 0},
+  /*327*/{prt_set, pf_dead_r3, pft_val, 1},
+  /*328*/{prt_set, pf_peep, pft_exprn, 178},
+  /*329*/{prt_swapr2r3},
+  /*330*/{prt_set, pf_op, pft_exprn, 179},
+  /*331*/{prt_swapr2r3},
+  /*332*/{prt_set, pf_op, pft_exprn, 147},
+  /*333*/{prt_set, pf_op, pft_exprn, 180},
+  /*334*/{prt_set, pf_r3, pft_field, fb_(1, pf_r1)},
+  /*335*/{prt_set, pf_dead_r1, pft_val, 1},
+  /*336*/{prt_set, pf_peep, pft_exprn, 178},
+  /*337*/{prt_set, pf_r3, pft_exprn, 173},
+  /*338*/{prt_set, pf_r2, pft_field, fb_(2, pf_r2)},
+  /*339*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /*340*/{prt_set, pf_r2, pft_exprn, 149},
+  /*341*/{prt_set, pf_op, pft_val, J_ADCOND},
+  /*342*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /*343*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*344*/{prt_set, pf_r3, pft_exprn, 5},
+  /*345*/{prt_set, pf_op, pft_val, J_PUSHM},
+  /*346*/{prt_set, pf_r3, pft_exprn, 181},
+  /*347*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*348*/{prt_set, pf_r3, pft_exprn, 152},
+  /*349*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*350*/{prt_set, pf_r3, pft_exprn, 4},
+  /*351*/{prt_set, pf_r2, pft_field, fb_(1, pf_r2)},
+  /*352*/{prt_set, pf_r3, pft_exprn, 29},
+  /*353*/{prt_set, pf_r3, pft_exprn, 29},
+  /*354*/{prt_set, pf_op, pft_val, J_ORRK},
+  /*355*/{prt_set, pf_r3, pft_field, fb_(0, pf_r3)},
+  /*356*/{prt_set, pf_op, pft_val, J_ANDK},
+  /*357*/{prt_set, pf_dead_r1, pft_val, 1},
+  /*358*/{prt_set, pf_peep, pft_exprn, 183},
+  /*359*/{prt_swapr2r3},
+  /*360*/{prt_set, pf_r1, pft_field, fb_(0, pf_r1)},
+  /*361*/{prt_set, pf_r1, pft_field, fb_(1, pf_r3)},
+  /*362*/{prt_set, pf_r4, pft_exprn, 184},
+  /*363*/{prt_set, pf_r2, pft_field, fb_(1, pf_r3)},
+  /*364*/{prt_set, pf_r4, pft_exprn, 184},
+  /*365*/{prt_set, pf_op, pft_val, J_SHLK},
+  /*366*/{prt_set, pf_r3, pft_val, 1},
+  /*367*/{prt_set, pf_peep, pft_exprn, 185},
+  /*368*/{prt_set, pf_op, pft_exprn, 187},
+  /*369*/{prt_set, pf_peep, pft_exprn, 182},
+  /*370*/{prt_kill},
+  /*371*/{prt_set, pf_op, pft_exprn, 188},
+  /*372*/{prt_set, pf_op, pft_exprn, 189},
+  /*373*/{prt_set, pf_peep, pft_exprn, 176},
+  /*374*/{prt_set, pf_peep, pft_exprn, 190},
+  /*375*/{prt_set, pf_op, pft_val, J_CONDEXEC+Q_LO},
+  /*376*/{prt_set, pf_op, pft_exprn, 191},
+  /*377*/{prt_set, pf_peep, pft_exprn, 192},
+  /*378*/{prt_set, pf_op, pft_exprn, 193},
+  /*379*/{prt_reverse_fn},
+  /*380*/{prt_set, pf_peep, pft_val, P_MS},
+  /*381*/{prt_set, pf_r3, pft_exprn, 194},
+  /*382*/{prt_set, pf_peep, pft_exprn, 195},
+  /*383*/{prt_set, pf_peep, pft_exprn, 196},
+  /*384*/{prt_set, pf_op, pft_exprn, 197},
+  /*385*/{prt_set, pf_r1, pft_field, fb_(1, pf_r2)},
+  /*386*/{prt_set, pf_r3, pft_exprn, 198},
+  /*387*/{prt_set, pf_r3, pft_exprn, 27},
+  /*388*/{prt_set, pf_op, pft_exprn, 202},
+  /*389*/{prt_set, pf_op, pft_exprn, 203},
+  /*390*/{prt_set, pf_r3, pft_exprn, 204},
+  /*391*/{prt_set, pf_r3, pft_exprn, 205}
+};
+static PeepExprn const peepexprns[] = {
+ /*  0*/{peo_sub, 0, pft_val, pft_field, 31,fb_(2, pf_r3)},
+ /*  1*/{peo_proc1, pep_bit, pft_exprn, pft_none, 0,0},
+ /*  2*/{peo_sub, 0, pft_exprn, pft_val, 1,1},
+ /*  3*/{peo_sub, 0, pft_val, pft_exprn, 0,1},
+ /*  4*/{peo_or, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*  5*/{peo_add, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*  6*/{peo_eor, 0, pft_val, pft_exprn, 0xffffffffl,5},
+ /*  7*/{peo_add, 0, pft_field, pft_field, fb_(0, pf_r3),fb_(1, pf_r3)},
+ /*  8*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),J_SHIFTVAL},
+ /*  9*/{peo_shr, 0, pft_exprn, pft_val, 8,J_SHIFTPOS},
+ /* 10*/{peo_and, 0, pft_field, pft_field, fb_(2, pf_r3),fb_(0, pf_r3)},
+ /* 11*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_r3),1},
+ /* 12*/{peo_sub, 0, pft_val, pft_field, 32,fb_(1, pf_r3)},
+ /* 13*/{peo_proc1, pep_bit, pft_exprn, pft_none, 12,0},
+ /* 14*/{peo_sub, 0, pft_val, pft_field, 0,fb_(1, pf_r3)},
+ /* 15*/{peo_and, 0, pft_field, pft_exprn, fb_(1, pf_r3),14},
+ /* 16*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_r2),3},
+ /* 17*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_peep),P_BASEALIGNED},
+ /* 18*/{peo_proc1, pep_bit, pft_val, pft_none, R_SP,0},
+ /* 19*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),J_SHIFTR},
+ /* 20*/{peo_shr, 0, pft_field, pft_val, fb_(0, pf_op),J_SHIFTPOS},
+ /* 21*/{peo_and, 0, pft_exprn, pft_val, 20,SHIFT_MASK},
+ /* 22*/{peo_add, 0, pft_field, pft_exprn, fb_(2, pf_r3),21},
+ /* 23*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_peep),P_CMPZ},
+ /* 24*/{peo_proc1, pep_lsb, pft_field, pft_none, fb_(1, pf_r3),0},
+ /* 25*/{peo_mul, 0, pft_exprn, pft_val, 24,0xff},
+ /* 26*/{peo_and, 0, pft_field, pft_exprn, fb_(1, pf_r3),25},
+ /* 27*/{peo_eor, 0, pft_field, pft_exprn, fb_(1, pf_r3),26},
+ /* 28*/{peo_add, 0, pft_field, pft_exprn, fb_(0, pf_r3),26},
+ /* 29*/{peo_and, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /* 30*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_r3),3},
+ /* 31*/{peo_eor, 0, pft_val, pft_field, 0xffffffffL,fb_(1, pf_r3)},
+ /* 32*/{peo_shl, 0, pft_val, pft_field, 1,fb_(0, pf_r3)},
+ /* 33*/{peo_sub, 0, pft_val, pft_exprn, 0,32},
+ /* 34*/{peo_and, 0, pft_exprn, pft_exprn, 31,33},
+ /* 35*/{peo_eor, 0, pft_field, pft_val, fb_(1, pf_r3),0xffffffff},
+ /* 36*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_r3),0xffffffff},
+ /* 37*/{peo_sub, 0, pft_field, pft_field, fb_(0, pf_r3),fb_(1, pf_r3)},
+ /* 38*/{peo_sub, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /* 39*/{peo_add, 0, pft_field, pft_val, fb_(2, pf_r3),1},
+ /* 40*/{peo_proc1, pep_lsb, pft_exprn, pft_none, 39,0},
+ /* 41*/{peo_proc1, pep_lsb, pft_field, pft_none, fb_(2, pf_r3),0},
+ /* 42*/{peo_sub, 0, pft_exprn, pft_val, 41,1},
+ /* 43*/{peo_or, 0, pft_field, pft_exprn, fb_(2, pf_r3),42},
+ /* 44*/{peo_eor, 0, pft_val, pft_field, 0xffffffff,fb_(1, pf_r3)},
+ /* 45*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_r3),1},
+ /* 46*/{peo_proc1, pep_lsb, pft_exprn, pft_none, 45,0},
+ /* 47*/{peo_sub, 0, pft_exprn, pft_val, 24,1},
+ /* 48*/{peo_or, 0, pft_field, pft_exprn, fb_(1, pf_r3),47},
+ /* 49*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),Q_MASK},
+ /* 50*/{peo_proc1, pep_shift_op, pft_field, pft_none, fb_(0, pf_op),0},
+ /* 51*/{peo_sub, 0, pft_val, pft_exprn, 0,11},
+ /* 52*/{peo_and, 0, pft_exprn, pft_exprn, 11,51},
+ /* 53*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_op),Q_MASK},
+ /* 54*/{peo_and, 0, pft_field, pft_val, fb_(2, pf_peep),P_CMPZ},
+ /* 55*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_MS},
+ /* 56*/{peo_sub, 0, pft_val, pft_exprn, 32,9},
+ /* 57*/{peo_proc1, pep_bit, pft_exprn, pft_none, 56,0},
+ /* 58*/{peo_sub, 0, pft_exprn, pft_val, 57,1},
+ /* 59*/{peo_sub, 0, pft_exprn, pft_field, 9,fb_(2, pf_r3)},
+ /* 60*/{peo_shl, 0, pft_exprn, pft_exprn, 58,59},
+ /* 61*/{peo_or, 0, pft_val, pft_exprn, P_CMPZ,49},
+ /* 62*/{peo_proc1, pep_shift_p, pft_field, pft_none, fb_(1, pf_op),0},
+ /* 63*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_peep),62},
+ /* 64*/{peo_or, 0, pft_exprn, pft_val, 63,P_SWAPCOND},
+ /* 65*/{peo_proc1, pep_q_swap, pft_field, pft_none, fb_(0, pf_op),0},
+ /* 66*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),J_SUBR^J_RSBR},
+ /* 67*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_peep),P_RSHIFT},
+ /* 68*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_peep),67},
+ /* 69*/{peo_sub, 0, pft_val, pft_field, 0,fb_(4, pf_r3)},
+ /* 70*/{peo_or, 0, pft_field, pft_val, fb_(4, pf_peep),P_CMPZ},
+ /* 71*/{peo_sub, 0, pft_val, pft_field, 0,fb_(7, pf_r3)},
+ /* 72*/{peo_or, 0, pft_field, pft_val, fb_(7, pf_peep),P_CMPZ},
+ /* 73*/{peo_proc1, pep_log2, pft_exprn, pft_none, 11,0},
+ /* 74*/{peo_sub, 0, pft_val, pft_exprn, 16,73},
+ /* 75*/{peo_and, 0, pft_field, pft_val, fb_(4, pf_op),Q_MASK},
+ /* 76*/{peo_or, 0, pft_field, pft_exprn, fb_(4, pf_peep),75},
+ /* 77*/{peo_or, 0, pft_val, pft_exprn, P_CMPZ,76},
+ /* 78*/{peo_proc1, pep_log2, pft_exprn, pft_none, 24,0},
+ /* 79*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHLK,78},
+ /* 80*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),79},
+ /* 81*/{peo_proc1, pep_q_swap, pft_exprn, pft_none, 80,0},
+ /* 82*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_SWAPCOND},
+ /* 83*/{peo_proc1, pep_log2, pft_exprn, pft_none, 45,0},
+ /* 84*/{peo_sub, 0, pft_val, pft_exprn, 32,83},
+ /* 85*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHRK+J_UNSIGNED,84},
+ /* 86*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),85},
+ /* 87*/{peo_proc1, pep_q_swap, pft_exprn, pft_none, 86,0},
+ /* 88*/{peo_proc1, pep_log2, pft_exprn, pft_none, 39,0},
+ /* 89*/{peo_sub, 0, pft_val, pft_exprn, 32,88},
+ /* 90*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHLK,89},
+ /* 91*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),90},
+ /* 92*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_UNSIGNEDCOND},
+ /* 93*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_r3),8},
+ /* 94*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(0, pf_r1),0},
+ /* 95*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(0, pf_r2),0},
+ /* 96*/{peo_or, 0, pft_exprn, pft_exprn, 94,95},
+ /* 97*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(1, pf_r1),0},
+ /* 98*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(1, pf_r2),0},
+ /* 99*/{peo_or, 0, pft_exprn, pft_exprn, 97,98},
+ /*100*/{peo_or, 0, pft_exprn, pft_exprn, 99,94},
+ /*101*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(1, pf_r3),0},
+ /*102*/{peo_or, 0, pft_exprn, pft_exprn, 97,94},
+ /*103*/{peo_proc1, pep_bit, pft_field, pft_none, fb_(0, pf_r3),0},
+ /*104*/{peo_or, 0, pft_exprn, pft_exprn, 95,103},
+ /*105*/{peo_or, 0, pft_exprn, pft_exprn, 101,104},
+ /*106*/{peo_or, 0, pft_exprn, pft_exprn, 98,105},
+ /*107*/{peo_or, 0, pft_exprn, pft_exprn, 98,96},
+ /*108*/{peo_or, 0, pft_exprn, pft_exprn, 97,107},
+ /*109*/{peo_or, 0, pft_exprn, pft_exprn, 101,103},
+ /*110*/{peo_shl, 0, pft_field, pft_exprn, fb_(1, pf_r3),9},
+ /*111*/{peo_or, 0, pft_val, pft_val, J_TAILCALLXR,J_NEGINDEX},
+ /*112*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_op),J_SHIFTMASK},
+ /*113*/{peo_or, 0, pft_exprn, pft_exprn, 111,112},
+ /*114*/{peo_or, 0, pft_val, pft_exprn, J_TAILCALLXR,112},
+ /*115*/{peo_or, 0, pft_val, pft_val, J_CALLXR,J_NEGINDEX},
+ /*116*/{peo_or, 0, pft_exprn, pft_exprn, 115,112},
+ /*117*/{peo_or, 0, pft_val, pft_exprn, J_CALLXR,112},
+ /*118*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),J_SIGNED},
+ /*119*/{peo_or, 0, pft_val, pft_exprn, J_SHRK,118},
+ /*120*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_op),J_SHIFTMASK+J_NEGINDEX},
+ /*121*/{peo_or, 0, pft_val, pft_exprn, J_TAILCALLIR,120},
+ /*122*/{peo_or, 0, pft_val, pft_exprn, J_CALLIR,120},
+ /*123*/{peo_proc2, pep_shift_k, pft_field, pft_field, fb_(1, pf_op),fb_(1, pf_r3)},
+ /*124*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),123},
+ /*125*/{peo_proc1, pep_q_swap, pft_exprn, pft_none, 124,0},
+ /*126*/{peo_sub, 0, pft_val, pft_exprn, 32,73},
+ /*127*/{peo_or, 0, pft_exprn, pft_exprn, 66,79},
+ /*128*/{peo_or, 0, pft_exprn, pft_exprn, 66,85},
+ /*129*/{peo_proc1, pep_log2, pft_exprn, pft_none, 41,0},
+ /*130*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHRK+J_UNSIGNED,129},
+ /*131*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),130},
+ /*132*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHRK+J_SIGNED,129},
+ /*133*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),132},
+ /*134*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_peep),P_POST},
+ /*135*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_op),J_LDRR-J_LDRK+J_NEGINDEX},
+ /*136*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_op),J_LDRR-J_LDRK+J_NEGINDEX},
+ /*137*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_PRE},
+ /*138*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_op),J_LDRR-J_LDRK},
+ /*139*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_op),J_LDRR-J_LDRK},
+ /*140*/{peo_add, 0, pft_val, pft_exprn, J_CMPK,49},
+ /*141*/{peo_shl, 0, pft_field, pft_exprn, fb_(1, pf_r3),59},
+ /*142*/{peo_sub, 0, pft_val, pft_field, 32,fb_(0, pf_r3)},
+ /*143*/{peo_proc1, pep_bit, pft_exprn, pft_none, 142,0},
+ /*144*/{peo_sub, 0, pft_exprn, pft_val, 143,1},
+ /*145*/{peo_proc1, pep_log2, pft_exprn, pft_none, 15,0},
+ /*146*/{peo_proc2, pep_shift_k, pft_val, pft_exprn, J_SHLK,145},
+ /*147*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_op),146},
+ /*148*/{peo_proc1, pep_q_swap, pft_exprn, pft_none, 147,0},
+ /*149*/{peo_add, 0, pft_field, pft_field, fb_(1, pf_r2),fb_(0, pf_r3)},
+ /*150*/{peo_or, 0, pft_exprn, pft_exprn, 66,123},
+ /*151*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_r4),94},
+ /*152*/{peo_eor, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(0, pf_r3)},
+ /*153*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_op),J_BICR-J_NOTR},
+ /*154*/{peo_add, 0, pft_field, pft_val, fb_(1, pf_op),J_ADCR-J_ADDR},
+ /*155*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),~J_SHIFTMASK},
+ /*156*/{peo_proc1, pep_shift_d, pft_field, pft_none, fb_(0, pf_op),0},
+ /*157*/{peo_add, 0, pft_exprn, pft_field, 156,fb_(1, pf_r3)},
+ /*158*/{peo_proc2, pep_shift_k, pft_field, pft_exprn, fb_(1, pf_op),157},
+ /*159*/{peo_or, 0, pft_exprn, pft_exprn, 155,158},
+ /*160*/{peo_or, 0, pft_field, pft_val, fb_(4, pf_peep),P_ZONLY},
+ /*161*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_SWAPPEDOPS},
+ /*162*/{peo_proc1, pep_q_tounsigned, pft_field, pft_none, fb_(1, pf_op),0},
+ /*163*/{peo_eor, 0, pft_field, pft_val, fb_(1, pf_peep),P_UNSIGNEDCOND},
+ /*164*/{peo_add, 0, pft_field, pft_field, fb_(0, pf_r4),fb_(1, pf_r3)},
+ /*165*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_ADJUSTSP},
+ /*166*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_op),J_ALIGN4-J_ALIGN1},
+ /*167*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_peep),P_BASEALIGNED},
+ /*168*/{peo_or, 0, pft_field, pft_val, fb_(0, pf_peep),P_BASEALIGNED},
+ /*169*/{peo_sub, 0, pft_val, pft_field, 32,fb_(2, pf_r3)},
+ /*170*/{peo_proc1, pep_bit, pft_exprn, pft_none, 169,0},
+ /*171*/{peo_proc1, pep_bit, pft_exprn, pft_none, 59,0},
+ /*172*/{peo_sub, 0, pft_exprn, pft_exprn, 170,171},
+ /*173*/{peo_sub, 0, pft_field, pft_field, fb_(1, pf_r3),fb_(2, pf_r3)},
+ /*174*/{peo_proc1, pep_bit, pft_exprn, pft_none, 173,0},
+ /*175*/{peo_sub, 0, pft_exprn, pft_exprn, 170,174},
+ /*176*/{peo_or, 0, pft_field, pft_val, fb_(2, pf_peep),P_CMPZ},
+ /*177*/{peo_eor, 0, pft_exprn, pft_val, 49,Q_MI^Q_LT},
+ /*178*/{peo_or, 0, pft_exprn, pft_exprn, 176,177},
+ /*179*/{peo_or, 0, pft_exprn, pft_exprn, 66,146},
+ /*180*/{peo_add, 0, pft_field, pft_val, fb_(0, pf_op),1},
+ /*181*/{peo_or, 0, pft_exprn, pft_exprn, 98,101},
+ /*182*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_peep),P_CMPZ},
+ /*183*/{peo_or, 0, pft_exprn, pft_exprn, 182,49},
+ /*184*/{peo_or, 0, pft_field, pft_exprn, fb_(0, pf_r4),97},
+ /*185*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_peep),~P_SWAPCOND},
+ /*186*/{peo_and, 0, pft_field, pft_val, fb_(0, pf_op),~Q_MASK},
+ /*187*/{peo_or, 0, pft_exprn, pft_val, 186,Q_HS},
+ /*188*/{peo_or, 0, pft_exprn, pft_val, 186,Q_LO},
+ /*189*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),Q_HI^Q_UNE},
+ /*190*/{peo_or, 0, pft_field, pft_val, fb_(1, pf_peep),P_PRE},
+ /*191*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),Q_HS^Q_LS},
+ /*192*/{peo_or, 0, pft_field, pft_val, fb_(2, pf_peep),P_SETCC+P_CMPZ},
+ /*193*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),Q_HS^Q_LO},
+ /*194*/{peo_shl, 0, pft_field, pft_val, fb_(2, pf_r3),16},
+ /*195*/{peo_or, 0, pft_field, pft_val, fb_(3, pf_peep),P_MS},
+ /*196*/{peo_or, 0, pft_field, pft_val, fb_(4, pf_peep),P_MS},
+ /*197*/{peo_proc1, pep_q_tounsigned, pft_field, pft_none, fb_(0, pf_op),0},
+ /*198*/{peo_div, 0, pft_field, pft_exprn, fb_(1, pf_r3),15},
+ /*199*/{peo_sub, 0, pft_field, pft_exprn, fb_(1, pf_r3),22},
+ /*200*/{peo_shl, 0, pft_exprn, pft_val, 199,J_SHIFTPOS},
+ /*201*/{peo_or, 0, pft_val, pft_exprn, J_SHIFTR,200},
+ /*202*/{peo_or, 0, pft_exprn, pft_exprn, 155,201},
+ /*203*/{peo_eor, 0, pft_field, pft_val, fb_(0, pf_op),Q_MI^Q_LT},
+ /*204*/{peo_and, 0, pft_field, pft_val, fb_(1, pf_r3),255},
+ /*205*/{peo_shl, 0, pft_field, pft_field, fb_(0, pf_r3),fb_(2, pf_r3)}
+};
+
+static PeepOp const p1_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, 0, 2, 317}};
+static PeepConstraint const c1[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p2_ops[] = {
+  {{pot_op, 0, 0, 0, J_PUSHC+J_ALIGN4}, 0, 1, 370}};
+static PeepConstraint const c2[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p3_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(0, 1)}, 0, 2, 365}};
+static PeepConstraint const c3[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p4_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(2, 3)}, 0, 3, 278}};
+static PeepConstraint const c4[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p5_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(4, 5)}, 0, 1, 370}};
+static PeepConstraint const c5[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p6_ops[] = {
+  {{pot_op_m, 0, 0, 0, fh_(4, 3)}, p_dead_r2, 1, 391},
+  {{pot_op, 0, 0, 0, J_SHRK+J_SIGNED}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_SHLK}, 0, 0, 0}};
+static PeepConstraint const c6[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ge, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_le, 0, pft_field, pft_exprn, fb_(0, pf_r3), 2}};
+static PeepOp const p7_ops[] = {
+  {{pot_op_m, 0, 0, 0, fh_(4, 3)}, p_dead_r2, 1, 391},
+  {{pot_op, 0, 0, 0, J_SHRK+J_SIGNED}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_SHLK}, 0, 0, 0}};
+static PeepConstraint const c7[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_lt, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_ge, 0, pft_field, pft_exprn, fb_(0, pf_r3), 3}};
+static PeepOp const p8_ops[] = {
+  {{pot_andnot, 0, pu_r1, 0, fh_(8, 9)}, p_dead_r1, 1, 361},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 1, 370}};
+static PeepConstraint const c8[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p9_ops[] = {
+  {{pot_andnot, 0, pu_r2, 0, fh_(12, 13)}, p_dead_r2, 1, 155},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 1, 370}};
+static PeepConstraint const c9[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p10_ops[] = {
+  {{pot_andnot, 0, pu_r3, 0, fh_(14, 7)}, p_dead_r3, 1, 36},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 1, 370}};
+static PeepConstraint const c10[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p11_ops[] = {
+  {{pot_andnot, 0, pu_r4, 0, fh_(15, 16)}, p_dead_r4, 1, 25},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 1, 370}};
+static PeepConstraint const c11[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r4)}};
+static PeepOp const p12_ops[] = {
+  {{pot_andnot, 0, pu_r1, 0, fh_(8, 9)}, 0, 1, 361},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 0, 0}};
+static PeepConstraint const c12[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p13_ops[] = {
+  {{pot_andnot, 0, pu_r2, 0, fh_(12, 18)}, 0, 1, 155},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 0, 0}};
+static PeepConstraint const c13[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p14_ops[] = {
+  {{pot_andnot, 0, pu_r3, 0, fh_(14, 17)}, 0, 1, 36},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 0, 0}};
+static PeepConstraint const c14[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p15_ops[] = {
+  {{pot_andnot, 0, pu_r4, 0, fh_(15, 19)}, 0, 1, 25},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 10)}, 0, 0, 0}};
+static PeepConstraint const c15[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r4)}};
+static PeepOp const p16_ops[] = {
+  {{pot_opinset, 0, pu_r2+pu_r4, 2, fh_(0, 37)}, p_dead_r2, 2, 363},
+  {{pot_op, pu_r1, pu_r1+pu_r3, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c16[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_or, 0, pft_val, pft_val, 2, 3},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_dead_r3), 1},
+  {pct_proc2, pcp_movc_pres_r1r2, pft_inst, pft_field, fb_(0, 0), fb_(1, pf_dead_r3)}};
+static PeepOp const p17_ops[] = {
+  {{pot_opinset, 0, pu_r1+pu_r4, 2, fh_(0, 39)}, p_dead_r1, 2, 361},
+  {{pot_op, pu_r1, pu_r1+pu_r3, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c17[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_or, 0, pft_val, pft_val, 2, 3},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_dead_r3), 1},
+  {pct_proc2, pcp_movc_pres_r1r2, pft_inst, pft_field, fb_(0, 0), fb_(0, pf_dead_r2)}};
+static PeepOp const p18_ops[] = {
+  {{pot_andnot, pu_r1, pu_r1, 0, fh_(6, 8)}, 0, 0, 0},
+  {{pot_and, pu_r1, 0, 0, fh_(20, 21)}, 0, 1, 370}};
+static PeepConstraint const c18[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_proc1, pcp_notcall, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p19_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(4, 10)}, p_dead_r3, 1, 370},
+  {{pot_opinset, pu_r1, pu_r1, 2, fh_(0, 10)}, 0, 1, 2}};
+static PeepConstraint const c19[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)}};
+static PeepOp const p20_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(4, 10)}, p_dead_r3, 1, 370},
+  {{pot_opinset, pu_r1, pu_r1, 2, fh_(0, 10)}, 0, 2, 359}};
+static PeepConstraint const c20[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)}};
+static PeepOp const p21_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(4, 10)}, p_dead_r3, 1, 370},
+  {{pot_andnot, pu_r1, pu_r1, 0, fh_(6, 22)}, 0, 1, 2}};
+static PeepConstraint const c21[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p22_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3+pu_r4, 0, fh_(0, 23)}, p_dead_r3, 4, 166},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(24, 5)}, 0, 1, 370}};
+static PeepConstraint const c22[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)}};
+static PeepOp const p23_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3+pu_r4, 0, fh_(0, 23)}, p_dead_r3, 4, 162},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(24, 5)}, 0, 1, 370}};
+static PeepConstraint const c23[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)}};
+static PeepOp const p24_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3+pu_r4, 0, fh_(0, 23)}, p_dead_r2, 4, 158},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(24, 5)}, 0, 1, 370}};
+static PeepConstraint const c24[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)}};
+static PeepOp const p25_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3+pu_r4, 0, fh_(0, 23)}, p_dead_r2, 4, 154},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(24, 5)}, 0, 1, 370}};
+static PeepConstraint const c25[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)}};
+static PeepOp const p26_ops[] = {
+  {{pot_op, 0, 0, 0, J_B}, 0, 0, 0},
+  {{pot_op, pu_r1, 0, 0, J_ADDK}, 0, 1, 370}};
+static PeepConstraint const c26[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), RETLABV},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_SP, 0},
+  {pct_proc0, pcp_notleafproc, pft_none, pft_none, 0, 0}};
+static PeepOp const p27_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 51)}, 0, 0, 0},
+  {{pot_op, pu_r1, 0, 0, J_ADDK}, 0, 1, 370}};
+static PeepConstraint const c27[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_SP, 0},
+  {pct_proc0, pcp_notleafproc, pft_none, pft_none, 0, 0}};
+static PeepOp const p28_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(25, 26)}, p_dead_r3, 2, 276},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(27, 5)}, 0, 1, 370}};
+static PeepConstraint const c28[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p29_ops[] = {
+  {{pot_and, 0, pu_r3+pu_r4, 0, fh_(25, 23)}, p_dead_r3, 4, 34},
+  {{pot_and, pu_r1, pu_r1+pu_r3+pu_r4, 0, fh_(29, 30)}, 0, 1, 370}};
+static PeepConstraint const c29[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p30_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(25, 26)}, p_dead_r2, 3, 275},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(27, 5)}, 0, 1, 370}};
+static PeepConstraint const c30[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p31_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r4, 0, fh_(25, 23)}, p_dead_r2, 5, 33},
+  {{pot_and, pu_r1, pu_r1+pu_r3+pu_r4, 0, fh_(29, 30)}, 0, 1, 370}};
+static PeepConstraint const c31[] = {
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_PSR, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p32_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 57)}, 0, 1, 370},
+  {{pot_and, 0, pu_r3, 0, fh_(4, 5)}, 0, 1, 358}};
+static PeepConstraint const c32[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PSR, 0},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_PSR, 0}};
+static PeepOp const p33_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 57)}, p_dead_r2, 1, 370},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(31, 28)}, 0, 2, 357}};
+static PeepConstraint const c33[] = {
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PSR, 0},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_PSR, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p34_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 57)}, 0, 1, 370},
+  {{pot_and, 0, pu_r1, 0, fh_(31, 28)}, 0, 1, 358}};
+static PeepConstraint const c34[] = {
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PSR, 0},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_PSR, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0}};
+static PeepOp const p35_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, p_dead_r2, 2, 353},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(32, 5)}, 0, 2, 355}};
+static PeepConstraint const c35[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p36_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, p_dead_r2, 1, 76},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(33, 5)}, 0, 1, 370}};
+static PeepConstraint const c36[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_val, 4, -1}};
+static PeepOp const p37_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, p_dead_r2, 2, 351},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(33, 5)}, 0, 1, 370}};
+static PeepConstraint const c37[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p38_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, p_dead_r2, 2, 349},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(32, 5)}, 0, 1, 370}};
+static PeepConstraint const c38[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p39_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_EORK}, p_dead_r2, 2, 347},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(34, 5)}, 0, 1, 370}};
+static PeepConstraint const c39[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p40_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(2, 3)}, p_dead_r2, 2, 343},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c40[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p41_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, 0, 3, 272},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c41[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p42_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, 0, 3, 269},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c42[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p43_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_EORK}, 0, 3, 266},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c43[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p44_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(2, 3)}, p_dead_r2, 3, 263},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 7}};
+static PeepConstraint const c44[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_or, 0, pft_val, pft_val, 3, 5},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 5, 0},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 6, 0},
+  {pct_negate, 0, pft_val, pft_none, 4, 0}};
+static PeepOp const p45_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(35, 3)}, p_dead_r2, 3, 260},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(36, 5)}, 0, 1, 370}};
+static PeepConstraint const c45[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p46_ops[] = {
+  {{pot_opinset_m, 0, 0, 6, fh_(4, 93)}, 0, 0, 0},
+  {{pot_opinset_m, 0, 0, 6, fh_(4, 93)}, 0, 1, 370}};
+static PeepConstraint const c46[] = {
+  {pct_proc1, pcp_regset_unkilled, pft_val, pft_none, M_PSR, 0},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_PSR, 0}};
+static PeepOp const p47_ops[] = {
+  {{pot_op, pu_r1, pu_r1, 0, J_STRBK+J_ALIGN1}, p_dead_r1, 0, 0},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 1, 390}};
+static PeepConstraint const c47[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_gtu, 0, pft_field, pft_val, fb_(1, pf_r3), 255}};
+static PeepOp const p48_ops[] = {
+  {{pot_op, 0, 0, 0, J_PUSHD}, p_dead_r1, 2, 345},
+  {{pot_op, pu_r1, pu_r1+pu_r2+pu_r3, 0, J_MOVIDR}, 0, 1, 370}};
+static PeepConstraint const c48[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p49_ops[] = {
+  {{pot_opinset_m, 0, pu_r2, 9, fh_(99, 100)}, p_dead_r2, 1, 155},
+  {{pot_and, pu_r1, pu_r1+pu_r3, 0, fh_(4, 5)}, 0, 1, 370}};
+static PeepConstraint const c49[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p50_ops[] = {
+  {{pot_opinset, 0, 0, 6, fh_(0, 109)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c50[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)}};
+static PeepOp const p51_ops[] = {
+  {{pot_opinset_m, 0, 0, 6, fh_(115, 116)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c51[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p52_ops[] = {
+  {{pot_opinset_m, 0, pu_r2, 6, fh_(122, 123)}, p_dead_r2, 2, 343},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c52[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 7, fb_(0, pf_op)}};
+static PeepOp const p53_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(37, 38)}, 0, 2, 212}};
+static PeepConstraint const c53[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)}};
+static PeepOp const p54_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_andnot, pu_r2, pu_r2, 0, fh_(37, 39)}, 0, 1, 263}};
+static PeepConstraint const c54[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)}};
+static PeepOp const p55_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(40, 5)}, 0, 2, 209}};
+static PeepConstraint const c55[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)}};
+static PeepOp const p56_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(40, 41)}, 0, 1, 263}};
+static PeepConstraint const c56[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)}};
+static PeepOp const p57_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 1, 370},
+  {{pot_opinset_m, 0, pu_r1, 2, fh_(131, 132)}, 0, 0, 0}};
+static PeepConstraint const c57[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 255},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p58_ops[] = {
+  {{pot_op, 0, pu_r1+pu_r4, 0, J_MOVC+J_ALIGN4}, p_dead_r1, 3, 257},
+  {{pot_none, 0, pu_r4, 0, 0}, 0, 6, 6},
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 5)}, 0, 6, 12}};
+static PeepConstraint const c58[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(2, pf_r1)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(2, 0), fb_(0, pf_r3)}};
+static PeepOp const p59_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(42, 39)}, 0, 1, 213}};
+static PeepConstraint const c59[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p60_ops[] = {
+  {{pot_op, pu_r1+pu_r2, pu_r1+pu_r2, 0, J_MOVDIR}, p_dead_r3, 1, 370},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(43, 39)}, 0, 3, 254}};
+static PeepConstraint const c60[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p61_ops[] = {
+  {{pot_op, pu_r1+pu_r2, pu_r1+pu_r2+pu_r3, 0, J_MOVDIR}, p_dead_r3, 4, 150},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVDK}, 0, 2, 341}};
+static PeepConstraint const c61[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p62_ops[] = {
+  {{pot_and, 0, pu_r3+pu_r4, 0, fh_(44, 23)}, p_dead_r3, 3, 147},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(45, 5)}, 0, 1, 370}};
+static PeepConstraint const c62[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p63_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r4, 0, fh_(46, 23)}, p_dead_r2, 4, 146},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(45, 5)}, 0, 1, 370}};
+static PeepConstraint const c63[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p64_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r4, 0, fh_(47, 23)}, p_dead_r2, 5, 28},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(45, 5)}, 0, 1, 370}};
+static PeepConstraint const c64[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p65_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r4, 0, fh_(48, 26)}, p_dead_r2, 5, 23},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(45, 5)}, 0, 1, 370}};
+static PeepConstraint const c65[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p66_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(44, 23)}, p_dead_r3, 2, 237},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c66[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p67_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(46, 23)}, p_dead_r2, 3, 236},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c67[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p68_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(47, 23)}, p_dead_r2, 3, 251},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c68[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p69_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(48, 26)}, p_dead_r2, 4, 142},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c69[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p70_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, p_dead_r2, 1, 370},
+  {{pot_opinset_m, pu_r1, pu_r1, 2, fh_(165, 166)}, 0, 2, 339}};
+static PeepConstraint const c70[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p71_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(2, 5)}, p_dead_r2, 3, 248},
+  {{pot_opinset_m, pu_r1, pu_r1, 2, fh_(165, 166)}, 0, 1, 370}};
+static PeepConstraint const c71[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p72_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_CALLR}, p_dead_r3, 4, 138},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(50, 5)}, 0, 1, 370}};
+static PeepConstraint const c72[] = {
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_LR},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 3, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p73_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_CALLR}, p_dead_r3, 4, 134},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(51, 5)}, 0, 1, 370}};
+static PeepConstraint const c73[] = {
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_LR},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), R_LR},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p74_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_TAILCALLR}, p_dead_r3, 4, 130},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(50, 5)}, 0, 1, 370}};
+static PeepConstraint const c74[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p75_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_TAILCALLR}, p_dead_r3, 4, 126},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(51, 5)}, 0, 1, 370}};
+static PeepConstraint const c75[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p76_ops[] = {
+  {{pot_and, 0, pu_r1+pu_r3, 0, fh_(4, 5)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1, 0, J_MOVR}, 0, 0, 0}};
+static PeepConstraint const c76[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r1)}};
+static PeepOp const p77_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(52, 53)}, p_dead_r1, 3, 245},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 370}};
+static PeepConstraint const c77[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p78_ops[] = {
+  {{pot_opinset_m, pu_r1, pu_r2+pu_r3, 2, fh_(172, 173)}, p_dead_r2, 5, 18},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 370},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(54, 10)}, 0, 1, 370}};
+static PeepConstraint const c78[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r3), fb_(2, pf_r1)},
+  {pct_ge, 0, pft_exprn, pft_field, 9, fb_(2, pf_r3)}};
+static PeepOp const p79_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(33, 10)}, 0, 1, 370},
+  {{pot_op_m, 0, pu_r1, 0, fh_(175, 72)}, 0, 0, 0},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c79[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_exprn, pft_field, 10, fb_(2, pf_r3)}};
+static PeepOp const p80_ops[] = {
+  {{pot_op, 0, 0, 0, J_ANDK}, p_dead_r2, 0, 0},
+  {{pot_op, 0, pu_r1+pu_r2, 0, J_SHRK+J_SIGNED}, p_dead_r2, 2, 337},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2, 0, fh_(115, 79)}, 0, 1, 370}};
+static PeepConstraint const c80[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_le, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_exprn, pft_exprn, 11, 13}};
+static PeepOp const p81_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 176)}, 0, 1, 389},
+  {{pot_opinset, 0, 0, 2, fh_(0, 180)}, p_dead_r2, 1, 370},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(55, 28)}, 0, 2, 335}};
+static PeepConstraint const c81[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p82_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 176)}, 0, 1, 389},
+  {{pot_opinset, 0, 0, 2, fh_(0, 180)}, 0, 1, 370},
+  {{pot_and, 0, pu_r1, 0, fh_(55, 28)}, 0, 1, 328}};
+static PeepConstraint const c82[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p83_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(56, 3)}, 0, 2, 333},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c83[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p84_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(57, 58)}, 0, 3, 242},
+  {{pot_and, 0, pu_r1+pu_r2, 0, fh_(59, 58)}, 0, 0, 0}};
+static PeepConstraint const c84[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p85_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(57, 58)}, 0, 3, 242},
+  {{pot_and, 0, pu_r1+pu_r2, 0, fh_(59, 60)}, 0, 0, 0}};
+static PeepConstraint const c85[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p86_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(61, 26)}, p_dead_r3, 1, 332},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(62, 3)}, 0, 1, 386}};
+static PeepConstraint const c86[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_exprn, pft_val, 15, 1}};
+static PeepOp const p87_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(63, 26)}, p_dead_r2, 2, 331},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(62, 3)}, 0, 1, 386}};
+static PeepConstraint const c87[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_exprn, pft_val, 15, 1}};
+static PeepOp const p88_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(47, 26)}, p_dead_r2, 2, 329},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(62, 3)}, 0, 1, 386}};
+static PeepConstraint const c88[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_exprn, pft_val, 15, 1}};
+static PeepOp const p89_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(48, 26)}, p_dead_r2, 3, 239},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(62, 3)}, 0, 1, 386}};
+static PeepConstraint const c89[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_exprn, pft_val, 15, 1}};
+static PeepOp const p90_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(64, 65)}, 0, 1, 320},
+  {{pot_op, 0, pu_r1, 0, J_ADCON+J_BASEALIGN4}, 0, 0, 0}};
+static PeepConstraint const c90[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_val, 16, 0}};
+static PeepOp const p91_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(66, 65)}, 0, 1, 320},
+  {{pot_op, 0, pu_r1, 0, J_ADCON+J_BASEALIGN4}, 0, 0, 0}};
+static PeepConstraint const c91[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_val, 16, 0}};
+static PeepOp const p92_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(64, 65)}, 0, 1, 320}};
+static PeepConstraint const c92[] = {
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_or, 0, pft_val, pft_val, 3, 4},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_NOFP, 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_FP}};
+static PeepOp const p93_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(66, 65)}, 0, 1, 320}};
+static PeepConstraint const c93[] = {
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_or, 0, pft_val, pft_val, 3, 4},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_NOFP, 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_FP}};
+static PeepOp const p94_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(64, 65)}, 0, 1, 320}};
+static PeepConstraint const c94[] = {
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_NOFP, 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p95_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(66, 65)}, 0, 1, 320}};
+static PeepConstraint const c95[] = {
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_NOFP, 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP}};
+static PeepOp const p96_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3, 0, fh_(67, 68)}, 0, 4, 122},
+  {{pot_none, 0, pu_r4, 0, 0}, 0, 6, 0}};
+static PeepConstraint const c96[] = {
+  {pct_or, 0, pft_val, pft_val, 3, 4},
+  {pct_negate, 0, pft_val, pft_none, 5, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_NO_UNALIGNED_LOADS, 0},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_ne, 0, pft_exprn, pft_val, 17, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p97_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3, 0, fh_(69, 68)}, 0, 4, 118},
+  {{pot_none, 0, pu_r4, 0, 0}, 0, 6, 0}};
+static PeepConstraint const c97[] = {
+  {pct_or, 0, pft_val, pft_val, 3, 4},
+  {pct_negate, 0, pft_val, pft_none, 5, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_NO_UNALIGNED_LOADS, 0},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_ne, 0, pft_exprn, pft_val, 17, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p98_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 176)}, 0, 1, 389},
+  {{pot_opinset, 0, 0, 2, fh_(0, 180)}, p_dead_r2, 1, 370},
+  {{pot_and, 0, pu_r3, 0, fh_(4, 5)}, 0, 2, 327}};
+static PeepConstraint const c98[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p99_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 176)}, 0, 1, 389},
+  {{pot_opinset, 0, 0, 2, fh_(0, 180)}, 0, 1, 370},
+  {{pot_and, 0, pu_r3, 0, fh_(4, 5)}, 0, 1, 328}};
+static PeepConstraint const c99[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p100_ops[] = {
+  {{pot_opinset_m, 0, pu_r3, 4, fh_(115, 252)}, p_dead_r3, 2, 237},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c100[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p101_ops[] = {
+  {{pot_opinset_m, 0, pu_r2, 4, fh_(115, 252)}, p_dead_r2, 3, 236},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c101[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)}};
+static PeepOp const p102_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_CALLR}, p_dead_r3, 4, 114},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ADDK}, 0, 1, 370}};
+static PeepConstraint const c102[] = {
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_LR},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 3, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p103_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_CALLR}, p_dead_r3, 4, 110},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(175, 44)}, 0, 1, 370}};
+static PeepConstraint const c103[] = {
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_LR},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), R_LR},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p104_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_CALLR}, p_dead_r3, 4, 106},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(175, 45)}, 0, 1, 370}};
+static PeepConstraint const c104[] = {
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_LR},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), R_LR},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p105_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_TAILCALLR}, p_dead_r3, 4, 102},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ADDK}, 0, 1, 370}};
+static PeepConstraint const c105[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p106_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_TAILCALLR}, p_dead_r3, 4, 98},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(175, 44)}, 0, 1, 370}};
+static PeepConstraint const c106[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p107_ops[] = {
+  {{pot_op, 0, pu_r3+pu_r4, 0, J_TAILCALLR}, p_dead_r3, 4, 94},
+  {{pot_op_m, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(175, 45)}, 0, 1, 370}};
+static PeepConstraint const c107[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_negate, 0, pft_val, pft_none, 2, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_INTERWORK, 0}};
+static PeepOp const p108_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(37, 38)}, 0, 3, 212}};
+static PeepConstraint const c108[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p109_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_andnot, 0, 0, 0, fh_(37, 39)}, 0, 2, 311}};
+static PeepConstraint const c109[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p110_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(40, 5)}, 0, 3, 209}};
+static PeepConstraint const c110[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p111_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(40, 41)}, 0, 2, 311}};
+static PeepConstraint const c111[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p112_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, 0, pu_r2, 0, fh_(42, 39)}, 0, 2, 213}};
+static PeepConstraint const c112[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p113_ops[] = {
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c113[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p114_ops[] = {
+  {{pot_opinset_m, 0, 0, 4, fh_(219, 256)}, p_dead_r1, 2, 325},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c114[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p115_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(70, 3)}, p_dead_r2, 3, 233},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(54, 3)}, 0, 1, 370}};
+static PeepConstraint const c115[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p116_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(71, 5)}, p_dead_r3, 1, 388},
+  {{pot_and, 0, 0, 0, fh_(70, 5)}, p_dead_r2, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(54, 5)}, 0, 2, 323}};
+static PeepConstraint const c116[] = {
+  {pct_ne, 0, pft_exprn, pft_val, 8, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 19, 0},
+  {pct_gt, 0, pft_field, pft_exprn, fb_(1, pf_r3), 22},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p117_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(266, 267)}, p_dead_r2+p_dead_r3, 3, 230},
+  {{pot_and, 0, 0, 0, fh_(36, 5)}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(54, 5)}, 0, 2, 321}};
+static PeepConstraint const c117[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r3), fb_(2, pf_r1)},
+  {pct_le, 0, pft_field, pft_exprn, fb_(2, pf_r3), 9}};
+static PeepOp const p118_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3, 0, fh_(72, 5)}, p_dead_r1+p_dead_r2+p_dead_r3, 3, 90},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 370}};
+static PeepConstraint const c118[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_exprn, pft_val, 23, 0}};
+static PeepOp const p119_ops[] = {
+  {{pot_and, 0, pu_r2+pu_r3, 0, fh_(72, 5)}, p_dead_r1+p_dead_r2, 4, 90},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 370}};
+static PeepConstraint const c119[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_exprn, pft_val, 23, 0}};
+static PeepOp const p120_ops[] = {
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 269)}, 0, 0, 0},
+  {{pot_opinset, 0, 0, 2, fh_(0, 271)}, 0, 0, 0}};
+static PeepConstraint const c120[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r2), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p121_ops[] = {
+  {{pot_opinset_m, 0, 0, 3, fh_(115, 273)}, p_dead_r2, 1, 319},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 387}};
+static PeepConstraint const c121[] = {
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 28, fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 27, 0}};
+static PeepOp const p122_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(115, 276)}, p_dead_r2, 2, 319},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVK}, 0, 1, 387}};
+static PeepConstraint const c122[] = {
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 28, fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 27, 0}};
+static PeepOp const p123_ops[] = {
+  {{pot_op, 0, pu_r3, 0, J_MOVDIR}, 0, 4, 86},
+  {{pot_op, pu_r1+pu_r2, pu_r1+pu_r2+pu_r3, 0, J_MOVDIR}, 0, 1, 370}};
+static PeepConstraint const c123[] = {
+  {pct_gt, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_gt, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p124_ops[] = {
+  {{pot_op, 0, pu_r3, 0, J_MOVDIR}, 0, 4, 86},
+  {{pot_op, pu_r1+pu_r2, pu_r1+pu_r2+pu_r3, 0, J_MOVDIR}, 0, 1, 370}};
+static PeepConstraint const c124[] = {
+  {pct_lt, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_lt, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p125_ops[] = {
+  {{pot_op, 0, pu_r2+pu_r3, 0, J_MOVIDR}, 0, 4, 82},
+  {{pot_op, pu_r1, pu_r1+pu_r2+pu_r3, 0, J_MOVIDR}, 0, 1, 370}};
+static PeepConstraint const c125[] = {
+  {pct_gt, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_gt, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p126_ops[] = {
+  {{pot_op, 0, pu_r2+pu_r3, 0, J_MOVIDR}, 0, 4, 82},
+  {{pot_op, pu_r1, pu_r1+pu_r2+pu_r3, 0, J_MOVIDR}, 0, 1, 370}};
+static PeepConstraint const c126[] = {
+  {pct_lt, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)},
+  {pct_lt, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p127_ops[] = {
+  {{pot_and, pu_r1, pu_r1, 0, fh_(73, 41)}, 0, 1, 370},
+  {{pot_op, 0, pu_r3, 0, J_MOVDIR}, 0, 4, 78}};
+static PeepConstraint const c127[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 4},
+  {pct_gt, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_SP, 0}};
+static PeepOp const p128_ops[] = {
+  {{pot_op, pu_r1+pu_r2, pu_r1+pu_r2+pu_r3, 0, J_MOVDIR}, p_dead_r3, 4, 74},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(74, 39)}, 0, 0, 0}};
+static PeepConstraint const c128[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p129_ops[] = {
+  {{pot_and, 0, pu_r3+pu_r4, 0, fh_(29, 26)}, p_dead_r3, 3, 147},
+  {{pot_and, pu_r1, pu_r1+pu_r2+pu_r3, 0, fh_(45, 5)}, 0, 1, 370}};
+static PeepConstraint const c129[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p130_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(29, 26)}, p_dead_r3, 2, 237},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c130[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p131_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(29, 26)}, p_dead_r3, 1, 332},
+  {{pot_op, pu_r1, pu_r1, 0, J_MULK}, 0, 1, 386}};
+static PeepConstraint const c131[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_exprn, pft_val, 15, 1}};
+static PeepOp const p132_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(32, 5)}, 0, 2, 317}};
+static PeepConstraint const c132[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0xffffffff}};
+static PeepOp const p133_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ORRK}, 0, 2, 317},
+  {{pot_op, pu_r1, pu_r1, 0, J_ANDK}, 0, 1, 370}};
+static PeepConstraint const c133[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_field, 29, fb_(1, pf_r3)}};
+static PeepOp const p134_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 278)}, 0, 2, 315}};
+static PeepConstraint const c134[] = {
+  {pct_ne, 0, pft_exprn, pft_val, 17, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 30, 0}};
+static PeepOp const p135_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(75, 3)}, p_dead_r2, 1, 76},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 370}};
+static PeepConstraint const c135[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_val, pft_exprn, 0, 34}};
+static PeepOp const p136_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(76, 77)}, 0, 3, 227},
+  {{pot_and, pu_r1+pu_r3, pu_r1+pu_r3, 0, fh_(0, 5)}, 0, 1, 370}};
+static PeepConstraint const c136[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p137_ops[] = {
+  {{pot_op, pu_r3, pu_r3, 0, J_ADDR}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(76, 5)}, 0, 3, 224}};
+static PeepConstraint const c137[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p138_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(76, 77)}, 0, 3, 221},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(35, 5)}, 0, 1, 370}};
+static PeepConstraint const c138[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p139_ops[] = {
+  {{pot_op, 0, 0, 0, J_SUBR}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(76, 5)}, 0, 3, 218}};
+static PeepConstraint const c139[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p140_ops[] = {
+  {{pot_op, 0, pu_r4, 0, J_B}, 0, 2, 313},
+  {{pot_op, pu_r1, 0, 0, J_ADDK}, 0, 1, 370}};
+static PeepConstraint const c140[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), RETLABV},
+  {pct_proc1, pcp_regset_unused, pft_val, pft_none, M_SP, 0},
+  {pct_proc1, pcp_pcs_flags, pft_val, pft_none, PCS_NOFP, 0}};
+static PeepOp const p141_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(78, 58)}, 0, 4, 70},
+  {{pot_and, 0, pu_r1+pu_r2, 0, fh_(79, 58)}, 0, 0, 0}};
+static PeepConstraint const c141[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)}};
+static PeepOp const p142_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(36, 3)}, 0, 3, 215},
+  {{pot_op, 0, pu_r1, 0, J_MOVK}, 0, 0, 0}};
+static PeepConstraint const c142[] = {
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 35, 0},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(0, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 36, 0},
+  {pct_or, 0, pft_val, pft_val, 6, 8},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 37, 0},
+  {pct_negate, 0, pft_val, pft_none, 5, 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 38, 0},
+  {pct_negate, 0, pft_val, pft_none, 7, 0}};
+static PeepOp const p143_ops[] = {
+  {{pot_opinset, 0, pu_r1, 2, fh_(0, 288)}, p_dead_r1, 1, 385},
+  {{pot_op, pu_r1, pu_r1+pu_r2, 0, J_ANDK}, 0, 1, 370}};
+static PeepConstraint const c143[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 255},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p144_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(37, 38)}, 0, 3, 212}};
+static PeepConstraint const c144[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)},
+  {pct_le, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p145_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_andnot, 0, 0, 0, fh_(37, 39)}, 0, 2, 311}};
+static PeepConstraint const c145[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)},
+  {pct_le, 0, pft_exprn, pft_val, 5, 0},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p146_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(40, 5)}, 0, 3, 209}};
+static PeepConstraint const c146[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)},
+  {pct_le, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p147_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(40, 41)}, 0, 2, 311}};
+static PeepConstraint const c147[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_exprn, pft_field, 5, fb_(1, pf_op)},
+  {pct_le, 0, pft_exprn, pft_val, 5, 0},
+  {pct_proc2, pcp_nostackrefsbelow, pft_inst, pft_field, fb_(1, 0), fb_(0, pf_r3)},
+  {pct_proc1, pcp_regset_unkilled, pft_exprn, pft_none, 18, 0}};
+static PeepOp const p148_ops[] = {
+  {{pot_opinset, 0, 0, 6, fh_(0, 109)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c148[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_le, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)}};
+static PeepOp const p149_ops[] = {
+  {{pot_opinset_m, 0, 0, 6, fh_(115, 116)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c149[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_le, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p150_ops[] = {
+  {{pot_opinset, 0, 0, 6, fh_(0, 109)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c150[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_ge, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)}};
+static PeepOp const p151_ops[] = {
+  {{pot_opinset_m, 0, 0, 6, fh_(115, 116)}, 0, 2, 222},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(2, 5)}, 0, 1, 370}};
+static PeepConstraint const c151[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_SP},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_ge, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_op)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)}};
+static PeepOp const p152_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(80, 26)}, p_dead_r2+p_dead_r3, 3, 66},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 2, 309}};
+static PeepConstraint const c152[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_exprn, pft_exprn, 40, 39}};
+static PeepOp const p153_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(81, 26)}, p_dead_r2+p_dead_r3, 4, 66},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 2, 309}};
+static PeepConstraint const c153[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_exprn, pft_exprn, 40, 39}};
+static PeepOp const p154_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(82, 26)}, p_dead_r2+p_dead_r3, 3, 206},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 2, 307}};
+static PeepConstraint const c154[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_exprn, pft_val, 43, 0xffffffff}};
+static PeepOp const p155_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(83, 26)}, p_dead_r2+p_dead_r3, 3, 203},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(33, 5)}, 0, 2, 305}};
+static PeepConstraint const c155[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_exprn, pft_val, 43, 0xffffffff}};
+static PeepOp const p156_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(84, 26)}, p_dead_r3, 2, 303},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 301}};
+static PeepConstraint const c156[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_exprn, 46, 45}};
+static PeepOp const p157_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(85, 26)}, p_dead_r2, 3, 200},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 301}};
+static PeepConstraint const c157[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_exprn, 46, 45}};
+static PeepOp const p158_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(86, 26)}, p_dead_r2, 3, 197},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 301}};
+static PeepConstraint const c158[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_exprn, 46, 45}};
+static PeepOp const p159_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(48, 26)}, p_dead_r2, 4, 62},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 301}};
+static PeepConstraint const c159[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_exprn, 46, 45}};
+static PeepOp const p160_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(84, 26)}, p_dead_r3, 2, 299},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 297}};
+static PeepConstraint const c160[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 48, 0xffffffff}};
+static PeepOp const p161_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(87, 26)}, p_dead_r2, 3, 194},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 297}};
+static PeepConstraint const c161[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 48, 0xffffffff}};
+static PeepOp const p162_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(86, 26)}, p_dead_r2, 3, 191},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 297}};
+static PeepConstraint const c162[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 48, 0xffffffff}};
+static PeepOp const p163_ops[] = {
+  {{pot_and, 0, pu_r2, 0, fh_(48, 26)}, p_dead_r2, 4, 58},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(33, 5)}, 0, 2, 297}};
+static PeepConstraint const c163[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_proc1, pcp_difficult_constant, pft_field, pft_none, fb_(1, pf_r3), 0},
+  {pct_proc1, pcp_difficult_constant, pft_exprn, pft_none, 44, 0},
+  {pct_eq, 0, pft_exprn, pft_val, 48, 0xffffffff}};
+static PeepOp const p164_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 319)}, 0, 1, 384},
+  {{pot_andnot, 0, 0, 0, fh_(88, 89)}, 0, 2, 295}};
+static PeepOp const p165_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(90, 91)}, 0, 2, 293},
+  {{pot_andnot, 0, 0, 0, fh_(88, 92)}, 0, 0, 0}};
+static PeepConstraint const c165[] = {
+  {pct_ne, 0, pft_exprn, pft_val, 49, Q_AL}};
+static PeepOp const p166_ops[] = {
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_opinset, 0, 0, 2, fh_(0, 325)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 269)}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 327)}, 0, 3, 188}};
+static PeepConstraint const c166[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r1)}};
+static PeepOp const p167_ops[] = {
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_opinset, 0, 0, 2, fh_(0, 325)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 269)}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 271)}, 0, 4, 54}};
+static PeepConstraint const c167[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r1)},
+  {pct_proc2, pcp_physreg_notread, pft_inst, pft_field, fb_(0, 0), fb_(2, pf_r1)}};
+static PeepOp const p168_ops[] = {
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_opinset, 0, 0, 2, fh_(0, 325)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_opinset, 0, 0, 2, fh_(0, 269)}, 0, 1, 370},
+  {{pot_andnot, 0, 0, 0, fh_(6, 10)}, p_dead_r1, 2, 291}};
+static PeepConstraint const c168[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r1)},
+  {pct_proc2, pcp_physreg_notread, pft_inst, pft_field, fb_(0, 0), fb_(2, pf_r1)}};
+static PeepOp const p169_ops[] = {
+  {{pot_op, 0, 0, 0, J_SHRK+J_SIGNED}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_SHLK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(93, 94)}, p_dead_r2+p_dead_r3, 0, 0},
+  {{pot_andnot, 0, 0, 0, fh_(95, 65)}, 0, 1, 382},
+  {{pot_andnot, 0, 0, 0, fh_(95, 65)}, 0, 1, 383}};
+static PeepConstraint const c169[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(4, pf_r1), fb_(2, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(3, pf_r1), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 16},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 16},
+  {pct_negate, 0, pft_val, pft_none, 9, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p170_ops[] = {
+  {{pot_op, 0, 0, 0, J_SHRK+J_SIGNED}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_SHLK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(93, 94)}, p_dead_r2+p_dead_r3, 0, 0},
+  {{pot_andnot, 0, 0, 0, fh_(95, 65)}, 0, 1, 382},
+  {{pot_andnot, 0, 0, 0, fh_(95, 65)}, 0, 1, 383}};
+static PeepConstraint const c170[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(4, pf_r1), fb_(2, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(3, pf_r1), fb_(2, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 16},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 16},
+  {pct_negate, 0, pft_val, pft_none, 9, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p171_ops[] = {
+  {{pot_op, 0, 0, 0, J_SHRK+J_SIGNED}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_SHLK}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(96, 97)}, p_dead_r2, 1, 381},
+  {{pot_andnot, 0, 0, 0, fh_(95, 65)}, 0, 1, 382}};
+static PeepConstraint const c171[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(3, pf_r1), fb_(2, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 16},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 16},
+  {pct_negate, 0, pft_val, pft_none, 8, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p172_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(98, 26)}, p_dead_r3, 2, 289},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c172[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r2), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_exprn, fb_(1, pf_op), 50}};
+static PeepOp const p173_ops[] = {
+  {{pot_and, 0, pu_r3, 0, fh_(99, 26)}, p_dead_r3, 2, 289},
+  {{pot_and, pu_r1, pu_r1+pu_r2, 0, fh_(49, 5)}, 0, 1, 370}};
+static PeepConstraint const c173[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)},
+  {pct_eq, 0, pft_field, pft_exprn, fb_(1, pf_op), 50}};
+static PeepOp const p174_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_ANDK}, 0, 3, 185},
+  {{pot_none, 0, 0, 0, 0}, 0, 4, 50},
+  {{pot_and, 0, pu_r1, 0, fh_(100, 5)}, 0, 1, 380}};
+static PeepConstraint const c174[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_exprn, pft_exprn, 11, 52},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_BIG_ENDIAN, 0},
+  {pct_negate, 0, pft_val, pft_none, 4, 0},
+  {pct_proc1, pcp_config, pft_val, pft_none, CONFIG_HALFWORD_SPT, 0}};
+static PeepOp const p175_ops[] = {
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_STACK}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_LABEL}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_CONDEXEC}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_B}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op_m, 0, 0, 0, fh_(338, 269)}, 0, 0, 0},
+  {{pot_op_m, 0, 0, 0, fh_(338, 57)}, 0, 4, 46}};
+static PeepConstraint const c175[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(7, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(5, pf_r1)},
+  {pct_proc2, pcp_physreg_notread, pft_inst, pft_field, fb_(0, 0), fb_(5, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(7, pf_r2), fb_(5, pf_r1)}};
+static PeepOp const p176_ops[] = {
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_op_m, 0, 0, 0, fh_(338, 325)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op_m, 0, 0, 0, fh_(338, 269)}, 0, 0, 0},
+  {{pot_op_m, 0, 0, 0, fh_(338, 57)}, 0, 4, 42}};
+static PeepConstraint const c176[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(2, pf_r1)},
+  {pct_proc2, pcp_physreg_notread, pft_inst, pft_field, fb_(0, 0), fb_(2, pf_r1)},
+  {pct_ne, 0, pft_field, pft_field, fb_(4, pf_r2), fb_(2, pf_r1)}};
+static PeepOp const p177_ops[] = {
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op_m, 0, 0, 0, fh_(338, 269)}, 0, 0, 0},
+  {{pot_prop, 0, 0, 0, p_loads_r1}, 0, 0, 0},
+  {{pot_op_m, 0, 0, 0, fh_(338, 325)}, 0, 0, 0},
+  {{pot_op_m, 0, 0, 0, fh_(338, 58)}, 0, 4, 42}};
+static PeepConstraint const c177[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(2, pf_r1)},
+  {pct_proc2, pcp_physreg_notread, pft_inst, pft_field, fb_(2, 0), fb_(0, pf_r1)}};
+static PeepOp const p178_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_SUBDR}, p_dead_r2, 3, 182},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(101, 5)}, 0, 1, 370}};
+static PeepConstraint const c178[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_fp_literal, pft_inst, pft_val, fb_(1, 0), J_RSBDK}};
+static PeepOp const p179_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_SUBFR}, p_dead_r2, 3, 179},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(101, 5)}, 0, 1, 370}};
+static PeepConstraint const c179[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_fp_literal, pft_inst, pft_val, fb_(1, 0), J_RSBFK}};
+static PeepOp const p180_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_DIVDR}, p_dead_r2, 3, 176},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(101, 5)}, 0, 1, 370}};
+static PeepConstraint const c180[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_fp_literal, pft_inst, pft_val, fb_(1, 0), J_RDVDK}};
+static PeepOp const p181_ops[] = {
+  {{pot_op, 0, pu_r2, 0, J_DIVDR}, p_dead_r2, 3, 176},
+  {{pot_and, pu_r1, pu_r1, 0, fh_(101, 5)}, 0, 1, 370}};
+static PeepConstraint const c181[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_fp_literal, pft_inst, pft_val, fb_(1, 0), J_RDVDK}};
+static PeepOp const p182_ops[] = {
+  {{pot_op, 0, 0, 0, J_MOVDIR}, p_dead_r3, 1, 370},
+  {{pot_op, pu_r1, pu_r1, 0, J_MOVIDR}, p_dead_r2+p_dead_r3, 1, 370}};
+static PeepConstraint const c182[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p183_ops[] = {
+  {{pot_op, 0, 0, 0, J_MOVDIR}, 0, 1, 370},
+  {{pot_op, 0, pu_r1, 0, J_MOVIDR}, p_dead_r2+p_dead_r3, 2, 287}};
+static PeepConstraint const c183[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r3)}};
+static PeepOp const p184_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 339)}, 0, 1, 379},
+  {{pot_op, 0, 0, 0, J_LDRK+J_ALIGN4}, 0, 2, 283},
+  {{pot_op, 0, 0, 0, J_LDRK+J_ALIGN4}, 0, 2, 285},
+  {{pot_opinset, 0, 0, 3, fh_(0, 341)}, 0, 1, 284},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c184[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r1), R_A3},
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r3), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r1), R_A4},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r1), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r2), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r1), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 4},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_A2},
+  {pct_proc1, pcp_asymmetric_fn, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p185_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 339)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_LDRK+J_ALIGN4}, 0, 2, 283},
+  {{pot_op, 0, 0, 0, J_LDRK+J_ALIGN4}, 0, 2, 285},
+  {{pot_opinset, 0, 0, 3, fh_(0, 341)}, 0, 1, 284},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c185[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r1), R_A3},
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r3), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r1), R_A4},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r1), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r2), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r1), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r2), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 4},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_A2},
+  {pct_proc1, pcp_symmetric_fn, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p186_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 339)}, 0, 1, 379},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 284},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 286},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c186[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r1), R_A3},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r1), R_A4},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r3), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r1), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_A2},
+  {pct_proc1, pcp_asymmetric_fn, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p187_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 339)}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 284},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 286},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVR}, 0, 1, 370}};
+static PeepConstraint const c187[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r1), R_A3},
+  {pct_eq, 0, pft_field, pft_val, fb_(4, pf_r3), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r1), R_A4},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r3), R_A2},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_r1), R_A1},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r1), R_A2},
+  {pct_proc1, pcp_symmetric_fn, pft_inst, pft_none, fb_(0, 0), 0}};
+static PeepOp const p188_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 344)}, 0, 1, 378},
+  {{pot_opinset, 0, 0, 2, fh_(0, 158)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1+pu_r2, 0, J_ADDR}, 0, 1, 377}};
+static PeepConstraint const c188[] = {
+  {pct_eq, 0, pft_exprn, pft_exprn, 53, 49},
+  {pct_eq, 0, pft_exprn, pft_val, 54, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r2), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(1, pf_r3)}};
+static PeepOp const p189_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 344)}, 0, 1, 378},
+  {{pot_opinset, 0, 0, 2, fh_(0, 158)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1+pu_r3, 0, J_ADDR}, 0, 1, 377}};
+static PeepConstraint const c189[] = {
+  {pct_eq, 0, pft_exprn, pft_exprn, 53, 49},
+  {pct_eq, 0, pft_exprn, pft_val, 54, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(1, pf_r3)}};
+static PeepOp const p190_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 344)}, 0, 1, 378},
+  {{pot_opinset, 0, 0, 2, fh_(0, 346)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1, 0, J_ADDK}, 0, 1, 377}};
+static PeepConstraint const c190[] = {
+  {pct_eq, 0, pft_exprn, pft_exprn, 53, 49},
+  {pct_eq, 0, pft_exprn, pft_val, 54, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r3)}};
+static PeepOp const p191_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 344)}, 0, 1, 376},
+  {{pot_opinset, 0, 0, 2, fh_(0, 160)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1+pu_r2, 0, J_ADDR}, 0, 1, 377}};
+static PeepConstraint const c191[] = {
+  {pct_eq, 0, pft_exprn, pft_exprn, 53, 49},
+  {pct_eq, 0, pft_exprn, pft_val, 54, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r2), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(1, pf_r3)}};
+static PeepOp const p192_ops[] = {
+  {{pot_opinset_m, 0, 0, 2, fh_(4, 344)}, 0, 1, 376},
+  {{pot_opinset, 0, 0, 2, fh_(0, 160)}, 0, 1, 370},
+  {{pot_op, 0, pu_r1+pu_r3, 0, J_ADDR}, 0, 1, 377}};
+static PeepConstraint const c192[] = {
+  {pct_eq, 0, pft_exprn, pft_exprn, 53, 49},
+  {pct_eq, 0, pft_exprn, pft_val, 54, 0},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r1), fb_(1, pf_r3)},
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(1, pf_r3)}};
+static PeepOp const p193_ops[] = {
+  {{pot_op, 0, 0, 0, J_ADCK}, 0, 1, 370},
+  {{pot_and, 0, pu_r1, 0, fh_(102, 103)}, 0, 2, 281}};
+static PeepConstraint const c193[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(0, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(0, pf_r3), 0},
+  {pct_proc1, pcp_regset_unused, pft_field, pft_none, fb_(1, pf_r1), 0}};
+static PeepOp const p194_ops[] = {
+  {{pot_op, 0, 0, 0, J_CONDEXEC}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 3, 173},
+  {{pot_op, 0, 0, 0, J_CONDEXEC+Q_HS}, 0, 1, 370}};
+static PeepConstraint const c194[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 1}};
+static PeepOp const p195_ops[] = {
+  {{pot_op, 0, 0, 0, J_CONDEXEC}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_CONDEXEC+Q_EQ}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_CONDEXEC+Q_NE}, 0, 1, 375},
+  {{pot_and, 0, 0, 0, fh_(104, 105)}, 0, 4, 38}};
+static PeepConstraint const c195[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(5, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 1},
+  {pct_eq, 0, pft_field, pft_field, fb_(3, pf_r1), fb_(1, pf_r1)}};
+static PeepOp const p196_ops[] = {
+  {{pot_op, 0, 0, 0, J_CONDEXEC}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_CONDEXEC+Q_NE}, 0, 0, 0},
+  {{pot_op, 0, 0, 0, J_MOVK}, 0, 1, 370},
+  {{pot_op, 0, 0, 0, J_CONDEXEC+Q_EQ}, 0, 1, 370},
+  {{pot_and, 0, 0, 0, fh_(106, 105)}, 0, 3, 170}};
+static PeepConstraint const c196[] = {
+  {pct_eq, 0, pft_field, pft_val, fb_(3, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 1},
+  {pct_eq, 0, pft_field, pft_field, fb_(3, pf_r1), fb_(1, pf_r1)}};
+static PeepOp const p197_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(40, 5)}, 0, 1, 374}};
+static PeepConstraint const c197[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(0, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)}};
+static PeepOp const p198_ops[] = {
+  {{pot_and, 0, 0, 0, fh_(2, 5)}, 0, 1, 370},
+  {{pot_and, pu_r2, pu_r2, 0, fh_(37, 38)}, 0, 1, 374}};
+static PeepConstraint const c198[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r3), fb_(0, pf_r3)},
+  {pct_ne, 0, pft_field, pft_val, fb_(1, pf_r2), R_SP},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(0, pf_r2)},
+  {pct_ne, 0, pft_field, pft_field, fb_(0, pf_r1), fb_(1, pf_r1)},
+  {pct_proc2, pcp_offsetinrange, pft_field, pft_field, fb_(0, pf_r3), fb_(1, pf_op)}};
+static PeepOp const p199_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 352)}, 0, 1, 372},
+  {{pot_opinset, 0, 0, 2, fh_(0, 356)}, 0, 1, 370},
+  {{pot_and, 0, pu_r1, 0, fh_(55, 28)}, 0, 1, 373}};
+static PeepConstraint const c199[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r2), fb_(2, pf_r1)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), 0},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p200_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 358)}, 0, 1, 371},
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 369},
+  {{pot_and, pu_r1, 0, 0, fh_(4, 107)}, p_dead_r1, 1, 370}};
+static PeepConstraint const c200[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), -1},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p201_ops[] = {
+  {{pot_opinset, 0, 0, 4, fh_(0, 362)}, 0, 1, 368},
+  {{pot_op, 0, 0, 0, J_ADDK}, 0, 1, 369},
+  {{pot_and, pu_r1, 0, 0, fh_(4, 107)}, p_dead_r1, 1, 370}};
+static PeepConstraint const c201[] = {
+  {pct_eq, 0, pft_field, pft_field, fb_(2, pf_r3), fb_(1, pf_r1)},
+  {pct_eq, 0, pft_field, pft_field, fb_(1, pf_r1), fb_(1, pf_r2)},
+  {pct_eq, 0, pft_field, pft_val, fb_(1, pf_r3), -1},
+  {pct_eq, 0, pft_field, pft_val, fb_(2, pf_cond), Q_AL}};
+static PeepOp const p202_ops[] = {
+  {{pot_opinset, 0, 0, 2, fh_(0, 366)}, 0, 0, 0},
+  {{pot_andnot, 0, 0, 0, fh_(88, 92)}, 0, 1, 367}};
+static PeepHole const patterns[] = {
+  {&p1_ops[0], &c1[0], 1, 1, 0, 0},
+  {&p2_ops[0], &c2[0], 1, 1, 0, 0},
+  {&p3_ops[0], &c3[0], 1, 1, 0, 0},
+  {&p4_ops[0], &c4[0], 1, 1, 0, 0},
+  {&p5_ops[0], &c5[0], 1, 1, 0, 0},
+  {&p6_ops[0], &c6[0], 3, 6, 0, G_ANY},
+  {&p7_ops[0], &c7[0], 3, 6, 0, G_ANY},
+  {&p8_ops[0], &c8[0], 2, 1, 0, 0},
+  {&p9_ops[0], &c9[0], 2, 1, 0, 0},
+  {&p10_ops[0], &c10[0], 2, 1, 0, 0},
+  {&p11_ops[0], &c11[0], 2, 1, 0, 0},
+  {&p12_ops[0], &c12[0], 2, 1, 0, 0},
+  {&p13_ops[0], &c13[0], 2, 1, 0, 0},
+  {&p14_ops[0], &c14[0], 2, 1, 0, 0},
+  {&p15_ops[0], &c15[0], 2, 1, 0, 0},
+  {&p16_ops[0], &c16[0], 2, 2, 0, 0},
+  {&p17_ops[0], &c17[0], 2, 2, 0, 0},
+  {&p18_ops[0], &c18[0], 2, 2, 0, 0},
+  {&p19_ops[0], &c19[0], 2, 2, 0, 0},
+  {&p20_ops[0], &c20[0], 2, 3, 0, 0},
+  {&p21_ops[0], &c21[0], 2, 1, 0, 0},
+  {&p22_ops[0], &c22[0], 2, 2, 0, 0},
+  {&p23_ops[0], &c23[0], 2, 3, 0, 0},
+  {&p24_ops[0], &c24[0], 2, 2, 0, 0},
+  {&p25_ops[0], &c25[0], 2, 3, 0, 0},
+  {&p26_ops[0], &c26[0], 2, 5, 0, 0},
+  {&p27_ops[0], &c27[0], 2, 4, 0, 0},
+  {&p28_ops[0], &c28[0], 2, 1, 0, 0},
+  {&p29_ops[0], &c29[0], 2, 1, 0, 0},
+  {&p30_ops[0], &c30[0], 2, 1, 0, 0},
+  {&p31_ops[0], &c31[0], 2, 2, 0, 0},
+  {&p32_ops[0], &c32[0], 2, 4, 0, 0},
+  {&p33_ops[0], &c33[0], 2, 4, 0, 0},
+  {&p34_ops[0], &c34[0], 2, 4, 0, 0},
+  {&p35_ops[0], &c35[0], 2, 1, 0, 0},
+  {&p36_ops[0], &c36[0], 2, 2, 0, 0},
+  {&p37_ops[0], &c37[0], 2, 1, 0, 0},
+  {&p38_ops[0], &c38[0], 2, 1, 0, 0},
+  {&p39_ops[0], &c39[0], 2, 1, 0, 0},
+  {&p40_ops[0], &c40[0], 2, 1, 0, 0},
+  {&p41_ops[0], &c41[0], 2, 1, 0, 0},
+  {&p42_ops[0], &c42[0], 2, 1, 0, 0},
+  {&p43_ops[0], &c43[0], 2, 1, 0, 0},
+  {&p44_ops[0], &c44[0], 2, 2, 0, 0},
+  {&p45_ops[0], &c45[0], 2, 1, 0, 0},
+  {&p46_ops[0], &c46[0], 2, 2, 0, 0},
+  {&p47_ops[0], &c47[0], 2, 2, 0, 0},
+  {&p48_ops[0], &c48[0], 2, 1, 0, 0},
+  {&p49_ops[0], &c49[0], 2, 1, 0, 0},
+  {&p50_ops[0], &c50[0], 2, 5, 0, 0},
+  {&p51_ops[0], &c51[0], 2, 6, 0, 0},
+  {&p52_ops[0], &c52[0], 2, 2, 0, 0},
+  {&p53_ops[0], &c53[0], 2, 6, 0, 0},
+  {&p54_ops[0], &c54[0], 2, 5, 0, 0},
+  {&p55_ops[0], &c55[0], 2, 5, 0, 0},
+  {&p56_ops[0], &c56[0], 2, 4, 0, 0},
+  {&p57_ops[0], &c57[0], 2, 3, 0, 0},
+  {&p58_ops[0], &c58[0], 3, 3, 0, 0},
+  {&p59_ops[0], &c59[0], 2, 3, 0, 0},
+  {&p60_ops[0], &c60[0], 2, 1, 0, 0},
+  {&p61_ops[0], &c61[0], 2, 1, 0, 0},
+  {&p62_ops[0], &c62[0], 2, 2, 0, 0},
+  {&p63_ops[0], &c63[0], 2, 2, 0, 0},
+  {&p64_ops[0], &c64[0], 2, 2, 0, 0},
+  {&p65_ops[0], &c65[0], 2, 2, 0, 0},
+  {&p66_ops[0], &c66[0], 2, 2, 0, 0},
+  {&p67_ops[0], &c67[0], 2, 2, 0, 0},
+  {&p68_ops[0], &c68[0], 2, 2, 0, 0},
+  {&p69_ops[0], &c69[0], 2, 2, 0, 0},
+  {&p70_ops[0], &c70[0], 2, 1, 0, 0},
+  {&p71_ops[0], &c71[0], 2, 1, 0, 0},
+  {&p72_ops[0], &c72[0], 2, 3, 0, G_ANYSTR},
+  {&p73_ops[0], &c73[0], 2, 4, 0, G_ANYSTR},
+  {&p74_ops[0], &c74[0], 2, 2, 0, G_ANYSTR},
+  {&p75_ops[0], &c75[0], 2, 2, 0, G_ANYSTR},
+  {&p76_ops[0], &c76[0], 2, 2, 0, 0},
+  {&p77_ops[0], &c77[0], 2, 1, 0, 0},
+  {&p78_ops[0], &c78[0], 3, 4, 0, 0},
+  {&p79_ops[0], &c79[0], 3, 4, 0, 0},
+  {&p80_ops[0], &c80[0], 3, 4, 0, 0},
+  {&p81_ops[0], &c81[0], 3, 3, 0, 0},
+  {&p82_ops[0], &c82[0], 3, 3, 0, 0},
+  {&p83_ops[0], &c83[0], 2, 1, 0, 0},
+  {&p84_ops[0], &c84[0], 2, 3, 0, G_POSSIBLEALIASSTR},
+  {&p85_ops[0], &c85[0], 2, 3, 0, G_POSSIBLEALIASSTR},
+  {&p86_ops[0], &c86[0], 2, 4, 0, 0},
+  {&p87_ops[0], &c87[0], 2, 4, 0, 0},
+  {&p88_ops[0], &c88[0], 2, 4, 0, 0},
+  {&p89_ops[0], &c89[0], 2, 4, 0, 0},
+  {&p90_ops[0], &c90[0], 2, 2, 0, 0},
+  {&p91_ops[0], &c91[0], 2, 2, 0, 0},
+  {&p92_ops[0], &c92[0], 1, 2, 0, 0},
+  {&p93_ops[0], &c93[0], 1, 2, 0, 0},
+  {&p94_ops[0], &c94[0], 1, 2, 0, 0},
+  {&p95_ops[0], &c95[0], 1, 2, 0, 0},
+  {&p96_ops[0], &c96[0], 2, 2, 0, 0},
+  {&p97_ops[0], &c97[0], 2, 2, 0, 0},
+  {&p98_ops[0], &c98[0], 3, 3, 0, 0},
+  {&p99_ops[0], &c99[0], 3, 3, 0, 0},
+  {&p100_ops[0], &c100[0], 2, 2, 0, 0},
+  {&p101_ops[0], &c101[0], 2, 2, 0, 0},
+  {&p102_ops[0], &c102[0], 2, 3, 0, 0},
+  {&p103_ops[0], &c103[0], 2, 4, 0, 0},
+  {&p104_ops[0], &c104[0], 2, 4, 0, 0},
+  {&p105_ops[0], &c105[0], 2, 2, 0, 0},
+  {&p106_ops[0], &c106[0], 2, 2, 0, 0},
+  {&p107_ops[0], &c107[0], 2, 2, 0, 0},
+  {&p108_ops[0], &c108[0], 2, 8, 0, G_NONSTACKMEM},
+  {&p109_ops[0], &c109[0], 2, 7, 0, G_NONSTACKMEM},
+  {&p110_ops[0], &c110[0], 2, 7, 0, G_NONSTACKMEM},
+  {&p111_ops[0], &c111[0], 2, 6, 0, G_NONSTACKMEM},
+  {&p112_ops[0], &c112[0], 2, 6, 0, G_NONSTACKMEM},
+  {&p113_ops[0], &c113[0], 2, 2, 0, 0},
+  {&p114_ops[0], &c114[0], 3, 2, 0, G_ANY},
+  {&p115_ops[0], &c115[0], 2, 2, 0, 0},
+  {&p116_ops[0], &c116[0], 3, 5, 0, G_ANY},
+  {&p117_ops[0], &c117[0], 3, 3, 0, G_ANY},
+  {&p118_ops[0], &c118[0], 2, 2, 0, 0},
+  {&p119_ops[0], &c119[0], 2, 2, 0, 0},
+  {&p120_ops[0], &c120[0], 3, 2, 0, 0},
+  {&p121_ops[0], &c121[0], 2, 4, 0, 0},
+  {&p122_ops[0], &c122[0], 2, 4, 0, 0},
+  {&p123_ops[0], &c123[0], 2, 2, 0, 0},
+  {&p124_ops[0], &c124[0], 2, 2, 0, 0},
+  {&p125_ops[0], &c125[0], 2, 2, 0, 0},
+  {&p126_ops[0], &c126[0], 2, 2, 0, 0},
+  {&p127_ops[0], &c127[0], 2, 4, 0, 0},
+  {&p128_ops[0], &c128[0], 2, 1, 0, G_ANYSTR},
+  {&p129_ops[0], &c129[0], 2, 1, 0, 0},
+  {&p130_ops[0], &c130[0], 2, 1, 0, 0},
+  {&p131_ops[0], &c131[0], 2, 3, 0, 0},
+  {&p132_ops[0], &c132[0], 1, 1, 0, 0},
+  {&p133_ops[0], &c133[0], 2, 2, 0, 0},
+  {&p134_ops[0], &c134[0], 1, 2, 0, 0},
+  {&p135_ops[0], &c135[0], 2, 2, 0, 0},
+  {&p136_ops[0], &c136[0], 2, 5, 0, 0},
+  {&p137_ops[0], &c137[0], 2, 6, 0, 0},
+  {&p138_ops[0], &c138[0], 2, 5, 0, 0},
+  {&p139_ops[0], &c139[0], 2, 6, 0, 0},
+  {&p140_ops[0], &c140[0], 2, 5, 0, 0},
+  {&p141_ops[0], &c141[0], 2, 2, 0, G_POSSIBLEALIASSTR},
+  {&p142_ops[0], &c142[0], 2, 5, 0, 0},
+  {&p143_ops[0], &c143[0], 2, 2, 0, 0},
+  {&p144_ops[0], &c144[0], 2, 9, 0, 0},
+  {&p145_ops[0], &c145[0], 2, 8, 0, 0},
+  {&p146_ops[0], &c146[0], 2, 8, 0, 0},
+  {&p147_ops[0], &c147[0], 2, 7, 0, 0},
+  {&p148_ops[0], &c148[0], 2, 6, 0, 0},
+  {&p149_ops[0], &c149[0], 2, 7, 0, 0},
+  {&p150_ops[0], &c150[0], 2, 6, 0, G_NONSTACKMEM},
+  {&p151_ops[0], &c151[0], 2, 7, 0, G_NONSTACKMEM},
+  {&p152_ops[0], &c152[0], 3, 4, 0, G_ANY},
+  {&p153_ops[0], &c153[0], 3, 4, 0, G_ANY},
+  {&p154_ops[0], &c154[0], 3, 4, 0, G_ANY},
+  {&p155_ops[0], &c155[0], 3, 4, 0, G_ANY},
+  {&p156_ops[0], &c156[0], 2, 5, 0, 0},
+  {&p157_ops[0], &c157[0], 2, 5, 0, 0},
+  {&p158_ops[0], &c158[0], 2, 5, 0, 0},
+  {&p159_ops[0], &c159[0], 2, 5, 0, 0},
+  {&p160_ops[0], &c160[0], 2, 5, 0, 0},
+  {&p161_ops[0], &c161[0], 2, 5, 0, 0},
+  {&p162_ops[0], &c162[0], 2, 5, 0, 0},
+  {&p163_ops[0], &c163[0], 2, 5, 0, 0},
+  {&p164_ops[0], 0, 2, 0, 0, 0},
+  {&p165_ops[0], &c165[0], 2, 1, 0, G_ALLOWCONDEXEC},
+  {&p166_ops[0], &c166[0], 5, 2, 0, G_ANY},
+  {&p167_ops[0], &c167[0], 5, 3, 0, G_ANY},
+  {&p168_ops[0], &c168[0], 5, 3, 0, G_ANY},
+  {&p169_ops[0], &c169[0], 5, 9, 0, G_ANY},
+  {&p170_ops[0], &c170[0], 5, 9, 0, G_ANY},
+  {&p171_ops[0], &c171[0], 4, 8, 0, G_ANY},
+  {&p172_ops[0], &c172[0], 2, 3, 0, 0},
+  {&p173_ops[0], &c173[0], 2, 2, 0, 0},
+  {&p174_ops[0], &c174[0], 3, 4, 0, 0},
+  {&p175_ops[0], &c175[0], 8, 5, 0, G_ANY},
+  {&p176_ops[0], &c176[0], 5, 5, 0, G_ANY},
+  {&p177_ops[0], &c177[0], 5, 4, 0, G_ANY},
+  {&p178_ops[0], &c178[0], 2, 2, 0, 0},
+  {&p179_ops[0], &c179[0], 2, 2, 0, 0},
+  {&p180_ops[0], &c180[0], 2, 2, 0, 0},
+  {&p181_ops[0], &c181[0], 2, 2, 0, 0},
+  {&p182_ops[0], &c182[0], 2, 3, 0, 0},
+  {&p183_ops[0], &c183[0], 2, 3, 0, 0},
+  {&p184_ops[0], &c184[0], 6, 12, 0, G_ANY},
+  {&p185_ops[0], &c185[0], 6, 12, 0, G_ANY},
+  {&p186_ops[0], &c186[0], 5, 7, 0, G_ANY},
+  {&p187_ops[0], &c187[0], 5, 7, 0, G_ANY},
+  {&p188_ops[0], &c188[0], 3, 5, 0, 0},
+  {&p189_ops[0], &c189[0], 3, 5, 0, 0},
+  {&p190_ops[0], &c190[0], 3, 4, 0, 0},
+  {&p191_ops[0], &c191[0], 3, 5, 0, 0},
+  {&p192_ops[0], &c192[0], 3, 5, 0, 0},
+  {&p193_ops[0], &c193[0], 2, 4, 0, 0},
+  {&p194_ops[0], &c194[0], 3, 1, 0, G_ANY},
+  {&p195_ops[0], &c195[0], 6, 4, 0, G_ANY},
+  {&p196_ops[0], &c196[0], 6, 3, 0, G_ANY},
+  {&p197_ops[0], &c197[0], 2, 5, 0, 0},
+  {&p198_ops[0], &c198[0], 2, 6, 0, 0},
+  {&p199_ops[0], &c199[0], 3, 3, 0, 0},
+  {&p200_ops[0], &c200[0], 3, 4, 0, 0},
+  {&p201_ops[0], &c201[0], 3, 4, 0, 0},
+  {&p202_ops[0], 0, 2, 0, 0, G_ALLOWCONDEXEC}
+};
+
+#define PeepholeMax 202
+#define MaxInst 8
+#if pcp_argct_movc_pres_r1r2 != 2
+ # error wrong argument count for pcp_movc_pres_r1r2
+#endif
+#if pcp_argct_regset_unused != 1
+ # error wrong argument count for pcp_regset_unused
+#endif
+#if pcp_argct_regset_unkilled != 1
+ # error wrong argument count for pcp_regset_unkilled
+#endif
+#if pcp_argct_notcall != 1
+ # error wrong argument count for pcp_notcall
+#endif
+#if pcp_argct_notleafproc != 0
+ # error wrong argument count for pcp_notleafproc
+#endif
+#if pcp_argct_difficult_constant != 1
+ # error wrong argument count for pcp_difficult_constant
+#endif
+#if pcp_argct_offsetinrange != 2
+ # error wrong argument count for pcp_offsetinrange
+#endif
+#if pcp_argct_nostackrefsbelow != 2
+ # error wrong argument count for pcp_nostackrefsbelow
+#endif
+#if pcp_argct_pcs_flags != 1
+ # error wrong argument count for pcp_pcs_flags
+#endif
+#if pcp_argct_config != 1
+ # error wrong argument count for pcp_config
+#endif
+#if pcp_argct_physreg_notread != 2
+ # error wrong argument count for pcp_physreg_notread
+#endif
+#if pcp_argct_fp_literal != 2
+ # error wrong argument count for pcp_fp_literal
+#endif
+#if pcp_argct_asymmetric_fn != 1
+ # error wrong argument count for pcp_asymmetric_fn
+#endif
+#if pcp_argct_symmetric_fn != 1
+ # error wrong argument count for pcp_symmetric_fn
+#endif
+#if pep_argct_bit != 1
+ # error wrong argument count for pep_bit
+#endif
+#if pep_argct_shift_p != 1
+ # error wrong argument count for pep_shift_p
+#endif
+#if pep_argct_q_swap != 1
+ # error wrong argument count for pep_q_swap
+#endif
+#if pep_argct_shift_k != 2
+ # error wrong argument count for pep_shift_k
+#endif
+#if pep_argct_log2 != 1
+ # error wrong argument count for pep_log2
+#endif
+#if pep_argct_lsb != 1
+ # error wrong argument count for pep_lsb
+#endif
+#if pep_argct_q_tounsigned != 1
+ # error wrong argument count for pep_q_tounsigned
+#endif
+#if pep_argct_shift_op != 1
+ # error wrong argument count for pep_shift_op
+#endif
+#if pep_argct_shift_d != 1
+ # error wrong argument count for pep_shift_d
+#endif
+static int const po_2[] = { /* B */
+	25,
+	80,
+	81,
+	97,
+	98,
+	139,
+	163,
+	164,
+	187,
+	188,
+	189,
+	190,
+	191,
+	198,
+	199,
+	200,
+	201
+};
+static int const po_4[] = { /* LDRK */
+	8,
+	12,
+	17,
+	50,
+	51,
+	83,
+	84,
+	120,
+	126,
+	133,
+	135,
+	137,
+	148,
+	150,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_5[] = { /* LDRR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	99,
+	100,
+	115,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_6[] = { /* LDRVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_7[] = { /* LDRV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_8[] = { /* LDRBK */
+	8,
+	12,
+	17,
+	50,
+	51,
+	90,
+	92,
+	94,
+	96,
+	121,
+	135,
+	137,
+	140,
+	148,
+	150,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_9[] = { /* LDRBR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	96,
+	99,
+	100,
+	115,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_10[] = { /* LDRBVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_11[] = { /* LDRBV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_12[] = { /* LDRWK */
+	8,
+	12,
+	17,
+	50,
+	51,
+	89,
+	91,
+	93,
+	95,
+	121,
+	148,
+	150,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_13[] = { /* LDRWR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	95,
+	115,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_14[] = { /* LDRWVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_15[] = { /* LDRWV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_16[] = { /* LDRLK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_17[] = { /* LDRLR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_18[] = { /* LDRLVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_19[] = { /* LDRLV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_20[] = { /* LDRFK */
+	8,
+	12,
+	17,
+	49,
+	147,
+	149,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_21[] = { /* LDRFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_22[] = { /* LDRFVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_23[] = { /* LDRFV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_24[] = { /* LDRDK */
+	8,
+	12,
+	17,
+	49,
+	147,
+	149,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_25[] = { /* LDRDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_26[] = { /* LDRDVK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_27[] = { /* LDRDV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_28[] = { /* STRK */
+	7,
+	8,
+	11,
+	12,
+	50,
+	51,
+	113,
+	120,
+	133,
+	135,
+	137,
+	148,
+	150
+};
+static int const po_29[] = { /* STRR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13,
+	48,
+	99,
+	100,
+	113
+};
+static int const po_30[] = { /* STRVK */
+	7,
+	11
+};
+static int const po_31[] = { /* STRV */
+	7,
+	11
+};
+static int const po_32[] = { /* STRBK */
+	7,
+	8,
+	11,
+	12,
+	46,
+	50,
+	51,
+	113,
+	120,
+	135,
+	137,
+	142,
+	148,
+	150
+};
+static int const po_33[] = { /* STRBR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13,
+	48,
+	99,
+	100,
+	113,
+	142
+};
+static int const po_34[] = { /* STRBVK */
+	7,
+	11
+};
+static int const po_35[] = { /* STRBV */
+	7,
+	11
+};
+static int const po_36[] = { /* STRWK */
+	7,
+	8,
+	11,
+	12,
+	50,
+	51,
+	148,
+	150
+};
+static int const po_37[] = { /* STRWR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13
+};
+static int const po_38[] = { /* STRWVK */
+	7,
+	11
+};
+static int const po_39[] = { /* STRWV */
+	7,
+	11
+};
+static int const po_40[] = { /* STRLK */
+	7,
+	8,
+	11,
+	12
+};
+static int const po_41[] = { /* STRLR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13
+};
+static int const po_42[] = { /* STRLVK */
+	7,
+	11
+};
+static int const po_43[] = { /* STRLV */
+	7,
+	11
+};
+static int const po_44[] = { /* STRFK */
+	7,
+	8,
+	11,
+	12,
+	49,
+	147,
+	149
+};
+static int const po_45[] = { /* STRFR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13,
+	48
+};
+static int const po_46[] = { /* STRFVK */
+	7,
+	11
+};
+static int const po_47[] = { /* STRFV */
+	7,
+	11
+};
+static int const po_48[] = { /* STRDK */
+	7,
+	8,
+	11,
+	12,
+	49,
+	147,
+	149
+};
+static int const po_49[] = { /* STRDR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13,
+	48
+};
+static int const po_50[] = { /* STRDVK */
+	7,
+	11
+};
+static int const po_51[] = { /* STRDV */
+	7,
+	11
+};
+static int const po_52[] = { /* LDRV1 */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_53[] = { /* PUSHR */
+	7,
+	11
+};
+static int const po_54[] = { /* MOVK */
+	17,
+	112,
+	119,
+	141,
+	165,
+	166,
+	167,
+	174,
+	175,
+	176
+};
+static int const po_55[] = { /* MOVR */
+	4,
+	9,
+	13,
+	17,
+	18,
+	19,
+	20,
+	75,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_56[] = { /* CMPK */
+	5,
+	6,
+	8,
+	12,
+	31,
+	32,
+	33,
+	45
+};
+static int const po_57[] = { /* CMPR */
+	8,
+	9,
+	12,
+	13,
+	45,
+	61,
+	62,
+	64,
+	65,
+	66,
+	68,
+	77,
+	85,
+	86,
+	88,
+	116,
+	151,
+	152,
+	153,
+	154,
+	155,
+	158,
+	159,
+	160,
+	162,
+	171
+};
+static int const po_58[] = { /* CHKLK */
+	8,
+	12
+};
+static int const po_59[] = { /* CHKLR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_60[] = { /* CHKUK */
+	8,
+	12
+};
+static int const po_61[] = { /* CHKUR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_64[] = { /* LDRLV1 */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_65[] = { /* PUSHL */
+	7,
+	11
+};
+static int const po_66[] = { /* MOVLK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_67[] = { /* MOVLR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_68[] = { /* LDRFV1 */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_69[] = { /* PUSHF */
+	7,
+	11
+};
+static int const po_70[] = { /* MOVFK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_71[] = { /* MOVFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_72[] = { /* LDRDV1 */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_73[] = { /* PUSHD */
+	7,
+	11,
+	47
+};
+static int const po_74[] = { /* MOVDK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_75[] = { /* MOVDR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_76[] = { /* ANDK */
+	0,
+	8,
+	12,
+	17,
+	34,
+	36,
+	40,
+	56,
+	78,
+	79,
+	82,
+	165,
+	166,
+	167,
+	173,
+	174,
+	175
+};
+static int const po_77[] = { /* ANDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	27,
+	28,
+	29,
+	30,
+	61,
+	62,
+	65,
+	66,
+	85,
+	86,
+	117,
+	118,
+	155,
+	156,
+	159,
+	160,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_78[] = { /* ORRK */
+	8,
+	12,
+	17,
+	35,
+	37,
+	41,
+	82,
+	131,
+	132,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_79[] = { /* ORRR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	62,
+	65,
+	66,
+	85,
+	86,
+	155,
+	156,
+	159,
+	160,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_80[] = { /* EORK */
+	8,
+	12,
+	17,
+	38,
+	42,
+	82,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_81[] = { /* EORR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	62,
+	65,
+	66,
+	85,
+	86,
+	155,
+	156,
+	159,
+	160,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_82[] = { /* ADDK */
+	3,
+	8,
+	12,
+	17,
+	39,
+	43,
+	52,
+	53,
+	54,
+	55,
+	58,
+	69,
+	70,
+	82,
+	107,
+	108,
+	109,
+	110,
+	111,
+	143,
+	144,
+	145,
+	146,
+	165,
+	166,
+	167,
+	174,
+	175,
+	196,
+	197
+};
+static int const po_83[] = { /* ADDR */
+	2,
+	8,
+	9,
+	12,
+	13,
+	17,
+	21,
+	22,
+	23,
+	24,
+	61,
+	62,
+	65,
+	66,
+	85,
+	86,
+	115,
+	136,
+	155,
+	156,
+	159,
+	160,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_84[] = { /* CALLK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175,
+	183,
+	184,
+	185,
+	186
+};
+static int const po_85[] = { /* CALLR */
+	17,
+	71,
+	72,
+	101,
+	102,
+	103,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_86[] = { /* MULK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_87[] = { /* MULR */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_88[] = { /* CMPFK */
+	8,
+	12,
+	45
+};
+static int const po_89[] = { /* CMPFR */
+	8,
+	9,
+	12,
+	13,
+	45
+};
+static int const po_90[] = { /* CHKNEFK */
+	8,
+	12
+};
+static int const po_91[] = { /* CHKNEFR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_92[] = { /* CHKNEDK */
+	8,
+	12
+};
+static int const po_93[] = { /* CHKNEDR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_94[] = { /* CHKNEK */
+	8,
+	12
+};
+static int const po_95[] = { /* CHKNER */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_96[] = { /* OPSYSK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_97[] = { /* CSE_LOADR */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_98[] = { /* INIT */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_101[] = { /* ADCONF */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_102[] = { /* ADCOND */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_103[] = { /* STRING */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_104[] = { /* SUBK */
+	8,
+	12,
+	17,
+	82,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_105[] = { /* SUBR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	44,
+	61,
+	63,
+	65,
+	67,
+	85,
+	87,
+	115,
+	138,
+	155,
+	157,
+	159,
+	161,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_106[] = { /* DIVK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_107[] = { /* DIVR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_108[] = { /* RSBK */
+	8,
+	12,
+	17,
+	82,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_109[] = { /* RSBR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	63,
+	65,
+	67,
+	85,
+	87,
+	155,
+	157,
+	159,
+	161,
+	165,
+	166,
+	167,
+	171,
+	174,
+	175
+};
+static int const po_110[] = { /* REMK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_111[] = { /* REMR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_112[] = { /* SHLK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_113[] = { /* SHLR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_114[] = { /* SHRK */
+	8,
+	12,
+	17,
+	114,
+	134,
+	165,
+	166,
+	167,
+	168,
+	169,
+	170,
+	174,
+	175
+};
+static int const po_115[] = { /* SHRR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_116[] = { /* INLINE1 */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_117[] = { /* NEGR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_118[] = { /* NOTR */
+	9,
+	13,
+	17,
+	128,
+	129,
+	130,
+	165,
+	166,
+	167,
+	172,
+	174,
+	175
+};
+static int const po_119[] = { /* ADCONV */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_120[] = { /* USEF */
+	7,
+	11
+};
+static int const po_121[] = { /* INITF */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_122[] = { /* ADDFK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_123[] = { /* ADDFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_124[] = { /* MULFK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_125[] = { /* MULFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_126[] = { /* INLINE1F */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_127[] = { /* SUBFK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_128[] = { /* SUBFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175,
+	178
+};
+static int const po_129[] = { /* DIVFK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_130[] = { /* DIVFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_131[] = { /* NEGFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_132[] = { /* FLTFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_133[] = { /* FIXFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_134[] = { /* MOVDFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_135[] = { /* MOVIFR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_136[] = { /* ADCON */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_137[] = { /* USED */
+	7,
+	11
+};
+static int const po_138[] = { /* INITD */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_139[] = { /* CMPDK */
+	8,
+	12,
+	45
+};
+static int const po_140[] = { /* CMPDR */
+	8,
+	9,
+	12,
+	13,
+	45
+};
+static int const po_141[] = { /* ADDDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_142[] = { /* ADDDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_143[] = { /* MULDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_144[] = { /* MULDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_145[] = { /* MOVIDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	124,
+	125,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_146[] = { /* INLINE1D */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_147[] = { /* SUBDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_148[] = { /* SUBDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175,
+	177
+};
+static int const po_149[] = { /* DIVDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_150[] = { /* DIVDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175,
+	179,
+	180
+};
+static int const po_151[] = { /* NEGDR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_152[] = { /* FLTDR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_153[] = { /* FIXDR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_154[] = { /* MOVFDR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_155[] = { /* CSE_WORD1 */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_156[] = { /* CSE_WORD2 */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_157[] = { /* CLRC */
+	16
+};
+static int const po_158[] = { /* MOVC */
+	15,
+	16,
+	57
+};
+static int const po_159[] = { /* TAILCALLK */
+	17,
+	26,
+	165,
+	166,
+	167,
+	174,
+	175,
+	183,
+	184,
+	185,
+	186
+};
+static int const po_160[] = { /* TAILCALLR */
+	9,
+	13,
+	17,
+	26,
+	73,
+	74,
+	104,
+	105,
+	106,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_165[] = { /* RESULT2 */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_166[] = { /* FNCON */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_167[] = { /* MOVDIR */
+	9,
+	13,
+	17,
+	59,
+	60,
+	122,
+	123,
+	127,
+	165,
+	166,
+	167,
+	174,
+	175,
+	181,
+	182
+};
+static int const po_168[] = { /* MOVFIR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_170[] = { /* EXTEND */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_171[] = { /* RORK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_172[] = { /* RORR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_178[] = { /* CONDEXEC */
+	80,
+	81,
+	97,
+	98,
+	163,
+	164,
+	187,
+	188,
+	189,
+	190,
+	191,
+	193,
+	194,
+	195,
+	198,
+	199,
+	200,
+	201
+};
+static int const po_180[] = { /* MOVLIR */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_181[] = { /* MOVILR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_184[] = { /* CASEBRANCH */
+	7,
+	11
+};
+static int const po_185[] = { /* USE */
+	7,
+	11
+};
+static int const po_186[] = { /* SCCK */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_187[] = { /* BZ */
+	8,
+	12
+};
+static int const po_190[] = { /* ADJUST */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_191[] = { /* RSBDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_192[] = { /* RSBDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_193[] = { /* RDVDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_194[] = { /* RDVDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_195[] = { /* RSBDK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_196[] = { /* RSBDR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_197[] = { /* RDVFK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_198[] = { /* RDVFR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_199[] = { /* MLAR */
+	10,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_200[] = { /* MLAK */
+	8,
+	10,
+	12,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_201[] = { /* MULL */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_202[] = { /* MLAL */
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_203[] = { /* ADCONLL */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_206[] = { /* FIXDRM */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_207[] = { /* FIXDRM */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_210[] = { /* BINRK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_211[] = { /* BINRR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_212[] = { /* BINRRK */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_213[] = { /* BINRRR */
+	8,
+	9,
+	10,
+	12,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_214[] = { /* MOVK */
+	17,
+	112,
+	119,
+	141,
+	165,
+	166,
+	167,
+	174,
+	175,
+	176
+};
+static int const po_215[] = { /* MOVR */
+	4,
+	9,
+	13,
+	17,
+	18,
+	19,
+	20,
+	75,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_216[] = { /* MOVRK */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_217[] = { /* MOVRR */
+	9,
+	10,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_218[] = { /* CMPK */
+	5,
+	6,
+	8,
+	12,
+	31,
+	32,
+	33,
+	45
+};
+static int const po_219[] = { /* CMPR */
+	8,
+	9,
+	12,
+	13,
+	45,
+	61,
+	62,
+	64,
+	65,
+	66,
+	68,
+	77,
+	85,
+	86,
+	88,
+	116,
+	151,
+	152,
+	153,
+	154,
+	155,
+	158,
+	159,
+	160,
+	162,
+	171
+};
+static int const po_220[] = { /* CMPRK */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_221[] = { /* CMPRR */
+	8,
+	9,
+	10,
+	12,
+	13,
+	14
+};
+static int const po_222[] = { /* LDRK */
+	8,
+	12,
+	17,
+	50,
+	51,
+	83,
+	84,
+	120,
+	126,
+	133,
+	135,
+	137,
+	148,
+	150,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_223[] = { /* LDRR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	48,
+	99,
+	100,
+	115,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_224[] = { /* LDRKW */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_225[] = { /* LDRRW */
+	9,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_226[] = { /* STRK */
+	7,
+	8,
+	11,
+	12,
+	50,
+	51,
+	113,
+	120,
+	133,
+	135,
+	137,
+	148,
+	150
+};
+static int const po_227[] = { /* STRR */
+	7,
+	8,
+	9,
+	11,
+	12,
+	13,
+	48,
+	99,
+	100,
+	113
+};
+static int const po_228[] = { /* STRKW */
+	7,
+	11
+};
+static int const po_229[] = { /* STRRW */
+	7,
+	9,
+	11,
+	13
+};
+static int const po_230[] = { /* LDM */
+	7,
+	11
+};
+static int const po_231[] = { /* LDMW */
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_232[] = { /* STM */
+	7,
+	11
+};
+static int const po_233[] = { /* STMW */
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_234[] = { /* MRS */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_235[] = { /* MSR */
+	9,
+	13
+};
+static int const po_237[] = { /* SWP */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_238[] = { /* SWPB */
+	8,
+	9,
+	12,
+	13,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_241[] = { /* MRC */
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_242[] = { /* MCR */
+	7,
+	11
+};
+static int const po_243[] = { /* LDC */
+	8,
+	12
+};
+static int const po_245[] = { /* STC */
+	8,
+	12
+};
+static int const po_249[] = { /* POPMB */
+	8,
+	12
+};
+static int const po_250[] = { /* PUSHC */
+	1,
+	15,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_251[] = { /* CALLI */
+	10,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_252[] = { /* CALLIR */
+	9,
+	10,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_253[] = { /* TAILCALLI */
+	10,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_254[] = { /* TAILCALLIR */
+	9,
+	10,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_255[] = { /* CALLX */
+	10,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_256[] = { /* CALLXR */
+	9,
+	10,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_257[] = { /* TAILCALLX */
+	10,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_258[] = { /* TAILCALLXR */
+	9,
+	10,
+	13,
+	14,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_261[] = { /* ADCK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175,
+	192
+};
+static int const po_262[] = { /* ADCR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	62,
+	65,
+	66,
+	85,
+	86,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_263[] = { /* SBCK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_264[] = { /* SBCR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	63,
+	65,
+	67,
+	85,
+	87,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_265[] = { /* RSCK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_266[] = { /* RSCR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	61,
+	63,
+	65,
+	67,
+	85,
+	87,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_267[] = { /* TSTK */
+	8,
+	12
+};
+static int const po_268[] = { /* TSTR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_269[] = { /* TEQK */
+	8,
+	12
+};
+static int const po_270[] = { /* TEQR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_271[] = { /* BICK */
+	8,
+	12,
+	17,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_272[] = { /* BICR */
+	8,
+	9,
+	12,
+	13,
+	17,
+	85,
+	86,
+	165,
+	166,
+	167,
+	174,
+	175
+};
+static int const po_273[] = { /* CMNK */
+	8,
+	12
+};
+static int const po_274[] = { /* CMNR */
+	8,
+	9,
+	12,
+	13
+};
+static int const po_275[] = { /* MVNK */
+	8,
+	12
+};
+static int const po_276[] = { /* MVNR */
+	8,
+	9,
+	12,
+	13
+};
+
+static struct { int i; int const *peepv; } const peepholeperop[] = {
+	{0, 0},
+	{0, 0},
+	{17, &po_2[0]},
+	{0, 0},
+	{19, &po_4[0]},
+	{14, &po_5[0]},
+	{6, &po_6[0]},
+	{6, &po_7[0]},
+	{20, &po_8[0]},
+	{15, &po_9[0]},
+	{6, &po_10[0]},
+	{6, &po_11[0]},
+	{17, &po_12[0]},
+	{13, &po_13[0]},
+	{6, &po_14[0]},
+	{6, &po_15[0]},
+	{8, &po_16[0]},
+	{10, &po_17[0]},
+	{6, &po_18[0]},
+	{6, &po_19[0]},
+	{11, &po_20[0]},
+	{11, &po_21[0]},
+	{6, &po_22[0]},
+	{6, &po_23[0]},
+	{11, &po_24[0]},
+	{11, &po_25[0]},
+	{6, &po_26[0]},
+	{6, &po_27[0]},
+	{13, &po_28[0]},
+	{10, &po_29[0]},
+	{2, &po_30[0]},
+	{2, &po_31[0]},
+	{14, &po_32[0]},
+	{11, &po_33[0]},
+	{2, &po_34[0]},
+	{2, &po_35[0]},
+	{8, &po_36[0]},
+	{6, &po_37[0]},
+	{2, &po_38[0]},
+	{2, &po_39[0]},
+	{4, &po_40[0]},
+	{6, &po_41[0]},
+	{2, &po_42[0]},
+	{2, &po_43[0]},
+	{7, &po_44[0]},
+	{7, &po_45[0]},
+	{2, &po_46[0]},
+	{2, &po_47[0]},
+	{7, &po_48[0]},
+	{7, &po_49[0]},
+	{2, &po_50[0]},
+	{2, &po_51[0]},
+	{6, &po_52[0]},
+	{2, &po_53[0]},
+	{10, &po_54[0]},
+	{13, &po_55[0]},
+	{8, &po_56[0]},
+	{26, &po_57[0]},
+	{2, &po_58[0]},
+	{4, &po_59[0]},
+	{2, &po_60[0]},
+	{4, &po_61[0]},
+	{0, 0},
+	{0, 0},
+	{6, &po_64[0]},
+	{2, &po_65[0]},
+	{6, &po_66[0]},
+	{8, &po_67[0]},
+	{6, &po_68[0]},
+	{2, &po_69[0]},
+	{6, &po_70[0]},
+	{8, &po_71[0]},
+	{6, &po_72[0]},
+	{3, &po_73[0]},
+	{6, &po_74[0]},
+	{8, &po_75[0]},
+	{17, &po_76[0]},
+	{27, &po_77[0]},
+	{14, &po_78[0]},
+	{21, &po_79[0]},
+	{11, &po_80[0]},
+	{21, &po_81[0]},
+	{30, &po_82[0]},
+	{28, &po_83[0]},
+	{10, &po_84[0]},
+	{11, &po_85[0]},
+	{8, &po_86[0]},
+	{6, &po_87[0]},
+	{3, &po_88[0]},
+	{5, &po_89[0]},
+	{2, &po_90[0]},
+	{4, &po_91[0]},
+	{2, &po_92[0]},
+	{4, &po_93[0]},
+	{2, &po_94[0]},
+	{4, &po_95[0]},
+	{6, &po_96[0]},
+	{6, &po_97[0]},
+	{6, &po_98[0]},
+	{0, 0},
+	{0, 0},
+	{6, &po_101[0]},
+	{6, &po_102[0]},
+	{6, &po_103[0]},
+	{9, &po_104[0]},
+	{24, &po_105[0]},
+	{8, &po_106[0]},
+	{10, &po_107[0]},
+	{9, &po_108[0]},
+	{21, &po_109[0]},
+	{8, &po_110[0]},
+	{10, &po_111[0]},
+	{8, &po_112[0]},
+	{10, &po_113[0]},
+	{13, &po_114[0]},
+	{10, &po_115[0]},
+	{8, &po_116[0]},
+	{8, &po_117[0]},
+	{12, &po_118[0]},
+	{6, &po_119[0]},
+	{2, &po_120[0]},
+	{6, &po_121[0]},
+	{8, &po_122[0]},
+	{10, &po_123[0]},
+	{8, &po_124[0]},
+	{10, &po_125[0]},
+	{8, &po_126[0]},
+	{8, &po_127[0]},
+	{11, &po_128[0]},
+	{8, &po_129[0]},
+	{10, &po_130[0]},
+	{8, &po_131[0]},
+	{8, &po_132[0]},
+	{8, &po_133[0]},
+	{8, &po_134[0]},
+	{8, &po_135[0]},
+	{6, &po_136[0]},
+	{2, &po_137[0]},
+	{6, &po_138[0]},
+	{3, &po_139[0]},
+	{5, &po_140[0]},
+	{8, &po_141[0]},
+	{10, &po_142[0]},
+	{8, &po_143[0]},
+	{10, &po_144[0]},
+	{12, &po_145[0]},
+	{8, &po_146[0]},
+	{8, &po_147[0]},
+	{11, &po_148[0]},
+	{8, &po_149[0]},
+	{12, &po_150[0]},
+	{8, &po_151[0]},
+	{8, &po_152[0]},
+	{8, &po_153[0]},
+	{8, &po_154[0]},
+	{8, &po_155[0]},
+	{8, &po_156[0]},
+	{1, &po_157[0]},
+	{3, &po_158[0]},
+	{11, &po_159[0]},
+	{14, &po_160[0]},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{8, &po_165[0]},
+	{6, &po_166[0]},
+	{15, &po_167[0]},
+	{8, &po_168[0]},
+	{0, 0},
+	{8, &po_170[0]},
+	{8, &po_171[0]},
+	{10, &po_172[0]},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{18, &po_178[0]},
+	{0, 0},
+	{8, &po_180[0]},
+	{10, &po_181[0]},
+	{0, 0},
+	{0, 0},
+	{2, &po_184[0]},
+	{2, &po_185[0]},
+	{6, &po_186[0]},
+	{2, &po_187[0]},
+	{0, 0},
+	{0, 0},
+	{8, &po_190[0]},
+	{8, &po_191[0]},
+	{10, &po_192[0]},
+	{8, &po_193[0]},
+	{10, &po_194[0]},
+	{8, &po_195[0]},
+	{10, &po_196[0]},
+	{8, &po_197[0]},
+	{10, &po_198[0]},
+	{8, &po_199[0]},
+	{10, &po_200[0]},
+	{6, &po_201[0]},
+	{5, &po_202[0]},
+	{6, &po_203[0]},
+	{0, 0},
+	{0, 0},
+	{8, &po_206[0]},
+	{8, &po_207[0]},
+	{0, 0},
+	{0, 0},
+	{8, &po_210[0]},
+	{10, &po_211[0]},
+	{10, &po_212[0]},
+	{12, &po_213[0]},
+	{10, &po_214[0]},
+	{13, &po_215[0]},
+	{8, &po_216[0]},
+	{10, &po_217[0]},
+	{8, &po_218[0]},
+	{26, &po_219[0]},
+	{4, &po_220[0]},
+	{6, &po_221[0]},
+	{19, &po_222[0]},
+	{14, &po_223[0]},
+	{6, &po_224[0]},
+	{8, &po_225[0]},
+	{13, &po_226[0]},
+	{10, &po_227[0]},
+	{2, &po_228[0]},
+	{4, &po_229[0]},
+	{2, &po_230[0]},
+	{5, &po_231[0]},
+	{2, &po_232[0]},
+	{5, &po_233[0]},
+	{6, &po_234[0]},
+	{2, &po_235[0]},
+	{0, 0},
+	{10, &po_237[0]},
+	{10, &po_238[0]},
+	{0, 0},
+	{0, 0},
+	{6, &po_241[0]},
+	{2, &po_242[0]},
+	{2, &po_243[0]},
+	{0, 0},
+	{2, &po_245[0]},
+	{0, 0},
+	{0, 0},
+	{0, 0},
+	{2, &po_249[0]},
+	{7, &po_250[0]},
+	{8, &po_251[0]},
+	{10, &po_252[0]},
+	{8, &po_253[0]},
+	{10, &po_254[0]},
+	{8, &po_255[0]},
+	{10, &po_256[0]},
+	{8, &po_257[0]},
+	{10, &po_258[0]},
+	{0, 0},
+	{0, 0},
+	{9, &po_261[0]},
+	{16, &po_262[0]},
+	{8, &po_263[0]},
+	{16, &po_264[0]},
+	{8, &po_265[0]},
+	{16, &po_266[0]},
+	{2, &po_267[0]},
+	{4, &po_268[0]},
+	{2, &po_269[0]},
+	{4, &po_270[0]},
+	{8, &po_271[0]},
+	{12, &po_272[0]},
+	{2, &po_273[0]},
+	{4, &po_274[0]},
+	{2, &po_275[0]},
+	{4, &po_276[0]}
+};
@@ -63,6 +63,8 @@ Dbg_Error dbg_ReadWord(Dbg_MCState *state, ARMword *word, ARMaddress addr);
 Dbg_Error Dbg_WriteHalf(Dbg_MCState *state, ARMaddress addr, ARMhword hword);
 Dbg_Error dbg_ReadByte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr);
 Dbg_Error dbg_WriteByte(Dbg_MCState *state, ARMaddress addr, Dbg_Byte byte);
+Dbg_Error dbg_ReadBytes(Dbg_MCState *state, Dbg_Byte *buf, ARMaddress addr,
+                        unsigned32 n);
 
 Dbg_Error dbg_StringToVarDef(Dbg_MCState *state,
                              const char *name,
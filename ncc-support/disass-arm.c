@@ -25,14 +25,22 @@
 #include <stdio.h>
 #include <string.h>
 
-static void disass_multiply(unsigned32 instr, char *out);
-static void disass_long_multiply(unsigned32 instr, char *out);
-static void disass_halfword_signed_transfer(unsigned32 instr, char *out);
-static void disass_swp(unsigned32 instr, char *out);
-static void disass_bx_blx_reg(unsigned32 instr, char *out);
-static void disass_clz(unsigned32 instr, char *out);
-static void disass_mrs(unsigned32 instr, char *out);
-static void disass_msr(unsigned32 instr, char *out);
+static void disass_multiply(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                            dis_cb_fn cb, char *out);
+static void disass_long_multiply(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                                 dis_cb_fn cb, char *out);
+static void disass_halfword_signed_transfer(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                                            dis_cb_fn cb, char *out);
+static void disass_swp(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out);
+static void disass_bx_blx_reg(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                              dis_cb_fn cb, char *out);
+static void disass_clz(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out);
+static void disass_mrs(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out);
+static void disass_msr(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out);
 
 // This only covers classic ARM 32-bit instructions that Norcroft emits:
 // data-processing, single data transfer, branches and SWI.
@@ -404,7 +412,8 @@ static void disass_branch(unsigned32 instr, unsigned32 pc, void *cb_arg,
     }
 }
 
-static void disass_swi(unsigned32 instr, char *out)
+static void disass_swi(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned32 imm24 = instr & 0x00FFFFFFu;
@@ -456,7 +465,8 @@ static char *append_core_reglist(char *p, unsigned list)
 }
 
 /* ARM block data transfer (LDM/STM) decoder. */
-static void disass_block_data_transfer(unsigned32 instr, char *out)
+static void disass_block_data_transfer(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned pbit = BITS(instr, 24, 24);
@@ -496,122 +506,109 @@ static void disass_block_data_transfer(unsigned32 instr, char *out)
     }
 }
 
+typedef void disass_fn(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out);
+
+typedef struct {
+    unsigned32 mask, value;
+    disass_fn *fn;                      /* NULL: leave as DCD */
+} DisassEntry;
+
+/* The classic ARM encodings, most specific first: the first entry whose
+   (instr & mask) == value decodes the word. */
+static const DisassEntry disass_table[] = {
+    /* BLX (immediate) – shares the branch encoding space but is
+       unconditional.  For now, leave it as DCD instead of mis-decoding
+       as BLNV. */
+    { 0xfe000000u, 0xfa000000u, NULL },
+    { 0x0ffffff0u, 0x012fff10u, disass_bx_blx_reg },            /* BX */
+    { 0x0ffffff0u, 0x012fff30u, disass_bx_blx_reg },            /* BLX (register) */
+    { 0x0fb00ff0u, 0x01000090u, disass_swp },                   /* SWP / SWPB */
+    { 0x0fff0ff0u, 0x016f0f10u, disass_clz },                   /* CLZ */
+    { 0x0fbf0fffu, 0x010f0000u, disass_mrs },                   /* MRS */
+    { 0x0db0f000u, 0x0120f000u, disass_msr },                   /* MSR */
+    { 0x0fc000f0u, 0x00000090u, disass_multiply },              /* MUL{S} */
+    { 0x0fc000f0u, 0x00200090u, disass_multiply },              /* MLA{S} */
+    { 0x0f8000f0u, 0x00800090u, disass_long_multiply },         /* UMULL/.../SMLAL */
+    { 0x0e0000f0u, 0x000000b0u, disass_halfword_signed_transfer },
+    { 0x0e000000u, 0x0a000000u, disass_branch },                /* B / BL */
+    { 0x0f000000u, 0x0f000000u, disass_swi },                   /* SWI */
+    { 0x0c000000u, 0x04000000u, disass_single_data_transfer },  /* LDR/STR{B} */
+    { 0x0e000000u, 0x08000000u, disass_block_data_transfer },   /* LDM/STM */
+    { 0x0c000000u, 0x00000000u, disass_data_processing }        /* AND ... MVN */
+};
+
+#define DISASS_NENTRIES ((int)(sizeof(disass_table)/sizeof(disass_table[0])))
+#define DISASS_CLASS(instr) (((instr) >> 25) & 7u)
+
+/* For each instruction class (bits 27:25) the indices of the table
+   entries which can match a word in it, in table order and ending in -1,
+   so that a word is only tested against its own handful of encodings. */
+static signed char disass_byclass[8][DISASS_NENTRIES + 1];
+static bool disass_byclass_built;
+
+static void disass_build_byclass(void)
+{
+    unsigned c;
+    for (c = 0; c < 8; c++) {
+        int i, n = 0;
+        for (i = 0; i < DISASS_NENTRIES; i++)
+            if ((((c << 25) ^ disass_table[i].value) &
+                 disass_table[i].mask & 0x0e000000u) == 0)
+                disass_byclass[c][n++] = (signed char)i;
+        disass_byclass[c][n] = -1;
+    }
+    disass_byclass_built = true;
+}
+
 void disass(uint64_t w, uint64_t oldq, const char* buf, void *cb_arg, dis_cb_fn cb)
 {
     unsigned32 instr = (unsigned32)w;
     unsigned32 pc    = (unsigned32)oldq;  /* byte offset within current function */
     char *out = (char *)buf;
+    unsigned cls = DISASS_CLASS(instr);
+    signed char const *ix;
 
     /* Default: show raw word as data. */
     sprintf(out, "DCD      %s%.8lX", g_hexprefix, (unsigned long)instr);
 
+    /* Coprocessor encodings live in classes 6 and 7; the only other one
+       the VFP/NEON decoder knows is VEOR (class 1, cond == 0xF). */
+    if (cls >= 6 || (cls == 1 && BITS(instr, 31, 28) == 0xFu)) {
 #if TARGET_HAS_VFP
-    // Try VFP/NEON disassembler for coprocessor 10/11 encodings.
-    if (disass_vfp(instr, pc, cb_arg, cb, out)) {
-        return;
-    }
+        // Try VFP/NEON disassembler for coprocessor 10/11 encodings.
+        if (disass_vfp(instr, pc, cb_arg, cb, out)) {
+            return;
+        }
 #endif
 
-    // Try obsolete FPA/FPE disassembler for CP1/CP2 encodings.
-    if (disass_fpa(instr, pc, cb_arg, cb, out)) {
-        return;
-    }
-
-    /* BLX (immediate) – shares the branch encoding space but is unconditional.
-       For now, leave it as DCD instead of mis-decoding as BLNV. */
-    if ((instr & 0xfe000000u) == 0xfa000000u) {
-        return;
-    }
-
-    /* BX / BLX (register). */
-    if ((instr & 0x0ffffff0u) == 0x012fff10u ||   /* BX */
-        (instr & 0x0ffffff0u) == 0x012fff30u) {   /* BLX (register) */
-        disass_bx_blx_reg(instr, out);
-        return;
-    }
-
-    /* SWP / SWPB. */
-    if ((instr & 0x0fb00ff0u) == 0x01000090u) {
-        disass_swp(instr, out);
-        return;
-    }
-
-    /* CLZ. */
-    if ((instr & 0x0fff0ff0u) == 0x016f0f10u) {
-        disass_clz(instr, out);
-        return;
-    }
-
-    /* MRS / MSR (status register moves). */
-    if ((instr & 0x0fbf0fffu) == 0x010f0000u) {
-        disass_mrs(instr, out);
-        return;
-    }
-    if ((instr & 0x0db0f000u) == 0x0120f000u) {
-        disass_msr(instr, out);
-        return;
-    }
-
-    /* Multiply / multiply-accumulate (MUL / MLA). */
-    if ((instr & 0x0FC000F0u) == 0x00000090u ||   /* MUL{S} */
-        (instr & 0x0FC000F0u) == 0x00200090u) {   /* MLA{S} */
-        disass_multiply(instr, out);
-        return;
-    }
-
-    /* 64-bit multiply family (UMULL/UMLAL/SMULL/SMLAL). */
-    if ((instr & 0x0F8000F0u) == 0x00800090u) {
-        disass_long_multiply(instr, out);
-        return;
-    }
-
-    /* Halfword and signed data transfer (LDRH/STRH/LDRSB/LDRSH). */
-    if ((instr & 0x0E0000F0u) == 0x000000B0u) {
-        disass_halfword_signed_transfer(instr, out);
-        return;
-    }
-
-    /* Branch / BL */
-    if ((instr & 0x0E000000u) == 0x0A000000u) {
-        disass_branch(instr, pc, cb_arg, cb, out);
-        return;
-    }
-
-    /* SWI */
-    if ((instr & 0x0F000000u) == 0x0F000000u) {
-        disass_swi(instr, out);
-        return;
-    }
-
-    /* Single data transfer (LDR/STR, LDRB/STRB) */
-    if ((instr & 0x0C000000u) == 0x04000000u) {
-        disass_single_data_transfer(instr, pc, cb_arg, cb, out);
-        return;
-    }
-
-    /* Block data transfer (LDM/STM). */
-    if ((instr & 0x0E000000u) == 0x08000000u) {
-        disass_block_data_transfer(instr, out);
-        return;
+        // Try obsolete FPA/FPE disassembler for CP1/CP2 encodings.
+        if (cls >= 6 && disass_fpa(instr, pc, cb_arg, cb, out)) {
+            return;
+        }
     }
 
-    /* Data processing (AND/EOR/SUB/ADD/... MOV/MVN). */
-    if ((instr & 0x0C000000u) == 0x00000000u) {
-        disass_data_processing(instr, pc, cb_arg, cb, out);
-        return;
+    if (!disass_byclass_built) disass_build_byclass();
+    for (ix = disass_byclass[cls]; *ix >= 0; ix++) {
+        DisassEntry const *e = &disass_table[*ix];
+        if ((instr & e->mask) == e->value) {
+            if (e->fn != NULL) e->fn(instr, pc, cb_arg, cb, out);
+            return;
+        }
     }
 
     /* Anything we don't understand is left as the DCD we printed at the top. */
 }
 
 /* ARM multiply / multiply-accumulate decoder (MUL / MLA). */
-static void disass_multiply(unsigned32 instr, char *out)
+static void disass_multiply(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                            dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned sbit = BITS(instr, 20, 20);
     unsigned acc  = BITS(instr, 21, 21);
-    unsigned rn   = BITS(instr, 19, 16);   /* accumulate register for MLA */
-    unsigned rd   = BITS(instr, 15, 12);
+    unsigned rd   = BITS(instr, 19, 16);
+    unsigned rn   = BITS(instr, 15, 12);   /* accumulate register for MLA */
     unsigned rs   = BITS(instr, 11, 8);
     unsigned rm   = BITS(instr, 3, 0);
     char mnem[8];
@@ -638,7 +635,8 @@ static void disass_multiply(unsigned32 instr, char *out)
 }
 
 /* ARM 64-bit multiply family decoder (UMULL/UMLAL/SMULL/SMLAL). */
-static void disass_long_multiply(unsigned32 instr, char *out)
+static void disass_long_multiply(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                                 dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned ubit = BITS(instr, 22, 22);  /* 0 = unsigned, 1 = signed */
@@ -673,7 +671,8 @@ static void disass_long_multiply(unsigned32 instr, char *out)
 /* ARM halfword & signed-data transfer decoder:
  * STRH, LDRH, LDRSB, LDRSH (immediate or register offset).
  */
-static void disass_halfword_signed_transfer(unsigned32 instr, char *out)
+static void disass_halfword_signed_transfer(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                                            dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned pbit = BITS(instr, 24, 24);
@@ -755,7 +754,8 @@ static void disass_halfword_signed_transfer(unsigned32 instr, char *out)
 }
 
 /* ARM single data swap: SWP / SWPB. */
-static void disass_swp(unsigned32 instr, char *out)
+static void disass_swp(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned rn   = BITS(instr, 19, 16);
@@ -779,7 +779,8 @@ static void disass_swp(unsigned32 instr, char *out)
 }
 
 /* ARM branch and exchange: BX / BLX (register form). */
-static void disass_bx_blx_reg(unsigned32 instr, char *out)
+static void disass_bx_blx_reg(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                              dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned rm   = BITS(instr, 3, 0);
@@ -795,7 +796,8 @@ static void disass_bx_blx_reg(unsigned32 instr, char *out)
 }
 
 /* ARM count-leading-zeros instruction: CLZ. */
-static void disass_clz(unsigned32 instr, char *out)
+static void disass_clz(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned rd   = BITS(instr, 15, 12);
@@ -809,7 +811,8 @@ static void disass_clz(unsigned32 instr, char *out)
 }
 
 /* ARM status register to general-purpose register: MRS. */
-static void disass_mrs(unsigned32 instr, char *out)
+static void disass_mrs(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned rd   = BITS(instr, 15, 12);
@@ -824,7 +827,8 @@ static void disass_mrs(unsigned32 instr, char *out)
 }
 
 /* ARM general-purpose register or immediate to status register: MSR. */
-static void disass_msr(unsigned32 instr, char *out)
+static void disass_msr(unsigned32 instr, unsigned32 pc, void *cb_arg,
+                       dis_cb_fn cb, char *out)
 {
     unsigned cond = BITS(instr, 31, 28);
     unsigned psr  = BITS(instr, 22, 22);  /* 0 = CPSR, 1 = SPSR */
@@ -206,18 +206,20 @@ bool disass_vfp(unsigned32 instr,
         return NO;
     }
 
-    /* Double-precision arithmetic: VADD.F64 / VSUB.F64 / VMUL.F64 / VDIV.F64 */
+    /* Double-precision arithmetic: VADD.F64 / VSUB.F64 / VMUL.F64 / VDIV.F64 / VMLA.F64 */
     {
         unsigned32 add_core = VFP_VADD_D & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 sub_core = VFP_VSUB_D & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 mul_core = VFP_VMUL_D & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 div_core = VFP_VDIV_D & ~(VFP_CONDMASK | VFP_REGMASK_DS);
+        unsigned32 mla_core = VFP_VMLA_D & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         const char *base = NULL;
 
         if (core == add_core) base = "VADD";
         else if (core == sub_core) base = "VSUB";
         else if (core == mul_core) base = "VMUL";
         else if (core == div_core) base = "VDIV";
+        else if (core == mla_core) base = "VMLA";
 
         if (base != NULL) {
             unsigned d  = vfp_decode_d_reg_from_D_Vd(instr);
@@ -234,17 +236,19 @@ bool disass_vfp(unsigned32 instr,
         }
     }
 
-    /* Single-precision arithmetic: VADD.F32 / VSUB.F32 / VMUL.F32 / VDIV.F32 */
+    /* Single-precision arithmetic: VADD.F32 / VSUB.F32 / VMUL.F32 / VDIV.F32 / VMLA.F32 */
     {
         unsigned32 add_core_s = VFP_VADD_S & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 sub_core_s = VFP_VSUB_S & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 mul_core_s = VFP_VMUL_S & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         unsigned32 div_core_s = VFP_VDIV_S & ~(VFP_CONDMASK | VFP_REGMASK_DS);
+        unsigned32 mla_core_s = VFP_VMLA_S & ~(VFP_CONDMASK | VFP_REGMASK_DS);
         const char *base = NULL;
         if (core == add_core_s) base = "VADD";
         else if (core == sub_core_s) base = "VSUB";
         else if (core == mul_core_s) base = "VMUL";
         else if (core == div_core_s) base = "VDIV";
+        else if (core == mla_core_s) base = "VMLA";
 
         if (base != NULL) {
             unsigned sd = vfp_decode_s_reg_from_D_Vd(instr);
@@ -311,8 +315,9 @@ bool disass_vfp(unsigned32 instr,
         }
     }
 
-    /* Single- and double-precision unary: VNEG/VABS */
+    /* Single- and double-precision unary: VNEG/VABS, and VMOV.F32 sD, sM */
     {
+        unsigned32 vmov_s_core = VFP_VMOV_S_S & ~(VFP_CONDMASK | VFP_SCALAR_REGMASK_DS);
         unsigned32 vneg_s_core = VFP_VNEG_S & ~(VFP_CONDMASK | VFP_SCALAR_REGMASK_DS);
         unsigned32 vneg_d_core = VFP_VNEG_D & ~(VFP_CONDMASK | VFP_SCALAR_REGMASK_DS);
         unsigned32 vabs_s_core = VFP_VABS_S & ~(VFP_CONDMASK | VFP_SCALAR_REGMASK_DS);
@@ -321,7 +326,8 @@ bool disass_vfp(unsigned32 instr,
         const char *base = NULL;
         bool single = false;
 
-        if (core_unary == vneg_s_core) { base = "VNEG"; single = true; }
+        if (core_unary == vmov_s_core) { base = "VMOV"; single = true; }
+        else if (core_unary == vneg_s_core) { base = "VNEG"; single = true; }
         else if (core_unary == vneg_d_core) { base = "VNEG"; single = false; }
         else if (core_unary == vabs_s_core) { base = "VABS"; single = true; }
         else if (core_unary == vabs_d_core) { base = "VABS"; single = false; }
@@ -356,6 +362,24 @@ bool disass_vfp(unsigned32 instr,
         }
     }
 
+    /* VMRS Rt, FPSCR / VMSR FPSCR, Rt */
+    {
+        unsigned32 core_rt = instr & ~(VFP_CONDMASK | (0xFu << 12));
+        unsigned rt = (instr >> 12) & 0xFu;
+        if (core_rt == (VFP_VMRS & ~VFP_CONDMASK) && rt != 15) {
+            p = emit_mnemonic(p, "VMRS", cond);
+            p = append_core_reg(p, rt);
+            p = append_str(p, ", fpscr");
+            return YES;
+        }
+        if (core_rt == (VFP_VMSR & ~VFP_CONDMASK)) {
+            p = emit_mnemonic(p, "VMSR", cond);
+            p = append_str(p, "fpscr, ");
+            p = append_core_reg(p, rt);
+            return YES;
+        }
+    }
+
     /* VCVT.S32.F64 (sD, dM) */
     {
         unsigned32 vcvt_s32_f64_core = VFP_VCVT_S32_F64 & ~(VFP_CONDMASK | VFP_SCALAR_REGMASK_DS);
@@ -617,8 +641,13 @@ bool disass_vfp(unsigned32 instr,
                 p = append_str(p, "[");
                 p = append_core_reg(p, rn);
                 if (offset != 0) {
+                    char *cb_start;
                     p = append_str(p, ", #");
+                    cb_start = p;
                     p = cb(D_LOAD, offset, 0, (int)instr, cb_arg, p);
+                    /* Not decorated: plain decimal, as for integer LDR. */
+                    if (p == cb_start)
+                        p += sprintf(p, "%ld", (long)offset);
                 }
                 p = append_str(p, "]");
             } else {
@@ -671,8 +700,13 @@ bool disass_vfp(unsigned32 instr,
                 p = append_str(p, "[");
                 p = append_core_reg(p, rn);
                 if (offset != 0) {
+                    char *cb_start;
                     p = append_str(p, ", #");
+                    cb_start = p;
                     p = cb(D_LOAD, offset, 0, (int)instr, cb_arg, p);
+                    /* Not decorated: plain decimal, as for integer LDR. */
+                    if (p == cb_start)
+                        p += sprintf(p, "%ld", (long)offset);
                 }
                 p = append_str(p, "]");
             } else {
@@ -726,8 +760,12 @@ bool disass_vfp(unsigned32 instr,
                 p = append_str(p, "[");
                 p = append_core_reg(p, rn);
                 if (offset != 0) {
+                    char *cb_start;
                     p = append_str(p, ", #");
+                    cb_start = p;
                     p = cb(D_STORE, offset, 0, (int)instr, cb_arg, p);
+                    if (p == cb_start)
+                        p += sprintf(p, "%ld", (long)offset);
                 }
                 p = append_str(p, "]");
             } else {
@@ -781,8 +819,12 @@ bool disass_vfp(unsigned32 instr,
                 p = append_str(p, "[");
                 p = append_core_reg(p, rn);
                 if (offset != 0) {
+                    char *cb_start;
                     p = append_str(p, ", #");
+                    cb_start = p;
                     p = cb(D_STORE, offset, 0, (int)instr, cb_arg, p);
+                    if (p == cb_start)
+                        p += sprintf(p, "%ld", (long)offset);
                 }
                 p = append_str(p, "]");
             } else {
@@ -804,23 +846,55 @@ bool disass_vfp(unsigned32 instr,
         }
     }
 
-    /* VPUSH {dD ...} */
+    /* VLDMIA/VSTMIA Rn{!}, {sD ...} or {dD ...} (other than VPOP) */
     {
-        unsigned32 vpush_d_core = VFP_VPUSH_D & ~(VFP_CONDMASK | VFP_LDST_REGMASK);
-        unsigned32 core_ld = instr & ~(VFP_CONDMASK | VFP_LDST_REGMASK);
-        if (core_ld == vpush_d_core) {
+        unsigned32 core_lm = instr & ~(VFP_CONDMASK | VFP_WRITEBACK | VFP_LDST_REGMASK | (1u << 20) | (1u << 8));
+        unsigned rn = (instr >> 16) & 0xFu;
+        if (core_lm == (VFP_VSTM_S & ~VFP_LDST_REGMASK) &&
+            (instr & VFP_UP) && rn != 13) {
+            int dbl = (instr >> 8) & 1u;
+            unsigned32 imm8 = instr & 0xFFu;
+            unsigned count = dbl ? imm8 / 2u : imm8;
+            unsigned r = dbl ? vfp_decode_d_reg_from_D_Vd(instr)
+                             : vfp_decode_s_reg_from_D_Vd(instr);
+            if (count == 0) count = 1;
+
+            p = emit_mnemonic(p, (instr & (1u << 20)) ? "VLDMIA" : "VSTMIA", cond);
+            p = append_core_reg(p, rn);
+            if (instr & VFP_WRITEBACK) *p++ = '!';
+            p = append_str(p, ", {");
+            p = dbl ? append_dreg(p, r) : append_sreg(p, r);
+            if (count > 1) {
+                *p++ = '-';
+                p = dbl ? append_dreg(p, r + count - 1)
+                        : append_sreg(p, r + count - 1);
+            }
+            *p++ = '}';
+            *p = '\0';
+            return YES;
+        }
+    }
+
+    /* VPUSH {sD ...} or {dD ...} */
+    {
+        unsigned32 vpush_core = VFP_VPUSH_D & ~(VFP_CONDMASK | VFP_LDST_REGMASK | (1u << 8));
+        unsigned32 core_ld = instr & ~(VFP_CONDMASK | VFP_LDST_REGMASK | (1u << 8));
+        if (core_ld == vpush_core) {
             const char *m = "VPUSH";
-            unsigned d   = vfp_decode_d_reg_from_D_Vd(instr);
+            int dbl = (instr >> 8) & 1u;
+            unsigned d   = dbl ? vfp_decode_d_reg_from_D_Vd(instr)
+                               : vfp_decode_s_reg_from_D_Vd(instr);
             unsigned32 imm8 = instr & 0xFFu;
-            unsigned count = imm8 / 2u;    /* each D is 8 bytes => imm = 2 * count */
+            unsigned count = dbl ? imm8 / 2u : imm8;    /* a D is 2 words */
             if (count == 0) count = 1;
 
             p = emit_mnemonic(p, m, cond);
             *p++ = '{';
-            p = append_dreg(p, d);
+            p = dbl ? append_dreg(p, d) : append_sreg(p, d);
             if (count > 1) {
                 *p++ = '-';
-                p = append_dreg(p, d + count - 1);
+                p = dbl ? append_dreg(p, d + count - 1)
+                        : append_sreg(p, d + count - 1);
             }
             *p++ = '}';
             *p = '\0';
@@ -828,23 +902,26 @@ bool disass_vfp(unsigned32 instr,
         }
     }
 
-    /* VPOP {dD ...} */
+    /* VPOP {sD ...} or {dD ...} */
     {
-        unsigned32 vpop_d_core = VFP_VPOP_D & ~(VFP_CONDMASK | VFP_LDST_REGMASK);
-        unsigned32 core_ld = instr & ~(VFP_CONDMASK | VFP_LDST_REGMASK);
-        if (core_ld == vpop_d_core) {
+        unsigned32 vpop_core = VFP_VPOP_D & ~(VFP_CONDMASK | VFP_LDST_REGMASK | (1u << 8));
+        unsigned32 core_ld = instr & ~(VFP_CONDMASK | VFP_LDST_REGMASK | (1u << 8));
+        if (core_ld == vpop_core) {
             const char *m = "VPOP";
-            unsigned d   = vfp_decode_d_reg_from_D_Vd(instr);
+            int dbl = (instr >> 8) & 1u;
+            unsigned d   = dbl ? vfp_decode_d_reg_from_D_Vd(instr)
+                               : vfp_decode_s_reg_from_D_Vd(instr);
             unsigned32 imm8 = instr & 0xFFu;
-            unsigned count = imm8 / 2u;
+            unsigned count = dbl ? imm8 / 2u : imm8;    /* a D is 2 words */
             if (count == 0) count = 1;
 
             p = emit_mnemonic(p, m, cond);
             *p++ = '{';
-            p = append_dreg(p, d);
+            p = dbl ? append_dreg(p, d) : append_sreg(p, d);
             if (count > 1) {
                 *p++ = '-';
-                p = append_dreg(p, d + count - 1);
+                p = dbl ? append_dreg(p, d + count - 1)
+                        : append_sreg(p, d + count - 1);
             }
             *p++ = '}';
             *p = '\0';
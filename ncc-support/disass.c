@@ -144,8 +144,9 @@ static const char *regname(unsigned r, RegType type)
     // Old Norcroft would always output lowercase register names.
 
     // Most registers are a prefix followed by the number.
-    // Return a short static buffer containing the value.
-    static char buf[8];
+    // Return a static buffer containing the value, sized for a prefix
+    // and any unsigned register number.
+    static char buf[1 + 10 + 1];
 
     char prefix = 'r';
 
@@ -175,8 +176,21 @@ static const char *regname(unsigned r, RegType type)
     else if (type == RegType_VFP_S)
         prefix = 's';
 
-    // no snprintf in old C libs.
-    sprintf(buf, "%c%u", prefix, r);
+    // Register numbers are small: spell them out rather than sprintf.
+    {
+        char *q = buf;
+        *q++ = prefix;
+        if (r >= 10) {
+            if (r >= 100) {
+                // no snprintf in old C libs.
+                sprintf(buf, "%c%u", prefix, r);
+                return buf;
+            }
+            *q++ = (char)('0' + r / 10);
+        }
+        *q++ = (char)('0' + r % 10);
+        *q = '\0';
+    }
 
     return buf;
 }
@@ -21,6 +21,7 @@ typedef struct FP_Gen {
   int32 (*restoresize)(int32 mask);
   void (*calleerestore)(int32 mask, int32 condition, FP_RestoreBase base, int32 offset);
   void (*saveargs)(int32);
+  bool (*expandcall)(Symstr const *name);   // optional: in place of J_CALLK
 } FP_Gen;
 
 struct DispDesc { int32 u_d, m; RealRegister r; };
@@ -37,6 +38,7 @@ struct InlineTable { char *name; Symstr const *sym; int32 op; };
 // Make ARM-specific static functions external. This does limit VFP to ARM...
 // (thumb has its own of the same name)
 extern void arm_addressability(int32 n);
+extern void arm_reservecode(int32 ninstr);
 extern void arm_ldm_flush(void);
 extern void arm_outinstr(int32 w);
 extern void arm_fpdesc_notespchange(int32 n);
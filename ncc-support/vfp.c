@@ -12,26 +12,33 @@
 #include "armops.h"
 #include "errors.h"
 #include "regalloc.h"
+#include "mcdep.h"
+#include "bind.h"
 
 #include "gen.h"
 #include "vfp.h"
 #include "vfpops.h"
 
-// Also NOTE: This only uses registers D0-D7 and S0-S15 STEP 2.
+// Register allocation: the allocator sees 15 float registers, R_F0..R_F0+14,
+// mapped to D0-D14. Arguments use D0-D7 and the var registers D8-D14, which
+// AAPCS makes callee-saved. D15 (S30) is the scratch register; a function
+// which uses it saves it with the var registers (see vfp_usesscratch). A
+// single precision value lives in the bottom half of its D register, so S1,
+// S3, ... are never allocated: the allocator has no notion of register pairs.
 
-// NOTE: My INVENTED AND NOT TO BE USED procedure call NOT-standard:
-// It only uses a simple register counter so considers S0 the same as D0,
-// S1 as D1. It converts the register size correctly, but is wasteful.
+// Calling standard: with -apcs /fpregargs the first 8 float/double arguments
+// are passed in D0-D7 using a simple register counter, so float arguments go in
+// S0, S2, ...
 
 #include <stdint.h>
 #include <string.h>
 
-// Pi Zero/Pi1 have VFP2, which only has 8 D registers and no VEOR.
-// Will become a command-line flag eventually.
+// Pi Zero/Pi1 have VFP2, which only has 16 D registers and no VEOR.
+// Set to 2 by -fpu vfpv2, which also enables short vectors (see below).
 int vfp_version = 3;
 
 #define VFP_SAVEREG_LOW R_F0 + NFLTARGREGS
-#define VFP_SAVEREG_TOP VFP_SAVEREG_LOW + NFLTVARREGS
+#define VFP_SAVEREG_TOP R_FSCRATCH + 1
 
 struct InlineTable inlinetable_vfp[] = {
     {"__r_abs",  0, VFP_VABS_S},
@@ -155,21 +162,41 @@ static bool vfp_materialise_literal(FloatCon *fc, bool is_double,
     return true;
 }
 
-// For double precision, map R_F0 upwards to VFP D0 upwards
+// For double precision, map R_F0 upwards to VFP D0 upwards. The scratch
+// register is only reached this way when it is saved and restored.
 static inline unsigned vfp_checkfreg_d(RealRegister r) {
-    if (r < R_F0 || r >= R_F0 + NFLTARGREGS + NFLTVARREGS)
+    if (r < R_F0 || (r >= R_F0 + NFLTARGREGS + NFLTVARREGS && r != R_FSCRATCH))
         syserr(syserr_gen_freg, (long)r);
 
     return (((int)r) & 0xf);
 }
 
-// For single precision, map R_F0..R_F7 to VFP S0..S15 STEP 2.
-// This is to temporarily re-use the FPA register allocator.
+// For single precision, use the bottom half of the same D register.
+// This is to re-use the FPA register allocator.
 static inline unsigned vfp_checkfreg_s(RealRegister r) {
-    if (r < R_F0 || r >= R_F0 + NFLTARGREGS + NFLTVARREGS)
-        syserr(syserr_gen_freg, (long)r);
+    return vfp_checkfreg_d(r) * 2;
+}
 
-    return (((int)r) & 0xf) * 2;
+// Whether vfp_show works ic through the scratch register. D15 is callee-saved
+// under AAPCS, so RealRegisterUse reports it corrupted and the function then
+// saves it with the var registers.
+bool vfp_usesscratch(Icode const *ic)
+{
+    switch (ic->op & J_TABLE_BITS) {
+        case J_CMPFK:
+            return ic->r3.f->floatbin.fb.val != 0;
+        case J_CMPDK:
+            return ic->r3.f->floatbin.db.msd != 0 || ic->r3.f->floatbin.db.lsd != 0;
+        case J_FIXFRM: case J_FIXDRM:
+        case J_FIXFR:  case J_FIXDR:
+        case J_ADDFK: case J_SUBFK: case J_RSBFK:
+        case J_MULFK: case J_DIVFK: case J_RDVFK:
+        case J_ADDDK: case J_SUBDK: case J_RSBDK:
+        case J_MULDK: case J_DIVDK: case J_RDVDK:
+            return true;
+        default:
+            return false;
+    }
 }
 
 static void vfp_show(const PendingOp *p);
@@ -178,13 +205,15 @@ static int32 vfp_restoresize(int32 mask);
 static void vfp_restoreregs(int32 mask, int32 condition,
                             FP_RestoreBase base, int32 offset);
 static void vfp_saveargs(int32 n);
+static bool vfp_expandcall(Symstr const *name);
 
 FP_Gen const vfp_gen = {
     vfp_show,
     vfp_saveregs,
     vfp_restoresize,
     vfp_restoreregs,
-    vfp_saveargs
+    vfp_saveargs,
+    vfp_expandcall
 };
 
 #define outinstr(X) arm_outinstr(X)
@@ -521,6 +550,14 @@ static void vfp_show(const PendingOp *p)
                 dmask     &= ~regbit(fr);
             }
 
+            // The rest are the words of an argument split between registers
+            // and the stack, which were pushed just before: pop them.
+            if (intmask != 0) {
+                arm_out_ldm_instr(OP_LDMFD | F_WRITEBACK | F_RN(R_SP) | intmask);
+                arm_adjustipvalue(R_SP, R_SP, 4 * bitcount(intmask));
+                used_ints |= intmask;
+            }
+
             // Mark used integer registers as having unknown values.
             // This doesn't necessarily write out all of r1 as fpa_show() does.
             // It's currently unclear if this is necessary or if returning
@@ -535,8 +572,9 @@ static void vfp_show(const PendingOp *p)
             /* If arguments have been pushed on the stack, we can load the fp value  */
             /* directly.  (It would be nice to ensure that if anything had been      */
             /* pushed on entry, the argument registers of the MOVIDR had).           */
+            /* The lower register holds the low word, as for J_MOVDIR.        */
             outinstr(VFP_VMOV_D_R_R | VFP_Dm(vfp_checkfreg_d(r1)) |
-                     VFP_Rt(R_(r3)) | VFP_Rt2(R_(r2)));
+                     VFP_Rt(R_(r2)) | VFP_Rt2(R_(r3)));
             break;
         }
 
@@ -968,19 +1006,247 @@ static void vfp_restoreregs(int32 mask, int32 condition,
     }
 }
 
+// Push incoming FP args D0..D{n-1} where cg_bindargs expects them: a narrow
+// float takes one word (the bottom half of its D register) and a double two,
+// with the first argument lowest. Runs of doubles go in one VPUSH.
 static void vfp_saveargs(int32 n)
 {
-    unsigned int list;
-    unsigned dd;
+    uint32 singles = currentfunction.fltargsingles;
+    int32 top = n, i;
+
+    while (top > 0) {
+        i = top - 1;
+        if (singles & (1u << i)) {
+            outinstr(VFP_VPUSH_S | VFP_Sd(vfp_checkfreg_s(R_F0 + i)) | 1);
+            arm_fpdesc_notespchange(4);
+        } else {
+            while (i > 0 && !(singles & (1u << (i - 1))))
+                --i;
+            outinstr(VFP_VPUSH_D | VFP_Dd(vfp_checkfreg_d(R_F0 + i)) | ((top - i) * 2));
+            arm_fpdesc_notespchange(8 * (top - i));
+        }
+        top = i;
+    }
+}
+
+// Short-vector loop kernels ---------------------------------------------------
+//
+// cg_loop hands simple float loops (see VK_* in mcdep.h) to the kernels below,
+// which are expanded in place of the call. They use VFPv1/v2 short-vector
+// mode: with FPSCR.LEN = VL, one VLDM/VMLA/VSTM moves or computes VL elements.
+// VFPv3 onwards dropped (or traps) short vectors, so only -fpu vfpv2 uses them.
+//
+// A call corrupts r0-r3, ip and D0-D7, so those are free here; D8-D15 are
+// callee-saved and are pushed around the kernel. Registers are used in banks
+// of VL: bank 0 holds the scalar (S0/D0), bank 1 the reduction accumulators,
+// banks 2 and 3 (D8-D15) the array elements. The loop counts are multiples of
+// VL, the caller mopping up the remainder.
+
+typedef struct {
+    char const *name;
+    int32 kind;
+    bool isdouble;
+} VectorKernel;
+
+static VectorKernel vectorkernels[] = {
+    {"__vfp_vmla_f32",  VK_MLA,   NO},  {"__vfp_vmla_f64",  VK_MLA,   YES},
+    {"__vfp_vscale_f32", VK_SCALE, NO}, {"__vfp_vscale_f64", VK_SCALE, YES},
+    {"__vfp_vadd_f32",  VK_ADD,   NO},  {"__vfp_vadd_f64",  VK_ADD,   YES},
+    {"__vfp_vsub_f32",  VK_SUB,   NO},  {"__vfp_vsub_f64",  VK_SUB,   YES},
+    {"__vfp_vmul_f32",  VK_MUL,   NO},  {"__vfp_vmul_f64",  VK_MUL,   YES},
+    {"__vfp_vsum_f32",  VK_SUM,   NO},  {"__vfp_vsum_f64",  VK_SUM,   YES},
+    {"__vfp_vdot_f32",  VK_DOT,   NO},  {"__vfp_vdot_f64",  VK_DOT,   YES},
+    {0, 0, 0}};
+
+#define VK_VL(dbl)      ((dbl) ? 4 : 8)
+#define VK_BANK(dbl, b) ((dbl) ? 4*(b) : 8*(b))
+#define VK_MAXINSTR     50
+#define VK_SAVED        8   // D8-D15
+
+static bool vfp_shortvectors(void)
+{
+    return fpu_type == fpu_vfp && vfp_version < 3 &&
+           (config & CONFIG_FPREGARGS) && (pcs_flags & PCS_CALLCHANGESPSR);
+}
+
+Symstr *target_vectorkernel(int32 kind, int32 size, int32 *veclen)
+{
+    VectorKernel *k;
+    if (!vfp_shortvectors()) return NULL;
+    for (k = vectorkernels; k->name != NULL; k++)
+        if (k->kind == kind && k->isdouble == (size == 8)) {
+            *veclen = VK_VL(k->isdouble);
+            return sym_insert_id(k->name);
+        }
+    return NULL;
+}
+
+static int32 vk_dp(uint32_t op_s, uint32_t op_d, bool dbl, int d, int n, int m)
+{
+    if (dbl) return op_d | VFP_Dd(d) | VFP_Dn(n) | VFP_Dm(m);
+    return op_s | VFP_Sd(d) | VFP_Sn(n) | VFP_Sm(m);
+}
+
+// VLDMIA/VSTMIA rn!, {bank}
+static int32 vk_ldst(uint32_t op_s, uint32_t op_d, bool dbl, RealRegister rn,
+                     int bank)
+{
+    int first = VK_BANK(dbl, bank), vl = VK_VL(dbl);
+    if (dbl) return op_d | VFP_UP | VFP_WRITEBACK | VFP_Rn(rn) | VFP_Dd(first) | 2*vl;
+    return op_s | VFP_UP | VFP_WRITEBACK | VFP_Rn(rn) | VFP_Sd(first) | vl;
+}
 
-    if (n == 0)
-        return;
+static void vk_setlen(int len)
+{
+    outinstr(VFP_VMRS | VFP_Rt(R_IP));
+    outinstr(OP_BICN | F_RD(R_IP) | F_RN(R_IP) | VFP_FPSCR_LENSTRIDE_IMM);
+    if (len > 1)
+        outinstr(OP_ORRN | F_RD(R_IP) | F_RN(R_IP) | VFP_FPSCR_LEN_IMM(len));
+    outinstr(VFP_VMSR | VFP_Rt(R_IP));
+}
 
-    list = ((1u << n) - 1) << 1;
-    dd = vfp_checkfreg_d(R_F0);
+static void vk_branchback(int32 cond, int32 dest)
+{
+    outinstr(OP_B | cond | (((dest - codep - 8) >> 2) & 0x00ffffff));
+}
 
-    // Push incoming FP args D0..D{n-1}.
-    outinstr(VFP_VPUSH_D | VFP_Dd(dd) | (n * 2));
+static int32 vk_branchfwd(int32 cond)
+{
+    int32 q = codep;
+    outinstr(OP_B | cond);
+    return q;
+}
+
+static void vk_setbranch(int32 q)
+{
+    set_code_inst_(q, code_inst_(q) | (((codep - q - 8) >> 2) & 0x00ffffff));
+}
+
+// No store to y may feed a load of x in the same block: give up unless
+// y - x is outside (0, VL elements).
+static void vk_overlapcheck(RealRegister y, RealRegister x, RealRegister cnt)
+{
+    outinstr(OP_SUBR | F_RD(R_IP) | F_RN(y) | x);
+    outinstr(OP_SUBN | F_RD(R_IP) | F_RN(R_IP) | 1);
+    outinstr(OP_CMPN | F_RN(R_IP) | 31);                // VL elements = 32 bytes
+    outinstr(OP_MOVN | F_RD(cnt) | 0 | C_LO);
+}
 
-    arm_fpdesc_notespchange(8 * n);
+// int k(x, y, cnt, double a) or int k(x, z, y, cnt): returns cnt & -VL, or 0
+static void vk_elementwise(VectorKernel const *k)
+{
+    bool dbl = k->isdouble, binary = k->kind != VK_MLA && k->kind != VK_SCALE;
+    RealRegister x = R_A1, z = R_A1+1, y = binary ? R_A1+2 : R_A1+1;
+    RealRegister cnt = binary ? R_A1+3 : R_A1+2;
+    int vl = VK_VL(dbl), b2 = VK_BANK(dbl, 2), b3 = VK_BANK(dbl, 3);
+    int32 skip, loop;
+
+    vk_overlapcheck(y, x, cnt);
+    if (binary) vk_overlapcheck(y, z, cnt);
+    outinstr(OP_CMPN | F_RN(cnt) | vl);
+    outinstr(OP_MOVN | F_RD(cnt) | 0 | C_LT);
+    skip = vk_branchfwd(C_LT);
+    outinstr(OP_BICN | F_RD(cnt) | F_RN(cnt) | (vl-1));
+    if (!binary && !dbl)
+        outinstr(VFP_VCVT_F32_F64 | VFP_Sd(0) | VFP_Dm(0));
+    vk_setlen(vl);
+    outinstr(OP_MOVR | F_RD(R_IP) | cnt);
+
+    loop = codep;
+    switch (k->kind) {
+    case VK_MLA:
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 3));
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, y, 2) & ~VFP_WRITEBACK);
+        outinstr(vk_dp(VFP_VMLA_S, VFP_VMLA_D, dbl, b2, b3, 0));
+        break;
+    case VK_SCALE:
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 3));
+        outinstr(vk_dp(VFP_VMUL_S, VFP_VMUL_D, dbl, b2, b3, 0));
+        break;
+    default:
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 2));
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, z, 3));
+        outinstr(k->kind == VK_ADD ? vk_dp(VFP_VADD_S, VFP_VADD_D, dbl, b2, b2, b3) :
+                 k->kind == VK_SUB ? vk_dp(VFP_VSUB_S, VFP_VSUB_D, dbl, b2, b2, b3) :
+                                     vk_dp(VFP_VMUL_S, VFP_VMUL_D, dbl, b2, b2, b3));
+        break;
+    }
+    outinstr(vk_ldst(VFP_VSTM_S, VFP_VSTM_D, dbl, y, 2));
+    outinstr(OP_SUBN | F_RD(R_IP) | F_RN(R_IP) | F_SCC | vl);
+    vk_branchback(C_NE, loop);
+    vk_setlen(1);
+
+    vk_setbranch(skip);
+    outinstr(OP_MOVR | F_RD(R_A1) | cnt);
+}
+
+// double k(x, cnt, double s) or double k(x, z, cnt, double s): s plus the
+// sum (of products) over the first cnt & -VL elements, summed pairwise.
+static void vk_reduction(VectorKernel const *k)
+{
+    bool dbl = k->isdouble;
+    RealRegister x = R_A1, z = R_A1+1, cnt = k->kind == VK_DOT ? R_A1+2 : R_A1+1;
+    int vl = VK_VL(dbl), b1 = VK_BANK(dbl, 1), b2 = VK_BANK(dbl, 2), b3 = VK_BANK(dbl, 3);
+    int32 skip, reduce, loop;
+    int w, i;
+
+    outinstr(OP_CMPN | F_RN(cnt) | vl);
+    skip = vk_branchfwd(C_LT);
+    outinstr(OP_BICN | F_RD(cnt) | F_RN(cnt) | (vl-1));
+    vk_setlen(vl);
+    if (k->kind == VK_SUM)
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 1));
+    else {
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 2));
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, z, 3));
+        outinstr(vk_dp(VFP_VMUL_S, VFP_VMUL_D, dbl, b1, b2, b3));
+    }
+    outinstr(OP_SUBN | F_RD(cnt) | F_RN(cnt) | F_SCC | vl);
+    reduce = vk_branchfwd(C_EQ);
+
+    loop = codep;
+    outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, x, 2));
+    if (k->kind == VK_SUM)
+        outinstr(vk_dp(VFP_VADD_S, VFP_VADD_D, dbl, b1, b1, b2));
+    else {
+        outinstr(vk_ldst(VFP_VLDM_S, VFP_VLDM_D, dbl, z, 3));
+        outinstr(vk_dp(VFP_VMLA_S, VFP_VMLA_D, dbl, b1, b2, b3));
+    }
+    outinstr(OP_SUBN | F_RD(cnt) | F_RN(cnt) | F_SCC | vl);
+    vk_branchback(C_NE, loop);
+
+    vk_setbranch(reduce);
+    vk_setlen(1);
+    for (w = 1; w < vl; w *= 2)
+        for (i = 0; i < vl; i += 2*w)
+            outinstr(vk_dp(VFP_VADD_S, VFP_VADD_D, dbl, b1+i, b1+i, b1+i+w));
+    if (dbl)
+        outinstr(VFP_VADD_D | VFP_Dd(0) | VFP_Dn(0) | VFP_Dm(b1));
+    else {
+        outinstr(VFP_VCVT_F32_F64 | VFP_Sd(0) | VFP_Dm(0));
+        outinstr(VFP_VADD_S | VFP_Sd(0) | VFP_Sn(0) | VFP_Sm(b1));
+        outinstr(VFP_VCVT_F64_F32 | VFP_Dd(0) | VFP_Sm(0));
+    }
+    vk_setbranch(skip);
+}
+
+static bool vfp_expandcall(Symstr const *name)
+{
+    VectorKernel const *k;
+    if (strncmp(symname_(name), "__vfp_v", 7) != 0) return NO;
+    for (k = vectorkernels; k->name != NULL; k++)
+        if (StrEq(symname_(name), k->name)) break;
+    if (k->name == NULL) return NO;
+    // corrupts_psr() keeps calls out of conditionally executed blocks.
+    if (!is_condition_always()) syserr(syserr_show_inst_dir, (long)J_CALLK);
+    arm_reservecode(VK_MAXINSTR);
+    outinstr(VFP_VPUSH_D | VFP_Dd(VK_SAVED) | 2*VK_SAVED);
+    arm_fpdesc_notespchange(8 * VK_SAVED);
+    if (k->kind == VK_SUM || k->kind == VK_DOT)
+        vk_reduction(k);
+    else
+        vk_elementwise(k);
+    outinstr(VFP_VPOP_D | VFP_Dd(VK_SAVED) | 2*VK_SAVED);
+    arm_fpdesc_notespchange(-8 * VK_SAVED);
+    return YES;
 }
@@ -10,3 +10,5 @@ extern FP_Gen const vfp_gen;
 extern struct InlineTable inlinetable_vfp[];
 
 extern int vfp_version;
+
+extern bool vfp_usesscratch(Icode const *ic);
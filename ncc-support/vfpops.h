@@ -51,6 +51,10 @@
 #define VFP_VDIV_S          0x0E800A00u // Sd <= Sn / Sm
 #define VFP_VDIV_D          0x0E800B00u // Dd <= Dn / Dm
 
+// Not fused: the product is rounded before the add, as VMUL then VADD.
+#define VFP_VMLA_S          0x0E000A00u // Sd <= Sd + Sn * Sm    p931
+#define VFP_VMLA_D          0x0E000B00u // Dd <= Dd + Dn * Dm    p931
+
 #define VFP_VEOR_D          0xF3000110u // Dd <= Dn ^ Dm Cond=ALWAYS p889
 
 #define VFP_VCVT_F32_F64    0x0EB70BC0u
@@ -109,6 +113,15 @@
 #define VFP_VCMPZ_S         0x0EB50A40u // Sd, Sm               p865
 #define VFP_VCMPZ_D         0x0EB50B40u // Dd, Dm               p865
 #define VFP_VMRS_APSR       0x0EF1FA10u // APSR <- flags        p955
+#define VFP_VMRS            0x0EF10A10u // Rt <- FPSCR          p955
+#define VFP_VMSR            0x0EE10A10u // FPSCR <- Rt          p957
+
+// FPSCR short-vector control (VFPv1/v2 only): LEN-1 in [18:16], STRIDE in
+// [21:20]. With LEN > 1, data-processing ops whose destination is outside
+// bank 0 (S0-S7 / D0-D3) operate on LEN registers, wrapping within the bank;
+// a bank 0 second operand is used as a scalar.
+#define VFP_FPSCR_LENSTRIDE_IMM 0x837u               // #0x00370000
+#define VFP_FPSCR_LEN_IMM(len)  (0x800u | ((len)-1)) // #(len-1) << 16
 
 #define VFP_VABS_S          0x0EB00AC0u // Sd <- Sm   p825
 #define VFP_VABS_D          0x0EB00BC0u // Dd <- Dm   p825
@@ -134,8 +147,8 @@
 #define VFP_VMOV_S_S_R_R    0x0C400A10u // Sm, Sm1 <- Rt, Rt2 p947 (unused)
 #define VFP_VMOV_R_R_S_S    0x0C500A10u // Rt, Rt2 <- Dn
 
-// Use the top-most regs as scratch registers.
-#define VFP_SCR_S   30  // S31
+// Use the top-most regs as scratch registers (R_FSCRATCH, see vfp.c).
+#define VFP_SCR_S   30  // S30
 #define VFP_SCR_D   15  // D15
 
 // For down-casting register numbers from RealRegister/IPtr/UPtr.
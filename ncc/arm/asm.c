@@ -22,6 +22,8 @@
 #  include <strings.h>
 #endif
 #include <ctype.h>
+#include <stdarg.h>
+#include <stdlib.h>
 
 #include "globals.h"
 #include "mcdep.h"
@@ -60,21 +62,80 @@ static bool new_area;
 static MiniFileLine last_fileline;
 #endif
 
+/* The listing is built up in asmbuf and handed to asmstream with one     */
+/* fwrite at the end of each exported function (or once it has grown past */
+/* ASMBUF_FLUSH) rather than a stdio call per field.  asm_reserve()        */
+/* guarantees room for one formatted item (an instruction is disassembled */
+/* straight into it); anything of unbounded length goes via asm_puts().   */
+#define ASMBUF_FLUSH    0x10000
+#define ASMBUF_ITEM     1024
+
+static char *asmbuf;
+static size_t asmbuf_len, asmbuf_size;
+
+static void asm_flush(void)
+{
+    if (asmbuf_len != 0) fwrite(asmbuf, 1, asmbuf_len, asmstream);
+    asmbuf_len = 0;
+}
+
+static char *asm_reserve(size_t n)
+{
+    if (asmbuf_len >= ASMBUF_FLUSH) asm_flush();
+    if (asmbuf_len + n > asmbuf_size) {
+        size_t size = asmbuf_size == 0 ? ASMBUF_FLUSH + ASMBUF_ITEM : asmbuf_size;
+        char *p;
+        while (asmbuf_len + n > size) size *= 2;
+        p = (char *)realloc(asmbuf, size);
+        if (p == NULL) cc_fatalerr(misc_fatalerr_space2);
+        asmbuf = p;
+        asmbuf_size = size;
+    }
+    return asmbuf + asmbuf_len;
+}
+
+/* Accepts the NUL-terminated text written at asm_reserve(). */
+static void asm_commit(void)
+{
+    asmbuf_len += strlen(asmbuf + asmbuf_len);
+}
+
+static void asm_putc(int c)
+{
+    *asm_reserve(1) = (char)c;
+    asmbuf_len++;
+}
+
+static void asm_puts(char const *s)
+{
+    size_t n = strlen(s);
+    memcpy(asm_reserve(n), s, n);
+    asmbuf_len += n;
+}
+
+static void asm_printf(char const *fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    asmbuf_len += vsprintf(asm_reserve(ASMBUF_ITEM), fmt, ap);
+    va_end(ap);
+}
+
 static void newline(void)
 {
-    fputc('\n', asmstream);
+    asm_putc('\n');
 }
 
 static void indent_18_if_annotating(void)
 {
     if (HasFeature(Feature_Annotate))
-        fputs(spaces_18, asmstream);
+        asm_puts(spaces_18);
 }
 
 static void padtocol8(unsigned32 n)
 {
     if (n > 8) n = 8;
-    fputs(spaces_18 + 18 - 8 + n, asmstream);
+    asm_puts(spaces_18 + 18 - 8 + n);
 }
 
 static void indent8(void)
@@ -86,9 +147,8 @@ static void pr_chars(int32 w)
 /* Works on both sexes of host machine. */
 /* Assumes ASCII target machine.        */
 {   unsigned i, c;
-    FILE *as = asmstream;
 
-    fputc('\'', as);
+    asm_putc('\'');
     for (i=0; i<sizeof(int32); i++)
     {   c = ((uint8 *)&w)[i];
         if (c < ' ' || c >= 127)
@@ -97,15 +157,15 @@ static void pr_chars(int32 w)
                  goto escape;
              }
              else
-             {   fprintf(as, "\\%o", c);
+             {   asm_printf("\\%o", c);
                  continue;
              }
         }
         else if (c == '\\' || c == '\'' || c == '\"')
-escape:     fputc('\\', as);
-        fputc(c, as);
+escape:     asm_putc('\\');
+        asm_putc(c);
     }
-    fputc('\'', as);
+    asm_putc('\'');
 }
 
 static void spr_asmname(char *buf, char const *s)
@@ -133,13 +193,13 @@ static void spr_asmsym(char *buf, Symstr const *sym) {
 static void pr_asmname(char const *s) {
     char buf[256];
     spr_asmname(buf, s);
-    fputs(buf, asmstream);
+    asm_puts(buf);
 }
 
 static void pr_asmsym(Symstr const *sym) {
     char buf[256];
     spr_asmsym(buf, sym);
-    fputs(buf, asmstream);
+    asm_puts(buf);
 }
 
 #ifdef CPLUSPLUS
@@ -148,7 +208,7 @@ static void pr_unmangled_name(const Symstr *sym) {
     if (LanguageIsCPlusPlus && HasFeature(Feature_Annotate)) {
         char const *name = unmangle2(symname_(sym), buf, sizeof buf);
         if (name != symname_(sym))
-            fprintf(asmstream, " ; %s", buf);
+            asm_printf(" ; %s", buf);
     }
 }
 #else
@@ -396,7 +456,7 @@ static void asm_scancode(void)
 static bool headerdone;
 
 #if RECORD_SOURCE_LOCATION
-static void output_location(MiniFileLine* fl, FILE* as)
+static void output_location(MiniFileLine* fl)
 {
     const char *file = fl->f;
     unsigned int line = fl->l;
@@ -407,13 +467,15 @@ static void output_location(MiniFileLine* fl, FILE* as)
 
     if (last_fileline.f == NULL || strcmp(last_fileline.f, file) != 0) {
         indent8();
-        fprintf(as, "; source-file: \"%s\", line %u\n", file, line);
+        asm_puts("; source-file: \"");
+        asm_puts(file);
+        asm_printf("\", line %u\n", line);
         last_fileline.f = file;
         last_fileline.l = line;
         last_fileline.column = col;
     } else if (line > 0 && (line != last_fileline.l || col != last_fileline.column)) {
         indent8();
-        fprintf(as, "; line: %u %u\n", line, col);
+        asm_printf("; line: %u %u\n", line, col);
         last_fileline.l = line;
         last_fileline.column = col;
     }
@@ -425,9 +487,9 @@ static void asm_areadef(char const *name, char const *attrib1, char const *attri
     newline();
     indent8();
     indent_18_if_annotating();
-    fputs("AREA ", asmstream);
+    asm_puts("AREA ");
     pr_asmname(name);
-    fprintf(asmstream, "%s, %s\n", attrib1, attrib2);
+    asm_printf("%s, %s\n", attrib1, attrib2);
 }
 
 
@@ -437,7 +499,7 @@ static void asm_areaname(Symstr const *name, char const *attributes, bool export
         newline();
         indent8();
         indent_18_if_annotating();
-        fputs("EXPORT  ", asmstream);
+        asm_puts("EXPORT  ");
         pr_asmname(s);
         pr_unmangled_name(name);
     }
@@ -447,7 +509,6 @@ static void asm_areaname(Symstr const *name, char const *attributes, bool export
 
 void display_assembly_code(Symstr const *name)
 {   uint32 q, qend;
-    FILE   *as = asmstream;
     char buf[255];
 
     if (codep == 0)
@@ -466,7 +527,7 @@ void display_assembly_code(Symstr const *name)
                         "CODE, READONLY");
         newline();
         pr_asmname(symname_(sym));
-        fprintf(as, " DATA");
+        asm_puts(" DATA");
         pr_unmangled_name(sym);
         newline();
         first_area = NO;
@@ -484,7 +545,7 @@ void display_assembly_code(Symstr const *name)
         newline();
 #if RECORD_SOURCE_LOCATION
         if (HasFeature(Feature_AsmIncludesLocation))
-            output_location(&currentfunction.start_fl, as);
+            output_location(&currentfunction.start_fl);
 #endif
     }
     asm_scancode();
@@ -498,17 +559,17 @@ void display_assembly_code(Symstr const *name)
             code_fileline_f(q) != NULL &&
             (f == LIT_RELADDR || f == LIT_OPCODE))
         {
-            output_location(&code_fileline_(q), as);
+            output_location(&code_fileline_(q));
         }
 #endif
 
         if (needslabel(q / 4))
         {   indent_18_if_annotating();
             printlabelname(buf, "", "\n", q, name);
-            fputs(buf, as);
+            asm_puts(buf);
         }
         if (HasFeature(Feature_Annotate))
-            fprintf(as, "%.6lx  %.8lx  ", (long)(q + codebase), lx_arg(w));
+            asm_printf("%.6lx  %.8lx  ", (long)(q + codebase), lx_arg(w));
         if (f != LIT_FPNUM2) indent8();
         switch(f)
         {
@@ -516,7 +577,7 @@ void display_assembly_code(Symstr const *name)
             {   unsigned32 oldq = q;
                 RelAddrRec r;
                 r.sym = (Symstr *)aux; r.offset = 0; r.count = 0;
-                r.buf = buf;
+                r.buf = asm_reserve(ASMBUF_ITEM);
                 if ((w & 0x0f000000L) == 0x02000000L) {
                     int32 rd = (w >> 12) & 0xfL;
                     while (q+4 < qend && code_flag_(q+4) == LIT_OPCODE &&
@@ -530,34 +591,34 @@ void display_assembly_code(Symstr const *name)
                         r.count++; r.offset += immediateval(w1);
                     }
                 }
-                disass(w, oldq, buf, (void *)&r, disass_cb);
-                fputs(buf, as);
+                disass(w, oldq, r.buf, (void *)&r, disass_cb);
+                asm_commit();
                 pr_unmangled_name((Symstr *)aux);
                 break;
             }
     case LIT_OPCODE:
-            disass(w, q, buf, (void *)0, disass_cb);
-            fputs(buf, as);
+            disass(w, q, asm_reserve(ASMBUF_ITEM), (void *)0, disass_cb);
+            asm_commit();
             break;
     case LIT_STRING:
             NoteLiteralLabel(q);
             {   int32 tmpw = w;
                 unsigned char *uc = (unsigned char *)&tmpw;
-                fprintf(as, "DCB      0x%.2x,0x%.2x,0x%.2x,0x%.2x",
+                asm_printf("DCB      0x%.2x,0x%.2x,0x%.2x,0x%.2x",
                     uc[0], uc[1], uc[2], uc[3]);
             }
             if (HasFeature(Feature_Annotate))
-                fprintf(as, "         ; "), pr_chars(w);
+                asm_puts("         ; "), pr_chars(w);
             break;
     case LIT_NUMBER:
             NoteLiteralLabel(q);
-            fprintf(as, "DCD      0x%.8lx", lx_arg(w));
+            asm_printf("DCD      0x%.8lx", lx_arg(w));
             break;
     case LIT_ADCON:
             NoteLiteralLabel(q);
             {   Symstr *sym = find_extsym(codebase+q);
-                fputs("DCD      ", as); pr_asmsym(sym);
-                if (w != 0) fprintf(as, "+0x%lx", lx_arg(w));
+                asm_puts("DCD      "); pr_asmsym(sym);
+                if (w != 0) asm_printf("+0x%lx", lx_arg(w));
                 pr_unmangled_name(sym);
             }
             break;
@@ -565,9 +626,10 @@ void display_assembly_code(Symstr const *name)
             NoteLiteralLabel(q);
             {   char *s = (char *)aux;
                 if (*s != '<') {
-                    fprintf(as, "DCFS            %s    @ 0x%.8lx", s, lx_arg(w));
+                    asm_puts("DCFS            "); asm_puts(s);
+                    asm_printf("    @ 0x%.8lx", lx_arg(w));
                 } else {
-                    fprintf(as, "DCD             0x%.8lx", lx_arg(w));
+                    asm_printf("DCD             0x%.8lx", lx_arg(w));
                 }
             }
             break;
@@ -575,10 +637,11 @@ void display_assembly_code(Symstr const *name)
             NoteLiteralLabel(q);
             {   char *s = (char *)aux;
                 if (*s != '<') {
-                    fprintf(as, "DCFD            %s    @ 0x%.8lx, 0x%.8lx",
-                            s, lx_arg(w), lx_arg(code_inst_(q+4)));
+                    asm_puts("DCFD            "); asm_puts(s);
+                    asm_printf("    @ 0x%.8lx, 0x%.8lx",
+                               lx_arg(w), lx_arg(code_inst_(q+4)));
                 } else {
-                    fprintf(as, "DCD             0x%.8lx, 0x%.8lx",
+                    asm_printf("DCD             0x%.8lx, 0x%.8lx",
                                 lx_arg(w), lx_arg(code_inst_(q+4)) );
                 }
             }
@@ -587,15 +650,16 @@ void display_assembly_code(Symstr const *name)
             if (HasFeature(Feature_Annotate)) break; else continue;
     case LIT_INT64_1:
             NoteLiteralLabel(q);
-            fprintf(as, "DCD      0x%.8lx, 0x%.8lx", lx_arg(w), lx_arg(code_inst_(q+4)) );
+            asm_printf("DCD      0x%.8lx, 0x%.8lx", lx_arg(w), lx_arg(code_inst_(q+4)) );
             break;
     case LIT_INT64_2:    /* all printed by the FPNUM1 */
             if (HasFeature(Feature_Annotate)) break; else continue;
     default:
-            fputs("???", as);
+            asm_puts("???");
         }
         newline();
     }
+    asm_flush();
 }
 
 void asm_header(void)
@@ -610,10 +674,11 @@ void asm_header(void)
     strcpy(b, "Lib$$Request$$armlib$$");
     target_lib_variant(&b[22]);
     obj_symref(sym_insert_id(b), xr_code+xr_weak, 0);
-    fprintf(asmstream, "; generated by %s\n", CC_BANNER);
-    if (HasFeature(Feature_Annotate)) return;   /* do not bore interactive user */
-    asm_areadef("C$$code", (obj_iscommoncode() ? ", COMDEF" : ""),
-                "CODE, READONLY");
+    asm_printf("; generated by %s\n", CC_BANNER);
+    if (!HasFeature(Feature_Annotate))      /* do not bore interactive user */
+        asm_areadef("C$$code", (obj_iscommoncode() ? ", COMDEF" : ""),
+                    "CODE, READONLY");
+    asm_flush();
 }
 
 static void asm_outextern(void)
@@ -630,9 +695,9 @@ static void asm_outextern(void)
             first = 0;
             indent8();
             indent_18_if_annotating();
-            fprintf(asmstream, "EXPORT ");
+            asm_puts("EXPORT ");
             pr_asmsym(x->extsym);
-            fprintf(asmstream, "\n");
+            asm_puts("\n");
         }
     }
     first = 1;
@@ -651,24 +716,25 @@ static void asm_outextern(void)
             first = 0;
             indent8();
             indent_18_if_annotating();
-            fprintf(asmstream, "IMPORT ");
+            asm_puts("IMPORT ");
             pr_asmsym(x->extsym);
             if (x->extflags & xr_weak)
-              fprintf(asmstream, ", WEAK");
-            fprintf(asmstream, "\n");
+              asm_puts(", WEAK");
+            asm_puts("\n");
         }
     }
 }
 
 void asm_setregname(int regno, char const *name) {
     if (regno < R_F0) {
-        if (headerdone) fprintf(asmstream, "%s RN %d\n", name, regno);
+        if (headerdone) asm_puts(name), asm_printf(" RN %d\n", regno);
         regnames[regno] = name;
     } else {
         regno -= R_F0;
-        if (headerdone) fprintf(asmstream, "%s FN %d\n", name, regno);
+        if (headerdone) asm_puts(name), asm_printf(" FN %d\n", regno);
         fregnames[regno] = name;
     }
+    asm_flush();
 }
 
 static void asm_checklenandrpt(int32 len, int lenwanted, int32 rpt, int32 val) {
@@ -681,7 +747,7 @@ static void asm_checklenandrpt(int32 len, int lenwanted, int32 rpt, int32 val) {
 }
 
 static void asm_data(DataInit *p, int constdata)
-{ FILE *as = asmstream;
+{
   int32 offset = 0;
   for (; p != 0; p = p->datacdr)
   { int32 sort = p->sort;
@@ -698,71 +764,72 @@ static void asm_data(DataInit *p, int constdata)
     switch (sort)
     {   case LIT_LABEL:
             pr_asmsym((Symstr *)rpt);
-            if (constdata) fprintf(as, " DATA");
+            if (constdata) asm_puts(" DATA");
             pr_unmangled_name((Symstr *)rpt);
             break;
         default:  syserr(syserr_asm_trailer, (long)sort);
         case LIT_BBBB:
             asm_checklenandrpt(len, -4, rpt, val.l);
-            fprintf(as, "DCB      0x%.2x,0x%.2x,0x%.2x,0x%.2x",
+            asm_printf("DCB      0x%.2x,0x%.2x,0x%.2x,0x%.2x",
                         val.b[0], val.b[1], val.b[2], val.b[3]);
             break;
         case LIT_BBBX:
             asm_checklenandrpt(len, -3, rpt, val.l);
-            fprintf(as, "DCB      0x%.2x,0x%.2x,0x%.2x", val.b[0], val.b[1], val.b[2]);
+            asm_printf("DCB      0x%.2x,0x%.2x,0x%.2x", val.b[0], val.b[1], val.b[2]);
             break;
         case LIT_BBX:
             asm_checklenandrpt(len, -2, rpt, val.l);
-            fprintf(as, "DCB      0x%.2x,0x%.2x", val.b[0], val.b[1]);
+            asm_printf("DCB      0x%.2x,0x%.2x", val.b[0], val.b[1]);
             break;
         case LIT_BXXX:
             asm_checklenandrpt(len, -1, rpt, val.l);
-            fprintf(as, "DCB      0x%.2x", val.b[0]);
+            asm_printf("DCB      0x%.2x", val.b[0]);
             break;
         case LIT_HH:
             asm_checklenandrpt(len, -4, rpt, val.l);
-            fprintf(as, "DCW%c     0x%.4x,0x%.4x", offset & 1 ? 'U' : ' ',
+            asm_printf("DCW%c     0x%.4x,0x%.4x", offset & 1 ? 'U' : ' ',
                                   val.w[0], val.w[1]);
             break;
         case LIT_HX:
             asm_checklenandrpt(len, -2, rpt, val.l);
-            fprintf(as, "DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
+            asm_printf("DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
             break;
         case LIT_BBH:
             asm_checklenandrpt(len, -4, rpt, val.l);
-            fprintf(as, "DCB      0x%.2x,0x%.2x", val.b[0], val.b[1]);
+            asm_printf("DCB      0x%.2x,0x%.2x", val.b[0], val.b[1]);
             newline(); indent_18_if_annotating(); indent8();
-            fprintf(as, "DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[1]);
+            asm_printf("DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[1]);
             break;
         case LIT_HBX:
             asm_checklenandrpt(len, -3, rpt, val.l);
-            fprintf(as, "DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
+            asm_printf("DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
             newline(); indent_18_if_annotating(); indent8();
-            fprintf(as, "DCB      0x%.2x", val.b[2]);
+            asm_printf("DCB      0x%.2x", val.b[2]);
             break;
         case LIT_HBB:
             asm_checklenandrpt(len, -4, rpt, val.l);
-            fprintf(as, "DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
+            asm_printf("DCW%c     0x%.4x", offset & 1 ? 'U' : ' ', val.w[0]);
             newline(); indent_18_if_annotating(); indent8();
-            fprintf(as, "DCB      0x%.2x,0x%.2x", val.b[2], val.b[3]);
+            asm_printf("DCB      0x%.2x,0x%.2x", val.b[2], val.b[3]);
             break;
         case LIT_NUMBER:
             asm_checklenandrpt(len, 4, rpt, val.l);
             if (len != 4) syserr(syserr_asm_data, (long)len);
             if (rpt == 1)
-                fprintf(as, "DCD%c     0x%.8lx", offset & 3 ? 'U' : ' ', lx_arg(val.l));
+                asm_printf("DCD%c     0x%.8lx", offset & 3 ? 'U' : ' ', lx_arg(val.l));
             else /* val.l already checked to be zero */
-                fprintf(as, "%%        %ld", (long)(rpt*len));
+                asm_printf("%%        %ld", (long)(rpt*len));
             break;
         case LIT_FPNUM:
         {   FloatCon *f = ptrval;
             char *s = f->floatstr;
             if (*s != '<') {
-                fprintf(as, "DCF%c     %s", (len == 8) ? 'D' : 'S', s);
+                asm_printf("DCF%c     ", (len == 8) ? 'D' : 'S');
+                asm_puts(s);
             } else if (len == 4) {
-                fprintf(as, "DCD      0x%.8lx", lx_arg(f->floatbin.fb.val));
+                asm_printf("DCD      0x%.8lx", lx_arg(f->floatbin.fb.val));
             } else {
-                fprintf(as, "DCD      0x%.8lx, 0x%.8lx",
+                asm_printf("DCD      0x%.8lx, 0x%.8lx",
                         lx_arg(f->floatbin.db.msd), lx_arg(f->floatbin.db.lsd));
             }
             break;
@@ -771,13 +838,13 @@ static void asm_data(DataInit *p, int constdata)
             while (rpt--)
             {
 #if (sizeof_ptr == 2)
-                fputs("DCW      ", as);
+                asm_puts("DCW      ");
 #else
-                fputs("DCD      ", as);
+                asm_puts("DCD      ");
 #endif
                 pr_asmsym((Symstr *)len);
                 pr_unmangled_name((Symstr *)len);
-                if (val.l != 0) fprintf(as, "+0x%lx", lx_arg(val.l));
+                if (val.l != 0) asm_printf("+0x%lx", lx_arg(val.l));
                 if (rpt) {newline();  indent_18_if_annotating();  indent8(); }
             }
             break;
@@ -795,11 +862,11 @@ typedef struct ExtRefList {
 static void asm_pad(int32 len)
 {   indent8();
     indent_18_if_annotating();
-    fprintf(asmstream, "%% %ld\n", (long)len);
+    asm_printf("%% %ld\n", (long)len);
 }
 
 void asm_trailer(void)
-{ FILE *as = asmstream;
+{
 #ifdef CONST_DATA_IN_CODE
   if (constdata_size() != 0) {
     asm_areadef("C$$constdata", "", "DATA, READONLY");
@@ -870,7 +937,8 @@ void asm_trailer(void)
   newline();
   indent8();
   indent_18_if_annotating();
-  fputs("END\n", as);
+  asm_puts("END\n");
+  asm_flush();
   headerdone = NO;
 }
 
@@ -496,6 +496,9 @@ static void obj_writedata(DataInit *p) { /* follows gendc exactly! */
         }
         while (rpt-- != 0) obj_fwrite(&val, 1, len, objstream);
         break;
+    case LIT_BLOB:    /* already in target sex */
+      obj_fwrite((void *)p->val, 1, len, objstream);
+      break;
     case LIT_NUMBER:
       if (len != 4) syserr(syserr_coff_datalen, (long)len);
       /* beware: sex dependent... */
@@ -1599,6 +1599,8 @@ case J_OPSYSK:
 
 case J_CALLK:
         ldm_flush();
+        if (fp_gen->expandcall != NULL && fp_gen->expandcall((Symstr *)r3))
+            break;
         call_k((Symstr *)r3, 0, (k_fltregs_(r2) != 0 ? aof_fpreg : 0), 0);
         break;
 
@@ -2698,7 +2700,6 @@ default:
 }
 
 static Uint saved_fpreg_words;
-static Uint fp_arg_words;
 
 #define NFPLITERALS 16
 
@@ -4527,10 +4528,17 @@ static void fpa_restoreregs(int32 mask, int32 condition, FP_RestoreBase base, in
 }
 
 static void fpa_saveargs(int32 n) {
+    /* narrow float args take one word (see cg_bindargs) */
     for (; --n >= 0; ) {
-        outinstr(OP_CPPRE | F_DOWN | F_WRITEBACK | F_STR |
-                 F_RN(R_SP) | F_RD(R_F0+n) | F_DOUBLE | 2);
-        fpdesc_notespchange(2 * 4);
+        if (currentfunction.fltargsingles & regbit(n)) {
+            outinstr(OP_CPPRE | F_DOWN | F_WRITEBACK | F_STR |
+                     F_RN(R_SP) | F_RD(R_F0+n) | F_SINGLE | 1);
+            fpdesc_notespchange(4);
+        } else {
+            outinstr(OP_CPPRE | F_DOWN | F_WRITEBACK | F_STR |
+                     F_RN(R_SP) | F_RD(R_F0+n) | F_DOUBLE | 2);
+            fpdesc_notespchange(2 * 4);
+        }
     }
 }
 
@@ -4539,7 +4547,8 @@ static FP_Gen const fpa_gen = {
     fpa_saveregs,
     fpa_restoresize,
     fpa_restoreregs,
-    fpa_saveargs
+    fpa_saveargs,
+    NULL
 };
 
 static void amp_saveregs(int32 mask)
@@ -4600,7 +4609,8 @@ static FP_Gen const amp_gen = {
     amp_saveregs,
     amp_restoresize,
     amp_restoreregs,
-    amp_saveargs
+    amp_saveargs,
+    NULL
 };
 
 static int32 LSBits(int32 mask, int n) {
@@ -4689,10 +4699,18 @@ static void routine_saveregs(int32 m)
 {
     int32 intregs = k_intregs_(m),
           fltregs = k_fltregs_(m);
+    bool splitarg;
     saveregs_done = YES;
     if (m < 0) syserr(syserr_enter, (long)m);
     nargwords = k_argwords_(m);
-    nregargwords = intregs + fp_arg_words*fltregs;
+    /* cg gives each fp register arg a word per 4 bytes of its type (see   */
+    /* cg_bindargs), and the stacked args follow them.                     */
+    nregargwords = intregs + currentfunction.fltargwords;
+    /* A double split between a4 and the stack is loaded as one value, so  */
+    /* when there are fp register args as well the integer arg registers   */
+    /* must be pushed on their own, next to the stacked args, as for a     */
+    /* variadic function. The fp args then go below them as usual.         */
+    splitarg = fltregs != 0 && intregs == NARGREGS && nargwords > nregargwords;
 #if DEBUG_X
     if (debugging(DEBUG_X)) desperate_codetrace();
 #endif
@@ -4711,10 +4729,12 @@ static void routine_saveregs(int32 m)
             mask = regmask & (M_VARREGS | M_LR);
             if (procflags & PROC_ARGPUSH) {
                 bool maybevariadic = fltregs == 0 && intregs < nargwords;
-                if (maybevariadic) {
+                if (maybevariadic || splitarg) {
                     fpdesc_setinitoffset(-4-NARGREGS*4);
                     PushRegs(M_ARGREGS);
                     argstopopabovefp = NARGREGS;
+                    argwordsbelowfp = realargwordsbelowfp =
+                        currentfunction.fltargwords;
                 } else {
                     argwordsbelowfp = nregargwords;
                     mask |= (regbit(R_A1+intregs) - regbit(R_A1));
@@ -4783,7 +4803,7 @@ static void routine_saveregs(int32 m)
 
             outinstr(OP_MOVR | F_RD(R_IP) | R_SP);
             DestroyIP();
-            if (!maybevariadic)
+            if (!maybevariadic && !(splitarg && saveargs))
             {   argwordsbelowfp = nregargwords;
                 if (saveargs) {
                     mask |= (regbit(R_A1+intregs) - regbit(R_A1));
@@ -4792,6 +4812,8 @@ static void routine_saveregs(int32 m)
             } else {
                 fpoff += NARGREGS*4;
                 PushRegs(M_ARGREGS);
+                argwordsbelowfp = realargwordsbelowfp =
+                    currentfunction.fltargwords;
             }
             PushRegs(mask);
             if (saveargs) fp_gen->saveargs(fltregs);
@@ -5132,6 +5154,66 @@ static void show_instruction_1(Icode const *ic)
     }
 }
 
+/* Long long shifts take their count in a3 (and use ip as a scratch      */
+/* register); a3 >= 32 shifts out to zero (or the sign) as ARM register  */
+/* specified shifts do, so counts of 0..63 need no special casing.       */
+static void ll_shift_orr(RealRegister r1, RealRegister r3, int32 shift, RealRegister rs)
+{   Icode op;
+    INIT_IC(op, J_ABINRRR); op.flags = MKOP(A_ORR,CL_BIN) | RN_SHIFT_REG | shift;
+    op.r1.rr = r1; op.r2.rr = r1; op.r3.rr = r3; op.r4.rr = rs;
+    show_instruction_1(&op);
+}
+
+static void ll_shift_count(int32 aop, int32 flags)
+{   Icode op;
+    INIT_IC(op, J_ABINRK); op.flags = MKOP(aop+RN_CONST,CL_BIN) | flags;
+    op.r1.rr = R_IP; op.r2.rr = R_A1+2; op.r3.i = 32;
+    show_instruction_1(&op);
+}
+
+static void ll_move(J_OPCODE jop, RealRegister r1, RealRegister r2, int32 n)
+{   Icode op;
+    INIT_IC(op, jop); op.r1.rr = r1;
+    if (jop == J_MOVR) op.r3.rr = r2;
+    else if (jop == J_MOVK) op.r3.i = n;
+    else { op.r2.rr = r2; op.r3.i = n; }
+    show_instruction_1(&op);
+}
+
+/* Shift of a1/a2 by a count known at compile time.  'to' is the word   */
+/* bits move into, 'from' the word they move out of: a1 and a2           */
+/* respectively for right shifts, the other way round for left shifts.   */
+static bool ExpandInlineShiftK(Symstr const *target, int32 k) {
+    Icode op;
+    bool left = target == bindsym_(exb_(sim.llshiftl));
+    bool sign = target == bindsym_(exb_(sim.llsshiftr));
+    J_OPCODE shift = left ? J_SHLK+J_UNSIGNED :
+                     sign ? J_SHRK+J_SIGNED : J_SHRK+J_UNSIGNED;
+    RealRegister to = left ? R_A1+1 : R_A1, from = left ? R_A1 : R_A1+1;
+    if (!left && !sign && target != bindsym_(exb_(sim.llushiftr)))
+        return NO;
+    if (k <= 0) return YES;
+    if (k < 32) {
+        ll_move(left ? J_SHLK+J_UNSIGNED : J_SHRK+J_UNSIGNED, to, to, k);
+        INIT_IC(op, J_ORRR + ((left ? (32-k) | SHIFT_RIGHT : 32-k) << J_SHIFTPOS));
+        op.r1.rr = to; op.r2.rr = to; op.r3.rr = from;
+        show_instruction_1(&op);
+        ll_move(shift, from, from, k);
+    } else if (k < 64) {
+        if (k == 32) ll_move(J_MOVR, to, from, 0);
+        else ll_move(shift, to, from, k-32);
+        if (sign) ll_move(J_SHRK+J_SIGNED, from, from, 31);
+        else ll_move(J_MOVK, from, 0, 0);
+    } else if (sign) {
+        ll_move(J_SHRK+J_SIGNED, from, from, 31);
+        ll_move(J_MOVR, to, from, 0);
+    } else {
+        ll_move(J_MOVK, to, 0, 0);
+        ll_move(J_MOVK, from, 0, 0);
+    }
+    return YES;
+}
+
 static bool ExpandInline(Symstr const *target, bool resinflags) {
     Icode op;
     if (target == bindsym_(exb_(sim.llfroml))) {
@@ -5203,6 +5285,51 @@ static bool ExpandInline(Symstr const *target, bool resinflags) {
         show_instruction_1(&op);
         return YES;
     }
+    if (target == bindsym_(exb_(sim.llmul)) && (config & CONFIG_LONG_MULTIPLY)) {
+        /* hi = xhi*ylo + xlo*yhi + high(xlo*ylo), lo = low(xlo*ylo)     */
+        INIT_IC(op, J_MULR); op.r1.rr = R_A1+1; op.r2.rr = R_A1+1; op.r3.rr = R_A1+2;
+        show_instruction_1(&op);
+        INIT_IC(op, J_MLAR); op.r1.rr = R_A1+1; op.r2.rr = R_A1+3; op.r3.rr = R_A1; op.r4.rr = R_A1+1;
+        show_instruction_1(&op);
+        INIT_IC(op, J_MULL); op.r1.rr = R_A1; op.r2.rr = R_A1+3; op.r3.rr = R_A1+2; op.r4.rr = R_A1;
+        show_instruction_1(&op);
+        INIT_IC(op, J_ADDR); op.r1.rr = R_A1+1; op.r2.rr = R_A1+1; op.r3.rr = R_A1+3;
+        show_instruction_1(&op);
+        return YES;
+    }
+    if (target == bindsym_(exb_(sim.llshiftl))) {
+        ll_shift_count(A_RSB, 0);
+        ll_move(J_SHLR+J_UNSIGNED, R_A1+1, R_A1+1, R_A1+2);
+        ll_shift_orr(R_A1+1, R_A1, SH_LSR, R_IP);
+        ll_shift_count(A_SUB, 0);
+        ll_shift_orr(R_A1+1, R_A1, SH_LSL, R_IP);
+        ll_move(J_SHLR+J_UNSIGNED, R_A1, R_A1, R_A1+2);
+        return YES;
+    }
+    if (target == bindsym_(exb_(sim.llushiftr))) {
+        ll_shift_count(A_RSB, 0);
+        ll_move(J_SHRR+J_UNSIGNED, R_A1, R_A1, R_A1+2);
+        ll_shift_orr(R_A1, R_A1+1, SH_LSL, R_IP);
+        ll_shift_count(A_SUB, 0);
+        ll_shift_orr(R_A1, R_A1+1, SH_LSR, R_IP);
+        ll_move(J_SHRR+J_UNSIGNED, R_A1+1, R_A1+1, R_A1+2);
+        return YES;
+    }
+    if (target == bindsym_(exb_(sim.llsshiftr)) && cond == Q_AL) {
+        /* an ASR by 32 or more gives the sign, not zero, so the low word */
+        /* takes the high word shifted by count-32 only if count >= 32.   */
+        ll_shift_count(A_RSB, 0);
+        ll_move(J_SHRR+J_UNSIGNED, R_A1, R_A1, R_A1+2);
+        ll_shift_orr(R_A1, R_A1+1, SH_LSL, R_IP);
+        ll_shift_count(A_SUB, SET_CC);
+        INIT_IC(op, J_CONDEXEC+Q_GE);
+        show_instruction_1(&op);
+        ll_move(J_SHRR+J_SIGNED, R_A1, R_A1+1, R_IP);
+        INIT_IC(op, J_CONDEXEC+Q_AL);
+        show_instruction_1(&op);
+        ll_move(J_SHRR+J_SIGNED, R_A1+1, R_A1+1, R_A1+2);
+        return YES;
+    }
     if (resinflags && cond == Q_AL)
     {
         if (target == bindsym_(exb_(sim.llcmpeq)) ||
@@ -5248,8 +5375,52 @@ static bool ExpandInline(Symstr const *target, bool resinflags) {
     return NO;
 }
 
+/* A constant long long shift count is loaded into a3 just before the    */
+/* call.  The load is held back here so that, if the call does follow,   */
+/* ExpandInlineShiftK can use the count directly and the load vanishes.  */
+static Icode held_a3;
+static bool a3_held;
+
+static bool ll_passes_held_a3(Icode const *ic)
+{   if (cond != Q_AL || (ic->flags & SET_CC) || (ic->op & Q_MASK) != Q_AL)
+        return NO;
+    switch (ic->op & J_TABLE_BITS) {
+    case J_MOVK:
+        return ic->r1.rr != R_A1+2;
+    case J_MOVR:
+        return ic->r1.rr != R_A1+2 && ic->r3.rr != R_A1+2;
+    case J_ADDK: case J_SUBK: case J_SHLK: case J_SHRK:
+    case J_ANDK: case J_ORRK: case J_EORK:
+        return ic->r1.rr != R_A1+2 && ic->r2.rr != R_A1+2;
+    default:
+        return NO;
+    }
+}
+
 void show_instruction(Icode const *const ic)
-{   if (ic->op == J_SAVE && target_stack_moves_once) {
+{   if (a3_held) {
+        if ((ic->op == J_CALLK || ic->op == J_TAILCALLK) && cond == Q_AL &&
+            ExpandInlineShiftK(ic->r3.sym, held_a3.r3.i)) {
+            a3_held = NO;
+            if (ic->op == J_TAILCALLK) {
+                Icode op;
+                INIT_IC(op, J_B); op.r3.l = RETLAB;
+                show_instruction_1(&op);
+            }
+            return;
+        }
+        if (!ll_passes_held_a3(ic)) {
+            a3_held = NO;
+            show_instruction_1(&held_a3);
+        }
+    }
+    if ((ic->op & ~J_DEADBITS) == J_MOVK && ic->r1.rr == R_A1+2 &&
+        ic->flags == 0 && cond == Q_AL) {
+        held_a3 = *ic;
+        a3_held = YES;
+        return;
+    }
+    if (ic->op == J_SAVE && target_stack_moves_once) {
         Icode op;
         show_instruction_1(ic);
         INIT_IC(op, J_SETSP); op.r1.rr = 0; op.r2.i = fp_minus_sp; op.r3.i = fp_minus_sp+greatest_stackdepth;
@@ -5373,18 +5544,15 @@ void mcdep_init(void)
       fp_gen = &amp_gen;
       disass_addcopro(AMP_DisassCP);
       saved_fpreg_words = 1; // size of float
-      fp_arg_words = 1;
     } else if (fpu_type == fpu_vfp) {
         fp_gen = &vfp_gen;
         // Our simple, and non-standard procedure call 'standard',
         // only uses every second S register. This allows any register
         // to contain a float or double.
         saved_fpreg_words = 2; // size of double
-        fp_arg_words = 2; // size of double
     } else {
       fp_gen = &fpa_gen;
       saved_fpreg_words = 3; // size of extended double
-      fp_arg_words = 2; // size of double
     }
     lib_reloc_sym = sym_insert_id("_Lib$Reloc$Off");
     mod_reloc_sym = sym_insert_id("_Mod$Reloc$Off");
@@ -5448,6 +5616,11 @@ void arm_addressability(int32 n)
     addressability(n);
 }
 
+void arm_reservecode(int32 ninstr)
+{
+    if (codep + 4*ninstr >= mustlitby) dumplits2(YES);
+}
+
 void arm_ldm_flush(void) {
     ldm_flush();
 }
@@ -25,6 +25,8 @@
 #include "toolenv.h"
 #include "toolenv2.h"
 #include "tooledit.h"
+#include "gen.h"
+#include "vfp.h"
 
 int arthur_module;
 int32 config;
@@ -34,6 +36,7 @@ FPU_Type fpu_type;
 static int config_mulbits;          /* number of bits per cycle */
 static int config_multime;          /* minimum cycles for MUL */
 static int config_mlatime;          /* minimum cycles for MLA */
+int branch_penalty;                 /* cycles lost by a taken branch */
 
 typedef struct {
   char const *name;
@@ -54,6 +57,7 @@ int32 numFloatArgRegs()
 }
 
 // Return the number of float 'var' registers.
+// VFP: D8-D14. D15 is the code generator's scratch register (R_FSCRATCH).
 int32 numFloatVarRegs()
 {
     if (fpu_type == fpu_vfp)
@@ -155,6 +159,7 @@ int mcdep_toolenv_insertdefaults(ToolEnv *t) {
 }
 
 #define MULSPD(bits, mul, mla) bits, mul, mla
+#define BRPEN(n) n
 
 #define ARCH_2  PROCESSOR_HAS_26BIT_MODE
 #define ARCH_3  PROCESSOR_HAS_26BIT_MODE|PROCESSOR_HAS_32BIT_MODE
@@ -163,15 +168,15 @@ int mcdep_toolenv_insertdefaults(ToolEnv *t) {
 #define ARCH_4  ARCH_3|(PROCESSOR_HAS_MULTIPLY|PROCESSOR_HAS_HALFWORDS)
 #define ARCH_4T ARCH_3|(PROCESSOR_HAS_MULTIPLY|PROCESSOR_HAS_HALFWORDS)|PROCESSOR_HAS_THUMB
 
-static Processor const p_arm6      = {"#ARM6",       ARCH_3,  "#3", MULSPD(2,2,2) };
-static Processor const p_arm7      = {"#ARM7",       ARCH_3,  "#3", MULSPD(2,2,2) };
-static Processor const p_arm7M     = {"#ARM7M",      ARCH_3M, "#3M",MULSPD(8,2,3) };
-static Processor const p_arm7TM    = {"#ARM7TM",     ARCH_4T, "#4T",MULSPD(8,2,3) };
-static Processor const p_arm8      = {"#ARM8",       ARCH_4,  "#4", MULSPD(8,3,3) };
-static Processor const p_strongarm = {"#StrongARM1", ARCH_4,  "#4", MULSPD(12,1,1)};
-static Processor const p_sa1500    = {"#SA1500",     ARCH_4,  "#4", MULSPD(12,1,1)};
-static Processor const p_arm2      = {"#ARM2",       ARCH_2,  "#2", MULSPD(2,2,2) };
-static Processor const p_arm3      = {"#ARM3",       ARCH_2,  "#2", MULSPD(2,2,2) };
+static Processor const p_arm6      = {"#ARM6",       ARCH_3,  "#3", MULSPD(2,2,2), BRPEN(2) };
+static Processor const p_arm7      = {"#ARM7",       ARCH_3,  "#3", MULSPD(2,2,2), BRPEN(2) };
+static Processor const p_arm7M     = {"#ARM7M",      ARCH_3M, "#3M",MULSPD(8,2,3), BRPEN(2) };
+static Processor const p_arm7TM    = {"#ARM7TM",     ARCH_4T, "#4T",MULSPD(8,2,3), BRPEN(2) };
+static Processor const p_arm8      = {"#ARM8",       ARCH_4,  "#4", MULSPD(8,3,3), BRPEN(1) };
+static Processor const p_strongarm = {"#StrongARM1", ARCH_4,  "#4", MULSPD(12,1,1), BRPEN(2) };
+static Processor const p_sa1500    = {"#SA1500",     ARCH_4,  "#4", MULSPD(12,1,1), BRPEN(2) };
+static Processor const p_arm2      = {"#ARM2",       ARCH_2,  "#2", MULSPD(2,2,2), BRPEN(2) };
+static Processor const p_arm3      = {"#ARM3",       ARCH_2,  "#2", MULSPD(2,2,2), BRPEN(2) };
 
 static Processor const *const processors[] = {
   &p_arm6,  /* default: must come first */
@@ -293,6 +298,9 @@ bool mcdep_config_option(char name, char const tail[], ToolEnv *t)
 
     case 'r':
         return tooledit_insertwithjoin(t, "-zr", '=', tail) != TE_Failed;
+
+    case 'b':
+        return tooledit_insertwithjoin(t, "-zb", '=', tail) != TE_Failed;
     }
     return NO;
 }
@@ -393,6 +401,9 @@ KW_Status mcdep_keyword(char const *key, char const *nextarg, ToolEnv *t) {
         } else if (cistreq(nextarg, "vfp")) {
             tooledit_insert(t, "-fpu", "#vfp");
             return KW_OKNEXT;
+        } else if (cistreq(nextarg, "vfpv2")) {
+            tooledit_insert(t, "-fpu", "#vfpv2");
+            return KW_OKNEXT;
         }
         return KW_BADNEXT;
     }
@@ -550,6 +561,8 @@ void config_init(ToolEnv *t)
         config_mulbits = (proc != NULL) ? proc->mulbits : 0;
         config_multime = (proc != NULL) ? proc->multime : 0;
         config_mlatime = (proc != NULL) ? proc->mlatime : 0;
+        branch_penalty = TE_Integer(t, "-zb",
+                            (proc != NULL) ? proc->brpen : BRANCH_PENALTY_DEFAULT);
     }
 
     pcs_flags = 0;
@@ -559,8 +572,12 @@ void config_init(ToolEnv *t)
             pcs_flags |= pcs_opts[i].flag;
 
     {   char const *fpuname = toolenv_lookup(t, "-fpu");
+        vfp_version = 3;
         if (StrEq(fpuname, "#vfp")) {
             fpu_type = fpu_vfp;
+        } else if (StrEq(fpuname, "#vfpv2")) {
+            fpu_type = fpu_vfp;
+            vfp_version = 2;    /* D0-D15 only, short vectors */
         } else if (StrEq(fpuname, "#amp")) {
             fpu_type = fpu_amp;
         } else {
@@ -615,6 +632,52 @@ void mcdep_set_options(ToolEnv *t) {
 #include "aeops.h"
 #include "inlnasm.h"
 #include "flowgraf.h"
+#include "inline.h"
+
+/* Result latencies (issue to first use without an interlock) for the    */
+/* floating point operations of each FPU, indexed by FPU_Type.  FPA and   */
+/* AMP figures are for the hardware, not the emulator.                    */
+typedef struct {
+    char ld, add, mul, divf, divd, cvt;
+} FPLatency;
+
+static FPLatency const fp_latency[] = {
+    /* fpu_fpa */ { 3, 4, 5, 17, 31, 4 },
+    /* fpu_amp */ { 2, 4, 4, 20, 20, 4 },
+    /* fpu_vfp */ { 4, 8, 9, 19, 33, 8 }
+};
+
+int32 arm_joplatency(int32 op)
+{
+    FPLatency const *fp = &fp_latency[fpu_type];
+    switch (op & J_TABLE_BITS) {
+    case J_LDRFK: case J_LDRFR: case J_LDRDK: case J_LDRDR:
+    case J_LDRFV: case J_LDRDV:
+        return (config & CONFIG_SOFTWARE_FP) ? 2 : fp->ld;
+    case J_LDRK: case J_LDRR: case J_LDRBK: case J_LDRBR:
+    case J_LDRWK: case J_LDRWR:
+        return 2;
+    case J_MULK: case J_MULR:
+        return config_multime > 1 ? config_multime : 2;
+    }
+    if (!floatiness_(op) || (config & CONFIG_SOFTWARE_FP)) return 1;
+    switch (op & J_TABLE_BITS) {
+    case J_ADDFK: case J_ADDFR: case J_SUBFK: case J_SUBFR:
+    case J_ADDDK: case J_ADDDR: case J_SUBDK: case J_SUBDR:
+    case J_NEGFR: case J_NEGDR:
+        return fp->add;
+    case J_MULFK: case J_MULFR: case J_MULDK: case J_MULDR:
+        return fp->mul;
+    case J_DIVFK: case J_DIVFR:
+        return fp->divf;
+    case J_DIVDK: case J_DIVDR:
+        return fp->divd;
+    case J_FLTFR: case J_FLTDR: case J_FIXFR: case J_FIXDR:
+    case J_MOVDFR: case J_MOVFDR:
+        return fp->cvt;
+    }
+    return 1;
+}
 
 static uint32 movc_workregs1(Icode const *ic);
 
@@ -886,6 +949,12 @@ static uint32 GetUsedRegs(Binder *b)
 
     if (var_cc_private_flags & 1024L)   /* usedregs optimization disabled */
         return volatile_regs;
+    if (symext_(s) == NULL || !(symext_(s)->extflags & (xr_defloc+xr_defext)))
+    {   RealRegSet used;
+        /* Defined in another unit: a linker veneer may corrupt IP too.   */
+        if (Inline_SummaryUsedRegs(s, &used))
+            return used.map[0] | regbit(R_IP);
+    }
     return (symext_(s) != NULL) ? symext_(s)->usedregs.map[0] : volatile_regs;
 }
 
@@ -1232,6 +1301,10 @@ void RealRegisterUse(const Icode *ic, RealRegUse *u)
             break;
     }
 
+    // VFP corrupts its scratch register, which then has to be saved.
+    if (fpu_type == fpu_vfp && vfp_usesscratch(ic))
+        c_out |= regbit(R_FSCRATCH);
+
     if ((ic->op & J_TABLE_BITS) < J_LAST_JOPCODE && j_is_ldr_or_str(ic->op)
         && OverlargeMemOffset(ic))
         c_in |= regbit(R_IP);
@@ -298,6 +298,7 @@ extern unsigned ldm_regs_max;
 typedef struct
 {   char name[16]; Uint flags; char arch[4];
     char mulbits, multime, mlatime;
+    char brpen;         /* extra cycles for a taken branch */
 } Processor;
 Processor const *LookupProcessor(char const *name);
 Processor const *LookupArchitecture(char const *name);
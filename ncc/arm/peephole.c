@@ -1125,8 +1125,166 @@ static bool MayMatch(PendingOp *ops[], PeepOp const peepops[],
   return YES;
 }
 
+/*
+ * Load/store clustering.  The LDM/STM peepholer in gen.c (ldm_outinstr)
+ * can only merge word transfers which arrive one after another with the
+ * same base register.  Before the pending ops are shown we look (within
+ * one straight-line stretch) for LDR/STR of adjacent words from the same
+ * base which have been separated by unrelated instructions, and hoist the
+ * later ones up next to the first so that gen.c sees them together.
+ * Registers must ascend with the address, as required by LDM/STM, and no
+ * more than ldm_regs_max are gathered into one group.
+ */
+
+#define LdmClusterWindow 16
+
+#define ldm_printf if (localcg_debug(4)) cc_msg
+
+static bool ldm_clusterable(PendingOp const *p)
+{ int32 op = p->ic.op;
+  RealRegister r1 = p->ic.r1.rr, r2 = p->ic.r2.rr;
+  int32 off = p->ic.r3.i;
+  if (op != J_LDRK+J_ALIGN4 && op != J_STRK+J_ALIGN4) return NO;
+  if (p->cond != Q_AL || (p->peep & ~P_BASEALIGNED) != 0) return NO;
+  if (r2 == R_PC || r2 == R_IP || r1 == R_IP || r1 == R_PC || r1 == R_SP)
+    return NO;
+  if (op == J_LDRK+J_ALIGN4 && r1 == r2) return NO;
+  return -0xfff <= off && off <= 0xfff;
+}
+
+/* Returns the number of bytes transferred by a simple reg+offset access, */
+/* or 0 if the extent of the access isn't obvious.                        */
+static int32 ldm_access_size(PendingOp const *p)
+{ int32 op = p->ic.op;
+  int32 size;
+  if (p->peep & (P_PRE | P_POST | P_RSHIFT)) return 0;
+  switch (op & J_TABLE_BITS) {
+  case J_LDRBK: case J_STRBK: return 1;
+  case J_LDRWK: case J_STRWK: size = 2; break;
+  case J_LDRK:  case J_STRK:
+  case J_LDRFK: case J_STRFK: size = 4; break;
+  case J_LDRLK: case J_STRLK:
+  case J_LDRDK: case J_STRDK: size = 8; break;
+  default: return 0;
+  }
+  /* unaligned accesses are expanded into wider loads of their neighbours */
+  if ((op & J_ALIGNMENT) < J_ALIGN2 ||
+      (size >= 4 && (op & J_ALIGNMENT) < J_ALIGN4)) return 0;
+  return size;
+}
+
+/* An op which may safely be hoisted over, given suitable register and   */
+/* memory independence.  Anything else ends the stretch being examined.  */
+static bool ldm_transparent(PendingOp const *p)
+{ if (p->cond != Q_AL || (p->ic.op & J_VOLATILE)) return NO;
+  switch (p->ic.op & J_TABLE_BITS) {
+  case J_NOOP:
+  case J_MOVK: case J_MOVR: case J_MVNK: case J_MVNR:
+  case J_ADDK: case J_ADDR: case J_SUBK: case J_SUBR:
+  case J_RSBK: case J_RSBR: case J_ANDK: case J_ANDR:
+  case J_ORRK: case J_ORRR: case J_EORK: case J_EORR:
+  case J_BICK: case J_BICR: case J_NEGR: case J_NOTR:
+  case J_SHLK: case J_SHLR: case J_SHRK: case J_SHRR:
+  case J_RORK: case J_RORR: case J_MULK: case J_MULR:
+  case J_CMPK: case J_CMPR: case J_CMNK: case J_CMNR:
+  case J_TSTK: case J_TSTR: case J_TEQK: case J_TEQR:
+  case J_ADCON: case J_STRING:
+    return YES;
+  case J_LDRBK: case J_STRBK: case J_LDRWK: case J_STRWK:
+  case J_LDRK:  case J_STRK:  case J_LDRLK: case J_STRLK:
+  case J_LDRFK: case J_STRFK: case J_LDRDK: case J_STRDK:
+    return !(p->peep & P_TRANS);
+  default:
+    return NO;
+  }
+}
+
+/* May q be moved to immediately before ops[from]?  (All of ops[from..to-1] */
+/* have already been checked to be transparent.)  The move is only worth  */
+/* making if some op passed over would have forced gen.c to flush the     */
+/* group (regs being the registers already in it).  If it is made, clear  */
+/* any dead bits of q which the move would make untrue.                   */
+static bool ldm_can_hoist(PendingOp *ops, int from, int to, uint32 regs)
+{ PendingOp *q = &ops[to];
+  RealRegister rd = q->ic.r1.rr, base = q->ic.r2.rr;
+  bool isload = (q->ic.op & J_TABLE_BITS) == J_LDRK;
+  int32 off = q->ic.r3.i;
+  uint32 used = 0;
+  bool disrupts = NO;
+  int i;
+  for (i = from; i < to; i++) {
+    PendingOp *x = &ops[i];
+    RegisterUsage u;
+    if (x->ic.op == J_NOOP) continue;
+    if (GetRegisterUsage(x, &u)) return NO;
+    if (regs_written(&u) & (regbit(base) | regbit(rd))) return NO;
+    if (isload && (regs_read(&u) & regbit(rd))) return NO;
+    if (a_uses_mem(x)) {
+      if (!isload || a_modifies_mem(x)) {
+        int32 size = ldm_access_size(x);
+        if (size == 0 || x->ic.r2.rr != base ||
+            (x->ic.r3.i < off + 4 && off < x->ic.r3.i + size))
+          return NO;
+      }
+      if (x->ic.r2.rr != base || (a_modifies_mem(x) != 0) == isload)
+        disrupts = YES;
+    }
+    if ((regs_used(&u) & (regbit(base) | (isload ? regs : 0))) ||
+        (regs_written(&u) & regs))
+      disrupts = YES;
+    used |= regs_read(&u);
+  }
+  if (!disrupts) return NO;
+  if (used & regbit(base)) q->dataflow &= ~J_DEAD_R2;
+  if (used & regbit(rd)) q->dataflow &= ~J_DEAD_R1;
+  return YES;
+}
+
+static void ldm_cluster(PendingOp *ops, int n)
+{ int i, j;
+  for (i = 0; i < n; i++) {
+    PendingOp *p = &ops[i];
+    int32 lo, hi, op;
+    RealRegister loreg, hireg;
+    uint32 regs;
+    unsigned count = 1;
+    int end = i;
+    if (!ldm_clusterable(p)) continue;
+    op = p->ic.op;
+    lo = hi = p->ic.r3.i;
+    loreg = hireg = p->ic.r1.rr;
+    regs = regbit(loreg);
+    for (j = i+1; j < n && j - i <= LdmClusterWindow; j++) {
+      PendingOp *q = &ops[j];
+      int32 off = q->ic.r3.i;
+      RealRegister r = q->ic.r1.rr;
+      if (count >= ldm_regs_max) break;
+      if (ldm_clusterable(q) && q->ic.op == op &&
+          q->ic.r2.rr == p->ic.r2.rr &&
+          ((off == hi+4 && r > hireg) || (off == lo-4 && r < loreg)) &&
+          !(j+1 < n && (ops[j+1].ic.op & J_TABLE_BITS) == J_USE) &&
+          (j == end+1 || ldm_can_hoist(ops, end+1, j, regs))) {
+        if (j != end+1) {
+          PendingOp temp; temp = *q;
+          memmove(&ops[end+2], &ops[end+1], (j-end-1) * sizeof(PendingOp));
+          ops[end+1] = temp;
+          ldm_printf("-- ldm cluster: hoist r%ld, [r%ld, #%ld] over %d\n",
+                     (long)r, (long)p->ic.r2.rr, (long)off, j-end-1);
+        }
+        end++; count++; regs |= regbit(r);
+        if (off > hi) hi = off, hireg = r; else lo = off, loreg = r;
+        continue;
+      }
+      if (!ldm_transparent(q)) break;
+    }
+    i = end;
+  }
+}
+
 static void flush_pending(int leave)
 { PendingOp *p = &pendingstack[0];
+  if (var_ldm_enabled != 0 && pending-leave >= pendingstack)
+    ldm_cluster(pendingstack, pending-leave - pendingstack + 1);
   for (; p <= pending-leave; p++)
     if (p->ic.op != J_NOOP)
       show_inst_direct(p);
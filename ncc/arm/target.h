@@ -47,6 +47,12 @@
 #  define TARGET_HAS_DEBUGGER           1
 #endif
 #define TARGET_HAS_COND_EXEC            1
+#define target_branch_penalty           branch_penalty
+extern int branch_penalty;
+   /* cycles lost by a taken branch on the selected processor (-zb) */
+#define target_joplatency(op)           arm_joplatency(op)
+extern int32 arm_joplatency(int32 op);
+   /* cycles before the result of jopcode op can be used without a stall */
 #define TARGET_HAS_SCALED_ADDRESSING    1
 #define TARGET_HAS_NEGATIVE_INDEXING    1
 #define target_shiftop_allowed(a,b,c,d) arm_shiftop_allowed(a, b, c, d)
@@ -140,6 +146,9 @@ extern int32 numFloatVarRegs();
                              16,17,18,19, 20,21,22,23, \
                              24,25,26,27, 28,29,30,31, \
                              255}
+
+// Simple float loops can be handed to short-vector kernels (vfp.c).
+#  define TARGET_HAS_VECTOR_KERNELS 1
 #endif
 
 #define NINTREGS       16L  /* same as smallest fp reg, usually R_F0 */
@@ -149,6 +158,11 @@ extern int32 numFloatVarRegs();
 // Maximum number of float regs, used for array allocations only.
 #define MAXFLTARGREGS   8
 #define MAXFLTVARREGS   8
+// Size of the float register bank as seen by the allocator. VFP allocates
+// D0-D14 and keeps D15 as the code generator's scratch register, which is
+// saved like a var register by any function that uses it (see vfp.c).
+#define MAXFLTREGS      16
+#define R_FSCRATCH      (R_F0+15)
 
 #define R_FV1           (R_F0+NFLTARGREGS)
 #define MAXGLOBFLTREG   4L
@@ -216,6 +230,10 @@ extern char *target_asm_options(ToolEnv *);
 #  define LDM_REGCOUNT_MIN_DEFAULT  3
 #endif
 
+#ifndef BRANCH_PENALTY_DEFAULT
+#  define BRANCH_PENALTY_DEFAULT 2
+#endif
+
 #ifndef STRUCT_PTR_ALIGN_DEFAULT
 #  define STRUCT_PTR_ALIGN_DEFAULT 1
 #endif
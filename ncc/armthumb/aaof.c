@@ -35,6 +35,7 @@
 #include "cg.h"                  /* has_main */
 #include "armops.h"
 #include "vargen.h"
+#include "inline.h"              /* Inline_SummaryChecksums */
 
 #ifdef PUT_FILE_NAME_IN_AREA_NAME
 #  include "fname.h"
@@ -103,6 +104,7 @@ struct DebugAreaDesc {
     Symstr *sym;
     Symstr *refsym;
     int32 size, nrelocs;
+    bool common;                /* COMDEF: folded with same-named areas */
 };
 static DebugAreaDesc *debugareas, **debugareas_tail;
 static DebugAreaDesc *curdebugarea;
@@ -144,6 +146,11 @@ static int32 obj_stringpos, obj_symcount, aof_hdr_offset;
 Symstr *data_sym, *bss_sym, *adcon_sym, *ddtor_sym,
   *extable_sym, *exhandler_sym;
 
+/* The checksums of the register summaries written by -zgs (inline.c).  */
+static Symstr *regsummary_sym;
+static uint32 *regsummary_keys;
+static int32 nregsummary_keys;
+
 ExtRef *obj_symlist;
 CodeXref *codexrefs;
 DataXref *dbgxrefs;
@@ -542,6 +549,9 @@ static void obj_writedata(DataInit *p)
             }
             while (rpt-- != 0) obj_fwrite(&val, 1, len, objstream);
             break;
+        case LIT_BLOB:    /* already in target sex */
+            obj_fwrite((void const *)ptrval, 1, len, objstream);
+            break;
         case LIT_NUMBER:
             if (len != 4) syserr(syserr_obj_datalen, (long)len);
             /* drop through */
@@ -816,18 +826,40 @@ void obj_enddebugarea(char const *name, DataXref *relocs) {
     p->nrelocs = obj_datarelocation(relocs, 0L);
 }
 
-Symstr *obj_notedebugarea(char const *name)
+static DebugAreaDesc *obj_newdebugarea(char const *name, DebugAreaDesc **where)
 {
     DebugAreaDesc *p = (DebugAreaDesc *)GlobAlloc(SU_Dbg, sizeof(*p));
-    *debugareas_tail = p; debugareas_tail = &cdr_(p);
-    cdr_(p) = NULL; p->sym = sym_insert_id(name);
-    p->size = 0; p->nrelocs = 0;
+    cdr_(p) = *where; *where = p;
+    if (debugareas_tail == where) debugareas_tail = &cdr_(p);
+    p->sym = sym_insert_id(name);
+    p->size = 0; p->nrelocs = 0; p->common = NO;
     obj_symref(p->sym, OBJ_DUMMYSYM, 0L);
     { char s[64]; s[0] = s[1] = '$';
       strcpy(&s[2], name);
       p->refsym = sym_insert_id(s);
       obj_symref(p->refsym, xr_data, 0L);
     }
+    return p;
+}
+
+Symstr *obj_notedebugarea(char const *name)
+{
+    return obj_newdebugarea(name, debugareas_tail)->refsym;
+}
+
+/* A common debug area, placed after the area 'after' and any common    */
+/* areas already placed there.  It must be written in that order.       */
+/* May be called while number_areas() is walking the list.              */
+Symstr *obj_notecommondebugarea(char const *name, char const *after)
+{
+    DebugAreaDesc *p = debugareas;
+    for (; p != NULL; p = cdr_(p))
+        if (strcmp(after, symname_(p->sym)) == 0)
+            break;
+    if (p == NULL) syserr("obj_notecommondebugarea %s", after);
+    while (cdr_(p) != NULL && cdr_(p)->common) p = cdr_(p);
+    p = obj_newdebugarea(name, &cdr_(p));
+    p->common = YES;
     return p->refsym;
 }
 
@@ -874,6 +906,7 @@ void obj_init(void)
         obj_symref(exhandler_sym = sym_insert_id("C$$exhandler"), OBJ_DUMMYSYM,0L);
 #endif
     obj_symref(ddtor_sym = sym_insert_id("C$$ddtorvec"), OBJ_DUMMYSYM, 0L);
+    obj_symref(regsummary_sym = sym_insert_id("C$$regsummary"), OBJ_DUMMYSYM, 0L);
     obj_symref(adcon_sym= sym_insert_id("sb$$adcons"),OBJ_DUMMYSYM, 0L);
     adconpool_lab = sym_insert_id("x$adcons");
     byte_reversing = (target_lsbytefirst != host_lsbytefirst);
@@ -955,6 +988,7 @@ static void number_areas(void) {
     i = SetExtIndex(ddtor_vecsize(), ddtor_sym, i);
     i = SetExtIndex(extable_size(), extable_sym, i);
     i = SetExtIndex(exhandler_size(), exhandler_sym, i);
+    i = SetExtIndex(4 * nregsummary_keys, regsummary_sym, i);
     {   DebugAreaDesc *p = debugareas;
         for (; p != NULL; p = cdr_(p))
             i = SetExtIndex(dbg_debugareaexists(symname_(p->sym)), p->sym, i);
@@ -974,6 +1008,7 @@ static void obj_aof_header(void)
     if (bss_size != 0) ++nareas;
     if (adconpool.size != 0) ++nareas;
     if (ddtor_vecsize() != 0) ++nareas;
+    if (nregsummary_keys != 0) ++nareas;
     {   DebugAreaDesc *p = debugareas;
         for (; p != NULL; p = cdr_(p))
             if (dbg_debugareaexists(symname_(p->sym))) ++nareas;
@@ -1062,6 +1097,14 @@ static void obj_aof_header(void)
         obj_fwrite(&d, 4, sizeof(aof_area)/4, objstream);
     }
 
+/* ... and the register summary checksums, which the linker may drop */
+    memset(&d, 0, sizeof(d));
+    if ((d.area_size = 4 * nregsummary_keys) != 0)
+    {   d.area_name = obj_checksym(regsummary_sym);
+        d.area_attributes = 2 + AOF_RONLYAT + AOF_DEBUGAT;
+        obj_fwrite(&d, 4, sizeof(aof_area)/4, objstream);
+    }
+
 /* ... and the debug areas */
     {   DebugAreaDesc *p = debugareas;
         for (; p != NULL; p = cdr_(p))
@@ -1070,6 +1113,7 @@ static void obj_aof_header(void)
                 d.area_size = p->size;
                 d.area_name = obj_checksym(p->sym);
                 d.area_attributes = 2 + AOF_RONLYAT + AOF_DEBUGAT;
+                if (p->common) d.area_attributes |= AOF_COMDEFAT;
                 d.area_nrelocs = p->nrelocs;
                 obj_fwrite(&d, 4, sizeof(aof_area)/4, objstream);
             }
@@ -1088,6 +1132,7 @@ void obj_trailer(void)
     /* just a reference to __main is enough to cause the library module    */
     /* containing it to be loaded.                                         */
     localcg_endcode();
+    nregsummary_keys = Inline_SummaryChecksums(&regsummary_keys);
 #ifdef CONST_DATA_IN_CODE
     obj_add_constdata_area();
     {   int32 n;
@@ -1144,6 +1189,10 @@ void obj_trailer(void)
         obj_writedata(exhandler_head());
         area_siz += exhandler_size();
       }
+    if (nregsummary_keys != 0)
+    {   obj_fwrite(regsummary_keys, 4, nregsummary_keys, objstream);
+        area_siz += 4 * nregsummary_keys;
+    }
 #ifdef TARGET_HAS_DEBUGGER
     if (debugging(DEBUG_OBJ)) cc_msg("writedebug\n");
     dbg_writedebug();
@@ -1175,6 +1224,80 @@ void obj_trailer(void)
     /* file now closed in main() where opened */
 }
 
+/* Reading back an object file written by an earlier compilation (for   */
+/* the register summary checksums).  Its words are in target byte order. */
+
+static uint32 obj_getword(uint8 const *p)
+{   return target_lsbytefirst
+        ? p[0] | p[1] << 8 | p[2] << 16 | (uint32)p[3] << 24
+        : p[3] | p[2] << 8 | p[1] << 16 | (uint32)p[0] << 24;
+}
+
+/* Reads size bytes at offset in f, or returns NULL. */
+static uint8 *obj_readbytes(FILE *f, uint32 offset, uint32 size)
+{   uint8 *p;
+    if (size == 0 || fseek(f, (long)offset, SEEK_SET) != 0) return NULL;
+    p = (uint8 *)GlobAlloc(SU_Other, (int32)size);
+    return fread(p, 1, (size_t)size, f) == size ? p : NULL;
+}
+
+/* Finds the chunk key in the chunk file header cfh. */
+static bool obj_findchunk(uint8 const *cfh, char const *key,
+                          uint32 *offset, uint32 *size)
+{   uint32 i, n = obj_getword(cfh + offsetof(cf_header, cf_numchunks));
+    for (i = 0; i < n && i < OBJ_MAXCHUNKS; i++)
+    {   uint8 const *e = cfh + offsetof(cf_header, cf_chunks) + i*sizeof(cf_entry);
+        if (memcmp(e, key, 8) == 0)
+        {   *offset = obj_getword(e + offsetof(cf_entry, cfe_offset));
+            *size = obj_getword(e + offsetof(cf_entry, cfe_size));
+            return YES;
+        }
+    }
+    return NO;
+}
+
+uint32 *obj_readarea(char const *file, char const *name, int32 *nwords)
+{   uint8 cfh[sizeof(cf_header) + (OBJ_MAXCHUNKS-1)*sizeof(cf_entry)];
+    uint8 *head, *strt, *b = NULL;
+    uint32 *v = NULL;
+    uint32 headpos, headsize, strtpos, strtsize, areapos, areasize, size = 0;
+    FILE *f = fopen(file, "rb");
+    if (f == NULL) return NULL;
+    if (fread(cfh, 1, sizeof(cfh), f) == sizeof(cfh) &&
+        obj_getword(cfh) == CF_MAGIC &&
+        obj_findchunk(cfh, "OBJ_HEAD", &headpos, &headsize) &&
+        obj_findchunk(cfh, "OBJ_STRT", &strtpos, &strtsize) &&
+        obj_findchunk(cfh, "OBJ_AREA", &areapos, &areasize) &&
+        (head = obj_readbytes(f, headpos, headsize)) != NULL &&
+        (strt = obj_readbytes(f, strtpos, strtsize)) != NULL)
+    {   uint32 i, nareas = obj_getword(head + offsetof(aof_header, aof_nareas));
+        uint8 const *a = head + offsetof(aof_header, aof_areas);
+        for (i = 0; i < nareas && a + sizeof(aof_area) <= head + headsize;
+             i++, a += sizeof(aof_area))
+        {   uint32 aname = obj_getword(a + offsetof(aof_area, area_name));
+            uint32 attr = obj_getword(a + offsetof(aof_area, area_attributes));
+            size = obj_getword(a + offsetof(aof_area, area_size));
+            if (aname < strtsize &&
+                strncmp((char const *)strt + aname, name, strtsize - aname) == 0)
+            {   if (!(attr & AOF_0INITAT) && size <= areasize)
+                    b = obj_readbytes(f, areapos, size);
+                break;
+            }
+            if (!(attr & AOF_0INITAT))
+                areapos += size + obj_getword(a + offsetof(aof_area, area_nrelocs))
+                                  * sizeof(aof_reloc);
+        }
+    }
+    if (b != NULL)
+    {   int32 j;
+        *nwords = (int32)(size / 4);
+        v = (uint32 *)GlobAlloc(SU_Other, 4 * *nwords);
+        for (j = 0; j < *nwords; j++) v[j] = obj_getword(b + 4*j);
+    }
+    fclose(f);
+    return v;
+}
+
 /* end of armobj.c */
 
 DataDesc adconpool;
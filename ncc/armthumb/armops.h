@@ -342,8 +342,14 @@
 #define M_ARGREGS       (regbit(R_A1+NARGREGS)-regbit(R_A1))
 #define M_VARREGS       (regbit(R_V1+NVARREGS)-regbit(R_V1))
 #define M_FARGREGS      (regbit(R_F0+NFLTARGREGS)-regbit(R_F0))
+#ifdef R_FSCRATCH
+#define M_FVARREGS      ((regbit(R_F0+NFLTVARREGS+NFLTARGREGS) - \
+                          regbit(R_F0+NFLTARGREGS)) | \
+                         (fpuIsVFP() ? regbit(R_FSCRATCH) : 0))
+#else
 #define M_FVARREGS      (regbit(R_F0+NFLTVARREGS+NFLTARGREGS) - \
                          regbit(R_F0+NFLTARGREGS))
+#endif
 
 /* #define R_F0    0x10L   / * 16 added to avoid muddle with integer regs.   */
 #define R_F1    0x11L
@@ -63,6 +63,8 @@
 "-p[<options>]   Generate code suitable for profiling",\
 "-S              Output assembly code instead of object code",\
 "-zM             Generate code suitable for building a RISC OS relocatable module",\
+"-fpu <fpu>      Select the floating point unit: fpa, amp, vfp, or vfpv2 (which",\
+"                also runs simple float loops in VFP short-vector mode)",\
 "",\
 "Linker options:",\
 "",\
@@ -78,6 +80,10 @@
 "",\
 "-zp<alpha><num> Emulate #pragma directives, given in their short <alpha><num> form",\
 "-zr<num>        Restrict size of LDMs and STMs to help control interrupt latency",\
+"-zb<num>        Cycles lost by a taken branch, for conditional execution choices",\
+"-zGS<file>      Write inline summaries of small external functions to <file>",\
+"-zGI<files>     Read inline summaries (comma-separated files) written by -zGS",\
+"-zGT<file>      C++: share template function instances between units via <file>",\
 "-f<features>    Enable a selection of compiler defined features"
 
 #define PROFILE_COUNTS_INLINE 1
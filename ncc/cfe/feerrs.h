@@ -54,6 +54,7 @@
 #define syn_warn_archaic_fnpara "archaic C-style function parameter $l"
 #define syn_warn_special_ops "'=', ',' or unary '&' defined as non-member"
 #define syn_warn_ineffective_asm_decl "asm(...) ignored: inline assembler not available"
+#define syn_warn_lazy_bodies_cpp "--lazy-bodies has no effect on C++ (ignored)"
 #define syn_warn_insert_sym_anachronism "inserting $r in ':(...)' anachronism"
 #define syn_warn_superfluous_prefix \
      "superfluous 'union','class', 'struct' or 'enum' prefix"
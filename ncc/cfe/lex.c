@@ -46,7 +46,7 @@
 #  include "inlnasm.h"
 #endif
 
-#define lex_getbodysym() ((void) 0)
+static void lex_getbodysym(void);
 #define lex_putbodysym() ((void) 0)
 #define save_names(a)    ((void) 0)
 #endif
@@ -66,6 +66,99 @@ static int lexbuf_max;
 static int buffersym_bufidx;
 /* */
 
+static const SymBuf lexbuf_empty =
+   { 0, { s_eof }, (SymInfo *)DUFF_ADDR, 0, /*pos*/ -1, 0, NO, /* old_put_handle */ -1 };
+#define INIT_NLEXBUFS 8         /* initially max 8 member fn defs.      */
+#define INIT_LEXBUFSIZE 32      /* initially max 32 tokens per def.     */
+
+/* C++ requires function definitions within class definitions to be     */
+/* lexed, but not parsed (typedefs) nor typechecked [ES, p178].         */
+/* We save them as as token streams until we are ready -- the end       */
+/* is observable by counting {}'s.                                      */
+/* Note there is a complication about reading such a saved token stream */
+/* since such a fn body may contain embedded fns within yet other       */
+/* (local) class definitions.                                           */
+/* Globalise everything to be buffered for now (very little to do).     */
+/* C uses the same buffers for the bodies of static functions whose     */
+/* parsing is deferred (--lazy-bodies).                                 */
+
+static int lex_findsavebuf(void)
+{   int i;
+    for (i = 0; i<lexbuf_max; i++)
+        if (lexbuf_vec[i].pos < 0)
+            return i;
+    {   int nmax = (lexbuf_max == 0 ? INIT_NLEXBUFS : 2*lexbuf_max);
+        SymBuf *nvec = (SymBuf *)GlobAlloc(SU_Other,
+                                     (int32)nmax * sizeof(SymBuf));
+        memcpy(nvec, lexbuf_vec, lexbuf_max * sizeof(SymBuf));
+        for (i = lexbuf_max; i < nmax; i++) nvec[i] = lexbuf_empty;
+        lexbuf_max = nmax, lexbuf_vec = nvec;
+        return lex_findsavebuf();       /* retry */
+    }
+}
+
+static void lex_ensurebuf(SymBuf *p)
+{   int nsize = (p->size == 0 ? INIT_LEXBUFSIZE : p->size*2);
+    SymInfo *nbuf = (SymInfo *)GlobAlloc(SU_Other,
+                                         (int32)nsize * sizeof(SymInfo));
+    memcpy(nbuf, p->buf, p->size * sizeof(SymInfo));
+    p->size = nsize, p->buf = nbuf;
+}
+
+static void lex_dumpbuf(const SymBuf *p)
+{
+    if (p->pos < 0)
+        cc_msg("unused lexbuf\n");
+    else
+    {   int i = 0;
+        cc_msg("    ");
+        for (;;)
+        {   cc_msg("$k ", p->buf[i]);
+            ++i;
+            if (0 < p->count && p->count <= i)
+                break;
+            else if (p->buf[i].sym == s_eof)
+                break;
+            if (i % 8 == 0)
+                cc_msg("\n    ");
+        }
+        cc_msg("\n");
+    }
+}
+
+/* lex_savebody() reads and saves (on the fly) a member fn body.        */
+/* maybe should be called lex_saveblock */
+int lex_savebody(void)
+{   int h = lex_findsavebuf();
+    SymBuf *p = &lexbuf_vec[h];
+    int k = 0, braces = 0;
+    if (debugging(DEBUG_LEX))
+        cc_msg("lex_savebody: [%d]\n", h);
+    p->pos = 0;                 /* inuse + ready for reader.        */
+/* save all the tokens in p->buf, followed by a s_eof token.        */
+    for (;;)
+    {   if (k >= p->size) lex_ensurebuf(p);
+        lex_beware_reinit();                    /* globalise curlex     */
+        if (debugging(DEBUG_LEX))
+            cc_msg("lex_savebody: saving $l in [%d]\n", h);
+        p->buf[k++] = curlex;
+        switch (curlex.sym)
+        {   case s_lbrace: braces++;
+            default:       nextsym();
+                           break;
+            case s_rbrace: if (--braces == 0) curlex.sym = s_eof;
+                           else nextsym();
+                           break;
+            case s_eof:    p->count = k;
+                           if (debugging(DEBUG_LEX))
+                           {   cc_msg("lex_savebody: [%d] is\n", h);
+                               lex_dumpbuf(p);
+                           }
+                           return h;
+        }
+    }
+}
+
 static FileLine endofsym_fl;
 
 /* exports: nextsym(), curlex, nextsym_for_hashif(),
@@ -96,6 +189,16 @@ bool inside_valof_block;
 static Symstr *resultisword;
 #endif
 
+/* An #embed file reaches us as "___embed <n>" (see pp.c) and is read   */
+/* as the tokens "b0 , b1 , ... ".  p is the next byte, n the number of */
+/* bytes not yet read and comma says whether a ',' comes before *p.     */
+static Symstr *embedword;
+static struct {
+    unsigned8 const *p;
+    int32 n;
+    bool comma;
+} lex_embed;
+
 #ifdef TARGET_HAS_INLINE_ASSEMBLER
 int asm_mode = ASM_NONE;
 static bool in_asm_string = NO;
@@ -118,6 +221,22 @@ static unsigned32 lexclass[1+255];
    with that
  */
 
+/* Keywords are found through a perfect hash of sym_lookup()'s hash of */
+/* the name (computed by next_basic_sym() as it reads the name), so     */
+/* they need not be looked for in the symbol table.  The multiplier is  */
+/* searched for once the keywords of this language and mode are known, */
+/* at the first identifier, so after any compiled header (which         */
+/* replaces the symbol table) has been loaded.  Should none be found,   */
+/* kwmult is left 0 and the table empty.                                */
+#define KWHASHBITS      10
+#define KWMAX           128
+#define kwhash_(h) ((int)(just32bits_((h) * kwmult) >> (32 - KWHASHBITS)))
+static Symstr *kwtab[1 << KWHASHBITS];
+static char const *kwnames[KWMAX];
+static int nkwnames;
+static bool kwtab_built;
+static unsigned32 kwmult;
+
 /* 'curlex.a2.flag' values - only exported for make_integer (q.v.) */
 /* the values are chosen for easy punning into sem.c types  */
 
@@ -320,6 +439,20 @@ static int nextchar(void)
     (((c) == 'x') || ((c) == 'X'))
 
 
+/* Appends to namebuf[k..] the digits (hex digits if hex) at the start */
+/* of the run already produced by pp, leaving the rest of any number to */
+/* be read by nextchar(), and returns the new k.                        */
+static int32 lex_digitrun(int32 k, bool hex)
+{   char const *p, *limit;
+    for (p = pp_nextrun(&limit); p < limit && k < NAMEMAX; p++)
+    {   int ch = *p & 0xff;
+        if (!(hex ? isxdigit(ch) : isdigit(ch))) break;
+        namebuf[k++] = ch;
+    }
+    pp_takerun(p);
+    return k;
+}
+
 static int32 read_floating(int32 k)
 {   int32 flag = NUM_FLOAT;
     while (isdigit(curchar))
@@ -375,6 +508,7 @@ static AEop read_number(int radix)
     {   while (isxdigit(curchar))
         {   if (k < NAMEMAX)
             {   namebuf[k++] = curchar;
+                k = lex_digitrun(k, YES);
                 nextchar();
             }
             else
@@ -395,6 +529,7 @@ static AEop read_number(int radix)
     {   while (isdigit(curchar))
         {   if (k < NAMEMAX)
             {   namebuf[k++] = curchar;
+                k = lex_digitrun(k, NO);
                 nextchar();
             }
             else
@@ -674,11 +809,78 @@ static void read_string(int quote, AEop type, bool lengthwanted)
     }
 }
 
+static AEop lex_embedsym(void)
+{   if (lex_embed.comma)
+    {   lex_embed.comma = NO;
+        return (curlex.sym = s_comma);
+    }
+    curlex.a1.i = *lex_embed.p++;
+    curlex.a2.flag = NUM_INT;
+    if (--lex_embed.n == 0)
+        lex_embed.p = NULL;
+    else
+        lex_embed.comma = YES;
+    return (curlex.sym = s_integer);
+}
+
+int32 lex_embedtake(int32 max, unsigned8 const **bytes)
+{   int32 n = lex_embed.n;
+    if (lex_embed.p == NULL || !lex_embed.comma || curlex.sym != s_integer ||
+        nextlex.sym != s_nothing || LanguageIsCPlusPlus)
+        return 0;
+/* curlex is the byte before lex_embed.p.  The last byte of the file is  */
+/* always left to be read as a token, lest it be the start of a larger   */
+/* expression.                                                           */
+    if (n > max) n = max;
+    *bytes = lex_embed.p - 1;
+    lex_embed.p += n - 1;
+    lex_embed.n -= n - 1;
+    nextsym();
+    return n;
+}
+
 #define CPP_word 256      /* identifier (but warned) for C, keyword for C++ */
 #define CPP_word2 512     /* keyword for C++, but currently warned+ident.   */
 #define CPP_word3 1024    /* keyword for C++, but currently warn that       */
                           /* feature is not fully implemented.              */
 
+static unsigned32 lex_hash(char const *s)
+{   unsigned32 hash = 1;
+    for (; *s != 0; s++) hash = sym_hashchar_(hash, *s);
+    return hash;
+}
+
+static void lex_buildkwtab(void)
+{   Symstr *kw[KWMAX];
+    unsigned32 kwh[KWMAX];
+    int i, tries;
+    for (i = 0; i < nkwnames; i++)
+    {   kw[i] = sym_lookup(kwnames[i], SYM_GLOBAL);
+        kwh[i] = lex_hash(kwnames[i]);
+    }
+    for (tries = 1; tries < 1000; tries++)
+    {   kwmult = just32bits_((unsigned32)(2*tries - 1) * 0x9e3779b1);
+        memclr(kwtab, sizeof(kwtab));
+        for (i = 0; i < nkwnames; i++)
+        {   Symstr **slot = &kwtab[kwhash_(kwh[i])];
+            if (*slot != NULL) break;
+            *slot = kw[i];
+        }
+        if (i == nkwnames) break;
+    }
+    if (i != nkwnames)
+    {   kwmult = 0;
+        memclr(kwtab, sizeof(kwtab));
+    }
+    embedword = sym_insert_id("___embed");
+    kwtab_built = YES;
+}
+
+static void lex_keyword(char const *name, int32 sym)
+{   sym_insert(name, sym);
+    if (nkwnames < KWMAX) kwnames[nkwnames++] = name;
+}
+
 static AEop next_basic_sym(void)
 /* all of nextsym() except debug info */
 {   unsigned32 charinfo;
@@ -688,6 +890,7 @@ static AEop next_basic_sym(void)
     if (endofsym_fl.filepos != -1 && !pp_inhashif)
         curlex.fl = endofsym_fl;
 
+    if (lex_embed.p != NULL) return lex_embedsym();
     if (curchar == NOTACHAR) nextchar();
     startofsym_fl = curlex.fl;
     for (;;)
@@ -729,13 +932,26 @@ default:    if (curchar == '#' || curchar == '\\')
             break;
 case l_idstart:
         {   int k = 0;          /* number of characters read */
-            do
+            unsigned32 hash = 1;
+            char const *p, *limit;
+            namebuf[k++] = curchar;
+            hash = sym_hashchar_(hash, namebuf[0]);
+            /* the rest of the name is usually already in pp's buffer   */
+            for (p = pp_nextrun(&limit);
+                 p < limit && (lexclass_(*p) & l_idcont); p++)
+                if (k < NAMEMAX)
+                {   namebuf[k++] = *p;
+                    hash = sym_hashchar_(hash, *p);
+                }
+            pp_takerun(p);
+            nextchar();
+            while (lexclass_(curchar) & l_idcont)
             {   if (k < NAMEMAX)
-                {
-                    namebuf[k++] = curchar;
+                {   namebuf[k++] = curchar;
+                    hash = sym_hashchar_(hash, namebuf[k-1]);
                 }
                 nextchar();
-            } while (lexclass_(curchar) & l_idcont);
+            }
             namebuf[k] = 0;
 /* Check if ANSI wide string/char -- illegal syntax in olde-C.             */
             if (k == 1 && namebuf[0] == 'L'
@@ -749,7 +965,12 @@ case l_idstart:
 #endif
             else
             {   int32 type;
-                curlex.a1.sv = sym_lookup(namebuf, SYM_GLOBAL);
+                Symstr *sv;
+                if (!kwtab_built) lex_buildkwtab();
+                sv = kwtab[kwhash_(hash)];
+                if (sv == NULL || strcmp(symname_(sv), namebuf) != 0)
+                    sv = sym_lookup_hashed(namebuf, hash);
+                curlex.a1.sv = sv;
                 type = symtype_(curlex.a1.sv);
 /* To prepare for C++, give a warning ONCE per file in ANSI mode when a */
 /* C++ keyword is used as a C identifier.                               */
@@ -795,6 +1016,21 @@ case l_idstart:
                 if (inside_valof_block && curlex.sym == s_identifier &&
                     curlex.a1.sv == resultisword) curlex.sym = s_resultis;
 #endif
+                if (curlex.sym == s_identifier && curlex.a1.sv == embedword &&
+                    !pp_inhashif)
+                {   /* "___embed <n>" from #embed, see pp.c             */
+                    int32 len = 0;
+                    unsigned8 const *b = NULL;
+/* curlex.fl is the pp's position: note it for the nested calls, and    */
+/* return directly as they leave it and endofsym_fl as they should be.  */
+                    endofsym_fl = curlex.fl;
+                    if (next_basic_sym() == s_integer)
+                        b = pp_embedded(curlex.a1.i, &len);
+                    if (len == 0) return next_basic_sym();
+                    lex_embed.p = b, lex_embed.n = len;
+                    lex_embed.comma = NO;
+                    return lex_embedsym();
+                }
             }
             break;
         }
@@ -1001,7 +1237,7 @@ AEop nextsym(void)
         nextlex.sym = s_nothing;
     }
     else
-    {   if (LanguageIsCPlusPlus && !pp_inhashif && nextsym_lookaside != NULL)
+    {   if (nextsym_lookaside != NULL && !pp_inhashif)
             lex_getbodysym();
         else
             next_basic_sym();
@@ -1272,16 +1508,18 @@ void lex_init()         /* C version  */
     if (HasFeature(Feature_PCC) || HasFeature(Feature_LimitedPCC))
         setuplexclass1("$", l_idstart);
 
+    nkwnames = 0;
+    kwtab_built = NO;
     {   unsigned int u;
         for (u = 0; u < sizeof(ns)/sizeof(ns[0]); ++u)
         {   const char *name = ns[u].name; int32 sym = ns[u].sym;
-            sym_insert(name, sym);
+            lex_keyword(name, sym);
             sym_name_table[sym] = name;
         }
         if (!(HasFeature(Feature_PCC) && HasFeature(Feature_Fussy)))
         {   for (u = 0; u < sizeof(ns2)/sizeof(ns2[0]); ++u)
             {   const char *name = ns2[u].name; int32 sym = ns2[u].sym;
-                sym_insert(name, sym);
+                lex_keyword(name, sym);
                 sym_name_table[sym] = name;
             }
             if (LanguageIsCPlusPlus || !SuppressDB_Has(Suppress_Future))
@@ -1289,7 +1527,7 @@ void lex_init()         /* C version  */
                 {   const char *name = ns3[u].name; int32 sym = ns3[u].sym;
                     if (LanguageIsCPlusPlus)
                         sym &= ~CPP_word;
-                    sym_insert(name, sym);
+                    lex_keyword(name, sym);
                     sym_name_table[sym & ~(CPP_word|CPP_word2|CPP_word3)] = name;
                 }
             }
@@ -1315,6 +1553,7 @@ void lex_init()         /* C version  */
 /* 'resultis' is a funny (experimental) syntax extension */
     resultisword = sym_insert_id("resultis");
 #endif
+    lex_embed.p = NULL;
     curchar = NOTACHAR; /* Kill lookahead  */
     curlex.sym = s_nothing;
     errs_on_this_sym = 0;
@@ -1345,11 +1584,44 @@ void lex_beware_reinit()
     }
 }
 
+#ifndef CPLUSPLUS
+/* C reads back only the bodies saved for --lazy-bodies, one at a time  */
+/* and at top level, so none of the C++ template renaming is needed.    */
+static SymInfo lexbuf_nextlex;
+
+void lex_openbody(int h, bool dup, bool record, Symstr *old_sv, Symstr *new_sv)
+{   IGNORE(dup); IGNORE(record); IGNORE(old_sv); IGNORE(new_sv);
+    if (debugging(DEBUG_LEX))
+        cc_msg("lex_openbody: [%d]\n", h);
+    lex_beware_reinit();                        /* globalise curlex     */
+    lexbuf_vec[h].prev = nextsym_lookaside;
+    lexbuf_vec[h].prevsym = curlex;
+    lexbuf_nextlex = nextlex; nextlex.sym = s_nothing;
+    nextsym_lookaside = &lexbuf_vec[h];
+    nextsym();                                  /* the '{'              */
+}
+
+void lex_closebody(void)
+{   if (debugging(DEBUG_LEX))
+        cc_msg("lex_closebody: [%d]\n", (int)(nextsym_lookaside - lexbuf_vec));
+    nextsym_lookaside->pos = -1;
+    nextsym_lookaside->count = 0;
+    curlex = nextsym_lookaside->prevsym;
+    nextsym_lookaside = nextsym_lookaside->prev;
+    nextlex = lexbuf_nextlex;
+}
+
+static void lex_getbodysym(void)
+{   curlex = nextsym_lookaside->buf[nextsym_lookaside->pos];
+    if (curlex.sym != s_eof) nextsym_lookaside->pos++;
+}
+#endif
+
 void lex_reinit()
 {
     lex_strend = lex_strptr = (char *)DUFF_ADDR;   /* better to use ""? */
     nextlex.sym = s_nothing;
-#ifdef CALLABLE_COMPILER
+#if defined(CALLABLE_COMPILER) || defined(TARGET_IS_INTERPRETER)
     curchar = NOTACHAR;
 #endif
 }
@@ -42,23 +42,29 @@ extern int errs_on_this_sym;
 
 extern AEop nextsym_for_hashif(void);
 
+extern int32 lex_embedtake(int32 max, unsigned8 const **bytes);
+/* If curlex is a byte of an #embed file (other than its last), take up */
+/* to max bytes starting with it, leaving curlex as the ',' after them. */
+/* Returns the number taken and sets *bytes to point at them.           */
+
 extern void lex_init(void);
 
 extern void lex_beware_reinit(void);
 
 extern void lex_reinit(void);
 
-#ifdef CPLUSPLUS
-
-/* for C++ or ANSI C; harmless here */
-extern int lex_bodybegin(void);         /* start save template def      */
-extern int lex_bodyend(void);           /* end   save template def      */
+/* for C++ or ANSI C (deferred static fn bodies) */
 extern int lex_savebody(void);          /* save member fn def           */
-extern int lex_saveexpr(void);
 extern void lex_openbody(int h, bool dup, bool record,
                          Symstr *old_sv, Symstr *new_sv);
                                         /* re-read saved text   */
 extern void lex_closebody(void);                /* end read + lose text */
+
+#ifdef CPLUSPLUS
+
+extern int lex_bodybegin(void);         /* start save template def      */
+extern int lex_bodyend(void);           /* end   save template def      */
+extern int lex_saveexpr(void);
 /* for C++ ONLY; not used in ANSI C */
 extern AEop lex_buffersym(void);
 extern void lex_endbuffering(void);
@@ -67,10 +73,7 @@ extern Symstr *lex_replaceable_template_sym(Symstr *s);
 
 #define lex_bodybegin()         0
 #define lex_bodyend()           0
-#define lex_savebody()          0
 #define lex_saveexpr()          0
-#define lex_openbody(h,dup,rec,o,n) ((void)0)
-#define lex_closebody()         ((void)0)
 
 
 #endif
@@ -95,6 +95,8 @@
 
 #ifdef CALLABLE_COMPILER
 #include "clbcomp.h"
+#elif defined(TARGET_IS_INTERPRETER)
+extern char *expr_string;       /* interp.c: the expression being read */
 #endif
 
 #define NOT_A_CHARACTER  (512)                 /* cannot be saved in a char */
@@ -313,6 +315,14 @@ static bool minus_e;
 
 static FILE *pp_cis;
 static FileLine *pp_fl;
+
+typedef struct PP_EMBED {
+  struct PP_EMBED *embedcdr;
+  unsigned8 *bytes;
+  int32 len;
+} PP_EMBED;
+static PP_EMBED *pp_embeds;     /* #embed files, latest first */
+static int32 pp_nembeds;
 int32 pp_pragmavec['z'-'a'+1];
 
 static char pp_datetime[26];
@@ -730,7 +740,7 @@ static int pp_fillbuf(void)
     }
     else
 #endif
-#ifdef CALLABLE_COMPILER
+#if defined(CALLABLE_COMPILER) || defined(TARGET_IS_INTERPRETER)
     if (expr_string != NULL) {
         strncpy(s, expr_string, sizeof(pp_linebuf));
         n = strlen(s);
@@ -2471,6 +2481,88 @@ static void pp_include(int pp_ch)
     pp_push_include(fname, lquote, saved_fl);
 }
 
+/*
+ * #embed "file" (or <file>) reads the named file, found as for #include,
+ * into store.  With -E it becomes a comma-separated list of its byte
+ * values; otherwise the token "___embed <n>" is passed on and lex.c
+ * expands it into the same list (see pp_embedded()), which lets static
+ * char arrays take the bytes wholesale instead of one token at a time.
+ */
+static void pp_embedfile(char const *fname, int lquote, int rquote)
+{ pp_uncompression_record *ur = NULL;
+  char const *hostname;
+  FILE *fp;
+  PP_EMBED *e;
+  int32 n, size = 4096;
+  unsigned8 *b;
+
+  if (fname[0] == 0 ||
+      (fp = pp_inclopen(fname, lquote=='<', &ur, &hostname, *pp_fl)) == NULL)
+  { cc_err(pp_err_embed_file, lquote, fname, rquote);
+    return;
+  }
+  if (ur != NULL)       /* an in-store header: not a byte stream */
+  { pp_inclclose(*pp_fl);
+    cc_err(pp_err_embed_file, lquote, fname, rquote);
+    return;
+  }
+  b = (unsigned8 *)pp_alloc(size);
+  for (n = 0; ; )
+  { n += (int32)fread(b + n, 1, (size_t)(size - n), fp);
+    if (n < size) break;
+    { unsigned8 *d = (unsigned8 *)pp_alloc(2*size);
+      memcpy(d, b, (size_t)n);
+      b = d, size *= 2;
+    }
+  }
+  trackfile_close(fp);
+  pp_inclclose(*pp_fl);
+  if (minus_e)
+  { char v[8];
+    int32 i;
+    for (i = 0; i < n; i++)
+    { sprintf(v, i == 0 ? "%d" : ",%d", (int)b[i]);
+      pp_wrbuf(v, (int32)strlen(v));
+    }
+    return;
+  }
+  e = (PP_EMBED *)pp_alloc(sizeof(PP_EMBED));
+  e->embedcdr = pp_embeds, e->bytes = b, e->len = n;
+  pp_embeds = e;
+  { char v[24];
+    sprintf(v, "___embed %ld", (long)pp_nembeds++);
+    pp_wrbuf(v, (int32)strlen(v));
+  }
+}
+
+static void pp_embed(int pp_ch)
+{ int lquote, rquote;
+  char *fname;
+
+  if (!pp_skipping) pp_ch = pp_directive_expand(pp_ch);
+  switch (lquote = pp_ch)
+  { case '"': rquote = '"'; break;
+    case '<': rquote = '>'; break;
+    default:  if (!pp_skipping) cc_err(pp_err_embed_quote);
+              pp_skip_linetokens(pp_ch);
+              return;
+  }
+  pp_stuffstring(rquote,1,pp_skipping);
+  fname = pp_closeid();    /* ensure done always */
+  if (!pp_skipping) pp_embedfile(fname, lquote, rquote);
+}
+
+unsigned8 const *pp_embedded(int32 n, int32 *len)
+{ PP_EMBED *e = pp_embeds;
+  int32 i;
+  for (i = pp_nembeds - 1; e != NULL; e = e->embedcdr, i--)
+    if (i == n)
+    { *len = e->len;
+      return e->bytes;
+    }
+  return NULL;
+}
+
 /* Pragmas: syntax allowed (we can argue more later) is:
  * "#pragma -<letter><optional digit> Argument_List -<letter><optional digit>".
  * The effect of "#pragma -<letter>" is to set pp_pragmavec[letter-a] to -1
@@ -2769,6 +2861,7 @@ static void pp_directive(void)
 /* pp_inclopen().  But then it would be wrong if file didn't open.      */
     return;
   }
+  else if (StrEq(v, "embed"))   pp_embed(pp_ch);
   else if (StrEq(v, "define"))  pp_define(pp_ch, 0);
 #ifdef MACH_EXTNS
   else if (StrEq(v, "defineval"))  pp_define(pp_ch, 1);
@@ -3024,6 +3117,20 @@ int pp_nextchar(void)
     return ch;
 }
 
+char const *pp_nextrun(char const **limit)
+{   *limit = pp_abufptr;
+    return pp_abufoptr;
+}
+
+void pp_takerun(char const *p)
+{
+#ifndef NO_LISTING_OUTPUT
+    if (listingstream)
+        while (pp_abufoptr < p) pp_listchar(*pp_abufoptr++);
+#endif /* NO_LISTING_OUTPUT */
+    pp_abufoptr = (char *)p;
+}
+
 void pp_predefine(char *s)
 {
     (void)pp_predefine2(s, 1);
@@ -3244,6 +3351,7 @@ void pp_init(FileLine *fl)
   pp_stick_at_eof = 1;
 #endif
   seen_before = NULL;
+  pp_embeds = NULL; pp_nembeds = 0;
   {   int ch;
       for (ch = 0; ch <= UCHAR_MAX; ch++)
       {   int i = 0;
@@ -57,6 +57,22 @@ extern int pp_nextchar(void);
  * Return PP_EOF at end of file.
  */
 
+extern char const *pp_nextrun(char const **limit);
+extern void pp_takerun(char const *p);
+/*
+ * The characters pp_nextchar() would return next which pp has already
+ * produced are those from pp_nextrun() up to *limit, so that lex.c may
+ * scan a run of them at once.  Those up to p are then consumed with
+ * pp_takerun(p).  Note a run may contain PP_ESC and PP_NOEXPAND, which
+ * pp_nextchar() interprets: the scan must stop at them.
+ */
+
+extern unsigned8 const *pp_embedded(int32 n, int32 *len);
+/*
+ * Return the bytes (and their number) of the n'th file read by #embed,
+ * which pp passes on as the token sequence "___embed n".
+ */
+
 extern void pp_predefine(char *s);
 /*
  * Define the pre-processor symbol 's' to be 1.
@@ -69,6 +69,7 @@
 #define call_dependency_type(a,b) 0
 #define call_dependency_val(a,b) 0
 #define is_comparable_specialization(a,b) 0
+#define xsem_init() ((void)0)
 #endif /* _SEM_H */
 
 #define exprdotmemfn_(p) arg2_(p)
@@ -467,6 +468,8 @@ static int32 alignofclass(TagBinder *b)
 {   int32 n = alignof_struct;
     if (tagbindbits_(b) & TB_UNALIGNED)
         return 1;
+    if (tagbindbits_(b) & TB_ALIGNCACHED)
+        return b->cachedalign;
 
     /* Short circuit the code if it can never update 'n':         */
     if (alignof_max > alignof_struct)
@@ -478,6 +481,10 @@ static int32 alignofclass(TagBinder *b)
             if (is_datamember_(l))
                 n = max(n, alignoftype(memtype_(l)));
     }
+    if (tagbindbits_(b) & TB_DEFD) {    /* as sizeofclass() */
+        b->cachedalign = n;
+        tagbindbits_(b) |= TB_ALIGNCACHED;
+    }
     return n;
 }
 
@@ -880,6 +887,9 @@ static int equivtype_4(TypeExpr *t1, TypeExpr *t2,
     for (;; (t1 = typearg_(t1), t2 = typearg_(t2)))
     {   m1 |= typedef_qualifiers(t1), m2 |= typedef_qualifiers(t2);
         t1 = princtype(t1),           t2 = princtype(t2);
+/* Global types are shared where possible (see globalize_typeexpr()),   */
+/* so the rest of the walk can often be skipped.                        */
+        if (t1 == t2 && m1 == m2) return sofar;
         if (h0_(t1) != h0_(t2)) return 0;
 
         switch (h0_(t1))
@@ -4892,6 +4902,7 @@ Expr *mkcond(Expr *a, Expr *b, Expr *c)
 void sem_init(void)
 {   static Expr errorexpr = { s_error };
     errornode = &errorexpr;
+    xsem_init();
 }
 
 /* End of sem.c */
@@ -191,6 +191,7 @@ extern int env_size(Binder *b);
 extern bool is_an_instance(BindList *ins, Binder *b);
 extern ScopeSaver dup_env_actuals(ScopeSaver tformals, ExprList *a);
 extern void add_instance(Binder *b, BindList **bl, bool su);
+extern void add_tmptfn_instance(Binder *inst, Binder *ftemp);
 extern bool is_dependent_type(TypeExpr *t);
 
 /* nasty: routines for overload.c */
@@ -201,6 +202,8 @@ extern Symstr *ovld_tmptfn_instance_name(Symstr *sv, ScopeSaver f);
 extern Expr *ovld_picknullary(Binder *bgeneric);
 extern List *mk_candidates(BindList *, int, int, List *);
 extern List *mk_operator_candidates(AEop, TypeExpr *, TypeExpr *, List *);
+extern Binder *ovld_memo_find(AEop op, Binder *b1, Binder *b2, List *,
+                              ExprList *l, ExprList *ll);
 extern Binder *ovld_reduce(Binder *b, List *, ExprList *l, ExprList *ll);
 extern Binder *ovld_resolve(Binder *b, BindList *alternatives,
                             ExprList *l, ExprList *ll, bool silent);
@@ -208,6 +211,10 @@ extern Symstr *specialized_name_of(TagBinder *tmptb);
 extern bool is_operator_name(Symstr *opname);
 extern Symstr *ovld_template_app(Symstr *sv, ScopeSaver f, ExprList *a);
 extern Symstr *ovld_function_template_name(Symstr *sv, TypeExpr *t);
+extern void ovld_init(void);
+extern void ovld_tidy(void);
+extern int32 ovldmemo_generation;
+#define ovldmemo_changed() (ovldmemo_generation++)
 extern Symstr *operator_name(AEop op);
 extern Symstr *conversion_name(TypeExpr *t);
 extern String *exception_name(TypeExpr *t);
@@ -232,6 +239,7 @@ extern Expr *cpp_mkbinaryorop(AEop, Expr*, Expr*);
 #define exists_conversion_sequence_from(tfm,tto) 0
 #define mkfnap_cpp(e, l, curried, let, firstarg) (e)
 #define add_instance(a,b,c) ((void)0)
+#define add_tmptfn_instance(a,b) ((void)0)
 #define is_dependent_type(a) 0
 #define merge_default_template_args(a,b,c) 0
 
@@ -249,6 +257,7 @@ extern Expr *cpp_mkbinaryorop(AEop, Expr*, Expr*);
 #define ovld_add_memclass(sv, scope, staticfn) 0
 #define ovld_instance_name(sv, t) 0
 #define ovld_resolve(b, alternatives, l, ll, silent) 0
+#define ovld_tidy() ((void)0)
 #define operator_name(op) 0
 #define conversion_name(t) 0
 #define exception_name(t) 0
@@ -877,6 +877,36 @@ static AEop NegateRelop(AEop op) {
   }
 }
 
+/* Fold memo.  optimise1b() and DistributedOp() rebuild nodes over     */
+/* operands which have already been simplified and then simplify the   */
+/* new node again, so in macro-generated (e.g. register bitfield)      */
+/* expressions the same subtrees were walked over and over.  Trees     */
+/* which optimise1() has produced (with valneeded) are remembered here */
+/* with their purity, and are not walked again.  optimise0() bumps the */
+/* generation so that nothing is trusted across calls, since syntax    */
+/* store is reused between them.                                       */
+#define FOLDMEMOSIZE 1024
+#define foldmemohash_(e) ((int)(((IPtr)(e)) >> 3) & (FOLDMEMOSIZE-1))
+
+typedef struct FoldMemoEntry {
+    Expr *e;
+    int32 generation;
+    bool pure;
+} FoldMemoEntry;
+
+static FoldMemoEntry foldmemo[FOLDMEMOSIZE];
+static int32 foldmemo_generation;
+
+static FoldMemoEntry *foldmemo_find(Expr *e)
+{   FoldMemoEntry *m = &foldmemo[foldmemohash_(e)];
+    return (m->e == e && m->generation == foldmemo_generation) ? m : NULL;
+}
+
+static void foldmemo_enter(Expr *e, bool pure)
+{   FoldMemoEntry *m = &foldmemo[foldmemohash_(e)];
+    m->e = e, m->generation = foldmemo_generation, m->pure = pure;
+}
+
 static Expr *MkBoolNot(Expr *e) {
   if (isrelational_(h0_(e)))
     return mk_expr2(NegateRelop(h0_(e)), type_(e), arg1_(e), arg2_(e));
@@ -889,6 +919,10 @@ static Expr *optimise1(Expr *e, bool valneeded, bool *pure)
     Expr *e1;
     bool purea1, purea2;
     *pure = YES;
+    if (valneeded)
+    {   FoldMemoEntry *m = foldmemo_find(e);
+        if (m != NULL) { *pure = m->pure; return e; }
+    }
     if (debugging(DEBUG_AETREE) && syserr_behaviour > 0) {
 #ifndef NO_RETURN_EXPRESSIONS
       if (op != s_return)
@@ -1546,6 +1580,7 @@ static Expr *optimise1(Expr *e, bool valneeded, bool *pure)
 #endif
         pr_exproftype("optimise1= ", e);
     }
+    if (valneeded && op != s_return) foldmemo_enter(e, *pure);
     return e;
 }
 
@@ -1793,6 +1828,7 @@ Expr *optimise0(Expr *e)
     if (h0_(e) == s_error) return NULL;
     checkvaruse(NULL, e);
     new_binders = NULL;
+    foldmemo_generation++;
     if (setjmp(optimise0_jb) == 0)
         res = optimise1(e, YES, &dummy);
     else
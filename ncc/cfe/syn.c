@@ -67,6 +67,7 @@
 #include "aeops.h"
 #include "codebuf.h"
 #include "compiler.h"  /* UpdateProgress */
+#include "dump.h"      /* for dump_state */
 
 /* It seems better to forbid "int a{2};" etc in C++.                  */
 #define archaic_init(s) ((s) == s_lbrace)
@@ -190,6 +191,84 @@ typedef struct GenFnList {
 } GenFnList;
 static GenFnList *syn_generatedfns;
 
+/* C with --lazy-bodies: the bodies of static functions are saved as    */
+/* token lists (with lex_savebody(), as for C++ member functions) and   */
+/* are only parsed once the function is referenced, with the file scope */
+/* rewound to where it was defined (bind_rewind()).  Those which never  */
+/* are get dropped unparsed at the end of the unit.                     */
+/* C++ is not covered, not even in-class member bodies: bind_rewind()   */
+/* does not undo later additions to overload sets, and rewinding to a   */
+/* member's class would also hide template instances made since, which  */
+/* its body would then instantiate again.  Those bodies are still read  */
+/* (via syn_pendingfns) at the top level declaration after the class.   */
+typedef struct LazyStash LazyStash;
+
+typedef struct LazyFn {
+    struct LazyFn *cdr;
+    struct LazyFn *hashcdr;
+    struct LazyFn *wantcdr;
+    Binder *b;
+    DeclRhsList *d;             /* global copy of the definition        */
+    ScopeSaver formaltags;
+    int toklist_handle;
+    int32 topmark;              /* bind_topmark() at its definition     */
+    int32 pragmas['z'-'a'+1];   /* pp_pragmavec at the end of its body  */
+    bool implicit_return_ok;
+    int state;
+    List *callees;              /* lazy fns its body references         */
+    struct LazyFn *refby;       /* last body adding to callees          */
+    LazyStash *parsed;
+} LazyFn;
+
+#define LF_Pending 0
+#define LF_Wanted  1            /* referenced: parse after this decl    */
+#define LF_Parsed  2
+#define LF_Done    3
+
+#define LAZY_INDEXSIZE 1024
+#define lazy_hash_(b) (((IPtr)(b) >> 2) % LAZY_INDEXSIZE)
+
+static LazyFn *lazy_fns, *lazy_wanted;
+static LazyFn **lazy_index;     /* by Binder                            */
+static LazyFn *lazy_current;    /* body being parsed                    */
+static int32 lazy_npending;
+
+/* Wanted bodies are parsed as soon as the top level declaration which  */
+/* references them has been.  All are then returned by rd_topdecl,      */
+/* callees first and the declaration last, their store being marked     */
+/* (much as for syn_generatedfns) until the last has been compiled.     */
+/* Each body is compiled, as it was read, with the file scope rewound.  */
+struct LazyStash {
+    LazyStash *cdr;
+    TopDecl *d;
+    int32 topmark;              /* or -1 for the declaration            */
+    CurrentFnDetails curfn;
+    int32 pragmas['z'-'a'+1];
+    bool implicit_return_ok;
+};
+static LazyStash *lazy_ready, **lazy_readyend, *lazy_stashfree;
+static Mark *lazy_mark;
+static int32 lazy_rewound = -1; /* topmark of the body being compiled  */
+
+static void lazy_reference(Binder *b)
+{   LazyFn *l;
+    for (l = lazy_index[lazy_hash_(b)]; l != NULL; l = l->hashcdr)
+        if (l->b == b)
+        {   if (l->state == LF_Pending)
+            {   l->state = LF_Wanted;
+                l->wantcdr = lazy_wanted, lazy_wanted = l;
+                lazy_npending--;
+            }
+            if (lazy_current != NULL && l != lazy_current &&
+                l->refby != lazy_current)
+            {   l->refby = lazy_current;
+                lazy_current->callees =
+                    (List *)global_cons2(SU_Other, lazy_current->callees, l);
+            }
+            return;
+        }
+}
+
 enum LinkSort { LINK_C, LINK_CPP };
 typedef struct Linkage {
     struct Linkage *linkcdr;
@@ -812,6 +891,10 @@ static Expr *rd_idexpr(int labelhack)
     {   /* use current 'variable' binding */
         if (bindstg_(b) & b_pseudonym) b = realbinder_(b);
         a = (Expr *)b;
+        if ((lazy_npending != 0 && !(binduses_(b) & u_referenced)) ||
+            lazy_current != NULL)
+            lazy_reference(b);
+        if (vg_ndeferred != 0) vg_reference(b);
         binduses_(b) |= u_referenced;
         if (chk_for_auto && !is_local_binder(b) && !is_template_arg_binder((Expr *)b) &&
             !is_globalbinder_(b) && !(bindstg_(b) & bitofstg_(s_static)) &&
@@ -1527,6 +1610,17 @@ bool syn_canrdinit(void)
     return 1;
 }
 
+int32 syn_rdembed(int32 max, unsigned8 const **bytes)
+/* Reads up to max elements of a char array initialiser at once if they  */
+/* are bytes from #embed, returning how many (see lex_embedtake()).      */
+{   int32 n;
+    if (syn_initpeek || syn_initdepth <= 0) return 0;
+    n = lex_embedtake(max, bytes);
+    if (n > 0 && curlex.sym != s_rbrace)
+        checkfor_2ket(s_comma, s_rbrace);
+    return n;
+}
+
 /* command reading routines... */
 #if 0
 static SynBindList *mkSynBindList_from_Decl(DeclRhsList *d, SynBindList *r)
@@ -2758,6 +2852,13 @@ than annoying.  Probably we don't understand the reason for it.
 #endif
     {   DeclSpec ds;
         TypeSpec *t = primtype2_(typesseen, b);
+/* In C, declarations with global (or no) binders get the shared copy   */
+/* of their type that globalize_typeexpr() keeps, so that equivtype()   */
+/* of two such types is mostly a pointer comparison.  (C++ fixes some   */
+/* types up in place.)                                                  */
+        if (!LanguageIsCPlusPlus &&
+            (b == 0 || (attributes_(b) & A_GLOBALSTORE)))
+            t = globalize_typeexpr(t);
 /* AM: the next line is really the wrong place to do this code (it      */
 /* should be in the loop above) since declaration specifiers may follow */
 /* the struct-specification.                                            */
@@ -4418,6 +4519,163 @@ static ScopeSaver globalize_formaltags(ScopeSaver l)
     return (ScopeSaver)h;
 }
 
+/* Copies a function definition's declarator, with its formals, to      */
+/* global store (cf. reinvent_fn_DeclRhsList()).                        */
+static DeclRhsList *globalize_fndef(DeclRhsList *d)
+{   TypeExpr *t = d->decltype, *gt;
+    DeclRhsList *p, *gd, *formals = NULL, **fp = &formals;
+    for (p = typefnargs1_(t); p != NULL; p = p->declcdr)
+    {   DeclRhsList *q = (DeclRhsList *)GlobAlloc(SU_Other, sizeof(DeclRhsList));
+        *q = *p;
+        q->declcdr = NULL;
+        q->decltype = globalize_typeexpr(p->decltype);
+        q->declbind = NULL;
+        *fp = q, fp = &q->declcdr;
+    }
+    gt = g_mkTypeExprfn(t_fnap, globalize_typeexpr(typearg_(t)),
+                        typeptrmap_(t), (FormTypeList *)formals,
+                        &typefnaux_(t));
+    typedbginfo_(gt) = typedbginfo_(t);
+    gd = (DeclRhsList *)GlobAlloc(SU_Other, sizeof(DeclRhsList));
+    *gd = *d;
+    gd->decltype = gt;
+    gd->declbind = NULL;
+    return gd;
+}
+
+/* Saves the body of static function d (curlex is its '{') in place of  */
+/* parsing it, and declares the function as if by a prototype.          */
+static TopDecl *lazy_savefn(DeclRhsList *d)
+{   LazyFn *l = (LazyFn *)GlobAlloc(SU_Other, sizeof(LazyFn));
+    DeclRhsList *dd;
+    l->d = globalize_fndef(d);
+    dd = mkDeclRhsList(l->d->declname, l->d->decltype,
+                       l->d->declstg | b_undef);
+    dd->fileline = d->fileline;
+    l->b = instate_declaration(dd, TOPLEVEL);
+    l->topmark = bind_topmark();
+    l->formaltags = globalize_formaltags(syn_formaltags);
+    l->implicit_return_ok = implicit_return_ok;
+    l->toklist_handle = lex_savebody();
+    curlex.sym = s_nothing;
+    memcpy(l->pragmas, pp_pragmavec, sizeof(l->pragmas));
+    l->state = LF_Pending;
+    l->callees = NULL;
+    l->refby = NULL;
+    l->parsed = NULL;
+    if (lazy_index == NULL)
+    {   lazy_index = (LazyFn **)GlobAlloc(SU_Other,
+                                   LAZY_INDEXSIZE * sizeof(LazyFn *));
+        memset(lazy_index, 0, LAZY_INDEXSIZE * sizeof(LazyFn *));
+    }
+    l->hashcdr = lazy_index[lazy_hash_(l->b)];
+    lazy_index[lazy_hash_(l->b)] = l;
+    l->cdr = lazy_fns, lazy_fns = l;
+    lazy_npending++;
+    return (TopDecl *)syn_list2(s_decl, dd);
+}
+
+static LazyStash *lazy_keep(TopDecl *d, int32 topmark)
+{   LazyStash *s = lazy_stashfree;
+    if (s != NULL)
+        lazy_stashfree = s->cdr;
+    else
+        s = (LazyStash *)GlobAlloc(SU_Other, sizeof(LazyStash));
+    s->d = d;
+    s->topmark = topmark;
+    s->curfn = currentfunction;
+    memcpy(s->pragmas, pp_pragmavec, sizeof(s->pragmas));
+    s->implicit_return_ok = implicit_return_ok;
+    return s;
+}
+
+static void lazy_queue(LazyStash *s)
+{   s->cdr = NULL;
+    *lazy_readyend = s, lazy_readyend = &s->cdr;
+}
+
+static TopDecl *lazy_next(void)
+{   LazyStash *s = lazy_ready;
+    lazy_ready = s->cdr;
+    if (lazy_rewound >= 0) bind_rewind(lazy_rewound, NO);
+    lazy_rewound = s->topmark;
+    if (lazy_rewound >= 0) bind_rewind(lazy_rewound, YES);
+    if (lazy_ready == NULL)
+    {   alloc_unmark(lazy_mark);
+        if (lazy_npending == 0) bind_topunmark();
+    }
+    currentfunction = s->curfn;
+    memcpy(pp_pragmavec, s->pragmas, sizeof(s->pragmas));
+    implicit_return_ok = s->implicit_return_ok;
+    s->cdr = lazy_stashfree, lazy_stashfree = s;
+    return s->d;
+}
+
+static void lazy_order(LazyFn *l)
+{   List *p;
+    if (l->state != LF_Parsed) return;
+    l->state = LF_Done;                 /* (recursion)                  */
+    for (p = l->callees; p != NULL; p = cdr_(p))
+        lazy_order((LazyFn *)car_(p));
+    lazy_queue(l->parsed);
+}
+
+/* Parses the bodies wanted by top level declaration d, and any they    */
+/* want in turn, and returns the first of them (or d itself).           */
+static TopDecl *lazy_readwanted(TopDecl *d)
+{   LazyStash *top;
+    LazyFn *batch = NULL, **batchend = &batch, *l;
+    if (lazy_wanted == NULL) return d;
+    top = lazy_keep(d, -1);
+    while ((l = lazy_wanted) != NULL)
+    {   lazy_wanted = l->wantcdr;
+        memcpy(pp_pragmavec, l->pragmas, sizeof(l->pragmas));
+        implicit_return_ok = l->implicit_return_ok;
+        lazy_current = l;
+        bind_rewind(l->topmark, YES);
+        lex_openbody(l->toklist_handle, NO, NO, NULL, NULL);
+        l->parsed = lazy_keep(rd_fndef(l->d, TOPLEVEL, NULL,
+                                       l->formaltags, NULL), l->topmark);
+        lex_closebody();
+        bind_rewind(l->topmark, NO);
+        lazy_current = NULL;
+        l->state = LF_Parsed;
+        l->wantcdr = NULL;
+        *batchend = l, batchend = &l->wantcdr;
+    }
+    lazy_ready = NULL, lazy_readyend = &lazy_ready;
+    for (l = batch; l != NULL; l = l->wantcdr) lazy_order(l);
+    lazy_queue(top);
+    lazy_mark = alloc_mark();
+    return lazy_next();
+}
+
+/* At the end of the unit: a body still pending is dropped unread, but  */
+/* the file scope names it uses are counted as referenced, so that the  */
+/* 'declared but not used' warnings are as if it had been parsed.       */
+static void lazy_dropfns(void)
+{   LazyFn *l;
+    for (l = lazy_fns; l != NULL; l = l->cdr)
+        if (l->state == LF_Pending)
+        {   bind_rewind(l->topmark, YES);
+            lex_openbody(l->toklist_handle, NO, NO, NULL, NULL);
+            for (; curlex.sym != s_eof; nextsym())
+                if (curlex.sym == s_identifier)
+                {   Binder *b = bind_global_(curlex.a1.sv);
+                    if (b != NULL && b != l->b) binduses_(b) |= u_referenced;
+                }
+            lex_closebody();
+            bind_rewind(l->topmark, NO);
+            bindstg_(l->b) &= ~b_undef;
+            l->state = LF_Done;
+        }
+    bind_topunmark();
+    lazy_fns = NULL;
+    lazy_npending = 0;
+    if (lazy_index != NULL)
+        memset(lazy_index, 0, LAZY_INDEXSIZE * sizeof(LazyFn *));
+}
+
 /* rd_decl reads a possibly top-level decl, see also rd_decl2()       */
 static TopDecl *rd_decl(int declflag, SET_BITMAP accbits)
 /* AM: Structure decls are tantalisingly close to ordinary decls (but no
@@ -4704,6 +4962,19 @@ anonu:      /* what a horrible place to put a label!                    */
                 /* Just pretend all is sweetness and light 'til later:  */
                 return (TopDecl *) syn_list2(s_memfndef, d);
             }
+            if (!LanguageIsCPlusPlus && HasFeature(Feature_LazyBodies) &&
+                declflag == TOPLEVEL &&
+                (d->declstg & bitofstg_(s_static)) &&
+                curlex.sym == s_lbrace &&
+                !typefnaux_(d->decltype).oldstyle &&
+                !usrdbg(DBG_ANY) && !(dump_state & DS_Dump))
+            {   /* Only a function not referenced yet is deferred.      */
+                Binder *b = bind_global_(d->declname);
+                if (b == NULL ||
+                    (bindstg_(b) & (b_undef|b_fnconst|u_referenced)) ==
+                        (b_undef|b_fnconst))
+                    return lazy_savefn(d);
+            }
             return rd_fndef(d, declflag, topfnscope,
                             syn_formaltags, template_formals); /* d != 0 by fiat */
         }
@@ -4939,6 +5210,7 @@ static void rd_strdecl(TagBinder *b, ClassMember *bb)
     /* to work while reading members.  See cppfe.c.bind("p209").        */
     /* See also 'derived_from' below.                                   */
         tagbindmems_(b) = bb;
+        classmemo_changed();
     }
   { int scope_level = push_scope(b, Scope_Ord);
     TagBinder *old_access = set_access_context(b, 0);
@@ -5130,7 +5402,7 @@ static void rd_enumdecl(TagBinder *tb)
     }
     if (has_neg && needs_unsigned)
         cc_rerr(syn_rerr_neg_unsigned_enum, tb);
-    tagbindbits_(tb) = (tagbindbits_(tb) & ~TB_BEINGDEFD) | TB_DEFD;
+    bind_tagdefined(tb);
     tagbindenums_(tb) = p;
 
     {   SET_BITMAP container;
@@ -5186,6 +5458,10 @@ TopDecl *rd_topdecl(bool returneof)
     valof_block_result_type = (TypeExpr *) DUFF_ADDR;
     cur_restype = 0;             /* check for valof out of body      */
 #endif
+    if (lazy_ready != NULL)
+    {   d = lazy_next();
+        if (h0_(d) != s_eof) return d;
+    }
     if (LanguageIsCPlusPlus && syn_generatedfns)
     {   TopDecl *fd = syn_generatedfns->d;
         Mark* mark = syn_generatedfns->mark;
@@ -5306,7 +5582,17 @@ case s_rbrace:  syn_pop_linkage(); nextsym();
                 }
             }
         } else
+        {   if (lazy_fns != NULL)
+            {   LazyFn *l;
+                for (l = lazy_fns; l != NULL; l = l->cdr)
+                    if (l->state == LF_Pending &&
+                        (binduses_(l->b) & u_referenced))
+                        lazy_reference(l->b);
+                if (lazy_wanted != NULL) return lazy_readwanted(&eofdecl);
+                lazy_dropfns();
+            }
             dbg_final_src_codeaddr(codebase, codep);
+        }
         return &eofdecl;
     }
     if (curlex.sym == s_lbrace)  /* temp for ACN - rethink general case */
@@ -5322,7 +5608,7 @@ case s_rbrace:  syn_pop_linkage(); nextsym();
     d = rd_decl(TOPLEVEL, 0);
     (void)set_access_context(old_access_context, NULL);
     curlex.fl.p = dbg_notefileline(curlex.fl);
-    return d;
+    return lazy_readwanted(d);
 }
 
 void syn_init(void)
@@ -5341,8 +5627,15 @@ void syn_init(void)
         cur_template_formals = 0;
         cur_template_actuals = 0;
         eof_done = NO;
+        if (HasFeature(Feature_LazyBodies)) cc_warn(syn_warn_lazy_bodies_cpp);
     }
     curlex_member = NULL;
+    lazy_fns = lazy_wanted = NULL;
+    lazy_npending = 0;
+    lazy_index = NULL;
+    lazy_current = NULL;
+    lazy_ready = lazy_stashfree = NULL;
+    lazy_rewound = -1;
     xsyn_init();
 }
 
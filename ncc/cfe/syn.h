@@ -25,6 +25,7 @@ extern int32 syn_begin_agg(void);
 extern void syn_end_agg(int32 beganbrace);
 extern Expr *syn_rdinit(TypeExpr *t, Binder *whole, int32 flag);
 extern bool syn_canrdinit(void);
+extern int32 syn_rdembed(int32 max, unsigned8 const **bytes);
 
 extern Expr *rd_expr(int n);
 extern Expr *rd_ANSIstring(void);
@@ -59,6 +60,8 @@ extern ScopeSaver copy_env(ScopeSaver env, int n);
 extern void parameter_names_transfer(FormTypeList *from, FormTypeList *to);
 extern void add_expr_dtors(Expr *edtor);
 extern void add_to_saved_temps(SynBindList *tmps);
+extern void syn_read_tmptrepository(FILE *f, char const *owner);
+extern void syn_write_tmptrepository(FILE *in, FILE *out);
 #else
 #define add_pendingfn(a,b,c,d,e,f,g,h,i) ((void)0)
 #define copy_env(a,b) 0
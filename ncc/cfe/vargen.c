@@ -34,6 +34,7 @@
    linkage to syn.c.
 */
 
+#include <string.h>            /* for memset (memclr) */
 #ifndef _VARGEN_H
 #include "globals.h"
 #include "vargen.h"
@@ -77,6 +78,45 @@ static Binder *cur_initlhs;
 #define orig_(p)  arg1_(p)
 #define compl_(p) arg2_(p)
 
+/* With --lazy-statics a top-level static C object is generated as      */
+/* usual (so diagnostics and open array sizes are unchanged), but its   */
+/* data is then cut back out of its area and kept until something other */
+/* than the initialiser of another such object references it.  Only     */
+/* then is it placed, at the end of its area.  One never referenced is  */
+/* never written.  Addresses of deferred objects planted in data are    */
+/* noted in 'fixups' and adjusted when the object is placed.            */
+typedef struct DeferredStatic {
+    struct DeferredStatic *hashcdr;
+    Binder *b;
+    DataInit *head, *tail;      /* its data, cut from its area          */
+    DataXref *xrefs;            /* offsets relative to the object       */
+    int32 size, align;
+    List *refs;                 /* Binders its initialiser references   */
+    List *fixups;               /* DataInits holding offsets within it  */
+} DeferredStatic;
+
+#define VG_INDEXSIZE 256
+#define vg_hash_(b) (((IPtr)(b) >> 2) % VG_INDEXSIZE)
+
+int32 vg_ndeferred;                     /* deferred and not yet placed  */
+static DeferredStatic **vg_index;       /* by Binder                    */
+static DeferredStatic *vg_current;      /* being generated              */
+static List *vg_wanted;                 /* referenced while generating  */
+static int vg_depth;                    /* genstaticparts() nesting     */
+
+static DeferredStatic *vg_deferred(Binder *b)
+{   DeferredStatic *p;
+    if (vg_ndeferred == 0) return NULL;
+    for (p = vg_index[vg_hash_(b)]; p != NULL; p = p->hashcdr)
+        if (p->b == b) return p;
+    return NULL;
+}
+
+static void vg_fixup(DeferredStatic *p)
+{   /* the DataInit just planted holds an offset within p's object      */
+    p->fixups = (List *)global_cons2(SU_Other, p->fixups, get_datadesc_ht(NO));
+}
+
 /* It is now clear that vg_acton_globreg() should be part of syn.c      */
 /* and/or bind.c (see bind_err_conflicting_globalreg below).            */
 static void vg_acton_globreg(DeclRhsList *d, Binder *b)
@@ -354,20 +394,27 @@ static void genpointer(Expr *einit)
                  */
                 if (bindstg_(b) & b_fnconst) gendcF(bindsym_(b), offset, 0);
                 else {
-                    gendcA(bindsym_(datasegment), bindaddr_(b)+offset, 0);
+                    DeferredStatic *p = vg_deferred(b);
+                    gendcA(bindsym_(datasegment),
+                           (p == NULL ? bindaddr_(b) : 0)+offset, 0);
+                    if (p != NULL) vg_fixup(p);
                 }
             }
 #ifdef TARGET_HAS_BSS
             else if ((bindstg_(b) & bitofstg_(s_static)) &&
                      bindaddr_(b) != BINDADDR_UNSET)
+            {   DeferredStatic *p = vg_deferred(b);
 #ifdef CONST_DATA_IN_CODE
                 gendcA(
                     (bindstg_(b) & u_constdata) ? bindsym_(constdatasegment) :
                                                   bindsym_(bsssegment),
-                            bindaddr_(b)+offset, 0);
+                            (p == NULL ? bindaddr_(b) : 0)+offset, 0);
 #else
-                gendcA(bindsym_(bsssegment), bindaddr_(b)+offset, 0);
+                gendcA(bindsym_(bsssegment),
+                       (p == NULL ? bindaddr_(b) : 0)+offset, 0);
 #endif
+                if (p != NULL) vg_fixup(p);
+            }
 #endif
             else if (bindstg_(b) & (bitofstg_(s_extern) | u_loctype))
             {   int xr = (bindstg_(b) & bitofstg_(s_weak)) ? xr_weak : 0;
@@ -712,8 +759,11 @@ case t_subscript:
             }
 /* Maybe generalise this one day:                                       */
 #define vg_init_to_null(t) (TARGET_NULL_BITPATTERN == 0)
+            t2 = princtype(typearg_(t));
             for (i = 0; i < m; i++)
-            {   if (!syn_canrdinit())
+            {   unsigned8 const *bytes;
+                int32 n;
+                if (!syn_canrdinit())
                 {   if (typesubsize_(t) == 0 || h0_(typesubsize_(t)) == s_binder)
                     {   typesubsize_(t) = globalize_int(i);
                         break;  /* set size to number of elements read. */
@@ -723,6 +773,13 @@ case t_subscript:
                         break;  /* optimise multi-zero initialisation.  */
                     }
                 }
+/* Bytes from #embed go straight into the data area as a block.        */
+                if (isprimtype_(t2, s_char) &&
+                    (n = syn_rdembed(m-i, &bytes)) > 0)
+                {   gendcB(n, bytes);
+                    i += n-1;
+                    continue;
+                }
                 initsubstatic(typearg_(t), 0, aligned, 0);
             }
             syn_end_agg(note);
@@ -938,6 +995,129 @@ static DeclRhsList *defergenerating(DeclRhsList *const d, Expr *dyninit)
     return dd;
 }
 
+static bool vg_candefer(DeclRhsList *const d, bool topflag)
+{   return !LanguageIsCPlusPlus && HasFeature(Feature_LazyStatics) &&
+           topflag && (d->declstg & bitofstg_(s_static)) &&
+           d->tentative == NULL &&
+           !(binduses_(d->declbind) & u_referenced) &&
+           !usrdbg(DBG_ANY) && !(dump_state & DS_Dump) &&
+           !HasFeature(Feature_WRStrLits) &&
+           !(config & CONFIG_REENTRANT_CODE);
+}
+
+static void vg_deferstatic(Binder *b, Expr *einit)
+{   DeferredStatic *p = (DeferredStatic *)GlobAlloc(SU_Other, sizeof(*p));
+    DataInit *tail;
+    DataXref *xrefs, *x;
+    int32 size;
+    if (vg_index == NULL)
+    {   vg_index = (DeferredStatic **)GlobAlloc(SU_Other,
+                                    VG_INDEXSIZE * sizeof(DeferredStatic *));
+        memclr(vg_index, VG_INDEXSIZE * sizeof(DeferredStatic *));
+    }
+    p->b = b;
+    p->align = alignoftype(bindtype_(b));
+    p->refs = p->fixups = NULL;
+    p->hashcdr = vg_index[vg_hash_(b)], vg_index[vg_hash_(b)] = p;
+    vg_ndeferred++;
+    padstatic(p->align);
+    labeldata(NULL);
+    tail = get_datadesc_ht(NO);
+    size = get_datadesc_size();
+    xrefs = get_datadesc_xrefs();
+    vg_current = p;
+    initstaticvar_1(b, NO, NULL, einit);        /* no label or symbol   */
+    vg_current = NULL;
+    labeldata(NULL);
+    /* Now cut its data and xrefs back out of the area...               */
+    p->head = tail == NULL ? get_datadesc_ht(YES) : tail->datacdr;
+    p->tail = p->head == NULL ? NULL : get_datadesc_ht(NO);
+    if (tail == NULL) set_datadesc_ht(YES, NULL); else tail->datacdr = NULL;
+    set_datadesc_ht(NO, tail);
+    p->size = get_datadesc_size() - size;
+    set_datadesc_size(size);
+    p->xrefs = NULL;
+    if ((x = get_datadesc_xrefs()) != xrefs)
+    {   p->xrefs = x;
+        for (;; x = x->dataxrcdr)
+        {   x->dataxroff -= size;
+            if (x->dataxrcdr == xrefs) break;
+        }
+        x->dataxrcdr = NULL;
+        set_datadesc_xrefs(xrefs);
+    }
+    if (debugging(DEBUG_DATA))
+        cc_msg("        deferred (%ld bytes)\n", (long)p->size);
+}
+
+static void vg_place(DeferredStatic *p)
+{   Binder *b = p->b;
+    DeferredStatic **pp = &vg_index[vg_hash_(b)];
+    DataAreaSort da;
+    DataXref *x;
+    List *l;
+    int32 base;
+    while (*pp != p) pp = &(*pp)->hashcdr;
+    *pp = p->hashcdr;
+    vg_ndeferred--;
+#ifdef CONST_DATA_IN_CODE
+    da = SetDataArea(bindstg_(b) & u_constdata ? DS_Const : DS_ReadWrite);
+#else
+    da = SetDataArea(DS_ReadWrite);
+#endif
+    padstatic(p->align);
+    base = bindaddr_(b) = get_datadesc_size();
+    if (debugging(DEBUG_DATA))
+        cc_msg("%.6lx: %s placed\n", (long)base, symname_(bindsym_(b)));
+    labeldata(bindsym_(b));
+    (void)obj_symref(bindsym_(b), get_datadesc_xrarea()+xr_defloc, base);
+    if (p->head != NULL)
+    {   if (get_datadesc_ht(NO) == NULL) set_datadesc_ht(YES, p->head);
+        else get_datadesc_ht(NO)->datacdr = p->head;
+        set_datadesc_ht(NO, p->tail);
+    }
+    set_datadesc_size(base + p->size);
+    if ((x = p->xrefs) != NULL)
+    {   for (;; x = x->dataxrcdr)
+        {   x->dataxroff += base;
+            if (x->dataxrcdr == NULL) break;
+        }
+        x->dataxrcdr = get_datadesc_xrefs();
+        set_datadesc_xrefs(p->xrefs);
+    }
+    labeldata(NULL);
+    for (l = p->fixups; l != NULL; l = cdr_(l))
+        ((DataInit *)car_(l))->val += base;
+    SetDataArea(da);
+    for (l = p->refs; l != NULL; l = cdr_(l))
+    {   DeferredStatic *q = vg_deferred((Binder *)car_(l));
+        if (q != NULL) vg_place(q);
+    }
+}
+
+/* vg_reference() is called by rd_primary() for each use of a variable  */
+/* while some static is deferred.  Uses in the initialiser of a deferred */
+/* object wait for that to be placed; other uses within an initialiser  */
+/* wait until its generation is complete.                               */
+void vg_reference(Binder *b)
+{   DeferredStatic *p = vg_deferred(b);
+    if (p == NULL || p == vg_current) return;
+    if (vg_current != NULL)
+        vg_current->refs = (List *)global_cons2(SU_Other, vg_current->refs, b);
+    else if (vg_depth != 0)
+        vg_wanted = (List *)global_cons2(SU_Other, vg_wanted, b);
+    else
+        vg_place(p);
+}
+
+static void vg_resetdeferred(void)
+{   vg_ndeferred = 0;
+    vg_index = NULL;
+    vg_current = NULL;
+    vg_wanted = NULL;
+    vg_depth = 0;
+}
+
 /* The following routine removes generated statics, which MUST have been
    instated with instate_declaration().  Dynamic initialistions are turned
    into assignments for rd_block(), by return'ing.  0 means no init.
@@ -945,8 +1125,8 @@ static DeclRhsList *defergenerating(DeclRhsList *const d, Expr *dyninit)
 /* AM: the 'const's below are to police the unchanging nature of 'd'    */
 /* (and its subfields stg,b).  Note that 't' can be changed.            */
 
-Expr *genstaticparts(DeclRhsList *const d, bool topflag, bool dummy_call,
-        Expr *dyninit)
+static Expr *genstaticparts_1(DeclRhsList *const d, bool topflag,
+        bool dummy_call, Expr *dyninit)
 {   const SET_BITMAP stg = d->declstg;
 /* also note stg below has 2/3 defns bindstg/declstg.                   */
     Binder     *const b  = d->declbind;
@@ -1136,7 +1316,10 @@ case bitofstg_(s_extern):
                     SetDataArea(DS_Const);
                 }
 #endif
-                initstaticvar_1(b, topflag, d->tentative, dyninit);
+                if (vg_candefer(d, topflag))
+                    vg_deferstatic(b, dyninit);
+                else
+                    initstaticvar_1(b, topflag, d->tentative, dyninit);
             }
             /* Put out debug info AFTER initialised array size has      */
             /* been filled in by initstaticvar():                       */
@@ -1262,6 +1445,21 @@ switch_break:
     return dyninit ? optimise0(dyninit) : 0;
 }
 
+Expr *genstaticparts(DeclRhsList *const d, bool topflag, bool dummy_call,
+        Expr *dyninit)
+{   Expr *e;
+    vg_depth++;
+    e = genstaticparts_1(d, topflag, dummy_call, dyninit);
+    if (--vg_depth == 0 && vg_wanted != NULL)
+    {   List *l = (List *)dreverse(vg_wanted);
+        DeferredStatic *p;
+        vg_wanted = NULL;
+        for (; l != NULL; l = cdr_(l))
+            if ((p = vg_deferred((Binder *)car_(l))) != NULL) vg_place(p);
+    }
+    return e;
+}
+
 void vg_generate_deferred_const(Binder *b)
 {   DeclRhsList *d = (DeclRhsList *)(IPtr)bindaddr_(b);  /* see defergenerating() uses */
     Expr *dyninit = declinit_(d);
@@ -1271,6 +1469,12 @@ void vg_generate_deferred_const(Binder *b)
     (void) genstaticparts(d, YES, NO, dyninit);
 }
 
+#ifndef _VARGEN_H       /* xvargen.c provides the C++ vargen_init()     */
+void vargen_init(void)
+{   vg_resetdeferred();
+}
+#endif
+
 #ifndef NO_DUMP_STATE
 void Vargen_LoadState(FILE *f) {
     if (LanguageIsCPlusPlus)
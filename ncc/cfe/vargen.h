@@ -44,8 +44,16 @@ extern Expr *genstaticparts(DeclRhsList * const d, bool topflag,
 
 #ifdef CALLABLE_COMPILER
 #define vg_generate_deferred_const(a)   ((void)(a))
+#define vg_ndeferred                    0
+#define vg_reference(b)                 ((void)(b))
 #else
 extern void vg_generate_deferred_const(Binder *);
+
+/* With --lazy-statics, the number of top-level statics whose data is   */
+/* being held back until they are referenced; rd_primary() then calls    */
+/* vg_reference() for each variable it reads.                           */
+extern int32 vg_ndeferred;
+extern void vg_reference(Binder *b);
 #endif
 #if (defined(CPLUSPLUS) && !defined(CALLABLE_COMPILER))
 extern void vg_note_vtable(TagBinder *cl, int32 sz, Symstr *name);
@@ -59,7 +67,11 @@ extern int32 ddtor_vecsize(void);
 #define vg_note_vtable(cl,sz,name)      ((void)0)
 #define vg_dynamic_init()               ((TopDecl *)0)
 #define vg_ref_dynamic_init()           ((void)0)
+#ifdef CALLABLE_COMPILER
 #define vargen_init()                   ((void)0)
+#else
+extern void vargen_init(void);
+#endif
 #define vg_currentdecl_inits            0
 #define ddtor_vecsize()                 ((int32)0)
 #endif
@@ -1330,11 +1330,166 @@ static int compute_match_value(OvldCandidate *c, TypeExpr *t, const Expr *e,
     }
 }
 
+/* Resolution memo.  A direct-mapped cache keyed by (kind, overload    */
+/* set, argument signature) remembering the unique user function which */
+/* a resolution picked, so that a call site replayed with identical     */
+/* argument types (typically inside template instantiations) does not  */
+/* rank the candidates again.  The signature is the mangled actual      */
+/* types plus lvalue-ness and null-pointer-constant-ness, which is all  */
+/* of an argument that compute_match_value() looks at.  Entries die     */
+/* when an overload set changes (ovldmemo_changed()) or a class gains   */
+/* members (classmemo_generation).  Builtin operator pseudo-binders are */
+/* rebuilt for each use and so are never remembered.                    */
+#define OVLDMEMOSIZE 512
+#define ovldmemohash_(op, b1, b2, sig) \
+    ((int)((op) + (((IPtr)(b1)) >> 3) + (((IPtr)(b2)) >> 3) * 3 + \
+           (((IPtr)(sig)) >> 2) * 7) & (OVLDMEMOSIZE-1))
+
+typedef struct OvldMemo {
+    int32 op;
+    Binder *b1, *b2;
+    Symstr *sig;
+    int32 generation, classgeneration;
+    Binder *result;
+} OvldMemo;
+
+static OvldMemo ovldmemo[OVLDMEMOSIZE];
+static OvldMemo ovldmemo_pending;       /* key for next ovld_reduce()   */
+int32 ovldmemo_generation;
+
+static struct {
+    int32 resolutions, candidates, exactpicks, memohits;
+} ovldstats;
+
+void ovld_init(void)
+{   memclr(ovldmemo, sizeof(ovldmemo));
+    memclr(&ovldstats, sizeof(ovldstats));
+    ovldmemo_pending.op = 0;
+    ovldmemo_generation = 1;
+}
+
+void ovld_tidy(void)
+{   if (debugging(DEBUG_STORE))
+        cc_msg("Overload resolution: %ld resolutions, %ld candidates examined, "
+               "%ld exact picks, %ld memo hits\n",
+               (long)ovldstats.resolutions, (long)ovldstats.candidates,
+               (long)ovldstats.exactpicks, (long)ovldstats.memohits);
+}
+
+static Symstr *ovld_memo_sig(ExprList *l, ExprList *ll)
+{   char v[256], *p = v, *q = v + sizeof(v) - 1;
+    if (l != ll) *p++ = '.';
+    for (; ll != NULL; ll = cdr_(ll))
+    {   Expr *e = exprcar_(ll);
+        TypeExpr *t = modify_actualtype(typeofexpr(e), e);
+        if (h0_(prunetype(t)) == t_ovld || contains_typevars(t))
+            return NULL;
+        p = type_signature(t, p, q, 0);
+        stuffsig_(lvalue_type(e) != NULL ? 'L' : 'r')
+        if (isnullptrconst(e)) stuffsig_('Z')
+        stuffsig_('.')
+        if (p == q) return NULL;
+    }
+    *p = 0;
+    if (strchr(v, '!') != NULL) return NULL;
+    return sym_insert_id(v);
+}
+
+/* Look up a resolution of the overload set (op, b1, b2) for actuals ll */
+/* (l if there is no 'this').  On a hit the candidates are discarded;   */
+/* otherwise the next ovld_reduce() is arranged to remember its result. */
+/* b1, b2 must be in global store since their addresses form the key.   */
+Binder *ovld_memo_find(AEop op, Binder *b1, Binder *b2, List *candidates,
+                       ExprList *l, ExprList *ll)
+{   OvldMemo *m;
+    Symstr *sig;
+    ovldmemo_pending.op = 0;
+    if (cdr_(candidates) == 0 ||
+        (b1 != NULL && !(attributes_(b1) & A_GLOBALSTORE)) ||
+        (b2 != NULL && !(attributes_(b2) & A_GLOBALSTORE)) ||
+        (sig = ovld_memo_sig(l, ll)) == NULL)
+        return NULL;
+    m = &ovldmemo[ovldmemohash_(op, b1, b2, sig)];
+    if (m->op == op && m->b1 == b1 && m->b2 == b2 && m->sig == sig &&
+        m->generation == ovldmemo_generation &&
+        m->classgeneration == classmemo_generation)
+    {   ++ovldstats.memohits;
+        while (candidates)
+        {   if (h0_(candidate_(candidates)->binder) != s_binder)
+                (void) discard3(candidate_(candidates)->binder);
+            candidates = ocl_discard(candidates);
+        }
+        chk_ovld_access(m->result);
+        return m->result;
+    }
+    m = &ovldmemo_pending;
+    m->op = op, m->b1 = b1, m->b2 = b2, m->sig = sig;
+    m->generation = ovldmemo_generation;
+    m->classgeneration = classmemo_generation;
+    return NULL;
+}
+
 #define is_derived_match_(i)    (i<=MATCH_3 && MATCH_4<i)
 #define MAX_NO_ARGS 32
+
+/* Pre-filter: a candidate whose every argument is an exact match        */
+/* (MATCH_1) can be neither beaten nor dropped by the ranking below, so  */
+/* if there is exactly one such it is the answer and candidates needing  */
+/* conversions need never be examined.  Conversion functions are not    */
+/* consulted (MATCH_1 is decided before them) and each candidate is     */
+/* abandoned at its first inexact argument.  Static member functions    */
+/* (which match 'this' specially) disable the pre-filter.               */
+static List *exact_candidate(List *candidates, ExprList *l, ExprList *ll)
+{   List *c, *exact = NULL;
+    for (c = candidates; c != 0; c = cdr_(c))
+    {   OvldCandidate *x = candidate_(c);
+        FormTypeList *ft = x->fnarg;
+        Binder *btry = x->binder;
+        bool is_memfn = h0_(btry) == s_binder &&
+                        (bindstg_(btry) & (b_memfna|b_memfns));
+        ExprList *p;
+        ++ovldstats.candidates;
+        if (is_memfn && (bindstg_(btry) & b_memfns) && l != ll) return NULL;
+        for (p = ll; p != 0 && x->fnarg != 0; p = cdr_(p))
+        {   Expr *e = exprcar_(p);
+            int arg_is_this = (p == ll) && (l != ll) && is_memfn;
+            if (compute_match_value(x, modify_actualtype(typeofexpr(e), e),
+                    e, arg_is_this, NO, lvalue_type(e) != NULL) != MATCH_1)
+                break;
+            x->fnarg = cdr_(x->fnarg);
+        }
+        x->fnarg = ft;
+        if (p == 0)
+        {   if (exact != NULL) return NULL;
+            exact = c;
+        }
+    }
+    return exact;
+}
+
 Binder *ovld_reduce(Binder *b, List *candidates, ExprList *l, ExprList *ll)
-{   /* if there is only one candidate we take it as the best match even though
+{   OvldMemo memo = ovldmemo_pending;
+    int32 ndiags = warncount + xwarncount + recovercount + errorcount;
+    ovldmemo_pending.op = 0;
+    ++ovldstats.resolutions;
+    /* if there is only one candidate we take it as the best match even though
        it may not match -- this gives us better error messages */
+    if (cdr_(candidates) != 0 && h0_(b) != s_init && length(ll) <= MAX_NO_ARGS)
+    {   List *c = exact_candidate(candidates, l, ll), *next;
+        if (c != NULL)
+        {   ++ovldstats.exactpicks;
+            for (next = candidates; next != 0;)
+                if (next == c)
+                    next = cdr_(next);
+                else
+                {   if (h0_(candidate_(next)->binder) != s_binder)
+                        (void) discard3(candidate_(next)->binder);
+                    next = ocl_discard(next);
+                }
+            cdr_(c) = 0;
+            candidates = c;
+        }
+    }
     if (cdr_(candidates) != 0 || h0_(b) == s_init)
     {   List *c, *prev, *next;
         ExprList *p;
@@ -1349,6 +1504,7 @@ Binder *ovld_reduce(Binder *b, List *candidates, ExprList *l, ExprList *ll)
             OvldCandidate *x = candidate_(c);
             FormTypeList *btryfnargs = x->fnarg;
             int nargs = 0;
+            ++ovldstats.candidates;
 
             for (p = ll; p != 0; p = cdr_(p), ++nargs)
             {   Expr *e = exprcar_(p);
@@ -1518,6 +1674,13 @@ Binder *ovld_reduce(Binder *b, List *candidates, ExprList *l, ExprList *ll)
             {   bmatch = candidate_(candidates)->binder;
                 /* beware pseudo-fns for builtin operators... */
                 if (h0_(bmatch) == s_binder) chk_ovld_access(bmatch);
+                if (memo.op != 0 && h0_(bmatch) == s_binder &&
+                    cdr_(candidates) == 0 && ndiags == warncount +
+                        xwarncount + recovercount + errorcount)
+                {   memo.result = bmatch;
+                    ovldmemo[ovldmemohash_(memo.op, memo.b1, memo.b2,
+                                           memo.sig)] = memo;
+                }
             }
         }
 /* clean up any remaining detritus...                                   */
@@ -1545,6 +1708,11 @@ Binder *ovld_resolve(Binder *b, BindList *alternatives,
         }
         return b;
     }
+/* Only the overload set of b itself (in global store) is remembered.   */
+    if (h0_(b) == s_binder && alternatives == typeovldlist_(bindtype_(b)))
+    {   Binder *bmatch = ovld_memo_find(s_binder, b, NULL, candidates, l, ll);
+        if (bmatch != NULL) return bmatch;
+    }
     return ovld_reduce(b, candidates, l, ll);
 }
 
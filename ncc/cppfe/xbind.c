@@ -137,6 +137,7 @@ ClassMember *mk_core_part(TagBinder *cl, ClassMember *bases,
         TagBinder *b = clone_tagbinder(corename, cl);
         tagbindbits_(b) |= TB_CORE|TB_BEINGDEFD;
         tagbindmems_(b) = bases;
+        classmemo_changed();
         b->tagparent = cl;
         m = mk_member(cl, tagbindtype_(b), bitofaccess_(s_public)|CB_CORE, cl);
         memcdr_(m) = vbases;
@@ -302,6 +303,7 @@ again:
     }
     *pp = m;
     memcdr_(m) = p;
+    classmemo_changed();
 
     return RecordGlobalBinder(m);
 }
@@ -863,7 +865,7 @@ static Binder *instate_declaration_cpp(DeclRhsList *d, int declflag)
                                               bindtext_(ftemp), env, YES);
                         }
                         if (declflag & SPECIALIZE)
-                            add_instance(bspecific, &bindinstances_(ftemp), YES);
+                            add_tmptfn_instance(bspecific, ftemp);
                         add_instance(bspecific, &typeovldlist_(bt), NO);
                     }
                 }
@@ -885,6 +887,7 @@ static Binder *instate_declaration_cpp(DeclRhsList *d, int declflag)
                 {   Binder *b = bl->bindlistcar;
                     if (bindsym_(b) == bindsym_(bspecific))
                     {   bl->bindlistcar = bspecific;
+                        ovldmemo_changed();
                         bt = 0;
                     }
                     else if ((stg & b_clinkage) && (bindstg_(b) & b_clinkage))
@@ -894,8 +897,10 @@ static Binder *instate_declaration_cpp(DeclRhsList *d, int declflag)
                     }
                 }
                 if (bt)
-                    typeovldlist_(bt) = (BindList *)
+                {   typeovldlist_(bt) = (BindList *)
                         global_cons2(SU_Type, typeovldlist_(bt), bspecific);
+                    ovldmemo_changed();
+                }
                 if ((stg & b_clinkage) && realbinder_(bspecific) == 0)
                 {   realbinder_(bspecific) =
                         global_mk_binder(0, sv,
@@ -986,9 +991,83 @@ int push_multi_scope(TagBinder *cl)
     return x;
 }
 
+/* Member lookup memo.  A direct-mapped cache keyed by (class, name)    */
+/* which records whether the name is declared anywhere in a complete    */
+/* class or its bases, so path_to_member_2() need not descend into      */
+/* bases which cannot contribute, and keyed by (scope, base) to hold    */
+/* the result of derived_from().  Adding a member, creating a tag or    */
+/* completing a class bumps classmemo_generation, invalidating all.     */
+/* Paths themselves are not cached: they carry access checks which      */
+/* depend on the context of the lookup.                                 */
+#define CLASSMEMOSIZE 1024
+#define classmemohash_(cl, k) \
+    ((int)((((IPtr)(cl)) >> 3) + (((IPtr)(k)) >> 2) * 7) & (CLASSMEMOSIZE-1))
+
+typedef struct ClassMemoEntry {
+    TagBinder *cl;
+    IPtr key;                   /* Symstr * or base TagBinder * */
+    int32 generation;
+    ClassMember *base;          /* derived_from() result */
+    int32 levels;               /* and its increment of derivation_level */
+    bool present;               /* name declared in cl or a base */
+} ClassMemoEntry;
+
+static ClassMemoEntry namememo[CLASSMEMOSIZE], basememo[CLASSMEMOSIZE];
+int32 classmemo_generation;
+
+static bool classmemo_usable(TagBinder *cl)
+{   return (tagbindbits_(cl) & (TB_DEFD|TB_BEINGDEFD|TB_SIZECACHED)) ==
+           (TB_DEFD|TB_SIZECACHED);
+}
+
+static ClassMemoEntry *classmemo_find(ClassMemoEntry *memo, TagBinder *cl, IPtr key)
+{   ClassMemoEntry *m = &memo[classmemohash_(cl, key)];
+    return (m->cl == cl && m->key == key &&
+            m->generation == classmemo_generation) ? m : NULL;
+}
+
+static ClassMemoEntry *classmemo_enter(ClassMemoEntry *memo, TagBinder *cl, IPtr key)
+{   ClassMemoEntry *m = &memo[classmemohash_(cl, key)];
+    m->cl = cl, m->key = key, m->generation = classmemo_generation;
+    return m;
+}
+
+void classmemo_init(void)
+{   memclr(namememo, sizeof(namememo));
+    memclr(basememo, sizeof(basememo));
+    classmemo_generation = 1;
+}
+
+/* Conservative: YES unless sv is certainly not a member of cl or any   */
+/* of its (core, direct or virtual) bases.                              */
+static bool class_may_declare(TagBinder *cl, Symstr *sv)
+{   ClassMemoEntry *m;
+    ClassMember *l;
+    bool present = NO;
+    if (!classmemo_usable(cl)) return YES;
+    if ((m = classmemo_find(namememo, cl, (IPtr)sv)) != NULL)
+        return m->present;
+    for (l = tagbindmems_(cl); l != NULL && !present; l = memcdr_(l))
+    {   if (memsv_(l) == sv)
+            present = YES;
+        else if (h0_(l) == s_member &&
+                 (attributes_(l) & (CB_CORE|CB_BASE|CB_VBASE|CB_VBPTR)))
+        {   TypeExpr *t = princtype(memtype_(l));
+            if (attributes_(l) & CB_VBPTR) t = princtype(typearg_(t));
+            present = !isclasstype_(t) ||
+                      class_may_declare(typespectagbind_(t), sv);
+        }
+    }
+    classmemo_enter(namememo, cl, (IPtr)sv)->present = present;
+    return present;
+}
+
 static Expr *path_to_member_2(ClassMember *member, TagBinder *b, int flags,
         ClassMember *vbases, TagBinder *privately_deriving_class)
 {   ClassMember *l = tagbindmems_(b);
+    if (h0_(member) == s_identifier &&
+        !class_may_declare(b, (Symstr *)member))
+        return NULL;
     if (l != NULL && (attributes_(l) & CB_CORE))
     {   Expr *e;
 /* This section is both useful for testing (in effect implementing a   */
@@ -1005,7 +1084,27 @@ static Expr *path_to_member_2(ClassMember *member, TagBinder *b, int flags,
 
 int derivation_level;
 
+static ClassMember *derived_from_1(TagBinder *base, TagBinder *scope);
+
 ClassMember *derived_from(TagBinder *base, TagBinder *scope)
+{   ClassMemoEntry *m;
+    ClassMember *l;
+    int level0;
+    if (!classmemo_usable(scope) || !classmemo_usable(base))
+        return derived_from_1(base, scope);
+    if ((m = classmemo_find(basememo, scope, (IPtr)base)) != NULL)
+    {   derivation_level += m->levels;
+        return m->base;
+    }
+    level0 = derivation_level;
+    l = derived_from_1(base, scope);
+    m = classmemo_enter(basememo, scope, (IPtr)base);
+    m->base = l;
+    m->levels = derivation_level - level0;
+    return l;
+}
+
+static ClassMember *derived_from_1(TagBinder *base, TagBinder *scope)
 {   ClassMember *l, *ll;
     if (debugging(DEBUG_BIND)) cc_msg("derived_from($b,$b)\n", base, scope);
     derivation_level++;
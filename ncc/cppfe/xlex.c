@@ -48,43 +48,6 @@ static void save_names(bool glob);
 static void restore_names(void);
 #include "lex.c"
 
-static const SymBuf lexbuf_empty =
-   { 0, { s_eof }, (SymInfo *)DUFF_ADDR, 0, /*pos*/ -1, 0, NO, /* old_put_handle */ -1 };
-#define INIT_NLEXBUFS 8         /* initially max 8 member fn defs.      */
-#define INIT_LEXBUFSIZE 32      /* initially max 32 tokens per def.     */
-
-/* C++ requires function definitions within class definitions to be     */
-/* lexed, but not parsed (typedefs) nor typechecked [ES, p178].         */
-/* We save them as as token streams until we are ready -- the end       */
-/* is observable by counting {}'s.                                      */
-/* Note there is a complication about reading such a saved token stream */
-/* since such a fn body may contain embedded fns within yet other       */
-/* (local) class definitions.                                           */
-/* Globalise everything to be buffered for now (very little to do).     */
-
-static int lex_findsavebuf(void)
-{   int i;
-    for (i = 0; i<lexbuf_max; i++)
-        if (lexbuf_vec[i].pos < 0)
-            return i;
-    {   int nmax = (lexbuf_max == 0 ? INIT_NLEXBUFS : 2*lexbuf_max);
-        SymBuf *nvec = (SymBuf *)GlobAlloc(SU_Other,
-                                     (int32)nmax * sizeof(SymBuf));
-        memcpy(nvec, lexbuf_vec, lexbuf_max * sizeof(SymBuf));
-        for (i = lexbuf_max; i < nmax; i++) nvec[i] = lexbuf_empty;
-        lexbuf_max = nmax, lexbuf_vec = nvec;
-        return lex_findsavebuf();       /* retry */
-    }
-}
-
-static void lex_ensurebuf(SymBuf *p)
-{   int nsize = (p->size == 0 ? INIT_LEXBUFSIZE : p->size*2);
-    SymInfo *nbuf = (SymInfo *)GlobAlloc(SU_Other,
-                                         (int32)nsize * sizeof(SymInfo));
-    memcpy(nbuf, p->buf, p->size * sizeof(SymInfo));
-    p->size = nsize, p->buf = nbuf;
-}
-
 static void lex_putbodysym()
 {   SymBuf *p = &lexbuf_vec[nextsym_put_handle];
     int put_handle = nextsym_put_handle;
@@ -126,27 +89,6 @@ int lex_bodybegin()
     return nextsym_put_handle;
 }
 
-static void lex_dumpbuf(const SymBuf *p)
-{
-    if (p->pos < 0)
-        cc_msg("unused lexbuf\n");
-    else
-    {   int i = 0;
-        cc_msg("    ");
-        for (;;)
-        {   cc_msg("$k ", p->buf[i]);
-            ++i;
-            if (0 < p->count && p->count <= i)
-                break;
-            else if (p->buf[i].sym == s_eof)
-                break;
-            if (i % 8 == 0)
-                cc_msg("\n    ");
-        }
-        cc_msg("\n");
-    }
-}
-
 int lex_bodyend()
 {   int h = nextsym_put_handle;
     SymBuf *p;
@@ -164,39 +106,6 @@ int lex_bodyend()
     return h;
 }
 
-/* lex_savebody() reads and saves (on the fly) a member fn body.        */
-/* maybe should be called lex_saveblock */
-int lex_savebody(void)
-{   int h = lex_findsavebuf();
-    SymBuf *p = &lexbuf_vec[h];
-    int k = 0, braces = 0;
-    if (debugging(DEBUG_LEX))
-        cc_msg("lex_savebody: [%d]\n", h);
-    p->pos = 0;                 /* inuse + ready for reader.        */
-/* save all the tokens in p->buf, followed by a s_eof token.        */
-    for (;;)
-    {   if (k >= p->size) lex_ensurebuf(p);
-        lex_beware_reinit();                    /* globalise curlex     */
-        if (debugging(DEBUG_LEX))
-            cc_msg("lex_savebody: saving $l in [%d]\n", h);
-        p->buf[k++] = curlex;
-        switch (curlex.sym)
-        {   case s_lbrace: braces++;
-            default:       nextsym();
-                           break;
-            case s_rbrace: if (--braces == 0) curlex.sym = s_eof;
-                           else nextsym();
-                           break;
-            case s_eof:    p->count = k;
-                           if (debugging(DEBUG_LEX))
-                           {   cc_msg("lex_savebody: [%d] is\n", h);
-                               lex_dumpbuf(p);
-                           }
-                           return h;
-        }
-    }
-}
-
 int lex_saveexpr(void)
 {   int h = lex_findsavebuf();
     SymBuf *p = &lexbuf_vec[h];
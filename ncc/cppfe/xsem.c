@@ -51,6 +51,7 @@ static bool call_dependency_val(Expr *e, ScopeSaver tactuals);
 static void sem_attempt_template_function(Binder *generic, Binder *specific);
 static bool is_comparable_specialization(TypeExpr *t1, TypeExpr *t2);
 static Binder *sem_instantiate_tmptfn(Binder *b, TypeExpr *bt, ExprList **l);
+static void xsem_init(void);
 
 #define ensurelvalue_s_invisible \
                              /* a more general version of s_integer ...    */\
@@ -372,9 +373,45 @@ static bool match_non_type_args(ScopeSaver tformals, ExprList *actuals)
     return (!tformals && !actuals) ? YES : NO;
 }
 
+/* Instances of function templates, hashed on the mangled instance name */
+/* (which encodes the template argument signature). Every instance goes  */
+/* in through add_tmptfn_instance(), so this is the only index searched. */
+#define TMPTINSTHASHSIZE 256
+#define tmptinsthash_(sv) ((int)(((IPtr)(sv)) >> 2) & (TMPTINSTHASHSIZE - 1))
+
+static struct tmpt_inst { struct tmpt_inst *cdr; Symstr *name; Binder *inst; }
+    *tmpt_instances[TMPTINSTHASHSIZE];
+
+static Binder *tmpt_instance_find(Symstr *sv)
+{   struct tmpt_inst *p;
+    for (p = tmpt_instances[tmptinsthash_(sv)]; p != NULL; p = p->cdr)
+        if (p->name == sv) return p->inst;
+    return NULL;
+}
+
+static void tmpt_instance_note(Symstr *sv, Binder *inst)
+{   int hash = tmptinsthash_(sv);
+    if (sv == NULL || tmpt_instance_find(sv) != NULL) return;
+    tmpt_instances[hash] = (struct tmpt_inst *)
+        global_list3(SU_Bind, tmpt_instances[hash], sv, inst);
+}
+
+static bool tmpt_instance_usable(Binder *inst, Binder *ftemp, TypeExpr *t,
+                                 ExprList *actuals)
+{   return equivtype(t, bindtype_(inst)) &&
+           !((bindstg_(inst) & b_undef) && !(bindstg_(ftemp) & b_undef)) &&
+           (actuals == NULL || match_non_type_args(bindformals_(inst), actuals));
+}
+
+static void xsem_init(void)
+{   memset(tmpt_instances, 0, sizeof(tmpt_instances));
+    ovld_init();
+}
+
 static Binder *sem_instantiate_tmptfn(Binder *b, TypeExpr *bt, ExprList **l)
 {   Binder *fb = NULL;
     BindList *tmpts;
+    Symstr *key = NULL;
 
     if ((tmpts = temp_reduce(NULL, *l, NULL, b)) != NULL)
     {   Binder *ftemp = tmpts->bindlistcar;
@@ -409,15 +446,17 @@ static Binder *sem_instantiate_tmptfn(Binder *b, TypeExpr *bt, ExprList **l)
                      match_non_type_args(bindformals_(bl->bindlistcar), bindactuals_(b))))
                     has_failed = YES;
 
-        for (bl = bindinstances_(ftemp); bl && !has_failed; bl = bl->bindlistcdr)
-            if (equivtype(t, bindtype_(bl->bindlistcar)) &&
-                !((bindstg_(bl->bindlistcar) & b_undef) &&
-                  !(bindstg_(ftemp) & b_undef)) &&
-                (bindactuals_(b) == NULL ||
-                 match_non_type_args(bindformals_(bl->bindlistcar), bindactuals_(b))))
-            {   has_failed = YES;   /* pretends it's failed */
-                fb = bl->bindlistcar;
-            }
+        /* Look the instance up by its mangled name.                      */
+        if (!has_failed)
+        {   TypeExpr *kt = clone_typeexpr(t);
+            fixup_template_arg_type(kt, env);
+            key = ovld_instance_name(ovld_tmptfn_instance_name(bindsym_(ftemp), env), kt);
+            if ((fb = tmpt_instance_find(key)) != NULL &&
+                tmpt_instance_usable(fb, ftemp, t, bindactuals_(b)))
+                has_failed = YES;   /* pretends it's failed */
+            else
+                fb = NULL;
+        }
 
         if (!has_failed)
         {   Binder *fbind = NULL;
@@ -445,7 +484,7 @@ static Binder *sem_instantiate_tmptfn(Binder *b, TypeExpr *bt, ExprList **l)
                 bindenv_(fbind) = (!prefer_tmptfn(bindactuals_(b))) ?
                     globalize_template_arg_binders(env, bindactuals_(b)) : env;
                 add_instance(fbind, &typeovldlist_(bt), NO);
-                add_instance(fbind, &bindinstances_(ftemp), YES);
+                add_tmptfn_instance(fbind, ftemp);
                 if (bindstg_(ftemp) & (b_memfna+b_memfns))
                 {   TagBinder *parent = bindparent_(ftemp);
                     Binder *btop;
@@ -732,10 +771,13 @@ default:
 
     if (candidates == 0) return 0;
 
-    {   Binder bb, *b;
+    {   Binder bb, *b = NULL;
         bb.h0 = op;
         bb.bindparent = cla;
-        b = ovld_reduce(&bb, candidates, l, ll);
+        if (b1 != NULL || b2 != NULL)
+            b = ovld_memo_find(op, b1, b2, candidates, l, ll);
+        if (b == NULL)
+            b = ovld_reduce(&bb, candidates, l, ll);
         if (b == 0)
         {   if (op == s_assign && cla != 0 && (tagbindbits_(cla) & TB_NEEDSOPEQ))
             {   cc_err(sem_err_assign_ovld, cla);
@@ -3239,6 +3281,12 @@ void add_instance(Binder *b, BindList **bl, bool bindstore)
     *bl = global_cons2((bindstore)? SU_Bind : SU_Type, *bl, b);
 }
 
+/* Record inst as an instance of the function template ftemp.            */
+void add_tmptfn_instance(Binder *inst, Binder *ftemp)
+{   add_instance(inst, &bindinstances_(ftemp), YES);
+    tmpt_instance_note(bindsym_(inst), inst);
+}
+
 bool contains_typevars(TypeExpr *t)
 {   typevars_tag_list = NULL;
     return contains_typevars_0(t, NO);
@@ -30,6 +30,7 @@
 #include "aeops.h"
 #include "codebuf.h"
 #include "compiler.h"  /* UpdateProgress */
+#include "dump.h"      /* for dump_state */
 #include "cg.h"  /* for cg_topdecl - @@@ BREAKS the dependency structure */
 
 #ifdef CALLABLE_COMPILER
@@ -974,7 +975,7 @@ static Binder *ovld_match_def(Binder *b, TypeExpr *t, BindList *l,
             /*typeovldlist_(bindtype_(b)) = (BindList *)
                 global_cons2(SU_Type, typeovldlist_(bindtype_(b)), fbind);*/
             add_instance(fbind, &typeovldlist_(bindtype_(b)), NO);
-            add_instance(fbind, &bindinstances_(ftemp), YES);
+            add_tmptfn_instance(fbind, ftemp);
             decl.declname = ovld_add_memclass(bindsym_(fbind), bindparent_(fbind),
                                               (bindstg_(fbind) & b_memfns) != 0);
             stg = killstgacc_(bindstg_(fbind));
@@ -3450,14 +3451,169 @@ static void add_memfn_template(TagBinder *p, Symstr *name, Symstr *realname, Typ
                     formaltags, tokhandle, templateformals, YES);
 }
 
+/* The template instantiation repository (-zGT<file>) records, one     */
+/* line per instance, each external function template instance that a  */
+/* compilation generated code for and the object file it went into.     */
+/* An instance owned by another object is neither parsed nor code       */
+/* generated here; calls to it are left as external references.          */
+/* A line whose object file no longer exists is stale and is ignored    */
+/* (and dropped when the file is next rewritten). The compilation's own */
+/* old lines are replaced by the instances it generates this time.      */
+#define TMPTREPHASHSIZE 256
+#define tmptrephash_(sv) ((int)(((IPtr)(sv)) >> 2) & (TMPTREPHASHSIZE - 1))
+
+typedef struct TmptRepEntry {
+    struct TmptRepEntry *cdr;
+    struct TmptRepEntry *newcdr;    /* entries generated by this compilation */
+    Symstr *name;
+    char const *owner;
+    bool claimed;                   /* written meanwhile by another unit     */
+} TmptRepEntry;
+
+static TmptRepEntry *tmptrep[TMPTREPHASHSIZE];
+static TmptRepEntry *tmptrep_new, **tmptrep_newq;
+static char const *tmptrep_owner;
+
+static TmptRepEntry *tmptrep_find(Symstr *sv)
+{   TmptRepEntry *p;
+    for (p = tmptrep[tmptrephash_(sv)]; p != NULL; p = p->cdr)
+        if (p->name == sv) return p;
+    return NULL;
+}
+
+static void tmptrep_add(Symstr *sv, char const *owner, bool isnew)
+{   int hash = tmptrephash_(sv);
+    TmptRepEntry *p = (TmptRepEntry *)GlobAlloc(SU_Other, sizeof(*p));
+    p->cdr = tmptrep[hash];
+    p->name = sv;
+    p->owner = owner;
+    p->newcdr = NULL;
+    p->claimed = NO;
+    tmptrep[hash] = p;
+    if (isnew) *tmptrep_newq = p, tmptrep_newq = &p->newcdr;
+}
+
+/* Reads the next line of f, of any length, splitting it at the tab.    */
+/* Returns NO at end of file. The buffer is reused by the next call.    */
+static char *tmptrep_buf;
+static size_t tmptrep_bufsize;
+
+static bool tmptrep_readline(FILE *f, char **name, char **owner)
+{   char *buf = tmptrep_buf;
+    size_t bufsize = tmptrep_bufsize;
+    if (f == NULL) return NO;
+    for (;;)
+    {   size_t n = 0;
+        int ch;
+        char *tab;
+        for (;;)
+        {   if (n + 1 >= bufsize)
+            {   size_t newsize = bufsize == 0 ? 256 : 2 * bufsize;
+                char *b = (char *)GlobAlloc(SU_Other, (int32)newsize);
+                if (n != 0) memcpy(b, buf, n);
+                tmptrep_buf = buf = b, tmptrep_bufsize = bufsize = newsize;
+            }
+            ch = getc(f);
+            if (ch == EOF && n == 0) return NO;
+            if (ch == EOF || ch == '\n') break;
+            buf[n++] = (char)ch;
+        }
+        buf[n] = 0;
+        if ((tab = strchr(buf, '\t')) != NULL)
+        {   *tab = 0;
+            *name = buf, *owner = tab + 1;
+            return YES;
+        }
+    }
+}
+
+/* Whether the object file named in a repository line still exists.     */
+/* Consecutive lines tend to share an owner, so remember the last one.  */
+static char const *tmptrep_lastowner;
+static bool tmptrep_lastexists;
+
+static bool tmptrep_ownerexists(char const *owner)
+{   FILE *f;
+    if (tmptrep_lastowner != NULL && StrEq(tmptrep_lastowner, owner))
+        return tmptrep_lastexists;
+    tmptrep_lastowner =
+        strcpy((char *)GlobAlloc(SU_Other, (int32)strlen(owner) + 1), owner);
+    if ((f = fopen(owner, "rb")) != NULL) fclose(f);
+    return tmptrep_lastexists = (f != NULL);
+}
+
+void syn_read_tmptrepository(FILE *f, char const *owner)
+{   char *name, *lineowner;
+    tmptrep_owner = strcpy((char *)GlobAlloc(SU_Other, (int32)strlen(owner) + 1), owner);
+    while (tmptrep_readline(f, &name, &lineowner))
+    {   Symstr *sv;
+        if (StrEq(lineowner, owner) || !tmptrep_ownerexists(lineowner))
+            continue;
+        sv = sym_insert_id(name);
+        if (tmptrep_find(sv) == NULL)
+            tmptrep_add(sv,
+                strcpy((char *)GlobAlloc(SU_Other, (int32)strlen(lineowner) + 1), lineowner),
+                NO);
+    }
+}
+
+/* Writes the repository to out: the lines of the current file in (NULL */
+/* if there is none yet) other than this compilation's own and stale    */
+/* ones, then the instances generated here. An instance claimed in the  */
+/* meantime by a unit compiled alongside this one keeps that claim.     */
+void syn_write_tmptrepository(FILE *in, FILE *out)
+{   TmptRepEntry *p;
+    char *name, *lineowner;
+    while (tmptrep_readline(in, &name, &lineowner))
+    {   Symstr *sv;
+        if (StrEq(lineowner, tmptrep_owner) || !tmptrep_ownerexists(lineowner))
+            continue;
+        sv = sym_insert_id(name);
+        if ((p = tmptrep_find(sv)) != NULL && p->owner == tmptrep_owner)
+            p->claimed = YES;
+        fprintf(out, "%s\t%s\n", name, lineowner);
+    }
+    for (p = tmptrep_new; p != NULL; p = p->newcdr)
+        if (!p->claimed)
+            fprintf(out, "%s\t%s\n", symname_(p->name), p->owner);
+}
+
+/* The name under which add_pendingfn()'s function will be defined.     */
+static Symstr *tmptrep_key(Symstr *name, Symstr *realname, TypeExpr *t,
+                           SET_BITMAP stg)
+{   return (realname == NULL || (stg & (b_memfna+b_memfns))) ? name :
+        ovld_instance_name(realname, t);
+}
+
+static bool tmptrep_elsewhere(Symstr *sv)
+{   TmptRepEntry *p;
+    if (tmptrep_owner == NULL || (p = tmptrep_find(sv)) == NULL) return NO;
+    return p->owner != tmptrep_owner;
+}
+
+static void tmptrep_note(Binder *b)
+{   if (tmptrep_owner == NULL || b == NULL) return;
+    if (!(bindstg_(b) & (bitofstg_(s_inline)|bitofstg_(s_static))) &&
+        tmptrep_find(bindsym_(b)) == NULL)
+        tmptrep_add(bindsym_(b), tmptrep_owner, YES);
+}
+
 void add_pendingfn(Symstr *name, Symstr *realname, TypeExpr *t, SET_BITMAP stg,
                    TagBinder *scope, ScopeSaver formaltags, int tokhandle,
                    ScopeSaver templateformals, bool tfn)
 {
     bool parse_only = (scope && ((tagbindbits_(scope) & TB_TEMPLATE)) ||
                        has_template_parameter(templateformals));
+    if (tfn && !parse_only && tmptrep_owner != NULL &&
+        tmptrep_elsewhere(tmptrep_key(name, realname, t, stg)))
+    {   if (debugging(DEBUG_TEMPLATE))
+            cc_msg("template fn $r in repository\n",
+                   tmptrep_key(name, realname, t, stg));
+        return;
+    }
     if (tfn && !parse_only)
     {   TopDecl *fd;
+        Binder *fb;
         DeclRhsList *d;
         int sl;
         int save_bind_scope = bind_scope; /* will be changed by rd_fndef */
@@ -3495,7 +3651,9 @@ void add_pendingfn(Symstr *name, Symstr *realname, TypeExpr *t, SET_BITMAP stg,
         pop_scope_no_check(sl);
         lex_closebody();
         (void)set_access_context(old_access_context, NULL);
+        fb = (h0_(fd) == s_fndef) ? fd->v_f.fn.name : NULL;
         cg_topdecl(fd, curlex.fl);
+        tmptrep_note(fb);
         drop_local_store();
         pop_nested_context();
         alloc_unmark(mark);
@@ -3758,6 +3916,10 @@ void xsyn_reinit()
 static void xsyn_init(void)
 {   saved_temps = NULL;
     recursing = 0;
+    memset(tmptrep, 0, sizeof(tmptrep));
+    tmptrep_new = NULL, tmptrep_newq = &tmptrep_new;
+    tmptrep_owner = tmptrep_lastowner = NULL;
+    tmptrep_buf = NULL, tmptrep_bufsize = 0;
 }
 
 /* End of cppfe/xsyn.c */
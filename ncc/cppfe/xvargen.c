@@ -32,6 +32,7 @@
 #include "xrefs.h"
 #include "inline.h"
 #include "errors.h"
+#include "dump.h"      /* for dump_state */
 #define _VARGEN_H
 
 static void dynamic_init(Expr *e, bool full);
@@ -423,7 +424,9 @@ TopDecl *vg_dynamic_init(void)
         return d;
     }
 #ifdef TARGET_HAS_DEBUGGER
-    usrdbgmask = saved_usrdbgmask;    /* to ensure dbg_writedebug works */
+    /* Only the DBG_ANY bits were saved and cleared: OR them back so   */
+    /* that the others (-gx, -gt+t) are not lost.                       */
+    usrdbgmask |= saved_usrdbgmask;   /* to ensure dbg_writedebug works */
     saved_usrdbgmask = -1;
 #endif
     return NULL;
@@ -457,7 +460,6 @@ void vg_ref_dynamic_init(void)
 
 #ifndef NO_DUMP_STATE
 
-#include "dump.h"
 static Cmd *LoadCmd(FILE *f) {
     Cmd *c = (Cmd *)GlobAlloc(SU_Other, (int32)offsetof(Cmd,cmd2));
     h0_(c) = s_semicolon;
@@ -581,7 +583,8 @@ static void Vargen_cpp_DumpState(FILE *f) {
 #endif
 
 void vargen_init(void)
-{   hackrefdataseg = NO;
+{   vg_resetdeferred();
+    hackrefdataseg = NO;
 #ifdef TARGET_HAS_DEBUGGER
     saved_usrdbgmask = -1;
 #endif
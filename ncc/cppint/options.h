@@ -29,6 +29,7 @@
 #define NO_OBJECT_OUTPUT        1
 #define NO_DEBUGGER             1
 #define NO_ASSEMBLER_OUTPUT     1
+#define NO_DUMP_STATE           1
 
 #define TARGET_VTAB_ELTSIZE  4
     /* for indirect VTABLEs optimised for single inheritance */
@@ -0,0 +1,173 @@
+/*
+ * interp/ibc.c: register bytecode for debugger expressions
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * Building and running the programs described in ibc.h.  The executor
+ * is a plain switch over a flat instruction vector: one dispatch per
+ * operation, operands in a local register file, no allocation, and a
+ * target read only where the source expression itself reads memory.
+ */
+
+#include <string.h>
+
+#include "ibc.h"
+
+void ibc_start(IbcBuild *bc)
+{
+    bc->flags = 0;
+    bc->ninsns = 0;
+    bc->overflow = NO;
+}
+
+int32 ibc_emit(IbcBuild *bc, IbcOp op, int a, int b, int c, int32 k)
+{
+    IbcInsn *p;
+
+    if (bc->ninsns >= IBC_MAXCODE) {
+        bc->overflow = YES;
+        return IBC_MAXCODE-1;
+    }
+    if (op == IBC_FPADDR) bc->flags |= IBCF_FRAME;
+    p = &bc->code[bc->ninsns];
+    p->op = (unsigned8)op;
+    p->a = (unsigned8)a;
+    p->b = (unsigned8)b;
+    p->c = (unsigned8)c;
+    p->k = k;
+    return bc->ninsns++;
+}
+
+void ibc_patch(IbcBuild *bc, int32 at)
+{
+    bc->code[at].k = bc->ninsns;
+}
+
+void ibc_finish(IbcBuild *bc, IbcProg *p)
+{
+    p->flags = bc->flags;
+    p->ninsns = bc->ninsns;
+    memcpy(p->code, bc->code, (size_t)bc->ninsns * sizeof(IbcInsn));
+}
+
+/* Kept static so that ibc_run() can have it inline. */
+static bool arith(IbcOp op, int32 x, int32 y, int32 *res)
+{
+    unsigned32 ux = (unsigned32)x, uy = (unsigned32)y;
+    unsigned32 n = uy & 255;
+
+    switch (op) {
+    case IBC_MOV:   *res = x; break;
+    case IBC_ADD:   *res = (int32)(ux + uy); break;
+    case IBC_SUB:   *res = (int32)(ux - uy); break;
+    case IBC_MUL:   *res = (int32)(ux * uy); break;
+    case IBC_DIV:
+    case IBC_REM:
+        /* the host would trap: refuse instead */
+        if (y == 0 || (y == -1 && x == INT32_MIN)) return NO;
+        *res = op == IBC_DIV ? x / y : x % y;
+        break;
+    case IBC_DIVU:
+    case IBC_REMU:
+        if (y == 0) return NO;
+        *res = (int32)(op == IBC_DIVU ? ux / uy : ux % uy);
+        break;
+    case IBC_AND:   *res = x & y; break;
+    case IBC_OR:    *res = x | y; break;
+    case IBC_XOR:   *res = x ^ y; break;
+    case IBC_SHL:   *res = n >= 32 ? 0 : (int32)(ux << n); break;
+    case IBC_SHRU:  *res = n >= 32 ? 0 : (int32)(ux >> n); break;
+    case IBC_SHR:   *res = x >> (n >= 32 ? 31 : n); break;
+    case IBC_EQ:    *res = x == y; break;
+    case IBC_NE:    *res = x != y; break;
+    case IBC_LT:    *res = x < y; break;
+    case IBC_LE:    *res = x <= y; break;
+    case IBC_GT:    *res = x > y; break;
+    case IBC_GE:    *res = x >= y; break;
+    case IBC_LTU:   *res = ux < uy; break;
+    case IBC_LEU:   *res = ux <= uy; break;
+    case IBC_GTU:   *res = ux > uy; break;
+    case IBC_GEU:   *res = ux >= uy; break;
+    case IBC_NEG:   *res = (int32)(0 - ux); break;
+    case IBC_NOT:   *res = ~x; break;
+    case IBC_BOOLNOT: *res = !x; break;
+    case IBC_TEST:  *res = x != 0; break;
+    case IBC_EXTB:  *res = (int32)(unsigned8)x; break;
+    case IBC_EXTSB: *res = (int32)(int8_t)x; break;
+    case IBC_EXTH:  *res = (int32)(unsigned16)x; break;
+    case IBC_EXTSH: *res = (int32)(int16_t)x; break;
+    default:
+        return NO;
+    }
+    return YES;
+}
+
+bool ibc_arith(IbcOp op, int32 x, int32 y, int32 *res)
+{
+    return arith(op, x, y, res);
+}
+
+Dbg_Error ibc_run(IbcProg const *p, IbcTarget const *t,
+                  Dbg_MCState *state, Dbg_Environment *env, int32 *result)
+{
+    int32 r[IBC_NREGS];
+    IbcInsn const *pc = p->code;
+    IbcInsn const *end = p->code + p->ninsns;
+    ARMaddress a;
+    ARMword w;
+    ARMhword h;
+    Dbg_Byte c;
+
+    for (; pc < end; pc++) {
+        switch (pc->op) {
+        case IBC_CONST:
+            r[pc->a] = pc->k;
+            continue;
+        case IBC_MOV:
+            r[pc->a] = r[pc->b];
+            continue;
+        case IBC_FPADDR:
+            r[pc->a] = (int32)FPOffset(pc->k, env);
+            continue;
+        case IBC_JMP:
+            pc = p->code + pc->k - 1;
+            continue;
+        case IBC_JZ:
+            if (r[pc->a] == 0) pc = p->code + pc->k - 1;
+            continue;
+        case IBC_JNZ:
+            if (r[pc->a] != 0) pc = p->code + pc->k - 1;
+            continue;
+        case IBC_RET:
+            *result = r[pc->a];
+            return Error_OK;
+        }
+
+        if (pc->op <= IBC_LDSB) {
+            a = (ARMaddress)(unsigned32)(pc->b == IBC_NOREG ? pc->k : r[pc->b] + pc->k);
+            switch (pc->op) {
+            case IBC_LDW:
+                if (t->readword(state, &w, a) != Error_OK) return Error_NOK;
+                r[pc->a] = (int32)w;
+                break;
+            case IBC_LDH:
+            case IBC_LDSH:
+                if (t->readhalf(state, &h, a) != Error_OK) return Error_NOK;
+                r[pc->a] = pc->op == IBC_LDSH ? (int32)(int16_t)h : (int32)h;
+                break;
+            default:
+                if (t->readbyte(state, &c, a) != Error_OK) return Error_NOK;
+                r[pc->a] = pc->op == IBC_LDSB ? (int32)(int8_t)c : (int32)c;
+                break;
+            }
+            continue;
+        }
+
+        /* Everything else is arithmetic; the unary ones ignore y. */
+        if (!arith((IbcOp)pc->op, r[pc->b],
+                   pc->c == IBC_NOREG ? pc->k : r[pc->c], &r[pc->a]))
+            return Error_NOK;
+    }
+    return Error_NOK;           /* fell off the end: no IBC_RET */
+}
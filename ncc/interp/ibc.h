@@ -0,0 +1,137 @@
+/*
+ * interp/ibc.h: register bytecode for debugger expressions
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * An expression which is evaluated over and over again (a conditional
+ * breakpoint or a watched expression) is compiled once by interp.c into
+ * a short vector of three address instructions over a small file of
+ * int32 registers, which ibc_run() then executes on each hit instead of
+ * walking the AE tree again.  Only side effect free integer and pointer
+ * expressions are compiled; anything else stays with eval_expr().
+ *
+ * This file knows nothing about AE trees, so it can be exercised (see
+ * ibcbench.c) against a stand-in target without the rest of the
+ * interpreter.
+ */
+
+#ifndef _ibc_h
+#define _ibc_h
+
+#include "host.h"
+#include "asdfmt.h"
+#include "dbg_hdr.h"
+
+#define IBC_NREGS       32
+#define IBC_MAXCODE     256
+#define IBC_NOREG       255     /* as b: absolute address k; as c: operand k */
+
+typedef enum {
+    IBC_CONST,          /* r[a] = k                                     */
+    IBC_MOV,            /* r[a] = r[b]                                  */
+    IBC_FPADDR,         /* r[a] = FPOffset(k, env)                      */
+    IBC_LDW,            /* r[a] = mem[r[b]+k], b == IBC_NOREG for mem[k] */
+    IBC_LDH,
+    IBC_LDSH,
+    IBC_LDB,
+    IBC_LDSB,
+    /* r[a] = r[b] op r[c], or r[b] op k if c == IBC_NOREG, on int32     */
+    /* wrapping as the target's registers do.  Shifts take the count from */
+    /* its bottom byte, as an ARM register shift does: a count of 32 or   */
+    /* more gives 0, or copies of the sign bit for IBC_SHR.               */
+    IBC_ADD,
+    IBC_SUB,
+    IBC_MUL,
+    IBC_AND,
+    IBC_OR,
+    IBC_XOR,
+    IBC_SHL,
+    IBC_EQ,
+    IBC_NE,
+    IBC_DIV,
+    IBC_REM,
+    IBC_SHR,
+    IBC_LT,
+    IBC_LE,
+    IBC_GT,
+    IBC_GE,
+    /* IBC_DIV to IBC_GE with the operands taken as unsigned32, in the    */
+    /* same order.                                                        */
+    IBC_DIVU,
+    IBC_REMU,
+    IBC_SHRU,
+    IBC_LTU,
+    IBC_LEU,
+    IBC_GTU,
+    IBC_GEU,
+    /* Unary: c is IBC_NOREG.                                             */
+    IBC_NEG,            /* r[a] = -r[b]                                 */
+    IBC_NOT,            /* r[a] = ~r[b]                                 */
+    IBC_BOOLNOT,        /* r[a] = !r[b]                                 */
+    IBC_TEST,           /* r[a] = r[b] != 0                             */
+    IBC_EXTB,           /* r[a] = r[b] truncated to unsigned8           */
+    IBC_EXTSB,          /*        ... to a signed byte                  */
+    IBC_EXTH,           /*        ... to unsigned16                     */
+    IBC_EXTSH,          /*        ... to a signed halfword              */
+    IBC_JMP,            /* goto k                                       */
+    IBC_JZ,             /* if (r[a] == 0) goto k                        */
+    IBC_JNZ,            /* if (r[a] != 0) goto k                        */
+    IBC_RET             /* result is r[a]                               */
+} IbcOp;
+
+typedef struct IbcInsn {
+    unsigned8 op, a, b, c;
+    int32 k;
+} IbcInsn;
+
+#define IBCF_FRAME      1       /* uses IBC_FPADDR: needs a current frame */
+
+typedef struct IbcProg {
+    int32 flags;
+    int32 ninsns;
+    IbcInsn code[1];            /* really [ninsns] */
+} IbcProg;
+
+#define ibc_progsize_(n) \
+    ((size_t)offsetof(IbcProg, code) + (size_t)(n) * sizeof(IbcInsn))
+
+/* The target memory interface: interp.c passes its readword() and      */
+/* friends so that interpreter-local addresses keep working.             */
+typedef struct IbcTarget {
+    Dbg_Error (*readword)(Dbg_MCState *, ARMword *, ARMaddress);
+    Dbg_Error (*readhalf)(Dbg_MCState *, ARMhword *, ARMaddress);
+    Dbg_Error (*readbyte)(Dbg_MCState *, Dbg_Byte *, ARMaddress);
+} IbcTarget;
+
+/* A program under construction.  Overflowing IBC_MAXCODE sets overflow  */
+/* and further instructions are dropped; the caller gives up on it.      */
+typedef struct IbcBuild {
+    int32 flags;
+    int32 ninsns;
+    bool overflow;
+    IbcInsn code[IBC_MAXCODE];
+} IbcBuild;
+
+extern void ibc_start(IbcBuild *bc);
+
+/* Appends an instruction and returns its index (for ibc_patch()). */
+extern int32 ibc_emit(IbcBuild *bc, IbcOp op, int a, int b, int c, int32 k);
+
+/* Sets the target of the jump at index 'at' to the next instruction. */
+extern void ibc_patch(IbcBuild *bc, int32 at);
+
+/* Copies the finished program (ibc_progsize_(bc->ninsns) bytes) to p. */
+extern void ibc_finish(IbcBuild *bc, IbcProg *p);
+
+/* Does an arithmetic instruction (IBC_ADD to IBC_EXTSH, or IBC_MOV) on */
+/* x and y (unused by the unary ones), so that the tree walker in        */
+/* interp.c gives the same answers as the bytecode.  Returns NO for      */
+/* division by zero or of INT32_MIN by -1, and for any other op.         */
+extern bool ibc_arith(IbcOp op, int32 x, int32 y, int32 *res);
+
+extern Dbg_Error ibc_run(IbcProg const *p, IbcTarget const *t,
+                         Dbg_MCState *state, Dbg_Environment *env,
+                         int32 *result);
+
+#endif
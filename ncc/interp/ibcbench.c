@@ -0,0 +1,328 @@
+/*
+ * interp/ibcbench.c: timing the debugger expression bytecode
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * A host program (make ibcbench) which runs the kind of programs
+ * interp.c compiles for conditional breakpoints against an in-memory
+ * stand-in for the Dbg_MCState target, checks each answer against the
+ * same expression evaluated natively, and reports the time and number
+ * of debug agent requests per evaluation, reading the target directly
+ * and through rdcache.c.  It then counts the requests needed to show
+ * a 1K-element array element by element, as display_expr_a() does.
+ *
+ *   ibcbench [iterations]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ibc.h"
+#include "rdcache.h"
+
+/* The stand-in target: MEMSIZE bytes at MEMBASE, little-endian. */
+
+#define MEMBASE 0x8000
+#define MEMSIZE 0x4000
+
+static unsigned8 mem[MEMSIZE];
+static unsigned long requests;
+
+static bool inrange(ARMaddress addr, int n)
+{
+    return addr >= MEMBASE && addr + n <= MEMBASE + MEMSIZE;
+}
+
+Dbg_Error dbg_ReadWord(Dbg_MCState *state, ARMword *word, ARMaddress addr)
+{
+    unsigned8 *p;
+    requests++;
+    if (!inrange(addr, 4)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    *word = p[0] | p[1] << 8 | p[2] << 16 | (ARMword)p[3] << 24;
+    return Error_OK;
+}
+
+Dbg_Error Dbg_ReadHalf(Dbg_MCState *state, ARMhword *hword, ARMaddress addr)
+{
+    unsigned8 *p;
+    requests++;
+    if (!inrange(addr, 2)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    *hword = (ARMhword)(p[0] | p[1] << 8);
+    return Error_OK;
+}
+
+Dbg_Error dbg_ReadByte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr)
+{
+    requests++;
+    if (!inrange(addr, 1)) return Error_NOK;
+    *byte = mem[addr - MEMBASE];
+    return Error_OK;
+}
+
+Dbg_Error dbg_ReadBytes(Dbg_MCState *state, Dbg_Byte *buf, ARMaddress addr,
+                        unsigned32 n)
+{
+    requests++;
+    if (!inrange(addr, n)) return Error_NOK;
+    memcpy(buf, &mem[addr - MEMBASE], n);
+    return Error_OK;
+}
+
+ARMaddress FPOffset(int32_t offset, Dbg_Environment *env)
+{
+    return (ARMaddress)env->frame.fp + offset;
+}
+
+static void poke(ARMaddress addr, int32 w)
+{
+    unsigned8 *p = &mem[addr - MEMBASE];
+    p[0] = (unsigned8)w; p[1] = (unsigned8)(w >> 8);
+    p[2] = (unsigned8)(w >> 16); p[3] = (unsigned8)(w >> 24);
+}
+
+static int32 peek(ARMaddress addr)
+{
+    unsigned8 *p = &mem[addr - MEMBASE];
+    return (int32)(p[0] | p[1] << 8 | p[2] << 16 | (ARMword)p[3] << 24);
+}
+
+/*
+ * The target program's state:
+ *
+ *   static int n;                         at N_ADDR
+ *   struct node { int value; short flags; struct node *next; } nodes[8];
+ *   int a[64];                            at A_ADDR
+ *   int big[1024];                        at BIG_ADDR
+ *   and, in the current frame, struct node *p at fp-8 and int i at fp-12.
+ */
+
+#define N_ADDR          0x8000
+#define NODES_ADDR      0x8100
+#define NODE_SIZE       12
+#define A_ADDR          0x8400
+#define FP_ADDR         0x8ff0
+#define BIG_ADDR        0x9000
+#define BIG_N           1024
+
+static void settarget(int32 k)
+{
+    int j;
+
+    memset(mem, 0, sizeof(mem));
+    poke(N_ADDR, 150 + (k & 127));
+    for (j = 0; j < 8; j++) {
+        ARMaddress nd = NODES_ADDR + j * NODE_SIZE;
+        poke(nd, j * 10 + (k & 3));
+        mem[nd + 4 - MEMBASE] = (unsigned8)(j & 5);
+        poke(nd + 8, j < 7 ? (int32)(nd + NODE_SIZE) : 0);
+    }
+    for (j = 0; j < 64; j++)
+        poke(A_ADDR + 4 * j, (j * 37 + k) % 101 - 50);
+    poke(FP_ADDR - 8, NODES_ADDR + (k & 7) * NODE_SIZE);
+    poke(FP_ADDR - 12, k & 63);
+    for (j = 0; j < BIG_N; j++)
+        poke(BIG_ADDR + 4 * j, j ^ k);
+}
+
+static int16_t flags(ARMaddress nd)
+{
+    return (int16_t)(mem[nd + 4 - MEMBASE] | mem[nd + 5 - MEMBASE] << 8);
+}
+
+/* n > 100 && (nodes[3].flags & 4) != 0 */
+static void build_a(IbcBuild *bc)
+{
+    int32 at;
+
+    ibc_emit(bc, IBC_LDW, 0, IBC_NOREG, 0, N_ADDR);
+    ibc_emit(bc, IBC_GT, 0, 0, IBC_NOREG, 100);
+    at = ibc_emit(bc, IBC_JZ, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_LDSH, 0, IBC_NOREG, 0, NODES_ADDR + 3 * NODE_SIZE + 4);
+    ibc_emit(bc, IBC_AND, 0, 0, IBC_NOREG, 4);
+    ibc_emit(bc, IBC_NE, 0, 0, IBC_NOREG, 0);
+    ibc_emit(bc, IBC_TEST, 0, 0, IBC_NOREG, 0);
+    ibc_patch(bc, at);
+    ibc_emit(bc, IBC_RET, 0, 0, 0, 0);
+}
+
+static int32 native_a(void)
+{
+    return peek(N_ADDR) > 100 &&
+           (flags(NODES_ADDR + 3 * NODE_SIZE) & 4) != 0;
+}
+
+/* p->next != 0 && p->next->value == p->value + 10 */
+static void build_b(IbcBuild *bc)
+{
+    int32 at;
+
+    ibc_emit(bc, IBC_FPADDR, 0, 0, 0, -8);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 8);
+    ibc_emit(bc, IBC_NE, 0, 0, IBC_NOREG, 0);
+    at = ibc_emit(bc, IBC_JZ, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_FPADDR, 0, 0, 0, -8);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 8);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_FPADDR, 1, 0, 0, -8);
+    ibc_emit(bc, IBC_LDW, 1, 1, 0, 0);
+    ibc_emit(bc, IBC_LDW, 1, 1, 0, 0);
+    ibc_emit(bc, IBC_ADD, 1, 1, IBC_NOREG, 10);
+    ibc_emit(bc, IBC_EQ, 0, 0, 1, 0);
+    ibc_emit(bc, IBC_TEST, 0, 0, IBC_NOREG, 0);
+    ibc_patch(bc, at);
+    ibc_emit(bc, IBC_RET, 0, 0, 0, 0);
+}
+
+static int32 native_b(void)
+{
+    ARMaddress p = (ARMaddress)peek(FP_ADDR - 8);
+    ARMaddress q = (ARMaddress)peek(p + 8);
+    return q != 0 && peek(q) == peek(p) + 10;
+}
+
+/* a[i] + a[i+1] < 0 ? i * 3 : a[i] % 7 */
+static void build_c(IbcBuild *bc)
+{
+    int32 at, at2;
+
+    ibc_emit(bc, IBC_FPADDR, 0, 0, 0, -12);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_MUL, 0, 0, IBC_NOREG, 4);
+    ibc_emit(bc, IBC_ADD, 0, 0, IBC_NOREG, A_ADDR);
+    ibc_emit(bc, IBC_LDW, 1, 0, 0, 4);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_ADD, 0, 0, 1, 0);
+    ibc_emit(bc, IBC_LT, 0, 0, IBC_NOREG, 0);
+    at = ibc_emit(bc, IBC_JZ, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_FPADDR, 0, 0, 0, -12);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_MUL, 0, 0, IBC_NOREG, 3);
+    at2 = ibc_emit(bc, IBC_JMP, 0, 0, 0, 0);
+    ibc_patch(bc, at);
+    ibc_emit(bc, IBC_FPADDR, 0, 0, 0, -12);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, 0);
+    ibc_emit(bc, IBC_MUL, 0, 0, IBC_NOREG, 4);
+    ibc_emit(bc, IBC_LDW, 0, 0, 0, A_ADDR);
+    ibc_emit(bc, IBC_REM, 0, 0, IBC_NOREG, 7);
+    ibc_patch(bc, at2);
+    ibc_emit(bc, IBC_RET, 0, 0, 0, 0);
+}
+
+static int32 native_c(void)
+{
+    int32 i = peek(FP_ADDR - 12);
+    int32 x = peek(A_ADDR + 4 * i), y = peek(A_ADDR + 4 * i + 4);
+    return x + y < 0 ? i * 3 : x % 7;
+}
+
+typedef struct Bench {
+    char const *name;
+    void (*build)(IbcBuild *);
+    int32 (*native)(void);
+} Bench;
+
+static Bench const benches[] = {
+    { "static and field test", build_a, native_a },
+    { "pointer chase", build_b, native_b },
+    { "array conditional", build_c, native_c }
+};
+
+#define NSETUPS 16
+
+static IbcTarget const direct = { dbg_ReadWord, Dbg_ReadHalf, dbg_ReadByte };
+static IbcTarget const cached = {
+    rdcache_readword, rdcache_readhalf, rdcache_readbyte
+};
+
+/* Reads big[] a word at a time; returns the number of requests made. */
+static unsigned long show_big(Dbg_MCState *state, bool usecache, int *failed)
+{
+    ARMword w;
+    int32 j;
+
+    requests = 0;
+    if (usecache) {
+        rdcache_flush();
+        rdcache_prefetch(state, BIG_ADDR, 4 * BIG_N);
+    }
+    for (j = 0; j < BIG_N; j++) {
+        if ((usecache ? rdcache_readword(state, &w, BIG_ADDR + 4 * j) :
+                        dbg_ReadWord(state, &w, BIG_ADDR + 4 * j)) != Error_OK ||
+                w != (ARMword)(j ^ 5))
+            *failed = 1;
+    }
+    return requests;
+}
+
+int main(int argc, char **argv)
+{
+    static IbcBuild bc;
+    Dbg_MCState state;
+    Dbg_Environment env;
+    unsigned long n = argc > 1 ? strtoul(argv[1], NULL, 10) : 1000000;
+    unsigned long j;
+    size_t b;
+    int failed = 0;
+    int usecache;
+
+    memset(&state, 0, sizeof(state));
+    memset(&env, 0, sizeof(env));
+    env.frame.fp = (void *)FP_ADDR;
+    rdcache_init(YES);
+    for (b = 0; b < sizeof(benches)/sizeof(benches[0]); b++)
+      for (usecache = 0; usecache <= 1; usecache++) {
+        IbcTarget const *target = usecache ? &cached : &direct;
+        IbcProg *p;
+        int32 expect[NSETUPS], res;
+        clock_t t0, t1;
+        int32 k;
+
+        ibc_start(&bc);
+        benches[b].build(&bc);
+        p = (IbcProg *)malloc(ibc_progsize_(bc.ninsns));
+        ibc_finish(&bc, p);
+
+        for (k = 0; k < NSETUPS; k++) {
+            settarget(k);
+            rdcache_flush();
+            expect[k] = benches[b].native();
+            if (ibc_run(p, target, &state, &env, &res) != Error_OK ||
+                    res != expect[k]) {
+                fprintf(stderr, "%s: setup %ld gives %ld, expected %ld\n",
+                        benches[b].name, (long)k, (long)res, (long)expect[k]);
+                failed = 1;
+            }
+        }
+
+        /* The breakpoint is hit repeatedly; each hit is a fresh stop. */
+        settarget(5);
+        requests = 0;
+        t0 = clock();
+        for (j = 0; j < n; j++) {
+            if (usecache) rdcache_flush();
+            if (ibc_run(p, target, &state, &env, &res) != Error_OK ||
+                    res != expect[5])
+                failed = 1;
+        }
+        t1 = clock();
+        printf("%-24s %-6s %2ld insns  %6.1f ns/eval  %5.2f requests/eval\n",
+               benches[b].name, usecache ? "cached" : "direct", (long)p->ninsns,
+               n ? (double)(t1 - t0) / CLOCKS_PER_SEC * 1e9 / n : 0.0,
+               n ? (double)requests / n : 0.0);
+        free(p);
+    }
+
+    settarget(5);
+    printf("%-24s direct %5lu requests\n", "show int[1024]",
+           show_big(&state, NO, &failed));
+    printf("%-24s cached %5lu requests\n", "show int[1024]",
+           show_big(&state, YES, &failed));
+    return failed;
+}
@@ -28,6 +28,11 @@
 #include "store.h"
 #include "simplify.h"
 #include "util.h"
+#include "vargen.h"
+#include "cg.h"
+#include "mcdep.h"
+#include "compiler.h"
+#include "dump.h"
 #ifdef USE_PP
 #include "pp.h"
 #endif
@@ -35,6 +40,9 @@
 #include "asdfmt.h"
 #include "dbg_hdr.h"
 #include "dbg_tbl.h"
+#include "ibc.h"
+#include "rdcache.h"
+#include "interp.h"
 
 #ifndef USE_PP
 /* Dummy definitions for stuff in cfe/pp.c */
@@ -48,7 +56,6 @@ FILE *asmstream, *objstream;
 int32 config;
 char *expr_string;
 
-extern int curchar;
 extern Expr *rd_expr(int n);
 
 static Dbg_MCState *cc_dbg_state;
@@ -78,7 +85,7 @@ static Dbg_Error readword(Dbg_MCState *state, ARMword *word, ARMaddress addr)
         *word = *(ARMword *)(addr & ~b_dbgaddr);
         return 0;
     } else {
-        return dbg_ReadWord(state, word, addr);
+        return rdcache_readword(state, word, addr);
     }
 }
 
@@ -88,6 +95,7 @@ static Dbg_Error writeword(Dbg_MCState *state, ARMaddress addr, ARMword word)
         *(ARMword *)(addr & ~b_dbgaddr) = word;
         return 0;
     } else {
+        rdcache_written(addr, sizeof(ARMword));
         return dbg_WriteWord(state, addr, word);
     }
 }
@@ -98,7 +106,7 @@ static Dbg_Error readhalf(Dbg_MCState *state, ARMhword *hword, ARMaddress addr)
         *hword = *(ARMhword *)(addr & ~b_dbgaddr);
         return 0;
     } else {
-        return Dbg_ReadHalf(state, hword, addr);
+        return rdcache_readhalf(state, hword, addr);
     }
 }
 
@@ -108,6 +116,7 @@ static Dbg_Error writehalf(Dbg_MCState *state, ARMaddress addr, ARMhword hword)
         *(ARMhword *)(addr & ~b_dbgaddr) = hword;
         return 0;
     } else {
+        rdcache_written(addr, sizeof(ARMhword));
         return Dbg_WriteHalf(state, addr, hword);
     }
 }
@@ -118,7 +127,7 @@ static Dbg_Error readbyte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr)
         *byte = *(Dbg_Byte *)(addr & ~b_dbgaddr);
         return 0;
     } else {
-        return dbg_ReadByte(state, byte, addr);
+        return rdcache_readbyte(state, byte, addr);
     }
 }
 
@@ -128,6 +137,7 @@ static Dbg_Error writebyte(Dbg_MCState *state, ARMaddress addr, Dbg_Byte byte)
         *(Dbg_Byte *)(addr & ~b_dbgaddr) = byte;
         return 0;
     } else {
+        rdcache_written(addr, sizeof(Dbg_Byte));
         return dbg_WriteByte(state, addr, byte);
     }
 }
@@ -177,6 +187,9 @@ static void eval_error(char *s, ...)
 }
 
 extern Expr *eval_expr(Expr *e);
+static bool ibc_scalar(int32 m);
+static IbcOp ibc_narrowop(int32 m);
+static IbcOp ibc_binop(Expr *e);
 
 static int32 read_with_mcrep(ARMaddress a, int32 m)
 {
@@ -326,6 +339,7 @@ Expr *eval_expr(Expr *e)
             if (!(addr & b_dbgaddr)) {
                 if (Dbg_CallNaturalSize(cc_dbg_state, addr, argw, args) != ps_callreturned)
                     eval_error("Call to function $e did not return normally", e1);
+                rdcache_flush();        /* the target has run the call */
                 if (structresult) {
                     b = mk_binder(gensymval(0), bitofstg_(s_static), t);
                     bindaddr_(b) = (IPtr)structresult;
@@ -415,6 +429,8 @@ Expr *eval_expr(Expr *e)
             }
             return e;
         case s_dot:
+            if (isbitfield_type(type_(e)))
+                eval_error("Cannot evaluate $e", e);
             e1 = mk_expr1(s_addrof, te_int, e1);
             x = eval_expr(e1);
             if (h0_(x) != s_integer)
@@ -437,12 +453,30 @@ Expr *eval_expr(Expr *e)
             }
             return (Expr *)b;
         case s_cast:
-            return eval_expr(e1);
+            x = eval_expr(e1);
+            m = mcrepofexpr(e);
+            if (x && h0_(x) == s_integer && ibc_scalar(m) &&
+                    ibc_narrowop(m) != IBC_MOV) {
+                ibc_arith(ibc_narrowop(m), intval_(x), 0, &i1);
+                return mkintconst(typeofexpr(e), i1, 0);
+            }
+            return x;
         case s_string:
             return mkintconst(te_charptr, mk_string((String *)e), 0);
         case s_integer:
         case s_boolean:
             return e;
+        case s_andand:
+        case s_oror:
+            x = eval_expr(e1);
+            if (h0_(x) != s_integer)
+                eval_error("Cannot evaluate $e", e1);
+            if ((intval_(x) != 0) == (op == s_andand)) {
+                x = eval_expr(e2);
+                if (h0_(x) != s_integer)
+                    eval_error("Cannot evaluate $e", e2);
+            }
+            return mkintconst(typeofexpr(e), intval_(x) != 0, 0);
         case s_plus:
         case s_minus:
         case s_times:
@@ -451,8 +485,6 @@ Expr *eval_expr(Expr *e)
         case s_and:
         case s_or:
         case s_xor:
-        case s_andand:
-        case s_oror:
         case s_leftshift:
         case s_rightshift:
         case s_equalequal:
@@ -474,50 +506,19 @@ Expr *eval_expr(Expr *e)
                     eval_error("Cannot evaluate $e", e1);
                 i1 = intval_(x);
                 switch (op) {
-                    case s_plus:
-                        i1 = i1+i2; break;
-                    case s_minus:
-                        i1 = i1-i2; break;
-                    case s_times:
-                        i1 = i1*i2; break;
-                    case s_div:
-                        i1 = i1/i2; break;
-                    case s_rem:
-                        i1 = i1%i2; break;
-                    case s_and:
-                        i1 = i1&i2; break;
-                    case s_or:
-                        i1 = i1|i2; break;
-                    case s_xor:
-                        i1 = i1^i2; break;
-                    case s_andand:
-                        i1 = i1&&i2; break;
-                    case s_oror:
-                        i1 = i1||i2; break;
-                    case s_leftshift:
-                        i1 = i1<<i2; break;
-                    case s_rightshift:
-                        i1 = i1>>i2; break;
-                    case s_equalequal:
-                        i1 = i1==i2; break;
-                    case s_notequal:
-                        i1 = i1!=i2; break;
-                    case s_less:
-                        i1 = i1<i2; break;
-                    case s_lessequal:
-                        i1 = i1<=i2; break;
-                    case s_greater:
-                        i1 = i1>i2; break;
-                    case s_greaterequal:
-                        i1 = i1>=i2; break;
                     case s_monplus:
-                        i1 = i1; break;
+                        break;
                     case s_neg:
-                        i1 = -i1; break;
+                        ibc_arith(IBC_NEG, i1, 0, &i1); break;
                     case s_bitnot:
                         i1 = ~i1; break;
                     case s_boolnot:
                         i1 = !i1; break;
+                    default:
+                        /* as the bytecode would do it (see ibc_binop()) */
+                        if (!ibc_arith(ibc_binop(e), i1, i2, &i1))
+                            eval_error("Cannot evaluate $e", e);
+                        break;
                 }
                 return mkintconst(typeofexpr(e), i1, 0);
         default:
@@ -627,21 +628,273 @@ static void display_expr(Expr *e, TypeExpr *t, char *format, int indent)
     x = eval_expr(x);
     if (h0_(x) != s_integer)
         eval_error("Cannot take address of $e", e);
+    /* An aggregate is read field by field: fetch it all in one request. */
+    if (!(intval_(x) & b_dbgaddr) &&
+            (h0_(t) == t_subscript || (h0_(t) == s_typespec &&
+             (typespecmap_(t) & CLASSBITS))))
+        rdcache_prefetch(cc_dbg_state, intval_(x), sizeoftype(t));
     display_expr_a(intval_(x), t, format, indent);
 }
 
-void cc_rd_expr(Dbg_MCState *state, Dbg_Environment *env, char *s, char *format)
+/*
+ * Expressions which are evaluated repeatedly (conditional breakpoints,
+ * watches) are parsed once by cc_compile_expr().  If the expression is
+ * side effect free integer arithmetic on target memory it is also
+ * compiled to bytecode (ibc.h), which cc_eval_compiled() then runs on
+ * each hit without re-reading or re-walking the tree.  Anything else
+ * (calls, assignments, register variables, interpreter locals, floating
+ * point, structure values) falls back to eval_expr().
+ *
+ * Integers wrap and shifts behave as the target's registers do, and a
+ * division by zero is refused rather than done; eval_expr() shares the
+ * arithmetic (ibc_arith()) so that the two agree, and evaluates && and
+ * || with C's short-circuit too.  Bit field reads reach here already
+ * expanded to shifts of the containing word.
+ *
+ * cc_rd_expr() parses through cc_compile_expr() too, and displays what
+ * the bytecode gives, walking the tree only when there is none.
+ */
+
+struct CompiledExpr {
+    Expr *e;
+    TypeExpr *type;
+    IbcProg *prog;              /* 0 if e is evaluated by eval_expr() */
+};
+
+static IbcTarget const ibc_target = { readword, readhalf, readbyte };
+static IbcBuild ibc_build;
+static jmp_buf ibc_reject;
+
+static bool ibc_scalar(int32 m)
 {
-    Expr *e, *x;
-    int32 i;
-    TypeExpr *t;
-    int32 spoffset;
-    Expr *edtor;
+    return ((m & MCR_SORT_MASK) == MCR_SORT_SIGNED ||
+            (m & MCR_SORT_MASK) == MCR_SORT_UNSIGNED) &&
+           (m & MCR_SIZE_MASK) <= sizeof(ARMword);
+}
+
+/* The instruction which reduces an int32 to a value of sort m, or      */
+/* IBC_MOV if there is nothing to do.                                    */
+static IbcOp ibc_narrowop(int32 m)
+{
+    bool sgn = (m & MCR_SORT_MASK) == MCR_SORT_SIGNED;
+
+    switch (m & MCR_SIZE_MASK) {
+        case sizeof(ARMhword):
+            return sgn ? IBC_EXTSH : IBC_EXTH;
+        case sizeof(Dbg_Byte):
+            return sgn ? IBC_EXTSB : IBC_EXTB;
+    }
+    return IBC_MOV;
+}
+
+static void ibc_expr(Expr *e, int r);
+
+static void ibc_load(int r, int base, int32 k, int32 m)
+{
+    IbcOp op;
+    bool sgn = (m & MCR_SORT_MASK) == MCR_SORT_SIGNED;
+
+    switch (m & MCR_SIZE_MASK) {
+        case sizeof(ARMword):
+            op = IBC_LDW; break;
+        case sizeof(ARMhword):
+            op = sgn ? IBC_LDSH : IBC_LDH; break;
+        case sizeof(Dbg_Byte):
+            op = sgn ? IBC_LDSB : IBC_LDB; break;
+        default:
+            longjmp(ibc_reject, 1);
+    }
+    ibc_emit(&ibc_build, op, r, base, 0, k);
+}
+
+/* Compiles the address of lvalue e, as base register (r or IBC_NOREG)  */
+/* plus the offset returned in *k.                                       */
+static int ibc_addr(Expr *e, int r, int32 *k)
+{
+    Binder *b;
+    int base;
+
+    switch (h0_(e)) {
+        case s_binder:
+            b = (Binder *)e;
+            if (bindstg_(b) & b_undef) break;       /* let define() complain */
+            if (bindstg_(b) & (bitofstg_(s_static) | bitofstg_(s_extern))) {
+                *k = bindaddr_(b);
+                return IBC_NOREG;
+            }
+            /* Target locals: the frame may differ from hit to hit.  Locals */
+            /* of interpreted code live on our own stack and are not seen.  */
+            if ((bindstg_(b) & bitofstg_(s_auto)) && !(bindaddr_(b) & b_dbgaddr)) {
+                ibc_emit(&ibc_build, IBC_FPADDR, r, 0, 0, bindxx_(b));
+                *k = 0;
+                return r;
+            }
+            break;
+        case s_content:
+            ibc_expr(arg1_(e), r);
+            *k = 0;
+            return r;
+        case s_dot:
+            base = ibc_addr(arg1_(e), r, k);
+            *k += exprdotoff_(e);
+            return base;
+    }
+    longjmp(ibc_reject, 1);
+    return 0;
+}
+
+/* The instruction for binary expression e, or IBC_RET if there is     */
+/* none.  Division, right shift and the comparisons are unsigned if the  */
+/* (already balanced) left operand is unsigned or a pointer.             */
+static IbcOp ibc_binop(Expr *e)
+{
+    IbcOp op;
+
+    switch (h0_(e)) {
+        case s_plus:            return IBC_ADD;
+        case s_minus:           return IBC_SUB;
+        case s_times:           return IBC_MUL;
+        case s_and:             return IBC_AND;
+        case s_or:              return IBC_OR;
+        case s_xor:             return IBC_XOR;
+        case s_leftshift:       return IBC_SHL;
+        case s_equalequal:      return IBC_EQ;
+        case s_notequal:        return IBC_NE;
+        case s_div:             op = IBC_DIV; break;
+        case s_rem:             op = IBC_REM; break;
+        case s_rightshift:      op = IBC_SHR; break;
+        case s_less:            op = IBC_LT; break;
+        case s_lessequal:       op = IBC_LE; break;
+        case s_greater:         op = IBC_GT; break;
+        case s_greaterequal:    op = IBC_GE; break;
+        default:                return IBC_RET;
+    }
+    if ((mcrepofexpr(arg1_(e)) & MCR_SORT_MASK) == MCR_SORT_UNSIGNED)
+        op = (IbcOp)(op + (IBC_DIVU - IBC_DIV));
+    return op;
+}
+
+/* Compiles e so that its value ends up in register r.  Registers above  */
+/* r are free for temporaries.                                           */
+static void ibc_expr(Expr *e, int r)
+{
+    Expr *e1, *e2;
+    int32 k, at, at2;
+    int base;
+    IbcOp op;
+
+    if (r >= IBC_NREGS) longjmp(ibc_reject, 1);
+    e1 = arg1_(e);
+    e2 = arg2_(e);
+    switch (h0_(e)) {
+        case s_integer:
+        case s_boolean:
+            ibc_emit(&ibc_build, IBC_CONST, r, 0, 0, intval_(e));
+            return;
+        case s_invisible:
+            ibc_expr(e2, r);
+            return;
+        case s_cast:
+            if (!ibc_scalar(mcrepofexpr(e))) break;
+            ibc_expr(e1, r);
+            op = ibc_narrowop(mcrepofexpr(e));
+            if (op != IBC_MOV) ibc_emit(&ibc_build, op, r, r, IBC_NOREG, 0);
+            return;
+        case s_monplus:
+            ibc_expr(e1, r);
+            return;
+        case s_comma:
+            ibc_expr(e1, r);
+            ibc_expr(e2, r);
+            return;
+        case s_binder:
+        case s_content:
+        case s_dot:
+            /* bit field values are shifts of the container by now */
+            if (h0_(e) == s_dot && isbitfield_type(type_(e))) break;
+            if (!ibc_scalar(mcrepofexpr(e))) break;
+            base = ibc_addr(e, r, &k);
+            ibc_load(r, base, k, mcrepofexpr(e));
+            return;
+        case s_addrof:
+            base = ibc_addr(e1, r, &k);
+            if (base == IBC_NOREG)
+                ibc_emit(&ibc_build, IBC_CONST, r, 0, 0, k);
+            else if (k != 0)
+                ibc_emit(&ibc_build, IBC_ADD, r, base, IBC_NOREG, k);
+            return;
+        case s_cond:
+            ibc_expr(e1, r);
+            at = ibc_emit(&ibc_build, IBC_JZ, r, 0, 0, 0);
+            ibc_expr(e2, r);
+            at2 = ibc_emit(&ibc_build, IBC_JMP, 0, 0, 0, 0);
+            ibc_patch(&ibc_build, at);
+            ibc_expr(arg3_(e), r);
+            ibc_patch(&ibc_build, at2);
+            return;
+        case s_andand:
+            ibc_expr(e1, r);
+            at = ibc_emit(&ibc_build, IBC_JZ, r, 0, 0, 0);
+            ibc_expr(e2, r);
+            ibc_emit(&ibc_build, IBC_TEST, r, r, IBC_NOREG, 0);
+            ibc_patch(&ibc_build, at);
+            return;
+        case s_oror:
+            ibc_expr(e1, r);
+            ibc_emit(&ibc_build, IBC_TEST, r, r, IBC_NOREG, 0);
+            at = ibc_emit(&ibc_build, IBC_JNZ, r, 0, 0, 0);
+            ibc_expr(e2, r);
+            ibc_emit(&ibc_build, IBC_TEST, r, r, IBC_NOREG, 0);
+            ibc_patch(&ibc_build, at);
+            return;
+        case s_neg:
+        case s_bitnot:
+        case s_boolnot:
+            ibc_expr(e1, r);
+            op = h0_(e) == s_neg ? IBC_NEG :
+                 h0_(e) == s_bitnot ? IBC_NOT : IBC_BOOLNOT;
+            ibc_emit(&ibc_build, op, r, r, IBC_NOREG, 0);
+            return;
+        default:
+            op = ibc_binop(e);
+            if (op == IBC_RET) break;
+            ibc_expr(e1, r);
+            if (h0_(e2) == s_integer)
+                ibc_emit(&ibc_build, op, r, r, IBC_NOREG, intval_(e2));
+            else {
+                ibc_expr(e2, r+1);
+                ibc_emit(&ibc_build, op, r, r, r+1, 0);
+            }
+            return;
+    }
+    longjmp(ibc_reject, 1);
+}
+
+static IbcProg *ibc_compile(Expr *e)
+{
+    IbcProg *p;
+
+    if (!ibc_scalar(mcrepofexpr(e))) return 0;
+    if (setjmp(ibc_reject) != 0) return 0;
+    ibc_start(&ibc_build);
+    ibc_expr(e, 0);
+    ibc_emit(&ibc_build, IBC_RET, 0, 0, 0, 0);
+    if (ibc_build.overflow) return 0;
+    p = (IbcProg *)GlobAlloc(SU_Other, ibc_progsize_(ibc_build.ninsns));
+    ibc_finish(&ibc_build, p);
+    return p;
+}
+
+CompiledExpr *cc_compile_expr(Dbg_MCState *state, Dbg_Environment *env, char *s)
+{
+    Expr *e;
+    CompiledExpr *c = 0;
 
     cc_dbg_state = state;
     cc_dbg_env = env;
+    rdcache_flush();            /* the target may have run since last time */
     expr_string = s;
-    curchar = 0;
+    lex_reinit();
 #ifdef USE_PP
     pp_notesource("<expr>", NULL, false);
 #endif
@@ -650,27 +903,95 @@ void cc_rd_expr(Dbg_MCState *state, Dbg_Environment *env, char *s, char *format)
         push_exprtemp_scope();
         e = rd_expr(10/*PASTCOMMA*/);
         if (e && h0_(e) != s_error) {
+            /* as a value, a bit field is shifts of its container */
+            if (isbitfield_type(typeofexpr(e))) e = coerceunary(e);
             e = optimise0(e);
-            sp = stack + STACKSIZE;
-            max_spoffset = 0;
-            inst_exprdecls(e, 0);
-            spoffset = max_spoffset;
-            sp = adjust_sp(spoffset);
-            x = eval_expr(e);
-            pr_expr(e);
-            if (x) {
-                t = typeofexpr(x);
-                cc_msg(" = [");
-                pr_typeexpr(t, 0);
-                cc_msg("] ");
-                display_expr(x, t, format, 0);
-            } else
-                cc_msg("void");
-            sp = adjust_sp(-spoffset);
-            cc_msg("\n");
+            c = (CompiledExpr *)GlobAlloc(SU_Other, sizeof(CompiledExpr));
+            c->e = e;
+            c->type = typeofexpr(e);
+            c->prog = ibc_compile(e);
         }
     }
-    return;
+    return c;
+}
+
+/* Walks c->e with room for its temporaries, which the caller frees   */
+/* with adjust_sp(-*spoffset) once it has finished with the value.      */
+static Expr *eval_tree(CompiledExpr *c, int32 *spoffset)
+{
+    sp = stack + STACKSIZE;
+    max_spoffset = 0;
+    inst_exprdecls(c->e, 0);
+    *spoffset = max_spoffset;
+    sp = adjust_sp(*spoffset);
+    return eval_expr(c->e);
+}
+
+Dbg_Error cc_eval_compiled(Dbg_MCState *state, Dbg_Environment *env,
+                           CompiledExpr *c, int32 *result)
+{
+    cc_dbg_state = state;
+    cc_dbg_env = env;
+    rdcache_flush();            /* the target may have run since last time */
+    if (c->prog) {
+        if ((c->prog->flags & IBCF_FRAME) &&
+                dbg_FindActivation(state, env) != Error_OK)
+            return Error_NOK;
+        return ibc_run(c->prog, &ibc_target, state, env, result);
+    }
+    return cc_eval_tree(state, env, c, result);
+}
+
+Dbg_Error cc_eval_tree(Dbg_MCState *state, Dbg_Environment *env,
+                       CompiledExpr *c, int32 *result)
+{
+    Expr *x;
+    int32 spoffset;
+
+    cc_dbg_state = state;
+    cc_dbg_env = env;
+    rdcache_flush();
+    if (setjmp(eval_recover) != 0) return Error_NOK;
+    x = eval_tree(c, &spoffset);
+    sp = adjust_sp(-spoffset);
+    if (!x || h0_(x) != s_integer) return Error_NOK;
+    *result = intval_(x);
+    return Error_OK;
+}
+
+int32 cc_compiled_insns(CompiledExpr *c)
+{
+    return c->prog ? c->prog->ninsns : 0;
+}
+
+void cc_rd_expr(Dbg_MCState *state, Dbg_Environment *env, char *s, char *format)
+{
+    CompiledExpr *c;
+    Expr *x;
+    TypeExpr *t;
+    int32 spoffset = 0, n;
+
+    c = cc_compile_expr(state, env, s);
+    if (c == 0) return;
+    if (setjmp(eval_recover) == 0) {
+        if (c->prog) {
+            if (cc_eval_compiled(state, env, c, &n) != Error_OK)
+                eval_error("Cannot evaluate $e", c->e);
+            x = mkintconst(c->type, n, 0);
+        } else
+            x = eval_tree(c, &spoffset);
+        pr_expr(c->e);
+        if (x) {
+            t = typeofexpr(x);
+            cc_msg(" = [");
+            pr_typeexpr(t, 0);
+            cc_msg("] ");
+            display_expr(x, t, format, 0);
+        } else
+            cc_msg("void");
+        sp = adjust_sp(-spoffset);
+        cc_msg("\n");
+    }
 }
 
 static void inst_exprdecls(Expr *e, int32 spoffset)
@@ -954,8 +1275,9 @@ Dbg_Error cc_rd_topdecl(Dbg_MCState *state, Dbg_Environment *env, char *s)
 
     cc_dbg_state = state;
     cc_dbg_env = env;
+    rdcache_flush();            /* the target may have run since last time */
     expr_string = 0;
-    curchar = 0;
+    lex_reinit();
 #ifdef USE_PP
     while (isspace(*s)) s++;
     if (*s) {
@@ -983,9 +1305,7 @@ Dbg_Error cc_rd_topdecl(Dbg_MCState *state, Dbg_Environment *env, char *s)
             t->v_f.fn.structresult = currentfunction.structresult;
         }
     }
-#ifdef USE_PP
-    if (f != stdin) fclose(f);
-#endif
+    /* pp closed f at its end */
     return 0;
 }
 
@@ -1229,6 +1549,7 @@ Symstr *int_sym_lookup(char const *name, int glo)
             if (dbg_FindActivation(cc_dbg_state, cc_dbg_env) != Error_OK)
                 return sym;
             bindaddr_(b) = FPOffset(item->location.offset, cc_dbg_env);
+            bindxx_(b) = (VRegnum)item->location.offset;    /* for ibc */
             break;
         case C_REG:
             bindstg_(b) = bitofstg_(s_register);
@@ -1249,12 +1570,57 @@ void initstaticvar(Binder *b, bool topflag)
 {
 }
 
-void compile_abort(int sig_no)
+int32 vg_ndeferred;
+void vg_reference(Binder *b) {}
+void vg_generate_deferred_const(Binder *b) {}
+void vg_note_vtable(TagBinder *cl, int32 sz, Symstr *name) {}
+Binder *generate_wrapper(Binder *a) { return a; }
+TopDecl *vg_dynamic_init(void) { return 0; }
+void vg_ref_dynamic_init(void) {}
+void vargen_init(void) {}
+
+/* Dummy definitions for the code generator and object code: the front */
+/* end still calls these for the functions and data it sees.            */
+void cg_init(void) {}
+void cg_reinit(void) {}
+void cg_tidy(void) {}
+void cg_topdecl(TopDecl *x, FileLine fl) {}
+Expr *rd_asm_decl(void) { return 0; }
+
+int32 codebase, codep;
+DataAreaSort SetDataArea(DataAreaSort s) { return DS_ReadWrite; }
+DataInit *get_datadesc_ht(bool head) { return 0; }
+void set_datadesc_ht(bool head, DataInit *val) {}
+int32 get_datadesc_size(void) { return 0; }
+void set_datadesc_size(int32 val) {}
+void gendc0(int32 nbytes) {}
+
+/* Dummy definitions for the debug table generator (the debugger has    */
+/* its own tables for the target; interpreted code needs none).         */
+int usrdbgmask;
+void *dbg_notefileline(FileLine fl) { return 0; }
+void dbg_final_src_codeaddr(int32 a, int32 b) {}
+void dbg_finalise(void) {}
+void dbg_type(Symstr *name, TypeExpr *t, FileLine fl) {}
+void dbg_proc(Symstr *name, TypeExpr *t, bool ext, FileLine fl) {}
+void dbg_locvar(Binder *name, FileLine fl) {}
+void dbg_define(char const *name, bool objectmacro, char const *body,
+                dbg_ArgList const *args, FileLine fl) {}
+void dbg_undef(char const *name, FileLine fl) {}
+void dbg_include(char const *filename, char const *path, FileLine fl) {}
+void dbg_notepath(char const *pathname) {}
+
+/* Dummy definitions for stuff in mip/driver.c */
+static int interp_backchat(void *handle, unsigned code, void const *msg)
 {
-    /* May be a bit unfriendly for an interactive program */
-    exit(1);
+    return 0;                   /* diagnostics go to errors */
 }
 
+BackChatHandler backchat = { interp_backchat, NULL };
+unsigned dump_state;
+int toolenv_insertdefaults(ToolEnv *t) { return 0; }
+void compiler_exit(int status) {}
+
 #ifndef USE_PP
 int pp_nextchar(void)
 {
@@ -1268,7 +1634,7 @@ int pp_nextchar(void)
 }
 #endif
 
-extern void cc_init(void)
+void cc_init(void)
 {
     int i;
 
@@ -1279,9 +1645,11 @@ extern void cc_init(void)
     ClearFeatures3(Feature_PCC, Feature_CPP, Feature_CFront);
 #endif
     expr_string = "";
+    errors = stderr;            /* there is no backchat to a driver */
     errstate_initialise();
     aetree_init();
     alloc_initialise();
+    alloc_perfileinit();
 #ifndef USE_PP
     for (i = 0; i <= 'z'-'a'; i++)
         pp_pragmavec[i] = -1;
@@ -1290,6 +1658,7 @@ extern void cc_init(void)
     pp_init(&curlex.fl);
 #endif
     var_cc_private_flags = 0;
+    rdcache_init(target_lsbytefirst);
     bind_init();
     lex_init();
     builtin_init();
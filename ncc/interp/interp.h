@@ -0,0 +1,39 @@
+/*
+ * interp/interp.h: the interpreter's interface to a debugger
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * The debugger calls cc_init() once, and may then read declarations
+ * and function definitions with cc_rd_topdecl() and evaluate and display
+ * expressions with cc_rd_expr().  An expression which is to be evaluated
+ * many times (say a breakpoint condition) is parsed once by
+ * cc_compile_expr() and then evaluated by cc_eval_compiled(), which runs
+ * its bytecode if it has any.  cc_eval_tree() always walks the tree, so
+ * that the two can be checked against each other (see npp.c).
+ */
+
+#ifndef _interp_h
+#define _interp_h
+
+#include "host.h"
+#include "asdfmt.h"
+#include "dbg_hdr.h"
+
+typedef struct CompiledExpr CompiledExpr;
+
+extern void cc_init(void);
+extern void cc_rd_expr(Dbg_MCState *state, Dbg_Environment *env, char *s, char *format);
+extern Dbg_Error cc_rd_topdecl(Dbg_MCState *state, Dbg_Environment *env, char *s);
+
+/* Returns 0 if s does not parse. */
+extern CompiledExpr *cc_compile_expr(Dbg_MCState *state, Dbg_Environment *env, char *s);
+extern Dbg_Error cc_eval_compiled(Dbg_MCState *state, Dbg_Environment *env,
+                                  CompiledExpr *c, int32 *result);
+extern Dbg_Error cc_eval_tree(Dbg_MCState *state, Dbg_Environment *env,
+                              CompiledExpr *c, int32 *result);
+
+/* The length of c's bytecode, or 0 if it has none. */
+extern int32 cc_compiled_insns(CompiledExpr *c);
+
+#endif
@@ -0,0 +1,218 @@
+/*
+ * interp/npp.c: a host driver for the interpreter
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * The interpreter (make interp) is normally part of a debugger, which
+ * supplies the dbg_ functions of dbg_hdr.h.  This driver supplies them
+ * for an in-memory stand-in target instead, so that expressions can be
+ * evaluated without one:
+ *
+ *   npp file
+ *
+ * reads the declarations in file (cc_rd_topdecl()), then obeys the
+ * comment lines in it of the form
+ *
+ *   // SET: addr word          store a word in the target
+ *   // EVAL: expr              evaluate expr
+ *   // PRINT: expr             display expr as the debugger would
+ *
+ * Each EVAL expression is evaluated both by its bytecode and by walking
+ * its tree (cc_eval_tree()), and the two must agree.  The target has no
+ * symbols, frames or functions, so expressions name target memory by
+ * address, e.g. *(unsigned char *)0x8003.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "globals.h"
+#include "interp.h"
+
+/* The stand-in target: MEMSIZE bytes at MEMBASE, little-endian. */
+
+#define MEMBASE 0x8000
+#define MEMSIZE 0x4000
+
+static unsigned8 mem[MEMSIZE];
+
+static bool inrange(ARMaddress addr, unsigned32 n)
+{
+    return addr >= MEMBASE && addr + n <= MEMBASE + MEMSIZE;
+}
+
+Dbg_Error dbg_ReadWord(Dbg_MCState *state, ARMword *word, ARMaddress addr)
+{
+    unsigned8 *p;
+    if (!inrange(addr, 4)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    *word = p[0] | p[1] << 8 | p[2] << 16 | (ARMword)p[3] << 24;
+    return Error_OK;
+}
+
+Dbg_Error Dbg_ReadHalf(Dbg_MCState *state, ARMhword *hword, ARMaddress addr)
+{
+    unsigned8 *p;
+    if (!inrange(addr, 2)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    *hword = (ARMhword)(p[0] | p[1] << 8);
+    return Error_OK;
+}
+
+Dbg_Error dbg_ReadByte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr)
+{
+    if (!inrange(addr, 1)) return Error_NOK;
+    *byte = mem[addr - MEMBASE];
+    return Error_OK;
+}
+
+Dbg_Error dbg_ReadBytes(Dbg_MCState *state, Dbg_Byte *buf, ARMaddress addr,
+                        unsigned32 n)
+{
+    if (!inrange(addr, n)) return Error_NOK;
+    memcpy(buf, &mem[addr - MEMBASE], n);
+    return Error_OK;
+}
+
+Dbg_Error dbg_WriteWord(Dbg_MCState *state, ARMaddress addr, ARMword word)
+{
+    unsigned8 *p;
+    if (!inrange(addr, 4)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    p[0] = (unsigned8)word; p[1] = (unsigned8)(word >> 8);
+    p[2] = (unsigned8)(word >> 16); p[3] = (unsigned8)(word >> 24);
+    return Error_OK;
+}
+
+Dbg_Error Dbg_WriteHalf(Dbg_MCState *state, ARMaddress addr, ARMhword hword)
+{
+    unsigned8 *p;
+    if (!inrange(addr, 2)) return Error_NOK;
+    p = &mem[addr - MEMBASE];
+    p[0] = (unsigned8)hword; p[1] = (unsigned8)(hword >> 8);
+    return Error_OK;
+}
+
+Dbg_Error dbg_WriteByte(Dbg_MCState *state, ARMaddress addr, Dbg_Byte byte)
+{
+    if (!inrange(addr, 1)) return Error_NOK;
+    mem[addr - MEMBASE] = byte;
+    return Error_OK;
+}
+
+/* No symbols, frames or code. */
+
+Dbg_Error dbg_StringToVarDef(Dbg_MCState *state, const char *name,
+                             Dbg_Environment *current_env, char **varname,
+                             VarDef **var, Dbg_Environment *env)
+{
+    return Error_NOK;
+}
+
+Dbg_Error dbg_StringToPath(Dbg_MCState *state, const char *start,
+                           const char *end, Dbg_Environment *env,
+                           void *unused, void *st, Dbg_Proc *proc)
+{
+    return Error_NOK;
+}
+
+Dbg_Error dbg_FindActivation(Dbg_MCState *state, Dbg_Environment *env)
+{
+    return Error_OK;
+}
+
+ARMaddress FPOffset(int32_t offset, Dbg_Environment *env)
+{
+    return (ARMaddress)env->frame.fp + offset;
+}
+
+ResultFrom_CallNaturalSize Dbg_CallNaturalSize(Dbg_MCState *state,
+                                               ARMaddress addr, int argw,
+                                               ARMword args[32])
+{
+    return ps_callfailed;
+}
+
+void *dbg_LLSymVal(Dbg_MCState *state, void *st, const char *symname,
+                   Dbg_LLSymType *junk, unsigned32 *val)
+{
+    return NULL;
+}
+
+static Dbg_MCState state;
+static Dbg_Environment env;
+
+/* Evaluates s both ways; returns NO if the two disagree. */
+static bool eval(char *s)
+{
+    CompiledExpr *c;
+    Dbg_Error e1, e2;
+    int32 n1 = 0, n2 = 0;
+
+    c = cc_compile_expr(&state, &env, s);
+    if (c == 0) {
+        printf("%s: does not parse\n", s);
+        return NO;
+    }
+    e1 = cc_eval_compiled(&state, &env, c, &n1);
+    e2 = cc_eval_tree(&state, &env, c, &n2);
+    if (e1 != e2 || (e1 == Error_OK && n1 != n2)) {
+        printf("%s: bytecode gives ", s);
+        if (e1 == Error_OK) printf("%ld", (long)n1); else printf("an error");
+        printf(", tree ");
+        if (e2 == Error_OK) printf("%ld\n", (long)n2); else printf("an error\n");
+        return NO;
+    }
+    if (e1 != Error_OK)
+        printf("%s: cannot evaluate [%s]\n", s,
+               cc_compiled_insns(c) ? "bytecode" : "tree");
+    else
+        printf("%s = %ld (0x%08lx) [%s]\n", s, (long)n1,
+               (unsigned long)(unsigned32)n1,
+               cc_compiled_insns(c) ? "bytecode" : "tree");
+    return YES;
+}
+
+int main(int argc, char *argv[])
+{
+    FILE *f;
+    char line[256];
+    int bad = 0;
+
+    if (argc != 2) {
+        fprintf(stderr, "usage: npp file\n");
+        return 2;
+    }
+    cc_init();
+    cc_rd_topdecl(&state, &env, argv[1]);
+    f = fopen(argv[1], "r");
+    if (f == NULL) return 2;
+    while (fgets(line, sizeof(line), f) != NULL) {
+        char *p = strstr(line, "// ");
+        if (p == NULL) continue;
+        line[strcspn(line, "\n")] = 0;
+        p += 3;
+        if (strncmp(p, "SET:", 4) == 0) {
+            char *q;
+            unsigned long addr = strtoul(p + 4, &q, 0);
+            unsigned long w = strtoul(q, &q, 0);
+            if (dbg_WriteWord(&state, addr, (ARMword)w) != Error_OK) {
+                printf("bad %s\n", p);
+                bad++;
+            }
+        } else if (strncmp(p, "EVAL:", 5) == 0) {
+            p += 5;
+            while (*p == ' ') p++;
+            if (!eval(p)) bad++;
+        } else if (strncmp(p, "PRINT:", 6) == 0) {
+            p += 6;
+            while (*p == ' ') p++;
+            cc_rd_expr(&state, &env, p, "");
+            fflush(stderr);
+        }
+    }
+    fclose(f);
+    return bad != 0;
+}
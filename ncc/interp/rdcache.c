@@ -0,0 +1,123 @@
+/*
+ * interp/rdcache.c: cached reads of target memory
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "rdcache.h"
+
+typedef struct RdPage {
+    ARMaddress base;
+    int state;
+    Dbg_Byte data[RDC_PAGESIZE];
+} RdPage;
+
+/* A page which could not be read as a whole is remembered as bad so    */
+/* that reads from it go straight to the scalar requests.                */
+#define RDC_EMPTY       0
+#define RDC_VALID       1
+#define RDC_BAD         2
+
+static RdPage rdc_pages[RDC_NPAGES];
+
+static struct {
+    ARMaddress base;
+    unsigned32 size;            /* 0 when empty */
+    Dbg_Byte data[RDC_MAXBLOCK];
+} rdc_block;
+
+static bool rdc_lsbytefirst = YES;
+
+void rdcache_init(bool lsbytefirst)
+{
+    rdc_lsbytefirst = lsbytefirst;
+    rdcache_flush();
+}
+
+void rdcache_flush(void)
+{
+    int i;
+    for (i = 0; i < RDC_NPAGES; i++) rdc_pages[i].state = RDC_EMPTY;
+    rdc_block.size = 0;
+}
+
+void rdcache_written(ARMaddress addr, unsigned32 n)
+{
+    ARMaddress p;
+
+    for (p = addr & ~(RDC_PAGESIZE-1); p < addr + n; p += RDC_PAGESIZE) {
+        RdPage *pg = &rdc_pages[(p >> RDC_PAGESHIFT) % RDC_NPAGES];
+        if (pg->base == p) pg->state = RDC_EMPTY;
+    }
+    if (rdc_block.size != 0 &&
+            addr < rdc_block.base + rdc_block.size && addr + n > rdc_block.base)
+        rdc_block.size = 0;
+}
+
+void rdcache_prefetch(Dbg_MCState *state, ARMaddress addr, unsigned32 n)
+{
+    if (n > RDC_MAXBLOCK) n = RDC_MAXBLOCK;
+    if (rdc_block.size != 0 &&
+            addr >= rdc_block.base && addr + n <= rdc_block.base + rdc_block.size)
+        return;
+    rdc_block.size = 0;
+    if (dbg_ReadBytes(state, rdc_block.data, addr, n) == Error_OK) {
+        rdc_block.base = addr;
+        rdc_block.size = n;
+    }
+}
+
+/* Copies n bytes at addr (not crossing a page) out of the cache,       */
+/* reading the page first if need be.                                   */
+static Dbg_Error rdc_read(Dbg_MCState *state, Dbg_Byte *buf, ARMaddress addr, int n)
+{
+    ARMaddress base = addr & ~(RDC_PAGESIZE-1);
+    RdPage *pg;
+
+    if (rdc_block.size != 0 &&
+            addr >= rdc_block.base && addr + n <= rdc_block.base + rdc_block.size) {
+        memcpy(buf, &rdc_block.data[addr - rdc_block.base], n);
+        return Error_OK;
+    }
+    if (addr + n > base + RDC_PAGESIZE) return Error_NOK;
+    pg = &rdc_pages[(base >> RDC_PAGESHIFT) % RDC_NPAGES];
+    if (pg->state == RDC_EMPTY || pg->base != base) {
+        pg->base = base;
+        pg->state = dbg_ReadBytes(state, pg->data, base, RDC_PAGESIZE) == Error_OK ?
+                    RDC_VALID : RDC_BAD;
+    }
+    if (pg->state != RDC_VALID) return Error_NOK;
+    memcpy(buf, &pg->data[addr - base], n);
+    return Error_OK;
+}
+
+Dbg_Error rdcache_readword(Dbg_MCState *state, ARMword *word, ARMaddress addr)
+{
+    Dbg_Byte b[4];
+
+    if (rdc_read(state, b, addr, 4) != Error_OK)
+        return dbg_ReadWord(state, word, addr);
+    *word = rdc_lsbytefirst ?
+        (ARMword)b[0] | (ARMword)b[1] << 8 | (ARMword)b[2] << 16 | (ARMword)b[3] << 24 :
+        (ARMword)b[3] | (ARMword)b[2] << 8 | (ARMword)b[1] << 16 | (ARMword)b[0] << 24;
+    return Error_OK;
+}
+
+Dbg_Error rdcache_readhalf(Dbg_MCState *state, ARMhword *hword, ARMaddress addr)
+{
+    Dbg_Byte b[2];
+
+    if (rdc_read(state, b, addr, 2) != Error_OK)
+        return Dbg_ReadHalf(state, hword, addr);
+    *hword = rdc_lsbytefirst ? (ARMhword)(b[0] | b[1] << 8) :
+                               (ARMhword)(b[1] | b[0] << 8);
+    return Error_OK;
+}
+
+Dbg_Error rdcache_readbyte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr)
+{
+    if (rdc_read(state, byte, addr, 1) != Error_OK)
+        return dbg_ReadByte(state, byte, addr);
+    return Error_OK;
+}
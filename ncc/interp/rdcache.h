@@ -0,0 +1,41 @@
+/*
+ * interp/rdcache.h: cached reads of target memory
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * Every scalar read of target memory used to be a round trip to the
+ * debug agent.  Reads now go through a small direct-mapped cache of
+ * RDC_PAGESIZE byte pages, each filled by one dbg_ReadBytes() request,
+ * plus one larger block which rdcache_prefetch() fills in a single
+ * request before an aggregate is displayed.  Where a block read fails
+ * (say a page straddling unmapped memory) the scalar request is made
+ * as before.
+ *
+ * The cache is only valid while the target is stopped: it must be
+ * flushed whenever the target may have run, and written addresses must
+ * be passed to rdcache_written().
+ */
+
+#ifndef _rdcache_h
+#define _rdcache_h
+
+#include "host.h"
+#include "asdfmt.h"
+#include "dbg_hdr.h"
+
+#define RDC_PAGESHIFT   10
+#define RDC_PAGESIZE    (1L << RDC_PAGESHIFT)
+#define RDC_NPAGES      8
+#define RDC_MAXBLOCK    0x10000L
+
+extern void rdcache_init(bool lsbytefirst);
+extern void rdcache_flush(void);
+extern void rdcache_written(ARMaddress addr, unsigned32 n);
+extern void rdcache_prefetch(Dbg_MCState *state, ARMaddress addr, unsigned32 n);
+
+extern Dbg_Error rdcache_readword(Dbg_MCState *state, ARMword *word, ARMaddress addr);
+extern Dbg_Error rdcache_readhalf(Dbg_MCState *state, ARMhword *hword, ARMaddress addr);
+extern Dbg_Error rdcache_readbyte(Dbg_MCState *state, Dbg_Byte *byte, ARMaddress addr);
+
+#endif
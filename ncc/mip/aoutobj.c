@@ -723,6 +723,9 @@ static void obj_writedata(DataInit *p)
                 while (rpt-- != 0) obj_fwrite(p, len, 1, objstream);
             }
             break;
+        case LIT_BLOB:    /* already in target sex */
+            obj_fwrite((VoidStar)p->val, 1, len, objstream);
+            break;
         case LIT_NUMBER:
             if (len != 4) syserr(syserr_aout_datalen, (long)len);
             /* beware: sex dependent... */
@@ -101,16 +101,34 @@ static int lang_namecmp(char *s, char *t)
 #include "dbg_hl.h"
 #endif
 
+static Symstr *sym_lookup_1(char const *name, int glo, unsigned32 hash);
+
 Symstr *sym_lookup(char const *name, int glo)
-{   int32 wsize;
-    unsigned32 hash, temp;
+{   unsigned32 hash = 1;
     char const *s;
-    Symstr *next, **lvptr = NULL;
   /*
    * 'glo' ==  SYM_LOCAL  => allocate in Binder store
    *       ==  SYM_GLOBAL => allocate in Global store
    *  glo'  &  NO_CHAIN   => don't chain to symtab buckets
    */
+    if (!(glo & NO_CHAIN))
+        for (s = name; *s != 0; ++s)
+            hash = sym_hashchar_(hash, lang_hashofchar(*s));
+    return sym_lookup_1(name, glo, hash);
+}
+
+Symstr *sym_lookup_hashed(char const *name, unsigned32 hash)
+{
+#ifdef PASCAL
+    return sym_lookup(name, SYM_GLOBAL);    /* lang_hashofchar() differs */
+#else
+    return sym_lookup_1(name, SYM_GLOBAL, hash);
+#endif
+}
+
+static Symstr *sym_lookup_1(char const *name, int glo, unsigned32 hash)
+{   int32 wsize;
+    Symstr *next, **lvptr = NULL;
     if (glo & NO_CHAIN)
         glo &= ~NO_CHAIN;
     else
@@ -118,12 +136,6 @@ Symstr *sym_lookup(char const *name, int glo)
 #ifdef CALLABLE_COMPILER
         if ((next = dbg_findhash(name)) != NULL) return next;
 #endif
-        hash = 1;
-        for (s = name; *s != 0; ++s)
-        {   temp = just32bits_(hash << 7);
-            hash = ((hash >> 25)^(temp >> 1)^(temp >> 4) ^
-                                             lang_hashofchar(*s)) & 0x7fffffff;
-        }
         lvptr = &(*hashvec)[hash % BIND_HASHSIZE];
         while ((next = *lvptr) != NULL)
         {   if (lang_namecmp(symname_(next), name) == 0) return(next);
@@ -343,6 +355,7 @@ TagBinder *global_mk_tagbinder(TagBinder *b, Symstr *c, AEop d)
     attributes_(p) = A_GLOBALSTORE;
     tagbindbits_(p) = bits;
     tagbindmems_(p) = 0;
+    classmemo_changed();
     tagbindtype_(p) = globalize_typeexpr(primtype2_(bits, p));
     if (LanguageIsCPlusPlus)
     {   p->friends = NULL;
@@ -384,6 +397,7 @@ TagBinder *mk_tagbinder(Symstr *c, AEop d)
     attributes_(p) = A_LOCALSTORE;
     tagbindbits_(p) = bits;
     tagbindmems_(p) = 0;
+    classmemo_changed();
     tagbindtype_(p) = primtype2_(bits, p);
     if (LanguageIsCPlusPlus)
     {   p->friends = NULL;
@@ -463,13 +477,111 @@ extern LabBind *mk_labbind(LabBind *b, Symstr *c)
    Precondition to call: loc must not represent a local binding.
 */
 #define topbind2(sv, stg, typ) \
-   (bind_global_(sv) = topbindingchain = \
+   (toplog_note(TC_Bind, sv, (IPtr)bind_global_(sv)), \
+    bind_global_(sv) = topbindingchain = \
         global_mk_binder(topbindingchain, sv, stg, typ))
 
 static Binder *topbindingchain;                                 /* vars */
 static TagBinder *toptagbindchain;                              /* tags */
 static LabBind *labelchain;                                     /* labels */
 
+/* C with --lazy-bodies: a deferred function body must be read seeing   */
+/* only the file scope as it was where the function was defined.  So    */
+/* while any such body is pending, changes to the file scope are logged */
+/* (the old value of each binding, type or tag definition changed), and */
+/* are undone while the body is read and redone afterwards.             */
+typedef struct TopChange {
+    int kind;
+    VoidStar p;
+    IPtr old, saved;
+} TopChange;
+
+#define TC_Bind 0               /* p a Symstr, old its Binder           */
+#define TC_Tag  1               /* p a Symstr, old its TagBinder        */
+#define TC_Type 2               /* p a Binder, old its type             */
+#define TC_Bits 3               /* p a TagBinder, old its tagbindbits   */
+#define TC_Mems 4               /* p a TagBinder, old its members       */
+
+static TopChange *toplog;
+static int32 toplog_n, toplog_size;
+static bool toplog_on;
+
+static void toplog_note(int kind, VoidStar p, IPtr old)
+{   TopChange *c;
+    if (!toplog_on) return;
+    if (toplog_n >= toplog_size)
+    {   int32 nsize = toplog_size == 0 ? 64 : 2 * toplog_size;
+        TopChange *v = (TopChange *)GlobAlloc(SU_Other,
+                                              nsize * sizeof(TopChange));
+        memcpy(v, toplog, (size_t)toplog_n * sizeof(TopChange));
+        toplog = v, toplog_size = nsize;
+    }
+    c = &toplog[toplog_n++];
+    c->kind = kind, c->p = p, c->old = old;
+}
+
+static IPtr toplog_swap(TopChange *c, IPtr v)
+{   IPtr was;
+    switch (c->kind)
+    {   case TC_Bind:
+            was = (IPtr)bind_global_((Symstr *)c->p);
+            bind_global_((Symstr *)c->p) = (Binder *)v;
+            break;
+        case TC_Tag:
+            was = (IPtr)tag_global_((Symstr *)c->p);
+            tag_global_((Symstr *)c->p) = (TagBinder *)v;
+            break;
+        case TC_Type:
+            was = (IPtr)bindtype_((Binder *)c->p);
+            bindtype_((Binder *)c->p) = (TypeExpr *)v;
+            break;
+        case TC_Bits:
+            was = (IPtr)tagbindbits_((TagBinder *)c->p);
+            tagbindbits_((TagBinder *)c->p) = (SET_BITMAP)v;
+            break;
+        default:
+            was = (IPtr)tagbindmems_((TagBinder *)c->p);
+            tagbindmems_((TagBinder *)c->p) = (ClassMember *)v;
+            break;
+    }
+    return was;
+}
+
+int32 bind_topmark(void)
+{   toplog_on = YES;
+    return toplog_n;
+}
+
+void bind_rewind(int32 mark, bool back)
+{   int32 i;
+    if (back)
+    {   toplog_on = NO;
+        for (i = toplog_n; i > mark; )
+        {   TopChange *c = &toplog[--i];
+            c->saved = toplog_swap(c, c->old);
+        }
+    }
+    else
+    {   for (i = mark; i < toplog_n; i++)
+            (void)toplog_swap(&toplog[i], toplog[i].saved);
+        toplog_on = YES;
+    }
+}
+
+void bind_topunmark(void)
+{   toplog_on = NO;
+    toplog_n = 0;
+}
+
+void bind_tagdefined(TagBinder *b)
+{   if (tag_global_(tagbindsym_(b)) == b)
+    {   /* (an undefined tag has no members)                            */
+        toplog_note(TC_Mems, b, 0);
+        toplog_note(TC_Bits, b, tagbindbits_(b) & ~TB_BEINGDEFD);
+    }
+    tagbindbits_(b) = (tagbindbits_(b) & ~TB_BEINGDEFD) | TB_DEFD;
+}
+
 /* FW: 01-Apr-96 definition of Scope published in bind.h */
 
 static Scope *local_scope, *freeScopes;
@@ -557,7 +669,7 @@ static ScopeSaver pop_scope_1(int level, bool check_unrefd)
         /* This is only for C: C++ has already closed the class (in     */
         /* cpp_end_strdecl). Hence no need to do this for the core class*/
         if (b != NULL && (tagbindbits_(b) & TB_BEINGDEFD))
-            tagbindbits_(b) = (tagbindbits_(b) & ~TB_BEINGDEFD) | TB_DEFD;
+            bind_tagdefined(b);
     }
     local_scope = scope->prev;
     scope->prev = freeScopes;
@@ -861,7 +973,8 @@ Binder *findbinding(Symstr *sv, TagBinder *cl, int flags)
 }
 
 void add_toplevel_binder(Binder *b)
-{   bind_global_(bindsym_(b)) = b;
+{   toplog_note(TC_Bind, bindsym_(b), (IPtr)bind_global_(bindsym_(b)));
+    bind_global_(bindsym_(b)) = b;
     bindcdr_(b) = topbindingchain;
     topbindingchain = b;
 }
@@ -885,6 +998,7 @@ static Binder **insertionpoint(Scope *scope)
         if (!(tagbindbits_(cl) & TB_BEINGDEFD))
             syserr("adding to completed scope $c", cl);
         cl = core_class(cl);
+        classmemo_changed();
         q = &tagbindmems_(cl);
         while ((l = *q) != NULL) q = &bindcdr_(l);
         return q;
@@ -923,6 +1037,7 @@ static void add_local_tagbinder(TagBinder *b, bool implicit)
     if (scope == NULL)
     {   if (!LanguageIsCPlusPlus) syserr("add_local_tagbinder");
         tagbindcdr_(b) = toptagbindchain;
+        toplog_note(TC_Tag, tagbindsym_(b), (IPtr)tag_global_(tagbindsym_(b)));
         tag_global_(tagbindsym_(b)) = toptagbindchain = b;
     }
     else
@@ -1046,6 +1161,7 @@ TagBinder *instate_tagbinding(Symstr *sv, AEop s, TagDefSort defining,
             if (b == 0)
                 /* introduction of new tag */
             {   *newtag = YES;
+                toplog_note(TC_Tag, sv, (IPtr)tag_global_(sv));
                 tag_global_(sv) = toptagbindchain = b =
                     global_mk_tagbinder(toptagbindchain,sv,s);
                 if (tagbindparent_(b) != 0 && !(bindflg & TEMPLATE))
@@ -1801,6 +1917,7 @@ static Binder *instate_declaration_1(DeclRhsList *d, int declflag)
                 bindstg_(b) = d->declstg |
                   (bindstg_(b) &
                    (bitofstg_(s_virtual)|bitofstg_(s_inline)|b_impl|b_purevirtual));
+                toplog_note(TC_Type, b, (IPtr)bindtype_(b));
                 bindtype_(b) = gt;      /* @@@ bindstg/bindconst too?   */
             }
 #else /* !OLD_VSN */
@@ -2102,7 +2219,7 @@ void Bind_LoadState(FILE *f) {
     tagbindsym_(b) = Dump_LoadedSym(x.w[1]);
     tagbindcdr_(b) = (TagBinder *)Dump_LoadedTagOrBinder(x.w[2]);
     attributes_(b) = x.w[3];
-    tagbindbits_(b) = x.w[4];
+    tagbindbits_(b) = x.w[4] & ~TB_ALIGNCACHED;
     tagbindparent_(b) = Dump_LoadedTag(x.w[5]);
     b->cachedsize = x.w[6];
     b->typedefname = Dump_LoadedSym(x.w[7]);
@@ -2111,6 +2228,7 @@ void Bind_LoadState(FILE *f) {
     else {
       fread(x.w, sizeof(uint32), 1, f);
       tagbindmems_(b) = Dump_LoadedTagOrBinder(x.w[0]);
+      classmemo_changed();
     }
     b->friends = Dump_LoadFriends(f);
     tagbindtype_(b) = Dump_LoadType(f);
@@ -2331,11 +2449,13 @@ void bind_cleanup(void)
 void bind_init(void)
 {   int i;
     topbindingchain = 0, toptagbindchain = 0, labelchain = 0;
+    toplog = NULL, toplog_n = toplog_size = 0, toplog_on = NO;
     freeScopes = local_scope = NULL;
     tag_found_in_local_scope = NO;
     scope_level = 0;
     tentative_defs = 0;
     saved_vg_state.size = 0;
+    classmemo_init();
     if (dump_state & DS_Dump) {
         ngensym = 1; gensymlimit = 0;
         nglobbind = 1; globbindlimit = 0;
@@ -41,6 +41,14 @@ extern const char *sym_name_table[];  /* translation back to strings  */
 
 extern Symstr *(sym_lookup)(char const *name, int glo);
 
+/* sym_lookup()'s hash, a character at a time from 1, so that lex.c can */
+/* hash an identifier while reading it and then look it up (globally)   */
+/* without reading it again.                                            */
+#define sym_hashchar_(h, ch) \
+    ((((h) >> 25) ^ (just32bits_((h) << 7) >> 1) ^ \
+      (just32bits_((h) << 7) >> 4) ^ (ch)) & 0x7fffffff)
+extern Symstr *sym_lookup_hashed(char const *name, unsigned32 hash);
+
 extern Symstr *sym_insert(char const *name, AEop type);
 
 extern Symstr *sym_insert_id(char const *name);
@@ -69,6 +77,17 @@ extern LabBind *mk_labbind(LabBind *b, Symstr *c);
 
 extern void add_toplevel_binder(Binder *b);
 
+extern int32 bind_topmark(void);
+/* Starts (or continues) logging changes to the file scope, for         */
+/* deferred function bodies (--lazy-bodies), and returns a mark.        */
+extern void bind_rewind(int32 mark, bool back);
+/* back: undoes the changes logged since mark (and suspends logging);   */
+/* !back: redoes them again.                                            */
+extern void bind_topunmark(void);
+/* Stops logging and forgets what has been logged.                      */
+extern void bind_tagdefined(TagBinder *b);
+/* Marks tag b as defined (TB_DEFD).                                    */
+
 typedef enum {
   TD_NotDef,
   TD_ContentDef,
@@ -209,6 +228,11 @@ extern SynBindList *pop_saved_temps(SynBindList *bl);
 extern void syn_note_generated_fn(TopDecl *d);
 extern int32 base_vtable_sz(TagBinder *b);
 extern TagBindList *rootOfPath;
+/* Member lookup memo (xbind.c): invalidated whenever a class's member  */
+/* list may have changed or a new tag may reuse a freed one's address.  */
+extern int32 classmemo_generation;
+extern void classmemo_init(void);
+#define classmemo_changed()                  (classmemo_generation++)
 #else
 
 #define current_member_scope()               ((TagBinder *)0)
@@ -232,6 +256,8 @@ extern TagBindList *rootOfPath;
 #define has_template_arg_scope()             (bool)0
 #define dup_template_scope()                 (ScopeSaver)0
 #define clone_bindlist(a,b)                  (BindList *)a
+#define classmemo_init()                     ((void)0)
+#define classmemo_changed()                  ((void)0)
 
 #endif
 
@@ -59,6 +59,7 @@
 #include "regsets.h"
 #include "cse.h"
 #include "sr.h"
+#include "sched.h"
 #include "flowgraf.h"
 #include "mcdep.h"
 #include "aetree.h"
@@ -105,6 +106,7 @@ static SynBindList *binderise(SynBindList *l)
 #define NOTINSWITCH NOTALABEL
 
 static int32 max_icode, max_block;          /* statistics (lies, damn lies) */
+static int32 branches_removed;
 
 // current_fl is set mostly when cg_current_cmd is set, but can also be set
 // earlier and later for the prologues and epilogues.
@@ -183,6 +185,9 @@ static void cg_count(FileLine fl);
 static void cg_return(Expr *x, bool implicitinvaluefn);
 static void cg_loop(Expr *init, Expr *pretest, Expr *step, Cmd *body,
                     Expr *posttest);
+#ifdef TARGET_HAS_VECTOR_KERNELS
+static bool cg_vectorloop(Expr *init, Expr *pretest, Expr *step, Cmd *body);
+#endif
 static void cg_test(Expr *x, bool branchtrue, LabelNumber *dest);
 static void casebranch(VRegnum r, CasePair *v, int32 ncases,
                        LabelNumber *defaultlab);
@@ -2572,7 +2577,13 @@ case s_do:
             cg_loop(0, 0, 0, cmd1c_(x), cmd2e_(x));
             break;
 
-case s_for: cg_loop(cmd1e_(x), cmd2e_(x), cmd3e_(x), cmd4c_(x), 0);
+case s_for:
+#ifdef TARGET_HAS_VECTOR_KERNELS
+            if (cg_vectorloop(cmd1e_(x), cmd2e_(x), cmd3e_(x), cmd4c_(x)))
+                cg_loop(0, cmd2e_(x), cmd3e_(x), cmd4c_(x), 0);
+            else
+#endif
+            cg_loop(cmd1e_(x), cmd2e_(x), cmd3e_(x), cmd4c_(x), 0);
             break;
 
 case s_if:  {   LabelNumber *l1 = nextlabel();
@@ -5087,7 +5098,8 @@ static VRegnum open_compilable(Expr **xp, RegSort rsort, bool valneeded)
         return R_A1; /* /* Resultregister wanted here? */
     }
 
-    if ((bindstg_(exb_(fname)) & bitofstg_(s_inline)) &&
+    if (((bindstg_(exb_(fname)) & bitofstg_(s_inline)) ||
+         Inline_HasSummary(exb_(fname))) &&
         !(var_cc_private_flags & 8192L)) {
         Expr *structresult = NULL;
         ExprList *args = exprfnargs_(x);
@@ -5315,6 +5327,7 @@ static int32 cg_bindargs(BindList *args, bool ellipsis)
     BindList *x;
     int32 argoff, lyingargwords;
     int32 nfltregargs = 0, nintregargs = 0, nfltregwords = 0;
+    uint32 fltsingles = 0;
     int32 argno = 0;
 
 /* If ANY argument has its address taken I mark ALL arguments as having  */
@@ -5344,6 +5357,7 @@ static int32 cg_bindargs(BindList *args, bool ellipsis)
             {   int32 bytes = rep & MCR_SIZE_MASK;
                 nfltregwords += (bytes > alignof_toplevel_auto ? bytes : alignof_toplevel_auto) /
                                 sizeof_int;
+                if (bytes == 4) fltsingles |= (uint32)1 << nfltregargs;
                 nfltregargs++,
                 *fltregargp = newbl, fltregargp = &newbl->bindlistcdr;
             } else
@@ -5361,6 +5375,7 @@ static int32 cg_bindargs(BindList *args, bool ellipsis)
     }
 
     currentfunction.fltargwords = nfltregwords;
+    currentfunction.fltargsingles = fltsingles;
     if (nintregargs > NARGREGS) nintregargs = NARGREGS;
     max_argsize = argoff;
 #ifdef TARGET_STRUCT_RESULT_REGISTER
@@ -5547,6 +5562,190 @@ static bool SimpleTest(Expr const *test) {
     /* (x) has already been turned into (x != 0) */
 }
 
+#ifdef TARGET_HAS_VECTOR_KERNELS
+
+/* Counted float loops of the shapes listed against VK_MLA etc in        */
+/* mcdep.h have the bulk of their iterations done by a target kernel:    */
+/*     init; if (i < n) i += K(&x[i], &y[i], n-i, a); for (;i<n;++i) ... */
+/* The kernel only works on whole vectors, so the original loop (less    */
+/* its initialiser) follows to do the rest - all of it if K declined.    */
+
+static bool vk_localvar(Expr *e, int32 mcrep)
+{   /* A variable which the loop body can only change by assignment.    */
+    Binder *b;
+    if (h0_(e) != s_binder) return NO;
+    b = exb_(e);
+    return (bindstg_(b) & PRINCSTGBITS) == bitofstg_(s_auto) &&
+           !(bindstg_(b) & b_addrof) &&
+           (mcrep == 0 ? h0_(princtype(bindtype_(b))) == t_content
+                       : mcrepofexpr(e) == mcrep);
+}
+
+static bool vk_scalar(Expr *e, int32 mcrep)
+{   return (h0_(e) == s_floatcon && mcrepofexpr(e) == mcrep) ||
+           vk_localvar(e, mcrep);
+}
+
+static Expr *vk_element(Expr *e, Expr *i, int32 mcrep)
+{   /* If e is x[i], for x an array or an unchanging pointer, &x[i].     */
+    Expr *a, *base, *ix, *k;
+    if (h0_(e) != s_content || mcrepofexpr(e) != mcrep || isvolatile_expr(e))
+        return NULL;
+    a = arg1_(e);
+    if (h0_(a) != s_plus) return NULL;
+    base = arg1_(a), ix = arg2_(a);
+    if (h0_(ix) != s_times) base = arg2_(a), ix = arg1_(a);
+    if (h0_(ix) != s_times) return NULL;
+    if (arg1_(ix) == i) k = arg2_(ix);
+    else if (arg2_(ix) == i) k = arg1_(ix);
+    else return NULL;
+    if (!integer_constant(k) || result2 != (mcrep & MCR_SIZE_MASK))
+        return NULL;
+    if (h0_(base) == s_addrof ? h0_(arg1_(base)) != s_binder
+                              : !vk_localvar(base, 0))
+        return NULL;
+    return a;
+}
+
+static Expr *vk_scaled(Expr *e, Expr *i, int32 mcrep, Expr **a)
+{   /* If e is a*x[i] or x[i]*a, &x[i] (and a).                           */
+    Expr *x;
+    if (h0_(e) != s_times) return NULL;
+    if ((x = vk_element(arg2_(e), i, mcrep)) != NULL &&
+        vk_scalar(arg1_(e), mcrep))
+        *a = arg1_(e);
+    else if ((x = vk_element(arg1_(e), i, mcrep)) != NULL &&
+             vk_scalar(arg2_(e), mcrep))
+        *a = arg2_(e);
+    else
+        return NULL;
+    return x;
+}
+
+static Expr *vk_double(Expr *e)
+{   return mcrepofexpr(e) == (MCR_SORT_FLOATING | sizeof_double) ? e :
+               mk_expr1(s_cast, te_double, e);
+}
+
+static bool cg_vectorloop(Expr *init, Expr *pretest, Expr *step, Cmd *body)
+{   Expr *i, *n, *e, *lhs, *rhs, *w, *s = NULL, *a = NULL;
+    Expr *x = NULL, *z = NULL, *y = NULL;
+    int32 mcrep, kind, veclen;
+    Symstr *name;
+    if (pretest == 0 || step == 0 || body == NULL ||
+        usrdbg(DBG_LINE) || (config & CONFIG_OPTIMISE_SPACE))
+        return NO;
+/* Loop control: i < n, stepping i by 1, with n unchanging.              */
+    if (h0_(pretest) != s_less) return NO;
+    i = arg1_(pretest), n = arg2_(pretest);
+    mcrep = mcrepofexpr(i);
+    if ((mcrep != 4 && mcrep != (MCR_SORT_UNSIGNED | 4)) ||
+        !vk_localvar(i, mcrep) || n == i ||
+        !(integer_constant(n) || vk_localvar(n, mcrep)))
+        return NO;
+    while (h0_(step) == s_cast) step = arg1_(step);
+    if ((h0_(step) != s_assign && h0_(step) != s_displace) ||
+        arg1_(step) != i || h0_(e = arg2_(step)) != s_plus ||
+        arg1_(e) != i || !integer_constant(arg2_(e)) || result2 != 1)
+        return NO;
+/* Body: one assignment, to y[i] or to a scalar s.                       */
+    while (h0_(body) == s_block && cmdblk_bl_(body) == NULL &&
+           cmdblk_cl_(body) != NULL && cdr_(cmdblk_cl_(body)) == NULL)
+        body = cmdcar_(cmdblk_cl_(body));
+    if (h0_(body) != s_semicolon) return NO;
+    e = cmd1e_(body);
+    while (h0_(e) == s_cast) e = arg1_(e);
+    if (h0_(e) != s_assign) return NO;
+    lhs = arg1_(e), rhs = arg2_(e);
+    mcrep = mcrepofexpr(lhs);
+    if ((mcrep & MCR_SORT_MASK) != MCR_SORT_FLOATING ||
+        mcrepofexpr(rhs) != mcrep)
+        return NO;
+    if (h0_(lhs) == s_binder) {
+        if (!vk_localvar(lhs, mcrep) || h0_(rhs) != s_plus) return NO;
+        s = lhs;
+        if (arg1_(rhs) == s) e = arg2_(rhs);
+        else if (arg2_(rhs) == s) e = arg1_(rhs);
+        else return NO;
+/* Partial sums per lane reorder the additions, which changes rounding:  */
+/* only done when the user has said that is acceptable.                  */
+        if (!HasFeature(Feature_FPReassociate)) return NO;
+        if ((x = vk_element(e, i, mcrep)) != NULL)
+            kind = VK_SUM;
+        else if (h0_(e) == s_times &&
+                 (x = vk_element(arg1_(e), i, mcrep)) != NULL &&
+                 (z = vk_element(arg2_(e), i, mcrep)) != NULL)
+            kind = VK_DOT;
+        else
+            return NO;
+    } else {
+        if ((y = vk_element(lhs, i, mcrep)) == NULL) return NO;
+        if ((x = vk_scaled(rhs, i, mcrep, &a)) != NULL)
+            kind = VK_SCALE;
+        else if (h0_(rhs) == s_plus &&
+                 (((x = vk_scaled(arg1_(rhs), i, mcrep, &a)) != NULL &&
+                   (w = vk_element(arg2_(rhs), i, mcrep)) != NULL) ||
+                  ((x = vk_scaled(arg2_(rhs), i, mcrep, &a)) != NULL &&
+                   (w = vk_element(arg1_(rhs), i, mcrep)) != NULL)))
+        {   if (!is_same(w, y)) return NO;
+            kind = VK_MLA;
+        }
+        else if ((h0_(rhs) == s_plus || h0_(rhs) == s_minus ||
+                  h0_(rhs) == s_times) &&
+                 (x = vk_element(arg1_(rhs), i, mcrep)) != NULL &&
+                 (z = vk_element(arg2_(rhs), i, mcrep)) != NULL)
+            kind = h0_(rhs) == s_plus ? VK_ADD :
+                   h0_(rhs) == s_minus ? VK_SUB : VK_MUL;
+        else
+            return NO;
+    }
+    name = target_vectorkernel(kind, mcrep & MCR_SIZE_MASK, &veclen);
+    if (name == NULL) return NO;
+
+    if (debugging(DEBUG_CG))
+        cc_msg("for loop -> vector kernel %s\n", symname_(name));
+    if (init != 0) cg_exprvoid(init);
+    {   TypeExpr *itype = typeofexpr(i);
+        Expr *count = mk_expr2(s_minus, itype, n, i);
+        Expr *argv[4], *fn, *call;
+        ExprList *args = NULL;
+        TypeExpr *fntype;
+        int argc = 0;
+        LabelNumber *skip = nextlabel();
+        argv[argc++] = x;
+        if (z != NULL) argv[argc++] = z;
+        if (y != NULL) argv[argc++] = y;
+        argv[argc++] = count;
+        if (a != NULL) argv[argc++] = vk_double(a);
+        if (s != NULL) argv[argc++] = vk_double(s);
+        fntype = te_fntype(s != NULL ? te_double : itype,
+                           typeofexpr(argv[0]), typeofexpr(argv[1]),
+                           argc > 2 ? typeofexpr(argv[2]) : NULL,
+                           argc > 3 ? typeofexpr(argv[3]) : NULL, NULL);
+        while (argc > 0) args = mkExprList(args, argv[--argc]);
+        fn = mk_expr1(s_addrof, ptrtotype_(fntype),
+                      (Expr *)mk_binder(name,
+                                        bitofstg_(s_extern) | b_undef | b_fnconst,
+                                        fntype));
+        call = mk_expr2(s_fnap, s != NULL ? te_double : itype, fn,
+                        (Expr *)args);
+        if (s != NULL && mcrep != (MCR_SORT_FLOATING | sizeof_double))
+            call = mk_expr1(s_cast, typeofexpr(s), call);
+        cg_test(pretest, NO, skip);
+        if (s != NULL) {
+            cg_exprvoid(mk_expr2(s_assign, typeofexpr(s), s, call));
+            call = mk_expr2(s_and, itype, count,
+                            mkintconst(itype, -veclen, 0));
+        }
+        cg_exprvoid(mk_expr2(s_assign, itype, i,
+                             mk_expr2(s_plus, itype, i, call)));
+        start_new_basic_block(skip);
+    }
+    return YES;
+}
+
+#endif
+
 static void cg_loop(Expr *init, Expr *pretest, Expr *step, Cmd *body,
                     Expr *posttest)
 {
@@ -6218,12 +6417,13 @@ static void forcetostore(BindList *bl)
 
 void cg_topdecl2(BindList *local_binders, BindList *regvar_binders)
 {
-    BindList *split_binders = NULL,
+    BindList *split_binders = NULL, *pipe_binders,
              *invariant_binders = cse_eliminate();
     /* Corrupt regvar_binders and local_binders to get */
     /* a spill_order list for allocate_registers()     */
     drop_local_store();   /* what loopopt used */
     split_binders = splitranges(local_binders, regvar_binders);
+    pipe_binders = schedule_loops();
     drop_local_store();
     lose_dead_code();     /* before regalloc   */
     if ((procflags & BLKSETJMP) &&
@@ -6235,9 +6435,10 @@ void cg_topdecl2(BindList *local_binders, BindList *regvar_binders)
     }
     allocate_registers(
         (BindList *)nconc((List *)invariant_binders,
+           nconc((List *)pipe_binders,
              nconc((List *)split_binders,
                 nconc((List *)local_binders,
-                      (List *)regvar_binders))));
+                      (List *)regvar_binders)))));
 
     drop_local_store();   /* what regalloc used */
 
@@ -6280,6 +6481,11 @@ void cg_topdecl2(BindList *local_binders, BindList *regvar_binders)
 
     if (cgstate.block_cur > max_block) max_block = cgstate.block_cur;
     if (cgstate.icode_cur > max_icode) max_icode = cgstate.icode_cur;
+    branches_removed += cgstate.branches_removed;
+    if (debugging(DEBUG_CG) && cgstate.branches_removed != 0)
+        cc_msg("%s: %ld branches removed by conditional execution\n",
+               symname_(currentfunction.symstr),
+               (long)cgstate.branches_removed);
 }
 
 /* After all code has been generated, we inspect it to remove b_addrof from
@@ -6487,8 +6693,13 @@ void cg_topdecl(TopDecl *x, FileLine fl)
                  usrdbg(DBG_ANY) ||
                  !Inline_Save(b, local_binders, regvar_binders)) {
 
-                cg_topdecl2(local_binders, regvar_binders);
-                symext_(currentfunction.symstr)->usedregs = regmaskvec;
+                if (currentfunction.xrflags & xr_defext && !usrdbg(DBG_ANY))
+                    Inline_SaveSummary(b, local_binders, regvar_binders);
+                if (!(HasFeature(Feature_UnitAtATime) && !usrdbg(DBG_ANY) &&
+                      Inline_Defer(b, local_binders, regvar_binders))) {
+                    cg_topdecl2(local_binders, regvar_binders);
+                    symext_(currentfunction.symstr)->usedregs = regmaskvec;
+                }
             }
             /* enable profile option, if necessary */
             if (old_profile_option)
@@ -6505,6 +6716,7 @@ void cg_init(void)
     mcdep_init();             /* code for system dependent module header */
     datasegbinders = (BindList *)global_cons2(SU_Other, 0, datasegment);
     max_icode = 0; max_block = 0;
+    branches_removed = 0;
     cse_init();
     splitrange_init();
     has_main = NO;
@@ -6529,12 +6741,16 @@ void cg_reinit(void)
 
 void cg_tidy(void)
 {
+    Inline_CompileDeferred();
     Inline_Tidy();
     codebuf_tidy();
     if (debugging(DEBUG_STORE)) {
         cc_msg("Max icode store %ld, block heads %ld bytes\n",
                 (long)max_icode, (long)max_block);
     }
+    if (debugging(DEBUG_CG))
+        cc_msg("%ld branches removed by conditional execution\n",
+               (long)branches_removed);
     regalloc_tidy();
     cse_tidy();
 
@@ -106,12 +106,16 @@ LabList *asm_lablist;         /* @@@ This is not really part of codebuf */
                               /* here as "gen/obj/asm support.          */
 
 /* For the sake of a cleaner separation between the FE and the BE       */
+/* Handing out the tail (or replacing it) ends any blob being extended: */
+/* the caller may splice or trim the list there.                        */
 DataInit *get_datadesc_ht(bool head)
-{   return (head) ? datap->head : datap->tail;
+{   if (head) return datap->head;
+    datap->blob = NULL;
+    return datap->tail;
 }
 
 void set_datadesc_ht(bool head, DataInit *val)
-{   if (head) datap->head = val; else datap->tail = val;
+{   if (head) datap->head = val; else datap->tail = val, datap->blob = NULL;
 }
 
 int32 get_datadesc_size(void)
@@ -143,11 +147,13 @@ DataDesc *get_datadesc(void)
 }
 
 void copy_datadesc(DataDesc *dest)
-{   *dest = data;
+{   data.blob = NULL;
+    *dest = data;
 }
 
 void restore_datadesc(DataDesc *src)
 {   data = *src;
+    data.blob = NULL;
 }
 
 int32 data_size(void)
@@ -314,6 +320,7 @@ static void adddata1(DataInit *x)
 #endif
     if (datap->head == 0) datap->head = datap->tail = x;
     else datap->tail->datacdr = x, datap->tail = x;
+    datap->blob = NULL;
 }
 
 static void adddata(DataInit *a, int32 b, int32 c, IPtr d, IPtr e)
@@ -322,6 +329,48 @@ static void adddata(DataInit *a, int32 b, int32 c, IPtr d, IPtr e)
     adddata1(x);
 }
 
+/* Successive words of constant data go into LIT_BLOBs, rather than a   */
+/* DataInit each, when no assembler output is wanted (the asm writers   */
+/* want the LIT_xxx sort of each word).  A lone word stays as it was    */
+/* and becomes a blob when a second one follows it; a full blob is      */
+/* continued in a new one of twice the size, so nothing is ever copied. */
+#define DATABLOB_MIN    16
+#define DATABLOB_MAX    4096
+
+static void blob_putword(unsigned8 *p, int32 w)
+{   /* w is a word value in target sex (see totargetsex()) */
+    if (target_lsbytefirst)
+        p[0] = (unsigned8)w, p[1] = (unsigned8)(w >> 8),
+        p[2] = (unsigned8)(w >> 16), p[3] = (unsigned8)(w >> 24);
+    else
+        p[0] = (unsigned8)(w >> 24), p[1] = (unsigned8)(w >> 16),
+        p[2] = (unsigned8)(w >> 8), p[3] = (unsigned8)w;
+}
+
+static void vg_addword(int lit_flag, int32 w)
+{   DataInit *x = datap->blob;
+    if (x != NULL)
+    {   if (x->sort != LIT_BLOB)
+        {   unsigned8 *b = (unsigned8 *)GlobAlloc(SU_Data, DATABLOB_MIN);
+            blob_putword(b, totargetsex((int32)x->val, (int)x->sort));
+            x->sort = LIT_BLOB, x->val = (IPtr)b;
+            datap->blobcap = DATABLOB_MIN;
+        }
+        else if (x->len == datap->blobcap)
+        {   int32 cap = datap->blobcap < DATABLOB_MAX ? 2*datap->blobcap :
+                                                         DATABLOB_MAX;
+            adddata(0, 1, LIT_BLOB, 0, (IPtr)GlobAlloc(SU_Data, cap));
+            x = datap->blob = datap->tail;
+            datap->blobcap = cap;
+        }
+        blob_putword((unsigned8 *)x->val + x->len, totargetsex(w, lit_flag));
+        x->len += 4;
+        return;
+    }
+    adddata(0, 1, lit_flag, 4, w);
+    if (asmstream == NULL) datap->blob = datap->tail;
+}
+
 /* (sizeof_ptr == 2) or unaligned */
 /* This routine outputs a LIT_BBX or LIT_HX just before a LIT_ADCON in   */
 /* the case where pointers are 2 bytes long.  In this case not all data  */
@@ -375,7 +424,7 @@ void gendcI_a(int32 len, int32 val, bool aligned)
     datap->wtype = (datap->wtype << len) | 1;    /* flag 'byte' boundaries */
     datap->wpos += (unsigned)len;
     if (datap->wpos == 4)
-    {   int32 lit_flag;
+    {   int lit_flag;
 /* the following values could be coded into the LIT_xxx values             */
         switch (datap->wtype)
         {   default:  syserr(syserr_vg_wtype, datap->wtype);
@@ -386,11 +435,25 @@ void gendcI_a(int32 len, int32 val, bool aligned)
             case 13: lit_flag = LIT_BBH;    break;
         }
         datap->wpos = 0, datap->wtype = 0;
-        adddata(0, 1, lit_flag, 4, datap->wbuff.w32[0]);
+        vg_addword(lit_flag, datap->wbuff.w32[0]);
     }
     datap->size += len;
 }
 
+void gendcB(int32 n, unsigned8 const *b)
+{   int32 nwords;
+    while (n != 0 && datap->wpos != 0) gendcI(1, *b++), n--;
+    nwords = n & ~3;
+    if (nwords != 0 && asmstream == NULL)
+    {   if (debugging(DEBUG_DATA))
+            cc_msg("%.6lx:   DC %ldX'...'\n", (long)datap->size, (long)nwords);
+        adddata(0, 1, LIT_BLOB, nwords, (IPtr)b);
+        datap->size += nwords;
+        b += nwords, n -= nwords;
+    }
+    while (n != 0) gendcI(1, *b++), n--;
+}
+
 void gendcE(int32 len, FloatCon *val)
 {   vg_wflush();                /* only if sizeof_ptr == 2 */
     adddata(0, 1, LIT_FPNUM, len, (IPtr)val);
@@ -498,6 +561,7 @@ void padstatic(int32 align)
 void labeldata(Symstr *s)
 {
     vg_wflush();                /* only if sizeof_ptr == 2 */
+    datap->blob = NULL;         /* keep each object's data to itself */
     if (asmstream != NULL       /* nasty space-saving hack */
         && s != NULL)           /* labeldata(NULL) provides access to vg_wflush() externally */
         adddata1((DataInit *)global_list5(SU_Data, (DataInit *)0, s, LIT_LABEL, 0, 0));
@@ -515,19 +579,30 @@ void labeldata(Symstr *s)
  */
 
 int32 trydeletezerodata(DataInit *previous, int32 minsize)
-{   int32 size = 0;
+{   int32 size = 0, trim = 0;
     DataInit *p,*q = previous;
     for (p = q ? q->datacdr : datap->head; p; p = p->datacdr)
         switch (p->sort)
-        {   case LIT_BBBB: case LIT_HH: case LIT_BBH: case LIT_HBB:
+        {   case LIT_BLOB:
+            {   unsigned8 const *b = (unsigned8 const *)p->val;
+                int32 n = p->len;
+                while (n != 0 && b[n-1] == 0) n--;
+                if (n == 0) { size += p->len; break; }
+                n = (n + 3) & ~3;       /* whole words only */
+                size = trim = p->len - n, q = p;
+                break;
+            }
+            case LIT_BBBB: case LIT_HH: case LIT_BBH: case LIT_HBB:
             case LIT_NUMBER:
                 if (p->val == 0) { size += p->rpt * 4; break; }
                 /* else drop through */
             default:
-                size = 0, q = p;
+                size = trim = 0, q = p;
         }
     if (size >= minsize)
     {   if (q==0) datap->head = 0; else datap->tail=q, q->datacdr=0;
+        if (trim != 0) q->len -= trim;
+        datap->blob = NULL;
         datap->size -= size;
         return size;
     }
@@ -591,8 +666,10 @@ void outcodewordaux_fl(int32 w, int32 f, VoidStar aux, MiniFileLine* fl)
         codeasmauxvec[codeveccnt] = (VoidStar (*)[CODEVECSEGSIZE]) (
             asmstream ? BindAlloc(sizeof(*codeasmauxvec[0])) : DUFF_ADDR);
 #if RECORD_SOURCE_LOCATION
-/* Only set up codefilelinevec to store MiniFileLines if asmstream is active. */
-        codefilelinevec[codeveccnt] = (asmstream ?
+/* Only set up codefilelinevec to store MiniFileLines if asmstream is active */
+/* and the listing is to show them.                                         */
+        codefilelinevec[codeveccnt] =
+            (asmstream && HasFeature(Feature_AsmIncludesLocation) ?
             BindAlloc(sizeof(*codefilelinevec[0]) * CODEVECSEGSIZE) :
             DUFF_ADDR);
 #endif
@@ -615,7 +692,8 @@ void outcodewordaux_fl(int32 w, int32 f, VoidStar aux, MiniFileLine* fl)
     if (asmstream) {
         code_aux_(q) = aux;
 #if RECORD_SOURCE_LOCATION
-        code_fileline_set(q, fl);
+        if (HasFeature(Feature_AsmIncludesLocation))
+            code_fileline_set(q, fl);
 #endif
     }
 #endif
@@ -1225,16 +1303,20 @@ void codebuf_init(void)
     data.head = NULL;  data.tail = NULL;
     data.size = 0; data.xrefs = NULL; data.xrarea = xr_data;
     data.wpos = 0, data.wtype = 0, data.wbuff.w32[0] = 0;
+    data.blob = NULL;
     extable.head = NULL; extable.size = 0;
     extable.xrefs = NULL; extable.xrarea = xr_constdata;
     extable.wpos = 0; extable.wtype = 0; extable.wbuff.w32[0] = 0;
+    extable.blob = NULL;
     exhandler.head = NULL; exhandler.size = 0;
     exhandler.xrefs = NULL; exhandler.xrarea = xr_constdata;
     exhandler.wpos = 0; exhandler.wtype = 0; exhandler.wbuff.w32[0] = 0;
+    exhandler.blob = NULL;
 #ifdef CONST_DATA_IN_CODE
     constdata.head = NULL; constdata.size = 0;
     constdata.xrefs = NULL; constdata.xrarea = xr_constdata;
     constdata.wpos = 0; constdata.wtype = 0; constdata.wbuff.w32[0] = 0;
+    constdata.blob = NULL;
 #endif
     datap = &data;
 #ifdef TARGET_CALL_USES_DESCRIPTOR
@@ -29,6 +29,8 @@ typedef struct DataDesc {
     union { int32 w32[1]; int16 w16[2]; int8 w8[4]; } wbuff;
     uint8 wpos;
     uint8 wtype;
+    DataInit *blob;     /* tail word or LIT_BLOB still being extended   */
+    int32 blobcap;      /* bytes allocated for blob (if LIT_BLOB)       */
 } DataDesc;
 
 typedef enum {
@@ -213,6 +215,8 @@ extern void gendc0(int32 nbytes);
 extern void gendcI_a(int32 len, int32 val, bool aligned);
 #define gendcI(len, val) gendcI_a(len, val, YES)
 extern void gendcE(int32 len, FloatCon *val);
+extern void gendcB(int32 n, unsigned8 const *b);
+ /* n constant bytes, b to remain valid until the data is written out */
 #ifdef TARGET_CALL_USES_DESCRIPTOR
 extern void gendcF(Symstr *sv, int32 offset);
 extern int32 genfncon(Symstr* sv);
@@ -808,6 +808,9 @@ static void obj_writedata()  /* follows gendc exactly! */
     {   case LIT_LABEL:   /* name only present for c.xxxasm */
             break;
         default:  syserr(syserr_coff_gendata, (long)sort);
+        case LIT_BLOB:    /* already in target sex */
+            obj_fwrite((void *)p->val, 1, len, objstream);
+            break;
         case LIT_BBBB:    /* the next 4 are the same as LIT_NUMBER except   */
         case LIT_HH:      /* for (as yet unsupported) cross compilation.    */
         case LIT_BBH:
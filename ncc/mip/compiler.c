@@ -79,7 +79,7 @@ typedef struct PathElement
 } PathElement;
 
 /* Peter Armistead - added to link Callable compiler */
-#ifdef CALLABLE_COMPILER
+#if defined(CALLABLE_COMPILER) || defined(TARGET_IS_INTERPRETER)
 void mcdep_set_options(ToolEnv *t) {
 }
 
@@ -95,7 +95,7 @@ int Tool_OrderedEnvEnumerate(
 Uint TE_Count(ToolEnv *t, char const *prefix) {
   return 0;
 }
-#endif /* COMPILE CALLABLE_COMPILER */
+#endif /* CALLABLE_COMPILER || TARGET_IS_INTERPRETER */
 
 /* AM/LDS: beware: the stack path_hd is assumed always to be non-empty, and  */
 /* the first element is treated very specially (in BSD).  Maybe it should be */
@@ -146,6 +146,11 @@ static FILE *makestream;
 #ifndef NO_DUMP_STATE
 static char const *compiledheader;
 static FILE *dumpstream;
+static char const *summaryfile, *summaryinputs;
+static FILE *summarystream;
+#endif
+#ifdef CPLUSPLUS
+static char const *tmptrepository;
 #endif
 
 #ifdef COMPILING_ON_RISC_OS
@@ -252,6 +257,10 @@ extern void compile_abort(int sig_no)
     {   cc_close(&dumpstream, compiledheader);
         remove(compiledheader);
     }
+    if (summarystream != NULL)
+    {   cc_close(&summarystream, summaryfile);
+        remove(summaryfile);
+    }
 #endif
     dbg_finalise();
     compiler_exit(sig_no == (-1) ? EXIT_fatal : EXIT_syserr);
@@ -437,6 +446,14 @@ static int SetLongForm(void *arg, char const *name, char const *val) {
 
     if (strcmp(&name[3], "asm-includes-location") == 0) {
       SetFeature(Feature_AsmIncludesLocation);
+    } else if (strcmp(&name[3], "unit-at-a-time") == 0) {
+      SetFeature(Feature_UnitAtATime);
+    } else if (strcmp(&name[3], "lazy-bodies") == 0) {
+      SetFeature(Feature_LazyBodies);
+    } else if (strcmp(&name[3], "lazy-statics") == 0) {
+      SetFeature(Feature_LazyStatics);
+    } else if (strcmp(&name[3], "fp-reassociate") == 0) {
+      SetFeature(Feature_FPReassociate);
     }
   }
 
@@ -651,6 +668,7 @@ static void set_debug_options(ToolEnv *t)
         case 'l': opt |= DBG_LINE;   break;
         case 'v': opt |= DBG_VAR;    break;
         case 'p': opt |= DBG_PP;     break;
+        case 't': opt |= DBG_TYPES;  break;
       }
     usrdbgmask |= opt;
   }
@@ -733,6 +751,11 @@ static void set_compile_options(ToolEnv *t)
 #ifndef NO_DUMP_STATE
   if ((val = toolenv_lookup(t, "-zgw")) != NULL) { compiledheader = &val[1]; dump_state |= DS_Dump; }
   if ((val = toolenv_lookup(t, "-zgr")) != NULL) { compiledheader = &val[1]; dump_state |= DS_Load; }
+  if ((val = toolenv_lookup(t, "-zgs")) != NULL) { summaryfile = &val[1]; dump_state |= DS_Summary; }
+  if ((val = toolenv_lookup(t, "-zgi")) != NULL) summaryinputs = &val[1];
+#endif
+#ifdef CPLUSPLUS
+  if ((val = toolenv_lookup(t, "-zgt")) != NULL) tmptrepository = &val[1];
 #endif
   if ((val = toolenv_lookup(t, ".pp_only")) != NULL)
     ccom_flags = (ccom_flags | FLG_PREPROCESS) & ~FLG_COMPILE;
@@ -855,6 +878,7 @@ static void cleanup(void)
 {
   bind_cleanup();
   pp_tidyup();
+  ovld_tidy();
 
   if (debugging(DEBUG_STORE))
   {
@@ -1112,6 +1136,80 @@ static void DumpCompiledHeader(void)
         Vargen_DumpState(dumpstream);
     cc_close(&dumpstream, compiledheader);
 }
+
+/* Inline summaries: -zgi names a comma-separated list of files written */
+/* by earlier compilations with -zgs.                                    */
+static void LoadInlineSummaries(void)
+{   char const *p = summaryinputs;
+    while (*p != 0)
+    {   char const *q = strchr(p, ',');
+        size_t n = (q == NULL) ? strlen(p) : (size_t)(q - p);
+        char *name = (char *)GlobAlloc(SU_Other, (int32)n + 1);
+        memcpy(name, p, n); name[n] = 0;
+        if (n != 0)
+        {   FILE *f = cc_open(name, BINARY_INPUT);
+            uint32 w;
+            fread(&w, sizeof(uint32), 1, f);
+            if (w != DS_Version)
+                cc_fatalerr(compiler_fatalerr_load_version, name);
+            if (ferror(f) == 0)
+                Inline_ReadSummaries(f, name);
+            cc_close(&f, name);
+        }
+        p += (q == NULL) ? n : n + 1;
+    }
+}
+
+static void WriteInlineSummaries(void)
+{   uint32 w = DS_Version;
+    summarystream = cc_open(summaryfile, BINARY_OUTPUT);
+    fwrite(&w, sizeof(uint32), 1, summarystream);
+    if (ferror(summarystream) == 0)
+        Inline_WriteSummaries(summarystream);
+    cc_close(&summarystream, summaryfile);
+}
+#endif
+
+#ifdef CPLUSPLUS
+/* Template repository: -zgt names a file shared by the compilations of */
+/* a build, listing the function template instances each has generated. */
+static char const *TemplateRepositoryOwner(void)
+{   return objectfile != NULL ? objectfile : asmfile;
+}
+
+static void ReadTemplateRepository(void)
+{   FILE *f = fopen(tmptrepository, "r");   /* absent for the first unit */
+    syn_read_tmptrepository(f, TemplateRepositoryOwner());
+    if (f != NULL) fclose(f);
+}
+
+/* The new contents go to a file beside the repository, named from this */
+/* compilation's object file, which is then renamed over it: a unit     */
+/* reading the repository meanwhile sees either the old or new file in  */
+/* full, never a partly written one.                                     */
+static void WriteTemplateRepository(void)
+{   char const *owner = TemplateRepositoryOwner();
+    unsigned32 hash = 0;
+    char *tmp;
+    FILE *in, *out;
+    for (; *owner != 0; owner++) hash = hash * 31 + (unsigned char)*owner;
+    tmp = (char *)GlobAlloc(SU_Other, (int32)strlen(tmptrepository) + 10);
+    sprintf(tmp, "%s.%08lx", tmptrepository, (unsigned long)hash);
+    if ((out = fopen(tmp, "w")) == NULL)
+    {   cc_warn(warn_template_repository, tmptrepository);
+        return;
+    }
+    in = fopen(tmptrepository, "r");
+    syn_write_tmptrepository(in, out);
+    if (in != NULL) fclose(in);
+    if (ferror(out) | fclose(out) ||
+        (rename(tmp, tmptrepository) != 0 &&
+         /* hosts which won't rename over an existing file */
+         (remove(tmptrepository), rename(tmp, tmptrepository) != 0)))
+    {   cc_warn(warn_template_repository, tmptrepository);
+        remove(tmp);
+    }
+}
 #endif
 
 bool inputfromtty;
@@ -1154,6 +1252,11 @@ extern int ccom(ToolEnv *t, char const *infile, char const *outfile,
 #ifndef NO_DUMP_STATE
   compiledheader = NULL;
   dumpstream = NULL;
+  summaryfile = summaryinputs = NULL;
+  summarystream = NULL;
+#endif
+#ifdef CPLUSPLUS
+  tmptrepository = NULL;
 #endif
 
   dump_state = 0;
@@ -1366,6 +1469,11 @@ extern int ccom(ToolEnv *t, char const *infile, char const *outfile,
 
 #ifndef NO_DUMP_STATE
   if (dump_state & DS_Load) LoadCompiledHeader();
+  if (summaryinputs != NULL) LoadInlineSummaries();
+#endif
+#ifdef CPLUSPLUS
+  if (tmptrepository != NULL && TemplateRepositoryOwner() != NULL)
+    ReadTemplateRepository();
 #endif
 
   initstaticvar(datasegment, 1);    /* nasty here */
@@ -1375,6 +1483,14 @@ extern int ccom(ToolEnv *t, char const *infile, char const *outfile,
     compile_statements();
   else
     preprocess_only();
+#ifndef NO_DUMP_STATE
+  if ((dump_state & DS_Summary) && errorcount == 0) WriteInlineSummaries();
+#endif
+#ifdef CPLUSPLUS
+  if (tmptrepository != NULL && TemplateRepositoryOwner() != NULL &&
+      errorcount == 0)
+    WriteTemplateRepository();
+#endif
 
   if (sourcefile != stdin_name)
       dbg_include(NULL, NULL, curlex.fl);
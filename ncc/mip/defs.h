@@ -101,7 +101,9 @@ typedef IPtr VRegnum;          /* a pity this has to be here, but... */
 #define NMAGICREGS  NINTREGS
 #define NANYARGREGS NARGREGS
 #else
-#  ifdef MAXFLTARGREGS
+#  if defined MAXFLTREGS
+#    define NMAGICREGS  (NINTREGS+MAXFLTREGS)
+#  elif defined MAXFLTARGREGS
 #    define NMAGICREGS  (NINTREGS+MAXFLTARGREGS)
 #  else
 #    define NMAGICREGS  (NINTREGS+NFLTREGS)
@@ -794,6 +796,7 @@ struct TagBinder
   Friend *friends;              /* list of friends of the class... */
   TagBinder *tagparent;         /* parent class of class or 0.          */
   int32 cachedsize;
+  int32 cachedalign;            /* valid if TB_ALIGNCACHED              */
 /* Rearrange next 2-3 lines to end so need not always be allocated?     */
   TagBindList *taginstances;       /* used if TB_TEMPLATE                  */
   ScopeSaver tagscope;          /* used if TB_TEMPLATE                  */
@@ -855,6 +858,7 @@ struct TagBinder
 #define TB_CORE            0x01000000   /* tagparent points to derivation */
 #define TB_HASCMEM         0x02000000   /* has a const data member or its derivation*/
 #define TB_SIZECACHED      0x04000000
+#define TB_ALIGNCACHED     0x10000000   /* not dumped: see Bind_LoadState */
 #define TB_OPAQUE          0x08000000   /* data member access and sizeof not allowed*/
 #define TB_NEEDSCCTOR      0x00000200   /* has a user-defined copy ctor in class
                                            or in its derivation
@@ -1655,6 +1655,11 @@ static bool HandleArg(ToolEnv *t, char const *current, char const *nextarg, bool
       case 'G':   switch (safe_toupper(current[3])) {
                   case 'W': tooledit_insertwithjoin(t, "-zgw", '=', &current[4]); break;
                   case 'R': tooledit_insertwithjoin(t, "-zgr", '=', &current[4]); break;
+                  case 'S': tooledit_insertwithjoin(t, "-zgs", '=', &current[4]); break;
+                  case 'I': tooledit_insertwithjoin(t, "-zgi", '=', &current[4]); break;
+#ifdef CPLUSPLUS
+                  case 'T': tooledit_insertwithjoin(t, "-zgt", '=', &current[4]); break;
+#endif
                   default:  goto check_mcdep;
                   }
                   break;
@@ -1839,6 +1844,10 @@ static KW const keytab[] = {
 #if RECORD_SOURCE_LOCATION
       {"--asm-includes-location", 0, ".--asm-includes-location", "=1" },
 #endif
+      {"--unit-at-a-time", 0, ".--unit-at-a-time", "=1" },
+      {"--lazy-bodies", 0, ".--lazy-bodies", "=1" },
+      {"--lazy-statics", 0, ".--lazy-statics", "=1" },
+      {"--fp-reassociate", 0, ".--fp-reassociate", "=1" },
 #endif /* PASCAL */
 };
 
@@ -14,6 +14,7 @@
 
 #define DS_Dump 1
 #define DS_Load 2
+#define DS_Summary 4
 extern unsigned dump_state;
 
 typedef struct {
@@ -71,6 +72,9 @@ void Dump_Init(Dump_Sort, FILE *);
 void Inline_LoadState(FILE *);
 void Inline_DumpState(FILE *);
 
+void Inline_WriteSummaries(FILE *);
+void Inline_ReadSummaries(FILE *, char const *);
+
 void Bind_LoadState(FILE *);
 void Bind_DumpState(FILE *);
 
@@ -109,6 +113,8 @@ void Vargen_DumpState(FILE *f);
 #define Dump_Init(a,b)                  ((void)0)
 #define Inline_LoadState(a)             ((void)0)
 #define Inline_DumpState(a)             ((void)0)
+#define Inline_WriteSummaries(a)        ((void)0)
+#define Inline_ReadSummaries(a,b)       ((void)0)
 #define Bind_LoadState(a)               ((void)0)
 #define Bind_DumpState(a)               ((void)0)
 #define PP_LoadState(a)                 ((void)0)
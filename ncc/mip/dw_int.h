@@ -38,6 +38,8 @@ extern Symstr *dw_macro_sym, *dw_abbrev_sym, *dw_location_sym;
 #define MacroAreaName ".debug_macinfo"
 #define AbbrevAreaName ".debug_abbrev"
 #define LocationAreaName ".debug_loc"
+/* Common areas holding shared types: the prefix plus the type signature */
+#define Dwarf2TypeAreaPrefix ".debug_info$$T"
 
 typedef struct Dw_ItemList Dw_TypeRep;
 
@@ -48,6 +50,7 @@ typedef struct Dbg_Return Dbg_Return;
 /* The following is the *internal* data structure in which debug info. */
 /* is buffered.                                                        */
 typedef struct Dw_ItemList Dw_ItemList;
+typedef struct Dw_TypeArea Dw_TypeArea;
 typedef enum {
     Stg_Reg,
     Stg_Auto,
@@ -67,6 +70,7 @@ struct Dw_ItemList {
     int debsort;
     Dw_ItemList *sibling;
     uint32 dbgloc;
+    Dw_TypeArea *typearea;      /* NULL if in the compilation unit itself */
     union
     {  struct { Dw_ItemList *children;
                 char const *name;
@@ -192,6 +196,7 @@ struct Dw_ItemList {
 #define debsort_(p) ((p)->debsort)
 #define sibling_(p) ((p)->sibling)
 #define dbgloc_(p) ((p)->dbgloc)
+#define typearea_(p) ((p)->typearea)
 
 #define sect_children_(p) ((p)->car.DEB_SECTION.children)
 #define sect_name_(p) ((p)->car.DEB_SECTION.name)
@@ -314,6 +319,23 @@ struct Dw_ItemList {
 extern Dw_ItemList *dw_list, *dw_listproc;
 extern Dw_ItemList *dw_basetypes;
 
+/* A type (with its members) moved to a common area of its own, named by */
+/* a signature of its structure, so that the linker keeps only one copy  */
+/* of it however many objects include it (DWARF 2, -gt+t only).          */
+typedef struct { uint32 h1, h2; } Dw_Signature;
+
+struct Dw_TypeArea {
+    Dw_TypeArea *cdr;
+    Dw_ItemList *root;
+    Dw_Signature sig;
+    char const *name;
+    Symstr *sym;                /* for relocations */
+    uint32 start, size;         /* in the debug buffer, while writing */
+    DataXref *xrefs;
+};
+
+extern Dw_TypeArea *dw_typeareas;
+
 typedef struct {
     Uint index;  /* of the file in filelist */
     uint16 l;
@@ -391,6 +413,13 @@ extern Dw_FileCoord dw_coord_sentinel;
 
 extern int32 dw_mapped_codebase, dw_mapped_codep;
 
+void Dw_StartArea(char const *name);
+void Dw_EndArea(char const *name, DataXref *relocs);
+uint32 Dw_BufPos(void);
+void Dw_WriteArea(char const *name, DataXref *relocs, uint32 start, uint32 n);
+void Dw_PatchBN(uint32 offset, uint8 const *p, int32 n);
+void Dw_PatchW(uint32 offset, uint32 u);
+
 uint32 Dw_WriteInlineString(char const *s, uint32 offset);
 uint32 Dw_WriteB(Uint u, uint32 offset);
 uint32 Dw_WriteH(uint32 u, uint32 offset);
@@ -411,4 +440,5 @@ void Dw_2_WriteMacros(void);
 void Dw_2_WriteInfo(void);
 void Dw_2_WriteAbbrevs(void);
 void Dw_2_WriteLineinfo(void);
+void Dw_2_NoteTypeAreas(Dw_ItemList *cu);
 
@@ -20,6 +20,7 @@
 #  include <strings.h>
 #endif
 #include <stddef.h>
+#include <stdlib.h>
 
 #include "globals.h"
 
@@ -101,6 +102,9 @@ static bool dw_init_done, dw_sub_init_done;
 Dw_ItemList *dw_list, *dw_listproc;
 Dw_ItemList *dw_basetypes;
 
+Dw_TypeArea *dw_typeareas;
+static bool dw_typeareas_noted;
+
 Dw_LocList *dw_loclist;
 Dw_MacroList *dw_macrolist;
 
@@ -124,6 +128,7 @@ static Dw_ItemList *Dw_ItemAlloc_S(size_t size, unsigned tag) {
   Dw_ItemList *p = (Dw_ItemList *)DbgAlloc(size);
   debsort_(p) = tag;
   dbgloc_(p) = 0;
+  typearea_(p) = NULL;
   return p;
 }
 
@@ -136,6 +141,7 @@ static Dw_ItemList *dw_additem_s(size_t size, unsigned tag) {
   sibling_(p) = NULL; *scopestack->childp = p; scopestack->childp = &sibling_(p);
   cdr_(p) = dw_list; dw_list = p;
   dbgloc_(p) = 0;
+  typearea_(p) = NULL;
   return p;
 }
 
@@ -272,36 +278,105 @@ DataXref *Dw_Relocate(DataXref *xrefs, int32 where, Symstr const *symbol) {
   return (DataXref*)global_list3(SU_Xref, xrefs, where, symbol);
 }
 
+/* Each debug area is assembled in dw_buf, in target byte order, and    */
+/* handed to obj_writedebug() in one piece by Dw_EndArea(), so values   */
+/* only known once the rest of the area is built (lengths, forward      */
+/* references) can be patched in place instead of being found by a      */
+/* separate sizing pass.  The buffer is kept from one area to the next. */
+static uint8 *dw_buf;
+static uint32 dw_bufsize, dw_buflen;
+
+static uint8 *Dw_BufExtend(uint32 n) {
+  uint8 *p;
+  if (dw_buflen + n > dw_bufsize) {
+    uint32 size = dw_bufsize == 0 ? 0x4000 : dw_bufsize;
+    while (size < dw_buflen + n) size *= 2;
+    p = (uint8 *)(dw_buf == NULL ? malloc(size) : realloc(dw_buf, size));
+    if (p == NULL) cc_fatalerr(misc_fatalerr_space2);
+    dw_buf = p; dw_bufsize = size;
+  }
+  p = &dw_buf[dw_buflen];
+  dw_buflen += n;
+  return p;
+}
+
+static void Dw_PutW(uint8 *p, uint32 u) {
+  if (target_lsbytefirst) {
+    p[0] = (uint8)u; p[1] = (uint8)(u >> 8); p[2] = (uint8)(u >> 16); p[3] = (uint8)(u >> 24);
+  } else {
+    p[3] = (uint8)u; p[2] = (uint8)(u >> 8); p[1] = (uint8)(u >> 16); p[0] = (uint8)(u >> 24);
+  }
+}
+
+void Dw_StartArea(char const *name) {
+  obj_startdebugarea(name);
+  dw_buflen = 0;
+}
+
+void Dw_EndArea(char const *name, DataXref *relocs) {
+  if (dw_buflen != 0) obj_writedebug(dw_buf, dw_buflen);
+  dw_buflen = 0;
+  obj_enddebugarea(name, relocs);
+}
+
+uint32 Dw_BufPos(void) {
+  return dw_buflen;
+}
+
+/* Hands over part of the buffer as a whole area: for areas which are   */
+/* built together (the info area and its type units), after which the   */
+/* next Dw_StartArea() discards the buffer as usual.                    */
+void Dw_WriteArea(char const *name, DataXref *relocs, uint32 start, uint32 n) {
+  obj_startdebugarea(name);
+  if (n != 0) obj_writedebug(&dw_buf[start], n);
+  obj_enddebugarea(name, relocs);
+}
+
+void Dw_PatchBN(uint32 offset, uint8 const *p, int32 n) {
+  if (offset + n > dw_buflen) syserr("Dw_PatchBN %lx", (long)offset);
+  memcpy(&dw_buf[offset], p, n);
+}
+
+void Dw_PatchW(uint32 offset, uint32 u) {
+  if (offset + 4 > dw_buflen) syserr("Dw_PatchW %lx", (long)offset);
+  Dw_PutW(&dw_buf[offset], u);
+}
+
 uint32 Dw_WriteInlineString(char const *s, uint32 offset) {
   uint32 n = strlen(s);
-  obj_writedebug(s, n+1);
+  memcpy(Dw_BufExtend(n+1), s, n+1);
   return offset + n + 1;
 }
 
 uint32 Dw_WriteB(unsigned u, uint32 offset) {
-  char b[1];
-  b[0] = u; obj_writedebug(b, 1);
+  *Dw_BufExtend(1) = (uint8)u;
   return offset + 1;
 }
 
 uint32 Dw_WriteBN(uint8 const *p, int32 n, uint32 offset) {
-  obj_writedebug(p, n);
+  memcpy(Dw_BufExtend(n), p, n);
   return offset + n;
 }
 
 uint32 Dw_WriteH(uint32 u, uint32 offset) {
-  uint16 h[1];
-  h[0] = (uint16)u; obj_writedebug(h, 1+DBG_SHORTFLAG);
+  uint8 *p = Dw_BufExtend(2);
+  if (target_lsbytefirst) {
+    p[0] = (uint8)u; p[1] = (uint8)(u >> 8);
+  } else {
+    p[1] = (uint8)u; p[0] = (uint8)(u >> 8);
+  }
   return offset + 2;
 }
 
 uint32 Dw_WriteW(uint32 u, uint32 offset) {
-  obj_writedebug(&u, 1+DBG_INTFLAG);
+  Dw_PutW(Dw_BufExtend(4), u);
   return offset + 4;
 }
 
 uint32 Dw_WriteL(uint32 const *d, uint32 offset) {
-  obj_writedebug(d, 2+DBG_INTFLAG);
+  uint8 *p = Dw_BufExtend(8);
+  Dw_PutW(p, d[0]);
+  Dw_PutW(p+4, d[1]);
   return offset + 8;
 }
 
@@ -1370,7 +1445,7 @@ static uint32 Dw_1or2_NameindexSize(void) {
   Dw_ItemList const *p = sect_children_(dw_section);
   uint32 n = 0;
   for (; p != NULL; p = sibling_(p))
-    switch (debsort_(p)) {
+    if (typearea_(p) == NULL) switch (debsort_(p)) {
     case DW_TAG_subprogram:
       n += (uint32)strlen(Dw_Unmangle(proc_name_(p))) + 5;
       break;
@@ -1418,14 +1493,14 @@ static void Dw_1or2_WriteNameindex(void) {
   uint32 size = dw_nameindex_size + 9 + /* header (excluding length word) */
                                     4;  /* terminator */
   uint32 roundup = (size & 3) ? 4 - (size & 3) : 0;
-  obj_startdebugarea(NameIndexAreaName);
+  Dw_StartArea(NameIndexAreaName);
   Dw_WriteW(size + roundup, 0);
   Dw_WriteB(1, 0);
   Dw_WriteW(0, 0);
   Dw_WriteW(dw_baseseg.len, 0);
   xrefs = Dw_Relocate(xrefs, 5, dw_debug_sym);
   for (; p != NULL; p = sibling_(p))
-    switch (debsort_(p)) {
+    if (typearea_(p) == NULL) switch (debsort_(p)) {
     case DW_TAG_subprogram:
       Dw_1or2_WriteNameindexEntry(p, Dw_Unmangle(proc_name_(p)));
       break;
@@ -1462,9 +1537,9 @@ static void Dw_1or2_WriteNameindex(void) {
   Dw_WriteW(0, 0);
   if (roundup) {
     uint32 w = 0;
-    obj_writedebug(&w, roundup);
+    Dw_WriteBN((uint8 const *)&w, roundup, 0);
   }
-  obj_enddebugarea(NameIndexAreaName, xrefs);
+  Dw_EndArea(NameIndexAreaName, xrefs);
 }
 
 #ifdef TARGET_HAS_FP_OFFSET_TABLES
@@ -1482,8 +1557,17 @@ void dbg_finalise(void) {
 }
 
 bool dbg_debugareaexists(char const *name) {
-  if (StrEq(name, DebugAreaName))
+  if (StrEq(name, DebugAreaName)) {
+    /* Asked first while the object's areas are numbered: the last point */
+    /* at which areas for shared types can be added.                     */
+    if (dw_version == 2 && usrdbg(DBG_TYPES) && dw_list != NULL &&
+        !dw_typeareas_noted) {
+      dw_typeareas_noted = YES;
+      Dw_2_NoteTypeAreas(dw_section);
+    }
     return dw_list != NULL;
+  } else if (StrnEq(name, Dwarf2TypeAreaPrefix, sizeof(Dwarf2TypeAreaPrefix)-1))
+    return YES;
   else if (StrEq(name, LineInfoAreaName))
     return dw_coord_p != NULL;
   else if (StrEq(name, NameIndexAreaName))
@@ -1520,6 +1604,7 @@ void dbg_writedebug(void) {
 
       q = (Dw_ItemList *)DbgAlloc(sizeof(dw_list->car.DEB_REST)+offsetof(Dw_ItemList,car));
       debsort_(q) = DW_TAG_unspecified_parameters;
+      typearea_(q) = NULL;
       sibling_(q) = *prevsibling; cdr_(q) = *prevp;
       *prevsibling = q; *prevp = q;
     }
@@ -1552,6 +1637,7 @@ static void dw_sub_init(void) {
   dw_ftlist = NULL;
   dw_fmllist = NULL;
   dw_macrolist = NULL;
+  dw_typeareas = NULL; dw_typeareas_noted = NO;
 }
 
 bool dbg_needsframepointer(void) {
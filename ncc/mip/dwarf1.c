@@ -64,7 +64,7 @@ void Dw_1_WriteLineinfo(void) {
   dw_coord_sentinel.codeseg = bindsym_(codesegment);
   *dw_coord_q = &dw_coord_sentinel;
   dw_coord_sentinel.codeaddr = dw_mapped_codebase+dw_mapped_codep;
-  obj_startdebugarea(Dwarf1LineInfoAreaName);
+  Dw_StartArea(Dwarf1LineInfoAreaName);
   Dw_WriteW(size + roundup, 0);
   Dw_WriteW(sectionbase, 4);
   xrefs = Dw_Relocate(xrefs, 4, p->codeseg);
@@ -85,7 +85,7 @@ void Dw_1_WriteLineinfo(void) {
     }
   /* round up to 4-byte multiple */
   if (roundup) Dw_WriteH(0, 0);
-  obj_enddebugarea(Dwarf1LineInfoAreaName, xrefs);
+  Dw_EndArea(Dwarf1LineInfoAreaName, xrefs);
 }
 
 /* armobj.c calls writedebug to generate the debugging tables.   */
@@ -537,7 +537,7 @@ void Dw_1_WriteInfo(void)
 { Dw_ItemList *p;
   unsigned32 infosize, offset, roundup;
   dw_xrefs = NULL;
-  obj_startdebugarea(Dwarf1DebugAreaName);
+  Dw_StartArea(Dwarf1DebugAreaName);
   for (infosize = 0, p = dw_list; p != NULL; p = cdr_(p)) {
     uint32 n;
     if (debsort_(p) == DW_TAG_fref) debsort_(p) = struct_undefsort_(p);
@@ -827,9 +827,9 @@ void Dw_1_WriteInfo(void)
   if (roundup != 0) {
     unsigned32 w = 0;
     Dw_WriteW(roundup, offset);
-    obj_writedebug(&w, roundup - 4);
+    Dw_WriteBN((uint8 const *)&w, roundup - 4, 0);
   }
-  obj_enddebugarea(Dwarf1DebugAreaName, dw_xrefs);
+  Dw_EndArea(Dwarf1DebugAreaName, dw_xrefs);
 }
 
 #else
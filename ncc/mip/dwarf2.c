@@ -22,6 +22,7 @@
 #include "cgdefs.h"
 #include "version.h"
 #include "xrefs.h"
+#include "store.h"
 #include "codebuf.h"
 #include "builtin.h"   /* te_xxx, xxxsegment */
 #include "simplify.h"  /* mcrep */
@@ -396,6 +397,14 @@ static AbbrevEntry const abbr_variable_extern = { DW_TAG_variable, NO, attr_vari
 
 static AbbrevEntry const abbr_volatiletype = { DW_TAG_volatile_type, NO, attr_qualtype };
 
+/* Heads a type unit (see Dw_2_NoteTypeAreas) */
+static AttribDesc const attr_typeunit[] = {
+  { DW_AT_language, DW_FORM_data1 },
+  { 0, 0 }
+};
+
+static AbbrevEntry const abbr_typeunit = { DW_TAG_compile_unit, YES, attr_typeunit };
+
 static AbbrevEntry const * const abbrevlist_c[] = {
   &abbr_null,
   &abbr_arraybound,
@@ -508,16 +517,15 @@ static uint8 const block_mem[] = { 2, DW_FORM_data1, DW_FORM_udata, 0 };
 
 #define ATTRIBBUFSIZE 20
 
-static uint32 Dw_WriteLEB128_U_3(uint32 u, uint32 offset) {
-  uint8 b[3];
-  u &= ~0x80000000;
+/* References to items not yet written are given a fixed three byte      */
+/* encoding, patched once the target's offset is known.                  */
+static void Dw_LEB128_U_3(uint8 *b, uint32 u) {
   b[0] = ((Uint)u & 0x7f) | 0x80;
   u = u >> 7;
   b[1] = ((Uint)u & 0x7f) | 0x80;
   u = u >> 7;
   b[2] = ((Uint)u & 0x7f);
-  if ((u & ~0x7f) != 0) syserr("Dw_WriteLEB128_U_3");
-  return Dw_WriteBN(b, 3, offset);
+  if ((u & ~0x7f) != 0) syserr("Dw_LEB128_U_3");
 }
 
 static uint32 Dw_WriteLEB128_U(uint32 u, uint32 offset) {
@@ -572,6 +580,10 @@ typedef struct { Uint form; uint32 i; void const *p; } AttribVal;
 #define blocksize_(p) ((p) & 0xff)
 #define blockix_(p) ((p) >> 8)
 
+/* A reference to item q: Dw_2_WriteInfo needs q itself if it has not    */
+/* yet been written (its dbgloc still flagged).                          */
+#define SetRef_(w, q) ((w).i = dbgloc_(q), (w).p = (q))
+
 static uint32 Dw_2_BlockArgs(AttribVal const *w, Uint n, uint8 const *block_mem) {
   uint32 size = 0;
   for (w += n; ; w++)
@@ -609,7 +621,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
     w[1].i = proc_body_(p) - proc_entry_(p);
     w[2].i = high_pc_(p); w[2].p = proc_codeseg_(p);
     if (proc_decl_(p) != NULL) {
-      w[3].i = dbgloc_(proc_decl_(p));
+      SetRef_(w[3], proc_decl_(p));
       return &abbr_subprogram_ref;
     }
     w[3].p = Dw_Unmangle(proc_name_(p));
@@ -618,7 +630,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
       if (is_void_type_(restype))
         return &abbr_subprogram_void;
       else {
-        w[5].i = dbgloc_(restype);
+        SetRef_(w[5], restype);
         return &abbr_subprogram;
       }
     }
@@ -633,7 +645,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
       w[0].p = Dw_Unmangle(procdecl_name_(p));
       w[1].i = YES;
       if (!is_void_type_(procdecl_type_(p))) {
-        w[i++].i = dbgloc_(procdecl_type_(p));
+        SetRef_(w[i], procdecl_type_(p)); i++;
         sort |= 1;
       }
       if (procdecl_stg_(p) & bitofstg_(s_virtual)) {
@@ -653,13 +665,13 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
       if (is_void_type_(restype))
         return &abbr_subroutinetype_void;
       else {
-        w[0].i = dbgloc_(restype);
+        SetRef_(w[0], restype);
         return &abbr_subroutinetype;
       }
     }
 
   case DW_TAG_proctype_formal:
-    w[0].i = dbgloc_(formal_type_(p));
+    SetRef_(w[0], formal_type_(p));
     if (formal_name_(p) == NULL)
       return &abbr_proctypeformal_anon;
     else {
@@ -695,20 +707,20 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
 
       default:
         w[2].form = DW_FORM_ref_udata;
-        w[2].i = dbgloc_(formal_defltfn_(p));
+        SetRef_(w[2], formal_defltfn_(p));
         break;
       }
       return &abbr_proctypeformal_default;
     }
 
   case DW_TAG_ptr_to_member_type:
-    w[0].i = dbgloc_(ptrtomem_container_(p));
-    w[1].i = dbgloc_(ptrtomem_type_(p));
+    SetRef_(w[0], ptrtomem_container_(p));
+    SetRef_(w[1], ptrtomem_type_(p));
     return &abbr_ptrtomembertype;
 
   case DW_TAG_typedef:
     w[0].p = type_name_(p);
-    w[1].i = dbgloc_(type_type_(p));
+    SetRef_(w[1], type_type_(p));
     return &abbr_typedef;
 
   case DW_TAG_lexical_block:
@@ -744,7 +756,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
 
   case DW_TAG_member:
     w[0].p = member_name_(p);
-    w[1].i = dbgloc_(member_type_(p));
+    SetRef_(w[1], member_type_(p));
     w[2].p = block_mem;
     { Uint n = ATTRIBBUFSIZE - block_mem[0];
       w[n].i = DW_OP_plus_uconst;
@@ -764,7 +776,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
     { Uint n;
       uint8 const *b;
       w[0].p = symname_(var_sym_(p));
-      w[1].i = dbgloc_(var_type_(p));
+      SetRef_(w[1], var_type_(p));
       switch (var_stgclass_(p)) {
       case Stg_Extern:
       case Stg_Static:
@@ -828,23 +840,23 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
 
 
   case DW_TAG_pointer_type:
-    w[0].i = dbgloc_(qualtype_qualifiedtype_(p));
+    SetRef_(w[0], qualtype_qualifiedtype_(p));
     return &abbr_pointertype;
 
   case DW_TAG_const_type:
-    w[0].i = dbgloc_(qualtype_qualifiedtype_(p));
+    SetRef_(w[0], qualtype_qualifiedtype_(p));
     return &abbr_consttype;
 
   case DW_TAG_volatile_type:
-    w[0].i = dbgloc_(qualtype_qualifiedtype_(p));
+    SetRef_(w[0], qualtype_qualifiedtype_(p));
     return &abbr_volatiletype;
 
   case DW_TAG_reference_type:
-    w[0].i = dbgloc_(qualtype_qualifiedtype_(p));
+    SetRef_(w[0], qualtype_qualifiedtype_(p));
     return &abbr_referencetype;
 
   case DW_TAG_array_type:
-    w[0].i = dbgloc_(array_basetype_(p));
+    SetRef_(w[0], array_basetype_(p));
     return &abbr_arraytype;
 
   case DW_TAG_array_bound:
@@ -915,7 +927,7 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
     }
 
   case DW_TAG_inheritance:
-    w[0].i = dbgloc_(inherit_type_(p));
+    SetRef_(w[0], inherit_type_(p));
     { Uint n = ATTRIBBUFSIZE - block_mem[0];
       w[n].i = DW_OP_plus_uconst;
       w[n+1].i = inherit_offset_(p);
@@ -930,184 +942,596 @@ static AbbrevEntry const *Dw_2_ItemEntry(Dw_ItemList const *p, AttribVal *w) {
   }
 }
 
-static Uint Dw_2_AbbrevLookup(AbbrevEntry const *abbrev) {
-  Uint i;
+/* Abbreviation indices, by a hash on the entry's address.  The table   */
+/* is rebuilt when the language (so abbrevlist_c/_cpp) changes.          */
+/* When there are type units, each entry with references has a twin     */
+/* (numbered after the list) whose references are DW_FORM_indirect, for */
+/* items referring to another unit; the type unit header comes last.    */
+#define ABBREVHASHSIZE 128
+
+static struct {
+  AbbrevEntry const *abbrev;
+  Uint index, twin;
+} abbrevindex[ABBREVHASHSIZE];
+
+static AbbrevEntry const * const *abbrevindex_table;
+static Uint abbrevcount, abbrevtwins;
+
+#define abbrevhash_(a) ((Uint)(((IPtr)(a) >> 3) % ABBREVHASHSIZE))
+
+static bool Dw_2_HasRefs(AbbrevEntry const *abbrev) {
+  AttribDesc const *attr = abbrev->attribs;
+  for (; attr->form != 0; attr++)
+    if (attr->form == DW_FORM_ref_udata) return YES;
+  return NO;
+}
+
+static Uint Dw_2_AbbrevHash(AbbrevEntry const *abbrev) {
   AbbrevEntry const * const *table = LanguageIsCPlusPlus ? abbrevlist_cpp : abbrevlist_c;
-  for (i = 0; table[i] != NULL; i++)
-    if (table[i] == abbrev) return i;
-  syserr("Dw_2_AbbrevLookup %p (%d)", abbrev, abbrev->tag);
+  Uint h;
+  if (abbrevindex_table != table) {
+    Uint i;
+    memset(abbrevindex, 0, sizeof(abbrevindex));
+    for (i = 0; table[i] != NULL; i++) continue;
+    abbrevcount = i; abbrevtwins = 0;
+    for (i = 0; table[i] != NULL; i++) {
+      for (h = abbrevhash_(table[i]); abbrevindex[h].abbrev != NULL; h = (h + 1) % ABBREVHASHSIZE)
+        continue;
+      abbrevindex[h].abbrev = table[i];
+      abbrevindex[h].index = i;
+      abbrevindex[h].twin = Dw_2_HasRefs(table[i]) ? abbrevcount + abbrevtwins++ : 0;
+    }
+    abbrevindex_table = table;
+  }
+  if (abbrev != NULL)
+    for (h = abbrevhash_(abbrev); abbrevindex[h].abbrev != NULL; h = (h + 1) % ABBREVHASHSIZE)
+      if (abbrevindex[h].abbrev == abbrev) return h;
+  syserr("Dw_2_AbbrevLookup %p (%d)", abbrev, abbrev == NULL ? 0 : abbrev->tag);
   return 0;
 }
 
-static uint32 Dw_2_InfoItemSize(Dw_ItemList const *p, AttribVal *w) {
+static Uint Dw_2_AbbrevLookup(AbbrevEntry const *abbrev) {
+  if (abbrev == &abbr_typeunit) {
+    Dw_2_AbbrevHash(&abbr_null);
+    return abbrevcount + abbrevtwins;
+  }
+  return abbrevindex[Dw_2_AbbrevHash(abbrev)].index;
+}
+
+static Uint Dw_2_AbbrevTwin(AbbrevEntry const *abbrev) {
+  Uint twin = abbrevindex[Dw_2_AbbrevHash(abbrev)].twin;
+  if (twin == 0) syserr("Dw_2_AbbrevTwin %d", abbrev->tag);
+  return twin;
+}
+
+static void Dw_RoundUp(uint32 offset) {
+  if ((offset & 3) != 0) {
+    uint32 w = 0;
+    Dw_WriteBN((uint8 const *)&w, 4 - (offset & 3), offset);
+  }
+}
+
+typedef struct Dw_RefFixup Dw_RefFixup;
+struct Dw_RefFixup {
+  Dw_RefFixup *cdr;
+  uint32 offset;                /* in the buffer, not the unit */
+  Dw_ItemList const *item;
+  bool addr;                    /* DW_FORM_ref_addr, not DW_FORM_ref_udata */
+};
+
+/* The unit being written (NULL for the compilation unit itself), where   */
+/* it starts in the buffer, and the references still to be patched.     */
+/* Within a unit, items refer to each other by DW_FORM_ref_udata;        */
+/* across units through a relocated DW_FORM_ref_addr.                    */
+static Dw_TypeArea *dw_unit;
+static uint32 dw_unitstart;
+static Dw_RefFixup *dw_fixups;
+
+static uint32 Dw_2_WriteRef(AttribVal const *w, bool addr, uint32 offset) {
+  Dw_ItemList const *q = (Dw_ItemList const *)w->p;
+  uint32 loc = w->i;
+  if (loc & 0x80000000) {
+    Dw_RefFixup *fx = (Dw_RefFixup *)GlobAlloc(SU_Dbg, sizeof(Dw_RefFixup));
+    fx->cdr = dw_fixups; fx->offset = dw_unitstart + offset;
+    fx->item = q; fx->addr = addr;
+    dw_fixups = fx;
+    if (!addr) {
+      uint8 b[3];
+      Dw_LEB128_U_3(b, 0);
+      return Dw_WriteBN(b, 3, offset);
+    }
+    loc = 0;
+  }
+  if (addr)
+    return Dw_WriteW_Relocated(loc, typearea_(q) == NULL ? dw_debug_sym : typearea_(q)->sym,
+                               offset);
+  return Dw_WriteLEB128_U(loc, offset);
+}
+
+#define IsRef_(f, v) \
+  ((f) == DW_FORM_ref_udata || ((f) == DW_FORM_indirect && (v).form == DW_FORM_ref_udata))
+
+static uint32 Dw_2_WriteItem(Dw_ItemList *p, uint32 offset) {
+  AttribVal w[ATTRIBBUFSIZE];
   AbbrevEntry const *abbrev = Dw_2_ItemEntry(p, w);
-  if (abbrev == NULL) return 0;
-  { Uint abbrevindex = Dw_2_AbbrevLookup(abbrev);
-    Uint i;
-    uint32 size = Dw_SizeLEB128_U(abbrevindex);
-    for (i = 0; ; i++) {
+  bool twin = NO;
+  Uint i;
+  if (abbrev == NULL) {
+    dbgloc_(p) = 0;
+    return offset;
+  }
+  for (i = 0; abbrev->attribs[i].form != 0; i++)
+    if (IsRef_(abbrev->attribs[i].form, w[i]) &&
+        typearea_((Dw_ItemList const *)w[i].p) != dw_unit)
+      twin = YES;
+  dbgloc_(p) = offset;
+  offset = Dw_WriteLEB128_U(twin ? Dw_2_AbbrevTwin(abbrev) : Dw_2_AbbrevLookup(abbrev), offset);
+  for (i = 0; ; i++)
+    if (abbrev->attribs[i].form == 0)
+      break;
+    else {
       Uint form = abbrev->attribs[i].form;
+      if (twin && form == DW_FORM_ref_udata) {
+        w[i].form = form; form = DW_FORM_indirect;
+      }
     indirect:
       switch (form) {
-      case 0:                return size;
-      case DW_FORM_indirect: form = w[i].form;
-                             size += Dw_SizeLEB128_U(form);
-                             if (form == DW_FORM_indirect) syserr("Dw_2_InfoItemSize indirect indirect");
-                             goto indirect;
+      default:               syserr("Dw_2_WriteInfo from %d", abbrev->attribs[i].form);
       case DW_FORM_flag:
-      case DW_FORM_data1:    size += 1; break;
-      case DW_FORM_data2:    size += 2; break;
+      case DW_FORM_data1:    offset = Dw_WriteB(w[i].i, offset); break;
+      case DW_FORM_data2:    offset = Dw_WriteH(w[i].i, offset); break;
+      case DW_FORM_data4:    offset = Dw_WriteW(w[i].i, offset); break;
+      case DW_FORM_data8:    offset = Dw_WriteL((uint32 const *)w[i].p, offset); break;
+      case DW_FORM_ref_udata:offset = Dw_2_WriteRef(&w[i], NO, offset); break;
+      case DW_FORM_ref_addr: offset = Dw_2_WriteRef(&w[i], YES, offset); break;
+      case DW_FORM_udata:    offset = Dw_WriteLEB128_U(w[i].i, offset); break;
+      case DW_FORM_string:   offset = Dw_WriteInlineString((char const *)w[i].p, offset); break;
       case DW_FORM_tref:
-      case DW_FORM_addr:
-      case DW_FORM_data4:    size += 4; break;
-      case DW_FORM_data8:    size += 8; break;
-      case DW_FORM_ref_udata:if (w[i].i == 0               /* forward reference before writing */
-                                 || (w[i].i & 0x80000000)) /* forward reference after writing */
-                               size += 3;
-                             else
-                               size += Dw_SizeLEB128_U(w[i].i);
-                             break;
-      case DW_FORM_udata:    size += Dw_SizeLEB128_U(w[i].i); break;
-      case DW_FORM_string:   size += (uint32)strlen((char const *)w[i].p)+1; break;
-      case DW_FORM_block:    size += blocksize_(w[i].i) + Dw_SizeLEB128_U(blocksize_(w[i].i)); break;
+      case DW_FORM_addr:     offset = Dw_WriteW_Relocated(w[i].i, (Symstr const *)w[i].p, offset); break;
+
+      case DW_FORM_indirect:
+        { uint32 n = form = w[i].form;
+          if (n == DW_FORM_string_expr)
+            n = DW_FORM_string;
+          else if (n == DW_FORM_ref_udata &&
+                   typearea_((Dw_ItemList const *)w[i].p) != dw_unit)
+            n = form = DW_FORM_ref_addr;
+          offset = Dw_WriteLEB128_U(n, offset);
+          goto indirect;
+        }
 
       case DW_FORM_string_expr:
         { StringSegList const *p = (StringSegList const *)w[i].p;
-          for (; p != NULL; p = p->strsegcdr) size += p->strseglen;
-          size += 1;
+          for (; p != NULL; p = p->strsegcdr)
+            offset = Dw_WriteBN((uint8 *)p->strsegbase, p->strseglen, offset);
+
+          offset = Dw_WriteB(0, offset);
         }
         break;
 
-      default:               syserr("Dw_2_InfoItemSize form %d", abbrev->attribs[i].form);
+      case DW_FORM_block:
+        offset = Dw_WriteLEB128_U(blocksize_(w[i].i), offset);
+        { uint8 const *p = (uint8 const *)w[i].p+1;
+          uint32 j = blockix_(w[i].i);
+          for (; *p != 0; p++, j++)
+            switch (*p) {
+            case DW_FORM_data1: offset = Dw_WriteB(w[j].i, offset); break;
+            case DW_FORM_data2: offset = Dw_WriteH(w[j].i, offset); break;
+            case DW_FORM_data4: offset = Dw_WriteW(w[j].i, offset); break;
+            case DW_FORM_addr:  offset = Dw_WriteW_Relocated(w[j].i, (Symstr const *)w[j].p, offset); break;
+            case DW_FORM_udata: offset = Dw_WriteLEB128_U(w[j].i, offset); break;
+            case DW_FORM_sdata: offset = Dw_WriteLEB128_S(w[j].i, offset); break;
+            default:            syserr("Dw_2_WriteInfo block op %d", *p);
+            }
+        }
       }
     }
+  return offset;
+}
+
+/* Shared types.  With -gt+t, each structure, union, class or enumeration */
+/* at the top level of the compilation unit is written, with its members */
+/* and nested types, as a unit of its own in a common area named by a    */
+/* signature of its contents, so that the linker keeps just one copy of  */
+/* it however many objects include it.  Derived types (pointers, arrays, */
+/* function types and so on) stay in the compilation unit, so the type   */
+/* units refer to them, and they to the types, across units.  The areas  */
+/* are made when the object's areas are numbered (dbg_debugareaexists),  */
+/* which is after the last item has been made.                           */
+
+static Dw_ItemList *Dw_2_Children(Dw_ItemList const *p) {
+  switch (debsort_(p)) {
+  case DW_TAG_structure_type:
+  case DW_TAG_union_type:
+  case DW_TAG_class_type:
+    return struct_children_(p);
+  case DW_TAG_enumeration_type:
+    return enum_children_(p);
+  case DW_TAG_procdecl:
+    return procdecl_children_(p);
+  default:
+    return NULL;
   }
 }
 
-static void Dw_RoundUp(uint32 offset) {
-  if ((offset & 3) != 0) {
-    uint32 w = 0;
-    obj_writedebug(&w, 4 - (offset & 3));
+/* Whether a child of a shared type goes with it */
+static bool Dw_2_InTypeUnit(Dw_ItemList const *p) {
+  switch (debsort_(p)) {
+  case DW_TAG_structure_type:
+  case DW_TAG_union_type:
+  case DW_TAG_class_type:
+  case DW_TAG_enumeration_type:
+  case DW_TAG_fref:
+  case DW_TAG_typedef:
+  case DW_TAG_member:
+  case DW_TAG_inheritance:
+  case DW_TAG_enumerator:
+  case DW_TAG_procdecl:
+  case DW_TAG_proctype_formal:
+  case DW_TAG_unspecified_parameters:
+  case TAG_padding:
+    return YES;
+  default:
+    return NO;
   }
 }
 
-void Dw_2_WriteInfo(void) {
-  Dw_ItemList *p;
-  uint32 infosize, offset;
+/* Items whose abbreviations say they have children must have had their */
+/* sibling chain terminated (a struct or enum without members does not). */
+static bool Dw_2_Shareable(Dw_ItemList const *p) {
+  Dw_ItemList const *c, *last = NULL;
+  switch (debsort_(p)) {
+  case DW_TAG_structure_type:
+  case DW_TAG_union_type:
+  case DW_TAG_class_type:
+  case DW_TAG_enumeration_type:
+  case DW_TAG_procdecl:
+    break;
+  default:
+    return YES;
+  }
+  for (c = Dw_2_Children(p); c != NULL; c = sibling_(c)) {
+    if (Dw_2_InTypeUnit(c) && !Dw_2_Shareable(c)) return NO;
+    last = c;
+  }
+  return last != NULL && debsort_(last) == TAG_padding;
+}
+
+static void Dw_2_MarkTypeUnit(Dw_ItemList *p, Dw_TypeArea *a) {
+  Dw_ItemList *c = Dw_2_Children(p);
+  typearea_(p) = a;
+  for (; c != NULL; c = sibling_(c))
+    if (Dw_2_InTypeUnit(c)) Dw_2_MarkTypeUnit(c, a);
+}
+
+static void Dw_2_NumberTypeUnit(Dw_ItemList *p, uint32 *n) {
+  Dw_ItemList *c = Dw_2_Children(p);
+  dbgloc_(p) = (*n)++;
+  for (; c != NULL; c = sibling_(c))
+    if (typearea_(c) == typearea_(p)) Dw_2_NumberTypeUnit(c, n);
+}
+
+static void Dw_2_HashBytes(Dw_Signature *s, uint8 const *b, uint32 n) {
+  uint32 h1 = s->h1, h2 = s->h2;
+  for (; n != 0; n--, b++) {
+    h1 = (h1 ^ *b) * 0x01000193;
+    h2 = (h2 ^ *b) * 0x5bd1e995; h2 ^= h2 >> 15;
+  }
+  s->h1 = h1; s->h2 = h2;
+}
+
+static void Dw_2_HashW(Dw_Signature *s, uint32 u) {
+  uint8 b[4];
+  b[0] = (uint8)u; b[1] = (uint8)(u >> 8); b[2] = (uint8)(u >> 16); b[3] = (uint8)(u >> 24);
+  Dw_2_HashBytes(s, b, 4);
+}
+
+static void Dw_2_HashString(Dw_Signature *s, char const *str) {
+  if (str == NULL)
+    Dw_2_HashW(s, 0);
+  else
+    Dw_2_HashBytes(s, (uint8 const *)str, (uint32)strlen(str) + 1);
+}
+
+#define TYPEKEYDEPTH 8
+
+/* What a type outside the unit is taken to be: its name where it has   */
+/* one, otherwise its structure (to a limited depth).                   */
+static void Dw_2_HashTypeKey(Dw_Signature *s, Dw_ItemList const *q, int depth) {
+  Dw_ItemList const *c;
+  if (q == NULL) {
+    Dw_2_HashW(s, 0);
+    return;
+  }
+  Dw_2_HashW(s, debsort_(q));
+  if (++depth > TYPEKEYDEPTH) return;
+  switch (debsort_(q)) {
+  case DW_TAG_base_type:
+    Dw_2_HashW(s, basetype_typecode_(q));
+    break;
+
+  case DW_TAG_typedef:
+    Dw_2_HashString(s, type_name_(q));
+    break;
+
+  case DW_TAG_fref:
+    Dw_2_HashW(s, struct_undefsort_(q));
+    Dw_2_HashString(s, struct_name_(q));
+    break;
+
+  case DW_TAG_structure_type:
+  case DW_TAG_union_type:
+  case DW_TAG_class_type:
+    Dw_2_HashString(s, struct_name_(q));
+    if (struct_name_(q) == NULL) {
+      Dw_2_HashW(s, struct_size_(q));
+      for (c = struct_children_(q); c != NULL; c = sibling_(c))
+        if (debsort_(c) == DW_TAG_member) {
+          Dw_2_HashString(s, member_name_(c));
+          Dw_2_HashW(s, member_offset_(c));
+          Dw_2_HashTypeKey(s, member_type_(c), depth);
+        }
+    }
+    break;
+
+  case DW_TAG_enumeration_type:
+    Dw_2_HashString(s, enum_name_(q));
+    if (enum_name_(q) == NULL) {
+      Dw_2_HashW(s, enum_size_(q));
+      for (c = enum_children_(q); c != NULL; c = sibling_(c))
+        if (debsort_(c) == DW_TAG_enumerator) {
+          Dw_2_HashString(s, enumerator_name_(c));
+          Dw_2_HashW(s, enumerator_val_(c));
+        }
+    }
+    break;
+
+  case DW_TAG_pointer_type:
+  case DW_TAG_const_type:
+  case DW_TAG_volatile_type:
+  case DW_TAG_reference_type:
+    Dw_2_HashTypeKey(s, qualtype_qualifiedtype_(q), depth);
+    break;
+
+  case DW_TAG_array_type:
+    Dw_2_HashW(s, array_open_(q));
+    Dw_2_HashW(s, array_upperbound_(q));
+    Dw_2_HashTypeKey(s, array_basetype_(q), depth);
+    break;
+
+  case DW_TAG_subroutine_type:
+    Dw_2_HashTypeKey(s, proctype_type_(q), depth);
+    for (c = proctype_children_(q); c != NULL; c = sibling_(c))
+      if (debsort_(c) == DW_TAG_proctype_formal)
+        Dw_2_HashTypeKey(s, formal_type_(c), depth);
+    break;
+
+  case DW_TAG_ptr_to_member_type:
+    Dw_2_HashTypeKey(s, ptrtomem_container_(q), depth);
+    Dw_2_HashTypeKey(s, ptrtomem_type_(q), depth);
+    break;
+
+  case DW_TAG_subprogram:
+    Dw_2_HashString(s, proc_name_(q));
+    break;
+
+  default:
+    break;
+  }
+}
+
+static void Dw_2_HashRef(Dw_Signature *s, AttribVal const *w, Dw_TypeArea const *a) {
+  Dw_ItemList const *q = (Dw_ItemList const *)w->p;
+  if (typearea_(q) == a) {
+    Dw_2_HashW(s, 1);
+    Dw_2_HashW(s, dbgloc_(q));
+  } else {
+    Dw_2_HashW(s, 2);
+    Dw_2_HashTypeKey(s, q, 0);
+  }
+}
+
+/* Hashes what Dw_2_WriteItem would write, with references within the   */
+/* unit by the order of their targets in it (set by NumberTypeUnit).    */
+static void Dw_2_HashTypeUnit(Dw_Signature *s, Dw_ItemList const *p) {
   AttribVal w[ATTRIBBUFSIZE];
-  dw_xrefs = NULL;
-  obj_startdebugarea(Dwarf2DebugAreaName);
-  for (infosize = 11, p = dw_list; p != NULL; p = cdr_(p)) {
-    uint32 n = Dw_2_InfoItemSize(p, w);
-    dbgloc_(p) = n == 0 ? 0 : infosize;
-    infosize += n;
+  AbbrevEntry const *abbrev = Dw_2_ItemEntry(p, w);
+  Dw_ItemList const *c;
+  Uint i;
+  if (abbrev == NULL) syserr("Dw_2_HashTypeUnit %d", debsort_(p));
+  Dw_2_HashW(s, Dw_2_AbbrevLookup(abbrev));
+  for (i = 0; abbrev->attribs[i].form != 0; i++) {
+    Uint form = abbrev->attribs[i].form;
+    if (form == DW_FORM_indirect) {
+      form = w[i].form;
+      Dw_2_HashW(s, form);
+    }
+    switch (form) {
+    case DW_FORM_ref_udata:
+      Dw_2_HashRef(s, &w[i], typearea_(p));
+      break;
+    case DW_FORM_string:
+      Dw_2_HashString(s, (char const *)w[i].p);
+      break;
+    case DW_FORM_string_expr:
+      { StringSegList const *p = (StringSegList const *)w[i].p;
+        for (; p != NULL; p = p->strsegcdr)
+          Dw_2_HashBytes(s, (uint8 const *)p->strsegbase, p->strseglen);
+        Dw_2_HashW(s, 0);
+      }
+      break;
+    case DW_FORM_data8:
+      Dw_2_HashW(s, ((uint32 const *)w[i].p)[0]);
+      Dw_2_HashW(s, ((uint32 const *)w[i].p)[1]);
+      break;
+    case DW_FORM_tref:
+    case DW_FORM_addr:
+      Dw_2_HashW(s, w[i].i);
+      Dw_2_HashString(s, symname_((Symstr const *)w[i].p));
+      break;
+    case DW_FORM_block:
+      Dw_2_HashW(s, w[i].i);
+      { uint8 const *b = (uint8 const *)w[i].p+1;
+        uint32 j = blockix_(w[i].i);
+        for (; *b != 0; b++, j++) {
+          Dw_2_HashW(s, w[j].i);
+          if (*b == DW_FORM_addr) Dw_2_HashString(s, symname_((Symstr const *)w[j].p));
+        }
+      }
+      break;
+    default:
+      Dw_2_HashW(s, w[i].i);
+      break;
+    }
   }
-  for (p = dw_list; p != NULL; p = cdr_(p)) {
-    if (dbgloc_(p) != 0) dbgloc_(p) |= 0x80000000;
+  for (c = Dw_2_Children(p); c != NULL; c = sibling_(c))
+    if (typearea_(c) == typearea_(p)) Dw_2_HashTypeUnit(s, c);
+}
+
+void Dw_2_NoteTypeAreas(Dw_ItemList *cu) {
+  Dw_TypeArea **tail = &dw_typeareas;
+  Dw_ItemList *p = sect_children_(cu);
+  for (; p != NULL; p = sibling_(p)) {
+    Dw_TypeArea *a, *b;
+    Dw_Signature sig;
+    uint32 n = 0;
+    switch (debsort_(p)) {
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_class_type:
+    case DW_TAG_enumeration_type:
+      if (Dw_2_Shareable(p)) break;
+    default:
+      continue;
+    }
+    a = (Dw_TypeArea *)GlobAlloc(SU_Dbg, sizeof(Dw_TypeArea));
+    Dw_2_MarkTypeUnit(p, a);
+    Dw_2_NumberTypeUnit(p, &n);
+    sig.h1 = 0x811c9dc5; sig.h2 = 0;
+    Dw_2_HashW(&sig, LanguageIsCPlusPlus ? LANG_C_PLUS_PLUS : LANG_C89);
+    Dw_2_HashTypeUnit(&sig, p);
+    for (b = dw_typeareas; b != NULL; b = cdr_(b))
+      if (b->sig.h1 == sig.h1 && b->sig.h2 == sig.h2) break;
+    if (b != NULL) {
+      /* Two types alike in one object: only the first is shared */
+      Dw_2_MarkTypeUnit(p, NULL);
+      continue;
+    }
+    { char name[sizeof(Dwarf2TypeAreaPrefix) + 16];
+      sprintf(name, "%s%08lx%08lx", Dwarf2TypeAreaPrefix, (long)sig.h1, (long)sig.h2);
+      a->name = strcpy((char *)GlobAlloc(SU_Dbg, (int32)strlen(name) + 1), name);
+    }
+    cdr_(a) = NULL; a->root = p; a->sig = sig;
+    a->start = a->size = 0; a->xrefs = NULL;
+    a->sym = obj_notecommondebugarea(a->name, Dwarf2DebugAreaName);
+    *tail = a; tail = &cdr_(a);
   }
-  offset = Dw_WriteW(infosize-4, 0);
+}
+
+static uint32 Dw_2_WriteTypeUnit(Dw_ItemList *p, uint32 offset) {
+  Dw_ItemList *c = Dw_2_Children(p);
+  offset = Dw_2_WriteItem(p, offset);
+  for (; c != NULL; c = sibling_(c))
+    if (typearea_(c) == typearea_(p)) offset = Dw_2_WriteTypeUnit(c, offset);
+  return offset;
+}
+
+void Dw_2_WriteInfo(void) {
+  Dw_ItemList *p;
+  Dw_TypeArea *a;
+  Dw_RefFixup *fx;
+  uint32 offset, size;
+  DataXref *xrefs;
+  dw_xrefs = NULL;
+  dw_fixups = NULL;
+  dw_unit = NULL; dw_unitstart = 0;
+  Dw_StartArea(Dwarf2DebugAreaName);
+  /* Items are given their offsets as they are written: until then, a    */
+  /* flagged dbgloc marks a forward reference, to be patched at the end. */
+  for (p = dw_list; p != NULL; p = cdr_(p)) dbgloc_(p) = 0x80000000;
+  offset = Dw_WriteW(0, 0);                   /* length, patched below */
   offset = Dw_WriteH(2, offset);
   offset = Dw_WriteW_Relocated(0, dw_abbrev_sym, offset);
   offset = Dw_WriteB(4, offset);
 
-  for (p = dw_list; p != NULL; p = cdr_(p)) {
-    AbbrevEntry const *abbrev = Dw_2_ItemEntry(p, w);
-    if (abbrev == NULL) continue;
-    { Uint abbrevindex = Dw_2_AbbrevLookup(abbrev);
-      Uint i;
-      dbgloc_(p) &= ~0x80000000;
-      if (offset != dbgloc_(p)) syserr("dw_2_writeinfo %lx != %lx", offset, dbgloc_(p));
-      offset = Dw_WriteLEB128_U(abbrevindex, offset);
-      for (i = 0; ; i++)
-        if (abbrev->attribs[i].form == 0)
-          break;
-        else {
-          Uint form = abbrev->attribs[i].form;
-        indirect:
-          switch (form) {
-          default:               syserr("Dw_2_WriteInfo from %d", abbrev->attribs[i].form);
-          case DW_FORM_flag:
-          case DW_FORM_data1:    offset = Dw_WriteB(w[i].i, offset); break;
-          case DW_FORM_data2:    offset = Dw_WriteH(w[i].i, offset); break;
-          case DW_FORM_data4:    offset = Dw_WriteW(w[i].i, offset); break;
-          case DW_FORM_data8:    offset = Dw_WriteL((uint32 const *)w[i].p, offset); break;
-          case DW_FORM_ref_udata:if (w[i].i & 0x80000000)
-                                   offset = Dw_WriteLEB128_U_3(w[i].i, offset);
-                                 else
-                                   offset = Dw_WriteLEB128_U(w[i].i, offset);
-                                 break;
-          case DW_FORM_udata:    offset = Dw_WriteLEB128_U(w[i].i, offset); break;
-          case DW_FORM_string:   offset = Dw_WriteInlineString((char const *)w[i].p, offset); break;
-          case DW_FORM_tref:
-          case DW_FORM_addr:     offset = Dw_WriteW_Relocated(w[i].i, (Symstr const *)w[i].p, offset); break;
-
-          case DW_FORM_indirect:
-            { uint32 n = form = w[i].form;
-              if (n == DW_FORM_string_expr) n = DW_FORM_string;
-              offset = Dw_WriteLEB128_U(n, offset);
-              goto indirect;
-            }
-
-          case DW_FORM_string_expr:
-            { StringSegList const *p = (StringSegList const *)w[i].p;
-              for (; p != NULL; p = p->strsegcdr)
-                offset = Dw_WriteBN((uint8 *)p->strsegbase, p->strseglen, offset);
+  for (p = dw_list; p != NULL; p = cdr_(p))
+    if (typearea_(p) == NULL) offset = Dw_2_WriteItem(p, offset);
+  Dw_PatchW(0, offset-4);
+  Dw_RoundUp(offset);
+  size = Dw_BufPos(); xrefs = dw_xrefs;
+
+  for (a = dw_typeareas; a != NULL; a = cdr_(a)) {
+    dw_xrefs = NULL;
+    dw_unit = a; dw_unitstart = a->start = Dw_BufPos();
+    offset = Dw_WriteW(0, 0);
+    offset = Dw_WriteH(2, offset);
+    offset = Dw_WriteW_Relocated(0, dw_abbrev_sym, offset);
+    offset = Dw_WriteB(4, offset);
+    offset = Dw_WriteLEB128_U(Dw_2_AbbrevLookup(&abbr_typeunit), offset);
+    offset = Dw_WriteB(LanguageIsCPlusPlus ? LANG_C_PLUS_PLUS : LANG_C89, offset);
+    offset = Dw_2_WriteTypeUnit(a->root, offset);
+    /* terminate the unit's children, and pad it within its length */
+    offset = Dw_WriteB(0, offset);
+    while ((offset & 3) != 0) offset = Dw_WriteB(0, offset);
+    Dw_PatchW(a->start, offset-4);
+    a->size = offset; a->xrefs = dw_xrefs;
+  }
+  dw_unit = NULL;
 
-              offset = Dw_WriteB(0, offset);
-            }
-            break;
-
-          case DW_FORM_block:
-            offset = Dw_WriteLEB128_U(blocksize_(w[i].i), offset);
-            { uint8 const *p = (uint8 const *)w[i].p+1;
-              uint32 j = blockix_(w[i].i);
-              for (; *p != 0; p++, j++)
-                switch (*p) {
-                case DW_FORM_data1: offset = Dw_WriteB(w[j].i, offset); break;
-                case DW_FORM_data2: offset = Dw_WriteH(w[j].i, offset); break;
-                case DW_FORM_data4: offset = Dw_WriteW(w[j].i, offset); break;
-                case DW_FORM_addr:  offset = Dw_WriteW_Relocated(w[j].i, (Symstr const *)w[j].p, offset); break;
-                case DW_FORM_udata: offset = Dw_WriteLEB128_U(w[j].i, offset); break;
-                case DW_FORM_sdata: offset = Dw_WriteLEB128_S(w[j].i, offset); break;
-                default:            syserr("Dw_2_WriteInfo block op %d", *p);
-                }
-            }
-          }
-        }
+  for (p = dw_list; p != NULL; p = cdr_(p))
+    if (dbgloc_(p) & 0x80000000) dbgloc_(p) = 0;
+  for (fx = dw_fixups; fx != NULL; fx = cdr_(fx))
+    if (fx->addr)
+      Dw_PatchW(fx->offset, dbgloc_(fx->item));
+    else {
+      uint8 b[3];
+      Dw_LEB128_U_3(b, dbgloc_(fx->item));
+      Dw_PatchBN(fx->offset, b, 3);
     }
+  Dw_WriteArea(Dwarf2DebugAreaName, xrefs, 0, size);
+  for (a = dw_typeareas; a != NULL; a = cdr_(a))
+    Dw_WriteArea(a->name, a->xrefs, a->start, a->size);
+}
+
+static uint32 Dw_2_WriteAbbrev(Uint i, AbbrevEntry const *abbr, bool twin, uint32 offset) {
+  AttribDesc const *attr = abbr->attribs;
+  offset = Dw_WriteLEB128_U(i, offset);
+  offset = Dw_WriteLEB128_U(abbr->tag, offset);
+  offset = Dw_WriteB(abbr->children, offset);
+  for (; ; attr++) {
+    Uint form = attr->form == DW_FORM_tref ? DW_FORM_data4 :
+                twin && attr->form == DW_FORM_ref_udata ? DW_FORM_indirect :
+                                                          attr->form;
+    offset = Dw_WriteLEB128_U(attr->attrib, offset);
+    offset = Dw_WriteLEB128_U(form, offset);
+    if (attr->attrib == 0) break;
   }
-  Dw_RoundUp(offset);
-  obj_enddebugarea(Dwarf2DebugAreaName, dw_xrefs);
+  return offset;
 }
 
 void Dw_2_WriteAbbrevs(void) {
   AbbrevEntry const * const *p = LanguageIsCPlusPlus ? abbrevlist_cpp : abbrevlist_c;
   Uint i;
   uint32 offset = 0;
-  obj_startdebugarea(AbbrevAreaName);
-  for (i = 1; p[i] != NULL; i++) {
-    AbbrevEntry const *abbr = p[i];
-    offset = Dw_WriteLEB128_U(i, offset);
-    offset = Dw_WriteLEB128_U(abbr->tag, offset);
-    offset = Dw_WriteB(abbr->children, offset);
-    { AttribDesc const *attr = abbr->attribs;
-      for (; ; attr++) {
-        offset = Dw_WriteLEB128_U(attr->attrib, offset);
-        offset = Dw_WriteLEB128_U(attr->form == DW_FORM_tref ? DW_FORM_data4 : attr->form, offset);
-        if (attr->attrib == 0) break;
-      }
-    }
+  Dw_StartArea(AbbrevAreaName);
+  for (i = 1; p[i] != NULL; i++)
+    offset = Dw_2_WriteAbbrev(i, p[i], NO, offset);
+  if (dw_typeareas != NULL) {
+    for (i = 1; p[i] != NULL; i++)
+      if (Dw_2_HasRefs(p[i]))
+        offset = Dw_2_WriteAbbrev(Dw_2_AbbrevTwin(p[i]), p[i], YES, offset);
+    offset = Dw_2_WriteAbbrev(Dw_2_AbbrevLookup(&abbr_typeunit), &abbr_typeunit, NO, offset);
   }
   offset = Dw_WriteLEB128_U(0, offset);
   Dw_RoundUp(offset);
-  obj_enddebugarea(AbbrevAreaName, NULL);
+  Dw_EndArea(AbbrevAreaName, NULL);
 }
 
 void Dw_2_WriteMacros(void) {
   Dw_MacroList *p;
   uint32 offset;
   dw_xrefs = NULL;
-  obj_startdebugarea(MacroAreaName);
+  Dw_StartArea(MacroAreaName);
   for (offset = 0, p = dw_macrolist; p != NULL; p = cdr_(p)) {
     offset = Dw_WriteB(p->sort, offset);
     switch (p->sort) {
@@ -1126,7 +1550,7 @@ void Dw_2_WriteMacros(void) {
   }
   offset = Dw_WriteB(0, offset);
   Dw_RoundUp(offset);
-  obj_enddebugarea(MacroAreaName, dw_xrefs);
+  Dw_EndArea(MacroAreaName, dw_xrefs);
 }
 
 #ifdef TARGET_HAS_HALFWORD_INSTRUCTIONS
@@ -1158,21 +1582,7 @@ static uint32 Dw_Write_LNS_OpS(Uint op, int32 operand, uint32 offset) {
    || ((codediff) == LNS_CODERANGE \
        && DW_LNS_Special_Op((linediff), (codediff)) <= 255))
 
-#define Write_LNS_OpU(op, arg, offset, write) \
-  ((write) ? Dw_Write_LNS_OpU(op, arg, offset) : (offset) + 1 + Dw_SizeLEB128_U(arg))
-#define Write_LNS_OpS(op, arg, offset, write) \
-  ((write) ? Dw_Write_LNS_OpS(op, arg, offset) : (offset) + 1 + Dw_SizeLEB128_S(arg))
-#define Write_LNS_NoOp(op, offset, write) \
-  ((write) ? Dw_WriteB(op, offset) : (offset) + 1)
-
-#define WriteB(b, offset, write) \
-  ((write) ? Dw_WriteB(b, offset) : (offset) + 1)
-#define WriteLEB128_U(n, offset, write) \
-  ((write) ? Dw_WriteLEB128_U(n, offset) : (offset) + Dw_SizeLEB128_U(n))
-#define WriteW_Relocated(n, sym, offset, write) \
-  ((write) ? Dw_WriteW_Relocated(n, sym, offset) : (offset) + 4)
-
-static uint32 Dw_2_ProcessLineList(uint32 offset, bool write) {
+static uint32 Dw_2_ProcessLineList(uint32 offset) {
   uint32 codeaddr = 0;
   Symstr *codeseg = NULL;
   int32 lineno = 1, column = 0;
@@ -1183,73 +1593,72 @@ static uint32 Dw_2_ProcessLineList(uint32 offset, bool write) {
     int32 linediff = (int32)lp->line - lineno;
     uint32 codediff = (lp->codeaddr - codeaddr) / AddressQuantum;
     if (fp != lp->file) {
-      offset = Write_LNS_OpU(DW_LNS_set_file, lp->file->index, offset, write);
+      offset = Dw_Write_LNS_OpU(DW_LNS_set_file, lp->file->index, offset);
       fp = lp->file;
     }
     if (lp->col != column) {
-      offset = Write_LNS_OpU(DW_LNS_set_column, lp->col, offset, write);
+      offset = Dw_Write_LNS_OpU(DW_LNS_set_column, lp->col, offset);
       changed = YES;
       column = lp->col;
     }
     if (codeseg != lp->codeseg) {
-      offset = WriteB(0, offset, write);  /* extended opcode escape */
-      offset = WriteLEB128_U(5, offset, write); /* length */
-      offset = WriteB(DW_LNE_set_address, offset, write);
-      offset = WriteW_Relocated(lp->codeaddr, lp->codeseg, offset, write);
+      offset = Dw_WriteB(0, offset);  /* extended opcode escape */
+      offset = Dw_WriteLEB128_U(5, offset); /* length */
+      offset = Dw_WriteB(DW_LNE_set_address, offset);
+      offset = Dw_WriteW_Relocated(lp->codeaddr, lp->codeseg, offset);
       codeseg = lp->codeseg;
       codeaddr = lp->codeaddr;
       if (linediff != 0) {
         lineno += linediff;
         if (linediff > 0 && linediff < LNS_RANGE) {
-          offset = Write_LNS_NoOp(DW_LNS_Special_Op(linediff, 0), offset, write);
+          offset = Dw_WriteB(DW_LNS_Special_Op(linediff, 0), offset);
           changed = NO;
           continue;
         }
-        offset = Write_LNS_OpS(DW_LNS_advance_line, linediff, offset, write);
+        offset = Dw_Write_LNS_OpS(DW_LNS_advance_line, linediff, offset);
       }
-      offset = Write_LNS_NoOp(DW_LNS_copy, offset, write);
+      offset = Dw_WriteB(DW_LNS_copy, offset);
       changed = NO;
       continue;
     }
     if (linediff < 0 || linediff >= LNS_RANGE) {
-      offset = Write_LNS_OpS(DW_LNS_advance_line, linediff, offset, write);
+      offset = Dw_Write_LNS_OpS(DW_LNS_advance_line, linediff, offset);
       lineno += linediff;
       changed = YES;
       linediff = 0;
     }
     if (codediff > LNS_SPECIAL_MAX_PC
         && CanUseSpecialOp(linediff, codediff - LNS_SPECIAL_MAX_PC)) {
-      offset = Write_LNS_NoOp(DW_LNS_const_add_pc, offset, write);
+      offset = Dw_WriteB(DW_LNS_const_add_pc, offset);
       codeaddr += LNS_SPECIAL_MAX_PC * AddressQuantum;
       codediff -= LNS_SPECIAL_MAX_PC;
       changed = YES;
     }
     if (!CanUseSpecialOp(linediff, codediff)) {
-      offset = Write_LNS_OpU(DW_LNS_advance_pc, codediff, offset, write);
+      offset = Dw_Write_LNS_OpU(DW_LNS_advance_pc, codediff, offset);
       codeaddr += codediff * AddressQuantum;
       codediff = 0;
       changed = YES;
     }
     if (linediff == 0 && codediff == 0) {
-      if (changed) offset = Write_LNS_NoOp(DW_LNS_copy, offset, write);
+      if (changed) offset = Dw_WriteB(DW_LNS_copy, offset);
     } else {
       lineno += linediff; codeaddr += codediff * AddressQuantum;
-      offset = Write_LNS_NoOp(DW_LNS_Special_Op(linediff, codediff), offset, write);
+      offset = Dw_WriteB(DW_LNS_Special_Op(linediff, codediff), offset);
     }
     changed = NO;
     if (cdr_(lp) == NULL || cdr_(lp)->codeseg != codeseg) {
       lineno = 1; column = 0;
-      offset = WriteB(0, offset, write);  /* extended opcode escape */
-      offset = WriteLEB128_U(1, offset, write); /* length */
-      offset = WriteB(DW_LNE_end_sequence, offset, write);
+      offset = Dw_WriteB(0, offset);  /* extended opcode escape */
+      offset = Dw_WriteLEB128_U(1, offset); /* length */
+      offset = Dw_WriteB(DW_LNE_end_sequence, offset);
     }
   }
   return offset;
 }
 
 void Dw_2_WriteLineinfo(void) {
-  uint32 offset, headerlen = 17+DW_LNS_LAST;
-  uint32 infosize;
+  uint32 offset;
   Dw_FileList *fp;
   Dw_PathList *pp;
 
@@ -1262,31 +1671,16 @@ void Dw_2_WriteLineinfo(void) {
         (LanguageIsCPlusPlus) ? dw_mapped_codebase+dw_mapped_codep : codebase+codep;
   }
   dw_pathlist = (Dw_PathList *)dreverse((List *)dw_pathlist);
-  for (pp = dw_pathlist; pp != NULL; pp = cdr_(pp))
-    headerlen += (uint32)strlen(pp->name) + 1;
-
   dw_filelist = (Dw_FileList *)dreverse((List *)dw_filelist);
   if (dw_filelist->index == 0)
     dw_filelist = cdr_(dw_filelist);
-  for (fp = dw_filelist; fp != NULL; fp = cdr_(fp)) {
-    char const *name = fp->filename;
-    Uint ix = 0;
-    if (fp->dir != NULL) {
-      name += fp->dir->len;
-      ix = fp->dir->index;
-    }
-    headerlen += (uint32)strlen(name) + 1 +
-                 Dw_SizeLEB128_U(ix) +
-                 Dw_SizeLEB128_U(fp->timestamp) +
-                 Dw_SizeLEB128_U(fp->filelength);
-  }
-  infosize = Dw_2_ProcessLineList(headerlen, NO);
+
   dw_xrefs = NULL;
-  obj_startdebugarea(Dwarf2LineInfoAreaName);
+  Dw_StartArea(Dwarf2LineInfoAreaName);
   offset = 0;
-  offset = Dw_WriteW(infosize - 4, offset);   /* end of area, relative to here */
+  offset = Dw_WriteW(0, offset);              /* end of area, patched below */
   offset = Dw_WriteH(1, offset);
-  offset = Dw_WriteW(headerlen - 10, offset); /* end of header, relative to here */
+  offset = Dw_WriteW(0, offset);              /* end of header, patched below */
   offset = Dw_WriteB(AddressQuantum, offset);
   offset = Dw_WriteB(1, offset);              /* all entries start a statement */
   offset = Dw_WriteB(0, offset);              /* line-base */
@@ -1311,9 +1705,11 @@ void Dw_2_WriteLineinfo(void) {
     offset = Dw_WriteLEB128_U(fp->filelength, offset);
   }
   offset = Dw_WriteB(0, offset);              /* terminator */
-  offset = Dw_2_ProcessLineList(offset, YES);
+  Dw_PatchW(6, offset - 10);                  /* relative to the end of the field */
+  offset = Dw_2_ProcessLineList(offset);
+  Dw_PatchW(0, offset - 4);                   /* relative to here */
   Dw_RoundUp(offset);
-  obj_enddebugarea(Dwarf2LineInfoAreaName, dw_xrefs);
+  Dw_EndArea(Dwarf2LineInfoAreaName, dw_xrefs);
 }
 
 #else
@@ -1320,7 +1320,11 @@ static int32 adjusted_stack_size(int32 stack_size, Icode *code, int32 n) {
 
 #define Bpcc_No 255
 
-static int CondMax_Ordinary, CondMax_Loop;
+#ifndef target_branch_penalty
+#  define target_branch_penalty 2   /* cycles lost by a taken branch */
+#endif
+
+static int CondMax_Ordinary, CondMax_Loop, CondMax_Pair;
 
 static int block_preserves_cc(BlockHead *b, int fl, int maxl)
 /* True if the block does not contain any instructions that would cause  */
@@ -1380,6 +1384,7 @@ static void show_conditional_block(int32 cond, BlockHead *p, bool showbranch)
     }
     prevblock = NULL;
     set_cond_execution(Q_AL);
+    cgstate.branches_removed++;
 }
 
 #define EQ_COND(x) (((x) | Q_UBIT) == Q_UEQ || ((x) | Q_UBIT) == Q_UNE)
@@ -1397,6 +1402,7 @@ static void show_blockchain(BlockHead *b, BlockList *bl, int32 cond) {
     set_cond_execution(cond);
     for (; bl != NULL; bl = bl->blklstcdr)
     {   b = bl->blklstcar;
+        cgstate.branches_removed++;
         cond = blkflags_(b) & Q_MASK;
         if (!EQ_COND(cond) || bl->blklstcdr != NULL)
             cond = Q_UKN;
@@ -1488,6 +1494,7 @@ static void show_block_pair(int32 cond, BlockHead *b1, BlockHead *b2, CommonInst
     blkflags_(b1) |= BLKCODED;
     blkflags_(b2) |= BLKCODED;
     set_cond_execution(Q_AL);
+    cgstate.branches_removed += 2;
 }
 
 static bool successor_inline(BlockHead *b) {
@@ -1698,7 +1705,8 @@ static LabelNumber *use_cond_field(BlockHead *p)
                        lab_xname_(blklab_(p)),
                        lab_xname_(next), condb, lcondb,
                        lab_xname_(next1), condb1, lcondb1);
-            if (condb <= CondMax_Ordinary && condb1 <= CondMax_Ordinary &&
+            if (condb <= CondMax_Loop && condb1 <= CondMax_Loop &&
+                condb + condb1 <= CondMax_Pair &&
                 blknext_(b) == blknext_(b1))
             {   CommonInst *c = common_insts(b1, b);
                 show_head(p, cond);
@@ -1813,6 +1821,7 @@ static LabelNumber *use_cond_field(BlockHead *p)
 /* block getting spuriously displayed again later.  It therefore        */
 /* requires the block_single_entryexit() condition.                     */
                 blkflags_(b) |= BLKCODED, blkflags_(b1) |= BLKCODED;
+                cgstate.branches_removed += 2;
                 return blknext_(b) == way_out ? RETLAB : blknext_(b);
             }
 /* Other cases worth searching for?                                     */
@@ -3449,6 +3458,7 @@ void flowgraph_reinit(void)
     currentblock = icodetop = (Icode *) DUFF_ADDR;
                                         /* NB. (currentblock >= icodetop) */
     cgstate.icode_cur = cgstate.block_cur = 0;
+    cgstate.branches_removed = 0;
     icoden = 0;
     bottom_block = 0, block_header = (BlockHead*) DUFF_ADDR;
     deadcode = 1;
@@ -3465,9 +3475,16 @@ void flowgraph_reinit(void)
     }
     else
     {
-        CondMax_Loop = 6;
-        CondMax_Ordinary = 3;
-    }
+/* Executing n instructions conditionally costs n cycles whichever way  */
+/* the condition goes, while branching round them costs the branch plus */
+/* the pipeline refill when it is taken.  So a block is only worth      */
+/* conditionalising if it is no longer than a taken branch, or twice    */
+/* that inside a loop or where the pair of arms of an if/else are both  */
+/* replaced (saving a taken branch on either path).                     */
+        CondMax_Ordinary = 1 + target_branch_penalty;
+        CondMax_Loop = 2 * CondMax_Ordinary;
+    }
+    CondMax_Pair = CondMax_Loop;
 #endif
 }
 
@@ -33,6 +33,7 @@ extern struct CGState {
 
   /* statistics */
     int32 icode_cur, block_cur;
+    int32 branches_removed;     /* by conditional execution / SCCK */
 
     struct {
         Binder *var;
@@ -295,6 +295,7 @@ typedef struct CurrentFnDetails {
     int32 maxargsize;
     int32 argwords;
     int32 fltargwords;
+    uint32 fltargsingles;     /* bit i: fp reg arg i is single precision */
     BindList *argbindlist;
     int32 fnname_offset;      /* for xxx/gen.c    */
     FileLine fl;
@@ -27,6 +27,7 @@
 #include "aetree.h"
 #include "bind.h"
 #include "jopcode.h"
+#include "xrefs.h"
 #include "inline.h"
 #include "cg.h"
 #include "regsets.h"
@@ -107,6 +108,69 @@ typedef struct {
 
 static SavedFnList *saved_fns;
 
+/* Functions whose code generation is deferred to the end of the unit   */
+/* (unit-at-a-time): see Inline_Defer() and Inline_CompileDeferred().    */
+typedef struct DeferredFn DeferredFn;
+struct DeferredFn {
+  DeferredFn *cdr;
+  DeferredFn *hashcdr;
+  SavedFnList *sf;
+  int32 pragmas['z'-'a'+1];     /* pp_pragmavec at the end of its body */
+  bool root;
+  int state;
+};
+
+#define DF_Pending 0
+#define DF_Active 1             /* its callees are being compiled */
+#define DF_Compiled 2
+
+/* Once the saved flowgraphs occupy this much global store, functions are */
+/* again compiled as they are read.                                        */
+#define DEFER_STORE_LIMIT 0x1000000L
+
+static DeferredFn *deferred_fns;
+static DeferredFn **deferred_index;
+static int32 deferred_indexsize;
+static int32 deferred_store;
+static SavedFnList *deferred_current;   /* the one being compiled */
+
+#ifndef NO_DUMP_STATE
+typedef struct SummaryFn SummaryFn;
+struct SummaryFn {
+  SummaryFn *cdr;
+  SavedFnList *sf;
+  uint32 nglobals;
+  Binder **globals;     /* placeholders for globals referenced by name */
+  uint32 nsig;
+  int32 *sig;           /* mcreps of the arguments, then of the result */
+  int state;
+};
+
+#define SS_Pending 0
+#define SS_Resolved 1
+#define SS_Rejected 2
+
+static SavedFnList *summary_fns;  /* to be written by Inline_WriteSummaries */
+static SummaryFn *imported_fns;
+
+/* Register usage summaries: the registers corrupted by an external     */
+/* function defined in another unit, for calls to it from this one.     */
+typedef struct RegSummary RegSummary;
+struct RegSummary {
+  RegSummary *cdr;
+  Symstr *sym;
+  uint32 nsig;
+  int32 *sig;
+  RealRegSet usedregs;
+  int state;
+};
+
+#define REGSUMMARY_HASHSIZE 256
+
+static BindList *regsummary_fns;  /* external functions defined here */
+static RegSummary *imported_regs[REGSUMMARY_HASHSIZE];
+#endif
+
 Inline_SavedFn *Inline_FindFn(Binder *b) {
   SavedFnList *fn = (SavedFnList *)bindinline_(b);
   if (fn != NULL)
@@ -360,10 +424,14 @@ static LabelNumber *LabelNo_NoteRef(LabelNumber *l, uint8 *justoneref, uint8 *an
   return (LabelNumber *)(IPtr)lno;
 }
 
-bool Inline_Save(Binder *b, BindList *local_binders, BindList *regvar_binders) {
+/* Copies the flowgraph of the current function to global store.  Only  */
+/* an inline function's copy is attached to its binder (so that calls     */
+/* may expand it) and queued for an out-of-line copy; see Inline_Defer(). */
+static SavedFnList *SaveFn(Binder *b, BindList *local_binders,
+                           BindList *regvar_binders, bool inlinable) {
   SavedFnList *p = NewGlob(SavedFnList, SU_Inline);
   SaveFnState st;
-  bindinline_(b) = p;
+  if (inlinable) bindinline_(b) = p;
   p->outoflineflags = (attributes_(b) & A_REALUSE) ? ol_used : 0;
   st.copied = NULL;
   st.sharedbindlists = NULL;
@@ -371,7 +439,7 @@ bool Inline_Save(Binder *b, BindList *local_binders, BindList *regvar_binders) {
   p->fn.fndetails = currentfunction;
   if (p->fn.fndetails.structresult != NULL)
     p->fn.fndetails.structresult = GlobalBinderCopy(&st, p->fn.fndetails.structresult);
-  if (p->fn.fndetails.xrflags & xr_defext)
+  if (inlinable && (p->fn.fndetails.xrflags & xr_defext))
     Inline_RealUse(b);
   p->fn.fndetails.argbindlist = GlobalBindListCopy(&st, p->fn.fndetails.argbindlist);
   p->fn.var_binders = GlobalBindListCopy(&st, local_binders);
@@ -566,7 +634,8 @@ bool Inline_Save(Binder *b, BindList *local_binders, BindList *regvar_binders) {
       p->sort = IS_Ord;
   }
   if (debugging(DEBUG_CG)) {
-    cc_msg("Inline_Save %s", symname_(p->fn.fndetails.symstr));
+    cc_msg("%s %s", inlinable ? "Inline_Save" : "Inline_Defer",
+           symname_(p->fn.fndetails.symstr));
     if (p->sort == IS_Dtor) {
       cc_msg(": Dtor: %x\n", blklab_(p->a.dtor));
     } else if (p->sort == IS_Ctor) {
@@ -580,8 +649,15 @@ bool Inline_Save(Binder *b, BindList *local_binders, BindList *regvar_binders) {
     } else
       cc_msg("\n");
   }
-  cdr_(p) = saved_fns;
-  saved_fns = p;
+  if (inlinable) {
+    cdr_(p) = saved_fns;
+    saved_fns = p;
+  }
+  return p;
+}
+
+bool Inline_Save(Binder *b, BindList *local_binders, BindList *regvar_binders) {
+  SaveFn(b, local_binders, regvar_binders, YES);
   return YES;
 }
 
@@ -656,6 +732,8 @@ static BindList *BindListCopy(BindList *bl) {
 
 static SavedFnList *FindSavedFn(Inline_SavedFn *fn) {
   SavedFnList *p;
+  if (deferred_current != NULL && fn == &deferred_current->fn)
+    return deferred_current;
   for (p = saved_fns; p != NULL; p = cdr_(p))
     if (fn->fndetails.symstr == p->fn.fndetails.symstr)
       return p;
@@ -722,7 +800,13 @@ void Inline_Restore(Inline_SavedFn *fn, Inline_RestoreControl *rc) {
   BlockHead *dtorlast = NULL;
   BlockHead *bottom = p->fn.bottom_block;
   bool skipblock2 = NO;
-  while (--n >= 0) vt[n].r = n <= NMAGICREGS ? n : vregister(vt[n].rs);
+  if (rc == NULL) {
+    /* An out-of-line copy: keep the original numbering (and so the same */
+    /* register allocation as if the function had been compiled at once) */
+    int32 i;
+    for (i = 0; i < n; i++) vt[i].r = i <= NMAGICREGS ? i : vregister(vt[i].rs);
+  } else
+    while (--n >= 0) vt[n].r = n <= NMAGICREGS ? n : vregister(vt[n].rs);
   st.copied = NULL;
   st.sharedbindlists = NULL;
   st.vregindex = p->vregtypetab;
@@ -1162,6 +1246,14 @@ maybeswitchblock :
 
 void Inline_Init(void) {
   saved_fns = NULL;
+  deferred_fns = NULL;
+  deferred_store = 0;
+#ifndef NO_DUMP_STATE
+  summary_fns = NULL;
+  imported_fns = NULL;
+  regsummary_fns = NULL;
+  memset(imported_regs, 0, sizeof(imported_regs));
+#endif
 }
 
 static void Inline_CompileOutOfLineCopy(Inline_SavedFn *fn) {
@@ -1177,6 +1269,106 @@ static void Inline_CompileOutOfLineCopy(Inline_SavedFn *fn) {
   cg_topdecl2(fn->var_binders, fn->reg_binders);
 }
 
+bool Inline_Defer(Binder *b, BindList *local_binders, BindList *regvar_binders) {
+  DeferredFn *d;
+  int32 use = alloc_globaluse();
+  if (deferred_store > DEFER_STORE_LIMIT) return NO;
+  d = NewGlob(DeferredFn, SU_Inline);
+  d->sf = SaveFn(b, local_binders, regvar_binders, NO);
+  memcpy(d->pragmas, pp_pragmavec, sizeof(d->pragmas));
+  d->root = NO;
+  d->state = DF_Pending;
+  cdr_(d) = deferred_fns;
+  deferred_fns = d;
+  deferred_store += alloc_globaluse() - use;
+  return YES;
+}
+
+static DeferredFn *FindDeferredFn(Symstr *sym) {
+  DeferredFn *d = deferred_index[((IPtr)sym >> 2) % deferred_indexsize];
+  for (; d != NULL; d = d->hashcdr)
+    if (d->sf->fn.fndetails.symstr == sym)
+      return d;
+  return NULL;
+}
+
+/* Applies f to each deferred function called or addressed by the saved  */
+/* flowgraph starting at top: the arcs of the call graph.                */
+static void DeferredRefs(BlockHead *top, void (*f)(DeferredFn *)) {
+  BlockHead *b;
+  for (b = top; b != NULL; b = blkdown_(b)) {
+    Icode *ic = blkcode_(b);
+    int32 n;
+    for (n = blklength_(b); --n >= 0; ic++) {
+      J_OPCODE op = ic->op & J_TABLE_BITS;
+      if (op == J_CALLK || op == J_TAILCALLK || op == J_ADCON) {
+        DeferredFn *d = FindDeferredFn(bindsym_(ic->r3.b));
+        if (d != NULL) f(d);
+      }
+    }
+  }
+}
+
+static void MarkRoot(DeferredFn *d) {
+  d->root = YES;
+}
+
+/* Compiles d after its callees, so that their register usage is known   */
+/* at its calls.  Recursive calls are left as calls of unknown functions. */
+static void CompileDeferredFn(DeferredFn *d) {
+  if (d->state != DF_Pending) return;
+  d->state = DF_Active;
+  DeferredRefs(d->sf->fn.top_block, CompileDeferredFn);
+  memcpy(pp_pragmavec, d->pragmas, sizeof(d->pragmas));
+  cg_reinit();
+  phasename = "loopopt";
+  current_fl = &currentfunction.fl;
+  deferred_current = d->sf;
+  Inline_CompileOutOfLineCopy(&d->sf->fn);
+  deferred_current = NULL;
+  symext_(currentfunction.symstr)->usedregs = regmaskvec;
+  currentfunction.symstr = NULL;
+  drop_local_store();
+  d->state = DF_Compiled;
+}
+
+void Inline_CompileDeferred(void) {
+  int32 pragmas['z'-'a'+1];
+  DeferredFn *d;
+  SavedFnList *p;
+  int32 n = 0;
+  if (deferred_fns == NULL) return;
+  deferred_fns = (DeferredFn *)dreverse((List *)deferred_fns);
+  for (d = deferred_fns; d != NULL; d = cdr_(d)) n++;
+  deferred_indexsize = n;
+  deferred_index = NewGlobN(DeferredFn *, SU_Inline, n);
+  memset(deferred_index, 0, (size_t)n * sizeof(DeferredFn *));
+  for (d = deferred_fns; d != NULL; d = cdr_(d)) {
+    DeferredFn **dp = &deferred_index[((IPtr)d->sf->fn.fndetails.symstr >> 2) % n];
+    d->hashcdr = *dp;
+    *dp = d;
+  }
+  /* The roots of the call graph: external functions, those referenced   */
+  /* already (from static data, or by a function compiled as it was read) */
+  /* and those referenced from inline functions.                          */
+  for (d = deferred_fns; d != NULL; d = cdr_(d))
+    if ((d->sf->fn.fndetails.xrflags & xr_defext) ||
+        symext_(d->sf->fn.fndetails.symstr) != NULL)
+      d->root = YES;
+  for (p = saved_fns; p != NULL; p = cdr_(p))
+    DeferredRefs(p->fn.top_block, MarkRoot);
+  memcpy(pragmas, pp_pragmavec, sizeof(pragmas));
+  for (d = deferred_fns; d != NULL; d = cdr_(d))
+    if (d->root) CompileDeferredFn(d);
+  memcpy(pp_pragmavec, pragmas, sizeof(pragmas));
+  if (debugging(DEBUG_CG))
+    for (d = deferred_fns; d != NULL; d = cdr_(d))
+      if (d->state == DF_Pending)
+        cc_msg("Inline_CompileDeferred: %s unreferenced\n",
+               symname_(d->sf->fn.fndetails.symstr));
+  deferred_fns = NULL;
+}
+
 void Inline_Tidy(void) {
   SavedFnList *p;
   for (;;) {
@@ -1392,4 +1584,676 @@ void Inline_DumpState(FILE *f) {
     }
   }
 }
+
+/* Inline summaries.                                                    */
+/* The saved flowgraphs of small external functions can be written to  */
+/* a sidecar file (-zgs) and read by other compilation units (-zgi),    */
+/* which may then expand calls to them inline.  Unlike the compiled     */
+/* header dump above, a summary file stands alone: the local binders of */
+/* each function are written out in full, and globals are referred to   */
+/* by name and resolved against the importing unit's declarations when  */
+/* the function is first called there.                                  */
+/* The file ends with the registers corrupted by each external function */
+/* compiled, whatever its size: calls to these from an importing unit   */
+/* need not assume that every argument register is lost.                */
+
+#define SUMMARY_MAXICODE 16     /* larger functions are not summarised  */
+
+typedef struct {
+  Binder **b;
+  BindList **bl;
+  uint32 nb, nbl, maxb, maxbl;
+} SummaryIndex;
+
+static bool Summary_SimpleType(TypeExpr *t) {
+  return h0_(t) == s_typespec &&
+         !(typespecmap_(t) & (ENUMORCLASSBITS|bitoftype_(s_typedefname)));
+}
+
+static bool Summary_BinderOK(Binder *b) {
+  if (b == NULL) return YES;
+  if (bindstg_(b) & bitofstg_(s_auto))
+    return bindmcrep_(b) != NOMCREPCACHE;
+  /* Anything else must be visible (by name) from another unit */
+  return (bindstg_(b) & bitofstg_(s_extern)) &&
+         !(bindstg_(b) & (bitofstg_(s_static)|b_globalregvar));
+}
+
+static bool Summary_BindListOK(BindList *bl) {
+  for (; bl != NULL; bl = bl->bindlistcdr)
+    if (!Summary_BinderOK(bl->bindlistcar)) return NO;
+  return YES;
+}
+
+static bool Summary_Transportable(SavedFnList *p, Binder *fb) {
+  BlockHead *b;
+  int32 size = 0;
+  Inline_ArgDesc *ad;
+  if (p->sort != IS_Ord || fntypeisvariadic(bindtype_(fb)) ||
+      !Summary_BinderOK(p->fn.fndetails.structresult) ||
+      !Summary_BindListOK(p->fn.fndetails.argbindlist) ||
+      !Summary_BindListOK(p->fn.var_binders) ||
+      !Summary_BindListOK(p->fn.reg_binders))
+    return NO;
+  for (ad = argdesc_(p); ad != NULL; ad = adcdr_(ad))
+    if (ad->abl.narrowtype != NULL && !Summary_SimpleType(ad->abl.narrowtype))
+      return NO;
+  for (b = p->fn.top_block; b != NULL; b = blkdown_(b)) {
+    Icode *ic = blkcode_(b);
+    int32 n = blklength_(b);
+    if ((size += n) > SUMMARY_MAXICODE || !Summary_BindListOK(blkstack_(b)))
+      return NO;
+    for (; --n >= 0; ic++) {
+      J_OPCODE op = ic->op & J_TABLE_BITS;
+      /* Operands which are pointers to things we cannot write out */
+      if (floatiness_(op) != 0) return NO;
+      switch (op) {
+      case J_ADCONLL: case J_TAILCALLK:
+      case J_INFOLINE: case J_INFOSCOPE: case J_INFOBODY: case J_COUNT:
+      case J_WORD_ADCON: case J_WORD_LABEL: case J_CASEBRANCH:
+      case J_THUNKTABLE: case J_TYPECASE: case J_ORG:
+        return NO;
+      case J_SETSPENV:
+        if (!Summary_BindListOK(ic->r3.bl)) return NO;
+        /* fall through */
+      case J_SETSPGOTO:
+        if (!Summary_BindListOK(ic->r2.bl)) return NO;
+        break;
+      default:
+        if ((uses_stack(op) || op == J_CALLK || op == J_ADCON || op == J_ADCONV ||
+             op == J_INIT || op == J_INITF || op == J_INITD) &&
+            !Summary_BinderOK(ic->r3.b))
+          return NO;
+      }
+    }
+  }
+  return YES;
+}
+
+void Inline_SaveSummary(Binder *b, BindList *local_binders, BindList *regvar_binders) {
+  SavedFnList *p;
+  BlockHead *bh;
+  int32 size = 0;
+  if (!(dump_state & DS_Summary)) return;
+  regsummary_fns = (BindList *)global_cons2(SU_Inline, regsummary_fns, b);
+  for (bh = top_block; bh != NULL; bh = blkdown_(bh))
+    if ((size += blklength_(bh)) > SUMMARY_MAXICODE) return;
+  if (!Inline_Save(b, local_binders, regvar_binders)) return;
+  /* Inline_Save has made the function available for inlining in this   */
+  /* unit too: undo that, as it is about to be compiled out of line.     */
+  p = saved_fns; saved_fns = cdr_(p);
+  bindinline_(b) = NULL;
+  if (Summary_Transportable(p, b)) {
+    cdr_(p) = summary_fns; summary_fns = p;
+  } else if (debugging(DEBUG_CG))
+    cc_msg("Inline summary of %s not written\n", symname_(bindsym_(b)));
+}
+
+static uint32 Summary_BinderRef(SummaryIndex *x, Binder *b);
+
+static uint32 Summary_ListRef(SummaryIndex *x, BindList *bl) {
+  uint32 i;
+  if (bl == NULL) return 0;
+  for (i = 1; i <= x->nbl; i++)
+    if (x->bl[i] == bl) return i;
+  if (x->nbl+1 >= x->maxbl) {
+    BindList **v = NewSynN(BindList *, 2*x->maxbl);
+    memcpy(v, x->bl, x->maxbl * sizeof(BindList *));
+    x->bl = v; x->maxbl *= 2;
+  }
+  x->bl[i = ++x->nbl] = bl;
+  Summary_ListRef(x, bl->bindlistcdr);
+  Summary_BinderRef(x, bl->bindlistcar);
+  return i;
+}
+
+static uint32 Summary_BinderRef(SummaryIndex *x, Binder *b) {
+  uint32 i;
+  if (b == NULL) return 0;
+  for (i = 1; i <= x->nb; i++)
+    if (x->b[i] == b) return i;
+  if (x->nb+1 >= x->maxb) {
+    Binder **v = NewSynN(Binder *, 2*x->maxb);
+    memcpy(v, x->b, x->maxb * sizeof(Binder *));
+    x->b = v; x->maxb *= 2;
+  }
+  x->b[i = ++x->nb] = b;
+  if ((bindstg_(b) & bitofstg_(s_auto)) && (bindstg_(b) & b_bindaddrlist))
+    Summary_ListRef(x, bindbl_(b));
+  return i;
+}
+
+static void Summary_WriteName(Symstr *sym, FILE *f) {
+  uint32 len = (uint32)strlen(symname_(sym));
+  fwrite(&len, sizeof(uint32), 1, f);
+  fwrite(symname_(sym), 1, (size_t)len, f);
+}
+
+/* A function's signature is the mcreps of its arguments, then of its  */
+/* result.                                                              */
+static int32 *Summary_Sig(TypeExpr *t, uint32 *nsig) {
+  FormTypeList *ft = typefnargs_(t);
+  uint32 i = 0, n = length((List *)ft) + 1;
+  int32 *sig = NewSynN(int32, n);
+  for (; ft != NULL; ft = ft->ftcdr)
+    sig[i++] = mcrepoftype(ft->fttype);
+  sig[i] = mcrepoftype(typearg_(t));
+  *nsig = n;
+  return sig;
+}
+
+static void Summary_WriteSig(TypeExpr *t, FILE *f) {
+  uint32 n;
+  int32 *sig = Summary_Sig(princtype(t), &n);
+  fwrite(&n, sizeof(uint32), 1, f);
+  fwrite(sig, sizeof(int32), (size_t)n, f);
+}
+
+static int32 *Summary_ReadSig(FILE *f, uint32 *nsig) {
+  int32 *sig;
+  fread(nsig, sizeof(uint32), 1, f);
+  sig = NewGlobN(int32, SU_Inline, *nsig);
+  fread(sig, sizeof(int32), (size_t)*nsig, f);
+  return sig;
+}
+
+/* The declaration seen here must agree with the definition summarised */
+static bool Summary_SigMatches(TypeExpr *t, uint32 nsig, int32 const *sig) {
+  FormTypeList *ft;
+  uint32 i;
+  if (h0_(t) != t_fnap || fntypeisvariadic(t)) return NO;
+  for (i = 0, ft = typefnargs_(t); ft != NULL; ft = ft->ftcdr, i++)
+    if (i+1 >= nsig || mcrepoftype(ft->fttype) != sig[i]) return NO;
+  return i+1 == nsig && mcrepoftype(typearg_(t)) == sig[i];
+}
+
+static void Summary_WriteBindList(SummaryIndex *x, BindList *bl, FILE *f) {
+  uint32 w = length((List *)bl);
+  fwrite(&w, sizeof(uint32), 1, f);
+  for (; bl != NULL; bl = bl->bindlistcdr) {
+    w = Summary_BinderRef(x, bl->bindlistcar);
+    fwrite(&w, sizeof(uint32), 1, f);
+  }
+}
+
+static void Summary_WriteFn(SavedFnList *p, FILE *f) {
+  SummaryIndex x;
+  SavedFnList sf = *p;
+  Inline_ArgDesc *ad;
+  BlockHead *b;
+  uint32 i, w[6];
+
+  x.nb = x.nbl = 0; x.maxb = x.maxbl = 16;
+  x.b = NewSynN(Binder *, x.maxb);
+  x.bl = NewSynN(BindList *, x.maxbl);
+  /* Number everything referenced before writing anything out */
+  Summary_BinderRef(&x, sf.fn.fndetails.structresult);
+  { BindList *bl;
+    for (bl = sf.fn.fndetails.argbindlist; bl != NULL; bl = bl->bindlistcdr)
+      Summary_BinderRef(&x, bl->bindlistcar);
+    for (bl = sf.fn.var_binders; bl != NULL; bl = bl->bindlistcdr)
+      Summary_BinderRef(&x, bl->bindlistcar);
+    for (bl = sf.fn.reg_binders; bl != NULL; bl = bl->bindlistcdr)
+      Summary_BinderRef(&x, bl->bindlistcar);
+  }
+  for (ad = argdesc_(&sf); ad != NULL; ad = adcdr_(ad)) {
+    Summary_BinderRef(&x, ad->abl.globarg);
+    Summary_BinderRef(&x, ad->abl.globnarrowarg);
+  }
+  for (b = sf.fn.top_block; b != NULL; b = blkdown_(b)) {
+    Icode *ic = blkcode_(b);
+    int32 n = blklength_(b);
+    Summary_ListRef(&x, blkstack_(b));
+    for (; --n >= 0; ic++) {
+      J_OPCODE op = ic->op & J_TABLE_BITS;
+      if (op == J_SETSPENV) {
+        Summary_ListRef(&x, ic->r3.bl);
+        Summary_ListRef(&x, ic->r2.bl);
+      } else if (op == J_SETSPGOTO)
+        Summary_ListRef(&x, ic->r2.bl);
+      else if (uses_stack(op) || op == J_CALLK || op == J_ADCON || op == J_ADCONV
+               || op == J_INIT || op == J_INITF || op == J_INITD)
+        Summary_BinderRef(&x, ic->r3.b);
+    }
+  }
+
+  Summary_WriteName(sf.fn.fndetails.symstr, f);
+  Summary_WriteSig(bindtype_(bind_global_(sf.fn.fndetails.symstr)), f);
+  fwrite(&sf, sizeof(SavedFnList), 1, f);
+  w[0] = x.nb; w[1] = x.nbl;
+  fwrite(w, sizeof(uint32), 2, f);
+  for (i = 1; i <= x.nb; i++) {
+    Binder *bb = x.b[i];
+    w[0] = (bindstg_(bb) & bitofstg_(s_auto)) != 0;
+    w[1] = isgensym(bindsym_(bb));
+    w[2] = bindstg_(bb);
+    fwrite(w, sizeof(uint32), 3, f);
+    Summary_WriteName(bindsym_(bb), f);
+    if (w[0]) {
+      w[0] = attributes_(bb);
+      w[1] = (bindstg_(bb) & b_bindaddrlist) ? Summary_ListRef(&x, bindbl_(bb))
+                                             : (uint32)bindaddr_(bb);
+      w[2] = bindmcrep_(bb);
+      w[3] = bindxx_(bb);
+      fwrite(w, sizeof(uint32), 4, f);
+    }
+  }
+  for (i = 1; i <= x.nbl; i++) {
+    w[0] = Summary_ListRef(&x, x.bl[i]->bindlistcdr);
+    w[1] = Summary_BinderRef(&x, x.bl[i]->bindlistcar);
+    fwrite(w, sizeof(uint32), 2, f);
+  }
+  w[0] = Summary_BinderRef(&x, sf.fn.fndetails.structresult);
+  fwrite(w, sizeof(uint32), 1, f);
+  Summary_WriteBindList(&x, sf.fn.fndetails.argbindlist, f);
+  Summary_WriteBindList(&x, sf.fn.var_binders, f);
+  Summary_WriteBindList(&x, sf.fn.reg_binders, f);
+  w[0] = length((List *)&argdesc_(&sf)->abl);
+  fwrite(w, sizeof(uint32), 1, f);
+  for (ad = argdesc_(&sf); ad != NULL; ad = adcdr_(ad)) {
+    w[0] = ad->flags;
+    w[1] = ad->accesssize | (ad->accessmap << 8);
+    w[2] = ad->mink;
+    w[3] = ad->maxk;
+    w[4] = Summary_BinderRef(&x, ad->abl.globarg);
+    w[5] = Summary_BinderRef(&x, ad->abl.globnarrowarg);
+    fwrite(w, sizeof(uint32), 6, f);
+    w[0] = ad->abl.narrowtype == NULL ? 0 : typespecmap_(ad->abl.narrowtype);
+    fwrite(w, sizeof(uint32), 1, f);
+  }
+  fwrite(sf.vregtypetab, sizeof(Inline_VRegIndex), (size_t)sf.maxreg, f);
+  if (sf.fn.firstblockignoresize > 0)
+    fwrite(sf.fn.firstblockignore, sizeof(uint8), MapSize(sf.fn.firstblockignoresize), f);
+
+  w[0] = 0;
+  for (b = sf.fn.top_block; b != NULL; b = blkdown_(b)) w[0]++;
+  fwrite(w, sizeof(uint32), 1, f);
+  for (b = sf.fn.top_block; b != NULL; b = blkdown_(b)) {
+    Icode *ic;
+    int32 n;
+    w[0] = blklength_(b);
+    w[1] = blkflags_(b);
+    w[2] = (uint32)(IPtr)blknext1_(b);
+    w[3] = (uint32)(IPtr)blklab_(b);
+    w[4] = Summary_ListRef(&x, blkstack_(b));
+    fwrite(w, sizeof(uint32), 5, f);
+    if (blkflags_(b) & BLKSWITCH)
+      fwrite(blktable_(b), sizeof(LabelNumber *), (size_t)blktabsize_(b), f);
+    else
+      fwrite(&blknext_(b), sizeof(LabelNumber *), 1, f);
+    for (n = blklength_(b), ic = blkcode_(b); --n >= 0; ic++) {
+      J_OPCODE op = ic->op & J_TABLE_BITS;
+      Icode c = *ic;
+      if (op == J_SETSPENV) {
+        c.r3.i = Summary_ListRef(&x, ic->r3.bl);
+        c.r2.i = Summary_ListRef(&x, ic->r2.bl);
+      } else if (op == J_SETSPGOTO) {
+        c.r2.i = Summary_ListRef(&x, ic->r2.bl);
+      } else if (uses_stack(op) || op == J_CALLK || op == J_ADCON || op == J_ADCONV
+                 || op == J_INIT || op == J_INITF || op == J_INITD) {
+        c.r3.i = Summary_BinderRef(&x, ic->r3.b);
+      }
+      fwrite(&c, sizeof(Icode), 1, f);
+      if (op == J_STRING) Dump_StrSeg(ic->r3.s, f);
+    }
+  }
+}
+
+/* A register summary carries a checksum over its contents and the     */
+/* register numbering of this compiler, so that a damaged record, or one */
+/* written by a compiler for another target, is ignored.  The object    */
+/* file compiled with the summary records the same checksum (in its     */
+/* debug area C$$regsummary, which the linker may drop): a summary is    */
+/* used only while that object still records it, so one made stale by a */
+/* change to the function, or by recompiling it without -zgs, is        */
+/* ignored and calls to the function assume it corrupts every register  */
+/* the procedure call standard allows.                                   */
+static uint32 RegSummary_Checksum(Symstr *sym, uint32 nsig, int32 const *sig,
+                                  RealRegSet const *used) {
+  uint32 h = 2166136261u, i;
+  char const *name = symname_(sym);
+  for (; *name != 0; name++) h = (h ^ (uint8)*name) * 16777619u;
+  h = (h ^ (uint32)DS_Version) * 16777619u;
+  h = (h ^ (uint32)NMAGICREGS) * 16777619u;
+  h = (h ^ (uint32)(NARGREGS << 8 | NFLTARGREGS)) * 16777619u;
+  for (i = 0; i < nsig; i++) h = (h ^ (uint32)sig[i]) * 16777619u;
+  for (i = 0; i < sizeof(used->map)/sizeof(used->map[0]); i++)
+    h = (h ^ (uint32)used->map[i]) * 16777619u;
+  return h;
+}
+
+static void RegSummary_Write(Binder *b, FILE *f) {
+  ExtRef *x = symext_(bindsym_(b));
+  uint32 nsig, w;
+  int32 *sig = Summary_Sig(princtype(bindtype_(b)), &nsig);
+  Summary_WriteName(bindsym_(b), f);
+  fwrite(&nsig, sizeof(uint32), 1, f);
+  fwrite(sig, sizeof(int32), (size_t)nsig, f);
+  fwrite(&x->usedregs, sizeof(RealRegSet), 1, f);
+  w = RegSummary_Checksum(bindsym_(b), nsig, sig, &x->usedregs);
+  fwrite(&w, sizeof(uint32), 1, f);
+}
+
+static bool RegSummary_Writable(Binder *b) {
+  ExtRef *x = symext_(bindsym_(b));
+  TypeExpr *t = princtype(bindtype_(b));
+  return x != NULL && (x->extflags & xr_defext) &&
+         h0_(t) == t_fnap && !fntypeisvariadic(t);
+}
+
+void Inline_WriteSummaries(FILE *f) {
+  SavedFnList *p;
+  BindList *bl;
+  uint32 w = length((List *)summary_fns);
+  fwrite(&w, sizeof(uint32), 1, f);
+  for (p = summary_fns; p != NULL; p = cdr_(p))
+    Summary_WriteFn(p, f);
+  /* cg_tidy() has compiled any deferred functions (--unit-at-a-time), */
+  /* so the register usage recorded here is that of the code emitted.  */
+  for (w = 0, bl = regsummary_fns; bl != NULL; bl = bl->bindlistcdr)
+    if (RegSummary_Writable(bl->bindlistcar)) w++;
+  fwrite(&w, sizeof(uint32), 1, f);
+  /* (an empty name if there is no object to check them against)       */
+  Summary_WriteName(sym_insert_id(objectfile != NULL ? objectfile : ""), f);
+  for (bl = regsummary_fns; bl != NULL; bl = bl->bindlistcdr)
+    if (RegSummary_Writable(bl->bindlistcar))
+      RegSummary_Write(bl->bindlistcar, f);
+}
+
+static Symstr *Summary_ReadName(FILE *f, bool gensym) {
+  uint32 len;
+  char *name;
+  fread(&len, sizeof(uint32), 1, f);
+  name = NewSynN(char, len+1);
+  Dump_LoadString(name, len, f);
+  return gensym ? gensymvalwithname(YES, name) : sym_insert_id(name);
+}
+
+static BindList *Summary_ReadBindList(Binder **bv, FILE *f) {
+  BindList *bl = NULL, **blp = &bl;
+  Binder *prevb = NULL;
+  uint32 n, w;
+  fread(&n, sizeof(uint32), 1, f);
+  while (n-- > 0) {
+    fread(&w, sizeof(uint32), 1, f);
+    if (prevb) bindcdr_(prevb) = bv[w];
+    prevb = bv[w];
+    *blp = (BindList *)global_cons2(SU_Inline, NULL, bv[w]);
+    blp = &(*blp)->bindlistcdr;
+  }
+  return bl;
+}
+
+static void Summary_ReadFn(FILE *f, char const *filename) {
+  SummaryFn *s = NewGlob(SummaryFn, SU_Inline);
+  SavedFnList *sf = NewGlob(SavedFnList, SU_Inline);
+  Symstr *fnsym = Summary_ReadName(f, NO);
+  Binder **bv;
+  BindList **blv;
+  uint32 i, nb, nbl, w[6];
+
+  s->sig = Summary_ReadSig(f, &s->nsig);
+  fread(sf, sizeof(SavedFnList), 1, f);
+  s->sf = sf;
+  s->state = SS_Pending;
+  sf->fn.fndetails.symstr = fnsym;
+  sf->fn.fndetails.fl.f = filename;
+  sf->fn.fndetails.fl.p = NULL;
+  sf->outoflineflags = ol_emitted;   /* it is defined elsewhere */
+
+  fread(w, sizeof(uint32), 2, f);
+  nb = w[0]; nbl = w[1];
+  bv = NewSynN(Binder *, nb+1);
+  blv = NewSynN(BindList *, nbl+1);
+  bv[0] = NULL; blv[0] = NULL;
+  for (i = 1; i <= nbl; i++)
+    blv[i] = (BindList *)GlobAlloc(SU_Inline, sizeof(BindList));
+  s->nglobals = 0;
+  s->globals = NewGlobN(Binder *, SU_Inline, nb+1);
+  for (i = 1; i <= nb; i++) {
+    Binder *b = (Binder *)GlobAlloc(SU_Bind, sizeof(Binder));
+    memset(b, 0, sizeof(Binder));
+    fread(w, sizeof(uint32), 3, f);
+    h0_(b) = s_binder;
+    bindstg_(b) = w[2];
+    bindsym_(b) = Summary_ReadName(f, (bool)w[1]);
+    if (w[0]) {
+      fread(w, sizeof(uint32), 4, f);
+      attributes_(b) = w[0] | A_GLOBALSTORE;
+      if (bindstg_(b) & b_bindaddrlist)
+        bindbl_(b) = blv[w[1]];
+      else
+        bindaddr_(b) = (int32)w[1];
+      bindmcrep_(b) = (int32)w[2];
+      bindxx_(b) = (VRegnum)(int32)w[3];   /* n.b. GAP is negative */
+      /* As for the compiled header, an auto's type is superseded by its */
+      /* cached mcrep.                                                   */
+      bindtype_(b) = (TypeExpr *)DUFF_ADDR;
+    } else {
+      /* A placeholder, replaced when the summary is first used */
+      attributes_(b) = A_GLOBALSTORE;
+      bindtype_(b) = (TypeExpr *)DUFF_ADDR;
+      s->globals[s->nglobals++] = b;
+    }
+    bv[i] = b;
+  }
+  for (i = 1; i <= nbl; i++) {
+    fread(w, sizeof(uint32), 2, f);
+    blv[i]->bindlistcdr = blv[w[0]];
+    blv[i]->bindlistcar = bv[w[1]];
+  }
+  fread(w, sizeof(uint32), 1, f);
+  sf->fn.fndetails.structresult = bv[w[0]];
+  sf->fn.fndetails.argbindlist = Summary_ReadBindList(bv, f);
+  sf->fn.var_binders = Summary_ReadBindList(bv, f);
+  sf->fn.reg_binders = Summary_ReadBindList(bv, f);
+  { Inline_ArgDesc **adp = &argdesc_(sf);
+    uint32 n;
+    fread(w, sizeof(uint32), 1, f);
+    for (n = w[0]; n-- > 0; ) {
+      Inline_ArgDesc *ad = NewGlob(Inline_ArgDesc, SU_Inline);
+      *adp = ad; adp = &adcdr_(ad);
+      fread(w, sizeof(uint32), 6, f);
+      ad->flags = w[0];
+      ad->accesssize = (uint8)w[1];
+      ad->accessmap = (uint8)(w[1] >> 8);
+      ad->mink = (int32)w[2];
+      ad->maxk = (int32)w[3];
+      ad->abl.globarg = bv[w[4]];
+      ad->abl.globnarrowarg = bv[w[5]];
+      ad->abl.instantiatednarrowarg = NULL;
+      ad->argsubst = NULL;
+      fread(w, sizeof(uint32), 1, f);
+      ad->abl.narrowtype = w[0] == 0 ? NULL :
+          globalize_typeexpr(primtype_(w[0]));
+    }
+    *adp = NULL;
+  }
+  sf->vregtypetab = NewGlobN(Inline_VRegIndex, SU_Inline, sf->maxreg);
+  fread(sf->vregtypetab, sizeof(Inline_VRegIndex), (size_t)sf->maxreg, f);
+  if (sf->fn.firstblockignoresize > 0) {
+    sf->fn.firstblockignore = NewGlobN(uint8, SU_Inline, sf->fn.firstblockignoresize);
+    fread(sf->fn.firstblockignore, sizeof(uint8), MapSize(sf->fn.firstblockignoresize), f);
+  } else
+    sf->fn.firstblockignore = NULL;
+
+  fread(w, sizeof(uint32), 1, f);
+  { int32 nblk = w[0];
+    BlockHead *b, *prev = NULL;
+    for (; --nblk >= 0; prev = b) {
+      Icode *ic;
+      int32 n;
+      b = NewGlob(BlockHead, SU_Inline);
+      memset(b, 0, sizeof(BlockHead));
+      blkup_(b) = prev;
+      if (prev == NULL)
+        sf->fn.top_block = b;
+      else
+        blkdown_(prev) = b;
+      fread(w, sizeof(uint32), 5, f);
+      blklength_(b) = w[0];
+      blkflags_(b) = w[1];
+      blknext1_(b) = (LabelNumber *)(IPtr)w[2];
+      blklab_(b) = (LabelNumber *)(IPtr)w[3];
+      blkstack_(b) = blv[w[4]];
+      if (blkflags_(b) & BLKSWITCH) {
+        blktable_(b) = NewGlobN(LabelNumber *, SU_Inline, blktabsize_(b));
+        fread(blktable_(b), sizeof(LabelNumber *), (size_t)blktabsize_(b), f);
+      } else
+        fread(&blknext_(b), sizeof(LabelNumber *), 1, f);
+      if (blklength_(b) == 0)
+        blkcode_(b) = (Icode *)DUFF_ADDR;
+      else {
+        blkcode_(b) = NewGlobN(Icode, SU_Inline, blklength_(b));
+        for (n = blklength_(b), ic = blkcode_(b); --n >= 0; ic++) {
+          J_OPCODE op;
+          fread(ic, sizeof(Icode), 1, f);
+          op = ic->op & J_TABLE_BITS;
+          if (op == J_SETSPENV) {
+            ic->r3.bl = blv[ic->r3.i];
+            ic->r2.bl = blv[ic->r2.i];
+          } else if (op == J_SETSPGOTO) {
+            ic->r2.bl = blv[ic->r2.i];
+          } else if (uses_stack(op) || op == J_CALLK || op == J_ADCON || op == J_ADCONV
+                     || op == J_INIT || op == J_INITF || op == J_INITD) {
+            ic->r3.b = bv[ic->r3.i];
+          } else if (op == J_STRING)
+            ic->r3.s = Dump_LoadStrSeg(f);
+        }
+      }
+    }
+    blkdown_(prev) = NULL;
+    sf->fn.bottom_block = prev;
+  }
+  cdr_(s) = imported_fns; imported_fns = s;
+}
+
+/* keys are the checksums recorded by the summaries' object file.      */
+static void RegSummary_Read(FILE *f, char const *filename,
+                            uint32 const *keys, int32 nkeys) {
+  RegSummary *r = NewGlob(RegSummary, SU_Inline);
+  uint32 w;
+  int32 i;
+  r->sym = Summary_ReadName(f, NO);
+  r->sig = Summary_ReadSig(f, &r->nsig);
+  fread(&r->usedregs, sizeof(RealRegSet), 1, f);
+  if (fread(&w, sizeof(uint32), 1, f) != 1 ||
+      w != RegSummary_Checksum(r->sym, r->nsig, r->sig, &r->usedregs)) {
+    if (debugging(DEBUG_CG))
+      cc_msg("Register summary of %s in %s ignored\n", symname_(r->sym), filename);
+    return;
+  }
+  for (i = 0; i < nkeys; i++)
+    if (keys[i] == w) break;
+  if (i == nkeys) {
+    if (debugging(DEBUG_CG))
+      cc_msg("Register summary of %s in %s is stale\n", symname_(r->sym), filename);
+    return;
+  }
+  r->state = SS_Pending;
+  { RegSummary **rp = &imported_regs[((IPtr)r->sym >> 2) % REGSUMMARY_HASHSIZE];
+    cdr_(r) = *rp; *rp = r;
+  }
+}
+
+void Inline_ReadSummaries(FILE *f, char const *filename) {
+  uint32 n;
+  fread(&n, sizeof(uint32), 1, f);
+  while (n-- > 0 && !ferror(f))
+    Summary_ReadFn(f, filename);
+  /* (absent from files written before register summaries were added)  */
+  if (fread(&n, sizeof(uint32), 1, f) != 1) return;
+  { Symstr *obj = Summary_ReadName(f, NO);
+    int32 nkeys = 0;
+    uint32 *keys = *symname_(obj) == 0 ? NULL :
+                   obj_readarea(symname_(obj), "C$$regsummary", &nkeys);
+    while (n-- > 0 && !ferror(f) && !feof(f))
+      RegSummary_Read(f, filename, keys, nkeys);
+  }
+}
+
+static bool Summary_Resolve(SummaryFn *s, Binder *fb) {
+  SavedFnList *sf = s->sf;
+  Binder **resolved;
+  BlockHead *b;
+  uint32 i;
+  if (!Summary_SigMatches(princtype(bindtype_(fb)), s->nsig, s->sig)) return NO;
+  resolved = NewSynN(Binder *, s->nglobals+1);
+  for (i = 0; i < s->nglobals; i++) {
+    Binder *gb = bind_global_(bindsym_(s->globals[i]));
+    if (gb == NULL || !(bindstg_(gb) & bitofstg_(s_extern))) return NO;
+    resolved[i] = gb;
+  }
+  for (b = sf->fn.top_block; b != NULL; b = blkdown_(b)) {
+    Icode *ic = blkcode_(b);
+    int32 n = blklength_(b);
+    for (; --n >= 0; ic++) {
+      J_OPCODE op = ic->op & J_TABLE_BITS;
+      if (op == J_CALLK || op == J_ADCON)
+        for (i = 0; i < s->nglobals; i++)
+          if (ic->r3.b == s->globals[i]) { ic->r3.b = resolved[i]; break; }
+    }
+  }
+  bindinline_(fb) = sf;
+  cdr_(sf) = saved_fns; saved_fns = sf;
+  if (debugging(DEBUG_CG))
+    cc_msg("Inline summary of %s imported from %s\n",
+           symname_(bindsym_(fb)), sf->fn.fndetails.fl.f);
+  return YES;
+}
+
+bool Inline_SummaryUsedRegs(Symstr *sym, RealRegSet *used) {
+  RegSummary *r = imported_regs[((IPtr)sym >> 2) % REGSUMMARY_HASHSIZE];
+  for (; r != NULL; r = cdr_(r))
+    if (r->sym == sym) break;
+  if (r == NULL || r->state == SS_Rejected) return NO;
+  if (r->state == SS_Pending) {
+    /* Checked against the declaration here once, when first called   */
+    Binder *b = bind_global_(sym);
+    if (b == NULL) return NO;
+    r->state = (bindstg_(b) & bitofstg_(s_extern)) && (bindstg_(b) & b_undef) &&
+               Summary_SigMatches(princtype(bindtype_(b)), r->nsig, r->sig)
+               ? SS_Resolved : SS_Rejected;
+    if (debugging(DEBUG_CG) && r->state == SS_Resolved)
+      cc_msg("Register summary of %s imported\n", symname_(sym));
+    if (r->state == SS_Rejected) return NO;
+  }
+  *used = r->usedregs;
+  return YES;
+}
+
+int32 Inline_SummaryChecksums(uint32 **keys) {
+  BindList *bl;
+  int32 n = 0;
+  if (!(dump_state & DS_Summary)) return 0;
+  for (bl = regsummary_fns; bl != NULL; bl = bl->bindlistcdr)
+    if (RegSummary_Writable(bl->bindlistcar)) n++;
+  if (n == 0) return 0;
+  *keys = NewGlobN(uint32, SU_Inline, n);
+  for (n = 0, bl = regsummary_fns; bl != NULL; bl = bl->bindlistcdr) {
+    Binder *b = bl->bindlistcar;
+    if (RegSummary_Writable(b)) {
+      uint32 nsig;
+      int32 *sig = Summary_Sig(princtype(bindtype_(b)), &nsig);
+      (*keys)[n++] = RegSummary_Checksum(bindsym_(b), nsig, sig,
+                                         &symext_(bindsym_(b))->usedregs);
+    }
+  }
+  return n;
+}
+
+bool Inline_HasSummary(Binder *b) {
+  SummaryFn *s;
+  if (imported_fns == NULL || !(bindstg_(b) & bitofstg_(s_extern)) ||
+      !(bindstg_(b) & b_undef))
+    return NO;
+  if (bindinline_(b) != NULL) return YES;
+  for (s = imported_fns; s != NULL; s = cdr_(s))
+    if (s->state == SS_Pending && s->sf->fn.fndetails.symstr == bindsym_(b)) {
+      s->state = Summary_Resolve(s, b) ? SS_Resolved : SS_Rejected;
+      return s->state == SS_Resolved;
+    }
+  return NO;
+}
+
 #endif /* NO_DUMP_STATE */
@@ -99,4 +99,31 @@ void Inline_Restore(Inline_SavedFn *p, Inline_RestoreControl *rc);
 void Inline_Init(void);
 void Inline_Tidy(void);
 
+/* Unit-at-a-time (--unit-at-a-time): code generation for the functions */
+/* of a compilation unit is deferred until its end.  Inline_Defer() saves */
+/* the flowgraph of the current function (returning NO if store is too   */
+/* short, when the function must be compiled at once); called from        */
+/* cg_tidy(), Inline_CompileDeferred() compiles the deferred functions    */
+/* callees first, omitting static functions which nothing references.    */
+bool Inline_Defer(Binder *b, BindList *local_binders, BindList *regvar_binders);
+void Inline_CompileDeferred(void);
+
+#ifndef NO_DUMP_STATE
+/* Inline summaries of small external functions, exchanged between      */
+/* compilation units through a file (-zgs to write, -zgi to read).       */
+void Inline_SaveSummary(Binder *b, BindList *local_binders, BindList *regvar_binders);
+bool Inline_HasSummary(Binder *b);
+/* The registers corrupted by an external function defined in another  */
+/* unit, if a summary file gave them (and its declaration here agrees). */
+bool Inline_SummaryUsedRegs(Symstr *sym, RealRegSet *used);
+/* The checksums of the register summaries written from this unit, for */
+/* its object file to record; returns their number.                     */
+int32 Inline_SummaryChecksums(uint32 **keys);
+#else
+#define Inline_SaveSummary(b,l,r)       ((void)0)
+#define Inline_HasSummary(b)            ((bool)0)
+#define Inline_SummaryUsedRegs(s,u)     ((bool)0)
+#define Inline_SummaryChecksums(k)      ((int32)0)
+#endif
+
 #endif
@@ -72,6 +72,26 @@ int32 CheckSWIValue(int32);
 extern int32 target_inlinable(Binder const *b, int32 nargs);
 #endif
 
+#ifdef TARGET_HAS_VECTOR_KERNELS
+/* Shapes of counted float loop 'for (...; i < n; ++i) body' which cg_loop */
+/* can hand to a target vector kernel (x, y, z arrays, a and s scalars).   */
+#define VK_MLA          0       /* y[i] = a*x[i] + y[i]                     */
+#define VK_SCALE        1       /* y[i] = a*x[i]                            */
+#define VK_ADD          2       /* y[i] = x[i] + z[i]                       */
+#define VK_SUB          3       /* y[i] = x[i] - z[i]                       */
+#define VK_MUL          4       /* y[i] = x[i] * z[i]                       */
+#define VK_SUM          5       /* s += x[i]                                */
+#define VK_DOT          6       /* s += x[i]*z[i]                           */
+extern Symstr *target_vectorkernel(int32 kind, int32 size, int32 *veclen);
+/* Returns the name of the kernel for loops of the given shape over float   */
+/* (size 4) or double (size 8) elements, or NULL, setting *veclen to the    */
+/* number of elements it handles per iteration.  Kernels take &x[i], &z[i], */
+/* &y[i] (as present) and n-i, then a or s as a double.  Elementwise ones   */
+/* return the number of elements they stored (a multiple of *veclen, or 0   */
+/* if the arrays overlap awkwardly); reductions return s plus the sum over  */
+/* the first (n-i) & -*veclen elements.                                     */
+#endif
+
 #ifndef alterscc
 #define alterscc(ic) (sets_psr(ic) || corrupts_psr(ic))
 #endif
@@ -179,6 +199,10 @@ extern void obj_header(void);
 
 extern void obj_trailer(void);
 
+extern uint32 *obj_readarea(char const *file, char const *name, int32 *nwords);
+/* The contents of the area name in the object file file, written by an  */
+/* earlier compilation; NULL if there is no such file or area.           */
+
 extern void obj_common_start(Symstr *name);
 
 extern void obj_common_end(void);
@@ -224,6 +248,8 @@ extern void display_assembly_code(Symstr const *);
 
 #define DBG_OPT_ALL  (DBG_OPT_CSE|DBG_OPT_REG|DBG_OPT_DEAD)
 
+#define DBG_TYPES 0x80       /* shared types in common areas (-gt+t)  */
+
 #ifdef TARGET_DEBUGGER_WANTS_MACROS
 #  define DBG_ANY (DBG_LINE|DBG_PROC|DBG_VAR|DBG_PP)
 #else
@@ -407,6 +433,7 @@ void dbg_setformat(char const *format);
 bool dbg_debugareaexists(char const *name);
 
 Symstr *obj_notedebugarea(char const *name);
+Symstr *obj_notecommondebugarea(char const *name, char const *after);
 void obj_startdebugarea(char const *name);
 void obj_enddebugarea(char const *name, DataXref *relocs);
 
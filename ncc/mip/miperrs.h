@@ -70,6 +70,7 @@ extern void pop_nested_context(void);
 #define warn_option_g "unknown debugging option -g%c: -g assumed"
 #define warn_option_zq "unknown option -zq%c: ignored"
 #define warn_preinclude "can't open pre-include file %s (ignored)"
+#define warn_template_repository "can't write template repository %s (ignored)"
 #define warn_option_E \
         "Obsolete use of '%s' to suppress errors -- use '-zu' for PCC mode"
 #define warn_option_p "unknown profile option %s: -p assumed"
@@ -136,6 +137,8 @@ extern void pop_nested_context(void);
 #define pp_err_include_quote "Missing '<' or '\"' after #include"
 #define pp_err_include_junk "Junk after #include %c%s%c"
 #define pp_err_include_file "#include file %c%s%c wouldn't open"
+#define pp_err_embed_quote "Missing '<' or '\"' after #embed"
+#define pp_err_embed_file "#embed file %c%s%c wouldn't open"
 #define pp_err_unknown_directive "Unknown directive: #%s"
 #define pp_err_endif_eof "Missing #endif at EOF"
 #define pp_fatalerr_hash_error "#error encountered \"%s\""
@@ -0,0 +1,760 @@
+/*
+ * sched.c: latency scheduling of floating point loop bodies
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+/*
+ * The body of an innermost loop which is a single basic block (ending in
+ * a branch back to itself) is list scheduled: each jopcode is issued as
+ * soon as target_joplatency() says its operands are ready, preferring the
+ * longest remaining chain of dependent operations.  Independent loads in
+ * the body are hoisted ahead of arithmetic that does not need them, so
+ * their latency is covered by other work from the same iteration.
+ *
+ * Before that, a loop whose floating point loads can be started an
+ * iteration early is software pipelined in two stages.  The first stage
+ * is the loads and the integer arithmetic forming their addresses, which
+ * must depend only on the induction variable and on values the loop does
+ * not change; the second stage is everything else.  The loop L becomes
+ *
+ *   L:  stage 1 (i)           into temporaries
+ *       if cond(i+step) goto K else goto E
+ *   K:  stage 1 (i+step)      into temporaries, having read the old ones
+ *       stage 2 (i)           which steps i
+ *       if cond(i+step) goto K
+ *   E:  stage 2 (i)           from the temporaries
+ *
+ * so that in the steady state K each load has a whole iteration's worth
+ * of arithmetic to cover its latency.  No load is issued for an iteration
+ * which the original loop would not have run.  Only loops counted by a
+ * register variable stepped by a constant, and compared against values
+ * the loop does not change, are pipelined.  A load may be moved above
+ * the stores of the previous iteration only if both are addressed from
+ * different static objects, so loops through pointer arguments which
+ * might overlap are left alone.  The temporaries are new binders which
+ * are live only from L to the end of E.
+ *
+ * This runs before register allocation, so values need no renaming, but
+ * every value moved earlier holds its register for longer: a candidate
+ * which would take the number of live floating values past the number of
+ * FP registers regalloc has to give out is held back while anything else
+ * can be issued.
+ *
+ * Only plain loads, stores, register variable accesses and arithmetic
+ * move.  Anything else (calls, compares, volatile accesses, debug markers
+ * and so on) is a barrier which nothing crosses.  Loads may pass loads;
+ * other memory accesses keep their order unless they are at disjoint
+ * constant offsets from the same base register.
+ */
+
+#include <string.h>
+
+#include "globals.h"
+#include "cgdefs.h"
+#include "jopcode.h"
+#include "flowgraf.h"
+#include "regalloc.h"
+#include "cg.h"
+#include "mcdep.h"
+#include "store.h"
+#include "sched.h"
+
+#ifndef target_joplatency
+#  define target_joplatency(op) 1   /* cycles before a result may be used */
+#endif
+
+#define SCHED_MAXLEN 64     /* longer bodies have little to gain       */
+#define PIPE_MAXCARRY 6     /* values passed from stage 1 to stage 2   */
+#define PIPE_MAXFPCARRY 4
+
+#define SK_ALU      0
+#define SK_LOAD     1
+#define SK_STORE    2
+#define SK_BARRIER  3
+
+#define DEP_NONE    0
+#define DEP_ORDER   1       /* must stay in order, but need not wait   */
+#define DEP_DATA    2       /* uses the result, so waits for it        */
+
+typedef struct SchedNode {
+    Icode ic;
+    int kind;
+    int ndef, nuse;
+    VRegnum def[2], use[5];
+    int usedef[5];          /* node defining use[i] here, or -1        */
+    int remaining;          /* uses of def[0] not yet scheduled        */
+    bool fpdef;
+    bool addrknown;         /* memory access is [base, #offset]        */
+    VRegnum base;
+    int32 offset, size;
+    int32 latency, height, ready;
+    int npreds;
+    bool done;
+} SchedNode;
+
+static int32 const memsize[] = {
+  1,
+  2,
+  4,
+  sizeof_float,
+  sizeof_double,
+  8
+};
+
+static bool isfpreg(VRegnum r)
+{   return !isany_realreg_(r) && vregsort(r) != INTREG;
+}
+
+static void sched_use(SchedNode *n, VRegnum r)
+{   n->use[n->nuse++] = r;
+}
+
+static void sched_def(SchedNode *n, VRegnum r)
+{   n->def[n->ndef++] = r;
+}
+
+static void sched_classify(SchedNode *n)
+{
+    Icode const *ic = &n->ic;
+    J_OPCODE op = ic->op & ~J_DEADBITS;
+    J_OPCODE base = op & J_TABLE_BITS;
+    n->ndef = n->nuse = 0;
+    n->addrknown = NO;
+    n->kind = SK_BARRIER;
+    if ((op & Q_MASK) != Q_AL || (op & J_VOLATILE)) base = J_NOOP;
+
+    switch (base) {
+    case J_LDRV: case J_LDRFV: case J_LDRDV:
+    case J_STRV: case J_STRFV: case J_STRDV:
+        if (bindxx_(ic->r3.b) != GAP) {
+            /* A register variable: really a register move.             */
+            n->kind = SK_ALU;
+            if (loads_r1(op))
+                sched_use(n, bindxx_(ic->r3.b)), sched_def(n, ic->r1.r);
+            else
+                sched_use(n, ic->r1.r), sched_def(n, bindxx_(ic->r3.b));
+        } else if (loads_r1(op)) {
+            n->kind = SK_LOAD;
+            sched_def(n, ic->r1.r);
+        } else {
+            n->kind = SK_STORE;
+            sched_use(n, ic->r1.r);
+        }
+        return;
+
+    case J_ADCONV:
+    case J_ADCON:
+    case J_MOVK: case J_MOVFK: case J_MOVDK:
+    case J_MOVR: case J_MOVFR: case J_MOVDR:
+    case J_ADDK: case J_ADDR: case J_SUBK: case J_SUBR:
+    case J_RSBK: case J_RSBR: case J_MULK: case J_MULR:
+    case J_ANDK: case J_ANDR: case J_ORRK: case J_ORRR:
+    case J_EORK: case J_EORR:
+    case J_SHLK: case J_SHLR: case J_SHRK: case J_SHRR:
+    case J_NEGR: case J_NOTR:
+    case J_ADDFK: case J_ADDFR: case J_SUBFK: case J_SUBFR:
+    case J_MULFK: case J_MULFR: case J_DIVFK: case J_DIVFR:
+    case J_ADDDK: case J_ADDDR: case J_SUBDK: case J_SUBDR:
+    case J_MULDK: case J_MULDR: case J_DIVDK: case J_DIVDR:
+    case J_NEGFR: case J_NEGDR:
+    case J_FLTFR: case J_FLTDR: case J_FIXFR: case J_FIXDR:
+    case J_MOVDFR: case J_MOVFDR:
+        n->kind = SK_ALU;
+        break;
+
+    default:
+        if (uses_stack(op)) return;
+        if (base != J_NOOP && j_is_ldr_or_str(op) && j_memsize(op) != MEM_LL) {
+            n->kind = loads_r1(op) ? SK_LOAD : SK_STORE;
+            if (!reads_r3(op)) {
+                n->addrknown = YES;
+                n->base = ic->r2.r;
+                n->offset = ic->r3.i;
+                n->size = memsize[j_memsize(op)];
+            }
+        }
+        /* Barriers' registers are noted only for the benefit of the    */
+        /* register pressure count.                                      */
+        break;
+    }
+    if (reads_r1(op) || (pseudo_reads_r1(op) && ic->r1.r != GAP))
+        sched_use(n, ic->r1.r);                 /* CMPK loopopt        */
+    if (reads_r2(op) || (pseudo_reads_r2(op) && ic->r2.r != GAP))
+        sched_use(n, ic->r2.r);                 /* MOVK/ADCON loopopt  */
+    if (reads_r3(op)) sched_use(n, ic->r3.r);
+    if (reads_r4(op)) sched_use(n, ic->r4.r);
+    if (loads_r1(op)) sched_def(n, ic->r1.r);
+    if (loads_r2(op)) sched_def(n, ic->r2.r);
+}
+
+static bool sched_disjoint(SchedNode const *a, SchedNode const *b)
+{   return a->addrknown && b->addrknown && a->base == b->base &&
+           (a->offset + a->size <= b->offset ||
+            b->offset + b->size <= a->offset);
+}
+
+static int sched_dep(SchedNode const *a, SchedNode const *b)
+{   /* How b (later) depends on a.                                      */
+    int i, j, dep = DEP_NONE;
+    for (i = 0; i < a->ndef; i++) {
+        for (j = 0; j < b->nuse; j++)
+            if (b->use[j] == a->def[i]) return DEP_DATA;
+        for (j = 0; j < b->ndef; j++)
+            if (b->def[j] == a->def[i]) dep = DEP_ORDER;
+    }
+    for (i = 0; i < a->nuse; i++)
+        for (j = 0; j < b->ndef; j++)
+            if (b->def[j] == a->use[i]) dep = DEP_ORDER;
+    if (a->kind == SK_BARRIER || b->kind == SK_BARRIER)
+        dep = DEP_ORDER;
+    else if ((a->kind == SK_STORE && b->kind != SK_ALU) ||
+             (b->kind == SK_STORE && a->kind != SK_ALU))
+        if (!sched_disjoint(a, b)) dep = DEP_ORDER;
+    return dep;
+}
+
+/* Cycles taken to issue the nodes in the order given.                 */
+static int32 sched_cycles(SchedNode *nodes, int *order, int n,
+                          unsigned char *deps)
+{
+    int32 t = 0, *start = NewSynN(int32, n);
+    int i, j;
+    for (i = 0; i < n; i++) {
+        int a = order[i];
+        int32 s = t;
+        for (j = 0; j < i; j++) {
+            int p = order[j];
+            if (deps[p*n + a] == DEP_DATA &&
+                start[p] + nodes[p].latency > s)
+                s = start[p] + nodes[p].latency;
+        }
+        start[a] = s;
+        t = s + 1;
+    }
+    return t;
+}
+
+static void schedule_block(BlockHead *b)
+{
+    int n = (int)blklength_(b), i, j, k, live = 0;
+    int fplimit = (int)NFLTREGS;
+    SchedNode *nodes;
+    unsigned char *deps;
+    int *order, *orig;
+    int32 cycle = 0, before, after;
+    bool anyfp = NO;
+
+    nodes = NewSynN(SchedNode, n);
+    deps = NewSynN(unsigned char, n*n);
+    order = NewSynN(int, n);
+    orig = NewSynN(int, n);
+    for (i = 0; i < n; i++) {
+        SchedNode *p = &nodes[i];
+        p->ic = blkcode_(b)[i];
+        sched_classify(p);
+        p->latency = target_joplatency(p->ic.op & ~J_DEADBITS);
+        p->fpdef = p->ndef > 0 && isfpreg(p->def[0]);
+        if (floatiness_(p->ic.op)) anyfp = YES;
+        p->remaining = 0;
+        p->npreds = 0;
+        p->done = NO;
+        orig[i] = i;
+        for (k = 0; k < p->nuse; k++) {
+            p->usedef[k] = -1;
+            for (j = i-1; j >= 0; j--)
+                if (nodes[j].ndef > 0 && nodes[j].def[0] == p->use[k]) {
+                    p->usedef[k] = j;
+                    nodes[j].remaining++;
+                    break;
+                }
+        }
+    }
+    if (!anyfp) return;
+    for (i = 0; i < n; i++)
+        for (j = 0; j < n; j++) {
+            int d = j > i ? sched_dep(&nodes[i], &nodes[j]) : DEP_NONE;
+            deps[i*n + j] = (unsigned char)d;
+            if (d != DEP_NONE) nodes[j].npreds++;
+        }
+    for (i = n-1; i >= 0; i--) {
+        int32 h = nodes[i].latency;
+        for (j = i+1; j < n; j++)
+            if (deps[i*n + j] == DEP_DATA && nodes[i].latency + nodes[j].height > h)
+                h = nodes[i].latency + nodes[j].height;
+            else if (deps[i*n + j] == DEP_ORDER && nodes[j].height > h)
+                h = nodes[j].height;
+        nodes[i].height = h;
+        nodes[i].ready = 0;
+    }
+
+    for (k = 0; k < n; k++) {
+        int best = -1, bestfits = 0;
+        int32 t = -1;
+        for (i = 0; i < n; i++)
+            if (!nodes[i].done && nodes[i].npreds == 0 &&
+                (t < 0 || nodes[i].ready < t))
+                t = nodes[i].ready;
+        if (t < cycle) t = cycle;
+        for (i = 0; i < n; i++) {
+            SchedNode *p = &nodes[i];
+            int fits;
+            if (p->done || p->npreds != 0 || p->ready > t) continue;
+            fits = !(p->fpdef && p->remaining > 0 && live >= fplimit);
+            if (best < 0 || fits > bestfits ||
+                (fits == bestfits && p->height > nodes[best].height))
+                best = i, bestfits = fits;
+        }
+        order[k] = best;
+        nodes[best].done = YES;
+        cycle = t + 1;
+        for (j = 0; j < nodes[best].nuse; j++) {
+            int d = nodes[best].usedef[j];
+            if (d >= 0 && --nodes[d].remaining == 0 && nodes[d].fpdef) live--;
+        }
+        if (nodes[best].fpdef && nodes[best].remaining > 0) live++;
+        for (j = 0; j < n; j++) {
+            int d = deps[best*n + j];
+            if (d == DEP_NONE) continue;
+            nodes[j].npreds--;
+            if (d == DEP_DATA && t + nodes[best].latency > nodes[j].ready)
+                nodes[j].ready = t + nodes[best].latency;
+            else if (t + 1 > nodes[j].ready)
+                nodes[j].ready = t + 1;
+        }
+    }
+
+    before = sched_cycles(nodes, orig, n, deps);
+    after = sched_cycles(nodes, order, n, deps);
+    if (after >= before) return;
+    if (debugging(DEBUG_CG))
+        cc_msg("loop L%ld: %ld jopcodes in %ld cycles (was %ld)\n",
+               (long)lab_xname_(blklab_(b)), (long)n, (long)after, (long)before);
+    for (i = 0; i < n; i++)
+        blkcode_(b)[i] = nodes[order[i]].ic;
+}
+
+/* Software pipelining.                                                 */
+
+typedef struct Pipe {
+    Icode *code;
+    int n;
+    SchedNode *nodes;
+    Binder *ivar;           /* the induction variable                  */
+    int istore;             /* the STRV of ivar                        */
+    int istep;              /* the ADDK or SUBK whose result it stores */
+    char *stage1;
+} Pipe;
+
+typedef struct PipeMap {
+    int n;
+    VRegnum *from, *to;
+} PipeMap;
+
+static bool pipe_isbinderop(Icode const *ic)
+{   J_OPCODE base = ic->op & J_TABLE_BITS;
+    return base == J_LDRV || base == J_LDRFV || base == J_LDRDV ||
+           base == J_STRV || base == J_STRFV || base == J_STRDV;
+}
+
+static J_OPCODE pipe_binderop(VRegnum r, J_OPCODE model)
+{   /* As CSEaccessOp(): 'model' is either J_LDRV or J_STRV.            */
+    J_OPCODE op;
+    switch (vregsort(r))
+    {   case FLTREG: op = J_LDRFV|J_ALIGN4; break;
+        case DBLREG: op = J_LDRDV|J_ALIGN8; break;
+        default:     op = J_LDRV|J_ALIGN4; break;
+    }
+    return model == J_LDRV ? op : J_LDtoST(op);
+}
+
+/* The last jopcode before 'before' which sets r, or -1.                */
+static int pipe_def(Pipe const *p, int before, VRegnum r)
+{   int j, k;
+    for (j = before-1; j >= 0; j--)
+        for (k = 0; k < p->nodes[j].ndef; k++)
+            if (p->nodes[j].def[k] == r) return j;
+    return -1;
+}
+
+static bool pipe_setinloop(Pipe const *p, VRegnum r)
+{   return pipe_def(p, p->n, r) >= 0;
+}
+
+static bool pipe_stored(Pipe const *p, Binder *b)
+{   int j;
+    for (j = 0; j < p->n; j++)
+        if (pipe_isbinderop(&p->code[j]) && !loads_r1(p->code[j].op) &&
+            p->code[j].r3.b == b)
+            return YES;
+    return NO;
+}
+
+/* The static object whose address r was formed from, or NULL.         */
+static void const *pipe_root(Pipe const *p, int before, VRegnum r)
+{   int d = pipe_def(p, before, r);
+    Icode const *ic;
+    if (d < 0) return NULL;
+    ic = &p->code[d];
+    switch (ic->op & J_TABLE_BITS) {
+    case J_ADCON:
+        return ic->r3.sym;
+    case J_ADDK: case J_SUBK: case J_SUBR:
+        return pipe_root(p, d, ic->r2.r);
+    case J_ADDR:
+    {   void const *q = pipe_root(p, d, ic->r2.r);
+        return q != NULL ? q : pipe_root(p, d, ic->r3.r);
+    }
+    case J_MOVR:
+        return pipe_root(p, d, ic->r3.r);
+    }
+    return NULL;
+}
+
+/* Marks jopcode j and everything it needs as the first stage, if that */
+/* depends only on ivar's value at the start of the iteration and on   */
+/* values the loop does not change.                                     */
+static bool pipe_slice(Pipe *p, int j, char *mark, bool top)
+{   SchedNode const *n = &p->nodes[j];
+    Icode const *ic = &p->code[j];
+    int k;
+    if (mark[j]) return YES;
+    if (pipe_isbinderop(ic)) {
+        if (!loads_r1(ic->op)) return NO;
+        if (ic->r3.b == p->ivar ? j > p->istore : pipe_stored(p, ic->r3.b))
+            return NO;
+        mark[j] = 1;
+        return YES;
+    }
+    if (top ? n->kind != SK_LOAD
+            : n->kind != SK_ALU || floatiness_(ic->op))
+        return NO;
+    mark[j] = 1;
+    for (k = 0; k < n->nuse; k++) {
+        int d = pipe_def(p, j, n->use[k]);
+        if (d < 0 ? pipe_setinloop(p, n->use[k])
+                  : !pipe_slice(p, d, mark, NO))
+            return NO;
+    }
+    return YES;
+}
+
+/* Whether load j may be issued before any of the loop's stores.        */
+static bool pipe_independent(Pipe const *p, int j)
+{   void const *root = pipe_root(p, j, p->code[j].r2.r);
+    int k;
+    for (k = 0; k < p->n; k++)
+        if (p->nodes[k].kind == SK_STORE &&
+            (root == NULL || pipe_root(p, k, p->code[k].r2.r) == NULL ||
+             pipe_root(p, k, p->code[k].r2.r) == root))
+            return NO;
+    return YES;
+}
+
+/* Classifies a register operand of the loop's compare: 1 if it is the */
+/* stepped induction variable, 0 if the loop does not change it.        */
+static int pipe_cmpop(Pipe const *p, VRegnum r)
+{   int d = pipe_def(p, p->n-1, r);
+    Icode const *ic;
+    if (d < 0) return pipe_setinloop(p, r) ? -1 : 0;
+    if (d == p->istep) return 1;
+    ic = &p->code[d];
+    if (!pipe_isbinderop(ic) || !loads_r1(ic->op)) return -1;
+    if (ic->r3.b == p->ivar) return d > p->istore ? 1 : -1;
+    return pipe_stored(p, ic->r3.b) ? -1 : 0;
+}
+
+static VRegnum pipe_lookup(PipeMap const *m, VRegnum r)
+{   int i;
+    for (i = m->n-1; i >= 0; i--)
+        if (m->from[i] == r) return m->to[i];
+    return r;
+}
+
+static VRegnum pipe_rename(PipeMap *m, VRegnum r)
+{   VRegnum r1 = vregister(vregsort(r));
+    m->from[m->n] = r, m->to[m->n] = r1, m->n++;
+    return r1;
+}
+
+static void pipe_newmap(PipeMap *m, int n)
+{   m->n = 0;
+    m->from = NewSynN(VRegnum, n);
+    m->to = NewSynN(VRegnum, n);
+}
+
+/* Copies *from to *to, giving everything it sets a new register.       */
+static void pipe_copy(Icode *to, Icode const *from, PipeMap *m)
+{   J_OPCODE op = from->op;
+    *to = *from;
+    if (reads_r1(op) || (pseudo_reads_r1(op) && from->r1.r != GAP))
+        to->r1.r = pipe_lookup(m, from->r1.r);
+    if (reads_r2(op) || (pseudo_reads_r2(op) && from->r2.r != GAP))
+        to->r2.r = pipe_lookup(m, from->r2.r);
+    if (reads_r3(op)) to->r3.r = pipe_lookup(m, from->r3.r);
+    if (reads_r4(op)) to->r4.r = pipe_lookup(m, from->r4.r);
+    if (loads_r1(op)) to->r1.r = pipe_rename(m, from->r1.r);
+    if (loads_r2(op)) to->r2.r = pipe_rename(m, from->r2.r);
+}
+
+static Icode *pipe_binder(Icode *c, J_OPCODE model, VRegnum r, Binder *b)
+{   INIT_IC(*c, pipe_binderop(r, model));
+    c->r1.r = r;
+    c->r3.b = b;
+    return c+1;
+}
+
+/* cond(ivar+step), for the value of ivar when it is reached.           */
+static Icode *pipe_test(Pipe const *p, Icode *c)
+{   Icode cmp = p->code[p->n-1];
+    VRegnum t = vregister(INTREG), t2 = vregister(INTREG);
+    int f;
+    c = pipe_binder(c, J_LDRV, t, p->ivar);
+    *c = p->code[p->istep];
+    c->r1.r = t2, c->r2.r = t;
+    c++;
+    for (f = 2; f <= 3; f++) {
+        VRegInt *field = f == 2 ? &cmp.r2 : &cmp.r3;
+        int d;
+        if (!(f == 2 ? reads_r2(cmp.op) : reads_r3(cmp.op))) continue;
+        d = pipe_def(p, p->n-1, field->r);
+        if (pipe_cmpop(p, field->r) == 1)
+            field->r = t2;
+        else if (d >= 0) {
+            VRegnum u = vregister(vregsort(field->r));
+            *c = p->code[d];
+            c->r1.r = u;
+            c++;
+            field->r = u;
+        }
+    }
+    *c++ = cmp;
+    return c;
+}
+
+static bool pipe_analyse(Pipe *p)
+{   Icode const *cmp = &p->code[p->n-1];
+    VRegnum r = GAP;
+    int j, k, loads = 0, ivarops = 0;
+    if (!is_compare(cmp->op)) return NO;
+    for (j = 0; j < p->n; j++) {
+        Icode const *ic = &p->code[j];
+        if (j < p->n-1 && p->nodes[j].kind == SK_BARRIER) return NO;
+        if (pipe_isbinderop(ic) && bindxx_(ic->r3.b) == GAP) return NO;
+    }
+    /* The induction variable is whichever the compare reads which is  */
+    /* stored just once, with a constant added to its old value.        */
+    if (reads_r2(cmp->op)) r = cmp->r2.r;
+    for (k = 0; k < 2; k++, r = reads_r3(cmp->op) ? cmp->r3.r : GAP) {
+        int d = r == GAP ? -1 : pipe_def(p, p->n-1, r);
+        if (d < 0) continue;
+        if (pipe_isbinderop(&p->code[d]) && pipe_stored(p, p->code[d].r3.b)) {
+            p->ivar = p->code[d].r3.b;
+            break;
+        }
+        for (j = d+1; j < p->n; j++)
+            if (pipe_isbinderop(&p->code[j]) && !loads_r1(p->code[j].op) &&
+                p->code[j].r1.r == r) {
+                p->ivar = p->code[j].r3.b;
+                break;
+            }
+        if (p->ivar != NULL) break;
+    }
+    if (p->ivar == NULL || vregsort(bindxx_(p->ivar)) != INTREG) return NO;
+    for (j = 0; j < p->n; j++)
+        if (pipe_isbinderop(&p->code[j]) && !loads_r1(p->code[j].op) &&
+            p->code[j].r3.b == p->ivar)
+            ivarops++, p->istore = j;
+    if (ivarops != 1) return NO;
+    p->istep = pipe_def(p, p->istore, p->code[p->istore].r1.r);
+    if (p->istep < 0) return NO;
+    {   Icode const *step = &p->code[p->istep];
+        J_OPCODE op = step->op & J_TABLE_BITS;
+        int d;
+        if (op != J_ADDK && op != J_SUBK) return NO;
+        d = pipe_def(p, p->istep, step->r2.r);
+        if (d < 0 || !pipe_isbinderop(&p->code[d]) ||
+            p->code[d].r3.b != p->ivar)
+            return NO;
+    }
+    k = 0;
+    if (reads_r2(cmp->op)) {
+        j = pipe_cmpop(p, cmp->r2.r);
+        if (j < 0) return NO;
+        k += j;
+    }
+    if (reads_r3(cmp->op)) {
+        j = pipe_cmpop(p, cmp->r3.r);
+        if (j < 0) return NO;
+        k += j;
+    }
+    if (k != 1) return NO;
+
+    p->stage1 = NewSynN(char, p->n);
+    memset(p->stage1, 0, p->n);
+    {   char *mark = NewSynN(char, p->n);
+        for (j = 0; j < p->n-1; j++) {
+            Icode const *ic = &p->code[j];
+            if (pipe_isbinderop(ic) || p->nodes[j].kind != SK_LOAD ||
+                !floatiness_(ic->op) || p->nodes[j].latency <= 1 ||
+                !pipe_independent(p, j))
+                continue;
+            memcpy(mark, p->stage1, p->n);
+            if (pipe_slice(p, j, mark, YES)) {
+                memcpy(p->stage1, mark, p->n);
+                loads++;
+            }
+        }
+    }
+    return loads > 0;
+}
+
+/* Pipelines the loop b, returning the binders carrying values between  */
+/* the stages (or NULL if it is left alone).                             */
+static BindList *pipeline_block(BlockHead *b)
+{
+    Pipe pp, *p = &pp;
+    int n = (int)blklength_(b), j, k, ncarry = 0, nfpcarry = 0;
+    VRegnum *carry;
+    Binder **tmp;
+    BindList *outer = blkstack_(b), *inner = outer, *carried = NULL;
+    PipeMap m;
+    BlockHead *kb, *eb;
+    Icode *code, *c;
+    int32 flags = blkflags_(b);
+
+    if (is_exit_label(blknext_(b)) ||
+        (flags & (BLKCCEXPORTED | BLKREXPORTED | BLKREXPORTED2)))
+        return NULL;
+    p->code = blkcode_(b);
+    p->n = n;
+    p->nodes = NewSynN(SchedNode, n);
+    p->ivar = NULL;
+    for (j = 0; j < n; j++) {
+        p->nodes[j].ic = p->code[j];
+        sched_classify(&p->nodes[j]);
+        p->nodes[j].latency = target_joplatency(p->code[j].op & ~J_DEADBITS);
+    }
+    if (!pipe_analyse(p)) return NULL;
+
+    /* Values set by the first stage and used by the second.           */
+    carry = NewSynN(VRegnum, n);
+    for (j = 0; j < n-1; j++) {
+        if (p->stage1[j]) continue;
+        for (k = 0; k < p->nodes[j].nuse; k++) {
+            VRegnum r = p->nodes[j].use[k];
+            int d = pipe_def(p, j, r), i;
+            if (d < 0 || !p->stage1[d]) continue;
+            for (i = 0; i < ncarry; i++) if (carry[i] == r) break;
+            if (i == ncarry) {
+                carry[ncarry++] = r;
+                if (vregsort(r) != INTREG) nfpcarry++;
+            }
+        }
+    }
+    if (ncarry == 0 || ncarry > PIPE_MAXCARRY || nfpcarry > PIPE_MAXFPCARRY)
+        return NULL;
+    tmp = NewSynN(Binder *, ncarry);
+    for (j = 0; j < ncarry; j++) {
+        Binder *t = gentempvarofsort(vregsort(carry[j]));
+        inner = mkBindList(inner, t);
+        bindbl_(t) = inner;
+        bindstg_(t) |= b_bindaddrlist;
+        carried = mkBindList(carried, t);
+        tmp[j] = t;
+    }
+    greatest_stackdepth += sizeofbinders(carried, YES);
+
+    kb = insertblockbetween(b, b, NO);
+    eb = insertblockbetween(kb, b, NO);
+    blkstack_(kb) = blkstack_(eb) = inner;
+    blknest_(kb) = blknest_(eb) = blknest_(b);
+
+    /* K: the steady state.                                             */
+    code = c = newicodeblock(2*n + 2*ncarry + 8);
+    for (j = 0; j < ncarry; j++)
+        c = pipe_binder(c, J_LDRV, carry[j], tmp[j]);
+    for (j = 0; j < n-1; j++)
+        if (!p->stage1[j]) *c++ = p->code[j];
+    /* ivar has been stepped, so this is the next iteration's stage 1. */
+    pipe_newmap(&m, n);
+    for (j = 0; j < n; j++)
+        if (p->stage1[j]) pipe_copy(c++, &p->code[j], &m);
+    for (j = 0; j < ncarry; j++)
+        c = pipe_binder(c, J_STRV, pipe_lookup(&m, carry[j]), tmp[j]);
+    c = pipe_test(p, c);
+    blkcode_(kb) = code;
+    blklength_(kb) = c - code;
+    blkflags_(kb) = flags;
+    blknext_(kb) = blklab_(eb);
+    blknext1_(kb) = blklab_(kb);
+
+    /* E: the last iteration's second stage.                            */
+    code = c = newicodeblock(n + ncarry + 1);
+    pipe_newmap(&m, n + ncarry);
+    for (j = 0; j < ncarry; j++)
+        c = pipe_binder(c, J_LDRV, pipe_rename(&m, carry[j]), tmp[j]);
+    for (j = 0; j < n-1; j++)
+        if (!p->stage1[j]) pipe_copy(c++, &p->code[j], &m);
+    INIT_IC(*c, J_SETSPENV);
+    c->r2.bl = inner;
+    c->r3.bl = outer;
+    c++;
+    blkcode_(eb) = code;
+    blklength_(eb) = c - code;
+    blkflags_(eb) = flags & ~(BLK2EXIT | Q_MASK | BLKLOOP);
+    blknext_(eb) = blknext_(b);
+
+    /* L: the first iteration's first stage.                            */
+    code = c = newicodeblock(n + ncarry + 8);
+    INIT_IC(*c, J_SETSPENV);
+    c->r2.bl = outer;
+    c->r3.bl = inner;
+    c++;
+    pipe_newmap(&m, n);
+    for (j = 0; j < n; j++)
+        if (p->stage1[j]) pipe_copy(c++, &p->code[j], &m);
+    for (j = 0; j < ncarry; j++)
+        c = pipe_binder(c, J_STRV, pipe_lookup(&m, carry[j]), tmp[j]);
+    c = pipe_test(p, c);
+    freeicodeblock(blkcode_(b), n);
+    blkcode_(b) = code;
+    blklength_(b) = c - code;
+    blkflags_(b) = flags & ~BLKLOOP;
+    blknext_(b) = blklab_(eb);
+    blknext1_(b) = blklab_(kb);
+
+    if (debugging(DEBUG_CG))
+        cc_msg("loop L%ld: pipelined as L%ld, %d values carried\n",
+               (long)lab_xname_(blklab_(b)), (long)lab_xname_(blklab_(kb)),
+               ncarry);
+    return carried;
+}
+
+BindList *schedule_loops(void)
+{
+    BlockHead *b;
+    BindList *binders = NULL;
+    if (!cse_enabled || usrdbg(DBG_LINE)) return NULL;
+    for (b = top_block; b != NULL; b = blkdown_(b)) {
+        int32 flags = blkflags_(b);
+        if (blklength_(b) < 2 || blklength_(b) > SCHED_MAXLEN ||
+            (flags & (BLKSWITCH | BLKCALL | BLK2CALL | BLKSETJMP | BLKCCLIVE)))
+            continue;
+        if ((flags & BLK2EXIT) && blknext1_(b) == blklab_(b)) {
+            BindList *bl = pipeline_block(b);
+            if (bl != NULL) {
+                /* b is now the prologue, followed by the loop and its  */
+                /* epilogue.                                            */
+                binders = (BindList *)nconc((List *)bl, (List *)binders);
+                b = blkdown_(b);
+                if (blklength_(b) <= SCHED_MAXLEN) schedule_block(b);
+                b = blkdown_(b);
+                continue;
+            }
+        }
+        if (blknext_(b) == blklab_(b) ||
+            ((flags & BLK2EXIT) && blknext1_(b) == blklab_(b)))
+            schedule_block(b);
+    }
+    return binders;
+}
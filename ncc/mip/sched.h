@@ -0,0 +1,17 @@
+/*
+ * sched.h: latency scheduling of floating point loop bodies
+ * SPDX-Licence-Identifier: Apache-2.0
+ */
+
+#ifndef _sched_h
+#define _sched_h
+
+/* Reorders the jopcodes of each single-block loop which does floating   */
+/* point arithmetic so that results are not used before target latency  */
+/* says they are ready, first software pipelining those whose loads can */
+/* be issued an iteration early.  Called between live range splitting   */
+/* and register allocation; returns the binders it introduced, which    */
+/* must be added to those register allocation is given.                 */
+extern BindList *schedule_loops(void);
+
+#endif
@@ -388,6 +388,10 @@ VoidStar GlobAlloc(StoreUse t, int32 n)
     return p;
 }
 
+int32 alloc_globaluse(void)
+{   return ((int32)globsegcnt*SEGSIZE - (globalltop - globallp)) + globallxtra;
+}
+
 static char *new_bindalloc_segment(void)
 {
     if (bindsegcur >= bindsegcnt)
@@ -59,6 +59,8 @@ extern VoidStar xglobal_list7(StoreUse t, IPtr a, IPtr b, IPtr c, IPtr d, IPtr e
 #endif
 
 extern VoidStar GlobAlloc(StoreUse t, int32 n);
+/* Bytes of global store in use (as reported by show_store_use()).    */
+extern int32 alloc_globaluse(void);
 
 #ifndef CALLABLE_COMPILER
 extern VoidStar PermAlloc(int32 n);
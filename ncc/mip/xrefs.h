@@ -177,6 +177,10 @@ struct ExtRef
 #endif
 #define LIT_INT64_1 0x1a
 #define LIT_INT64_2 0x1b
+/* A run of constant data words in target byte order: len is the byte   */
+/* count (a multiple of 4) and val points to the bytes.  Only built     */
+/* when there is no assembler output; see codebuf.c(vg_addword).        */
+#define LIT_BLOB    0x1c
 
 extern CodeXref *codexrefs;
 extern ExtRef *obj_symlist;
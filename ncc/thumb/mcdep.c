@@ -328,6 +328,7 @@ void mcdep_set_options(ToolEnv *t) {
 #include "inlnasm.h"
 #include "flowgraf.h"
 #include "simplify.h"
+#include "inline.h"
 
 int32 a_loads_r1(const PendingOp *const p)
 {
@@ -737,6 +738,12 @@ static uint32 GetUsedRegs(Binder *b)
 
     if (var_cc_private_flags & 1024L)   /* usedregs optimization disabled */
         return volatile_regs;
+    if (symext_(s) == NULL || !(symext_(s)->extflags & (xr_defloc+xr_defext)))
+    {   RealRegSet used;
+        /* Defined in another unit: a linker veneer may corrupt IP too.   */
+        if (Inline_SummaryUsedRegs(s, &used))
+            return used.map[0] | regbit(R_IP);
+    }
     return (symext_(s) != NULL) ? symext_(s)->usedregs.map[0] : volatile_regs;
 }
 
@@ -3,6 +3,8 @@
 # - Discovers tests under tests/**/*.c,*.cpp by default
 # - Reads inline directives from // comments
 # - Executes RUN lines with %s (source), %t (any temp file), %cc (C), %cxx (C++)
+#   and %armsim (tests/tools/armsim.py: links AOF objects and runs main)
+#   and %npp (the interpreter, make interp: tests using it are skipped if it isn't built)
 #
 # Examples:
 #   ./runtests.py --root tests --features explicit,namespaces -j8 --junit out.xml
@@ -10,6 +12,7 @@
 #
 # Directives (examples):
 #   // RUN: %cxx %s -c              (optional if default isn't suitable)
+#   // RUN: %cc %s -c -o %t.o && %armsim %t.o   (run it; main must return 0)
 #   // EXPECT-ERROR                 (check return code != 0)
 #   // KNOWN-FAIL: fails because... (don't highlight as a FAIL)
 
@@ -103,19 +106,25 @@ class TestResult:
     stdout: str = ""
     stderr: str = ""
 
-def substitute(cmd: str, src: str, tempstem: str, c_compiler: str, cxx_compiler: str) -> str:
+ARMSIM = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'tests', 'tools', 'armsim.py')
+
+def substitute(cmd: str, src: str, tempstem: str, c_compiler: str, cxx_compiler: str, npp: str) -> str:
     abs_src = os.path.abspath(src)
+    cmd = cmd.replace('%armsim', shlex.quote(sys.executable) + ' ' + shlex.quote(ARMSIM))
+    cmd = cmd.replace('%npp', shlex.quote(npp))
     cmd = cmd.replace('%s', shlex.quote(abs_src))
     cmd = cmd.replace('%t', tempstem)
     cmd = cmd.replace('%cxx', shlex.quote(cxx_compiler))
     cmd = cmd.replace('%cc', shlex.quote(c_compiler))
     return cmd
 
-def run_one(spec: TestSpec, features: set[str], echo: bool, c_compiler: str, cxx_compiler: str, dump_checked: bool) -> TestResult:
+def run_one(spec: TestSpec, features: set[str], echo: bool, c_compiler: str, cxx_compiler: str, npp: str, dump_checked: bool) -> TestResult:
     # gating
     if spec.requires and not spec.requires.issubset(features):
         return TestResult(spec.path, 'SKIP',
                           details=f"Missing required features: {', '.join(sorted(spec.requires - features))}")
+    if any('%npp' in r for r in spec.runs) and not os.path.exists(npp):
+        return TestResult(spec.path, 'SKIP', details=f"{npp} not built (make interp)")
 
     # temp dir and stem
     tmpdir = tempfile.mkdtemp(prefix='rt-')
@@ -136,7 +145,7 @@ def run_one(spec: TestSpec, features: set[str], echo: bool, c_compiler: str, cxx
             spec.runs = [cmd]
 
         for raw in spec.runs:
-            cmd = substitute(raw, spec.path, tempstem, c_compiler, cxx_compiler)
+            cmd = substitute(raw, spec.path, tempstem, c_compiler, cxx_compiler, npp)
 
             # Auto-append Norcroft VFP ABI for tests under /vfp/
             try:
@@ -407,6 +416,7 @@ def main():
     p.add_argument('--junit', default='', help='Write JUnit XML to this file')
     p.add_argument('--cc', default='bin/ncc-riscos', help='C compiler to invoke for %%cc')
     p.add_argument('--cxx', default='bin/n++-riscos', help='C++ compiler to invoke for %%cxx')
+    p.add_argument('--npp', default='bin/npp', help='Interpreter to invoke for %%npp')
     p.add_argument('--echo', action='store_true', help='Echo each expanded RUN command and its temp dir before executing')
     p.add_argument('paths', nargs='*', help='Optional list of test files or directories. If omitted, uses --root.')
     p.add_argument('--match', default='', help='Only run tests whose path contains this substring (case-sensitive).')
@@ -418,6 +428,8 @@ def main():
         args.cc = os.path.join(script_dir, args.cc)
     if not os.path.isabs(args.cxx):
         args.cxx = os.path.join(script_dir, args.cxx)
+    if not os.path.isabs(args.npp):
+        args.npp = os.path.join(script_dir, args.npp)
 
     features = set([t.strip() for t in args.features.split(',') if t.strip()])
 
@@ -452,7 +464,7 @@ def main():
     # Pre-parse all specs first, so parse errors show early
     specs = [parse_test(t) for t in tests]
 
-    work = [(s, features, args.echo, args.cc, args.cxx, args.verbose) for s in specs]
+    work = [(s, features, args.echo, args.cc, args.cxx, args.npp, args.verbose) for s in specs]
     if args.jobs > 1:
         with Pool(processes=args.jobs) as pool:
             results = pool.starmap(run_one, work)
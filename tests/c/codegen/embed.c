@@ -0,0 +1,41 @@
+// RUN: printf 'Norcroft\0\1\377 embed' > t.bin && %cc -I. %s -S -o -
+// RUN: %cc -I. %s -E | grep '^[0-9]'
+// RUN: %cc -I. %s -c -o a.o && %cc -I. %s -E > e.c && %cc e.c -c -o b.o && cmp a.o b.o && echo objects match
+
+// #embed reads a file's bytes as a comma-separated list of integers.
+// A char array takes them straight into its data as one block (which
+// must give the same object code as the list written out), and an open
+// array gets the file's size.
+
+// CHECK: blobsize
+// CHECK: mov     r0, #17
+// CHECK: padded
+// CHECK: mov     r0, #19
+// CHECK: blob
+// CHECK: DCB      0x4e,0x6f,0x72,0x63
+// CHECK: DCB      0x72,0x6f,0x66,0x74
+// CHECK: DCB      0x00,0x01,0xff,0x20
+// CHECK: DCB      0x65,0x6d,0x62,0x65
+// CHECK: DCB      0x64,0x00,0x00,0x00
+// CHECK: words
+// CHECK: DCD      0x00000007
+// CHECK: DCD      0x0000004e
+// CHECK: DCD      0x00000064
+// CHECK: DCD      0x00000009
+// CHECK: 78,111,114,99,114,111,102,116,0,1,255,32,101,109,98,101,100
+// CHECK: objects match
+
+const unsigned char blob[] = {
+#embed "t.bin"
+};
+
+const unsigned char blob20[20] = {
+#embed "t.bin"
+};
+
+int words[] = { 7,
+#embed "t.bin"
+, 9 };
+
+unsigned blobsize(void) { return sizeof blob; }
+unsigned padded(void) { return sizeof words / sizeof words[0]; }
@@ -0,0 +1,25 @@
+// RUN: %cc %s -S -o -
+
+// Regrouping in optimise0 rebuilds nodes over operands it has already
+// simplified; the constants in these must still be folded together.
+
+// CHECK: setf
+// CHECK: and             r2, r1, #3
+// CHECK: add             ip, r2, #1
+// CHECK: str             r3, [r0]
+// CHECK: orr             r0, r2, #4
+// CHECK: mov             r2, #24
+// CHECK: add             r1, r2, r1, lsl #2
+// CHECK: eor             r0, r0, r1
+// CHECK: mov             pc, lr
+
+typedef struct { unsigned a:4, b:4, c:8; } R;
+#define SETF(r, x) ((r).a = (x), (r).b = (x) + 1, (r).c = ((x) << 1) | 1)
+
+unsigned setf(R *p, unsigned x)
+{
+  R r = *p;
+  SETF(r, x & 3);
+  *p = r;
+  return (((x & 3) | 4) & 7) ^ ((((x + 1) + 2) + 3) * 4);
+}
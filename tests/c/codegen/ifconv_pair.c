@@ -0,0 +1,23 @@
+// RUN: %cc %s -S -o -
+
+// Both arms of an if/else are executed conditionally when their combined
+// length is within twice the branch penalty, even if one arm alone is
+// longer than the limit for a single arm (default ARM6: 3 and 6).
+
+extern int g;
+
+// CHECK: uneven
+// CHECK-NO: bgt
+// CHECK: addle   r1, r1, r2
+// CHECK: suble   r0, r1, r0
+// CHECK: addgt   r0, r1, r3
+// CHECK: mov     pc, lr
+void uneven(int x, int a, int b, int c)
+{
+    int r;
+    if (x > 0)
+        r = a + c;
+    else
+        r = ((a + b) ^ c) - (b | x);
+    g = r;
+}
@@ -0,0 +1,53 @@
+// RUN: %cc %s -S -o -
+// RUN: %cc %s -S -o - -zb4
+// RUN: %cc %s -S -o - -cpu ARM8
+
+// Whether a short arm of an if is executed conditionally or branched
+// round depends on the cost of a taken branch for the target processor
+// (-zb overrides the per-processor figure).
+
+extern int g;
+
+// Default (ARM6, penalty 2): four instructions are too many to beat a branch.
+// CHECK: step
+// CHECK: bgt
+// CHECK: add     r1, r1, r2
+// CHECK: mov     pc, lr
+// CHECK: tri
+// CHECK: addne   r1, r1, r2
+// CHECK: orrne   r1, r0, #3
+// CHECK: mov     pc, lr
+
+// -zb4: both conditionalised.
+// CHECK: step
+// CHECK-NO: bgt
+// CHECK: addle   r1, r1, r2
+// CHECK: suble   r1, r1, r0
+// CHECK: mov     pc, lr
+// CHECK: tri
+// CHECK: addne   r1, r1, r2
+// CHECK: mov     pc, lr
+
+// ARM8 (penalty 1): three instructions no longer pay either.
+// CHECK: step
+// CHECK: bgt
+// CHECK: tri
+// CHECK: beq
+// CHECK: add     r1, r1, r2
+// CHECK: mov     pc, lr
+
+void step(int x, int a, int b, int c)
+{
+    int r;
+    if (x > 0)
+        r = a;
+    else
+        r = ((a + b) ^ c) - (b | x);
+    g = r;
+}
+
+int tri(int x, int a, int b)
+{
+    if (x) { a += b; a ^= x; a |= 3; }
+    return a;
+}
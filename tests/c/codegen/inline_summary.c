@@ -0,0 +1,36 @@
+// RUN: %cc %s -DEXPORT -c -o %t.o -zGS%t.isum
+// RUN: %cc %s -S -o - -zGI%t.isum
+
+// -zGS writes the saved flowgraphs of small external functions to a
+// summary file; a later compilation reading it with -zGI may expand
+// calls to them inline, as though they had been declared inline.
+
+#ifdef EXPORT
+extern int hits;
+int scale(int x) { return x * 3 + 1; }
+int count(int n) { hits += n; return hits; }
+int twice(int a, int b) { return a + a + b; }
+#else
+extern int hits;
+extern int scale(int x);
+extern int count(int n);
+extern int twice(int a);        /* does not match the definition */
+
+// CHECK: use_scale
+// CHECK-NO: bl
+// CHECK: add     r0, r0, r0, lsl #1
+// CHECK: add     r0, r0, #1
+// CHECK: mov     pc, lr
+int use_scale(int a) { return scale(a); }
+
+// CHECK: use_count
+// CHECK-NO: bl
+// CHECK: str
+// CHECK: mov     pc, lr
+int use_count(int a) { return count(a); }
+
+// A summary is not used when the declaration here disagrees with it.
+// CHECK: use_twice
+// CHECK: b       twice
+int use_twice(int a) { return twice(a); }
+#endif
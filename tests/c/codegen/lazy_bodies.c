@@ -0,0 +1,20 @@
+// RUN: %cc --lazy-bodies %s -S -o -
+
+// With --lazy-bodies the body of a static function is saved as tokens
+// and only parsed once something references it; callees are compiled
+// before their callers and an unreferenced body is never parsed.
+
+static int helper(int x) { return x * 5; }
+static int unused(int x) { return x * 3; }
+static int leaf(int x) { return helper(x) + 1; }
+
+// CHECK: helper
+// CHECK: leaf
+// CHECK: bl      helper
+// CHECK: top
+// CHECK: bl      leaf
+// CHECK-NO: unused
+// CHECK: END
+int top(int a)
+{   return leaf(a) - a;
+}
@@ -0,0 +1,12 @@
+// RUN: %cc --lazy-bodies %s -S -o -
+// EXPECT-ERROR
+
+// A deferred body must be read with only the file-scope declarations
+// visible at its definition, so 'later' is undeclared inside f.
+
+// CHECK-ERR: undeclared name, inventing 'extern int later'
+static int f(void) { return later; }
+
+int later = 3;
+
+int h(void) { return f(); }
@@ -0,0 +1,24 @@
+// RUN: %cc --lazy-statics %s -S -o -
+
+// With --lazy-statics an initialised static object is only laid out
+// once something references it; an object nothing refers to is never
+// emitted, and one referenced only from a live object is kept.
+
+struct node { struct node *next; int v; };
+
+static int dead[4] = { 11, 22, 33, 44 };
+static struct node ring[2] = { { &ring[1], 1 }, { &ring[0], 2 } };
+static struct node *const tabs[] = { &ring[0] };
+static struct node *const deadtabs[] = { &ring[1] };
+
+// CHECK: walk
+// CHECK: AREA |C$$constdata|
+// CHECK: tabs
+// CHECK-NO: deadtabs
+// CHECK: AREA |C$$data|
+// CHECK: ring
+// CHECK-NO: 0x0000000b
+// CHECK: END
+int walk(void)
+{   return tabs[0]->next->v;
+}
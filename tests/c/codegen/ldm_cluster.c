@@ -0,0 +1,30 @@
+// RUN: %cc %s -S -o -
+
+// Word transfers from the same base which are separated by unrelated
+// instructions are brought together so they can form an LDM/STM.
+
+struct S { int a, b, c, d; };
+
+// CHECK: store2
+// CHECK: stmia   r0, {r1-r2}
+// CHECK-NO: str     r2, [r0, #4]
+// CHECK: mov     pc, lr
+void store2(struct S *s, int a, int b, int c)
+{   s->a = a;
+    c = c * 5 + a;
+    s->b = b;
+    s->c = c;
+}
+
+// CHECK: load2
+// CHECK: ldmia   r0, {r2-r3}
+// CHECK: add     ip, r2, r1
+// CHECK-NO: ldr     r3, [r0, #4]
+// CHECK: mov     pc, lr
+int load2(struct S *s, int k)
+{   int x = s->a;
+    int y = x + k;
+    int z = s->b;
+    int w = s->c;
+    return (x ^ y) + z + w + k;
+}
@@ -0,0 +1,51 @@
+// RUN: %cc %s -S -o -
+// RUN: %cc %s -S -o - -arch 4
+
+// long long shifts, and multiplies where UMULL is available, are
+// expanded in registers rather than calling the _ll_ helpers.
+
+// CHECK: shl12
+// CHECK: mov     r1, r1, lsl #12
+// CHECK: orr     r1, r1, r0, lsr #20
+// CHECK: mov     r0, r0, lsl #12
+// CHECK-NO: _ll_shift_l
+// CHECK: mov     pc, lr
+long long shl12(long long x) { return x << 12; }
+
+// CHECK: sar40
+// CHECK: mov     r0, r1, asr #8
+// CHECK: mov     r1, r1, asr #31
+// CHECK-NO: _ll_sshift_r
+// CHECK: mov     pc, lr
+long long sar40(long long x) { return x >> 40; }
+
+// CHECK: shrv
+// CHECK: rsb     ip, r2, #32
+// CHECK: mov     r0, r0, lsr r2
+// CHECK: orr     r0, r0, r1, lsl ip
+// CHECK: sub     ip, r2, #32
+// CHECK: orr     r0, r0, r1, lsr ip
+// CHECK: mov     r1, r1, lsr r2
+// CHECK-NO: _ll_ushift_r
+// CHECK: mov     pc, lr
+unsigned long long shrv(unsigned long long x, int n) { return x >> n; }
+
+// CHECK: sarv
+// CHECK: subs    ip, r2, #32
+// CHECK: movge   r0, r1, asr ip
+// CHECK: mov     r1, r1, asr r2
+// CHECK: mov     pc, lr
+long long sarv(long long x, int n) { return x >> n; }
+
+// Without -arch the target has no long multiply.
+// CHECK: mul
+// CHECK: b       _ll_mul
+long long mul(long long a, long long b) { return a * b; }
+
+// CHECK: mul
+// CHECK: mul     r1, r2, r1
+// CHECK: mla     r1, r0, r3, r1
+// CHECK: umull   r0, r3, r2, r0
+// CHECK: add     r1, r1, r3
+// CHECK-NO: _ll_mul
+// CHECK: mov     pc, lr
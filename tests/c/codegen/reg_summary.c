@@ -0,0 +1,48 @@
+// RUN: %cc %s -DEXPORT -c -o %t.o -zGS%t.isum && %armsim --areas %t.o
+// RUN: %cc %s -S -o - -zGI%t.isum
+// RUN: %cc %s -DEXPORT -c -o %t.o && echo recompiled && %cc %s -S -o - -zGI%t.isum
+
+// The summary file written by -zGS also records the registers corrupted
+// by each external function.  A value live across a call to one read
+// back with -zGI may then stay in an argument register which the callee
+// leaves alone, rather than in a register which must be saved.
+//
+// The object file records the checksum of each summary in a debug area
+// of its own, not in the program's data.  A summary is used only while
+// its object still records it: once the callee is recompiled (here
+// without -zGS) the summary is ignored, and calls to it assume that it
+// corrupts every register the procedure call standard allows.
+
+#ifdef EXPORT
+// CHECK: AREA C$$code
+// CHECK-NO: C$$data
+// CHECK: AREA C$$regsummary DEBUG size 8
+int popc(unsigned x) { int n = 0; while (x) { x &= x - 1; n++; } return n; }
+int popc2(unsigned x) { int n = 0; while (x) { x &= x - 1; n++; } return n; }
+#else
+extern int popc(unsigned x);
+extern int popc2(unsigned x, int y);    /* does not match the definition */
+
+// CHECK: use_popc
+// CHECK-NO: r4
+// CHECK: bl      popc
+// CHECK: add     r0, r0, r3
+// CHECK: ldmdb   fp, {fp, sp, pc}
+int use_popc(unsigned a, int b) { return popc(a) + b; }
+
+// A summary is not used when the declaration here disagrees with it.
+// CHECK: use_popc2
+// CHECK: mov     r4, r1
+// CHECK: bl      popc2
+// CHECK: add     r0, r0, r4
+int use_popc2(unsigned a, int b) { return popc2(a, 0) + b; }
+// CHECK-NO: x$r$
+// CHECK: recompiled
+
+// The stale summary of popc is ignored.
+// CHECK: use_popc
+// CHECK-NO: popc2
+// CHECK: mov     r4, r1
+// CHECK: bl      popc
+// CHECK: add     r0, r0, r4
+#endif
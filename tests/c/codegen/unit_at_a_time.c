@@ -0,0 +1,23 @@
+// RUN: %cc --unit-at-a-time %s -S -o -
+
+// With --unit-at-a-time functions are compiled callees first, so a call
+// to a function defined later in the file knows which registers it
+// corrupts, and a static function which nothing references is omitted.
+
+static int twice(int x);
+static int unused(int x) { return x * 3; }
+
+// CHECK: twice
+// CHECK: mov     pc, lr
+// CHECK: top
+// CHECK: mov     r1, r0
+// CHECK: bl      twice
+// CHECK-NO: r4
+// CHECK: add     r0, r0, r1
+// CHECK-NO: unused
+// CHECK: END
+int top(int a)
+{   return twice(a) + a;
+}
+
+static int twice(int x) { return x + x; }
@@ -0,0 +1,37 @@
+// RUN: %cc -dwarf2 -g -gt+t %s -c -o %t.o && %armsim --areas %t.o
+// RUN: %cc -dwarf2 -g -gt+t -DOTHER %s -c -o %t2.o && %armsim --areas %t2.o
+// RUN: %cc -dwarf2 -g %s -c -o %t3.o && %armsim --areas %t3.o
+
+// With -gt+t each top-level structure type goes in a COMDEF debug area
+// named from a signature of its contents, so two objects which both use
+// it (here the same source with a different function) give it the same
+// name and the linker keeps one. The compilation unit refers to the
+// types' areas, and struct line's area to struct point's. Without +t the
+// types stay in .debug_info.
+
+struct point { int x, y; };
+struct line { struct point a, b; };
+
+#ifdef OTHER
+int g(struct line *l) { return l->b.y; }
+#else
+int f(struct point *p) { return p->x + p->y; }
+struct line l;
+#endif
+
+// CHECK: AREA .debug_info DEBUG
+// CHECK: -> .debug_info$$T32ff672d83d220fa
+// CHECK: AREA .debug_info$$T32ff672d83d220fa DEBUG COMDEF
+// CHECK: AREA .debug_info$$T25190a0fb61b74fc DEBUG COMDEF
+// CHECK: -> .debug_info$$T32ff672d83d220fa
+// CHECK: AREA .debug_line
+
+// CHECK: AREA .debug_info DEBUG
+// CHECK: -> .debug_info$$T
+// CHECK: AREA .debug_info$$T32ff672d83d220fa DEBUG COMDEF
+// CHECK: AREA .debug_info$$T25190a0fb61b74fc DEBUG COMDEF
+// CHECK: AREA .debug_line
+
+// CHECK: AREA .debug_info DEBUG
+// CHECK-NO: $$T
+// CHECK: AREA .debug_abbrev
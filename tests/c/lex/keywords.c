@@ -0,0 +1,24 @@
+// RUN: %cc %s -S -o -
+
+// Identifiers and numbers are read in runs from the preprocessor's
+// buffer and keywords found by a perfect hash: check names built by
+// pasting, keywords from macros and names which merely begin with one.
+
+#define CAT(a, b) a##b
+#define T int
+
+CAT(un, signed) CAT(lo, ng) CAT(v, ar) = 0x12345678;
+T intx = 4660, do_ = 0x1234, _int = 012;
+
+// CHECK: get
+// CHECK: ldr             r0, [r0, #4]
+// CHECK: mov             pc, lr
+// CHECK: var
+// CHECK: DCD      0x12345678
+// CHECK: intx
+// CHECK: DCD      0x00001234
+// CHECK: do_
+// CHECK: DCD      0x00001234
+// CHECK: _int
+// CHECK: DCD      0x0000000a
+CAT(sign, ed) T CAT(g, et)(void) { CAT(ret, urn) intx; }
@@ -0,0 +1,14 @@
+// RUN: %cxx --lazy-bodies %s -S -o -
+
+// --lazy-bodies only defers C static functions; with C++ it says so
+// and in-class member bodies are read after the class as usual.
+
+// CHECK-ERR: Warning: --lazy-bodies has no effect on C++ (ignored)
+struct A {
+    int get() { return n * 3; }
+    int n;
+};
+
+// CHECK: f
+// CHECK: END
+int f(A *a) { return a->get(); }
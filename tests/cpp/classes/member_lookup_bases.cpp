@@ -0,0 +1,27 @@
+// RUN: %cxx %s -S -o -
+// EXPECT-ERROR
+
+// Member lookup through repeated, virtual and ambiguous bases.  Lookups
+// of the same names recur from several classes so that remembered
+// results are reused; diagnostics must be unaffected.
+
+struct A { int a; int f() { return a; } };
+struct B : virtual A { int b; };
+struct C : virtual A { int c; };
+struct D : B, C { int d; int g() { return a + b + c + d + f(); } };
+struct E : D { int e; int h() { return g() + a + e; } };
+
+int use(E *p) { return p->h() + p->a + p->b; }
+int use2(D *p) { return p->a + p->c + p->f(); }
+
+struct X { int x; };
+struct Y { int x; };
+struct Z : X, Y { int z; };
+
+// CHECK-ERR: Error: 'x' is an ambiguous name in 'struct Z'
+int amb(Z *p) { return p->x; }
+int ok(Z *p) { return p->z + p->X::x; }
+// CHECK-ERR: Serious error: 'nosuch' is not a member of struct/class 'E'
+int none(E *p) { return p->nosuch; }
+// CHECK-ERR: Serious error: 'e' is not a member of struct/class 'D'
+int none2(D *p) { return p->e; }
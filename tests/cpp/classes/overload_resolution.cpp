@@ -0,0 +1,57 @@
+// RUN: %cxx %s -S -o -
+
+// Overload resolution of calls and operators which recur with the same
+// argument types, including from template instances.  Exact matches are
+// picked without ranking and repeated resolutions are remembered; each
+// call must still reach the same function.
+
+struct Str {
+    char *p;
+    Str(const char *);
+    Str(const Str &);
+    Str &operator+=(const Str &);
+    Str &operator+=(char);
+    int operator==(const Str &) const;
+    int operator==(const char *) const;
+};
+
+int f(int);
+int f(long);
+int f(double);
+int f(const char *);
+int f(const Str &);
+
+// CHECK-LABEL: calls__FR3Str
+// CHECK: bl              f__Fi
+// CHECK: bl              f__Fl
+// CHECK: bl              f__Fd
+// CHECK: bl              f__FPCc
+// CHECK: bl              f__FRC3Str
+// CHECK: bl              f__Fi
+// CHECK: bl              f__FRC3Str
+int calls(Str &r) {
+    return f(1) + f(2L) + f(2.5) + f("lit") + f(r) + f(3) + f(r);
+}
+
+// The instances are emitted before inst().
+// CHECK-LABEL: twice__tF1TT1_i_<i>__FiT1
+// CHECK: bl              f__Fi
+// CHECK: bl              f__Fi
+// CHECK: bl              f__Fi
+// CHECK-LABEL: twice__tF1TT1_i_<d>__FdT1
+// CHECK: bl              f__Fd
+// CHECK: bl              f__Fd
+// CHECK: bl              f__Fd
+template <class T> int twice(T a, T b) { return f(a) + f(b) + f(a); }
+
+// CHECK-LABEL: inst__FR3StrT1
+// CHECK: bl              __apl__3StrFRC3Str
+// CHECK: bl              __apl__3StrFc
+// CHECK: bl              __apl__3StrFRC3Str
+// CHECK: bl              __eq__3StrCFRC3Str
+// CHECK: bl              __eq__3StrCFPCc
+// CHECK: bl              __eq__3StrCFRC3Str
+int inst(Str &a, Str &b) {
+    a += b; a += 'c'; a += b;
+    return (a == b) + (a == "x") + (a == b) + twice(1, 2) + twice(2.0, 3.0);
+}
@@ -0,0 +1,20 @@
+// RUN: %cxx -dwarf2 -g -gt+t %s -c -o %t.o && %armsim --areas %t.o
+
+// A unit with a dynamic initialiser still shares its types under -gt+t:
+// the debug flags which are switched off while the initialisation
+// function is generated come back without losing the +t.
+
+struct point { int x, y; point() : x(1), y(2) {} };
+struct line { point a, b; };
+
+line l;
+
+int f(point *p) { return p->x + p->y; }
+
+// CHECK: AREA C$$ctor
+// CHECK: AREA .debug_info DEBUG
+// CHECK: AREA .debug_info$$T
+// CHECK: DEBUG COMDEF
+// CHECK: AREA .debug_info$$T
+// CHECK: DEBUG COMDEF
+// CHECK: AREA .debug_line
@@ -0,0 +1,40 @@
+// RUN: %cxx %s -DFIRST -zGT%t.rep -S -o %t.1.s
+// RUN: cat %t.rep
+// RUN: %cxx %s -zGT%t.rep -S -o -
+
+// A template repository shared between units: the second unit takes the
+// <int> instances generated by the first as external references and only
+// generates code for the <double> ones.
+
+template <class T> struct V {
+    T *p;
+    int n;
+    T get(int i) { return p[i]; }
+    void set(int i, T v);
+};
+
+template <class T> void V<T>::set(int i, T v) { p[i] = v; }
+
+template <class T> T sum(T *a, int n) {
+    T s = 0;
+    for (int i = 0; i < n; i++) s += a[i];
+    return s;
+}
+
+// The inline member is never recorded.
+// CHECK-NO: get__
+// CHECK: set__5V__tiFiT1
+// CHECK: sum__tFP1Ti_1T_<i>__FPii
+int f(V<int> &v) {
+    v.set(0, 1);
+    return v.get(1) + sum(v.p, v.n) + sum(v.p, 2);
+}
+
+#ifndef FIRST
+double g(V<double> &v) { v.set(0, 1.0); return sum(v.p, v.n); }
+#endif
+
+// CHECK: EXPORT |sum__tFP1Ti_1T_<d>__FPdi|
+// CHECK: EXPORT set__5V__tdFid
+// CHECK: IMPORT |sum__tFP1Ti_1T_<i>__FPii|
+// CHECK: IMPORT set__5V__tiFiT1
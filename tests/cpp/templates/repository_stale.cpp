@@ -0,0 +1,33 @@
+// RUN: touch other.o && python3 -c "print('x' * 3000 + '\tother.o'); print('set__5V__tiFiT1\tgone.o'); print('sum__tFP1Ti_1T_<i>__FPii\tother.o'); print('set__5V__tdFid\t%t.s')" > %t.rep
+// RUN: %cxx %s -zGT%t.rep -S -o %t.s && cat %t.s
+// RUN: %cxx %s -zGT%t.rep -S -o %t.s && awk -F '\t' '{ print substr($1, 1, 15), $2 }' %t.rep
+
+// Repository lines are read whatever their length. The line for an object
+// which no longer exists is ignored, so its instance is generated here. The
+// unit's own old lines are replaced, not added to, when it is recompiled.
+
+template <class T> struct V {
+    T *p;
+    void set(int i, T v);
+};
+
+template <class T> void V<T>::set(int i, T v) { p[i] = v; }
+
+template <class T> T sum(T *a, int n) {
+    T s = 0;
+    for (int i = 0; i < n; i++) s += a[i];
+    return s;
+}
+
+int f(V<int> &v) { v.set(0, 1); return sum(v.p, 2); }
+
+// CHECK: EXPORT set__5V__tiFiT1
+// CHECK: IMPORT |sum__tFP1Ti_1T_<i>__FPii|
+
+// The long line and other.o's line are kept; gone.o's is dropped, and the
+// unit's own line for set<double>, no longer generated, goes with it.
+// CHECK: xxxxxxxxxxxxxxx other.o
+// CHECK: sum__tFP1Ti_1T_ other.o
+// CHECK-NO: gone.o
+// CHECK-NO: set__5V__tdFid
+// CHECK: set__5V__tiFiT1
@@ -182,25 +182,37 @@ float t_loop_fma_sum(const float *p, int n) {
     // CHECK: mov       r2, #0
     // CHECK: cmp       r1, #0
     // CHECK: movle     pc, lr
-    // CHECK: ldfs      f1, [pc, #L00021c-.-8]
+    // CHECK: ldfs      f1, [pc, #L00023c-.-8]
 
-    // CHECK: |L0001fc.J4.t_loop_fma_sum|
+    // The first load is issued before the loop, and each iteration loads
+    // the next element before the loop test.
+    // CHECK: add       r3, r0, r2, lsl #2
+    // CHECK: ldfs      f2, [r3]
+    // CHECK: add       r3, r2, #1
+    // CHECK: cmp       r3, r1
+    // CHECK: bge       |L000230.J11.t_loop_fma_sum|
+    // CHECK: |L000210.J10.t_loop_fma_sum|
     for (i = 0; i < n; ++i) {
-        // CHECK: add       r3, r0, r2, lsl #2
-        // CHECK: ldfs      f2, [r3]
         // CHECK: mufs      f2, f2, f1
+        // CHECK: add       r2, r2, #1
         // CHECK: adfs      f0, f2, f0
         acc = acc + p[i] * 1.5f;
 
-        // CHECK: add       r2, r2, #1
-        // CHECK: cmp       r2, r1
-        // CHECK: blt       |L0001fc.J4.t_loop_fma_sum|
+        // CHECK: add       r3, r0, r2, lsl #2
+        // CHECK: ldfs      f2, [r3]
+        // CHECK: add       r3, r2, #1
+        // CHECK: cmp       r3, r1
+        // CHECK: blt       |L000210.J10.t_loop_fma_sum|
     }
 
+    // The last iteration's arithmetic.
+    // CHECK: |L000230.J11.t_loop_fma_sum|
+    // CHECK: mufs      f1, f2, f1
+    // CHECK: adfs      f0, f1, f0
     // CHECK: mov       pc, lr
     return acc;
 }
-// CHECK: L00021c
+// CHECK: L00023c
 // CHECK: DCFS     1.5
 
 // ---------- Test 13: variadic call (should fall back to core regs/stack)
@@ -216,7 +228,7 @@ int t_varargs(float a, double b) {
     // CHECK: ldfd            f1, [sp], #&8
     // CHECK: mvfs            f0, f0
     // CHECK: stfd            f1, [sp, #-&8]!
-    // CHECK: add             r0, pc, #L00026c-.-8
+    // CHECK: add             r0, pc, #L00028c-.-8
     // CHECK: stfd            f0, [sp, #-&8]!
     // CHECK: ldmia           sp!, {r1-r3}
     // CHECK: bl              printf
@@ -32,8 +32,8 @@ double sumd(int n, ...)
         // CHECK: bic             r1, r1, #3
         // CHECK: add             r1, r1, #8
         // CHECK: ldfd            f1, [r1, #-&8]
-        // CHECK: adfd            f0, f1, f0
         // CHECK: add             r0, r0, #1
+        // CHECK: adfd            f0, f1, f0
         // CHECK: cmp             r0, r2
         // CHECK: blt             |L000034.J4.sumd|
         s += va_arg(ap, double);
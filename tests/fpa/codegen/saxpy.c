@@ -29,14 +29,16 @@ void saxpy(float *x, float *y, int n, float a) {
         // CHECK: add             ip, r1, r3, lsl #2
         // CHECK: ldfs            f2, [ip]
 
+        // ++i, scheduled into the load latency
+        // CHECK: add             r3, r3, #1
+
         // f1 = (a * x[i]) + y[i]
         // CHECK: adfs            f1, f1, f2
 
         // y[i] = f1
         // CHECK: stfs            f1, [ip]
 
-        // ++i, i < n
-        // CHECK: add             r3, r3, #1
+        // i < n
         // CHECK: cmp             r3, r2
         // CHECK: blt             |L000030.J4.saxpy|
         y[i] = a * x[i] + y[i];
@@ -11,19 +11,32 @@ double sumd(double *p, int n)
     // CHECK: cmp             r1, #0
     // CHECK: movle           pc, lr
 
-    // CHECK: |L000010.J4.sumd|
+    // The first element is loaded before the loop.
+    // CHECK: add             r3, r0, r2, lsl #3
+    // CHECK: ldfd            f1, [r3]
+    // CHECK: add             r3, r2, #1
+    // CHECK: cmp             r3, r1
+    // CHECK: bge             |L000040.J11.sumd|
+
+    // CHECK: |L000024.J10.sumd|
     for (i = 0; i < n; ++i) {
+        // Each iteration adds the element loaded by the one before, and
+        // loads the next.
+        // CHECK: add             r2, r2, #1
+        // CHECK: adfd            f0, f1, f0
         // CHECK: add             r3, r0, r2, lsl #3
         // CHECK: ldfd            f1, [r3]
-        // CHECK: adfd            f0, f1, f0
         s += p[i];
 
-        // ++1, i < n
-        // CHECK: add             r2, r2, #1
-        // CHECK: cmp             r2, r1
-        // CHECK: blt             |L000010.J4.sumd|
+        // i+1 < n
+        // CHECK: add             r3, r2, #1
+        // CHECK: cmp             r3, r1
+        // CHECK: blt             |L000024.J10.sumd|
     }
 
+    // The last element.
+    // CHECK: |L000040.J11.sumd|
+    // CHECK: adfd            f0, f1, f0
     // CHECK: mov             pc, lr
     return s;
 }
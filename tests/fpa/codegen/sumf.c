@@ -10,20 +10,32 @@ float sumf(float *p, int n) {
     // CHECK: cmp       r1, #0
     // CHECK: movle     pc, lr
 
-    // CHECK: |L000010.J4.sumf|
+    // The first element is loaded before the loop.
+    // CHECK: add             r3, r0, r2, lsl #2
+    // CHECK: ldfs            f1, [r3]
+    // CHECK: add             r3, r2, #1
+    // CHECK: cmp             r3, r1
+    // CHECK: bge             |L000040.J11.sumf|
+
+    // CHECK: |L000024.J10.sumf|
     for (i = 0; i < n; ++i) {
+        // Each iteration adds the element loaded by the one before, and
+        // loads the next.
+        // CHECK: add             r2, r2, #1
+        // CHECK: adfs            f0, f1, f0
         // CHECK: add             r3, r0, r2, lsl #2
         // CHECK: ldfs            f1, [r3]
-        // CHECK: adfs            f0, f1, f0
         s += p[i];
 
-        // ++1, i < n
-        // CHECK: add             r2, r2, #1
-        // CHECK: cmp             r2, r1
-
-        // CHECK: blt             |L000010.J4.sumf|
+        // i+1 < n
+        // CHECK: add             r3, r2, #1
+        // CHECK: cmp             r3, r1
+        // CHECK: blt             |L000024.J10.sumf|
     }
 
+    // The last element.
+    // CHECK: |L000040.J11.sumf|
+    // CHECK: adfs            f0, f1, f0
     // CHECK: mov             pc, lr
     return s;
 }
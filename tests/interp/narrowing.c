@@ -0,0 +1,36 @@
+// RUN: %npp %s
+
+// Casts to char and short types truncate and then sign or zero extend,
+// and reading a bit field gives just its bits, sign extended for a signed
+// field, whether on its own or as an operand. Plain int fields are
+// unsigned, as plain char is.
+
+struct S { unsigned a : 3, b : 5; int c : 4; signed int d : 4; };
+
+// SET: 0x8000 0x12348281
+// SET: 0x8100 0x0000f1fd
+
+// EVAL: (unsigned char)*(int *)0x8000
+// EVAL: (signed char)*(int *)0x8000
+// EVAL: (unsigned short)*(int *)0x8000
+// EVAL: (short)*(int *)0x8000
+// EVAL: (short)(*(int *)0x8000 + 0x8000)
+// EVAL: (char)*(unsigned short *)0x8000 == 0x81
+// EVAL: ((struct S *)0x8100)->a
+// EVAL: ((struct S *)0x8100)->b
+// EVAL: ((struct S *)0x8100)->c
+// EVAL: ((struct S *)0x8100)->d
+// EVAL: ((struct S *)0x8100)->d * 10 + ((struct S *)0x8100)->b
+
+// CHECK: (unsigned char)*(int *)0x8000 = 129 (0x00000081) [bytecode]
+// CHECK: (signed char)*(int *)0x8000 = -127 (0xffffff81) [bytecode]
+// CHECK: (unsigned short)*(int *)0x8000 = 33409 (0x00008281) [bytecode]
+// CHECK: (short)*(int *)0x8000 = -32127 (0xffff8281) [bytecode]
+// CHECK: (short)(*(int *)0x8000 + 0x8000) = 641 (0x00000281) [bytecode]
+// CHECK: (char)*(unsigned short *)0x8000 == 0x81 = 1 (0x00000001) [bytecode]
+// CHECK: ((struct S *)0x8100)->a = 5 (0x00000005) [bytecode]
+// CHECK: ((struct S *)0x8100)->b = 31 (0x0000001f) [bytecode]
+// CHECK: ((struct S *)0x8100)->c = 1 (0x00000001) [bytecode]
+// CHECK: ((struct S *)0x8100)->d = -1 (0xffffffff) [bytecode]
+// CHECK: ((struct S *)0x8100)->d * 10 + ((struct S *)0x8100)->b = 21 (0x00000015) [bytecode]
+// CHECK-NO: bytecode gives
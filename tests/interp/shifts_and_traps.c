@@ -0,0 +1,41 @@
+// RUN: %npp %s
+
+// Shifts use the bottom byte of the count, as the target's register shifts
+// do: 32 or more gives 0, or all sign bits for a signed right shift. The
+// right operand of && is only evaluated if it is needed.
+// Dividing by zero, or the most negative int by -1, cannot be evaluated,
+// and neither can a call, which the stand-in target has no code for; the
+// call is left to the tree walk.
+
+// SET: 0x8000 32
+// SET: 0x8004 0x80000000
+// SET: 0x8008 0
+// SET: 0x800c 0x104
+// SET: 0x8010 -1
+
+// EVAL: 1 << *(int *)0x8000
+// EVAL: 1 << *(int *)0x800c
+// EVAL: *(int *)0x8004 >> *(int *)0x8000
+// EVAL: *(unsigned *)0x8004 >> *(int *)0x8000
+// EVAL: *(int *)0x8004 >> 31
+// EVAL: -*(int *)0x8004
+// EVAL: *(int *)0x8004 - 1
+// EVAL: 1 / *(int *)0x8008
+// EVAL: 1u % *(unsigned *)0x8008
+// EVAL: *(int *)0x8004 / *(int *)0x8010
+// EVAL: *(int *)0x8008 && 1 / *(int *)0x8008
+// EVAL: ((int (*)(void))0x8000)() + 1
+
+// CHECK: 1 << *(int *)0x8000 = 0 (0x00000000) [bytecode]
+// CHECK: 1 << *(int *)0x800c = 16 (0x00000010) [bytecode]
+// CHECK: *(int *)0x8004 >> *(int *)0x8000 = -1 (0xffffffff) [bytecode]
+// CHECK: *(unsigned *)0x8004 >> *(int *)0x8000 = 0 (0x00000000) [bytecode]
+// CHECK: *(int *)0x8004 >> 31 = -1 (0xffffffff) [bytecode]
+// CHECK: -*(int *)0x8004 = -2147483648 (0x80000000) [bytecode]
+// CHECK: *(int *)0x8004 - 1 = 2147483647 (0x7fffffff) [bytecode]
+// CHECK: 1 / *(int *)0x8008: cannot evaluate [bytecode]
+// CHECK: 1u % *(unsigned *)0x8008: cannot evaluate [bytecode]
+// CHECK: *(int *)0x8004 / *(int *)0x8010: cannot evaluate [bytecode]
+// CHECK: *(int *)0x8008 && 1 / *(int *)0x8008 = 0 (0x00000000) [bytecode]
+// CHECK: ((int (*)(void))0x8000)() + 1: cannot evaluate [tree]
+// CHECK-NO: bytecode gives
@@ -0,0 +1,40 @@
+// RUN: %npp %s
+
+// Division, remainder, right shift and the comparisons depend on whether
+// the operands are signed, and pointers compare as unsigned. The bytecode
+// and the tree walk must agree on each (npp fails the run if they don't).
+
+// SET: 0x8000 0xfffffff0
+// SET: 0x8004 7
+// SET: 0x8008 0x80000000
+
+// EVAL: *(unsigned *)0x8000 / *(unsigned *)0x8004
+// EVAL: *(int *)0x8000 / *(int *)0x8004
+// EVAL: *(unsigned *)0x8000 % *(unsigned *)0x8004
+// EVAL: *(int *)0x8000 % *(int *)0x8004
+// EVAL: *(unsigned *)0x8000 >> 4
+// EVAL: *(int *)0x8000 >> 4
+// EVAL: *(unsigned *)0x8000 > *(unsigned *)0x8004
+// EVAL: *(int *)0x8000 > *(int *)0x8004
+// EVAL: *(unsigned *)0x8008 <= 1u
+// EVAL: *(int *)0x8008 <= 1
+// EVAL: *(int **)0x8008 > (int *)0x8000
+// EVAL: *(unsigned *)0x8008 * 2 + *(unsigned *)0x8004
+// PRINT: *(unsigned *)0x8000 / *(unsigned *)0x8004
+
+// CHECK: *(unsigned *)0x8000 / *(unsigned *)0x8004 = 613566754 (0x24924922) [bytecode]
+// CHECK: *(int *)0x8000 / *(int *)0x8004 = -2 (0xfffffffe) [bytecode]
+// CHECK: *(unsigned *)0x8000 % *(unsigned *)0x8004 = 2 (0x00000002) [bytecode]
+// CHECK: *(int *)0x8000 % *(int *)0x8004 = -2 (0xfffffffe) [bytecode]
+// CHECK: *(unsigned *)0x8000 >> 4 = 268435455 (0x0fffffff) [bytecode]
+// CHECK: *(int *)0x8000 >> 4 = -1 (0xffffffff) [bytecode]
+// CHECK: *(unsigned *)0x8000 > *(unsigned *)0x8004 = 1 (0x00000001) [bytecode]
+// CHECK: *(int *)0x8000 > *(int *)0x8004 = 0 (0x00000000) [bytecode]
+// CHECK: *(unsigned *)0x8008 <= 1u = 0 (0x00000000) [bytecode]
+// CHECK: *(int *)0x8008 <= 1 = 1 (0x00000001) [bytecode]
+// CHECK: *(int **)0x8008 > (int *)0x8000 = 1 (0x00000001) [bytecode]
+// CHECK: *(unsigned *)0x8008 * 2 + *(unsigned *)0x8004 = 7 (0x00000007) [bytecode]
+// CHECK-NO: bytecode gives
+
+// The debugger's display shows the same value.
+// CHECK-ERR: = [unsigned int] 613566754
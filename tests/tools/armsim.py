@@ -0,0 +1,932 @@
+#!/usr/bin/env python3
+# Minimal AOF linker and ARM/VFP user-mode simulator for execution tests.
+#
+#   armsim.py [-t] [--steps N] file.o [file.o ...]
+#   armsim.py --areas file.o [file.o ...]
+#
+# Links the given AOF objects at 0x8000, calls main() and exits with its
+# result. With --areas it instead lists each object's areas and what their
+# relocations refer to, for tests of the object format itself. Undefined symbols resolve to host stubs (printf, memcpy, the
+# division helpers, ...); calling any other undefined symbol is an error.
+# Tests may declare 'extern unsigned sim_fpscr(void)' to read the FPSCR.
+#
+# Covers what ncc emits for -apcs 3/32bit with -fpu vfp/vfpv2/vfpv3: ARMv5
+# core instructions and VFP including the VFPv2 short-vector mode (FPSCR
+# LEN/STRIDE). Not a full architecture model: no Thumb, no exceptions, no
+# privileged modes, no floating-point exception flags.
+
+import math
+import struct
+import sys
+
+M32 = 0xffffffff
+MEMSIZE = 0x400000
+LOADBASE = 0x8000
+STUBBASE = 0x1000
+STACKTOP = MEMSIZE - 0x100
+EXITADDR = 0x0ffc
+
+class SimError(Exception):
+    pass
+
+# ----------------------------- AOF loading -----------------------------
+
+AOF_0INITAT = 0x1000
+AOF_DEBUGAT = 0x8000
+AOF_COMDEFAT = 0x0400
+
+REL_TYPE2 = 0x80000000
+REL_B = 0x10000000
+REL_A = 0x08000000
+REL_R = 0x04000000
+
+def read_chunks(path):
+    d = open(path, 'rb').read()
+    hdr, maxc, _ = struct.unpack_from('<III', d, 0)
+    if hdr != 0xC3CBC6C5:
+        raise SimError(f'{path}: not a chunk file')
+    ch = {}
+    for i in range(maxc):
+        cid, off, sz = struct.unpack_from('<8sII', d, 12 + 16 * i)
+        if off:
+            ch[cid.decode('latin-1')] = d[off:off + sz]
+    return ch
+
+class Obj:
+    def __init__(self, path):
+        ch = read_chunks(path)
+        self.path = path
+        strt = ch['OBJ_STRT']
+        def s(o):
+            return strt[o:strt.index(b'\0', o)].decode('latin-1')
+        head = ch['OBJ_HEAD']
+        _, _, na, ns, _, _ = struct.unpack_from('<6I', head, 0)
+        symt = ch.get('OBJ_SYMT', b'')
+        self.syms = []
+        for i in range(ns):
+            n, at, v, an = struct.unpack_from('<4I', symt, 16 * i)
+            self.syms.append((s(n), at, v, s(an) if at & 1 else None))
+        self.areas = []
+        data = ch['OBJ_AREA']
+        pos = 0
+        for i in range(na):
+            n, at, sz, nr, _ = struct.unpack_from('<5I', head, 24 + 20 * i)
+            if at & AOF_0INITAT:
+                body = bytes(sz)
+            else:
+                body = data[pos:pos + sz]
+                pos += sz
+            rels = [struct.unpack_from('<II', data, pos + 8 * j) for j in range(nr)]
+            pos += 8 * nr
+            self.areas.append({'name': s(n), 'attr': at, 'data': bytearray(body),
+                               'rels': rels, 'base': None})
+
+def link(paths, mem):
+    objs = [Obj(p) for p in paths]
+    addr = LOADBASE
+    comdefs = {}
+    for o in objs:
+        for a in o.areas:
+            if a['attr'] & AOF_DEBUGAT:
+                continue
+            if a['attr'] & AOF_COMDEFAT and a['name'] in comdefs:
+                a['base'] = comdefs[a['name']]
+                a['dup'] = True
+                continue
+            align = 1 << max(2, a['attr'] & 0xff)
+            addr = (addr + align - 1) & ~(align - 1)
+            a['base'] = addr
+            comdefs[a['name']] = addr
+            addr += len(a['data'])
+    if addr >= STACKTOP - 0x10000:
+        raise SimError('image too large')
+    heap = (addr + 15) & ~15
+
+    globs = {}
+    for o in objs:
+        for name, at, v, an in o.syms:
+            if at & 3 == 3:
+                base = next(a['base'] for a in o.areas if a['name'] == an)
+                globs.setdefault(name, base + v)
+    stubs = {}
+    def resolve(o, name, at, v, an):
+        if at & 1:
+            if at & 2 and name in globs:
+                return globs[name]
+            return next(a['base'] for a in o.areas if a['name'] == an) + v
+        if name in globs:
+            return globs[name]
+        if name not in stubs:
+            stubs[name] = STUBBASE + 4 * len(stubs)
+        return stubs[name]
+
+    for o in objs:
+        for a in o.areas:
+            if a['base'] is None or a.get('dup'):
+                continue
+            d = a['data']
+            for off, fl in a['rels']:
+                if not fl & REL_TYPE2:
+                    raise SimError(f'{o.path}: type 1 relocation')
+                ix = fl & 0xffffff
+                if fl & REL_A:
+                    target = resolve(o, *o.syms[ix])
+                else:
+                    target = o.areas[ix]['base']
+                ft = (fl >> 24) & 3
+                if fl & REL_B:
+                    raise SimError(f'{o.path}: based relocation')
+                if fl & REL_R:
+                    delta = target - a['base']
+                    if ft != 3:
+                        raise SimError(f'{o.path}: PC-relative data relocation')
+                    ins, = struct.unpack_from('<I', d, off)
+                    if (ins >> 25) & 7 == 5:
+                        field = ((ins & 0xffffff) + (delta >> 2)) & 0xffffff
+                        ins = (ins & 0xff000000) | field
+                    else:
+                        raise SimError(f'{o.path}: unsupported PC-relative '
+                                       f'instruction 0x{ins:08x}')
+                    struct.pack_into('<I', d, off, ins)
+                else:
+                    if ft == 3:
+                        raise SimError(f'{o.path}: absolute instruction relocation')
+                    size = {0: 1, 1: 2, 2: 4}[ft]
+                    fmt = {1: '<B', 2: '<H', 4: '<I'}[size]
+                    v, = struct.unpack_from(fmt, d, off)
+                    struct.pack_into(fmt, d, off, (v + target) & ((1 << 8 * size) - 1))
+            mem[a['base']:a['base'] + len(d)] = d
+    if 'main' not in globs:
+        raise SimError('no main')
+    return globs['main'], {v: k for k, v in stubs.items()}, heap
+
+def show_areas(paths):
+    for p in paths:
+        o = Obj(p)
+        for a in o.areas:
+            attrs = [n for n, bit in (('DEBUG', AOF_DEBUGAT), ('COMDEF', AOF_COMDEFAT),
+                                      ('NOINIT', AOF_0INITAT)) if a['attr'] & bit]
+            print(f"AREA {a['name']} {' '.join(attrs)} size {len(a['data'])}")
+            for off, fl in a['rels']:
+                ix = fl & 0xffffff
+                to = o.syms[ix][0] if fl & REL_A else o.areas[ix]['name']
+                print(f'  0x{off:x} -> {to}')
+
+# ------------------------------- helpers -------------------------------
+
+def ror(v, n):
+    n &= 31
+    return ((v >> n) | (v << (32 - n))) & M32 if n else v
+
+def sx(v, bits):
+    v &= (1 << bits) - 1
+    return v - (1 << bits) if v >> (bits - 1) else v
+
+def s32(v):
+    return sx(v, 32)
+
+def f32_bits(x):
+    try:
+        return struct.unpack('<I', struct.pack('<f', x))[0]
+    except OverflowError:
+        return 0xff800000 if x < 0 else 0x7f800000
+
+def bits_f32(b):
+    return struct.unpack('<f', struct.pack('<I', b & M32))[0]
+
+def f64_bits(x):
+    return struct.unpack('<Q', struct.pack('<d', x))[0]
+
+def bits_f64(b):
+    return struct.unpack('<d', struct.pack('<Q', b))[0]
+
+def round_f32(x):
+    return bits_f32(f32_bits(x))
+
+def to_int(x, signed):
+    if math.isnan(x):
+        return 0
+    lo, hi = (-(1 << 31), (1 << 31) - 1) if signed else (0, M32)
+    if math.isinf(x):
+        return (hi if x > 0 else lo) & M32
+    return max(lo, min(hi, int(x))) & M32
+
+# ------------------------------ simulator ------------------------------
+
+class Sim:
+    def __init__(self, trace=False):
+        self.mem = bytearray(MEMSIZE)
+        self.r = [0] * 16
+        self.N = self.Z = self.C = self.V = 0
+        self.s = [0] * 32            # S0-S31 == D0-D15 (raw words)
+        self.dhi = [0] * 16          # D16-D31 (raw doublewords)
+        self.fpscr = 0
+        self.trace = trace
+        self.out = []
+
+    # memory
+    def chk(self, a, n):
+        if a < 0x100 or a + n > MEMSIZE:
+            raise SimError(f'bad address 0x{a:08x} at pc 0x{self.pc:08x}')
+    def rd32(self, a):
+        self.chk(a, 4)
+        if a & 3:
+            return ror(struct.unpack_from('<I', self.mem, a & ~3)[0], 8 * (a & 3))
+        return struct.unpack_from('<I', self.mem, a)[0]
+    def wr32(self, a, v):
+        self.chk(a, 4)
+        struct.pack_into('<I', self.mem, a & ~3, v & M32)
+    def rd16(self, a):
+        self.chk(a, 2)
+        return struct.unpack_from('<H', self.mem, a)[0]
+    def wr16(self, a, v):
+        self.chk(a, 2)
+        struct.pack_into('<H', self.mem, a, v & 0xffff)
+    def rd8(self, a):
+        self.chk(a, 1)
+        return self.mem[a]
+    def wr8(self, a, v):
+        self.chk(a, 1)
+        self.mem[a] = v & 0xff
+    def cstr(self, a):
+        e = self.mem.index(b'\0', a)
+        return self.mem[a:e].decode('latin-1')
+
+    # VFP registers
+    def gs(self, n):
+        return self.s[n]
+    def ss(self, n, v):
+        self.s[n] = v & M32
+    def gd(self, n):
+        if n < 16:
+            return self.s[2 * n] | (self.s[2 * n + 1] << 32)
+        return self.dhi[n - 16]
+    def sd(self, n, v):
+        if n < 16:
+            self.s[2 * n] = v & M32
+            self.s[2 * n + 1] = (v >> 32) & M32
+        else:
+            self.dhi[n - 16] = v & 0xffffffffffffffff
+
+    def cond(self, c):
+        N, Z, C, V = self.N, self.Z, self.C, self.V
+        return [Z, not Z, C, not C, N, not N, V, not V,
+                C and not Z, not C or Z, N == V, N != V,
+                not Z and N == V, Z or N != V, True, False][c]
+
+    def setnz(self, v):
+        self.N = v >> 31
+        self.Z = int(v == 0)
+
+    def reg(self, n):
+        return (self.pc + 8) & M32 if n == 15 else self.r[n]
+
+    def setreg(self, n, v):
+        if n == 15:
+            self.branch(v)
+        else:
+            self.r[n] = v & M32
+
+    def branch(self, v):
+        self.pc = v & ~3 & M32
+        self.jumped = True
+
+    def shifter(self, ins):
+        if ins & (1 << 25):
+            rot = ((ins >> 8) & 15) * 2
+            v = ror(ins & 0xff, rot)
+            return v, (v >> 31 if rot else self.C)
+        val = self.r[ins & 15] if (ins & 15) != 15 else (self.pc + (12 if ins & 0x10 else 8)) & M32
+        typ = (ins >> 5) & 3
+        if ins & 0x10:
+            amt = self.r[(ins >> 8) & 15] & 0xff
+            if amt == 0:
+                return val, self.C
+        else:
+            amt = (ins >> 7) & 31
+            if amt == 0:
+                if typ == 0:
+                    return val, self.C
+                if typ == 3:
+                    return (self.C << 31) | (val >> 1), val & 1
+                amt = 32
+        if typ == 0:
+            if amt < 32:
+                return (val << amt) & M32, (val >> (32 - amt)) & 1
+            return 0, (val & 1 if amt == 32 else 0)
+        if typ == 1:
+            if amt < 32:
+                return val >> amt, (val >> (amt - 1)) & 1
+            return 0, (val >> 31 if amt == 32 else 0)
+        if typ == 2:
+            if amt < 32:
+                return (s32(val) >> amt) & M32, (val >> (amt - 1)) & 1
+            return (M32 if val >> 31 else 0), val >> 31
+        amt &= 31
+        if amt == 0:
+            return val, val >> 31
+        v = ror(val, amt)
+        return v, v >> 31
+
+    def addc(self, a, b, c):
+        r = a + b + c
+        res = r & M32
+        return res, r >> 32, ((~(a ^ b) & (a ^ res)) >> 31) & 1
+
+    def dataproc(self, ins):
+        opc = (ins >> 21) & 15
+        S = (ins >> 20) & 1
+        rn = (ins >> 16) & 15
+        rd = (ins >> 12) & 15
+        op2, sc = self.shifter(ins)
+        a = (self.pc + (12 if not ins & (1 << 25) and ins & 0x10 else 8)) & M32 if rn == 15 else self.r[rn]
+        c, v = sc, self.V
+        if opc == 0: res = a & op2
+        elif opc == 1: res = a ^ op2
+        elif opc == 2: res, c, v = self.addc(a, ~op2 & M32, 1)
+        elif opc == 3: res, c, v = self.addc(op2, ~a & M32, 1)
+        elif opc == 4: res, c, v = self.addc(a, op2, 0)
+        elif opc == 5: res, c, v = self.addc(a, op2, self.C)
+        elif opc == 6: res, c, v = self.addc(a, ~op2 & M32, self.C)
+        elif opc == 7: res, c, v = self.addc(op2, ~a & M32, self.C)
+        elif opc == 8: res = a & op2
+        elif opc == 9: res = a ^ op2
+        elif opc == 10: res, c, v = self.addc(a, ~op2 & M32, 1)
+        elif opc == 11: res, c, v = self.addc(a, op2, 0)
+        elif opc == 12: res = a | op2
+        elif opc == 13: res = op2
+        elif opc == 14: res = a & ~op2 & M32
+        else: res = ~op2 & M32
+        if S and not (rd == 15 and not 8 <= opc <= 11):
+            self.setnz(res)
+            self.C, self.V = c, v
+        if not 8 <= opc <= 11:
+            self.setreg(rd, res)
+
+    def misc(self, ins):
+        # Returns True if ins was one of the miscellaneous encodings that
+        # share the data-processing space.
+        if ins & 0x0ffffff0 == 0x012fff10:
+            self.branch(self.r[ins & 15])
+            return True
+        if ins & 0x0ffffff0 == 0x012fff30:
+            t = self.r[ins & 15]
+            self.r[14] = (self.pc + 4) & M32
+            self.branch(t)
+            return True
+        if ins & 0x0fff0ff0 == 0x016f0f10:
+            v = self.r[ins & 15]
+            self.r[(ins >> 12) & 15] = 32 - v.bit_length()
+            return True
+        if ins & 0x0fbf0fff == 0x010f0000:
+            self.r[(ins >> 12) & 15] = (self.N << 31) | (self.Z << 30) | (self.C << 29) | (self.V << 28) | 0x10
+            return True
+        if ins & 0x0db0f000 == 0x0120f000:
+            v = ror(ins & 0xff, ((ins >> 8) & 15) * 2) if ins & (1 << 25) else self.r[ins & 15]
+            if ins & (1 << 19):
+                self.N, self.Z, self.C, self.V = v >> 31, (v >> 30) & 1, (v >> 29) & 1, (v >> 28) & 1
+            return True
+        return False
+
+    def multiply(self, ins):
+        rd = (ins >> 16) & 15
+        rn = (ins >> 12) & 15
+        rs = self.r[(ins >> 8) & 15]
+        rm = self.r[ins & 15]
+        S = (ins >> 20) & 1
+        A = (ins >> 21) & 1
+        if ins & (1 << 23):
+            if ins & (1 << 22):
+                p = s32(rm) * s32(rs)
+            else:
+                p = rm * rs
+            if A:
+                p += self.r[rn] | (self.r[rd] << 32)
+            p &= 0xffffffffffffffff
+            self.r[rn] = p & M32
+            self.r[rd] = p >> 32
+            if S:
+                self.N, self.Z = p >> 63, int(p == 0)
+        else:
+            p = (rm * rs + (self.r[rn] if A else 0)) & M32
+            self.r[rd] = p
+            if S:
+                self.setnz(p)
+
+    def extra_ldst(self, ins):
+        P, U, I, W, L = [(ins >> b) & 1 for b in (24, 23, 22, 21, 20)]
+        rn = (ins >> 16) & 15
+        rd = (ins >> 12) & 15
+        sh = (ins >> 5) & 3
+        off = ((ins >> 4) & 0xf0) | (ins & 0xf) if I else self.r[ins & 15]
+        base = self.reg(rn)
+        addr = (base + off if U else base - off) & M32
+        ea = addr if P else base
+        if L:
+            if sh == 1: self.r[rd] = self.rd16(ea)
+            elif sh == 2: self.r[rd] = sx(self.rd8(ea), 8) & M32
+            else: self.r[rd] = sx(self.rd16(ea), 16) & M32
+        else:
+            if sh == 1: self.wr16(ea, self.r[rd])
+            elif sh == 2:
+                self.r[rd], self.r[rd + 1] = self.rd32(ea), self.rd32(ea + 4)
+            else:
+                self.wr32(ea, self.r[rd]); self.wr32(ea + 4, self.r[rd + 1])
+        if (not P or W) and not (L and rn == rd):
+            self.r[rn] = addr
+
+    def ldst(self, ins):
+        I, P, U, B, W, L = [(ins >> b) & 1 for b in (25, 24, 23, 22, 21, 20)]
+        rn = (ins >> 16) & 15
+        rd = (ins >> 12) & 15
+        if I:
+            off, _ = self.shifter(ins & ~0x10 & ~(1 << 25))
+        else:
+            off = ins & 0xfff
+        base = self.reg(rn)
+        addr = (base + off if U else base - off) & M32
+        ea = addr if P else base
+        if L:
+            v = self.rd8(ea) if B else self.rd32(ea)
+        else:
+            v = self.reg(rd) + (4 if rd == 15 else 0)
+            if B: self.wr8(ea, v)
+            else: self.wr32(ea, v)
+        if (not P or W) and rn != 15:
+            self.r[rn] = addr
+        if L:
+            self.setreg(rd, v)
+
+    def ldm(self, ins):
+        P, U, S, W, L = [(ins >> b) & 1 for b in (24, 23, 22, 21, 20)]
+        rn = (ins >> 16) & 15
+        regs = [i for i in range(16) if ins & (1 << i)]
+        n = 4 * len(regs)
+        base = self.r[rn]
+        start = base + (4 if P else 0) if U else base - n + (0 if P else 4)
+        new = (base + n if U else base - n) & M32
+        a = start & M32
+        if L:
+            vals = [self.rd32(a + 4 * i) for i in range(len(regs))]
+            if W:
+                self.r[rn] = new
+            for reg, v in zip(regs, vals):
+                self.setreg(reg, v)
+        else:
+            for i, reg in enumerate(regs):
+                self.wr32(a + 4 * i, self.reg(reg) + (4 if reg == 15 else 0))
+            if W:
+                self.r[rn] = new
+
+    # ----- VFP -----
+
+    def vfp_ldst(self, ins):
+        dbl = (ins >> 8) & 1
+        P, U, D, W, L = [(ins >> b) & 1 for b in (24, 23, 22, 21, 20)]
+        rn = (ins >> 16) & 15
+        vd = (ins >> 12) & 15
+        imm = ins & 0xff
+        first = (D << 4) | vd if dbl else (vd << 1) | D
+        base = self.reg(rn) & ~3 if rn == 15 else self.r[rn]
+        if P and not W:
+            a = (base + 4 * imm if U else base - 4 * imm) & M32
+            count = 1
+        else:
+            a = base if U else (base - 4 * imm) & M32
+            count = imm // 2 if dbl else imm
+            if W:
+                self.r[rn] = (base + 4 * imm if U else base - 4 * imm) & M32
+        for i in range(count):
+            if dbl:
+                if L: self.sd(first + i, self.rd32(a) | (self.rd32(a + 4) << 32))
+                else:
+                    v = self.gd(first + i)
+                    self.wr32(a, v & M32); self.wr32(a + 4, v >> 32)
+                a += 8
+            else:
+                if L: self.ss(first + i, self.rd32(a))
+                else: self.wr32(a, self.gs(first + i))
+                a += 4
+
+    def vfp_mrrc(self, ins):
+        rt = (ins >> 12) & 15
+        rt2 = (ins >> 16) & 15
+        m = ins & 15
+        M = (ins >> 5) & 1
+        L = (ins >> 20) & 1
+        if ins & 0x100:
+            dm = (M << 4) | m
+            if L:
+                v = self.gd(dm)
+                self.r[rt], self.r[rt2] = v & M32, v >> 32
+            else:
+                self.sd(dm, self.r[rt] | (self.r[rt2] << 32))
+        else:
+            sm = (m << 1) | M
+            if L:
+                self.r[rt], self.r[rt2] = self.gs(sm), self.gs(sm + 1)
+            else:
+                self.ss(sm, self.r[rt]); self.ss(sm + 1, self.r[rt2])
+
+    def vfp_xfer(self, ins):
+        rt = (ins >> 12) & 15
+        if ins & 0x0fff0fff == 0x0ef10a10:
+            if rt == 15:
+                f = self.fpscr
+                self.N, self.Z, self.C, self.V = f >> 31, (f >> 30) & 1, (f >> 29) & 1, (f >> 28) & 1
+            else:
+                self.r[rt] = self.fpscr
+            return
+        if ins & 0x0fff0fff == 0x0ee10a10:
+            self.fpscr = self.r[rt]
+            return
+        if ins & 0x0fe00f7f == 0x0e000a10:
+            sn = (((ins >> 16) & 15) << 1) | ((ins >> 7) & 1)
+            if ins & (1 << 20): self.r[rt] = self.gs(sn)
+            else: self.ss(sn, self.r[rt])
+            return
+        if ins & 0x0fc00f7f == 0x0e000b10:
+            dn = (((ins >> 7) & 1) << 4) | ((ins >> 16) & 15)
+            x = (ins >> 21) & 1
+            v = self.gd(dn)
+            if ins & (1 << 20):
+                self.r[rt] = (v >> (32 * x)) & M32
+            else:
+                sh = 32 * x
+                self.sd(dn, (v & ~(M32 << sh)) | (self.r[rt] << sh))
+            return
+        raise SimError(f'unsupported VFP transfer 0x{ins:08x} at 0x{self.pc:08x}')
+
+    def vfp_dp(self, ins):
+        dbl = (ins >> 8) & 1
+        p, q, r, s = (ins >> 23) & 1, (ins >> 21) & 1, (ins >> 20) & 1, (ins >> 6) & 1
+        D, N, M = (ins >> 22) & 1, (ins >> 7) & 1, (ins >> 5) & 1
+        vd, vn, vm = (ins >> 12) & 15, (ins >> 16) & 15, ins & 15
+        if dbl:
+            d, n, m = (D << 4) | vd, (N << 4) | vn, (M << 4) | vm
+            get = lambda i: bits_f64(self.gd(i))
+            put = lambda i, x: self.sd(i, f64_bits(x))
+            rnd = lambda x: x
+        else:
+            d, n, m = (vd << 1) | D, (vn << 1) | N, (vm << 1) | M
+            get = lambda i: bits_f32(self.gs(i))
+            put = lambda i, x: self.ss(i, f32_bits(x))
+            rnd = round_f32
+        opc = (p << 2) | (q << 1) | r
+        if opc == 7:
+            opc2 = (ins >> 16) & 15
+            op = (ins >> 7) & 1
+            if not s:
+                imm = (((ins >> 16) & 15) << 4) | (ins & 15)
+                a, b, cdefgh = imm >> 7, (imm >> 6) & 1, imm & 0x3f
+                if dbl:
+                    bits = (a << 63) | ((b ^ 1) << 62) | ((0xff if b else 0) << 54) | (cdefgh << 48)
+                    self.vec(dbl, d, None, None, lambda _a, _b: bits_f64(bits), put, get)
+                else:
+                    bits = (a << 31) | ((b ^ 1) << 30) | ((0x1f if b else 0) << 25) | (cdefgh << 19)
+                    self.vec(dbl, d, None, None, lambda _a, _b: bits_f32(bits), put, get)
+                return
+            if opc2 == 0:
+                f = (lambda _a, x: abs(x)) if op else (lambda _a, x: x)
+                if op == 0:
+                    # VMOV copies the bit pattern (NaNs included).
+                    self.vec_raw(dbl, d, m)
+                    return
+                self.vec(dbl, d, None, m, f, put, get)
+                return
+            if opc2 == 1:
+                f = (lambda _a, x: rnd(math.sqrt(x)) if x >= 0 else math.nan) if op else (lambda _a, x: -x)
+                self.vec(dbl, d, None, m, f, put, get)
+                return
+            if opc2 in (4, 5):
+                a = get(d)
+                b = 0.0 if opc2 == 5 else get(m)
+                if math.isnan(a) or math.isnan(b): f = 0x3
+                elif a == b: f = 0x6
+                elif a < b: f = 0x8
+                else: f = 0x2
+                self.fpscr = (self.fpscr & 0x0fffffff) | (f << 28)
+                return
+            if opc2 == 7:
+                if dbl:
+                    self.ss((vd << 1) | D, f32_bits(bits_f64(self.gd((M << 4) | vm))))
+                else:
+                    self.sd((D << 4) | vd, f64_bits(bits_f32(self.gs((vm << 1) | M))))
+                return
+            if opc2 == 8:
+                iv = self.gs((vm << 1) | M)
+                x = float(s32(iv) if op else iv)
+                put(d, rnd(x))
+                return
+            if opc2 in (12, 13):
+                x = get(m)
+                if not op:
+                    mode = (self.fpscr >> 22) & 3
+                    x = [round, math.ceil, math.floor, math.trunc][mode](x) if math.isfinite(x) else x
+                self.ss((vd << 1) | D, to_int(x, opc2 == 13))
+                return
+            raise SimError(f'unsupported VFP op 0x{ins:08x} at 0x{self.pc:08x}')
+        if opc == 0:
+            f = (lambda acc, a, b: rnd(acc - rnd(a * b))) if s else (lambda acc, a, b: rnd(acc + rnd(a * b)))
+            self.vec3(dbl, d, n, m, f, put, get, True)
+        elif opc == 1:
+            f = (lambda acc, a, b: rnd(-acc - rnd(a * b))) if s else (lambda acc, a, b: rnd(rnd(a * b) - acc))
+            self.vec3(dbl, d, n, m, f, put, get, True)
+        elif opc == 2:
+            f = (lambda _c, a, b: -rnd(a * b)) if s else (lambda _c, a, b: rnd(a * b))
+            self.vec3(dbl, d, n, m, f, put, get, False)
+        elif opc == 3:
+            f = (lambda _c, a, b: rnd(a - b)) if s else (lambda _c, a, b: rnd(a + b))
+            self.vec3(dbl, d, n, m, f, put, get, False)
+        elif opc == 4 and not s:
+            def div(_c, a, b):
+                if b == 0:
+                    if a == 0 or math.isnan(a): return math.nan
+                    return math.copysign(math.inf, a) * math.copysign(1, b)
+                return rnd(a / b)
+            self.vec3(dbl, d, n, m, div, put, get, False)
+        else:
+            raise SimError(f'unsupported VFP op 0x{ins:08x} at 0x{self.pc:08x}')
+
+    # Short-vector iteration (VFPv2 FPSCR LEN/STRIDE). A destination in bank
+    # 0 makes the operation scalar; a bank 0 Sm/Dm is a scalar operand.
+    def vec_shape(self, dbl, d, m):
+        length = ((self.fpscr >> 16) & 7) + 1
+        stride = 2 if (self.fpscr >> 20) & 3 == 3 else 1
+        bank = 4 if dbl else 8
+        if length == 1 or d < bank or (dbl and d >= 16):
+            return 1, stride, bank, False
+        return length, stride, bank, m is not None and m < bank
+
+    def step(self, reg, stride, bank):
+        return (reg & ~(bank - 1)) | ((reg + stride) & (bank - 1))
+
+    def vec3(self, dbl, d, n, m, f, put, get, acc):
+        length, stride, bank, mscalar = self.vec_shape(dbl, d, m)
+        ops = []
+        for _ in range(length):
+            ops.append((d, n, m))
+            d, n = self.step(d, stride, bank), self.step(n, stride, bank)
+            if not mscalar:
+                m = self.step(m, stride, bank)
+        vals = [(dd, f(get(dd) if acc else 0.0, get(nn), get(mm))) for dd, nn, mm in ops]
+        for dd, x in vals:
+            put(dd, x)
+
+    def vec(self, dbl, d, n, m, f, put, get):
+        length, stride, bank, mscalar = self.vec_shape(dbl, d, m)
+        vals = []
+        for _ in range(length):
+            vals.append((d, f(None, get(m) if m is not None else None)))
+            d = self.step(d, stride, bank)
+            if m is not None and not mscalar:
+                m = self.step(m, stride, bank)
+        for dd, x in vals:
+            put(dd, x)
+
+    def vec_raw(self, dbl, d, m):
+        length, stride, bank, mscalar = self.vec_shape(dbl, d, m)
+        g, p = (self.gd, self.sd) if dbl else (self.gs, self.ss)
+        vals = []
+        for _ in range(length):
+            vals.append((d, g(m)))
+            d = self.step(d, stride, bank)
+            if not mscalar:
+                m = self.step(m, stride, bank)
+        for dd, x in vals:
+            p(dd, x)
+
+    # ----- execution -----
+
+    def execute(self, ins):
+        if ins >> 28 == 0xf:
+            if ins & 0xffb00f10 == 0xf3000110 and not ins & 0x40:
+                D, N, M = (ins >> 22) & 1, (ins >> 7) & 1, (ins >> 5) & 1
+                d = (D << 4) | ((ins >> 12) & 15)
+                n = (N << 4) | ((ins >> 16) & 15)
+                m = (M << 4) | (ins & 15)
+                self.sd(d, self.gd(n) ^ self.gd(m))
+                return
+            raise SimError(f'unsupported instruction 0x{ins:08x} at 0x{self.pc:08x}')
+        if not self.cond(ins >> 28):
+            return
+        op = (ins >> 25) & 7
+        if op == 0:
+            if ins & 0x0fc000f0 == 0x00000090 or ins & 0x0f8000f0 == 0x00800090:
+                self.multiply(ins)
+            elif ins & 0x90 == 0x90 and ins & 0x60:
+                self.extra_ldst(ins)
+            elif ins & 0x01900000 == 0x01000000 and self.misc(ins):
+                pass
+            else:
+                self.dataproc(ins)
+        elif op == 1:
+            if ins & 0x01900000 == 0x01000000 and self.misc(ins):
+                return
+            self.dataproc(ins)
+        elif op in (2, 3):
+            self.ldst(ins)
+        elif op == 4:
+            self.ldm(ins)
+        elif op == 5:
+            if ins & (1 << 24):
+                self.r[14] = (self.pc + 4) & M32
+            self.branch(self.pc + 8 + (sx(ins & 0xffffff, 24) << 2))
+        elif op == 6:
+            if (ins >> 9) & 7 != 5:
+                raise SimError(f'unsupported coprocessor 0x{ins:08x} at 0x{self.pc:08x}')
+            if ins & 0x0fe000d0 == 0x0c400010:
+                self.vfp_mrrc(ins)
+            else:
+                self.vfp_ldst(ins)
+        else:
+            if ins & (1 << 24):
+                raise SimError(f'SWI at 0x{self.pc:08x}')
+            if (ins >> 9) & 7 != 5:
+                raise SimError(f'unsupported coprocessor 0x{ins:08x} at 0x{self.pc:08x}')
+            if ins & 0x10:
+                self.vfp_xfer(ins)
+            else:
+                self.vfp_dp(ins)
+
+    def run(self, entry, stubs, heap, steps):
+        self.heap = heap
+        self.r[13] = STACKTOP
+        self.r[14] = EXITADDR
+        self.pc = entry
+        for _ in range(steps):
+            if self.pc == EXITADDR:
+                return self.r[0]
+            if STUBBASE <= self.pc < LOADBASE:
+                name = stubs.get(self.pc)
+                if name is None:
+                    raise SimError(f'jump to 0x{self.pc:08x}')
+                self.host(name)
+                self.pc = self.r[14]
+                continue
+            ins = self.rd32(self.pc)
+            if self.trace:
+                print(f'{self.pc:08x}: {ins:08x}', file=sys.stderr)
+            self.jumped = False
+            self.execute(ins)
+            if not self.jumped:
+                self.pc = (self.pc + 4) & M32
+        raise SimError('step limit exceeded')
+
+    # ----- host library -----
+
+    def arg_words(self):
+        sp = self.r[13]
+        i = 0
+        while True:
+            yield self.r[i] if i < 4 else self.rd32(sp + 4 * (i - 4))
+            i += 1
+
+    def printf(self, args):
+        fmt = self.cstr(next(args))
+        out = []
+        i = 0
+        while i < len(fmt):
+            ch = fmt[i]
+            if ch != '%':
+                out.append(ch); i += 1; continue
+            j = i + 1
+            while fmt[j] in '-+ #0': j += 1
+            spec = fmt[i:j]
+            if fmt[j] == '*':
+                spec += str(s32(next(args))); j += 1
+            while fmt[j].isdigit(): spec += fmt[j]; j += 1
+            if fmt[j] == '.':
+                spec += '.'; j += 1
+                if fmt[j] == '*':
+                    spec += str(s32(next(args))); j += 1
+                while fmt[j].isdigit(): spec += fmt[j]; j += 1
+            size = ''
+            while fmt[j] in 'hlLqjzt':
+                size += fmt[j]; j += 1
+            conv = fmt[j]
+            i = j + 1
+            if conv == '%':
+                out.append('%'); continue
+            if conv in 'diouxXc':
+                v = next(args)
+                if size in ('ll', 'q', 'j'):
+                    v |= next(args) << 32
+                    v = sx(v, 64) if conv in 'di' else v
+                else:
+                    v = s32(v) if conv in 'di' else v
+                if conv == 'u':
+                    conv = 'd'
+                out.append((spec + conv) % v)
+            elif conv in 'eEfFgG':
+                lo = next(args)
+                out.append((spec + conv) % bits_f64(lo | (next(args) << 32)))
+            elif conv == 's':
+                out.append((spec + 's') % self.cstr(next(args)))
+            elif conv == 'p':
+                out.append('0x%08x' % next(args))
+            else:
+                raise SimError(f'printf: unsupported conversion %{conv}')
+        text = ''.join(out)
+        self.out.append(text)
+        return len(text)
+
+    def host(self, name):
+        r = self.r
+        a = self.arg_words()
+        if name == 'printf':
+            r[0] = self.printf(a)
+        elif name == 'putchar':
+            self.out.append(chr(r[0] & 0xff))
+        elif name == 'puts':
+            self.out.append(self.cstr(r[0]) + '\n')
+        elif name in ('__rt_stkovf_split_small', '__rt_stkovf_split_big'):
+            pass
+        elif name in ('__rt_sdiv', '__rt_udiv', 'x$divide', 'x$udivide'):
+            d, n = r[0], r[1]
+            if d == 0:
+                raise SimError('division by zero')
+            if name in ('__rt_sdiv', 'x$divide'):
+                q = abs(s32(n)) // abs(s32(d))
+                if (s32(n) < 0) != (s32(d) < 0): q = -q
+                r[0], r[1] = q & M32, (s32(n) - q * s32(d)) & M32
+            else:
+                r[0], r[1] = n // d, n % d
+        elif name == '__rt_sdiv10':
+            q = abs(s32(r[0])) // 10
+            if s32(r[0]) < 0: q = -q
+            r[0], r[1] = q & M32, (s32(r[0]) - 10 * q) & M32
+        elif name == '__rt_udiv10':
+            r[0], r[1] = r[0] // 10, r[0] % 10
+        elif name in ('memcpy', 'memmove'):
+            dst, src, n = r[0], r[1], r[2]
+            self.chk(dst, n); self.chk(src, n)
+            self.mem[dst:dst + n] = self.mem[src:src + n]
+        elif name == 'memset':
+            self.chk(r[0], r[2])
+            self.mem[r[0]:r[0] + r[2]] = bytes([r[1] & 0xff]) * r[2]
+        elif name == 'strlen':
+            r[0] = len(self.cstr(r[0]))
+        elif name == 'malloc':
+            p = self.heap
+            self.heap = (self.heap + r[0] + 15) & ~15
+            if self.heap >= STACKTOP - 0x10000:
+                raise SimError('out of memory')
+            r[0] = p
+        elif name == 'free':
+            pass
+        elif name == 'sim_fpscr':
+            r[0] = self.fpscr
+        elif name == 'exit':
+            raise SystemExit(self.flush() or (r[0] & 0xff))
+        elif name == 'abort':
+            raise SimError('abort() called')
+        elif name in ('sqrt', 'fabs'):
+            x = bits_f64(self.gd(0))
+            self.sd(0, f64_bits(math.sqrt(x) if name == 'sqrt' else abs(x)))
+        elif name in ('sqrtf', 'fabsf'):
+            x = bits_f32(self.gs(0))
+            self.ss(0, f32_bits(math.sqrt(x) if name == 'sqrtf' else abs(x)))
+        else:
+            raise SimError(f'call to undefined function {name}')
+
+    def flush(self):
+        sys.stdout.write(''.join(self.out))
+        sys.stdout.flush()
+        self.out = []
+        return 0
+
+def main(argv):
+    trace = False
+    areas = False
+    steps = 50_000_000
+    files = []
+    it = iter(argv)
+    for a in it:
+        if a == '-t':
+            trace = True
+        elif a == '--areas':
+            areas = True
+        elif a == '--steps':
+            steps = int(next(it))
+        else:
+            files.append(a)
+    if not files:
+        print('usage: armsim.py [-t] [--steps N] file.o ...', file=sys.stderr)
+        return 2
+    if areas:
+        show_areas(files)
+        return 0
+    sim = Sim(trace)
+    try:
+        entry, stubs, heap = link(files, sim.mem)
+        rc = sim.run(entry, stubs, heap, steps)
+    except SimError as e:
+        sim.flush()
+        print(f'armsim: {e}', file=sys.stderr)
+        return 3
+    sim.flush()
+    return rc & 0xff
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
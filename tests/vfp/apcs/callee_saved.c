@@ -0,0 +1,15 @@
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfp
+
+extern double h(double);
+
+// D8-D15 are callee-saved: a value live across a call is kept there
+// and the register is saved on entry and reloaded from the frame.
+// CHECK-LABEL: keep:
+// CHECK: vpush           {d8}
+// CHECK: vmov.f64        d8, d0
+// CHECK: bl              h
+// CHECK: vadd.f64        d0, d0, d8
+// CHECK: vldr            d8, [fp
+double keep(double a) {
+    return h(a) + a;
+}
@@ -0,0 +1,68 @@
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfp %s -c -o %t.o && %armsim %t.o
+
+// Arguments past the eight in D0-D7 go in the integer registers and then
+// on the stack, and a double can be split between r3 and the stack. Each
+// function must find every argument, whether or not it has a frame and
+// whether or not an argument's address is taken, and a function which
+// uses the scratch register D15 must leave the caller's D15 alone.
+
+// CHECK: arguments ok
+
+extern int printf(const char *, ...);
+
+static int bad;
+
+static void check(char const *what, double got, double want)
+{
+    if (got != want) {
+        printf("%s: %f, expected %f\n", what, got, want);
+        bad++;
+    }
+}
+
+static int touch(void) { return 0; }
+
+float f13(float a, float b, float c, float d, float e, float f, float g,
+          float h, float i, float j, float k, float l, float m)
+{
+    return a*1 + b*2 + c*3 + d*4 + e*5 + f*6 + g*7 + h*8 + i*9 + j*10 +
+           k*11 + l*12 + m*13;
+}
+
+/* The tenth double is split between r3 and the stack.                 */
+double d10(int x, double a, double b, double c, double d, double e,
+           double f, double g, double h, double i, double j, int y)
+{
+    touch();
+    return x*1000 + y + a*1 + b*2 + c*3 + d*4 + e*5 + f*6 + g*7 + h*8 +
+           i*9 + j*10;
+}
+
+double mixed(float a, double b, float c, double d, float e, double f,
+             float g, double h, float i, double j, float k)
+{
+    return a*1 + b*2 + c*3 + d*4 + e*5 + f*6 + g*7 + h*8 + i*9 + j*10 +
+           k*11;
+}
+
+/* Taking an argument's address makes the function save the argument   */
+/* registers, a word per float and two per double.                     */
+double addr(float a, double b, float c, double d)
+{
+    float *pa = &a, *pc = &c;
+    double *pb = &b, *pd = &d;
+    return *pa * 1000 + *pb * 100 + *pc * 10 + *pd;
+}
+
+int round_trip(double x) { touch(); return (int)(x * 0.5); }
+
+int main(void)
+{
+    check("f13", f13(1,2,3,4,5,6,7,8,9,10,11,12,13), 819);
+    check("d10", d10(7, 1,2,3,4,5,6,7,8,9,10, 3), 7003 + 385);
+    check("mixed", mixed(1,2,3,4,5,6,7,8,9,10,11), 506);
+    check("addr", addr(4, 3, 2, 1), 4321);
+    check("round_trip", round_trip(9.0), 4);
+    if (bad == 0) printf("arguments ok\n");
+    return bad;
+}
@@ -40,8 +40,8 @@ double sumd(int n, ...)
     // CHECK: add    r0, r0, #8
 
     // CHECK: vldr    d1, [r0,
-    // CHECK: vadd.f64    d0, d1, d0
     // CHECK: add    r1, r1, #1
+    // CHECK: vadd.f64    d0, d1, d0
     for (i = 0; i < n; i++)
         s += va_arg(ap, double);
 
@@ -0,0 +1,93 @@
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfp %s -S -o -
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfp %s -c -o %t.o && %armsim %t.o
+
+// Loops whose loads are issued an iteration early must give the same
+// answers as the original loop for every trip count, including none and
+// one, counting up or down, in steps of more than one and with the
+// induction variable on either side of the compare.  A loop which stores
+// to the array it loads from is left alone.
+
+// The first iteration's loads are done before the loop, the last
+// iteration's arithmetic after it.
+// CHECK: sum_static
+// CHECK: vldr
+// CHECK: bge
+// CHECK: vldr
+// CHECK: blt
+// CHECK: vadd.f32
+// CHECK: dot
+// CHECK: recur
+// CHECK: blt
+// CHECK-NO: vstr
+// CHECK: check
+// CHECK: pipeline ok
+
+extern int printf(const char *, ...);
+
+#define N 24
+
+static float a[N], b[N];
+static double d[N];
+static int bad;
+
+float sum_static(int n)
+    { int i; float s = 0; for (i = 0; i < n; i++) s += a[i]; return s; }
+float dot(float *x, float *y, int n)
+    { int i; float s = 0; for (i = 0; i < n; i++) s += x[i] * y[i]; return s; }
+float sum_down(float *x, int n)
+    { int i; float s = 0; for (i = n-1; i >= 0; i--) s += x[i]; return s; }
+float sum_step2(float *x, int n)
+    { int i; float s = 0; for (i = 0; i < n; i += 2) s += x[i]; return s; }
+float sum_ne(float *x, int k, int n)
+    { int i; float s = 0; for (i = k; n != i; i++) s += 2.0f * x[i]; return s; }
+double sum_d(int n)
+    { int i; double s = 0; for (i = 0; i < n; i++) s += d[i] * 0.5; return s; }
+void scale(float k, int n)
+    { int i; for (i = 0; i < n; i++) b[i] = a[i] * k; }
+void recur(int n)
+    { int i; for (i = 0; i < n; i++) b[i+1] = b[i] * 2.0f + 1.0f; }
+
+static void check(char const *what, int n, double got, double want)
+{
+    if (got != want) {
+        printf("%s n=%d: %f, expected %f\n", what, n, got, want);
+        bad++;
+    }
+}
+
+int main(void)
+{
+    int n, i;
+    for (i = 0; i < N; i++) {
+        a[i] = (float)(i + 1);
+        d[i] = (double)(3 * i);
+    }
+    for (n = 0; n < N; n++) {
+        int s = 0, s2 = 0, sd = 0, sne = 0, sdot = 0;
+        for (i = 0; i < n; i++) {
+            s += i + 1;
+            sdot += (i + 1) * (i + 1);
+            sd += 3 * i;
+            if ((i & 1) == 0) s2 += i + 1;
+            if (i >= 3) sne += 2 * (i + 1);
+        }
+        check("sum_static", n, sum_static(n), s);
+        check("dot", n, dot(a, a, n), sdot);
+        check("sum_down", n, sum_down(a, n), s);
+        check("sum_step2", n, sum_step2(a, n), s2);
+        if (n > 3) check("sum_ne", n, sum_ne(a, 3, n), sne);
+        check("sum_d", n, sum_d(n), sd * 0.5);
+
+        for (i = 0; i < N; i++) b[i] = -1.0f;
+        scale(3.0f, n);
+        for (i = 0; i < N; i++)
+            check("scale", n, b[i], i < n ? 3.0f * (i + 1) : -1.0f);
+
+        for (i = 0; i < N; i++) b[i] = 0.0f;
+        recur(n < N-1 ? n : N-1);
+        for (i = 0; i < N; i++)
+            check("recur", n, b[i], i <= n ? (float)((1 << i) - 1) : 0.0f);
+    }
+    if (bad == 0) printf("pipeline ok\n");
+    return bad;
+}
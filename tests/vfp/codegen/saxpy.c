@@ -5,14 +5,15 @@
 // CHECK: mov     r3, #0
 // CHECK: cmp     r2, #0
 // CHECK: movle   pc, lr
+// The loop body is scheduled so the loads and the multiply overlap.
 // CHECK: add     ip, r0, r3, lsl #2
 // CHECK: vldr    s2, [ip]
-// CHECK: vmul.f32        s2, s2, s0
 // CHECK: add     ip, r1, r3, lsl #2
+// CHECK: vmul.f32        s2, s2, s0
 // CHECK: vldr    s4, [ip]
+// CHECK: add     r3, r3, #1
 // CHECK: vadd.f32        s2, s2, s4
 // CHECK: vstr    s2, [ip]
-// CHECK: add     r3, r3, #1
 // CHECK: cmp     r3, r2
 // CHECK: blt     
 
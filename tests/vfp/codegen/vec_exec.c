@@ -0,0 +1,156 @@
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfpv2 %s -c -o %t.o && %armsim %t.o
+
+// Runs the elementwise short-vector kernels against the scalar result for
+// every count from 0 to 21 (empty, fewer than one vector, whole vectors
+// and every remainder), from a start index which is not a multiple of the
+// vector length, and with overlapping arrays which the kernel must leave
+// to the scalar loop. FPSCR.LEN/STRIDE must be back to zero afterwards
+// whichever way the kernel was left.
+
+// CHECK: elementwise ok
+
+extern int printf(const char *, ...);
+extern unsigned sim_fpscr(void);
+
+#define N 40
+#define LENSTRIDE 0x00370000u
+
+static float xf[N], yf[N], zf[N], rf[N];
+static double xd[N], yd[N], zd[N], rd[N];
+static int bad;
+
+static void fpscr_clear(char const *what, int n)
+{
+    if (sim_fpscr() & LENSTRIDE) {
+        printf("%s n=%d: FPSCR 0x%x\n", what, n, sim_fpscr());
+        bad++;
+    }
+}
+
+static void setf(void)
+{
+    int i;
+    for (i = 0; i < N; ++i) {
+        xf[i] = (float)(i + 1) * 0.5f;
+        yf[i] = (float)(3 * i - 7);
+        zf[i] = (float)(i % 5) - 2.0f;
+        xd[i] = (double)(i + 1) * 0.25;
+        yd[i] = (double)(7 - 2 * i);
+        zd[i] = (double)(i % 3) + 1.5;
+    }
+}
+
+void mlaf(float *x, float *y, int n, float a)
+    { int i; for (i = 0; i < n; ++i) y[i] = a * x[i] + y[i]; }
+void scalef(float *x, float *y, int n, float a)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] * a; }
+void addf(float *x, float *z, float *y, int n)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] + z[i]; }
+void subf(float *x, float *z, float *y, int n)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] - z[i]; }
+void mulf(float *x, float *z, float *y, int n)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] * z[i]; }
+void mlad(double *x, double *y, int n, double a)
+    { int i; for (i = 0; i < n; ++i) y[i] = a * x[i] + y[i]; }
+void addd(double *x, double *z, double *y, int n)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] + z[i]; }
+void muld(double *x, double *z, double *y, int n)
+    { int i; for (i = 0; i < n; ++i) y[i] = x[i] * z[i]; }
+
+/* Starts at k, so the kernel sees a count of n-k from an odd address.  */
+void mlaf_from(float *x, float *y, int k, int n, float a)
+    { int i; for (i = k; i < n; ++i) y[i] = a * x[i] + y[i]; }
+
+static void checkf(char const *what, int n, int k)
+{
+    int i;
+    for (i = 0; i < N; ++i)
+        if (yf[i] != rf[i]) {
+            printf("%s n=%d k=%d: y[%d] = %f, expected %f\n",
+                   what, n, k, i, (double)yf[i], (double)rf[i]);
+            bad++;
+            return;
+        }
+    fpscr_clear(what, n);
+}
+
+static void checkd(char const *what, int n)
+{
+    int i;
+    for (i = 0; i < N; ++i)
+        if (yd[i] != rd[i]) {
+            printf("%s n=%d: y[%d] = %f, expected %f\n",
+                   what, n, i, yd[i], rd[i]);
+            bad++;
+            return;
+        }
+    fpscr_clear(what, n);
+}
+
+int main(void)
+{
+    int n, k, i;
+    for (n = 0; n <= 21; ++n) {
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = i < n ? 1.5f * xf[i] + yf[i] : yf[i];
+        mlaf(xf, yf, n, 1.5f);
+        checkf("mlaf", n, 0);
+
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = i < n ? xf[i] * -3.0f : yf[i];
+        scalef(xf, yf, n, -3.0f);
+        checkf("scalef", n, 0);
+
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = i < n ? xf[i] + zf[i] : yf[i];
+        addf(xf, zf, yf, n);
+        checkf("addf", n, 0);
+
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = i < n ? xf[i] - zf[i] : yf[i];
+        subf(xf, zf, yf, n);
+        checkf("subf", n, 0);
+
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = i < n ? xf[i] * zf[i] : yf[i];
+        mulf(xf, zf, yf, n);
+        checkf("mulf", n, 0);
+
+        for (k = 1; k < 4; ++k) {
+            setf();
+            for (i = 0; i < N; ++i)
+                rf[i] = i >= k && i < n ? 0.5f * xf[i] + yf[i] : yf[i];
+            mlaf_from(xf, yf, k, n, 0.5f);
+            checkf("mlaf_from", n, k);
+        }
+
+        setf();
+        for (i = 0; i < N; ++i) rd[i] = i < n ? 2.5 * xd[i] + yd[i] : yd[i];
+        mlad(xd, yd, n, 2.5);
+        checkd("mlad", n);
+
+        setf();
+        for (i = 0; i < N; ++i) rd[i] = i < n ? xd[i] + zd[i] : yd[i];
+        addd(xd, zd, yd, n);
+        checkd("addd", n);
+
+        setf();
+        for (i = 0; i < N; ++i) rd[i] = i < n ? xd[i] * zd[i] : yd[i];
+        muld(xd, zd, yd, n);
+        checkd("muld", n);
+    }
+
+    /* y one element past x: each element depends on the one before, so */
+    /* this must be done one at a time.                                  */
+    for (n = 0; n <= 21; ++n) {
+        setf();
+        for (i = 0; i < N; ++i) rf[i] = xf[i];
+        for (i = 0; i < n; ++i) rf[i+1] = 2.0f * rf[i] + rf[i+1];
+        for (i = 0; i < N; ++i) yf[i] = xf[i];
+        mlaf(yf, yf + 1, n, 2.0f);
+        checkf("mlaf overlap", n, 0);
+    }
+
+    if (bad == 0) printf("elementwise ok\n");
+    return bad;
+}
@@ -0,0 +1,128 @@
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfpv2 %s -S -o -
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfpv2 %s -c -o %t.o && %armsim %t.o
+
+// Loops which leave early or call out stay scalar; they must still give
+// the right answers next to loops which are vectorised, and functions
+// called from a loop around a vectorised one must run with FPSCR.LEN = 0
+// as the calling standard requires.
+
+// CHECK: mla_until
+// CHECK-NO: vmsr
+// CHECK: vmla_ret
+// CHECK-NO: vmsr
+// CHECK: mla_call
+// CHECK-NO: vmsr
+// CHECK: mlaf
+// CHECK: vmsr
+// CHECK: scalar ok
+
+extern int printf(const char *, ...);
+extern unsigned sim_fpscr(void);
+
+#define N 40
+#define LENSTRIDE 0x00370000u
+
+static float x[N], y[N], r[N];
+static int bad, calls;
+
+static void setup(void)
+{
+    int i;
+    for (i = 0; i < N; ++i) {
+        x[i] = (float)(i - 11);
+        y[i] = (float)(2 * i + 1);
+    }
+}
+
+static void callee(void)
+{
+    ++calls;
+    if (sim_fpscr() & LENSTRIDE) {
+        printf("callee: FPSCR 0x%x\n", sim_fpscr());
+        bad++;
+    }
+}
+
+/* Stops at the first non-negative x.                                   */
+int mla_until(float *x, float *y, int n, float a)
+{
+    int i;
+    for (i = 0; i < n; ++i) {
+        if (x[i] >= 0.0f) break;
+        y[i] = a * x[i] + y[i];
+    }
+    return i;
+}
+
+int vmla_ret(float *x, float *y, int n, float a)
+{
+    int i;
+    for (i = 0; i < n; ++i) {
+        if (y[i] > 30.0f) return i;
+        y[i] = a * x[i] + y[i];
+    }
+    return -1;
+}
+
+void mla_call(float *x, float *y, int n, float a)
+{
+    int i;
+    for (i = 0; i < n; ++i) {
+        y[i] = a * x[i] + y[i];
+        callee();
+    }
+}
+
+void mlaf(float *x, float *y, int n, float a)
+    { int i; for (i = 0; i < n; ++i) y[i] = a * x[i] + y[i]; }
+
+static void check(char const *what, int n, int got, int want)
+{
+    int i;
+    if (got != want) {
+        printf("%s n=%d: returned %d, expected %d\n", what, n, got, want);
+        bad++;
+    }
+    for (i = 0; i < N; ++i)
+        if (y[i] != r[i]) {
+            printf("%s n=%d: y[%d] = %f, expected %f\n",
+                   what, n, i, (double)y[i], (double)r[i]);
+            bad++;
+            return;
+        }
+}
+
+int main(void)
+{
+    int n, i, j, stop;
+    for (n = 0; n <= 21; ++n) {
+        setup();
+        stop = n < 11 ? n : 11;
+        for (i = 0; i < N; ++i) r[i] = i < stop ? 2.0f * x[i] + y[i] : y[i];
+        check("mla_until", n, mla_until(x, y, n, 2.0f), stop);
+
+        setup();
+        /* y[i] = 2i+1 > 30 first at i = 15.                             */
+        stop = n <= 15 ? n : 15;
+        for (i = 0; i < N; ++i) r[i] = i < stop ? 3.0f * x[i] + y[i] : y[i];
+        check("vmla_ret", n, vmla_ret(x, y, n, 3.0f), n <= 15 ? -1 : 15);
+
+        setup();
+        calls = 0;
+        for (i = 0; i < N; ++i) r[i] = i < n ? -1.0f * x[i] + y[i] : y[i];
+        mla_call(x, y, n, -1.0f);
+        check("mla_call", n, calls, n);
+
+        /* The vectorised loop inside a loop which calls out.            */
+        setup();
+        for (i = 0; i < N; ++i) r[i] = y[i];
+        for (j = 0; j < 3; ++j) {
+            for (i = 0; i < N; ++i) if (i < n) r[i] = 0.5f * x[i] + r[i];
+            mlaf(x, y, n, 0.5f);
+            callee();
+        }
+        check("mlaf", n, 0, 0);
+    }
+    if (bad == 0) printf("scalar ok\n");
+    return bad;
+}
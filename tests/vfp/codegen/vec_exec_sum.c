@@ -0,0 +1,73 @@
+// RUN: %cc -apcs 3/32bit/fpregargs/narrow -fpu vfpv2 --fp-reassociate %s -c -o %t.o && %armsim %t.o
+
+// Runs the sum and dot product kernels for every count from 0 to 21 and
+// from starts which are not a multiple of the vector length. The data are
+// small integers, so every order of additions gives the same result and
+// it can be compared exactly with a sum done one element at a time.
+
+// CHECK: reductions ok
+
+extern int printf(const char *, ...);
+extern unsigned sim_fpscr(void);
+
+#define N 40
+#define LENSTRIDE 0x00370000u
+
+static float xf[N], zf[N];
+static double xd[N], zd[N];
+static int bad;
+
+float sumf(float *p, int n)
+    { float s = 0.0f; int i; for (i = 0; i < n; ++i) s += p[i]; return s; }
+float sumf_from(float *p, int k, int n, float s)
+    { int i; for (i = k; i < n; ++i) s += p[i]; return s; }
+float dotf(float *p, float *q, int n)
+    { float s = 0.0f; int i; for (i = 0; i < n; ++i) s += p[i] * q[i]; return s; }
+double sumd(double *p, int n)
+    { double s = 0.0; int i; for (i = 0; i < n; ++i) s += p[i]; return s; }
+double dotd(double *p, double *q, int n)
+    { double s = 0.0; int i; for (i = 0; i < n; ++i) s = s + p[i] * q[i]; return s; }
+
+static void check(char const *what, int n, int k, double got, double want)
+{
+    if (got != want) {
+        printf("%s n=%d k=%d: %f, expected %f\n", what, n, k, got, want);
+        bad++;
+    }
+    if (sim_fpscr() & LENSTRIDE) {
+        printf("%s n=%d: FPSCR 0x%x\n", what, n, sim_fpscr());
+        bad++;
+    }
+}
+
+int main(void)
+{
+    int n, k, i;
+    double ws, wd, vs, vd;
+    for (i = 0; i < N; ++i) {
+        xf[i] = (float)(i * 3 - 20);
+        zf[i] = (float)(i % 7 - 3);
+        xd[i] = (double)(17 - i * 2);
+        zd[i] = (double)(i % 4 + 1);
+    }
+    for (n = 0; n <= 21; ++n) {
+        ws = wd = vs = vd = 0.0;
+        for (i = 0; i < n; ++i) {
+            ws += xf[i];
+            wd += xf[i] * zf[i];
+            vs += xd[i];
+            vd += xd[i] * zd[i];
+        }
+        check("sumf", n, 0, sumf(xf, n), ws);
+        check("dotf", n, 0, dotf(xf, zf, n), wd);
+        check("sumd", n, 0, sumd(xd, n), vs);
+        check("dotd", n, 0, dotd(xd, zd, n), vd);
+        for (k = 1; k < 4; ++k) {
+            ws = 100.0;
+            for (i = k; i < n; ++i) ws += xf[i];
+            check("sumf_from", n, k, sumf_from(xf, k, n, 100.0f), ws);
+        }
+    }
+    if (bad == 0) printf("reductions ok\n");
+    return bad;
+}
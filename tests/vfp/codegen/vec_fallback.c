@@ -0,0 +1,48 @@
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfpv2
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfp
+
+// Loops the short-vector kernels cannot do stay scalar, as does
+// everything without -fpu vfpv2 (VFPv3 has no short vectors).
+
+// CHECK: shifted
+// CHECK-NO: vmsr
+// CHECK: vldr
+// CHECK: blt
+// CHECK: stride
+// CHECK-NO: vmsr
+// CHECK: vldr
+// CHECK: blt
+// CHECK: divide
+// CHECK-NO: vmsr
+// CHECK: vdiv.f32
+// CHECK: saxpy
+// CHECK: vmsr    fpscr, ip
+
+// -fpu vfp
+// CHECK: shifted
+// CHECK: stride
+// CHECK: divide
+// CHECK: saxpy
+// CHECK-NO: vmsr
+// CHECK: vmul.f32
+// CHECK: blt
+
+void shifted(float *x, int n) {
+    int i;
+    for (i = 0; i < n; i++) x[i] = x[i+1];
+}
+
+void stride(float *x, float *y, int n, float a) {
+    int i;
+    for (i = 0; i < n; i += 2) y[i] = a * x[i] + y[i];
+}
+
+void divide(float *x, float *z, float *y, int n) {
+    int i;
+    for (i = 0; i < n; i++) y[i] = x[i] / z[i];
+}
+
+void saxpy(float *x, float *y, int n, float a) {
+    int i;
+    for (i = 0; i < n; i++) y[i] = a * x[i] + y[i];
+}
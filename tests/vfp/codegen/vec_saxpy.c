@@ -0,0 +1,48 @@
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfpv2
+
+// With -fpu vfpv2 whole vectors of eight are done in short-vector mode
+// (FPSCR.LEN = 8) and the original loop finishes off the remainder.
+
+// CHECK: saxpy
+// The kernel declines if y starts inside the first vector past x.
+// CHECK: sub     ip, r1, r0
+// CHECK: cmp     ip, #31
+// CHECK: movcc   r2, #0
+// CHECK: cmp     r2, #8
+// CHECK: bic     r2, r2, #7
+// CHECK: vmrs    ip, fpscr
+// CHECK: orr     ip, ip, #458752
+// CHECK: vmsr    fpscr, ip
+// CHECK: vldmia  r0!, {s24-s31}
+// CHECK: vldmia  r1, {s16-s23}
+// CHECK: vmla.f32        s16, s24, s0
+// CHECK: vstmia  r1!, {s16-s23}
+// CHECK: subs    ip, ip, #8
+// CHECK: vmsr    fpscr, ip
+// Scalar epilogue.
+// CHECK: vmul.f32
+// CHECK: vadd.f32
+// CHECK: vstr
+
+void saxpy(float *x, float *y, int n, float a) {
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        y[i] = a * x[i] + y[i];
+    }
+}
+
+// CHECK: vsubd
+// CHECK: orr     ip, ip, #196608
+// CHECK: vldmia  r0!, {d8-d11}
+// CHECK: vldmia  r1!, {d12-d15}
+// CHECK: vsub.f64        d8, d8, d12
+// CHECK: vstmia  r2!, {d8-d11}
+// CHECK: subs    ip, ip, #4
+
+void vsubd(double *x, double *z, double *y, int n) {
+    int i;
+
+    for (i = 0; i < n; i++)
+        y[i] = x[i] - z[i];
+}
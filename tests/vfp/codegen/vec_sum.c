@@ -0,0 +1,52 @@
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfpv2 --fp-reassociate
+
+// Reductions keep VL partial sums in s8-s15 (d4-d7) and add them
+// pairwise at the end, so the additions are reassociated: this needs
+// --fp-reassociate.
+
+// D8-D15 are callee-saved, so the kernel preserves them.
+// CHECK: sumf
+// CHECK: vpush   {d8-d15}
+// CHECK: cmp     r1, #8
+// CHECK: vmsr    fpscr, ip
+// CHECK: vldmia  r0!, {s8-s15}
+// CHECK: vldmia  r0!, {s16-s23}
+// CHECK: vadd.f32        s8, s8, s16
+// CHECK: vmsr    fpscr, ip
+// CHECK: vadd.f32        s8, s8, s9
+// CHECK: vadd.f32        s8, s8, s12
+// CHECK: vadd.f32        s0, s0, s8
+// CHECK: vpop    {d8-d15}
+// The loop resumes from the first element not summed.
+// CHECK: bic     r0, r4, #7
+// CHECK: vadd.f32
+
+float sumf(float *p, int n) {
+    float s = 0.0f;
+    int i;
+
+    for (i = 0; i < n; ++i) {
+        s += p[i];
+    }
+
+    return s;
+}
+
+// CHECK: dot
+// CHECK: vldmia  r0!, {d8-d11}
+// CHECK: vldmia  r1!, {d12-d15}
+// CHECK: vmul.f64        d4, d8, d12
+// CHECK: vmla.f64        d4, d8, d12
+// CHECK: vadd.f64        d0, d0, d4
+// CHECK: bic     r0, r4, #3
+// CHECK: vmul.f64
+// CHECK: vadd.f64
+
+double dot(double *x, double *y, int n) {
+    double s = 0;
+    int i;
+
+    for (i = 0; i < n; i++)
+        s += x[i] * y[i];
+    return s;
+}
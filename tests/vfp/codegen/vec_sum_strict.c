@@ -0,0 +1,27 @@
+// RUN: %cc %s -S -o - -apcs 3/32bit/fpregargs/narrow -fpu vfpv2
+
+// Without --fp-reassociate a reduction keeps its order of additions, so
+// it stays a scalar loop; elementwise loops still use the kernels.
+
+// CHECK: sumf
+// CHECK-NO: vmsr    fpscr
+// CHECK: vadd.f32
+// CHECK: add3
+// CHECK: vmsr    fpscr
+// CHECK: END
+
+float sumf(float *p, int n) {
+    float s = 0.0f;
+    int i;
+
+    for (i = 0; i < n; ++i)
+        s += p[i];
+    return s;
+}
+
+void add3(float *y, float *x, float *z, int n) {
+    int i;
+
+    for (i = 0; i < n; ++i)
+        y[i] = x[i] + z[i];
+}